@@ -0,0 +1,493 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#ifndef ARF_H
+#define ARF_H
+
+#include "fmpr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+  An arf_struct holds a floating-point number x = (-1)^s * m * 2^e where
+  1/2 <= m < 1 is a fraction with a finite binary expansion. The fraction
+  is stored as an unsigned, top-aligned array of limbs (the top bit of the
+  most significant limb is always set, and the least significant limb
+  is always nonzero).
+
+  The size field encodes (number of limbs << 1) | sign. A mantissa of a
+  single limb is stored inline; a mantissa of two or more limbs is stored
+  in a separately allocated (and recycled) limb array whose allocation size
+  is kept in the limb preceding the data.
+
+  Special values are encoded by a size of zero, the exponent then
+  determining the value.
+*/
+
+#define ARF_EXP_ZERO 0L
+#define ARF_EXP_POS_INF 1L
+#define ARF_EXP_NEG_INF 2L
+#define ARF_EXP_NAN 3L
+
+typedef union
+{
+    mp_limb_t d;
+    mp_ptr ptr;
+}
+arf_mantissa_struct;
+
+typedef struct
+{
+    fmpz exp;
+    mp_size_t size;
+    arf_mantissa_struct d;
+}
+arf_struct;
+
+typedef arf_struct arf_t[1];
+typedef arf_struct * arf_ptr;
+typedef const arf_struct * arf_srcptr;
+
+#define ARF_EXP(x) ((x)->exp)
+#define ARF_EXPREF(x) (&(x)->exp)
+#define ARF_XSIZE(x) ((x)->size)
+
+#define ARF_MAKE_XSIZE(size, sgnbit) ((((mp_size_t) size) << 1) | (sgnbit))
+#define ARF_SIZE(x) (ARF_XSIZE(x) >> 1)
+#define ARF_SGNBIT(x) (ARF_XSIZE(x) & 1)
+#define ARF_NEG(x) (ARF_XSIZE(x) ^= 1)
+
+#define ARF_HAS_PTR(x) (ARF_XSIZE(x) > ARF_MAKE_XSIZE(1, 1))
+#define ARF_NOPTR_D(x) (&(x)->d.d)
+#define ARF_PTR_D(x) ((x)->d.ptr)
+#define ARF_PTR_ALLOC(x) ((mp_size_t) ((x)->d.ptr[-1]))
+
+/* Mantissas with at most this many limbs are recycled on release. */
+#define ARF_RECYCLE_LIMBS 8
+#define ARF_RECYCLE_COUNT 64
+
+mp_ptr _arf_limbs_alloc(mp_size_t n);
+
+void _arf_limbs_free(mp_ptr ptr);
+
+/* Releases the limb array (if any); the size field is left untouched. */
+#define ARF_DEMOTE(x) \
+    do { \
+        if (ARF_HAS_PTR(x)) \
+        { \
+            _arf_limbs_free(ARF_PTR_D(x)); \
+            ARF_XSIZE(x) = 0; \
+        } \
+    } while (0)
+
+/* Gets a pointer to the limbs of x for reading. */
+#define ARF_GET_MPN_READONLY(xptr, xn, x) \
+    do { \
+        xn = ARF_SIZE(x); \
+        if (xn <= 1) \
+            xptr = ARF_NOPTR_D(x); \
+        else \
+            xptr = ARF_PTR_D(x); \
+    } while (0)
+
+/* Makes room for n limbs in x and sets the size (with positive sign);
+   the previous mantissa is destroyed. */
+#define ARF_GET_MPN_WRITE(xptr, n, x) \
+    do { \
+        mp_size_t __n = (n); \
+        if (__n <= 1) \
+        { \
+            ARF_DEMOTE(x); \
+            xptr = ARF_NOPTR_D(x); \
+        } \
+        else \
+        { \
+            if (!ARF_HAS_PTR(x)) \
+            { \
+                ARF_PTR_D(x) = _arf_limbs_alloc(__n); \
+            } \
+            else if (ARF_PTR_ALLOC(x) < __n) \
+            { \
+                _arf_limbs_free(ARF_PTR_D(x)); \
+                ARF_PTR_D(x) = _arf_limbs_alloc(__n); \
+            } \
+            xptr = ARF_PTR_D(x); \
+        } \
+        ARF_XSIZE(x) = ARF_MAKE_XSIZE(__n, 0); \
+    } while (0)
+
+static __inline__ void
+arf_init(arf_t x)
+{
+    fmpz_init(ARF_EXPREF(x));
+    ARF_XSIZE(x) = 0;
+}
+
+static __inline__ void
+arf_clear(arf_t x)
+{
+    ARF_DEMOTE(x);
+    fmpz_clear(ARF_EXPREF(x));
+}
+
+/* Special values */
+
+static __inline__ void
+arf_zero(arf_t x)
+{
+    ARF_DEMOTE(x);
+    ARF_XSIZE(x) = 0;
+    fmpz_zero(ARF_EXPREF(x));
+}
+
+static __inline__ void
+arf_pos_inf(arf_t x)
+{
+    ARF_DEMOTE(x);
+    ARF_XSIZE(x) = 0;
+    fmpz_set_si(ARF_EXPREF(x), ARF_EXP_POS_INF);
+}
+
+static __inline__ void
+arf_neg_inf(arf_t x)
+{
+    ARF_DEMOTE(x);
+    ARF_XSIZE(x) = 0;
+    fmpz_set_si(ARF_EXPREF(x), ARF_EXP_NEG_INF);
+}
+
+static __inline__ void
+arf_nan(arf_t x)
+{
+    ARF_DEMOTE(x);
+    ARF_XSIZE(x) = 0;
+    fmpz_set_si(ARF_EXPREF(x), ARF_EXP_NAN);
+}
+
+static __inline__ int
+arf_is_special(const arf_t x)
+{
+    return ARF_XSIZE(x) == 0;
+}
+
+static __inline__ int
+arf_is_normal(const arf_t x)
+{
+    return ARF_XSIZE(x) != 0;
+}
+
+static __inline__ int
+arf_is_zero(const arf_t x)
+{
+    return arf_is_special(x) && ARF_EXP(x) == ARF_EXP_ZERO;
+}
+
+static __inline__ int
+arf_is_pos_inf(const arf_t x)
+{
+    return arf_is_special(x) && ARF_EXP(x) == ARF_EXP_POS_INF;
+}
+
+static __inline__ int
+arf_is_neg_inf(const arf_t x)
+{
+    return arf_is_special(x) && ARF_EXP(x) == ARF_EXP_NEG_INF;
+}
+
+static __inline__ int
+arf_is_nan(const arf_t x)
+{
+    return arf_is_special(x) && ARF_EXP(x) == ARF_EXP_NAN;
+}
+
+static __inline__ int
+arf_is_inf(const arf_t x)
+{
+    return arf_is_pos_inf(x) || arf_is_neg_inf(x);
+}
+
+static __inline__ int
+arf_is_finite(const arf_t x)
+{
+    return arf_is_normal(x) || arf_is_zero(x);
+}
+
+static __inline__ void
+arf_one(arf_t x)
+{
+    ARF_DEMOTE(x);
+    ARF_XSIZE(x) = ARF_MAKE_XSIZE(1, 0);
+    ARF_NOPTR_D(x)[0] = 1UL << (FLINT_BITS - 1);
+    fmpz_set_ui(ARF_EXPREF(x), 1);
+}
+
+static __inline__ int
+arf_is_one(const arf_t x)
+{
+    return ARF_XSIZE(x) == ARF_MAKE_XSIZE(1, 0)
+        && ARF_NOPTR_D(x)[0] == (1UL << (FLINT_BITS - 1))
+        && fmpz_is_one(ARF_EXPREF(x));
+}
+
+/* Assignment and comparisons */
+
+static __inline__ void
+arf_set(arf_t y, const arf_t x)
+{
+    if (y != x)
+    {
+        mp_size_t n = ARF_SIZE(x);
+
+        if (n <= 1)
+        {
+            ARF_DEMOTE(y);
+            ARF_NOPTR_D(y)[0] = ARF_NOPTR_D(x)[0];
+        }
+        else
+        {
+            mp_ptr yptr;
+            ARF_GET_MPN_WRITE(yptr, n, y);
+            flint_mpn_copyi(yptr, ARF_PTR_D(x), n);
+        }
+
+        ARF_XSIZE(y) = ARF_XSIZE(x);
+        fmpz_set(ARF_EXPREF(y), ARF_EXPREF(x));
+    }
+}
+
+static __inline__ void
+arf_swap(arf_t x, arf_t y)
+{
+    arf_struct t = *x;
+    *x = *y;
+    *y = t;
+}
+
+static __inline__ void
+arf_neg(arf_t y, const arf_t x)
+{
+    arf_set(y, x);
+
+    if (arf_is_special(y))
+    {
+        if (arf_is_pos_inf(y))
+            fmpz_set_si(ARF_EXPREF(y), ARF_EXP_NEG_INF);
+        else if (arf_is_neg_inf(y))
+            fmpz_set_si(ARF_EXPREF(y), ARF_EXP_POS_INF);
+    }
+    else
+    {
+        ARF_NEG(y);
+    }
+}
+
+static __inline__ int
+arf_sgn(const arf_t x)
+{
+    if (arf_is_special(x))
+    {
+        if (arf_is_pos_inf(x))
+            return 1;
+        if (arf_is_neg_inf(x))
+            return -1;
+        return 0;
+    }
+
+    return ARF_SGNBIT(x) ? -1 : 1;
+}
+
+static __inline__ void
+arf_abs(arf_t y, const arf_t x)
+{
+    if (arf_sgn(x) < 0)
+        arf_neg(y, x);
+    else
+        arf_set(y, x);
+}
+
+int arf_equal(const arf_t x, const arf_t y);
+
+int arf_cmp(const arf_t x, const arf_t y);
+
+int arf_cmpabs(const arf_t x, const arf_t y);
+
+static __inline__ long
+arf_bits(const arf_t x)
+{
+    if (arf_is_special(x))
+    {
+        return 0;
+    }
+    else
+    {
+        mp_srcptr xp;
+        mp_size_t xn;
+        int c;
+
+        ARF_GET_MPN_READONLY(xp, xn, x);
+        count_trailing_zeros(c, xp[0]);
+        return xn * FLINT_BITS - c;
+    }
+}
+
+static __inline__ void
+arf_mul_2exp_si(arf_t y, const arf_t x, long e)
+{
+    arf_set(y, x);
+    if (!arf_is_special(y))
+        fmpz_add_si_inline(ARF_EXPREF(y), ARF_EXPREF(y), e);
+}
+
+static __inline__ void
+arf_mul_2exp_fmpz(arf_t y, const arf_t x, const fmpz_t e)
+{
+    arf_set(y, x);
+    if (!arf_is_special(y))
+        fmpz_add_inline(ARF_EXPREF(y), ARF_EXPREF(y), e);
+}
+
+/* Rounding */
+
+int _arf_set_round_mpn(arf_t y, long * exp_shift, mp_srcptr x, mp_size_t xn,
+    int sgnbit, long prec, fmpr_rnd_t rnd);
+
+int _arf_set_round_ui(arf_t y, long * exp_shift, mp_limb_t x,
+    int sgnbit, long prec, fmpr_rnd_t rnd);
+
+static __inline__ int
+_arf_set_round_uiui(arf_t y, long * exp_shift, mp_limb_t hi, mp_limb_t lo,
+    int sgnbit, long prec, fmpr_rnd_t rnd)
+{
+    mp_limb_t t[2];
+
+    if (hi == 0)
+        return _arf_set_round_ui(y, exp_shift, lo, sgnbit, prec, rnd);
+
+    t[0] = lo;
+    t[1] = hi;
+    return _arf_set_round_mpn(y, exp_shift, t, 2, sgnbit, prec, rnd);
+}
+
+int arf_set_round(arf_t y, const arf_t x, long prec, fmpr_rnd_t rnd);
+
+/* Conversions */
+
+static __inline__ void
+arf_set_ui(arf_t x, ulong c)
+{
+    if (c == 0)
+    {
+        arf_zero(x);
+    }
+    else
+    {
+        int lead;
+        count_leading_zeros(lead, c);
+        ARF_DEMOTE(x);
+        ARF_XSIZE(x) = ARF_MAKE_XSIZE(1, 0);
+        ARF_NOPTR_D(x)[0] = c << lead;
+        fmpz_set_ui(ARF_EXPREF(x), FLINT_BITS - lead);
+    }
+}
+
+static __inline__ void
+arf_set_si(arf_t x, long c)
+{
+    if (c < 0)
+    {
+        arf_set_ui(x, -(ulong) c);
+        ARF_NEG(x);
+    }
+    else
+    {
+        arf_set_ui(x, c);
+    }
+}
+
+void arf_set_fmpz(arf_t y, const fmpz_t x);
+
+void arf_set_fmpz_2exp(arf_t y, const fmpz_t man, const fmpz_t exp);
+
+void arf_get_fmpz_2exp(fmpz_t man, fmpz_t exp, const arf_t x);
+
+void arf_set_fmpr(arf_t y, const fmpr_t x);
+
+void arf_get_fmpr(fmpr_t y, const arf_t x);
+
+void arf_get_fmpz(fmpz_t z, const arf_t x, fmpr_rnd_t rnd);
+
+/* Arithmetic */
+
+int arf_add(arf_t z, const arf_t x, const arf_t y, long prec, fmpr_rnd_t rnd);
+
+int arf_sub(arf_t z, const arf_t x, const arf_t y, long prec, fmpr_rnd_t rnd);
+
+int arf_mul(arf_t z, const arf_t x, const arf_t y, long prec, fmpr_rnd_t rnd);
+
+int arf_addmul(arf_t z, const arf_t x, const arf_t y, long prec, fmpr_rnd_t rnd);
+
+/* Random generation and input/output */
+
+void arf_randtest(arf_t x, flint_rand_t state, long bits, long mag_bits);
+
+void arf_randtest_not_zero(arf_t x, flint_rand_t state, long bits, long mag_bits);
+
+void arf_randtest_special(arf_t x, flint_rand_t state, long bits, long mag_bits);
+
+void arf_print(const arf_t x);
+
+void arf_printd(const arf_t x, long digits);
+
+/* vector functions */
+
+static __inline__ arf_ptr
+_arf_vec_init(long n)
+{
+    long i;
+    arf_ptr v = (arf_ptr) flint_malloc(sizeof(arf_struct) * n);
+
+    for (i = 0; i < n; i++)
+        arf_init(v + i);
+
+    return v;
+}
+
+static __inline__ void
+_arf_vec_clear(arf_ptr v, long n)
+{
+    long i;
+    for (i = 0; i < n; i++)
+        arf_clear(v + i);
+    flint_free(v);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
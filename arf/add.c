@@ -0,0 +1,327 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arf.h"
+
+#define ADD_STACK_ALLOC 40
+#define ADD_TLS_ALLOC 1000
+
+TLS_PREFIX mp_ptr __arf_add_tmp = NULL;
+TLS_PREFIX long __arf_add_alloc = 0;
+
+void _arf_add_tmp_cleanup(void)
+{
+    flint_free(__arf_add_tmp);
+    __arf_add_tmp = NULL;
+    __arf_add_alloc = 0;
+}
+
+#define ADD_TMP_ALLOC \
+    if (alloc <= ADD_STACK_ALLOC) \
+    { \
+        tmp = tmp_stack; \
+    } \
+    else if (alloc <= ADD_TLS_ALLOC) \
+    { \
+        if (__arf_add_alloc < alloc) \
+        { \
+            if (__arf_add_alloc == 0) \
+            { \
+                flint_register_cleanup_function(_arf_add_tmp_cleanup); \
+            } \
+            __arf_add_tmp = flint_realloc(__arf_add_tmp, sizeof(mp_limb_t) * alloc); \
+            __arf_add_alloc = alloc; \
+        } \
+        tmp = __arf_add_tmp; \
+    } \
+    else \
+    { \
+        tmp = flint_malloc(sizeof(mp_limb_t) * alloc); \
+    }
+
+#define ADD_TMP_FREE \
+    if (alloc > ADD_TLS_ALLOC) \
+        flint_free(tmp);
+
+static int
+_arf_add_special(arf_t z, const arf_t x, const arf_t y, long prec, fmpr_rnd_t rnd)
+{
+    if (arf_is_zero(x))
+    {
+        if (arf_is_zero(y))
+        {
+            arf_zero(z);
+            return 0;
+        }
+        else
+            return arf_set_round(z, y, prec, rnd);
+    }
+    else if (arf_is_zero(y))
+    {
+        return arf_set_round(z, x, prec, rnd);
+    }
+    else if (arf_is_nan(x) || arf_is_nan(y)
+        || (arf_is_pos_inf(x) && arf_is_neg_inf(y))
+        || (arf_is_neg_inf(x) && arf_is_pos_inf(y)))
+    {
+        arf_nan(z);
+        return 0;
+    }
+    else if (arf_is_special(x))
+    {
+        arf_set(z, x);
+        return 0;
+    }
+    else
+    {
+        arf_set(z, y);
+        return 0;
+    }
+}
+
+/* sets {t, tn} to {s, sn} * 2^d; the caller guarantees that there is room */
+static __inline__ void
+_arf_mpn_place(mp_ptr t, mp_size_t tn, mp_srcptr s, mp_size_t sn, ulong d)
+{
+    mp_size_t dl = d / FLINT_BITS;
+    unsigned int db = d % FLINT_BITS;
+
+    flint_mpn_zero(t, tn);
+
+    if (db == 0)
+        flint_mpn_copyi(t + dl, s, sn);
+    else
+        t[dl + sn] = mpn_lshift(t + dl, s, sn, db);
+}
+
+/*
+  Adds x = {xp, xn} * 2^(xexp - xn * FLINT_BITS) and
+  y = {yp, yn} * 2^(xexp - shift - yn * FLINT_BITS) where shift >= 0,
+  i.e. x has the larger exponent.
+*/
+static int
+_arf_add_mpn(arf_t z, mp_srcptr xp, mp_size_t xn, int xsgnbit, const fmpz_t xexp,
+    mp_srcptr yp, mp_size_t yn, int ysgnbit, long shift, long prec, fmpr_rnd_t rnd)
+{
+    mp_limb_t tmp_stack[ADD_STACK_ALLOC];
+    mp_ptr tmp, tmp2;
+    mp_size_t tn, alloc;
+    long fix, minbot;
+    int inexact, sgnbit;
+
+    /* y does not overlap with x or with the rounded result: the outcome
+       is the same as adding or subtracting a tiny number to or from x */
+    if (prec != FMPR_PREC_EXACT)
+    {
+        tn = FLINT_MAX(xn, (prec + FLINT_BITS - 1) / FLINT_BITS) + 1;
+
+        if (shift > (tn - 1) * FLINT_BITS)
+        {
+            alloc = tn;
+
+            ADD_TMP_ALLOC
+
+            flint_mpn_zero(tmp, tn - xn);
+            flint_mpn_copyi(tmp + tn - xn, xp, xn);
+
+            if (xsgnbit == ysgnbit)
+                tmp[0] = 1;
+            else
+                mpn_sub_1(tmp, tmp, tn, 1);
+
+            inexact = _arf_set_round_mpn(z, &fix, tmp, tn, xsgnbit, prec, rnd);
+            fmpz_add_si_inline(ARF_EXPREF(z), xexp, fix - tn * FLINT_BITS);
+
+            ADD_TMP_FREE
+
+            return inexact;
+        }
+    }
+
+    /* exponent of the lowest bit relative to xexp */
+    minbot = FLINT_MIN(-xn * FLINT_BITS, -shift - yn * FLINT_BITS);
+
+    /* one extra limb for carry */
+    tn = (-minbot + FLINT_BITS - 1) / FLINT_BITS + 1;
+    alloc = 2 * tn;
+
+    ADD_TMP_ALLOC
+
+    tmp2 = tmp + tn;
+
+    _arf_mpn_place(tmp, tn, xp, xn, -minbot - xn * FLINT_BITS);
+    _arf_mpn_place(tmp2, tn, yp, yn, -minbot - shift - yn * FLINT_BITS);
+
+    if (xsgnbit == ysgnbit)
+    {
+        mpn_add_n(tmp, tmp, tmp2, tn);
+        sgnbit = xsgnbit;
+    }
+    else
+    {
+        int cmp = mpn_cmp(tmp, tmp2, tn);
+
+        if (cmp == 0)
+        {
+            arf_zero(z);
+            ADD_TMP_FREE
+            return 0;
+        }
+        else if (cmp > 0)
+        {
+            mpn_sub_n(tmp, tmp, tmp2, tn);
+            sgnbit = xsgnbit;
+        }
+        else
+        {
+            mpn_sub_n(tmp, tmp2, tmp, tn);
+            sgnbit = ysgnbit;
+        }
+    }
+
+    while (tmp[tn - 1] == 0)
+        tn--;
+
+    inexact = _arf_set_round_mpn(z, &fix, tmp, tn, sgnbit, prec, rnd);
+    fmpz_add_si_inline(ARF_EXPREF(z), xexp, minbot + fix);
+
+    ADD_TMP_FREE
+
+    return inexact;
+}
+
+int
+arf_add(arf_t z, const arf_t x, const arf_t y, long prec, fmpr_rnd_t rnd)
+{
+    mp_srcptr xp, yp;
+    mp_size_t xn, yn;
+    long shift;
+
+    if (arf_is_special(x) || arf_is_special(y))
+        return _arf_add_special(z, x, y, prec, rnd);
+
+    shift = _fmpz_sub_small(ARF_EXPREF(x), ARF_EXPREF(y));
+
+    if (shift < 0)
+    {
+        arf_srcptr t = x;
+        x = y;
+        y = t;
+        shift = -shift;
+    }
+
+    ARF_GET_MPN_READONLY(xp, xn, x);
+    ARF_GET_MPN_READONLY(yp, yn, y);
+
+    if (xn == 1 && yn == 1 && shift < FLINT_BITS)
+    {
+        mp_limb_t hi, lo, xv, yv;
+        long fix;
+        int inexact, sgnbit;
+
+        xv = xp[0];
+        yv = yp[0];
+        sgnbit = ARF_SGNBIT(x);
+
+        /* work in units of 2^(exp(x) - FLINT_BITS - shift) */
+        if (shift == 0)
+        {
+            hi = 0;
+            lo = xv;
+        }
+        else
+        {
+            hi = xv >> (FLINT_BITS - shift);
+            lo = xv << shift;
+        }
+
+        if (ARF_SGNBIT(x) == ARF_SGNBIT(y))
+        {
+            add_ssaaaa(hi, lo, hi, lo, 0, yv);
+        }
+        else
+        {
+            if (hi == 0 && lo < yv)
+            {
+                lo = yv - lo;
+                sgnbit = !sgnbit;
+            }
+            else
+            {
+                sub_ddmmss(hi, lo, hi, lo, 0, yv);
+            }
+
+            if (hi == 0 && lo == 0)
+            {
+                arf_zero(z);
+                return 0;
+            }
+        }
+
+        inexact = _arf_set_round_uiui(z, &fix, hi, lo, sgnbit, prec, rnd);
+        fmpz_add_si_inline(ARF_EXPREF(z), ARF_EXPREF(x), fix - FLINT_BITS - shift);
+        return inexact;
+    }
+
+    return _arf_add_mpn(z, xp, xn, ARF_SGNBIT(x), ARF_EXPREF(x),
+        yp, yn, ARF_SGNBIT(y), shift, prec, rnd);
+}
+
+int
+arf_sub(arf_t z, const arf_t x, const arf_t y, long prec, fmpr_rnd_t rnd)
+{
+    int inexact;
+
+    if (z == y)
+    {
+        arf_t t;
+        arf_init(t);
+        arf_neg(t, y);
+        inexact = arf_add(z, x, t, prec, rnd);
+        arf_clear(t);
+    }
+    else
+    {
+        /* shallow negated copy; the mantissa is only read */
+        arf_struct t = *y;
+
+        if (arf_is_special(y))
+        {
+            if (arf_is_pos_inf(y))
+                t.exp = ARF_EXP_NEG_INF;
+            else if (arf_is_neg_inf(y))
+                t.exp = ARF_EXP_POS_INF;
+        }
+        else
+        {
+            ARF_NEG(&t);
+        }
+
+        inexact = arf_add(z, x, &t, prec, rnd);
+    }
+
+    return inexact;
+}
+
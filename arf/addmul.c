@@ -0,0 +1,41 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arf.h"
+
+int
+arf_addmul(arf_t z, const arf_t x, const arf_t y, long prec, fmpr_rnd_t rnd)
+{
+    arf_t t;
+    int inexact;
+
+    arf_init(t);
+    arf_mul(t, x, y, FMPR_PREC_EXACT, FMPR_RND_DOWN);
+    inexact = arf_add(z, z, t, prec, rnd);
+    arf_clear(t);
+
+    return inexact;
+}
+
@@ -0,0 +1,106 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arf.h"
+
+/* compares the mantissas as fractions (ignoring signs) */
+static int
+_arf_cmpabs_mantissa(const arf_t x, const arf_t y)
+{
+    mp_srcptr xp, yp;
+    mp_size_t xn, yn, i;
+
+    ARF_GET_MPN_READONLY(xp, xn, x);
+    ARF_GET_MPN_READONLY(yp, yn, y);
+
+    for (i = 1; i <= FLINT_MIN(xn, yn); i++)
+    {
+        if (xp[xn - i] != yp[yn - i])
+            return (xp[xn - i] < yp[yn - i]) ? -1 : 1;
+    }
+
+    /* the low limb is nonzero, so the longer mantissa is larger */
+    if (xn == yn)
+        return 0;
+
+    return (xn < yn) ? -1 : 1;
+}
+
+int
+arf_cmpabs(const arf_t x, const arf_t y)
+{
+    int ec;
+
+    if (arf_is_special(x) || arf_is_special(y))
+    {
+        if (arf_equal(x, y)) return 0;
+        if (arf_is_nan(x) || arf_is_nan(y)) return 0;
+        if (arf_is_zero(x)) return -1;
+        if (arf_is_zero(y)) return 1;
+        if (arf_is_inf(x)) return arf_is_inf(y) ? 0 : 1;
+        if (arf_is_inf(y)) return -1;
+        return 0;
+    }
+
+    ec = fmpz_cmp(ARF_EXPREF(x), ARF_EXPREF(y));
+
+    if (ec != 0)
+        return (ec < 0) ? -1 : 1;
+
+    return _arf_cmpabs_mantissa(x, y);
+}
+
+int
+arf_cmp(const arf_t x, const arf_t y)
+{
+    int xs, ys, ec, mc;
+
+    if (arf_is_special(x) || arf_is_special(y))
+    {
+        if (arf_equal(x, y)) return 0;
+        if (arf_is_nan(x) || arf_is_nan(y)) return 0;
+        if (arf_is_zero(y)) return arf_sgn(x);
+        if (arf_is_zero(x)) return -arf_sgn(y);
+        if (arf_is_pos_inf(x)) return 1;
+        if (arf_is_neg_inf(y)) return 1;
+        return -1;
+    }
+
+    xs = ARF_SGNBIT(x);
+    ys = ARF_SGNBIT(y);
+
+    if (xs != ys)
+        return xs ? -1 : 1;
+
+    ec = fmpz_cmp(ARF_EXPREF(x), ARF_EXPREF(y));
+
+    if (ec == 0)
+        mc = _arf_cmpabs_mantissa(x, y);
+    else
+        mc = (ec < 0) ? -1 : 1;
+
+    return xs ? -mc : mc;
+}
+
@@ -0,0 +1,68 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arf.h"
+
+void
+arf_get_fmpz_2exp(fmpz_t man, fmpz_t exp, const arf_t x)
+{
+    if (arf_is_special(x))
+    {
+        if (arf_is_zero(x))
+        {
+            fmpz_zero(man);
+            fmpz_zero(exp);
+        }
+        else
+        {
+            printf("arf_get_fmpz_2exp: cannot convert infinity or nan\n");
+            abort();
+        }
+    }
+    else
+    {
+        mp_srcptr xp;
+        mp_size_t xn;
+        int shift;
+
+        ARF_GET_MPN_READONLY(xp, xn, x);
+        count_trailing_zeros(shift, xp[0]);
+
+        fmpz_sub_ui(exp, ARF_EXPREF(x), xn * FLINT_BITS - shift);
+
+        if (xn == 1)
+        {
+            if (ARF_SGNBIT(x))
+                fmpz_neg_ui(man, xp[0] >> shift);
+            else
+                fmpz_set_ui(man, xp[0] >> shift);
+        }
+        else
+        {
+            fmpz_set_mpn_rshift(man, xp, xn, shift, ARF_SGNBIT(x));
+        }
+    }
+}
+
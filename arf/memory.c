@@ -0,0 +1,109 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arf.h"
+
+/*
+  Limb arrays are allocated with one extra header limb holding the
+  allocation size. Arrays of at most ARF_RECYCLE_LIMBS limbs are put on a
+  thread-local free list when released (threaded through the first data
+  limb), so that variables switching between inline and heap-allocated
+  mantissas do not hit malloc every time.
+*/
+
+TLS_PREFIX mp_ptr _arf_recycle_head[ARF_RECYCLE_LIMBS + 1];
+TLS_PREFIX long _arf_recycle_num[ARF_RECYCLE_LIMBS + 1];
+TLS_PREFIX int _arf_recycle_initialised = 0;
+
+void _arf_recycle_cleanup(void)
+{
+    long i;
+    mp_ptr p, next;
+
+    for (i = 0; i <= ARF_RECYCLE_LIMBS; i++)
+    {
+        p = _arf_recycle_head[i];
+
+        while (p != NULL)
+        {
+            next = (mp_ptr) p[0];
+            flint_free(p - 1);
+            p = next;
+        }
+
+        _arf_recycle_head[i] = NULL;
+        _arf_recycle_num[i] = 0;
+    }
+
+    _arf_recycle_initialised = 0;
+}
+
+mp_ptr
+_arf_limbs_alloc(mp_size_t n)
+{
+    mp_ptr p;
+
+    if (n <= ARF_RECYCLE_LIMBS)
+    {
+        /* only use two size classes, to improve reuse */
+        n = (n <= ARF_RECYCLE_LIMBS / 2) ? ARF_RECYCLE_LIMBS / 2 : ARF_RECYCLE_LIMBS;
+
+        if (_arf_recycle_num[n] != 0)
+        {
+            p = _arf_recycle_head[n];
+            _arf_recycle_head[n] = (mp_ptr) p[0];
+            _arf_recycle_num[n]--;
+            return p;
+        }
+    }
+
+    p = flint_malloc(sizeof(mp_limb_t) * (n + 1));
+    p[0] = n;
+    return p + 1;
+}
+
+void
+_arf_limbs_free(mp_ptr ptr)
+{
+    mp_size_t n = ptr[-1];
+
+    if (n <= ARF_RECYCLE_LIMBS && _arf_recycle_num[n] < ARF_RECYCLE_COUNT)
+    {
+        if (!_arf_recycle_initialised)
+        {
+            flint_register_cleanup_function(_arf_recycle_cleanup);
+            _arf_recycle_initialised = 1;
+        }
+
+        ptr[0] = (mp_limb_t) _arf_recycle_head[n];
+        _arf_recycle_head[n] = ptr;
+        _arf_recycle_num[n]++;
+    }
+    else
+    {
+        flint_free(ptr - 1);
+    }
+}
+
@@ -0,0 +1,156 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arf.h"
+
+#define MUL_STACK_ALLOC 40
+#define MUL_TLS_ALLOC 1000
+
+TLS_PREFIX mp_ptr __arf_mul_tmp = NULL;
+TLS_PREFIX long __arf_mul_alloc = 0;
+
+void _arf_mul_tmp_cleanup(void)
+{
+    flint_free(__arf_mul_tmp);
+    __arf_mul_tmp = NULL;
+    __arf_mul_alloc = 0;
+}
+
+#define MUL_TMP_ALLOC \
+    if (alloc <= MUL_STACK_ALLOC) \
+    { \
+        tmp = tmp_stack; \
+    } \
+    else if (alloc <= MUL_TLS_ALLOC) \
+    { \
+        if (__arf_mul_alloc < alloc) \
+        { \
+            if (__arf_mul_alloc == 0) \
+            { \
+                flint_register_cleanup_function(_arf_mul_tmp_cleanup); \
+            } \
+            __arf_mul_tmp = flint_realloc(__arf_mul_tmp, sizeof(mp_limb_t) * alloc); \
+            __arf_mul_alloc = alloc; \
+        } \
+        tmp = __arf_mul_tmp; \
+    } \
+    else \
+    { \
+        tmp = flint_malloc(sizeof(mp_limb_t) * alloc); \
+    }
+
+#define MUL_TMP_FREE \
+    if (alloc > MUL_TLS_ALLOC) \
+        flint_free(tmp);
+
+static void
+_arf_mul_special(arf_t z, const arf_t x, const arf_t y)
+{
+    if (arf_is_zero(x) && arf_is_finite(y))
+    {
+        arf_zero(z);
+    }
+    else if (arf_is_zero(y) && arf_is_finite(x))
+    {
+        arf_zero(z);
+    }
+    else if ((arf_is_inf(x) && (arf_is_inf(y) || !arf_is_special(y))) ||
+        (arf_is_inf(y) && !arf_is_special(x)))
+    {
+        if (arf_sgn(x) == arf_sgn(y))
+            arf_pos_inf(z);
+        else
+            arf_neg_inf(z);
+    }
+    else
+    {
+        arf_nan(z);
+    }
+}
+
+int
+arf_mul(arf_t z, const arf_t x, const arf_t y, long prec, fmpr_rnd_t rnd)
+{
+    mp_srcptr xp, yp;
+    mp_size_t xn, yn;
+    long fix;
+    int inexact, sgnbit;
+
+    if (arf_is_special(x) || arf_is_special(y))
+    {
+        _arf_mul_special(z, x, y);
+        return 0;
+    }
+
+    ARF_GET_MPN_READONLY(xp, xn, x);
+    ARF_GET_MPN_READONLY(yp, yn, y);
+
+    sgnbit = ARF_SGNBIT(x) ^ ARF_SGNBIT(y);
+
+    if (xn == 1 && yn == 1)
+    {
+        mp_limb_t hi, lo;
+
+        /* both mantissas are top-aligned, so hi is nonzero */
+        umul_ppmm(hi, lo, xp[0], yp[0]);
+
+        inexact = _arf_set_round_uiui(z, &fix, hi, lo, sgnbit, prec, rnd);
+        fmpz_add2_fmpz_si_inline(ARF_EXPREF(z), ARF_EXPREF(x), ARF_EXPREF(y),
+            fix - 2 * FLINT_BITS);
+    }
+    else
+    {
+        mp_limb_t tmp_stack[MUL_STACK_ALLOC];
+        mp_ptr tmp;
+        mp_size_t zn, alloc;
+
+        if (xn < yn)
+        {
+            arf_srcptr t = x;
+            mp_srcptr tp = xp;
+            x = y; xp = yp;
+            y = t; yp = tp;
+            zn = xn; xn = yn; yn = zn;
+        }
+
+        zn = alloc = xn + yn;
+
+        MUL_TMP_ALLOC
+
+        if (yn == 1)
+            tmp[zn - 1] = mpn_mul_1(tmp, xp, xn, yp[0]);
+        else
+            mpn_mul(tmp, xp, xn, yp, yn);
+
+        inexact = _arf_set_round_mpn(z, &fix, tmp, zn, sgnbit, prec, rnd);
+        fmpz_add2_fmpz_si_inline(ARF_EXPREF(z), ARF_EXPREF(x), ARF_EXPREF(y),
+            fix - zn * FLINT_BITS);
+
+        MUL_TMP_FREE
+    }
+
+    return inexact;
+}
+
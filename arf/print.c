@@ -0,0 +1,47 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arf.h"
+
+void
+arf_print(const arf_t x)
+{
+    fmpr_t t;
+    fmpr_init(t);
+    arf_get_fmpr(t, x);
+    fmpr_print(t);
+    fmpr_clear(t);
+}
+
+void
+arf_printd(const arf_t x, long digits)
+{
+    fmpr_t t;
+    fmpr_init(t);
+    arf_get_fmpr(t, x);
+    fmpr_printd(t, digits);
+    fmpr_clear(t);
+}
+
@@ -0,0 +1,57 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arf.h"
+
+void
+arf_randtest(arf_t x, flint_rand_t state, long bits, long mag_bits)
+{
+    fmpr_t t;
+    fmpr_init(t);
+    fmpr_randtest(t, state, bits, mag_bits);
+    arf_set_fmpr(x, t);
+    fmpr_clear(t);
+}
+
+void
+arf_randtest_not_zero(arf_t x, flint_rand_t state, long bits, long mag_bits)
+{
+    fmpr_t t;
+    fmpr_init(t);
+    fmpr_randtest_not_zero(t, state, bits, mag_bits);
+    arf_set_fmpr(x, t);
+    fmpr_clear(t);
+}
+
+void
+arf_randtest_special(arf_t x, flint_rand_t state, long bits, long mag_bits)
+{
+    fmpr_t t;
+    fmpr_init(t);
+    fmpr_randtest_special(t, state, bits, mag_bits);
+    arf_set_fmpr(x, t);
+    fmpr_clear(t);
+}
+
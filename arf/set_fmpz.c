@@ -0,0 +1,55 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arf.h"
+
+void
+arf_set_fmpz(arf_t y, const fmpz_t x)
+{
+    if (!COEFF_IS_MPZ(*x))
+    {
+        arf_set_si(y, *x);
+    }
+    else
+    {
+        __mpz_struct * z = COEFF_TO_PTR(*x);
+        long fix;
+
+        _arf_set_round_mpn(y, &fix, z->_mp_d, FLINT_ABS(z->_mp_size),
+            (z->_mp_size < 0), FMPR_PREC_EXACT, FMPR_RND_DOWN);
+
+        fmpz_set_si(ARF_EXPREF(y), fix);
+    }
+}
+
+void
+arf_set_fmpz_2exp(arf_t y, const fmpz_t man, const fmpz_t exp)
+{
+    arf_set_fmpz(y, man);
+
+    if (!arf_is_special(y))
+        fmpz_add_inline(ARF_EXPREF(y), ARF_EXPREF(y), exp);
+}
+
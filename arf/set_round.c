@@ -0,0 +1,66 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arf.h"
+
+int
+arf_set_round(arf_t y, const arf_t x, long prec, fmpr_rnd_t rnd)
+{
+    mp_srcptr xp;
+    mp_size_t xn;
+    long fix;
+    int inexact;
+
+    if (arf_is_special(x))
+    {
+        arf_set(y, x);
+        return 0;
+    }
+
+    ARF_GET_MPN_READONLY(xp, xn, x);
+
+    /* quick exit */
+    if (xn * FLINT_BITS <= prec)
+    {
+        arf_set(y, x);
+        return 0;
+    }
+
+    if (y == x)
+    {
+        arf_t t;
+        arf_init(t);
+        inexact = arf_set_round(t, x, prec, rnd);
+        arf_swap(y, t);
+        arf_clear(t);
+        return inexact;
+    }
+
+    inexact = _arf_set_round_mpn(y, &fix, xp, xn, ARF_SGNBIT(x), prec, rnd);
+    fmpz_add_si_inline(ARF_EXPREF(y), ARF_EXPREF(x), fix - xn * FLINT_BITS);
+
+    return inexact;
+}
+
@@ -0,0 +1,164 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arf.h"
+
+int
+_arf_set_round_mpn(arf_t y, long * exp_shift, mp_srcptr x, mp_size_t xn,
+    int sgnbit, long prec, fmpr_rnd_t rnd)
+{
+    unsigned int leading;
+    long bits, val, significant, rem;
+    mp_size_t yn, val_limbs;
+    mp_ptr yptr;
+    mp_limb_t cy;
+    int inexact;
+
+    /* total bit length of x */
+    count_leading_zeros(leading, x[xn - 1]);
+    bits = xn * FLINT_BITS - leading;
+
+    /* strip trailing zero limbs */
+    val_limbs = 0;
+    while (x[val_limbs] == 0)
+        val_limbs++;
+    x += val_limbs;
+    xn -= val_limbs;
+
+    count_trailing_zeros(val, x[0]);
+    significant = xn * FLINT_BITS - leading - val;
+
+    inexact = (significant > prec);
+
+    if (inexact)
+        yn = (prec + FLINT_BITS - 1) / FLINT_BITS;
+    else
+        yn = (significant + FLINT_BITS - 1) / FLINT_BITS;
+
+    ARF_GET_MPN_WRITE(yptr, yn, y);
+
+    /* copy the top yn limbs of x << leading */
+    if (leading == 0)
+    {
+        flint_mpn_copyi(yptr, x + xn - yn, yn);
+    }
+    else
+    {
+        mpn_lshift(yptr, x + xn - yn, yn, leading);
+        if (xn > yn)
+            yptr[0] |= x[xn - yn - 1] >> (FLINT_BITS - leading);
+    }
+
+    if (inexact)
+    {
+        rem = yn * FLINT_BITS - prec;
+
+        if (rem != 0)
+            yptr[0] &= ~((1UL << rem) - 1);
+
+        if (rounds_up(rnd, sgnbit))
+        {
+            cy = mpn_add_1(yptr, yptr, yn, 1UL << rem);
+
+            /* overflow to the next power of two */
+            if (cy != 0)
+            {
+                ARF_DEMOTE(y);
+                ARF_NOPTR_D(y)[0] = 1UL << (FLINT_BITS - 1);
+                ARF_XSIZE(y) = ARF_MAKE_XSIZE(1, sgnbit);
+                *exp_shift = bits + 1;
+                return 1;
+            }
+        }
+
+        /* truncation or rounding can leave zero limbs at the bottom */
+        if (yptr[0] == 0)
+        {
+            mp_size_t zn = 1;
+
+            while (yptr[zn] == 0)
+                zn++;
+
+            if (yn - zn == 1)
+            {
+                cy = yptr[yn - 1];
+                ARF_DEMOTE(y);
+                ARF_NOPTR_D(y)[0] = cy;
+            }
+            else
+            {
+                flint_mpn_copyi(yptr, yptr + zn, yn - zn);
+            }
+
+            yn -= zn;
+        }
+    }
+
+    ARF_XSIZE(y) = ARF_MAKE_XSIZE(yn, sgnbit);
+    *exp_shift = bits;
+    return inexact;
+}
+
+int
+_arf_set_round_ui(arf_t y, long * exp_shift, mp_limb_t x,
+    int sgnbit, long prec, fmpr_rnd_t rnd)
+{
+    unsigned int leading;
+    mp_limb_t mask;
+    int inexact = 0;
+
+    count_leading_zeros(leading, x);
+    x <<= leading;
+    *exp_shift = FLINT_BITS - leading;
+
+    if (prec < FLINT_BITS)
+    {
+        mask = (1UL << (FLINT_BITS - prec)) - 1;
+
+        if ((x & mask) != 0)
+        {
+            inexact = 1;
+            x &= ~mask;
+
+            if (rounds_up(rnd, sgnbit))
+            {
+                x += mask + 1;
+
+                if (x == 0)
+                {
+                    x = 1UL << (FLINT_BITS - 1);
+                    (*exp_shift)++;
+                }
+            }
+        }
+    }
+
+    ARF_DEMOTE(y);
+    ARF_NOPTR_D(y)[0] = x;
+    ARF_XSIZE(y) = ARF_MAKE_XSIZE(1, sgnbit);
+
+    return inexact;
+}
+
@@ -0,0 +1,86 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arf.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("cmp....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000000; iter++)
+    {
+        fmpr_t x, y;
+        arf_t X, Y;
+        int r1, r2, r3, r4;
+
+        fmpr_init(x);
+        fmpr_init(y);
+
+        arf_init(X);
+        arf_init(Y);
+
+        fmpr_randtest_special(x, state, 1 + n_randint(state, 200), 1 + n_randint(state, 10));
+
+        if (n_randint(state, 4) == 0)
+            fmpr_set(y, x);
+        else
+            fmpr_randtest_special(y, state, 1 + n_randint(state, 200), 1 + n_randint(state, 10));
+
+        arf_set_fmpr(X, x);
+        arf_set_fmpr(Y, y);
+
+        r1 = fmpr_cmp(x, y);
+        r2 = arf_cmp(X, Y);
+        r3 = fmpr_cmpabs(x, y);
+        r4 = arf_cmpabs(X, Y);
+
+        if (r1 != r2 || r3 != r4 || fmpr_equal(x, y) != arf_equal(X, Y))
+        {
+            printf("FAIL\n\n");
+            printf("x = "); fmpr_print(x); printf("\n\n");
+            printf("y = "); fmpr_print(y); printf("\n\n");
+            printf("r1 = %d, r2 = %d, r3 = %d, r4 = %d\n", r1, r2, r3, r4);
+            abort();
+        }
+
+        fmpr_clear(x);
+        fmpr_clear(y);
+
+        arf_clear(X);
+        arf_clear(Y);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,124 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "arf.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("mul....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* compare with fmpr */
+    for (iter = 0; iter < 1000000; iter++)
+    {
+        long prec, ret1;
+        int ret2;
+        fmpr_t x, y, z, w;
+        arf_t X, Y, Z;
+        fmpr_rnd_t rnd;
+
+        fmpr_init(x);
+        fmpr_init(y);
+        fmpr_init(z);
+        fmpr_init(w);
+
+        arf_init(X);
+        arf_init(Y);
+        arf_init(Z);
+
+        fmpr_randtest_special(x, state, 1 + n_randint(state, 1000), 1 + n_randint(state, 100));
+        fmpr_randtest_special(y, state, 1 + n_randint(state, 1000), 1 + n_randint(state, 100));
+        arf_randtest_special(Z, state, 1 + n_randint(state, 1000), 1 + n_randint(state, 100));
+
+        prec = 2 + n_randint(state, 1000);
+        if (n_randint(state, 10) == 0 &&
+                fmpz_bits(fmpr_expref(x)) < 10 &&
+                fmpz_bits(fmpr_expref(y)) < 10)
+            prec = FMPR_PREC_EXACT;
+
+        switch (n_randint(state, 4))
+        {
+            case 0: rnd = FMPR_RND_DOWN; break;
+            case 1: rnd = FMPR_RND_UP; break;
+            case 2: rnd = FMPR_RND_FLOOR; break;
+            default: rnd = FMPR_RND_CEIL; break;
+        }
+
+        arf_set_fmpr(X, x);
+        arf_set_fmpr(Y, y);
+
+        ret1 = fmpr_mul(z, x, y, prec, rnd);
+
+        switch (n_randint(state, 3))
+        {
+            case 0:
+                ret2 = arf_mul(Z, X, Y, prec, rnd);
+                break;
+            case 1:
+                arf_set(Z, X);
+                ret2 = arf_mul(Z, Z, Y, prec, rnd);
+                break;
+            default:
+                arf_set(Z, Y);
+                ret2 = arf_mul(Z, X, Z, prec, rnd);
+                break;
+        }
+
+        arf_get_fmpr(w, Z);
+
+        if (!fmpr_equal(z, w) || (ret1 == FMPR_RESULT_EXACT) != (ret2 == 0))
+        {
+            printf("FAIL\n\n");
+            printf("iter %ld\n", iter);
+            printf("prec = %ld\n", prec);
+            printf("x = "); fmpr_print(x); printf("\n\n");
+            printf("y = "); fmpr_print(y); printf("\n\n");
+            printf("z = "); fmpr_print(z); printf("\n\n");
+            printf("w = "); fmpr_print(w); printf("\n\n");
+            printf("ret1 = %ld, ret2 = %d\n", ret1, ret2);
+            abort();
+        }
+
+        fmpr_clear(x);
+        fmpr_clear(y);
+        fmpr_clear(z);
+        fmpr_clear(w);
+
+        arf_clear(X);
+        arf_clear(Y);
+        arf_clear(Z);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -38,12 +38,28 @@
 extern "C" {
 #endif
 
-extern long TLS_PREFIX bernoulli_cache_num;
+/* shared by all threads; see cache_compute.c */
+extern long bernoulli_cache_num;
 
-extern TLS_PREFIX fmpq * bernoulli_cache;
+extern fmpq * bernoulli_cache;
 
 void bernoulli_cache_compute(long n);
 
+void bernoulli_cache_sync(void);
+
+/* must be used between reading bernoulli_cache_num and reading
+   bernoulli_cache, so that a thread that sees the new size also
+   sees the new array and its entries */
+#if defined(__GNUC__)
+#define BERNOULLI_READ_BARRIER() __sync_synchronize()
+#else
+#define BERNOULLI_READ_BARRIER() bernoulli_cache_sync()
+#endif
+
+void bernoulli_cleanup(void);
+
+void bernoulli_vec_multimod(fmpq * res, long a, long b);
+
 /*
 Crude bound for the bits in d(n) = denom(B_n).
 By von Staudt-Clausen, d(n) = prod_{p-1 | n} p
@@ -113,6 +129,8 @@ void bernoulli_rev_clear(bernoulli_rev_t iter);
     long __n = (n); \
     if (__n >= bernoulli_cache_num) \
         bernoulli_cache_compute(__n + 1); \
+    else \
+        BERNOULLI_READ_BARRIER(); \
   } while (0); \
 
 long bernoulli_bound_2exp_si(ulong n);
@@ -129,6 +147,7 @@ _bernoulli_fmpq_ui(fmpz_t num, fmpz_t den, ulong n)
 {
     if (n < bernoulli_cache_num)
     {
+        BERNOULLI_READ_BARRIER();
         fmpz_set(num, fmpq_numref(bernoulli_cache + n));
         fmpz_set(den, fmpq_denref(bernoulli_cache + n));
     }
@@ -23,58 +23,197 @@
 
 ******************************************************************************/
 
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
 #include "bernoulli.h"
+#include "thread_pool.h"
 
-TLS_PREFIX long bernoulli_cache_num = 0;
+/* the cache is shared by all threads; it is only extended while holding
+   bernoulli_cache_lock, and readers access it without locking, which
+   is safe because cached entries never change and arrays that have
+   been replaced are kept alive until the cache is freed.
 
-TLS_PREFIX fmpq * bernoulli_cache = NULL;
+   The writer stores the new array before the new size, with a memory
+   barrier in between; a reader loads the size first and then uses
+   BERNOULLI_READ_BARRIER() before loading the array, so that it never
+   sees a new size together with an old array. Without compiler support
+   for barriers, the read barrier takes the lock. */
+
+long bernoulli_cache_num = 0;
+
+fmpq * bernoulli_cache = NULL;
+
+static pthread_mutex_t bernoulli_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* arrays replaced by a larger copy; their entries are shared with the
+   current array, so only the arrays themselves are freed */
+static fmpq ** bernoulli_cache_retired = NULL;
+static long bernoulli_cache_num_retired = 0;
+
+/* set once bernoulli_cleanup has been passed to atexit */
+static int bernoulli_cache_atexit_registered = 0;
+
+/* minimum number of indices handled by a single iterator */
+#define BERNOULLI_BLOCK_MIN 128
+
+/* use the multimodular algorithm when extending the cache to at least
+   this many entries, if a large fraction of the entries are new */
+#define BERNOULLI_MULTIMOD_CUTOFF 2000
+
+void
+bernoulli_cache_sync(void)
+{
+    pthread_mutex_lock(&bernoulli_cache_lock);
+    pthread_mutex_unlock(&bernoulli_cache_lock);
+}
 
 void
 bernoulli_cleanup(void)
 {
     long i;
 
+    pthread_mutex_lock(&bernoulli_cache_lock);
+
     for (i = 0; i < bernoulli_cache_num; i++)
         fmpq_clear(bernoulli_cache + i);
 
+    for (i = 0; i < bernoulli_cache_num_retired; i++)
+        flint_free(bernoulli_cache_retired[i]);
+
     flint_free(bernoulli_cache);
+    flint_free(bernoulli_cache_retired);
+
     bernoulli_cache = NULL;
     bernoulli_cache_num = 0;
+    bernoulli_cache_retired = NULL;
+    bernoulli_cache_num_retired = 0;
+
+    pthread_mutex_unlock(&bernoulli_cache_lock);
+}
+
+typedef struct
+{
+    fmpq * cache;
+    long * bounds;
+}
+bernoulli_block_arg_t;
+
+/* computes the even-indexed entries in [bounds[i], bounds[i+1]) using
+   a separate iterator started at the top of the block */
+static void
+_bernoulli_block_worker(void * arg_ptr, long i)
+{
+    const bernoulli_block_arg_t * arg = (const bernoulli_block_arg_t *) arg_ptr;
+    long j, lo, hi;
+    bernoulli_rev_t iter;
+
+    lo = arg->bounds[i];
+    hi = arg->bounds[i + 1];
+
+    j = hi - 1;
+    j -= (j % 2);
+
+    if (j < lo)
+        return;
+
+    bernoulli_rev_init(iter, j);
+    for ( ; j >= lo; j -= 2)
+    {
+        bernoulli_rev_next(fmpq_numref(arg->cache + j),
+            fmpq_denref(arg->cache + j), iter);
+    }
+    bernoulli_rev_clear(iter);
+}
+
+/* computes the entries in [lo, hi) */
+static void
+_bernoulli_cache_fill(fmpq * cache, long lo, long hi)
+{
+    bernoulli_block_arg_t arg;
+    long i, num_blocks, num_threads;
+    double a, b;
+
+    num_threads = flint_get_num_threads();
+    num_blocks = FLINT_MIN(4 * num_threads, (hi - lo) / BERNOULLI_BLOCK_MIN);
+    num_blocks = FLINT_MAX(num_blocks, 1);
+
+    arg.cache = cache;
+    arg.bounds = flint_malloc(sizeof(long) * (num_blocks + 1));
+
+    /* computing B_n costs roughly O(n^2), so choose the block
+       boundaries to balance the sum of n^2 */
+    a = (double) lo * lo * lo;
+    b = (double) hi * hi * hi;
+
+    arg.bounds[0] = lo;
+    for (i = 1; i < num_blocks; i++)
+    {
+        arg.bounds[i] = pow(a + (b - a) * i / num_blocks, 1.0 / 3.0);
+        arg.bounds[i] = FLINT_MAX(arg.bounds[i], arg.bounds[i - 1]);
+        arg.bounds[i] = FLINT_MIN(arg.bounds[i], hi);
+    }
+    arg.bounds[num_blocks] = hi;
+
+    thread_pool_parallel_for(_bernoulli_block_worker, &arg,
+        num_blocks, num_threads);
+
+    flint_free(arg.bounds);
 }
 
 void
 bernoulli_cache_compute(long n)
 {
+    pthread_mutex_lock(&bernoulli_cache_lock);
+
     if (bernoulli_cache_num < n)
     {
-        long i, new_num;
-        bernoulli_rev_t iter;
+        long i, old_num, new_num;
+        fmpq * cache;
 
-        if (bernoulli_cache_num == 0)
-        {
-            flint_register_cleanup_function(bernoulli_cleanup);
-        }
+        old_num = bernoulli_cache_num;
+
+        /* grow geometrically, so that few arrays are retired */
+        new_num = FLINT_MAX(old_num + 128, old_num + old_num / 8);
+        new_num = FLINT_MAX(new_num, n);
+
+        /* copy the existing entries, which stay valid in the old array */
+        cache = flint_malloc(new_num * sizeof(fmpq));
+        if (old_num != 0)
+            memcpy(cache, bernoulli_cache, old_num * sizeof(fmpq));
+        for (i = old_num; i < new_num; i++)
+            fmpq_init(cache + i);
 
-        new_num = FLINT_MAX(bernoulli_cache_num + 128, n);
+        if (new_num >= BERNOULLI_MULTIMOD_CUTOFF && new_num - old_num >= new_num / 4)
+            bernoulli_vec_multimod(cache + old_num, old_num, new_num);
+        else
+            _bernoulli_cache_fill(cache, old_num, new_num);
 
-        bernoulli_cache = flint_realloc(bernoulli_cache, new_num * sizeof(fmpq));
-        for (i = bernoulli_cache_num; i < new_num; i++)
-            fmpq_init(bernoulli_cache + i);
+        if (old_num <= 1 && new_num > 1)
+            fmpq_set_si(cache + 1, -1, 2);
 
-        i = new_num - 1;
-        i -= (i % 2);
-        bernoulli_rev_init(iter, i);
-        for ( ; i >= bernoulli_cache_num; i -= 2)
+        if (bernoulli_cache != NULL)
         {
-            bernoulli_rev_next(fmpq_numref(bernoulli_cache + i),
-                fmpq_denref(bernoulli_cache + i), iter);
+            bernoulli_cache_retired = flint_realloc(bernoulli_cache_retired,
+                (bernoulli_cache_num_retired + 1) * sizeof(fmpq *));
+            bernoulli_cache_retired[bernoulli_cache_num_retired++] = bernoulli_cache;
         }
-        bernoulli_rev_clear(iter);
-
-        if (new_num > 1)
-            fmpq_set_si(bernoulli_cache + 1, -1, 2);
 
+        /* publish the array before the new size (release) */
+        bernoulli_cache = cache;
+#if defined(__GNUC__)
+        __sync_synchronize();
+#endif
         bernoulli_cache_num = new_num;
+
+        /* not flint_cleanup(), which runs whenever the thread that
+           filled the cache exits, e.g. a worker of the thread pool */
+        if (!bernoulli_cache_atexit_registered)
+        {
+            atexit(bernoulli_cleanup);
+            bernoulli_cache_atexit_registered = 1;
+        }
     }
-}
 
+    pthread_mutex_unlock(&bernoulli_cache_lock);
+}
@@ -30,6 +30,7 @@ bernoulli_fmprb_ui(fmprb_t b, ulong n, long prec)
 {
     if (n < bernoulli_cache_num)
     {
+        BERNOULLI_READ_BARRIER();
         fmprb_set_fmpq(b, bernoulli_cache + n, prec);
     }
     else
@@ -31,6 +31,7 @@ bernoulli_rev_init(bernoulli_rev_t iter, ulong nmax)
     long j;
     fmpz_t t;
     fmprb_t x;
+    fmpr_t r;
     int round1, round2;
     long wp;
 
@@ -51,6 +52,7 @@ bernoulli_rev_init(bernoulli_rev_t iter, ulong nmax)
     fmprb_init(iter->two_pi_squared);
 
     fmprb_init(x);
+    fmpr_init(r);
     fmpz_init(t);
 
     /* precompute powers */
@@ -62,7 +64,8 @@ bernoulli_rev_init(bernoulli_rev_t iter, ulong nmax)
         fmpz_set(iter->powers + j, t);
 
         /* error: the radius, plus two roundings */
-        round2 = fmpr_get_fmpz_fixed_si(t, fmprb_radref(x), -wp);
+        fmprb_get_rad_fmpr(r, x);
+        round2 = fmpr_get_fmpz_fixed_si(t, r, -wp);
         fmpz_add_ui(t, t, (round1 != 0) + (round2 != 0));
         if (fmpz_cmp(iter->pow_error, t) < 0)
             fmpz_set(iter->pow_error, t);
@@ -81,5 +84,6 @@ bernoulli_rev_init(bernoulli_rev_t iter, ulong nmax)
 
     fmpz_clear(t);
     fmprb_clear(x);
+    fmpr_clear(r);
 }
 
@@ -0,0 +1,110 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "fmpz_vec.h"
+#include "arith.h"
+#include "bernoulli.h"
+#include "thread_pool.h"
+
+int main()
+{
+    fmpz * num;
+    fmpz * den;
+    long iter, i, n, N;
+    flint_rand_t state;
+
+    printf("cache_compute....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    N = 1500;
+
+    num = _fmpz_vec_init(N);
+    den = _fmpz_vec_init(N);
+
+    _arith_bernoulli_number_vec_multi_mod(num, den, N);
+
+    for (iter = 0; iter < 20; iter++)
+    {
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        if (n_randint(state, 4) == 0)
+            bernoulli_cleanup();
+
+        /* extend the cache a few times */
+        for (i = 0; i < 3; i++)
+        {
+            n = n_randint(state, N + 1);
+            bernoulli_cache_compute(n);
+
+            if (bernoulli_cache_num < n)
+            {
+                printf("FAIL: bernoulli_cache_num = %ld, n = %ld\n",
+                    bernoulli_cache_num, n);
+                abort();
+            }
+        }
+
+        /* the workers run flint_cleanup() when they stop, which must
+           leave the shared cache alone */
+        if (n_randint(state, 2))
+        {
+            n = bernoulli_cache_num;
+            thread_pool_clear();
+
+            if (bernoulli_cache_num != n)
+            {
+                printf("FAIL: cache freed by a worker\n");
+                abort();
+            }
+        }
+
+        for (n = 0; n < FLINT_MIN(bernoulli_cache_num, N); n++)
+        {
+            if (!fmpz_equal(num + n, fmpq_numref(bernoulli_cache + n)) ||
+                !fmpz_equal(den + n, fmpq_denref(bernoulli_cache + n)))
+            {
+                printf("FAIL: n = %ld\n", n);
+                printf("vec:   "); fmpz_print(num + n); printf(" / ");
+                fmpz_print(den + n); printf("\n");
+                printf("cache: "); fmpq_print(bernoulli_cache + n); printf("\n");
+                abort();
+            }
+        }
+    }
+
+    _fmpz_vec_clear(num, N);
+    _fmpz_vec_clear(den, N);
+
+    flint_set_num_threads(1);
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,87 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "fmpz_vec.h"
+#include "fmpq_vec.h"
+#include "arith.h"
+#include "bernoulli.h"
+
+int main()
+{
+    fmpz * num;
+    fmpz * den;
+    fmpq * res;
+    long iter, i, a, b, N;
+    flint_rand_t state;
+
+    printf("vec_multimod....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    N = 1000;
+
+    num = _fmpz_vec_init(N);
+    den = _fmpz_vec_init(N);
+
+    _arith_bernoulli_number_vec_multi_mod(num, den, N);
+
+    for (iter = 0; iter < 100; iter++)
+    {
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        a = n_randint(state, N);
+        b = a + n_randint(state, N - a + 1);
+
+        res = _fmpq_vec_init(b - a);
+
+        bernoulli_vec_multimod(res, a, b);
+
+        for (i = a; i < b; i++)
+        {
+            if (!fmpz_equal(num + i, fmpq_numref(res + i - a)) ||
+                !fmpz_equal(den + i, fmpq_denref(res + i - a)))
+            {
+                printf("FAIL: a = %ld, b = %ld, i = %ld\n", a, b, i);
+                printf("vec:      "); fmpz_print(num + i); printf(" / ");
+                fmpz_print(den + i); printf("\n");
+                printf("multimod: "); fmpq_print(res + i - a); printf("\n");
+                abort();
+            }
+        }
+
+        _fmpq_vec_clear(res, b - a);
+    }
+
+    _fmpz_vec_clear(num, N);
+    _fmpz_vec_clear(den, N);
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
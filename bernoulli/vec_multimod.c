@@ -0,0 +1,252 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "bernoulli.h"
+#include "ulong_extras.h"
+#include "nmod_poly.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+    long k0;
+    long k1;
+    const mp_limb_t * primes;
+    const fmpz * den;           /* den[k-k0] = denominator of B_(2k) */
+    const long * offset;        /* residues of B_(2k) start at offset[k-k0] */
+    const long * comb_index;    /* B_(2k) is reconstructed using combs[comb_index[k-k0]] */
+    const long * comb_size;
+    mp_limb_t * residues;
+    fmpz_comb_struct * combs;
+    long num_combs;
+    long num_blocks;
+    fmpq * res;
+    long a;
+}
+multimod_arg_t;
+
+/* computes the numerators of B_(2k) mod the j-th prime, using
+   (x/2) coth(x/2) = sum_k B_(2k) x^(2k) / (2k)!, i.e.
+   sum_k B_(2k) 4^k y^k / (2k)! = (sum_k y^k / (2k)!) / (sum_k y^k / (2k+1)!) */
+static void
+_multimod_prime_worker(void * arg_ptr, long j)
+{
+    const multimod_arg_t * arg = (const multimod_arg_t *) arg_ptr;
+    mp_limb_t p, pinv, f, g, c, inv4;
+    nmod_poly_t A, B;
+    long k, len;
+
+    p = arg->primes[j];
+    pinv = n_preinvert_limb(p);
+    len = arg->k1;
+
+    nmod_poly_init2(A, p, len);
+    nmod_poly_init2(B, p, len);
+
+    /* f = 1 / (2 len - 1)! */
+    f = 1;
+    for (k = 2; k <= 2 * len - 1; k++)
+        f = n_mulmod2_preinv(f, k, p, pinv);
+    f = n_invmod(f, p);
+
+    for (k = len - 1; k >= 0; k--)
+    {
+        nmod_poly_set_coeff_ui(B, k, f);
+        f = n_mulmod2_preinv(f, 2 * k + 1, p, pinv);
+        nmod_poly_set_coeff_ui(A, k, f);
+        f = n_mulmod2_preinv(f, 2 * k, p, pinv);
+    }
+
+    nmod_poly_inv_series(B, B, len);
+    nmod_poly_mullow(A, A, B, len);
+
+    /* B_(2k) = coeff_k (2k)! / 4^k */
+    inv4 = n_invmod(4, p);
+    g = 1;
+
+    for (k = 0; k < arg->k1; k++)
+    {
+        if (k >= arg->k0 && j < arg->comb_size[arg->comb_index[k - arg->k0]])
+        {
+            c = nmod_poly_get_coeff_ui(A, k);
+            c = n_mulmod2_preinv(c, g, p, pinv);
+            c = n_mulmod2_preinv(c, fmpz_fdiv_ui(arg->den + k - arg->k0, p), p, pinv);
+            arg->residues[arg->offset[k - arg->k0] + j] = c;
+        }
+
+        g = n_mulmod2_preinv(g, 2 * k + 1, p, pinv);
+        g = n_mulmod2_preinv(g, 2 * k + 2, p, pinv);
+        g = n_mulmod2_preinv(g, inv4, p, pinv);
+    }
+
+    nmod_poly_clear(A);
+    nmod_poly_clear(B);
+}
+
+/* reconstructs the numerators of B_(2k) for k = k0 + b, k0 + b + num_blocks,
+   ..., which spreads the large indices evenly over the blocks */
+static void
+_multimod_crt_worker(void * arg_ptr, long b)
+{
+    const multimod_arg_t * arg = (const multimod_arg_t *) arg_ptr;
+    fmpz_comb_temp_struct * temps;
+    int * temp_init;
+    long k, c;
+    fmpq * x;
+
+    temps = flint_malloc(sizeof(fmpz_comb_temp_struct) * arg->num_combs);
+    temp_init = flint_calloc(arg->num_combs, sizeof(int));
+
+    for (k = arg->k0 + b; k < arg->k1; k += arg->num_blocks)
+    {
+        c = arg->comb_index[k - arg->k0];
+
+        if (!temp_init[c])
+        {
+            fmpz_comb_temp_init(temps + c, arg->combs + c);
+            temp_init[c] = 1;
+        }
+
+        x = arg->res + 2 * k - arg->a;
+        fmpz_multi_CRT_ui(fmpq_numref(x), arg->residues + arg->offset[k - arg->k0],
+            arg->combs + c, temps + c, 1);
+        fmpz_set(fmpq_denref(x), arg->den + k - arg->k0);
+    }
+
+    for (c = 0; c < arg->num_combs; c++)
+        if (temp_init[c])
+            fmpz_comb_temp_clear(temps + c);
+
+    flint_free(temps);
+    flint_free(temp_init);
+}
+
+void
+bernoulli_vec_multimod(fmpq * res, long a, long b)
+{
+    multimod_arg_t arg;
+    mp_limb_t * primes;
+    fmpz * den;
+    long * offset, * comb_index, * comb_size;
+    long i, k, k0, k1, c, bits, num_primes, num_threads, total;
+
+    if (a >= b)
+        return;
+
+    /* B_1 = -1/2 and B_n = 0 for odd n > 1 */
+    for (i = a + (a % 2 == 0); i < b; i += 2)
+    {
+        if (i == 1)
+            fmpq_set_si(res + i - a, -1, 2);
+        else
+            fmpq_zero(res + i - a);
+    }
+
+    /* the even indices are 2k for k0 <= k < k1 */
+    k0 = (a + 1) / 2;
+    k1 = (b + 1) / 2;
+
+    if (k0 >= k1)
+        return;
+
+    num_threads = flint_get_num_threads();
+
+    den = _fmpz_vec_init(k1 - k0);
+    offset = flint_malloc(sizeof(long) * (k1 - k0));
+    comb_index = flint_malloc(sizeof(long) * (k1 - k0));
+
+    /* the denominators are given by the von Staudt-Clausen theorem;
+       the numerator of B_(2k) is bounded by |B_(2k)| times the
+       denominator, and we need one extra bit for the sign */
+    num_primes = 0;
+    for (k = k0; k < k1; k++)
+    {
+        arith_bernoulli_number_denom(den + k - k0, 2 * k);
+
+        bits = (k == 0) ? 1 : FLINT_MAX(arith_bernoulli_number_size(2 * k), 1);
+        bits += fmpz_bits(den + k - k0) + 2;
+
+        /* each prime has FLINT_BITS - 1 bits; stored temporarily in offset */
+        offset[k - k0] = bits / (FLINT_BITS - 1) + 1;
+        num_primes = FLINT_MAX(num_primes, offset[k - k0]);
+    }
+
+    /* the primes exceed 2k + 1, so the factorials are invertible and
+       the primes do not divide the denominators */
+    primes = flint_malloc(sizeof(mp_limb_t) * num_primes);
+    primes[0] = n_nextprime(1UL << (FLINT_BITS - 1), 0);
+    for (i = 1; i < num_primes; i++)
+        primes[i] = n_nextprime(primes[i - 1], 0);
+
+    /* use combs on the first 1, 2, 4, ..., num_primes primes so that
+       small indices are not reconstructed with all the primes */
+    arg.num_combs = FLINT_BIT_COUNT(num_primes - 1) + 1;
+    comb_size = flint_malloc(sizeof(long) * arg.num_combs);
+    arg.combs = flint_malloc(sizeof(fmpz_comb_struct) * arg.num_combs);
+
+    for (c = 0; c < arg.num_combs; c++)
+    {
+        comb_size[c] = FLINT_MIN(1L << c, num_primes);
+        fmpz_comb_init(arg.combs + c, primes, comb_size[c]);
+    }
+
+    total = 0;
+    for (k = k0; k < k1; k++)
+    {
+        c = FLINT_BIT_COUNT(offset[k - k0] - 1);
+        comb_index[k - k0] = c;
+        offset[k - k0] = total;
+        total += comb_size[c];
+    }
+
+    arg.k0 = k0;
+    arg.k1 = k1;
+    arg.primes = primes;
+    arg.den = den;
+    arg.offset = offset;
+    arg.comb_index = comb_index;
+    arg.comb_size = comb_size;
+    arg.residues = flint_malloc(sizeof(mp_limb_t) * total);
+    arg.res = res;
+    arg.a = a;
+
+    thread_pool_parallel_for(_multimod_prime_worker, &arg,
+        num_primes, num_threads);
+
+    arg.num_blocks = FLINT_MIN(4 * num_threads, k1 - k0);
+
+    thread_pool_parallel_for(_multimod_crt_worker, &arg,
+        arg.num_blocks, num_threads);
+
+    for (c = 0; c < arg.num_combs; c++)
+        fmpz_comb_clear(arg.combs + c);
+
+    _fmpz_vec_clear(den, k1 - k0);
+    flint_free(offset);
+    flint_free(comb_index);
+    flint_free(comb_size);
+    flint_free(arg.combs);
+    flint_free(arg.residues);
+    flint_free(primes);
+}
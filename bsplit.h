@@ -0,0 +1,88 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#ifndef BSPLIT_H
+#define BSPLIT_H
+
+#include "fmprb.h"
+#include "thread_pool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+  Generic binary splitting. The user describes the state of a subinterval
+  [a, b) of the summation range (for example P, Q, T) through callbacks:
+
+    init, clear    -- initialise or free a state
+    basecase       -- compute the state for [a, b) directly; typically the
+                      sequential binary splitting recursion
+    merge          -- replace the state L for [a, m) by the state for
+                      [a, b), given the state R for [m, b), which
+                      may be overwritten
+
+  The flag cont is zero only for the top-level interval, in which case
+  quantities needed only for continuation (such as P) may be omitted.
+  The intervals are always split at m = a + (b - a) / 2, so that the
+  result does not depend on the number of threads if the sequential
+  recursion splits in the same way and uses the same merge function.
+*/
+
+typedef void (*bsplit_init_func_t)(void * state, void * args);
+typedef void (*bsplit_clear_func_t)(void * state, void * args);
+typedef void (*bsplit_basecase_func_t)(void * state,
+    long a, long b, int cont, void * args);
+typedef void (*bsplit_merge_func_t)(void * L, void * R,
+    long a, long m, long b, int cont, long num_threads, void * args);
+
+typedef struct
+{
+    size_t size;
+    bsplit_init_func_t init;
+    bsplit_clear_func_t clear;
+    bsplit_basecase_func_t basecase;
+    bsplit_merge_func_t merge;
+    void * args;
+}
+bsplit_struct;
+
+typedef bsplit_struct bsplit_t[1];
+
+void bsplit_eval(void * state, const bsplit_t B,
+    long a, long b, int cont, long num_threads);
+
+void bsplit_fmprb_mul_batch(fmprb_ptr * z, fmprb_srcptr * x,
+    fmprb_srcptr * y, long n, long prec, long num_threads);
+
+void bsplit_fmpz_mul_batch(fmpz ** z, const fmpz ** x,
+    const fmpz ** y, long n, long num_threads);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
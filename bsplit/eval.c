@@ -0,0 +1,155 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "bsplit.h"
+
+/* use at most this many leaves per thread */
+#define LEAVES_PER_THREAD 4
+
+typedef struct
+{
+    const bsplit_struct * B;
+    void ** states;
+    const long * bounds;
+    long step;
+    int cont;
+}
+bsplit_eval_arg_t;
+
+static void
+_bsplit_leaf(void * arg_ptr, long i)
+{
+    const bsplit_eval_arg_t * arg = (const bsplit_eval_arg_t *) arg_ptr;
+
+    arg->B->basecase(arg->states[i], arg->bounds[i], arg->bounds[i + 1],
+        1, arg->B->args);
+}
+
+static void
+_bsplit_merge(void * arg_ptr, long k)
+{
+    const bsplit_eval_arg_t * arg = (const bsplit_eval_arg_t *) arg_ptr;
+    long i, h;
+
+    i = k * arg->step;
+    h = arg->step / 2;
+
+    arg->B->merge(arg->states[i], arg->states[i + h], arg->bounds[i],
+        arg->bounds[i + h], arg->bounds[i + arg->step], arg->cont,
+        1, arg->B->args);
+}
+
+void
+bsplit_eval(void * state, const bsplit_t B,
+    long a, long b, int cont, long num_threads)
+{
+    bsplit_eval_arg_t arg;
+    long depth, num_leaves, count, step, i, h;
+    long * bounds;
+    void ** states;
+    char * mem;
+
+    /* choose the number of leaves, making sure that each leaf
+       has at least two terms */
+    depth = 0;
+    if (num_threads > 1)
+    {
+        while ((1L << depth) < LEAVES_PER_THREAD * num_threads &&
+                ((b - a) >> (depth + 1)) >= 2)
+            depth++;
+    }
+
+    if (depth == 0)
+    {
+        B->basecase(state, a, b, cont, B->args);
+        return;
+    }
+
+    num_leaves = 1L << depth;
+
+    /* split in the same way as the sequential recursion */
+    bounds = flint_malloc(sizeof(long) * (num_leaves + 1));
+    bounds[0] = a;
+    bounds[num_leaves] = b;
+
+    for (step = num_leaves; step > 1; step /= 2)
+    {
+        for (i = 0; i < num_leaves; i += step)
+        {
+            bounds[i + step / 2] = bounds[i] +
+                (bounds[i + step] - bounds[i]) / 2;
+        }
+    }
+
+    states = flint_malloc(sizeof(void *) * num_leaves);
+    mem = flint_malloc(B->size * (num_leaves - 1));
+
+    states[0] = state;
+    for (i = 1; i < num_leaves; i++)
+    {
+        states[i] = mem + B->size * (i - 1);
+        B->init(states[i], B->args);
+    }
+
+    arg.B = B;
+    arg.states = states;
+    arg.bounds = bounds;
+
+    thread_pool_parallel_for(_bsplit_leaf, &arg, num_leaves, num_threads);
+
+    /* merge the levels bottom-up; the levels with fewer nodes than
+       threads are merged one node at a time, letting each merge
+       use all threads for its multiplications */
+    for (step = 2; step <= num_leaves; step *= 2)
+    {
+        count = num_leaves / step;
+        arg.step = step;
+        arg.cont = (step == num_leaves) ? cont : 1;
+
+        if (count >= num_threads)
+        {
+            thread_pool_parallel_for(_bsplit_merge, &arg, count, num_threads);
+        }
+        else
+        {
+            h = step / 2;
+
+            for (i = 0; i < num_leaves; i += step)
+            {
+                B->merge(states[i], states[i + h], bounds[i],
+                    bounds[i + h], bounds[i + step], arg.cont,
+                    num_threads, B->args);
+            }
+        }
+    }
+
+    for (i = 1; i < num_leaves; i++)
+        B->clear(states[i], B->args);
+
+    flint_free(mem);
+    flint_free(states);
+    flint_free(bounds);
+}
+
@@ -0,0 +1,55 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "bsplit.h"
+
+typedef struct
+{
+    fmpz ** z;
+    const fmpz ** x;
+    const fmpz ** y;
+}
+fmpz_mul_batch_arg_t;
+
+static void
+_fmpz_mul_batch_task(void * arg_ptr, long i)
+{
+    const fmpz_mul_batch_arg_t * arg = (const fmpz_mul_batch_arg_t *) arg_ptr;
+    fmpz_mul(arg->z[i], arg->x[i], arg->y[i]);
+}
+
+void
+bsplit_fmpz_mul_batch(fmpz ** z, const fmpz ** x,
+    const fmpz ** y, long n, long num_threads)
+{
+    fmpz_mul_batch_arg_t arg;
+
+    arg.z = z;
+    arg.x = x;
+    arg.y = y;
+
+    thread_pool_parallel_for(_fmpz_mul_batch_task, &arg, n, num_threads);
+}
+
@@ -0,0 +1,186 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "bsplit.h"
+#include "ulong_extras.h"
+
+/* the sum of prod_{j=a}^{k} (j + c) / (2j + d) for k = a, ..., b - 1
+   is T / Q, where P, Q are the products of the numerators and
+   denominators over [a, b) */
+typedef struct
+{
+    fmpz P;
+    fmpz Q;
+    fmpz T;
+}
+test_state_struct;
+
+typedef struct
+{
+    long c;
+    long d;
+}
+test_arg_t;
+
+static void
+test_init(void * state, void * args)
+{
+    test_state_struct * S = state;
+
+    fmpz_init(&S->P);
+    fmpz_init(&S->Q);
+    fmpz_init(&S->T);
+}
+
+static void
+test_clear(void * state, void * args)
+{
+    test_state_struct * S = state;
+
+    fmpz_clear(&S->P);
+    fmpz_clear(&S->Q);
+    fmpz_clear(&S->T);
+}
+
+static void
+test_basecase(void * state, long a, long b, int cont, void * args)
+{
+    test_state_struct * S = state;
+    test_arg_t * arg = args;
+    long k;
+
+    fmpz_one(&S->P);
+    fmpz_one(&S->Q);
+    fmpz_zero(&S->T);
+
+    for (k = a; k < b; k++)
+    {
+        fmpz_mul_ui(&S->P, &S->P, k + arg->c);
+        fmpz_mul_ui(&S->Q, &S->Q, 2 * k + arg->d);
+        fmpz_mul_ui(&S->T, &S->T, 2 * k + arg->d);
+        fmpz_add(&S->T, &S->T, &S->P);
+    }
+}
+
+static void
+test_merge(void * L, void * R, long a, long m, long b,
+    int cont, long num_threads, void * args)
+{
+    test_state_struct * S = L;
+    test_state_struct * S2 = R;
+    fmpz_t u, v, w;
+    fmpz * z[3];
+    const fmpz * x[3];
+    const fmpz * y[3];
+
+    if (m != a + (b - a) / 2)
+    {
+        printf("FAIL (split point)\n");
+        printf("a = %ld, m = %ld, b = %ld\n", a, m, b);
+        abort();
+    }
+
+    fmpz_init(u);
+    fmpz_init(v);
+    fmpz_init(w);
+
+    z[0] = u; x[0] = &S->T; y[0] = &S2->Q;
+    z[1] = v; x[1] = &S->P; y[1] = &S2->T;
+    z[2] = w; x[2] = &S->Q; y[2] = &S2->Q;
+
+    bsplit_fmpz_mul_batch(z, x, y, 3, num_threads);
+
+    fmpz_add(&S->T, u, v);
+    fmpz_swap(&S->Q, w);
+
+    if (cont)
+        fmpz_mul(&S->P, &S->P, &S2->P);
+
+    fmpz_clear(u);
+    fmpz_clear(v);
+    fmpz_clear(w);
+}
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("eval....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 10000; iter++)
+    {
+        test_state_struct S1, S2;
+        test_arg_t arg;
+        bsplit_t B;
+        long a, b, num_threads;
+        int cont;
+
+        arg.c = 1 + n_randint(state, 10);
+        arg.d = 1 + n_randint(state, 10);
+
+        a = n_randint(state, 100);
+        b = a + 1 + n_randint(state, 300);
+        cont = n_randint(state, 2);
+        num_threads = 1 + n_randint(state, 8);
+
+        B->size = sizeof(test_state_struct);
+        B->init = test_init;
+        B->clear = test_clear;
+        B->basecase = test_basecase;
+        B->merge = test_merge;
+        B->args = &arg;
+
+        test_init(&S1, &arg);
+        test_init(&S2, &arg);
+
+        test_basecase(&S1, a, b, 1, &arg);
+        bsplit_eval(&S2, B, a, b, cont, num_threads);
+
+        if (!fmpz_equal(&S1.Q, &S2.Q) || !fmpz_equal(&S1.T, &S2.T) ||
+            (cont && !fmpz_equal(&S1.P, &S2.P)))
+        {
+            printf("FAIL\n");
+            printf("a = %ld, b = %ld, cont = %d, num_threads = %ld\n\n",
+                a, b, cont, num_threads);
+            printf("Q1 = "); fmpz_print(&S1.Q); printf("\n\n");
+            printf("Q2 = "); fmpz_print(&S2.Q); printf("\n\n");
+            printf("T1 = "); fmpz_print(&S1.T); printf("\n\n");
+            printf("T2 = "); fmpz_print(&S2.T); printf("\n\n");
+            abort();
+        }
+
+        test_clear(&S1, &arg);
+        test_clear(&S2, &arg);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
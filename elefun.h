@@ -60,6 +60,41 @@ void elefun_exp_fixed_precomp(fmpz_t y, fmpz_t yerr, fmpz_t exponent,
 
 int elefun_exp_precomp(fmprb_t z, const fmprb_t x, long prec, int minus_one);
 
+void fmprb_get_fmpz_fixed_si_check_1ulp(fmpz_t r, const fmprb_t x, long exponent);
+
+#define LOG_CACHE_PREC 1024
+#define LOG_CACHE_BITS 8
+#define LOG_CACHE_NUM (1L<<LOG_CACHE_BITS)
+#define LOG_CACHE_LEVELS 2
+#define LOG_CACHE_REDUCTION (LOG_CACHE_LEVELS * LOG_CACHE_BITS)
+
+void elefun_log_fixed_precomp(fmpz_t y, fmpz_t yerr,
+    const fmpz_t x, const fmpz_t xerr, long prec);
+
+int elefun_log_precomp(fmprb_t z, const fmpr_t x, long prec);
+
+#define ATAN_CACHE_PREC 1024
+#define ATAN_CACHE_BITS 8
+#define ATAN_CACHE_NUM (1L<<ATAN_CACHE_BITS)
+#define ATAN_CACHE_LEVELS 2
+#define ATAN_CACHE_REDUCTION (ATAN_CACHE_LEVELS * ATAN_CACHE_BITS)
+
+void elefun_atan_fixed_precomp(fmpz_t y, fmpz_t yerr,
+    const fmpz_t x, const fmpz_t xerr, long prec);
+
+int elefun_atan_precomp(fmprb_t z, const fmpr_t x, long prec);
+
+#define SIN_COS_CACHE_PREC 1024
+#define SIN_COS_CACHE_BITS 8
+#define SIN_COS_CACHE_NUM (1L<<SIN_COS_CACHE_BITS)
+#define SIN_COS_CACHE_LEVELS 2
+#define SIN_COS_CACHE_REDUCTION (SIN_COS_CACHE_LEVELS * SIN_COS_CACHE_BITS)
+
+void elefun_sin_cos_fixed_precomp(fmpz_t s, fmpz_t c, fmpz_t yerr,
+    const fmpz_t x, const fmpz_t xerr, long prec);
+
+int elefun_sin_cos_precomp(fmprb_t s, fmprb_t c, const fmpr_t x, long prec);
+
 void elefun_exp_via_mpfr(fmprb_t z, const fmprb_t x, long prec);
 
 void elefun_exp_sum_bs_powtab(fmpz_t T, fmpz_t Q, mp_bitcnt_t * Qexp,
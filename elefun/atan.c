@@ -0,0 +1,118 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "elefun.h"
+
+int
+elefun_atan_precomp(fmprb_t z, const fmpr_t x, long prec)
+{
+    fmpz_t yfixed, yfixed_err, xfixed, xfixed_err, exponent;
+    fmpr_t t;
+    fmprb_t c;
+    long mag, fixed_wp;
+    int inverse;
+
+    if (fmpr_is_special(x))
+        return 0;
+
+    /* magnitude clamped between +/- FMPR_PREC_EXACT */
+    mag = fmpr_abs_bound_lt_2exp_si(x);
+
+    /* too small or too large (simple asymptotic bounds are better) */
+    if (mag < -prec || mag > prec)
+        return 0;
+
+    fixed_wp = prec + 2 * FLINT_BIT_COUNT(prec);
+
+    /* absolute accuracy for small x */
+    if (mag < 0)
+        fixed_wp += -mag;
+
+    fixed_wp = FLINT_MAX(fixed_wp, 2 * ATAN_CACHE_REDUCTION);
+
+    if (fixed_wp > ATAN_CACHE_PREC)
+        return 0;
+
+    fmpz_init(yfixed);
+    fmpz_init(yfixed_err);
+    fmpz_init(xfixed);
+    fmpz_init(xfixed_err);
+    fmpz_init(exponent);
+    fmpr_init(t);
+    fmprb_init(c);
+
+    fmpr_abs(t, x);
+
+    /* for |x| > 1, use atan(x) = pi/2 - atan(1/x) */
+    inverse = (fmpr_cmp_2exp_si(t, 0) > 0);
+
+    if (inverse)
+    {
+        /* 1 ulp error for the division, 1 ulp for truncation */
+        fmpr_ui_div(t, 1, t, fixed_wp, FMPR_RND_DOWN);
+        fmpr_get_fmpz_fixed_si(xfixed, t, -fixed_wp);
+        fmpz_set_ui(xfixed_err, 2);
+    }
+    else
+    {
+        /* 1 ulp error for truncation */
+        fmpr_get_fmpz_fixed_si(xfixed, t, -fixed_wp);
+        fmpz_one(xfixed_err);
+    }
+
+    elefun_atan_fixed_precomp(yfixed, yfixed_err, xfixed, xfixed_err, fixed_wp);
+
+    fmpz_set_si(exponent, -fixed_wp);
+
+    if (inverse)
+    {
+        fmprb_set_fmpz_2exp(z, yfixed, exponent);
+        fmprb_const_pi(c, fixed_wp);
+        fmprb_mul_2exp_si(c, c, -1);
+        fmprb_sub(z, c, z, prec);
+    }
+    else
+    {
+        fmprb_set_round_fmpz_2exp(z, yfixed, exponent, prec);
+    }
+
+    /* add error */
+    fmpr_set_round_fmpz_2exp(t, yfixed_err, exponent, FMPRB_RAD_PREC, FMPR_RND_UP);
+    fmprb_add_error_fmpr(z, t);
+
+    if (fmpr_sgn(x) < 0)
+        fmprb_neg(z, z);
+
+    fmpz_clear(yfixed);
+    fmpz_clear(yfixed_err);
+    fmpz_clear(xfixed);
+    fmpz_clear(xfixed_err);
+    fmpz_clear(exponent);
+    fmpr_clear(t);
+    fmprb_clear(c);
+
+    return 1;
+}
+
@@ -0,0 +1,198 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "elefun.h"
+
+/* the first level needs the extra entry atan(1) */
+TLS_PREFIX fmpz atan_cache[ATAN_CACHE_LEVELS][ATAN_CACHE_NUM + 1];
+TLS_PREFIX int atan_cache_init = 0;
+
+static long
+_fmpr_atan(fmpr_t y, const fmpr_t x, long prec, fmpr_rnd_t rnd)
+{
+    long r;
+    CALL_MPFR_FUNC(r, mpfr_atan, y, x, prec, rnd);
+    return r;
+}
+
+void
+atan_cache_cleanup()
+{
+    long i, j;
+
+    for (i = 0; i < ATAN_CACHE_LEVELS; i++)
+        for (j = 0; j <= ATAN_CACHE_NUM; j++)
+            fmpz_clear(atan_cache[i] + j);
+
+    atan_cache_init = 0;
+}
+
+void
+compute_atan_cache()
+{
+    long i, j, r, wp;
+    fmprb_t y;
+    fmpr_t t;
+
+    wp = ATAN_CACHE_PREC + 30;
+
+    fmprb_init(y);
+    fmpr_init(t);
+
+    /* atan_cache[i][j] = atan(j / 2^((i+1)*ATAN_CACHE_BITS)) */
+    for (i = 0; i < ATAN_CACHE_LEVELS; i++)
+    {
+        for (j = 0; j <= ATAN_CACHE_NUM; j++)
+        {
+            fmpr_set_ui_2exp_si(t, j, -(i+1) * ATAN_CACHE_BITS);
+
+            r = _fmpr_atan(fmprb_midref(y), t, wp, FMPR_RND_DOWN);
+            mag_set_error_result(fmprb_radref(y), fmprb_midref(y), r);
+
+            fmpz_init(atan_cache[i] + j);
+            fmprb_get_fmpz_fixed_si_check_1ulp(atan_cache[i] + j, y, -ATAN_CACHE_PREC);
+        }
+    }
+
+    fmprb_clear(y);
+    fmpr_clear(t);
+
+    atan_cache_init = 1;
+
+    flint_register_cleanup_function(atan_cache_cleanup);
+}
+
+/* sets y = atan(x) for 0 <= x < 2^(-ATAN_CACHE_REDUCTION) using Horner's
+   rule on the Taylor series in x^2, with an error of at most 3 ulp
+   including the truncation of the series */
+static void
+_atan_fixed_taylor(fmpz_t y, const fmpz_t x, long prec)
+{
+    fmpz_t s, c, w;
+    long j, n;
+
+    fmpz_init(s);
+    fmpz_init(c);
+    fmpz_init(w);
+
+    n = prec / (2 * ATAN_CACHE_REDUCTION) + 1;
+
+    fmpz_one(c);
+    fmpz_mul_2exp(c, c, prec);
+
+    fmpz_mul_tdiv_q_2exp(w, x, x, prec);
+
+    /* innermost coefficient */
+    fmpz_tdiv_q_ui(s, c, 2 * n - 1);
+
+    for (j = n - 2; j >= 0; j--)
+    {
+        fmpz_mul_tdiv_q_2exp(s, s, w, prec);
+        fmpz_neg(s, s);
+        fmpz_tdiv_q_ui(y, c, 2 * j + 1);
+        fmpz_add(s, s, y);
+    }
+
+    fmpz_mul_tdiv_q_2exp(y, s, x, prec);
+
+    fmpz_clear(s);
+    fmpz_clear(c);
+    fmpz_clear(w);
+}
+
+void
+elefun_atan_fixed_precomp(fmpz_t y, fmpz_t yerr,
+    const fmpz_t x, const fmpz_t xerr, long prec)
+{
+    long i, r;
+    ulong k;
+    fmpz_t t, u, v, one;
+
+    if (prec < ATAN_CACHE_REDUCTION || prec > ATAN_CACHE_PREC)
+    {
+        printf("exception: elefun_atan_fixed_precomp: precision out of range\n");
+        abort();
+    }
+
+    fmpz_init(t);
+    fmpz_init(u);
+    fmpz_init(v);
+    fmpz_init(one);
+
+    fmpz_one(one);
+    fmpz_mul_2exp(one, one, prec);
+
+    if (fmpz_sgn(x) < 0 || fmpz_cmp(x, one) > 0)
+    {
+        printf("exception: elefun_atan_fixed_precomp: need 0 <= x <= 1\n");
+        abort();
+    }
+
+    if (!atan_cache_init)
+        compute_atan_cache();
+
+    fmpz_set(t, x);
+    fmpz_zero(y);
+
+    /* atan(t) = atan(c) + atan((t - c) / (1 + c t)), where c = k / 2^r
+       consists of the leading bits of t; the quotient is rounded down,
+       so t stays nonnegative */
+    for (i = 0; i < ATAN_CACHE_LEVELS; i++)
+    {
+        r = (i + 1) * ATAN_CACHE_BITS;
+
+        fmpz_tdiv_q_2exp(u, t, prec - r);
+        k = fmpz_get_ui(u);
+
+        if (k != 0)
+        {
+            /* v = 1 + c t, u = t - c */
+            fmpz_mul_ui(v, t, k);
+            fmpz_tdiv_q_2exp(v, v, r);
+            fmpz_add(v, v, one);
+            fmpz_mul_2exp(u, u, prec - r);
+            fmpz_sub(u, t, u);
+
+            fmpz_mul_2exp(t, u, prec);
+            fmpz_tdiv_q(t, t, v);
+
+            fmpz_tdiv_q_2exp(v, atan_cache[i] + k, ATAN_CACHE_PREC - prec);
+            fmpz_add(y, y, v);
+        }
+    }
+
+    _atan_fixed_taylor(u, t, prec);
+    fmpz_add(y, y, u);
+
+    /* each level adds 2 ulp for the division and 2 ulp for the table
+       entry; the input error is not magnified since atan'(x) <= 1 */
+    fmpz_add_ui(yerr, xerr, 4 * ATAN_CACHE_LEVELS + 3);
+
+    fmpz_clear(t);
+    fmpz_clear(u);
+    fmpz_clear(v);
+    fmpz_clear(one);
+}
+
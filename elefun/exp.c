@@ -33,7 +33,7 @@ elefun_exp_precomp(fmprb_t z, const fmprb_t x, long prec, int minus_one)
     long mag, fixed_wp;
 
     /* require radius < 0.25 */
-    if (fmpr_cmp_2exp_si(fmprb_radref(x), -2) >= 0)
+    if (mag_cmp_2exp_si(fmprb_radref(x), -2) >= 0)
         return 0;
 
     /* magnitude clamped between +/- FMPR_PREC_EXACT */
@@ -68,7 +68,8 @@ elefun_exp_precomp(fmprb_t z, const fmprb_t x, long prec, int minus_one)
 
     /* convert radius to fixed-point number; need to add 1 for
        error rounding midpoint, 1 for rounding the error itself */
-    fmpr_get_fmpz_fixed_si(xfixed_err, fmprb_radref(x), -fixed_wp);
+    fmprb_get_rad_fmpr(terr, x);
+    fmpr_get_fmpz_fixed_si(xfixed_err, terr, -fixed_wp);
     fmpz_add_ui(xfixed_err, xfixed_err, 2);
 
     /* compute exp(x) as a fixed-point number */
@@ -88,7 +89,7 @@ elefun_exp_precomp(fmprb_t z, const fmprb_t x, long prec, int minus_one)
 
     /* add error */
     fmpr_set_round_fmpz_2exp(terr, zfixed_err, exponent, FMPRB_RAD_PREC, FMPR_RND_UP);
-    fmpr_add(fmprb_radref(z), fmprb_radref(z), terr, FMPRB_RAD_PREC, FMPR_RND_UP);
+    fmprb_add_error_fmpr(z, terr);
 
     fmpz_clear(zfixed);
     fmpz_clear(zfixed_err);
@@ -46,10 +46,9 @@ fmprb_get_fmpz_fixed_si_check_1ulp(fmpz_t r, const fmprb_t x, long exponent)
     fmprb_sub(t, t, x, FMPRB_RAD_PREC);
     fmprb_abs(t, t);
 
-    fmpr_add(fmprb_radref(t), fmprb_midref(t), fmprb_radref(t),
-        FMPRB_RAD_PREC, FMPR_RND_CEIL);
+    fmprb_get_ubound_fmpr(fmprb_midref(t), t, FMPRB_RAD_PREC);
 
-    if (fmpr_cmp_2exp_si(fmprb_radref(t), exponent) > 0)
+    if (fmpr_cmp_2exp_si(fmprb_midref(t), exponent) > 0)
     {
         printf("error larger than 1 ulp!\n");
         abort();
@@ -86,7 +85,7 @@ compute_exp_cache()
     for (i = 0; i < EXP_CACHE_LEVELS; i++)
     {
         fmpr_set_ui_2exp_si(fmprb_midref(x), 1, -(i+1) * EXP_CACHE_BITS);
-        fmpr_zero(fmprb_radref(x));
+        mag_zero(fmprb_radref(x));
 
         elefun_exp_via_mpfr(x, x, wp);
         fmprb_one(y);
@@ -149,7 +149,7 @@ elefun_exp_fmpr_bb(fmprb_t z, const fmpr_t x, long prec, int m1)
             fmprb_init(w);
             fmpr_set_fmpz(fmprb_midref(w), T);
             fmpr_mul_2exp_si(fmprb_midref(w), fmprb_midref(w), -wp);
-            fmpr_set_si_2exp_si(fmprb_radref(w), 2, -wp);
+            mag_set_ui_2exp_si(fmprb_radref(w), 2, -wp);
             fmprb_mul(z, z, w, wp);
             fmprb_clear(w);
         }
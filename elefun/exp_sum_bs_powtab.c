@@ -24,6 +24,7 @@
 ******************************************************************************/
 
 #include "elefun.h"
+#include "bsplit.h"
 
 /* When splitting [a,b) into [a,m), [m,b), we need the power x^(m-a).
    This function computes all the exponents (m-a) that can appear when
@@ -140,6 +141,55 @@ get_exp_pos(const long * tab, long step)
     }
 }
 
+typedef struct
+{
+    fmpz T;
+    fmpz Q;
+    mp_bitcnt_t Qexp;
+}
+exp_bsplit_struct;
+
+typedef struct
+{
+    const long * xexp;
+    const fmpz * xpow;
+    mp_bitcnt_t r;
+}
+exp_bsplit_arg_t;
+
+/* sets (T, Q, Qexp) to the combination of (T, Q, Qexp) for [a, a + step)
+   and (T2, Q2, Q2exp); the three multiplications are done in parallel */
+static void
+bsplit_merge(fmpz_t T, fmpz_t Q, mp_bitcnt_t * Qexp,
+    const fmpz_t T2, const fmpz_t Q2, mp_bitcnt_t Q2exp,
+    const long * xexp, const fmpz * xpow, long step, long num_threads)
+{
+    fmpz_t u, v, w;
+    fmpz * z[3];
+    const fmpz * x[3];
+    const fmpz * y[3];
+
+    fmpz_init(u);
+    fmpz_init(v);
+    fmpz_init(w);
+
+    z[0] = u; x[0] = T; y[0] = Q2;
+    /* find x^step in table */
+    z[1] = v; x[1] = xpow + get_exp_pos(xexp, step); y[1] = T2;
+    z[2] = w; x[2] = Q; y[2] = Q2;
+
+    bsplit_fmpz_mul_batch(z, x, y, 3, num_threads);
+
+    fmpz_mul_2exp(T, u, Q2exp);
+    fmpz_add(T, T, v);
+    fmpz_swap(Q, w);
+    *Qexp = *Qexp + Q2exp;
+
+    fmpz_clear(u);
+    fmpz_clear(v);
+    fmpz_clear(w);
+}
+
 static void
 bsplit(fmpz_t T, fmpz_t Q, mp_bitcnt_t * Qexp,
     const long * xexp,
@@ -171,7 +221,7 @@ bsplit(fmpz_t T, fmpz_t Q, mp_bitcnt_t * Qexp,
     }
     else
     {
-        long step, m, i;
+        long step, m;
         mp_bitcnt_t Q2exp[1];
         fmpz_t Q2, T2;
 
@@ -184,20 +234,53 @@ bsplit(fmpz_t T, fmpz_t Q, mp_bitcnt_t * Qexp,
         bsplit(T,  Q,  Qexp,  xexp, xpow, r, a, m);
         bsplit(T2, Q2, Q2exp, xexp, xpow, r, m, b);
 
-        fmpz_mul(T, T, Q2);
-        fmpz_mul_2exp(T, T, *Q2exp);
+        bsplit_merge(T, Q, Qexp, T2, Q2, *Q2exp, xexp, xpow, step, 1);
 
-        /* find x^step in table */
-        i = get_exp_pos(xexp, step);
-        fmpz_addmul(T, xpow + i, T2);  
         fmpz_clear(T2);
-
-        fmpz_mul(Q, Q, Q2);
-        *Qexp = *Qexp + *Q2exp;
         fmpz_clear(Q2);
     }
 }
 
+static void
+_exp_bsplit_init(void * state, void * args)
+{
+    exp_bsplit_struct * S = state;
+
+    fmpz_init(&S->T);
+    fmpz_init(&S->Q);
+    S->Qexp = 0;
+}
+
+static void
+_exp_bsplit_clear(void * state, void * args)
+{
+    exp_bsplit_struct * S = state;
+
+    fmpz_clear(&S->T);
+    fmpz_clear(&S->Q);
+}
+
+static void
+_exp_bsplit_basecase(void * state, long a, long b, int cont, void * args)
+{
+    exp_bsplit_struct * S = state;
+    exp_bsplit_arg_t * arg = args;
+
+    bsplit(&S->T, &S->Q, &S->Qexp, arg->xexp, arg->xpow, arg->r, a, b);
+}
+
+static void
+_exp_bsplit_merge(void * L, void * R, long a, long m, long b,
+    int cont, long num_threads, void * args)
+{
+    exp_bsplit_struct * S = L;
+    exp_bsplit_struct * S2 = R;
+    exp_bsplit_arg_t * arg = args;
+
+    bsplit_merge(&S->T, &S->Q, &S->Qexp, &S2->T, &S2->Q, S2->Qexp,
+        arg->xexp, arg->xpow, m - a, num_threads);
+}
+
 void
 elefun_exp_sum_bs_powtab(fmpz_t T, fmpz_t Q, mp_bitcnt_t * Qexp,
     const fmpz_t x, mp_bitcnt_t r, long N)
@@ -205,6 +288,9 @@ elefun_exp_sum_bs_powtab(fmpz_t T, fmpz_t Q, mp_bitcnt_t * Qexp,
     long * xexp;
     long length, i;
     fmpz * xpow;
+    exp_bsplit_struct S;
+    exp_bsplit_arg_t arg;
+    bsplit_t B;
 
     /* compute the powers of x that will appear (at least x^1) */
     xexp = flint_calloc(2 * FLINT_BITS, sizeof(long));
@@ -241,7 +327,24 @@ elefun_exp_sum_bs_powtab(fmpz_t T, fmpz_t Q, mp_bitcnt_t * Qexp,
         }
     }
 
-    bsplit(T, Q, Qexp, xexp, xpow, r, 0, N);
+    arg.xexp = xexp;
+    arg.xpow = xpow;
+    arg.r = r;
+
+    B->size = sizeof(exp_bsplit_struct);
+    B->init = _exp_bsplit_init;
+    B->clear = _exp_bsplit_clear;
+    B->basecase = _exp_bsplit_basecase;
+    B->merge = _exp_bsplit_merge;
+    B->args = &arg;
+
+    _exp_bsplit_init(&S, &arg);
+    bsplit_eval(&S, B, 0, N, 0, flint_get_num_threads());
+
+    fmpz_swap(T, &S.T);
+    fmpz_swap(Q, &S.Q);
+    *Qexp = S.Qexp;
+    _exp_bsplit_clear(&S, &arg);
 
     fmpz_init(xpow + 0);  /* don't free the shallow copy of x */
     _fmpz_vec_clear(xpow, length);
@@ -30,7 +30,7 @@ elefun_exp_fmpr_via_mpfr(fmprb_t z, const fmpr_t x, long prec)
 {
     long r;
     r = fmpr_exp(fmprb_midref(z), x, prec, FMPR_RND_DOWN);
-    fmpr_set_error_result(fmprb_radref(z), fmprb_midref(z), r);
+    mag_set_error_result(fmprb_radref(z), fmprb_midref(z), r);
 }
 
 void
@@ -43,17 +43,20 @@ elefun_exp_via_mpfr(fmprb_t z, const fmprb_t x, long prec)
     else
     {
         /* exp(a+b) - exp(a) = exp(a) * (exp(b)-1) <= b * exp(a+b) */
-        fmpr_t t;
+        fmpr_t t, u;
         fmpr_init(t);
+        fmpr_init(u);
 
-        fmpr_add(t, fmprb_midref(x), fmprb_radref(x), FMPRB_RAD_PREC, FMPR_RND_CEIL);
+        fmprb_get_ubound_fmpr(t, x, FMPRB_RAD_PREC);
         fmpr_exp(t, t, FMPRB_RAD_PREC, FMPR_RND_UP);
-        fmpr_mul(t, t, fmprb_radref(x), FMPRB_RAD_PREC, FMPR_RND_UP);
+        fmprb_get_rad_fmpr(u, x);
+        fmpr_mul(t, t, u, FMPRB_RAD_PREC, FMPR_RND_UP);
 
         elefun_exp_fmpr_via_mpfr(z, fmprb_midref(x), prec);
-        fmpr_add(fmprb_radref(z), fmprb_radref(z), t, FMPRB_RAD_PREC, FMPR_RND_UP);
+        fmprb_add_error_fmpr(z, t);
 
         fmpr_clear(t);
+        fmpr_clear(u);
     }
 }
 
@@ -0,0 +1,117 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "elefun.h"
+
+int
+elefun_log_precomp(fmprb_t z, const fmpr_t x, long prec)
+{
+    fmpz_t yfixed, yfixed_err, xfixed, xfixed_err, exponent;
+    fmpr_t t;
+    fmprb_t c;
+    long mag, k, fixed_wp;
+
+    if (fmpr_is_special(x) || fmpr_sgn(x) <= 0)
+        return 0;
+
+    /* magnitude clamped between +/- FMPR_PREC_EXACT */
+    mag = fmpr_abs_bound_lt_2exp_si(x);
+
+    /* too large or too small */
+    if (mag > FMPR_PREC_EXACT / 2 || mag < -FMPR_PREC_EXACT / 2)
+        return 0;
+
+    /* x = t * 2^k with 1 <= t < 2 */
+    k = mag - 1;
+
+    fixed_wp = prec + 2 * FLINT_BIT_COUNT(prec);
+
+    fmpr_init(t);
+
+    /* cancellation between log(t) and k log(2) near x = 1 */
+    if (k == 0 || k == -1)
+    {
+        fmpr_sub_ui(t, x, 1, FMPR_PREC_EXACT, FMPR_RND_DOWN);
+
+        if (fmpr_is_zero(t))
+        {
+            fmprb_zero(z);
+            fmpr_clear(t);
+            return 1;
+        }
+
+        fixed_wp -= fmpr_abs_bound_lt_2exp_si(t);
+    }
+
+    fixed_wp = FLINT_MAX(fixed_wp, 2 * LOG_CACHE_REDUCTION);
+
+    if (fixed_wp > LOG_CACHE_PREC)
+    {
+        fmpr_clear(t);
+        return 0;
+    }
+
+    fmpz_init(yfixed);
+    fmpz_init(yfixed_err);
+    fmpz_init(xfixed);
+    fmpz_init(xfixed_err);
+    fmpz_init(exponent);
+    fmprb_init(c);
+
+    /* truncating t to a fixed-point number adds 1 ulp error */
+    fmpr_get_fmpz_fixed_si(xfixed, x, k - fixed_wp);
+    fmpz_one(xfixed_err);
+
+    elefun_log_fixed_precomp(yfixed, yfixed_err, xfixed, xfixed_err, fixed_wp);
+
+    fmpz_set_si(exponent, -fixed_wp);
+
+    if (k == 0)
+    {
+        fmprb_set_round_fmpz_2exp(z, yfixed, exponent, prec);
+    }
+    else
+    {
+        fmprb_set_fmpz_2exp(z, yfixed, exponent);
+        fmprb_const_log2(c, fixed_wp + FLINT_BIT_COUNT(FLINT_ABS(k)));
+        fmprb_mul_si(c, c, k, fixed_wp + FLINT_BIT_COUNT(FLINT_ABS(k)));
+        fmprb_add(z, z, c, prec);
+    }
+
+    /* add error */
+    fmpr_set_round_fmpz_2exp(t, yfixed_err, exponent, FMPRB_RAD_PREC, FMPR_RND_UP);
+    fmprb_add_error_fmpr(z, t);
+
+    fmpz_clear(yfixed);
+    fmpz_clear(yfixed_err);
+    fmpz_clear(xfixed);
+    fmpz_clear(xfixed_err);
+    fmpz_clear(exponent);
+    fmpr_clear(t);
+    fmprb_clear(c);
+
+    return 1;
+}
+
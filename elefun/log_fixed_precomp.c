@@ -0,0 +1,177 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "elefun.h"
+
+TLS_PREFIX fmpz log_cache[LOG_CACHE_LEVELS][LOG_CACHE_NUM];
+TLS_PREFIX int log_cache_init = 0;
+
+void
+log_cache_cleanup()
+{
+    long i, j;
+
+    for (i = 0; i < LOG_CACHE_LEVELS; i++)
+        for (j = 0; j < LOG_CACHE_NUM; j++)
+            fmpz_clear(log_cache[i] + j);
+
+    log_cache_init = 0;
+}
+
+void
+compute_log_cache()
+{
+    long i, j, r, wp;
+    fmprb_t y;
+    fmpr_t t;
+
+    wp = LOG_CACHE_PREC + 30;
+
+    fmprb_init(y);
+    fmpr_init(t);
+
+    /* log_cache[i][j] = log(1 + j / 2^((i+1)*LOG_CACHE_BITS)) */
+    for (i = 0; i < LOG_CACHE_LEVELS; i++)
+    {
+        for (j = 0; j < LOG_CACHE_NUM; j++)
+        {
+            fmpr_set_ui_2exp_si(t, j, -(i+1) * LOG_CACHE_BITS);
+            fmpr_add_ui(t, t, 1, FMPR_PREC_EXACT, FMPR_RND_DOWN);
+
+            r = fmpr_log(fmprb_midref(y), t, wp, FMPR_RND_DOWN);
+            mag_set_error_result(fmprb_radref(y), fmprb_midref(y), r);
+
+            fmpz_init(log_cache[i] + j);
+            fmprb_get_fmpz_fixed_si_check_1ulp(log_cache[i] + j, y, -LOG_CACHE_PREC);
+        }
+    }
+
+    fmprb_clear(y);
+    fmpr_clear(t);
+
+    log_cache_init = 1;
+
+    flint_register_cleanup_function(log_cache_cleanup);
+}
+
+/* sets y = log(1+x) for 0 <= x < 2^(-LOG_CACHE_REDUCTION) using Horner's
+   rule on the Taylor series, with an error of at most 3 ulp including
+   the truncation of the series */
+static void
+_log1p_fixed_taylor(fmpz_t y, const fmpz_t x, long prec)
+{
+    fmpz_t s, c;
+    long j, n;
+
+    fmpz_init(s);
+    fmpz_init(c);
+
+    n = prec / LOG_CACHE_REDUCTION + 1;
+
+    fmpz_one(c);
+    fmpz_mul_2exp(c, c, prec);
+
+    /* innermost coefficient */
+    fmpz_tdiv_q_ui(s, c, n);
+
+    for (j = n - 1; j >= 1; j--)
+    {
+        fmpz_mul_tdiv_q_2exp(s, s, x, prec);
+        fmpz_neg(s, s);
+        fmpz_tdiv_q_ui(y, c, j);
+        fmpz_add(s, s, y);
+    }
+
+    fmpz_mul_tdiv_q_2exp(y, s, x, prec);
+
+    fmpz_clear(s);
+    fmpz_clear(c);
+}
+
+void
+elefun_log_fixed_precomp(fmpz_t y, fmpz_t yerr,
+    const fmpz_t x, const fmpz_t xerr, long prec)
+{
+    long i, r;
+    ulong k;
+    fmpz_t t, u, v, one;
+
+    if (prec < LOG_CACHE_REDUCTION || prec > LOG_CACHE_PREC)
+    {
+        printf("exception: elefun_log_fixed_precomp: precision out of range\n");
+        abort();
+    }
+
+    if (!log_cache_init)
+        compute_log_cache();
+
+    fmpz_init(t);
+    fmpz_init(u);
+    fmpz_init(v);
+    fmpz_init(one);
+
+    fmpz_one(one);
+    fmpz_mul_2exp(one, one, prec);
+
+    fmpz_set(t, x);
+    fmpz_zero(y);
+
+    /* write x = (1 + k_0 / 2^b) (1 + k_1 / 2^(2b)) ... (1 + t),
+       where each division by 1 + k_i / 2^(ib) is rounded down so
+       that t stays nonnegative */
+    for (i = 0; i < LOG_CACHE_LEVELS; i++)
+    {
+        r = (i + 1) * LOG_CACHE_BITS;
+
+        fmpz_sub(u, t, one);
+        fmpz_tdiv_q_2exp(u, u, prec - r);
+        k = fmpz_get_ui(u);
+
+        if (k != 0)
+        {
+            fmpz_mul_2exp(u, u, prec - r);
+            fmpz_add(u, u, one);
+            fmpz_mul_2exp(t, t, prec);
+            fmpz_tdiv_q(t, t, u);
+
+            fmpz_tdiv_q_2exp(v, log_cache[i] + k, LOG_CACHE_PREC - prec);
+            fmpz_add(y, y, v);
+        }
+    }
+
+    fmpz_sub(t, t, one);
+    _log1p_fixed_taylor(u, t, prec);
+    fmpz_add(y, y, u);
+
+    /* each level adds 1 ulp for the division and 2 ulp for the table
+       entry; the input error is not magnified since 1 <= x */
+    fmpz_add_ui(yerr, xerr, 3 * LOG_CACHE_LEVELS + 3);
+
+    fmpz_clear(t);
+    fmpz_clear(u);
+    fmpz_clear(v);
+    fmpz_clear(one);
+}
+
@@ -0,0 +1,116 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "elefun.h"
+
+int
+elefun_sin_cos_precomp(fmprb_t s, fmprb_t c, const fmpr_t x, long prec)
+{
+    fmpz_t sfixed, cfixed, yfixed_err, xfixed, xfixed_err, exponent;
+    fmpr_t t;
+    long mag, fixed_wp, min_bits;
+    int result;
+
+    if (fmpr_is_special(x))
+        return 0;
+
+    /* magnitude clamped between +/- FMPR_PREC_EXACT */
+    mag = fmpr_abs_bound_lt_2exp_si(x);
+
+    /* too large */
+    if (mag >= 128)
+        return 0;
+
+    /* too small */
+    if (mag < -prec)
+        return 0;
+
+    fixed_wp = prec + 2 * FLINT_BIT_COUNT(prec);
+
+    if (mag > 0)
+        fixed_wp += mag;   /* for argument reduction */
+    else
+        fixed_wp += -mag;  /* absolute accuracy for small x */
+
+    fixed_wp = FLINT_MAX(fixed_wp, 2 * SIN_COS_CACHE_REDUCTION);
+
+    if (fixed_wp > SIN_COS_CACHE_PREC)
+        return 0;
+
+    fmpz_init(sfixed);
+    fmpz_init(cfixed);
+    fmpz_init(yfixed_err);
+    fmpz_init(xfixed);
+    fmpz_init(xfixed_err);
+    fmpz_init(exponent);
+    fmpr_init(t);
+
+    /* 1 ulp error for truncation */
+    fmpr_abs(t, x);
+    fmpr_get_fmpz_fixed_si(xfixed, t, -fixed_wp);
+    fmpz_one(xfixed_err);
+
+    elefun_sin_cos_fixed_precomp(sfixed, cfixed, yfixed_err,
+        xfixed, xfixed_err, fixed_wp);
+
+    /* near a zero of sin or cos, the fixed-point result does not give
+       full relative accuracy; let the caller use another algorithm */
+    min_bits = prec + fmpz_bits(yfixed_err) + 1;
+
+    result = !((s != NULL && fmpz_bits(sfixed) < min_bits) ||
+               (c != NULL && fmpz_bits(cfixed) < min_bits));
+
+    if (result)
+    {
+        fmpz_set_si(exponent, -fixed_wp);
+        fmpr_set_round_fmpz_2exp(t, yfixed_err, exponent, FMPRB_RAD_PREC, FMPR_RND_UP);
+
+        if (s != NULL)
+        {
+            if (fmpr_sgn(x) < 0)
+                fmpz_neg(sfixed, sfixed);
+
+            fmprb_set_round_fmpz_2exp(s, sfixed, exponent, prec);
+            fmprb_add_error_fmpr(s, t);
+        }
+
+        if (c != NULL)
+        {
+            fmprb_set_round_fmpz_2exp(c, cfixed, exponent, prec);
+            fmprb_add_error_fmpr(c, t);
+        }
+    }
+
+    fmpz_clear(sfixed);
+    fmpz_clear(cfixed);
+    fmpz_clear(yfixed_err);
+    fmpz_clear(xfixed);
+    fmpz_clear(xfixed_err);
+    fmpz_clear(exponent);
+    fmpr_clear(t);
+
+    return result;
+}
+
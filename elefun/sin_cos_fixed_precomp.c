@@ -0,0 +1,267 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "elefun.h"
+
+/* the error bound in elefun_sin_cos_fixed_precomp assumes two levels */
+#if SIN_COS_CACHE_LEVELS != 2
+#error "elefun_sin_cos_fixed_precomp: the error bound requires SIN_COS_CACHE_LEVELS == 2"
+#endif
+
+TLS_PREFIX fmpz_t pi4_cache;
+TLS_PREFIX fmpz sin_cache[SIN_COS_CACHE_LEVELS][SIN_COS_CACHE_NUM];
+TLS_PREFIX fmpz cos_cache[SIN_COS_CACHE_LEVELS][SIN_COS_CACHE_NUM];
+TLS_PREFIX int sin_cos_cache_init = 0;
+
+static void
+_fmpr_sin_cos(long * r1, long * r2, fmpr_t s, fmpr_t c, const fmpr_t x, long prec, fmpr_rnd_t rnd)
+{
+    CALL_MPFR_FUNC_2X1(*r1, *r2, mpfr_sin_cos, s, c, x, prec, rnd);
+}
+
+void
+sin_cos_cache_cleanup()
+{
+    long i, j;
+
+    for (i = 0; i < SIN_COS_CACHE_LEVELS; i++)
+    {
+        for (j = 0; j < SIN_COS_CACHE_NUM; j++)
+        {
+            fmpz_clear(sin_cache[i] + j);
+            fmpz_clear(cos_cache[i] + j);
+        }
+    }
+
+    fmpz_clear(pi4_cache);
+
+    sin_cos_cache_init = 0;
+}
+
+void
+compute_sin_cos_cache()
+{
+    long i, j, r1, r2, wp;
+    fmprb_t s, c;
+    fmpr_t t;
+
+    wp = SIN_COS_CACHE_PREC + 30;
+
+    fmprb_init(s);
+    fmprb_init(c);
+    fmpr_init(t);
+
+    /* sin_cache[i][j] = sin(j / 2^((i+1)*SIN_COS_CACHE_BITS)), similarly cos */
+    for (i = 0; i < SIN_COS_CACHE_LEVELS; i++)
+    {
+        for (j = 0; j < SIN_COS_CACHE_NUM; j++)
+        {
+            fmpr_set_ui_2exp_si(t, j, -(i+1) * SIN_COS_CACHE_BITS);
+
+            _fmpr_sin_cos(&r1, &r2, fmprb_midref(s), fmprb_midref(c), t, wp, FMPR_RND_DOWN);
+            mag_set_error_result(fmprb_radref(s), fmprb_midref(s), r1);
+            mag_set_error_result(fmprb_radref(c), fmprb_midref(c), r2);
+
+            fmpz_init(sin_cache[i] + j);
+            fmpz_init(cos_cache[i] + j);
+            fmprb_get_fmpz_fixed_si_check_1ulp(sin_cache[i] + j, s, -SIN_COS_CACHE_PREC);
+            fmprb_get_fmpz_fixed_si_check_1ulp(cos_cache[i] + j, c, -SIN_COS_CACHE_PREC);
+        }
+    }
+
+    fmprb_const_pi(s, wp);
+    fmprb_mul_2exp_si(s, s, -2);
+
+    fmpz_init(pi4_cache);
+    fmprb_get_fmpz_fixed_si_check_1ulp(pi4_cache, s, -SIN_COS_CACHE_PREC);
+
+    fmprb_clear(s);
+    fmprb_clear(c);
+    fmpr_clear(t);
+
+    sin_cos_cache_init = 1;
+
+    flint_register_cleanup_function(sin_cos_cache_cleanup);
+}
+
+/* sets s = sin(x), c = cos(x) for 0 <= x < 2^(-SIN_COS_CACHE_REDUCTION)
+   using Horner's rule on the Taylor series in x^2, with an error of at
+   most 3 ulp each including the truncation of the series */
+static void
+_sin_cos_fixed_taylor(fmpz_t s, fmpz_t c, const fmpz_t x, long prec)
+{
+    fmpz_t one, w, t;
+    long j, n;
+
+    fmpz_init(one);
+    fmpz_init(w);
+    fmpz_init(t);
+
+    n = prec / (2 * SIN_COS_CACHE_REDUCTION) + 1;
+
+    fmpz_one(one);
+    fmpz_mul_2exp(one, one, prec);
+
+    fmpz_mul_tdiv_q_2exp(w, x, x, prec);
+
+    /* sin(x) = x (1 - x^2/(2*3) (1 - x^2/(4*5) (1 - ...))) and
+       cos(x) = 1 - x^2/(1*2) (1 - x^2/(3*4) (1 - ...)) */
+    fmpz_set(s, one);
+    fmpz_set(c, one);
+
+    for (j = n; j >= 1; j--)
+    {
+        fmpz_mul_tdiv_q_2exp(t, s, w, prec);
+        fmpz_tdiv_q_ui(t, t, (2 * j) * (2 * j + 1));
+        fmpz_sub(s, one, t);
+
+        fmpz_mul_tdiv_q_2exp(t, c, w, prec);
+        fmpz_tdiv_q_ui(t, t, (2 * j - 1) * (2 * j));
+        fmpz_sub(c, one, t);
+    }
+
+    fmpz_mul_tdiv_q_2exp(s, s, x, prec);
+
+    fmpz_clear(one);
+    fmpz_clear(w);
+    fmpz_clear(t);
+}
+
+void
+elefun_sin_cos_fixed_precomp(fmpz_t s, fmpz_t c, fmpz_t yerr,
+    const fmpz_t x, const fmpz_t xerr, long prec)
+{
+    long i, r;
+    ulong k, q;
+    int odd;
+    fmpz_t n, t, u, v, sk, ck;
+
+    if (prec < SIN_COS_CACHE_REDUCTION || prec > SIN_COS_CACHE_PREC)
+    {
+        printf("exception: elefun_sin_cos_fixed_precomp: precision out of range\n");
+        abort();
+    }
+
+    if (fmpz_sgn(x) < 0)
+    {
+        printf("exception: elefun_sin_cos_fixed_precomp: need x >= 0\n");
+        abort();
+    }
+
+    if (!sin_cos_cache_init)
+        compute_sin_cos_cache();
+
+    fmpz_init(n);
+    fmpz_init(t);
+    fmpz_init(u);
+    fmpz_init(v);
+    fmpz_init(sk);
+    fmpz_init(ck);
+
+    /* x = n pi/4 + u with 0 <= u < pi/4; pi/4 has 2 ulp error
+       (1 ulp in the table and 1 ulp from truncating it) */
+    fmpz_tdiv_q_2exp(v, pi4_cache, SIN_COS_CACHE_PREC - prec);
+    fmpz_fdiv_qr(n, u, x, v);
+
+    fmpz_mul_ui(yerr, n, 2);
+    fmpz_add(yerr, yerr, xerr);
+
+    /* for odd n, write x = (n+1) pi/4 - u' with u' = pi/4 - u */
+    odd = fmpz_is_odd(n);
+    if (odd)
+    {
+        fmpz_sub(u, v, u);
+        fmpz_add_ui(n, n, 1);
+        fmpz_add_ui(yerr, yerr, 2);
+    }
+
+    /* quadrant */
+    q = fmpz_fdiv_ui(n, 8) / 2;
+
+    /* write u = a_0 + a_1 + t where a_i = k_i / 2^((i+1)*b) */
+    fmpz_tdiv_q_2exp(t, u, prec - SIN_COS_CACHE_REDUCTION);
+    fmpz_mul_2exp(t, t, prec - SIN_COS_CACHE_REDUCTION);
+    fmpz_sub(t, u, t);
+    fmpz_tdiv_q_2exp(u, u, prec - SIN_COS_CACHE_REDUCTION);
+
+    _sin_cos_fixed_taylor(s, c, t, prec);
+
+    /* combine using sin(a+b) = sin(a) cos(b) + cos(a) sin(b) and
+       cos(a+b) = cos(a) cos(b) - sin(a) sin(b) */
+    for (i = SIN_COS_CACHE_LEVELS - 1; i >= 0; i--)
+    {
+        r = (SIN_COS_CACHE_LEVELS - i - 1) * SIN_COS_CACHE_BITS;
+        k = (fmpz_get_ui(u) >> r) & (SIN_COS_CACHE_NUM - 1);
+
+        if (k != 0)
+        {
+            fmpz_tdiv_q_2exp(sk, sin_cache[i] + k, SIN_COS_CACHE_PREC - prec);
+            fmpz_tdiv_q_2exp(ck, cos_cache[i] + k, SIN_COS_CACHE_PREC - prec);
+
+            fmpz_mul(t, s, ck);
+            fmpz_addmul(t, c, sk);
+            fmpz_mul(v, c, ck);
+            fmpz_submul(v, s, sk);
+
+            fmpz_tdiv_q_2exp(s, t, prec);
+            fmpz_tdiv_q_2exp(c, v, prec);
+        }
+    }
+
+    /* errors: 3 ulp from the Taylor series; each level multiplies the
+       error by at most |sin(a)| + |cos(a)| <= sqrt(2) and adds 2 ulp
+       times the same factor for the table entries plus 1 ulp for
+       rounding, which gives less than 16 ulp in total */
+    fmpz_add_ui(yerr, yerr, 16);
+
+    if (odd)
+        fmpz_neg(s, s);
+
+    switch (q)
+    {
+        case 0:
+            break;
+        case 1:
+            fmpz_swap(s, c);
+            fmpz_neg(c, c);
+            break;
+        case 2:
+            fmpz_neg(s, s);
+            fmpz_neg(c, c);
+            break;
+        default:
+            fmpz_swap(s, c);
+            fmpz_neg(s, s);
+            break;
+    }
+
+    fmpz_clear(n);
+    fmpz_clear(t);
+    fmpz_clear(u);
+    fmpz_clear(v);
+    fmpz_clear(sk);
+    fmpz_clear(ck);
+}
+
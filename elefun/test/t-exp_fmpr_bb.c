@@ -45,7 +45,7 @@ int main()
         fmprb_init(z);
 
         fmprb_randtest(x, state, 1 + n_randint(state, 8000), 3);
-        fmpr_zero(fmprb_radref(x));
+        mag_zero(fmprb_radref(x));
 
         if (n_randint(state, 2))
         {
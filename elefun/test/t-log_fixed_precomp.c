@@ -0,0 +1,133 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "elefun.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("log_fixed_precomp....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100000; iter++)
+    {
+        long prec, prec2;
+
+        fmpz_t y, yerr, x, xerr, one;
+        fmpr_t ya, yb, xa, xb, t, u;
+
+        prec = LOG_CACHE_REDUCTION + n_randint(state, LOG_CACHE_PREC - LOG_CACHE_REDUCTION + 1);
+        prec2 = prec + 30;
+
+        fmpz_init(x);
+        fmpz_init(xerr);
+        fmpz_init(y);
+        fmpz_init(yerr);
+        fmpz_init(one);
+
+        fmpr_init(ya);
+        fmpr_init(yb);
+        fmpr_init(xa);
+        fmpr_init(xb);
+        fmpr_init(t);
+        fmpr_init(u);
+
+        fmpz_one(one);
+        fmpz_mul_2exp(one, one, prec);
+
+        /* 1 <= x < 2, with x close to 1 half of the time */
+        if (n_randint(state, 2))
+            fmpz_randm(x, state, one);
+        else
+            fmpz_randtest_unsigned(x, state, 1 + n_randint(state, prec));
+        fmpz_add(x, x, one);
+
+        /* 1 <= x - xerr */
+        fmpz_randtest_unsigned(xerr, state, prec - 2);
+        fmpz_sub(y, x, one);
+        if (fmpz_cmp(xerr, y) > 0)
+            fmpz_set(xerr, y);
+
+        fmpz_randtest(y, state, 1500);
+        fmpz_randtest(yerr, state, 1500);
+
+        elefun_log_fixed_precomp(y, yerr, x, xerr, prec);
+
+        fmpr_set_fmpz(t, x);
+        fmpr_mul_2exp_si(t, t, -prec);
+        fmpr_set_fmpz(u, xerr);
+        fmpr_mul_2exp_si(u, u, -prec);
+        fmpr_sub(xa, t, u, FMPR_PREC_EXACT, FMPR_RND_FLOOR);
+        fmpr_add(xb, t, u, FMPR_PREC_EXACT, FMPR_RND_CEIL);
+
+        fmpr_set_fmpz(t, y);
+        fmpr_mul_2exp_si(t, t, -prec);
+        fmpr_set_fmpz(u, yerr);
+        fmpr_mul_2exp_si(u, u, -prec);
+        fmpr_sub(ya, t, u, FMPR_PREC_EXACT, FMPR_RND_FLOOR);
+        fmpr_add(yb, t, u, FMPR_PREC_EXACT, FMPR_RND_CEIL);
+
+        fmpr_log(t, xa, prec2, FMPR_RND_FLOOR);
+        fmpr_log(u, xb, prec2, FMPR_RND_CEIL);
+
+        if (!(fmpr_cmp(ya, t) <= 0 && fmpr_cmp(u, yb) <= 0))
+        {
+            printf("FAIL (bounds)\n");
+            printf("prec = %ld\n", prec);
+            printf("xa = "); fmpr_printd(xa, 50); printf("\n");
+            printf("xb = "); fmpr_printd(xb, 50); printf("\n");
+            printf("ya = "); fmpr_printd(ya, 50); printf("\n");
+            printf("yb = "); fmpr_printd(yb, 50); printf("\n");
+            printf("log(xa) = "); fmpr_printd(t, 50); printf("\n");
+            printf("log(xb) = "); fmpr_printd(u, 50); printf("\n");
+            abort();
+        }
+
+        fmpz_clear(x);
+        fmpz_clear(xerr);
+        fmpz_clear(y);
+        fmpz_clear(yerr);
+        fmpz_clear(one);
+
+        fmpr_clear(ya);
+        fmpr_clear(yb);
+        fmpr_clear(xa);
+        fmpr_clear(xb);
+        fmpr_clear(t);
+        fmpr_clear(u);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
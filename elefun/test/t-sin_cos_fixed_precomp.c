@@ -0,0 +1,137 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "elefun.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("sin_cos_fixed_precomp....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100000; iter++)
+    {
+        long prec, prec2;
+
+        fmpz_t s, c, yerr, x, xerr;
+        fmpr_t sa, sb, ca, cb, t, u;
+        mpfr_t vx, vs, vc;
+
+        prec = SIN_COS_CACHE_REDUCTION + n_randint(state, SIN_COS_CACHE_PREC - SIN_COS_CACHE_REDUCTION + 1);
+        prec2 = prec + 30;
+
+        fmpz_init(x);
+        fmpz_init(xerr);
+        fmpz_init(s);
+        fmpz_init(c);
+        fmpz_init(yerr);
+
+        fmpr_init(sa);
+        fmpr_init(sb);
+        fmpr_init(ca);
+        fmpr_init(cb);
+        fmpr_init(t);
+        fmpr_init(u);
+
+        mpfr_init2(vx, prec + 100);
+        mpfr_init2(vs, prec2);
+        mpfr_init2(vc, prec2);
+
+        fmpz_randtest_unsigned(x, state, prec + 20);
+        fmpz_randtest_unsigned(xerr, state, 1 + n_randint(state, 10));
+
+        fmpz_randtest(s, state, 1500);
+        fmpz_randtest(c, state, 1500);
+        fmpz_randtest(yerr, state, 1500);
+
+        elefun_sin_cos_fixed_precomp(s, c, yerr, x, xerr, prec);
+
+        fmpr_set_fmpz(u, yerr);
+        fmpr_mul_2exp_si(u, u, -prec);
+
+        fmpr_set_fmpz(t, s);
+        fmpr_mul_2exp_si(t, t, -prec);
+        fmpr_sub(sa, t, u, FMPR_PREC_EXACT, FMPR_RND_FLOOR);
+        fmpr_add(sb, t, u, FMPR_PREC_EXACT, FMPR_RND_CEIL);
+
+        fmpr_set_fmpz(t, c);
+        fmpr_mul_2exp_si(t, t, -prec);
+        fmpr_sub(ca, t, u, FMPR_PREC_EXACT, FMPR_RND_FLOOR);
+        fmpr_add(cb, t, u, FMPR_PREC_EXACT, FMPR_RND_CEIL);
+
+        /* the midpoint x is exact */
+        fmpr_set_fmpz(t, x);
+        fmpr_mul_2exp_si(t, t, -prec);
+        fmpr_get_mpfr(vx, t, MPFR_RNDN);
+        mpfr_sin_cos(vs, vc, vx, MPFR_RNDN);
+
+        fmpr_set_mpfr(t, vs);
+        fmpr_set_mpfr(u, vc);
+
+        if (!(fmpr_cmp(sa, t) < 0 && fmpr_cmp(t, sb) < 0 &&
+              fmpr_cmp(ca, u) < 0 && fmpr_cmp(u, cb) < 0))
+        {
+            printf("FAIL (bounds)\n");
+            printf("prec = %ld\n", prec);
+            printf("x = "); fmpz_print(x); printf("\n");
+            printf("sa = "); fmpr_printd(sa, 50); printf("\n");
+            printf("sb = "); fmpr_printd(sb, 50); printf("\n");
+            printf("ca = "); fmpr_printd(ca, 50); printf("\n");
+            printf("cb = "); fmpr_printd(cb, 50); printf("\n");
+            printf("sin(x) = "); fmpr_printd(t, 50); printf("\n");
+            printf("cos(x) = "); fmpr_printd(u, 50); printf("\n");
+            abort();
+        }
+
+        fmpz_clear(x);
+        fmpz_clear(xerr);
+        fmpz_clear(s);
+        fmpz_clear(c);
+        fmpz_clear(yerr);
+
+        fmpr_clear(sa);
+        fmpr_clear(sb);
+        fmpr_clear(ca);
+        fmpr_clear(cb);
+        fmpr_clear(t);
+        fmpr_clear(u);
+
+        mpfr_clear(vx);
+        mpfr_clear(vs);
+        mpfr_clear(vc);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
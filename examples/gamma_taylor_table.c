@@ -0,0 +1,126 @@
+/* This file is public domain. Author: Fredrik Johansson. */
+
+#include <string.h>
+#include "gamma.h"
+
+#define CHUNK 256
+
+/*
+  Writes gamma/taylor_table.h, the table of Taylor coefficients of
+  1/gamma(1+x) that is loaded by gamma_taylor_precompute when the library
+  is compiled with GAMMA_TAYLOR_STATIC_TABLE defined. Each coefficient is
+  rounded to the nearest multiple of 2^(-abs_prec), and the table is valid
+  with radius 2^(-abs_prec). The checked-in table is regenerated with
+
+      build/examples/gamma_taylor_table 4096 680 4200 > gamma/taylor_table.h
+*/
+
+int main(int argc, char *argv[])
+{
+    fmpr_ptr t;
+    fmpr_t err, rad;
+    fmprb_srcptr c;
+    char * s, * d;
+    long * chunks;
+    long i, j, num, prec, abs_prec, bits, len, first;
+
+    if (argc < 4)
+    {
+        printf("usage: build/examples/gamma_taylor_table prec num abs_prec\n");
+        return 1;
+    }
+
+    prec = atol(argv[1]);
+    num = atol(argv[2]);
+    abs_prec = atol(argv[3]);
+
+    if (num < gamma_taylor_coeffs_for_prec(prec) || abs_prec < prec * 1.01 + 32)
+    {
+        printf("num or abs_prec too small for prec = %ld\n", prec);
+        return 1;
+    }
+
+    gamma_taylor_precompute(num, abs_prec + 64);
+    c = gamma_taylor_coeffs;
+
+    t = _fmpr_vec_init(num);
+    chunks = flint_malloc(sizeof(long) * num);
+    fmpr_init(err);
+    fmpr_init(rad);
+
+    for (i = 0; i < num; i++)
+    {
+        /* round to the nearest multiple of 2^(-abs_prec) */
+        bits = fmpr_abs_bound_lt_2exp_si(fmprb_midref(c + i)) + abs_prec;
+
+        if (!fmpr_is_zero(fmprb_midref(c + i)) && bits > 0)
+            fmpr_set_round(t + i, fmprb_midref(c + i), bits, FMPR_RND_NEAR);
+
+        /* the rounding error plus the radius must fit the table radius */
+        fmpr_sub(err, t + i, fmprb_midref(c + i), FMPR_PREC_EXACT, FMPR_RND_DOWN);
+        fmpr_abs(err, err);
+        fmprb_get_rad_fmpr(rad, c + i);
+        fmpr_add(err, err, rad, FMPRB_RAD_PREC, FMPR_RND_UP);
+
+        if (fmpr_cmp_2exp_si(err, -abs_prec) > 0)
+        {
+            printf("coefficient %ld is not accurate enough\n", i);
+            abort();
+        }
+    }
+
+    printf("/* do not edit; regenerate with\n");
+    printf("   build/examples/gamma_taylor_table %ld %ld %ld > gamma/taylor_table.h */\n\n",
+        prec, num, abs_prec);
+    printf("/* coefficients of 1/gamma(1+x), rounded to the nearest multiple of\n");
+    printf("   2^(-%ld), with radius 2^(-%ld); the mantissa of coefficient i is\n",
+        abs_prec, abs_prec);
+    printf("   made of the next |gamma_taylor_table_chunks[i]| hexadecimal chunks of\n");
+    printf("   gamma_taylor_table_man, most significant first, and is negative if\n");
+    printf("   gamma_taylor_table_chunks[i] < 0 */\n\n");
+    printf("#define GAMMA_TAYLOR_TABLE_NUM %ld\n", num);
+    printf("#define GAMMA_TAYLOR_TABLE_PREC %ld\n", prec);
+    printf("#define GAMMA_TAYLOR_TABLE_ABS_PREC %ld\n\n", abs_prec);
+
+    /* ISO C90 only guarantees string literals of 509 characters, so the
+       mantissas are split into chunks of at most CHUNK digits */
+    printf("static const char * const gamma_taylor_table_man[] = {\n");
+    for (i = 0; i < num; i++)
+    {
+        s = fmpz_get_str(NULL, 16, fmpr_manref(t + i));
+        d = s + (s[0] == '-');
+        len = strlen(d);
+        first = (len % CHUNK == 0) ? CHUNK : len % CHUNK;
+        chunks[i] = 1 + (len - first) / CHUNK;
+
+        printf("    \"%.*s\",\n", (int) first, d);
+        for (j = first; j < len; j += CHUNK)
+            printf("    \"%.*s\",\n", (int) CHUNK, d + j);
+
+        if (s[0] == '-')
+            chunks[i] = -chunks[i];
+
+        flint_free(s);
+    }
+    printf("};\n\n");
+
+    printf("static const int gamma_taylor_table_chunks[] = {\n");
+    for (i = 0; i < num; i++)
+        printf("%s%ld,%s", (i % 16 == 0) ? "    " : " ", chunks[i],
+            (i % 16 == 15 || i == num - 1) ? "\n" : "");
+    printf("};\n\n");
+
+    printf("static const long gamma_taylor_table_exp[] = {\n");
+    for (i = 0; i < num; i++)
+        printf("%s%ldL,%s", (i % 8 == 0) ? "    " : " ",
+            fmpz_get_si(fmpr_expref(t + i)),
+            (i % 8 == 7 || i == num - 1) ? "\n" : "");
+    printf("};\n");
+
+    flint_free(chunks);
+    _fmpr_vec_clear(t, num);
+    fmpr_clear(err);
+    fmpr_clear(rad);
+    flint_cleanup();
+    return 0;
+}
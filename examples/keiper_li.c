@@ -115,18 +115,22 @@ int main(int argc, char *argv[])
     if (out_file != NULL)
     {
         FILE * fp = fopen(out_file, "w");
+        fmpr_t r;
+        fmpr_init(r);
         for (i = 0; i < len; i++)
         {
+            fmprb_get_rad_fmpr(r, z + i);
             fprintf(fp, "%ld ", i);
             fmpz_fprint(fp, fmpr_manref(fmprb_midref(z + i)));
             fprintf(fp, " ");
             fmpz_fprint(fp, fmpr_expref(fmprb_midref(z + i)));
             fprintf(fp, " ");
-            fmpz_fprint(fp, fmpr_manref(fmprb_radref(z + i)));
+            fmpz_fprint(fp, fmpr_manref(r));
             fprintf(fp, " ");
-            fmpz_fprint(fp, fmpr_expref(fmprb_radref(z + i)));
+            fmpz_fprint(fp, fmpr_expref(r));
             fprintf(fp, "\n");
         }
+        fmpr_clear(r);
         fclose(fp);
     }
 
@@ -48,8 +48,8 @@ int check_accuracy(fmpcb_ptr vec, long len, long prec)
 
     for (i = 0; i < len; i++)
     {
-        if (fmpr_cmp_2exp_si(fmprb_radref(fmpcb_realref(vec + i)), -prec) >= 0
-         || fmpr_cmp_2exp_si(fmprb_radref(fmpcb_imagref(vec + i)), -prec) >= 0)
+        if (mag_cmp_2exp_si(fmprb_radref(fmpcb_realref(vec + i)), -prec) >= 0
+         || mag_cmp_2exp_si(fmprb_radref(fmpcb_imagref(vec + i)), -prec) >= 0)
             return 0;
     }
 
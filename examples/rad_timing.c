@@ -0,0 +1,78 @@
+/* This file is public domain. Author: Fredrik Johansson. */
+
+#include "fmprb_poly.h"
+#include "fmprb_mat.h"
+#include "profiler.h"
+
+/*
+  Times the operations whose cost is dominated by the radius arithmetic
+  in fmprb_add, fmprb_mul and fmprb_addmul (classical polynomial and
+  matrix multiplication of precise balls) at a small precision.
+*/
+
+int main(int argc, char *argv[])
+{
+    fmprb_poly_t a, b, c;
+    fmprb_mat_t A, B, C;
+    flint_rand_t state;
+    long i, j, n, prec;
+
+    if (argc < 3)
+    {
+        printf("usage: build/examples/rad_timing n prec\n");
+        return 1;
+    }
+
+    n = atol(argv[1]);
+    prec = atol(argv[2]);
+
+    flint_randinit(state);
+
+    fmprb_poly_init(a);
+    fmprb_poly_init(b);
+    fmprb_poly_init(c);
+    fmprb_mat_init(A, n, n);
+    fmprb_mat_init(B, n, n);
+    fmprb_mat_init(C, n, n);
+
+    fmprb_poly_fit_length(a, n);
+    fmprb_poly_fit_length(b, n);
+    for (i = 0; i < n; i++)
+    {
+        fmprb_randtest_precise(a->coeffs + i, state, prec, 4);
+        fmprb_randtest_precise(b->coeffs + i, state, prec, 4);
+    }
+    _fmprb_poly_set_length(a, n);
+    _fmprb_poly_set_length(b, n);
+    _fmprb_poly_normalise(a);
+    _fmprb_poly_normalise(b);
+
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            fmprb_randtest_precise(fmprb_mat_entry(A, i, j), state, prec, 4);
+            fmprb_randtest_precise(fmprb_mat_entry(B, i, j), state, prec, 4);
+        }
+    }
+
+    printf("fmprb_poly_mullow_classical, n = %ld, prec = %ld: ", n, prec);
+    TIMEIT_START
+    fmprb_poly_mullow_classical(c, a, b, n, prec);
+    TIMEIT_STOP
+
+    printf("fmprb_mat_mul_classical, n = %ld, prec = %ld: ", n, prec);
+    TIMEIT_START
+    fmprb_mat_mul_classical(C, A, B, prec);
+    TIMEIT_STOP
+
+    fmprb_poly_clear(a);
+    fmprb_poly_clear(b);
+    fmprb_poly_clear(c);
+    fmprb_mat_clear(A);
+    fmprb_mat_clear(B);
+    fmprb_mat_clear(C);
+    flint_randclear(state);
+    flint_cleanup();
+    return 0;
+}
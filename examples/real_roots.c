@@ -185,9 +185,7 @@ int main(int argc, char *argv[])
     fmpr_set_d(fa, a);
     fmpr_set_d(fb, b);
 
-    fmpr_add(fmprb_midref(t), fb, fa, FMPR_PREC_EXACT, FMPR_RND_DOWN);
-    fmpr_sub(fmprb_radref(t), fb, fa, FMPR_PREC_EXACT, FMPR_RND_DOWN);
-    fmprb_mul_2exp_si(t, t, -1);
+    fmprb_set_interval_fmpr(t, fa, fb, FMPR_PREC_EXACT);
 
     printf("interval: "); fmprb_printd(t, 15); printf("\n");
     printf("maxdepth = %ld, maxeval = %ld, maxfound = %ld, low_prec = %ld\n",
@@ -317,10 +317,12 @@ fmpcb_get_rad_ubound_fmpr(fmpr_t u, const fmpcb_t z, long prec)
 {
     /* fixme: this bound is very sloppy */
 
-    if (fmpr_cmp(fmprb_radref(fmpcb_realref(z)), fmprb_radref(fmpcb_imagref(z))) >= 0)
-        fmpr_mul_2exp_si(u, fmprb_radref(fmpcb_realref(z)), 1);
+    if (mag_cmp(fmprb_radref(fmpcb_realref(z)), fmprb_radref(fmpcb_imagref(z))) >= 0)
+        fmprb_get_rad_fmpr(u, fmpcb_realref(z));
     else
-        fmpr_mul_2exp_si(u, fmprb_radref(fmpcb_imagref(z)), 1);
+        fmprb_get_rad_fmpr(u, fmpcb_imagref(z));
+
+    fmpr_mul_2exp_si(u, u, 1);
 }
 
 void fmpcb_arg(fmprb_t r, const fmpcb_t z, long prec);
@@ -594,6 +596,7 @@ void fmpcb_tan(fmpcb_t r, const fmpcb_t z, long prec);
 void fmpcb_cot(fmpcb_t r, const fmpcb_t z, long prec);
 
 void fmpcb_sin_pi(fmpcb_t r, const fmpcb_t z, long prec);
+void fmpcb_log_sin_pi(fmpcb_t res, const fmpcb_t z, long prec);
 void fmpcb_cos_pi(fmpcb_t r, const fmpcb_t z, long prec);
 void fmpcb_sin_cos_pi(fmpcb_t s, fmpcb_t c, const fmpcb_t z, long prec);
 
@@ -614,8 +617,10 @@ void fmpcb_root(fmpcb_t r, const fmpcb_t a, long m, long index, long prec);
 void fmpcb_gamma(fmpcb_t y, const fmpcb_t x, long prec);
 void fmpcb_rgamma(fmpcb_t y, const fmpcb_t x, long prec);
 void fmpcb_lgamma(fmpcb_t y, const fmpcb_t x, long prec);
+void fmpcb_lgamma_vec(fmpcb_ptr y, fmpcb_srcptr x, long num, long prec);
 
 void fmpcb_digamma(fmpcb_t y, const fmpcb_t x, long prec);
+void fmpcb_polygamma(fmpcb_t y, ulong m, const fmpcb_t x, long prec);
 
 void fmpcb_rising_ui(fmpcb_t y, const fmpcb_t x, ulong n, long prec);
 
@@ -850,6 +855,9 @@ _fmpcb_vec_trim(fmpcb_ptr res, fmpcb_srcptr vec, long len)
         fmpcb_trim(res + i, vec + i);
 }
 
+void _fmpcb_vec_dot(fmpcb_t res, const fmpcb_t initial, int subtract,
+    fmpcb_srcptr x, long xstep, fmpcb_srcptr y, long ystep, long len, long prec);
+
 
 #ifdef __cplusplus
 }
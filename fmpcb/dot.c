@@ -0,0 +1,67 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmpcb.h"
+
+void
+_fmpcb_vec_dot(fmpcb_t res, const fmpcb_t initial, int subtract,
+    fmpcb_srcptr x, long xstep, fmpcb_srcptr y, long ystep, long len, long prec)
+{
+    fmprb_srcptr xr, xi, yr, yi;
+    fmprb_t re, im;
+
+    if (len <= 0)
+    {
+        if (initial == NULL)
+            fmpcb_zero(res);
+        else
+            fmpcb_set_round(res, initial, prec);
+        return;
+    }
+
+    /* the real and imaginary parts are interleaved */
+    xr = fmpcb_realref(x);
+    xi = fmpcb_imagref(x);
+    yr = fmpcb_realref(y);
+    yi = fmpcb_imagref(y);
+
+    fmprb_init(re);
+    fmprb_init(im);
+
+    _fmprb_vec_dot2(re, initial == NULL ? NULL : fmpcb_realref(initial),
+        subtract, xr, 2 * xstep, yr, 2 * ystep, len,
+        xi, 2 * xstep, yi, 2 * ystep, 1, len, prec);
+
+    _fmprb_vec_dot2(im, initial == NULL ? NULL : fmpcb_imagref(initial),
+        subtract, xr, 2 * xstep, yi, 2 * ystep, len,
+        xi, 2 * xstep, yr, 2 * ystep, 0, len, prec);
+
+    fmprb_swap(fmpcb_realref(res), re);
+    fmprb_swap(fmpcb_imagref(res), im);
+
+    fmprb_clear(re);
+    fmprb_clear(im);
+}
+
@@ -79,8 +79,8 @@ fmpcb_invroot_newton(fmpcb_t r, const fmpcb_t a, ulong m,
 
         /* z[n+1] = z[n] * (m + 1 - a * z[n]^m) / m */
         fmpcb_set(z_exact, z);
-        fmpr_zero(fmprb_radref(fmpcb_realref(z_exact)));
-        fmpr_zero(fmprb_radref(fmpcb_imagref(z_exact)));
+        mag_zero(fmprb_radref(fmpcb_realref(z_exact)));
+        mag_zero(fmprb_radref(fmpcb_imagref(z_exact)));
 
         fmpcb_pow_ui(t, z_exact, m, wp);
         fmpcb_mul(t, t, a, wp);
@@ -98,27 +98,50 @@ fmpcb_lgamma(fmpcb_t y, const fmpcb_t x, long prec)
 {
     int reflect;
     long r, n, wp;
-    fmpcb_t t, u;
+    fmpcb_t t, u, v;
 
     wp = prec + FLINT_BIT_COUNT(prec);
 
-    gamma_stirling_choose_param_fmpcb(&reflect, &r, &n, x, 0, 0, wp);
+    /* the reflection formula is only valid for the principal branch
+       if x is known to lie off the real axis */
+    gamma_stirling_choose_param_fmpcb(&reflect, &r, &n, x,
+        !fmprb_contains_zero(fmpcb_imagref(x)), 0, wp);
 
-    /* log(gamma(x)) = log(gamma(x+r)) - log(rf(x,r)) */
     fmpcb_init(t);
     fmpcb_init(u);
+    fmpcb_init(v);
 
-    fmpcb_add_ui(t, x, r, wp);
-    gamma_stirling_eval_fmpcb(u, t, n, 0, wp);
+    if (reflect)
+    {
+        /* log(gamma(x)) = log(pi) - log(sin(pi x)) - log(gamma(1-x)),
+           log(gamma(1-x)) = log(gamma(1-x+r)) - log(rf(1-x,r)) */
+        fmpcb_sub_ui(u, x, 1, wp);
+        fmpcb_neg(u, u);
 
-    gamma_rising_fmpcb_ui_bsplit(t, x, r, prec);
-    fmpcb_log(t, t, prec);
+        fmpcb_add_ui(t, u, r, wp);
+        gamma_stirling_eval_fmpcb(v, t, n, 0, wp);
+        gamma_log_rising_fmpcb_ui(t, u, r, wp);
+        fmpcb_sub(v, v, t, wp);
 
-    _fmpcb_log_rising_correct_branch(t, t, x, r, wp);
+        fmpcb_log_sin_pi(t, x, wp);
+        fmpcb_add(v, v, t, wp);
 
-    fmpcb_sub(y, u, t, prec);
+        fmprb_const_pi(fmpcb_realref(t), wp);
+        fmprb_log(fmpcb_realref(t), fmpcb_realref(t), wp);
+        fmprb_zero(fmpcb_imagref(t));
+
+        fmpcb_sub(y, t, v, prec);
+    }
+    else
+    {
+        /* log(gamma(x)) = log(gamma(x+r)) - log(rf(x,r)) */
+        fmpcb_add_ui(t, x, r, wp);
+        gamma_stirling_eval_fmpcb(u, t, n, 0, wp);
+        gamma_log_rising_fmpcb_ui(t, x, r, wp);
+        fmpcb_sub(y, u, t, prec);
+    }
 
     fmpcb_clear(t);
     fmpcb_clear(u);
+    fmpcb_clear(v);
 }
-
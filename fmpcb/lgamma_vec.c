@@ -0,0 +1,144 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmpcb.h"
+#include "gamma.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+    fmpcb_ptr y;
+    fmpcb_srcptr x;
+    fmpcb_srcptr s;
+    const long * index;
+    long r;
+    long wp;
+    long prec;
+}
+lgamma_vec_arg_t;
+
+static void
+_fmpcb_lgamma_vec_special(void * arg_ptr, long j)
+{
+    const lgamma_vec_arg_t * arg = (const lgamma_vec_arg_t *) arg_ptr;
+    long i = arg->index[j];
+
+    fmpcb_lgamma(arg->y + i, arg->x + i, arg->prec);
+}
+
+/* log(gamma(x)) = log(gamma(x+r)) - log(rf(x,r)), given the
+   Stirling series s = log(gamma(x+r)) */
+static void
+_fmpcb_lgamma_vec_worker(void * arg_ptr, long j)
+{
+    const lgamma_vec_arg_t * arg = (const lgamma_vec_arg_t *) arg_ptr;
+    fmpcb_t t;
+    long i;
+
+    i = arg->index[j];
+
+    fmpcb_init(t);
+
+    gamma_log_rising_fmpcb_ui(t, arg->x + i, arg->r, arg->wp);
+    fmpcb_sub(arg->y + i, arg->s + j, t, arg->prec);
+
+    fmpcb_clear(t);
+}
+
+void
+fmpcb_lgamma_vec(fmpcb_ptr y, fmpcb_srcptr x, long num, long prec)
+{
+    lgamma_vec_arg_t arg;
+    fmpcb_ptr z, s;
+    long * index;
+    long i, j, num_special, num_generic, r, n, rj, nj, wp, num_threads;
+    int reflect;
+
+    if (num < 1)
+        return;
+
+    num_threads = flint_get_num_threads();
+    wp = prec + FLINT_BIT_COUNT(prec);
+
+    index = flint_malloc(sizeof(long) * num);
+
+    arg.y = y;
+    arg.x = x;
+    arg.wp = wp;
+    arg.prec = prec;
+
+    /* the non-finite points and the points where fmpcb_lgamma uses
+       the reflection formula are kept at the end of index; one (r, n)
+       is used for all other points: the largest needed by any point */
+    num_special = num_generic = 0;
+    r = n = 0;
+
+    for (i = 0; i < num; i++)
+    {
+        reflect = 0;
+
+        if (fmprb_is_finite(fmpcb_realref(x + i)) &&
+            fmprb_is_finite(fmpcb_imagref(x + i)))
+        {
+            gamma_stirling_choose_param_fmpcb(&reflect, &rj, &nj, x + i,
+                !fmprb_contains_zero(fmpcb_imagref(x + i)), 0, wp);
+        }
+
+        if (reflect || !fmprb_is_finite(fmpcb_realref(x + i)) ||
+            !fmprb_is_finite(fmpcb_imagref(x + i)))
+        {
+            index[num - 1 - num_special++] = i;
+        }
+        else
+        {
+            r = FLINT_MAX(r, rj);
+            n = FLINT_MAX(n, nj);
+            index[num_generic++] = i;
+        }
+    }
+
+    z = _fmpcb_vec_init(num_generic);
+    s = _fmpcb_vec_init(num_generic);
+
+    for (j = 0; j < num_generic; j++)
+        fmpcb_add_ui(z + j, x + index[j], r, wp);
+
+    gamma_stirling_eval_fmpcb_vec(s, z, num_generic, n, 0, wp);
+
+    arg.index = index;
+    arg.s = s;
+    arg.r = r;
+
+    thread_pool_parallel_for(_fmpcb_lgamma_vec_worker, &arg,
+        num_generic, num_threads);
+
+    arg.index = index + num_generic;
+    thread_pool_parallel_for(_fmpcb_lgamma_vec_special, &arg,
+        num_special, num_threads);
+
+    _fmpcb_vec_clear(z, num_generic);
+    _fmpcb_vec_clear(s, num_generic);
+    flint_free(index);
+}
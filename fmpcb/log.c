@@ -43,7 +43,7 @@ fmpcb_log(fmpcb_t r, const fmpcb_t z, long prec)
     if (fmprb_contains_zero(t) || fmpr_sgn(fmprb_midref(t)) < 0)
     {
         fmpr_zero(fmprb_midref(t));
-        fmpr_pos_inf(fmprb_radref(t));
+        mag_inf(fmprb_radref(t));
     }
     else
     {
@@ -0,0 +1,96 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmpcb.h"
+
+/* log(sin(pi z)) for Im(z) > 0, using
+   sin(pi z) = (i/2) exp(-pi i z) (1 - exp(2 pi i z)) */
+static void
+_fmpcb_log_sin_pi_upper(fmpcb_t res, const fmpcb_t z, long prec)
+{
+    fmpcb_t q;
+    fmprb_t m, t;
+
+    fmpcb_init(q);
+    fmprb_init(m);
+    fmprb_init(t);
+
+    /* q = exp(2 pi i z) = exp(-2 pi b) (cos(2 pi a) + i sin(2 pi a)) */
+    fmprb_mul_2exp_si(t, fmpcb_realref(z), 1);
+    fmprb_sin_cos_pi(fmpcb_imagref(q), fmpcb_realref(q), t, prec);
+    fmprb_const_pi(m, prec);
+    fmprb_mul(m, m, fmpcb_imagref(z), prec);
+    fmprb_mul_2exp_si(m, m, 1);
+    fmprb_neg(m, m);
+    fmprb_exp(m, m, prec);
+    fmpcb_mul_fmprb(q, q, m, prec);
+
+    /* log(1 - q), where 1 - q lies in the right half-plane */
+    fmpcb_sub_ui(q, q, 1, prec);
+    fmpcb_neg(q, q);
+    fmpcb_log(q, q, prec);
+
+    /* -pi i z + pi i / 2 - log(2) = pi b - log(2) + (1/2 - a) pi i */
+    fmprb_const_pi(m, prec);
+    fmprb_mul(t, m, fmpcb_imagref(z), prec);
+    fmprb_add(fmpcb_realref(q), fmpcb_realref(q), t, prec);
+    fmprb_const_log2(t, prec);
+    fmprb_sub(fmpcb_realref(q), fmpcb_realref(q), t, prec);
+
+    fmprb_one(t);
+    fmprb_mul_2exp_si(t, t, -1);
+    fmprb_sub(t, t, fmpcb_realref(z), prec);
+    fmprb_mul(t, t, m, prec);
+    fmprb_add(fmpcb_imagref(q), fmpcb_imagref(q), t, prec);
+
+    fmpcb_swap(res, q);
+
+    fmpcb_clear(q);
+    fmprb_clear(m);
+    fmprb_clear(t);
+}
+
+void
+fmpcb_log_sin_pi(fmpcb_t res, const fmpcb_t z, long prec)
+{
+    if (fmprb_is_positive(fmpcb_imagref(z)))
+    {
+        _fmpcb_log_sin_pi_upper(res, z, prec);
+    }
+    else if (fmprb_is_negative(fmpcb_imagref(z)))
+    {
+        fmpcb_t t;
+        fmpcb_init(t);
+        fmpcb_conj(t, z);
+        _fmpcb_log_sin_pi_upper(res, t, prec);
+        fmpcb_conj(res, res);
+        fmpcb_clear(t);
+    }
+    else
+    {
+        fmpcb_sin_pi(res, z, prec);
+        fmpcb_log(res, res, prec);
+    }
+}
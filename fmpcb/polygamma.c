@@ -0,0 +1,74 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmpcb.h"
+#include "gamma.h"
+
+void
+fmpcb_polygamma(fmpcb_t y, ulong m, const fmpcb_t x, long prec)
+{
+    long r, n, k, wp;
+    fmpcb_t t, u, v;
+    fmpz_t f;
+
+    if (m == 0)
+    {
+        fmpcb_digamma(y, x, prec);
+        return;
+    }
+
+    wp = prec + FLINT_BIT_COUNT(prec);
+
+    gamma_stirling_choose_param_polygamma_fmpcb(&r, &n, m, x, wp);
+
+    fmpcb_init(t);
+    fmpcb_init(u);
+    fmpcb_init(v);
+    fmpz_init(f);
+
+    /* psi^(m)(x) = psi^(m)(x+r) + (-1)^(m+1) m! sum_{k=0}^{r-1} (x+k)^(-(m+1)),
+       summing the terms directly */
+    for (k = 0; k < r; k++)
+    {
+        fmpcb_add_ui(t, x, k, wp);
+        fmpcb_inv(t, t, wp);
+        fmpcb_pow_ui(t, t, m + 1, wp);
+        fmpcb_add(v, v, t, wp);
+    }
+
+    fmpz_fac_ui(f, m);
+    fmpcb_mul_fmpz(v, v, f, wp);
+    if (m % 2 == 0)
+        fmpcb_neg(v, v);
+
+    fmpcb_add_ui(t, x, r, wp);
+    gamma_stirling_eval_polygamma_fmpcb(u, m, t, n, wp);
+    fmpcb_add(y, u, v, prec);
+
+    fmpcb_clear(t);
+    fmpcb_clear(u);
+    fmpcb_clear(v);
+    fmpz_clear(f);
+}
@@ -135,7 +135,7 @@ void
 fmpcb_pow_fmprb(fmpcb_t z, const fmpcb_t x, const fmprb_t y, long prec)
 {
     const fmpr_struct * ymid = fmprb_midref(y);
-    const fmpr_struct * yrad = fmprb_radref(y);
+    const mag_struct * yrad = fmprb_radref(y);
 
     if (fmprb_is_zero(y))
     {
@@ -143,7 +143,7 @@ fmpcb_pow_fmprb(fmpcb_t z, const fmpcb_t x, const fmprb_t y, long prec)
         return;
     }
 
-    if (fmpr_is_zero(yrad))
+    if (mag_is_zero(yrad))
     {
         /* small half-integer or integer */
         if (fmpr_cmpabs_2exp_si(ymid, BINEXP_LIMIT) < 0 &&
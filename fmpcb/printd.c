@@ -28,6 +28,9 @@
 void
 fmpcb_printd(const fmpcb_t z, long digits)
 {
+    fmpr_t t;
+    fmpr_init(t);
+
     printf("(");
     fmpr_printd(fmprb_midref(fmpcb_realref(z)), digits);
     printf(" + ");
@@ -37,8 +40,12 @@ fmpcb_printd(const fmpcb_t z, long digits)
     printf("  +/-  ");
 
     printf("(");
-    fmpr_printd(fmprb_radref(fmpcb_realref(z)), 3);
+    fmprb_get_rad_fmpr(t, fmpcb_realref(z));
+    fmpr_printd(t, 3);
     printf(", ");
-    fmpr_printd(fmprb_radref(fmpcb_imagref(z)), 3);
+    fmprb_get_rad_fmpr(t, fmpcb_imagref(z));
+    fmpr_printd(t, 3);
     printf("j)");
+
+    fmpr_clear(t);
 }
@@ -0,0 +1,134 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmpcb.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("dot....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100000; iter++)
+    {
+        fmpcb_ptr x, y, ystart;
+        fmpcb_t s, t, u, v, init;
+        long i, len, prec, xstep, ystep;
+        int subtract, use_initial;
+
+        len = n_randint(state, 20);
+        prec = 2 + n_randint(state, 300);
+        subtract = n_randint(state, 2);
+        use_initial = n_randint(state, 2);
+        xstep = 1 + n_randint(state, 2);
+        ystep = n_randint(state, 2) ? 1 : -1;
+
+        x = _fmpcb_vec_init(len * xstep + 1);
+        y = _fmpcb_vec_init(len + 1);
+        ystart = (ystep == 1) ? y : y + len - 1;
+
+        fmpcb_init(s);
+        fmpcb_init(t);
+        fmpcb_init(u);
+        fmpcb_init(v);
+        fmpcb_init(init);
+
+        for (i = 0; i < len; i++)
+        {
+            fmpcb_randtest(x + i * xstep, state, 1 + n_randint(state, 400), 1 + n_randint(state, 10));
+            fmpcb_randtest(y + i, state, 1 + n_randint(state, 400), 1 + n_randint(state, 10));
+        }
+
+        fmpcb_randtest(init, state, 1 + n_randint(state, 400), 1 + n_randint(state, 10));
+
+        if (use_initial && n_randint(state, 2))
+        {
+            /* aliasing of res and initial */
+            fmpcb_set(s, init);
+            _fmpcb_vec_dot(s, s, subtract, x, xstep, ystart, ystep, len, prec);
+        }
+        else
+        {
+            _fmpcb_vec_dot(s, use_initial ? init : NULL, subtract,
+                x, xstep, ystart, ystep, len, prec);
+        }
+
+        /* naive evaluation (t), and exact evaluation at the midpoints (u) */
+        if (use_initial)
+        {
+            fmpcb_set(t, init);
+            fmprb_set_fmpr(fmpcb_realref(u), fmprb_midref(fmpcb_realref(init)));
+            fmprb_set_fmpr(fmpcb_imagref(u), fmprb_midref(fmpcb_imagref(init)));
+        }
+
+        for (i = 0; i < len; i++)
+        {
+            if (subtract)
+                fmpcb_submul(t, x + i * xstep, ystart + i * ystep, prec);
+            else
+                fmpcb_addmul(t, x + i * xstep, ystart + i * ystep, prec);
+
+            fmprb_set_fmpr(fmpcb_realref(v), fmprb_midref(fmpcb_realref(x + i * xstep)));
+            fmprb_set_fmpr(fmpcb_imagref(v), fmprb_midref(fmpcb_imagref(x + i * xstep)));
+            fmpcb_mul(v, v, ystart + i * ystep, FMPR_PREC_EXACT);
+            fmprb_set_fmpr(fmpcb_realref(v), fmprb_midref(fmpcb_realref(v)));
+            fmprb_set_fmpr(fmpcb_imagref(v), fmprb_midref(fmpcb_imagref(v)));
+
+            if (subtract)
+                fmpcb_sub(u, u, v, FMPR_PREC_EXACT);
+            else
+                fmpcb_add(u, u, v, FMPR_PREC_EXACT);
+        }
+
+        if (!fmpcb_overlaps(s, t) || !fmpcb_contains(s, u))
+        {
+            printf("FAIL\n\n");
+            printf("iter = %ld, len = %ld, prec = %ld\n\n", iter, len, prec);
+            printf("s = "); fmpcb_printd(s, 30); printf("\n\n");
+            printf("t = "); fmpcb_printd(t, 30); printf("\n\n");
+            printf("u = "); fmpcb_printd(u, 30); printf("\n\n");
+            abort();
+        }
+
+        _fmpcb_vec_clear(x, len * xstep + 1);
+        _fmpcb_vec_clear(y, len + 1);
+
+        fmpcb_clear(s);
+        fmpcb_clear(t);
+        fmpcb_clear(u);
+        fmpcb_clear(v);
+        fmpcb_clear(init);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
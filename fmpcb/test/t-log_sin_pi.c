@@ -0,0 +1,125 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmpcb.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("log_sin_pi....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000; iter++)
+    {
+        fmpcb_t x, a, b, c;
+        fmprb_t pi;
+        long prec1, prec2;
+
+        prec1 = 2 + n_randint(state, 1000);
+        prec2 = prec1 + 30;
+
+        fmpcb_init(x);
+        fmpcb_init(a);
+        fmpcb_init(b);
+        fmpcb_init(c);
+        fmprb_init(pi);
+
+        fmpcb_randtest(x, state, 1 + n_randint(state, 1000), 2 + n_randint(state, 8));
+
+        fmpcb_log_sin_pi(a, x, prec1);
+        fmpcb_log_sin_pi(b, x, prec2);
+
+        /* check consistency */
+        if (!fmpcb_overlaps(a, b))
+        {
+            printf("FAIL: overlap\n\n");
+            printf("x = "); fmpcb_print(x); printf("\n\n");
+            printf("a = "); fmpcb_print(a); printf("\n\n");
+            printf("b = "); fmpcb_print(b); printf("\n\n");
+            abort();
+        }
+
+        /* compare with sin */
+        fmpcb_exp(b, a, prec1);
+        fmpcb_sin_pi(c, x, prec1);
+
+        if (!fmpcb_overlaps(b, c))
+        {
+            printf("FAIL: exp\n\n");
+            printf("x = "); fmpcb_print(x); printf("\n\n");
+            printf("a = "); fmpcb_print(a); printf("\n\n");
+            printf("b = "); fmpcb_print(b); printf("\n\n");
+            printf("c = "); fmpcb_print(c); printf("\n\n");
+            abort();
+        }
+
+        /* check the branch: log(sin(pi (x+1))) = log(sin(pi x)) -+ pi i */
+        if (!fmprb_contains_zero(fmpcb_imagref(x)))
+        {
+            fmpcb_add_ui(c, x, 1, prec1);
+            fmpcb_log_sin_pi(b, c, prec1);
+
+            fmprb_const_pi(pi, prec1);
+            if (fmprb_is_positive(fmpcb_imagref(x)))
+                fmprb_add(fmpcb_imagref(b), fmpcb_imagref(b), pi, prec1);
+            else
+                fmprb_sub(fmpcb_imagref(b), fmpcb_imagref(b), pi, prec1);
+
+            if (!fmpcb_overlaps(a, b))
+            {
+                printf("FAIL: branch\n\n");
+                printf("x = "); fmpcb_print(x); printf("\n\n");
+                printf("a = "); fmpcb_print(a); printf("\n\n");
+                printf("b = "); fmpcb_print(b); printf("\n\n");
+                abort();
+            }
+        }
+
+        fmpcb_log_sin_pi(x, x, prec1);
+
+        if (!fmpcb_overlaps(a, x))
+        {
+            printf("FAIL: aliasing\n\n");
+            printf("a = "); fmpcb_print(a); printf("\n\n");
+            printf("x = "); fmpcb_print(x); printf("\n\n");
+            abort();
+        }
+
+        fmpcb_clear(x);
+        fmpcb_clear(a);
+        fmpcb_clear(b);
+        fmpcb_clear(c);
+        fmprb_clear(pi);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
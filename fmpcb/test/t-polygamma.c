@@ -0,0 +1,176 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmpcb.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("polygamma....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000; iter++)
+    {
+        fmpcb_t a, b, c;
+        fmpz_t f;
+        ulong m;
+        long prec1, prec2;
+
+        prec1 = 2 + n_randint(state, 500);
+        prec2 = prec1 + 30;
+
+        if (n_randint(state, 10) == 0)
+            m = n_randint(state, 50);
+        else
+            m = n_randint(state, 6);
+
+        fmpcb_init(a);
+        fmpcb_init(b);
+        fmpcb_init(c);
+        fmpz_init(f);
+
+        fmprb_randtest_precise(fmpcb_realref(a), state, 1 + n_randint(state, 1000), 4);
+        fmprb_randtest_precise(fmpcb_imagref(a), state, 1 + n_randint(state, 1000), 4);
+
+        fmpcb_polygamma(b, m, a, prec1);
+        fmpcb_polygamma(c, m, a, prec2);
+
+        if (!fmpcb_overlaps(b, c))
+        {
+            printf("FAIL: overlap\n\n");
+            printf("m = %lu\n\n", m);
+            printf("a = "); fmpcb_print(a); printf("\n\n");
+            printf("b = "); fmpcb_print(b); printf("\n\n");
+            printf("c = "); fmpcb_print(c); printf("\n\n");
+            abort();
+        }
+
+        fmpcb_set(c, a);
+        fmpcb_polygamma(c, m, c, prec2);
+        if (!fmpcb_overlaps(b, c))
+        {
+            printf("FAIL: aliasing\n\n");
+            printf("m = %lu\n\n", m);
+            printf("a = "); fmpcb_print(a); printf("\n\n");
+            printf("b = "); fmpcb_print(b); printf("\n\n");
+            printf("c = "); fmpcb_print(c); printf("\n\n");
+            abort();
+        }
+
+        /* check psi^(m)(z+1) = psi^(m)(z) + (-1)^m m! / z^(m+1) */
+        fmpcb_inv(c, a, prec1);
+        fmpcb_pow_ui(c, c, m + 1, prec1);
+        fmpz_fac_ui(f, m);
+        fmpcb_mul_fmpz(c, c, f, prec1);
+        if (m % 2 == 1)
+            fmpcb_neg(c, c);
+        fmpcb_add(b, b, c, prec1);
+        fmpcb_add_ui(c, a, 1, prec1);
+        fmpcb_polygamma(c, m, c, prec1);
+
+        if (!fmpcb_overlaps(b, c))
+        {
+            printf("FAIL: functional equation\n\n");
+            printf("m = %lu\n\n", m);
+            printf("a = "); fmpcb_print(a); printf("\n\n");
+            printf("b = "); fmpcb_print(b); printf("\n\n");
+            printf("c = "); fmpcb_print(c); printf("\n\n");
+            abort();
+        }
+
+        fmpcb_clear(a);
+        fmpcb_clear(b);
+        fmpcb_clear(c);
+        fmpz_clear(f);
+    }
+
+    /* high derivatives near the imaginary axis */
+    for (iter = 0; iter < 200; iter++)
+    {
+        fmpcb_t a, b, c;
+        ulong m;
+        long prec1, prec2, acc;
+
+        prec1 = 2 + n_randint(state, 300);
+
+        fmpcb_init(a);
+        fmpcb_init(b);
+        fmpcb_init(c);
+
+        if (iter == 0)
+        {
+            m = 15;
+            prec1 = 53;
+            fmpcb_set_ui(a, 1);
+            fmprb_set_ui(fmpcb_imagref(a), 40);
+        }
+        else if (iter == 1)
+        {
+            m = 20;
+            prec1 = 53;
+            fmpcb_set_ui(a, 3);
+            fmprb_set_ui(fmpcb_imagref(a), 100);
+        }
+        else
+        {
+            m = 15 + n_randint(state, 30);
+            fmprb_set_si(fmpcb_realref(a), n_randint(state, 20) - 10);
+            fmprb_set_ui(fmpcb_imagref(a), 10 + n_randint(state, 1000));
+            if (n_randint(state, 2))
+                fmprb_neg(fmpcb_imagref(a), fmpcb_imagref(a));
+        }
+
+        prec2 = prec1 + 30;
+
+        fmpcb_polygamma(b, m, a, prec1);
+        fmpcb_polygamma(c, m, a, prec2);
+
+        acc = FLINT_MAX(fmprb_rel_accuracy_bits(fmpcb_realref(b)),
+                        fmprb_rel_accuracy_bits(fmpcb_imagref(b)));
+
+        if (!fmpcb_overlaps(b, c) || acc < prec1 / 2 - 10)
+        {
+            printf("FAIL: large imaginary part\n\n");
+            printf("m = %lu, prec1 = %ld, acc = %ld\n\n", m, prec1, acc);
+            printf("a = "); fmpcb_print(a); printf("\n\n");
+            printf("b = "); fmpcb_print(b); printf("\n\n");
+            printf("c = "); fmpcb_print(c); printf("\n\n");
+            abort();
+        }
+
+        fmpcb_clear(a);
+        fmpcb_clear(b);
+        fmpcb_clear(c);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
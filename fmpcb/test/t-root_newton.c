@@ -51,8 +51,8 @@ int main()
         index = z_randtest(state);
 
         fmpcb_randtest(a, state, 1 + n_randint(state, 2000), 3);
-        fmpr_zero(fmprb_radref(fmpcb_realref(a)));
-        fmpr_zero(fmprb_radref(fmpcb_imagref(a)));
+        mag_zero(fmprb_radref(fmpcb_realref(a)));
+        mag_zero(fmprb_radref(fmpcb_imagref(a)));
 
         fmpcb_randtest(b, state, 1 + n_randint(state, 2000), 3);
 
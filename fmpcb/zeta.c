@@ -25,6 +25,7 @@
 
 #include "fmpcb.h"
 #include "zeta.h"
+#include "fmprb_poly.h"
 
 void
 fmpcb_hurwitz_zeta(fmpcb_t z, const fmpcb_t s, const fmpcb_t a, long prec)
@@ -32,10 +33,59 @@ fmpcb_hurwitz_zeta(fmpcb_t z, const fmpcb_t s, const fmpcb_t a, long prec)
     zeta_series(z, s, a, 0, 1, prec);
 }
 
+/* zeta(1/2 + ti) = exp(-i theta(t)) Z(t) using the Riemann-Siegel
+   formula, if s is exactly on the critical line and |t| is large enough */
+static int
+_fmpcb_zeta_critical_line_rs(fmpcb_t z, const fmpcb_t s, long prec)
+{
+    fmprb_t t, u, c, d;
+    long wp;
+    int success, negative;
+
+    if (!fmprb_is_exact(fmpcb_realref(s)) ||
+        fmpr_cmp_2exp_si(fmprb_midref(fmpcb_realref(s)), -1) != 0)
+        return 0;
+
+    fmprb_init(t);
+    fmprb_init(u);
+    fmprb_init(c);
+    fmprb_init(d);
+
+    negative = fmpr_sgn(fmprb_midref(fmpcb_imagref(s))) < 0;
+    fmprb_abs(t, fmpcb_imagref(s));
+
+    success = _fmprb_poly_riemann_siegel_z_rs(u, t, prec + 4);
+
+    if (success)
+    {
+        wp = prec + 4 + FLINT_MAX(0, fmpr_abs_bound_lt_2exp_si(fmprb_midref(t)));
+
+        _fmprb_poly_riemann_siegel_theta_series(c, t, 1, 1, wp);
+        fmprb_sin_cos(d, c, c, wp);
+
+        if (!negative)
+            fmprb_neg(d, d);
+
+        fmprb_mul(fmpcb_realref(z), c, u, prec);
+        fmprb_mul(fmpcb_imagref(z), d, u, prec);
+    }
+
+    fmprb_clear(t);
+    fmprb_clear(u);
+    fmprb_clear(c);
+    fmprb_clear(d);
+
+    return success;
+}
+
 void
 fmpcb_zeta(fmpcb_t z, const fmpcb_t s, long prec)
 {
     fmpcb_t a;
+
+    if (_fmpcb_zeta_critical_line_rs(z, s, prec))
+        return;
+
     fmpcb_init(a);
     fmpcb_one(a);
 
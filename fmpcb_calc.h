@@ -38,12 +38,19 @@ extern "C" {
 typedef int (*fmpcb_calc_func_t)(fmpcb_ptr out,
     const fmpcb_t inp, void * param, long order, long prec);
 
+typedef int (*fmpcb_calc_vec_func_t)(fmpcb_ptr out,
+    fmpcb_srcptr inp, long num, void * param, long order, long prec);
+
 /* Bounds */
 
 void fmpcb_calc_cauchy_bound(fmprb_t bound, fmpcb_calc_func_t func,
     void * param, const fmpcb_t x, const fmprb_t radius,
     long maxdepth, long prec);
 
+void fmpcb_calc_cauchy_bound_vec(fmprb_t bound, fmpcb_calc_vec_func_t func,
+    void * param, const fmpcb_t x, const fmprb_t radius,
+    long maxdepth, long prec);
+
 /* Integration */
 
 int fmpcb_calc_integrate_taylor(fmpcb_t res,
@@ -53,6 +60,13 @@ int fmpcb_calc_integrate_taylor(fmpcb_t res,
     const fmpr_t outer_radius,
     long accuracy_goal, long prec);
 
+int fmpcb_calc_integrate_taylor_vec(fmpcb_t res,
+    fmpcb_calc_vec_func_t func, void * param,
+    const fmpcb_t a, const fmpcb_t b,
+    const fmpr_t inner_radius,
+    const fmpr_t outer_radius,
+    long accuracy_goal, long prec);
+
 #ifdef __cplusplus
 }
 #endif
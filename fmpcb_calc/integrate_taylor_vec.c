@@ -0,0 +1,159 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmpcb_calc.h"
+
+/* number of Taylor expansions requested per call */
+#define INTEGRATE_VEC_BATCH 64
+
+int _fmpcb_calc_taylor_num_terms(long * num_terms, fmpr_t err,
+    const fmprb_t cbound, const fmpcb_t x, const fmpr_t outer_radius,
+    long accuracy_goal, long prec);
+
+void _fmpcb_calc_taylor_add_step(fmpcb_t sum, fmpcb_ptr taylor_poly, long N,
+    const fmpcb_t x, const fmpr_t err, long prec);
+
+int
+fmpcb_calc_integrate_taylor_vec(fmpcb_t res,
+    fmpcb_calc_vec_func_t func, void * param,
+    const fmpcb_t a, const fmpcb_t b,
+    const fmpr_t inner_radius,
+    const fmpr_t outer_radius,
+    long accuracy_goal, long prec)
+{
+    long num_steps, step, start, num, i, Nmax, bp;
+    long * N;
+    int result;
+
+    fmpcb_t delta, x, sum;
+    fmpcb_ptr m, taylor_polys, taylor_poly;
+    fmprb_t cbound, rbound;
+    fmpr_struct * err;
+
+    fmpcb_init(delta);
+    fmpcb_init(x);
+    fmpcb_init(sum);
+    fmprb_init(cbound);
+    fmprb_init(rbound);
+
+    fmpcb_sub(delta, b, a, prec);
+
+    /* precision used for bounds calculations */
+    bp = FMPRB_RAD_PREC;
+
+    /* compute the number of steps */
+    {
+        fmpr_t t;
+        fmpr_init(t);
+        fmpcb_get_abs_ubound_fmpr(t, delta, bp);
+        fmpr_div(t, t, inner_radius, bp, FMPR_RND_UP);
+        fmpr_mul_2exp_si(t, t, -1);
+        num_steps = (long) (fmpr_get_d(t, FMPR_RND_UP) + 1.0);
+        /* make sure it's not something absurd */
+        num_steps = FLINT_MIN(num_steps, 10 * prec);
+        num_steps = FLINT_MAX(num_steps, 1);
+        fmpr_clear(t);
+    }
+
+    m = _fmpcb_vec_init(INTEGRATE_VEC_BATCH);
+    N = flint_malloc(sizeof(long) * INTEGRATE_VEC_BATCH);
+    err = _fmpr_vec_init(INTEGRATE_VEC_BATCH);
+
+    /* evaluate at +/- x */
+    fmpcb_div_ui(x, delta, 2 * num_steps, prec);
+
+    result = FMPRB_CALC_SUCCESS;
+
+    fmprb_set_fmpr(rbound, outer_radius);
+    fmpcb_zero(sum);
+
+    for (start = 0; start < num_steps && result == FMPRB_CALC_SUCCESS;
+        start += INTEGRATE_VEC_BATCH)
+    {
+        num = FLINT_MIN(INTEGRATE_VEC_BATCH, num_steps - start);
+        Nmax = 1;
+
+        /* bounds for each step, stopping at the first failure */
+        for (i = 0; i < num; i++)
+        {
+            step = start + i;
+
+            /* midpoint of subinterval */
+            fmpcb_mul_ui(m + i, delta, 2 * step + 1, prec);
+            fmpcb_div_ui(m + i, m + i, 2 * num_steps, prec);
+            fmpcb_add(m + i, m + i, a, prec);
+
+            if (fmprb_calc_verbose)
+            {
+                printf("integration point %ld/%ld: ", 2 * step + 1, 2 * num_steps);
+                fmpcb_printd(m + i, 15); printf("\n");
+            }
+
+            /* see fmpcb_calc_integrate_taylor */
+            fmpcb_calc_cauchy_bound_vec(cbound, func, param, m + i, rbound, 8, bp);
+
+            result = _fmpcb_calc_taylor_num_terms(N + i, err + i, cbound, x,
+                outer_radius, accuracy_goal, prec);
+
+            Nmax = FLINT_MAX(Nmax, N[i]);
+
+            if (result == FMPRB_CALC_NO_CONVERGENCE)
+            {
+                num = i + 1;
+                break;
+            }
+        }
+
+        /* all Taylor polynomials in one call, each with Nmax terms
+           of which the first N[i] are used */
+        taylor_polys = _fmpcb_vec_init(num * Nmax);
+        taylor_poly = _fmpcb_vec_init(Nmax + 1);
+
+        func(taylor_polys, m, num, param, Nmax, prec);
+
+        for (i = 0; i < num; i++)
+        {
+            _fmpcb_vec_set(taylor_poly, taylor_polys + i * Nmax, N[i]);
+            _fmpcb_calc_taylor_add_step(sum, taylor_poly, N[i], x, err + i, prec);
+        }
+
+        _fmpcb_vec_clear(taylor_polys, num * Nmax);
+        _fmpcb_vec_clear(taylor_poly, Nmax + 1);
+    }
+
+    fmpcb_set(res, sum);
+
+    _fmpcb_vec_clear(m, INTEGRATE_VEC_BATCH);
+    flint_free(N);
+    _fmpr_vec_clear(err, INTEGRATE_VEC_BATCH);
+
+    fmpcb_clear(delta);
+    fmpcb_clear(x);
+    fmpcb_clear(sum);
+    fmprb_clear(cbound);
+    fmprb_clear(rbound);
+
+    return result;
+}
@@ -76,8 +76,9 @@ int main()
 
         fmpcb_calc_cauchy_bound(b, sin_x, NULL, x, radius, maxdepth, prec);
 
+        fmpr_set_d(fmprb_midref(ans), 1e-8);
+        mag_set_fmpr(fmprb_radref(ans), fmprb_midref(ans));
         fmpr_set_d(fmprb_midref(ans), answers[r-1]);
-        fmpr_set_d(fmprb_radref(ans), 1e-8);
 
         if (!fmprb_overlaps(b, ans))
         {
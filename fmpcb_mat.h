@@ -111,6 +111,10 @@ void fmpcb_mat_sub(fmpcb_mat_t res, const fmpcb_mat_t mat1, const fmpcb_mat_t ma
 
 void fmpcb_mat_mul(fmpcb_mat_t res, const fmpcb_mat_t mat1, const fmpcb_mat_t mat2, long prec);
 
+void fmpcb_mat_mul_classical(fmpcb_mat_t C, const fmpcb_mat_t A, const fmpcb_mat_t B, long prec);
+
+void fmpcb_mat_mul_block(fmpcb_mat_t C, const fmpcb_mat_t A, const fmpcb_mat_t B, long prec);
+
 void fmpcb_mat_pow_ui(fmpcb_mat_t B, const fmpcb_mat_t A, ulong exp, long prec);
 
 /* Scalar arithmetic */
@@ -109,29 +109,31 @@ fmpcb_mat_det_inplace(fmpcb_t det, fmpcb_mat_t A, long prec)
     /* bound unreduced part using Hadamard's inequality */
     if (rank < n)
     {
-        fmpr_t t;
+        fmpr_t t, u;
         fmprb_t d;
         fmpcb_t e;
 
         fmpr_init(t);
+        fmpr_init(u);
         fmprb_init(d);
         fmpcb_init(e);
 
-        fmpr_one(fmprb_radref(d));
+        fmpr_one(u);
 
         for (i = rank; i < n; i++)
         {
             fmpcb_vec_get_fmpr_2norm_squared_bound(t, A->rows[i] + rank, 
                 n - rank, FMPRB_RAD_PREC);
-            fmpr_mul(fmprb_radref(d), fmprb_radref(d), t, FMPRB_RAD_PREC, FMPR_RND_UP);
+            fmpr_mul(u, u, t, FMPRB_RAD_PREC, FMPR_RND_UP);
         }
 
         /* now d contains the absolute value of the determinant */
-        fmpr_sqrt(fmprb_radref(d), fmprb_radref(d), FMPRB_RAD_PREC, FMPR_RND_UP);
+        fmpr_sqrt(u, u, FMPRB_RAD_PREC, FMPR_RND_UP);
+        fmprb_set_rad_fmpr(d, u);
 
         /* multiply by interval containing the unit disc */
-        fmpr_set_ui(fmprb_radref(fmpcb_realref(e)), 1);
-        fmpr_set_ui(fmprb_radref(fmpcb_imagref(e)), 1);
+        mag_one(fmprb_radref(fmpcb_realref(e)));
+        mag_one(fmprb_radref(fmpcb_imagref(e)));
         fmpcb_mul_fmprb(e, e, d, prec);
 
         fmpcb_mul(det, det, e, prec);
@@ -139,6 +141,7 @@ fmpcb_mat_det_inplace(fmpcb_t det, fmpcb_mat_t A, long prec)
         fmpcb_clear(e);
         fmprb_clear(d);
         fmpr_clear(t);
+        fmpr_clear(u);
     }
 }
 
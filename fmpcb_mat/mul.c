@@ -25,52 +25,21 @@
 
 #include "fmpcb_mat.h"
 
+/* use block multiplication when all dimensions are at least this large */
+#define BLOCK_CUTOFF 8
+
 void
 fmpcb_mat_mul(fmpcb_mat_t C, const fmpcb_mat_t A, const fmpcb_mat_t B, long prec)
 {
-    long ar, ac, br, bc, i, j, k;
-
-    ar = fmpcb_mat_nrows(A);
-    ac = fmpcb_mat_ncols(A);
-    br = fmpcb_mat_nrows(B);
-    bc = fmpcb_mat_ncols(B);
-
-    if (ac != br || ar != fmpcb_mat_nrows(C) || bc != fmpcb_mat_ncols(C))
-    {
-        printf("fmpcb_mat_mul: incompatible dimensions\n");
-        abort();
-    }
-
-    if (br == 0)
+    if (fmpcb_mat_nrows(A) >= BLOCK_CUTOFF &&
+        fmpcb_mat_ncols(A) >= BLOCK_CUTOFF &&
+        fmpcb_mat_ncols(B) >= BLOCK_CUTOFF)
     {
-        fmpcb_mat_zero(C);
-        return;
+        fmpcb_mat_mul_block(C, A, B, prec);
     }
-
-    if (A == C || B == C)
-    {
-        fmpcb_mat_t T;
-        fmpcb_mat_init(T, ar, bc);
-        fmpcb_mat_mul(T, A, B, prec);
-        fmpcb_mat_swap(T, C);
-        fmpcb_mat_clear(T);
-        return;
-    }
-
-    for (i = 0; i < ar; i++)
+    else
     {
-        for (j = 0; j < bc; j++)
-        {
-            fmpcb_mul(fmpcb_mat_entry(C, i, j),
-                      fmpcb_mat_entry(A, i, 0),
-                      fmpcb_mat_entry(B, 0, j), prec);
-
-            for (k = 1; k < br; k++)
-            {
-                fmpcb_addmul(fmpcb_mat_entry(C, i, j),
-                             fmpcb_mat_entry(A, i, k),
-                             fmpcb_mat_entry(B, k, j), prec);
-            }
-        }
+        fmpcb_mat_mul_classical(C, A, B, prec);
     }
 }
+
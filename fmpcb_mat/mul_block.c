@@ -0,0 +1,125 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2012 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmpcb_mat.h"
+
+/* sets X to a shallow copy of the real or imaginary part of A */
+static void
+_fmpcb_mat_get_part_shallow(fmprb_mat_t X, const fmpcb_mat_t A, int imag)
+{
+    long i, j, r, c;
+
+    r = fmpcb_mat_nrows(A);
+    c = fmpcb_mat_ncols(A);
+
+    X->entries = flint_malloc(sizeof(fmprb_struct) * r * c);
+    X->rows = flint_malloc(sizeof(fmprb_ptr) * r);
+    X->r = r;
+    X->c = c;
+
+    for (i = 0; i < r; i++)
+    {
+        X->rows[i] = X->entries + i * c;
+
+        for (j = 0; j < c; j++)
+        {
+            if (imag)
+                X->rows[i][j] = *fmpcb_imagref(fmpcb_mat_entry(A, i, j));
+            else
+                X->rows[i][j] = *fmpcb_realref(fmpcb_mat_entry(A, i, j));
+        }
+    }
+}
+
+static void
+_fmprb_mat_clear_shallow(fmprb_mat_t X)
+{
+    flint_free(X->entries);
+    flint_free(X->rows);
+}
+
+void
+fmpcb_mat_mul_block(fmpcb_mat_t C, const fmpcb_mat_t A, const fmpcb_mat_t B, long prec)
+{
+    long ar, ac, br, bc, i, j;
+    fmprb_mat_t Ar, Ai, Br, Bi, Cr, Ci, T;
+
+    ar = fmpcb_mat_nrows(A);
+    ac = fmpcb_mat_ncols(A);
+    br = fmpcb_mat_nrows(B);
+    bc = fmpcb_mat_ncols(B);
+
+    if (ac != br || ar != fmpcb_mat_nrows(C) || bc != fmpcb_mat_ncols(C))
+    {
+        printf("fmpcb_mat_mul_block: incompatible dimensions\n");
+        abort();
+    }
+
+    if (ar == 0 || br == 0 || bc == 0)
+    {
+        fmpcb_mat_zero(C);
+        return;
+    }
+
+    _fmpcb_mat_get_part_shallow(Ar, A, 0);
+    _fmpcb_mat_get_part_shallow(Ai, A, 1);
+    _fmpcb_mat_get_part_shallow(Br, B, 0);
+    _fmpcb_mat_get_part_shallow(Bi, B, 1);
+
+    fmprb_mat_init(Cr, ar, bc);
+    fmprb_mat_init(Ci, ar, bc);
+    fmprb_mat_init(T, ar, bc);
+
+    /* (Ar + Ai i)(Br + Bi i) = (Ar Br - Ai Bi) + (Ar Bi + Ai Br) i */
+    fmprb_mat_mul_block(Cr, Ar, Br, prec);
+    fmprb_mat_mul_block(T, Ai, Bi, prec);
+    fmprb_mat_sub(Cr, Cr, T, prec);
+
+    fmprb_mat_mul_block(Ci, Ar, Bi, prec);
+    fmprb_mat_mul_block(T, Ai, Br, prec);
+    fmprb_mat_add(Ci, Ci, T, prec);
+
+    _fmprb_mat_clear_shallow(Ar);
+    _fmprb_mat_clear_shallow(Ai);
+    _fmprb_mat_clear_shallow(Br);
+    _fmprb_mat_clear_shallow(Bi);
+
+    /* A and B are no longer needed, so C may alias them */
+    for (i = 0; i < ar; i++)
+    {
+        for (j = 0; j < bc; j++)
+        {
+            fmprb_swap(fmpcb_realref(fmpcb_mat_entry(C, i, j)),
+                fmprb_mat_entry(Cr, i, j));
+            fmprb_swap(fmpcb_imagref(fmpcb_mat_entry(C, i, j)),
+                fmprb_mat_entry(Ci, i, j));
+        }
+    }
+
+    fmprb_mat_clear(Cr);
+    fmprb_mat_clear(Ci);
+    fmprb_mat_clear(T);
+}
+
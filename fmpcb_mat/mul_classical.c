@@ -0,0 +1,78 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2012 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmpcb_mat.h"
+
+void
+fmpcb_mat_mul_classical(fmpcb_mat_t C, const fmpcb_mat_t A, const fmpcb_mat_t B, long prec)
+{
+    long ar, ac, br, bc, i, j;
+    fmpcb_ptr BT;
+
+    ar = fmpcb_mat_nrows(A);
+    ac = fmpcb_mat_ncols(A);
+    br = fmpcb_mat_nrows(B);
+    bc = fmpcb_mat_ncols(B);
+
+    if (ac != br || ar != fmpcb_mat_nrows(C) || bc != fmpcb_mat_ncols(C))
+    {
+        printf("fmpcb_mat_mul: incompatible dimensions\n");
+        abort();
+    }
+
+    if (br == 0)
+    {
+        fmpcb_mat_zero(C);
+        return;
+    }
+
+    if (A == C || B == C)
+    {
+        fmpcb_mat_t T;
+        fmpcb_mat_init(T, ar, bc);
+        fmpcb_mat_mul(T, A, B, prec);
+        fmpcb_mat_swap(T, C);
+        fmpcb_mat_clear(T);
+        return;
+    }
+
+    /* shallow transpose of B, so that the columns are contiguous */
+    BT = flint_malloc(sizeof(fmpcb_struct) * br * bc);
+
+    for (i = 0; i < br; i++)
+        for (j = 0; j < bc; j++)
+            BT[j * br + i] = *fmpcb_mat_entry(B, i, j);
+
+    for (i = 0; i < ar; i++)
+    {
+        for (j = 0; j < bc; j++)
+        {
+            _fmpcb_vec_dot(fmpcb_mat_entry(C, i, j), NULL, 0,
+                A->rows[i], 1, BT + j * br, 1, br, prec);
+        }
+    }
+
+    flint_free(BT);
+}
@@ -29,7 +29,8 @@ void
 fmpcb_mat_solve_lu_precomp(fmpcb_mat_t X, const long * perm,
     const fmpcb_mat_t A, const fmpcb_mat_t B, long prec)
 {
-    long i, j, c, n, m;
+    long i, c, n, m;
+    fmpcb_ptr xc;
 
     n = fmpcb_mat_nrows(X);
     m = fmpcb_mat_ncols(X);
@@ -60,29 +61,34 @@ fmpcb_mat_solve_lu_precomp(fmpcb_mat_t X, const long * perm,
         }
     }
 
+    /* shallow copies of the entries of the current column of X */
+    xc = flint_malloc(sizeof(fmpcb_struct) * n);
+
     for (c = 0; c < m; c++)
     {
         /* solve Ly = b */
-        for (i = 1; i < n; i++)
+        for (i = 0; i < n; i++)
         {
-            for (j = 0; j < i; j++)
-            {
-                fmpcb_submul(fmpcb_mat_entry(X, i, c),
-                    fmpcb_mat_entry(A, i, j), fmpcb_mat_entry(X, j, c), prec);
-            }
+            if (i > 0)
+                _fmpcb_vec_dot(fmpcb_mat_entry(X, i, c), fmpcb_mat_entry(X, i, c),
+                    1, A->rows[i], 1, xc, 1, i, prec);
+
+            xc[i] = *fmpcb_mat_entry(X, i, c);
         }
 
         /* solve Ux = y */
         for (i = n - 1; i >= 0; i--)
         {
-            for (j = i + 1; j < n; j++)
-            {
-                fmpcb_submul(fmpcb_mat_entry(X, i, c),
-                    fmpcb_mat_entry(A, i, j), fmpcb_mat_entry(X, j, c), prec);
-            }
+            if (i < n - 1)
+                _fmpcb_vec_dot(fmpcb_mat_entry(X, i, c), fmpcb_mat_entry(X, i, c),
+                    1, A->rows[i] + i + 1, 1, xc + i + 1, 1, n - i - 1, prec);
 
             fmpcb_div(fmpcb_mat_entry(X, i, c), fmpcb_mat_entry(X, i, c),
                 fmpcb_mat_entry(A, i, i), prec);
+
+            xc[i] = *fmpcb_mat_entry(X, i, c);
         }
     }
+
+    flint_free(xc);
 }
@@ -29,7 +29,7 @@ void
 _fmpcb_poly_evaluate_rectangular(fmpcb_t y, fmpcb_srcptr poly,
     long len, const fmpcb_t x, long prec)
 {
-    long i, j, m, r;
+    long i, m, r;
     fmpcb_ptr xs;
     fmpcb_t s, t, c;
 
@@ -61,15 +61,13 @@ _fmpcb_poly_evaluate_rectangular(fmpcb_t y, fmpcb_srcptr poly,
 
     _fmpcb_vec_set_powers(xs, x, m + 1, prec);
 
-    fmpcb_set(y, poly + (r - 1) * m);
-    for (j = 1; (r - 1) * m + j < len; j++)
-        fmpcb_addmul(y, xs + j, poly + (r - 1) * m + j, prec);
+    _fmpcb_vec_dot(y, poly + (r - 1) * m, 0, xs + 1, 1,
+        poly + (r - 1) * m + 1, 1, len - (r - 1) * m - 1, prec);
 
     for (i = r - 2; i >= 0; i--)
     {
-        fmpcb_set(s, poly + i * m);
-        for (j = 1; j < m; j++)
-            fmpcb_addmul(s, xs + j, poly + i * m + j, prec);
+        _fmpcb_vec_dot(s, poly + i * m, 0, xs + 1, 1,
+            poly + i * m + 1, 1, m - 1, prec);
 
         fmpcb_mul(y, y, xs + m, prec);
         fmpcb_add(y, y, s, prec);
@@ -40,9 +40,16 @@ long
 _fmpcb_get_rad_mag(const fmpcb_t z)
 {
     long rm, im;
+    fmpr_t t;
 
-    rm = fmpr_abs_bound_lt_2exp_si(fmprb_radref(fmpcb_realref(z)));
-    im = fmpr_abs_bound_lt_2exp_si(fmprb_radref(fmpcb_imagref(z)));
+    fmpr_init(t);
+
+    fmprb_get_rad_fmpr(t, fmpcb_realref(z));
+    rm = fmpr_abs_bound_lt_2exp_si(t);
+    fmprb_get_rad_fmpr(t, fmpcb_imagref(z));
+    im = fmpr_abs_bound_lt_2exp_si(t);
+
+    fmpr_clear(t);
 
     return FLINT_MAX(rm, im);
 }
@@ -57,18 +64,18 @@ _fmpcb_poly_roots_initial_values(fmpcb_ptr roots, long deg, long prec)
 
     fmpq_set_si(q, 4, 10);
     fmprb_set_fmpq(fmpcb_realref(roots + 0), q, prec);
-    fmpr_zero(fmprb_radref(fmpcb_realref(roots + 0)));
+    mag_zero(fmprb_radref(fmpcb_realref(roots + 0)));
 
     fmpq_set_si(q, 9, 10);
     fmprb_set_fmpq(fmpcb_imagref(roots + 0), q, prec);
-    fmpr_zero(fmprb_radref(fmpcb_imagref(roots + 0)));
+    mag_zero(fmprb_radref(fmpcb_imagref(roots + 0)));
     fmpq_clear(q);
 
     for (i = 1; i < deg; i++)
     {
         fmpcb_mul(roots + i, roots + i - 1, roots + 0, prec);
-        fmpr_zero(fmprb_radref(fmpcb_realref(roots + i)));
-        fmpr_zero(fmprb_radref(fmpcb_imagref(roots + i)));
+        mag_zero(fmprb_radref(fmpcb_realref(roots + i)));
+        mag_zero(fmprb_radref(fmpcb_imagref(roots + i)));
     }
 }
 
@@ -92,9 +99,9 @@ _fmpcb_poly_find_roots(fmpcb_ptr roots,
         for (i = 0; i < deg; i++)
         {
             fmprb_zero(fmpcb_realref(roots + i));
-            fmpr_pos_inf(fmprb_radref(fmpcb_realref(roots + i)));
+            mag_inf(fmprb_radref(fmpcb_realref(roots + i)));
             fmprb_zero(fmpcb_imagref(roots + i));
-            fmpr_pos_inf(fmprb_radref(fmpcb_imagref(roots + i)));
+            mag_inf(fmprb_radref(fmpcb_imagref(roots + i)));
         }
         return 0;
     }
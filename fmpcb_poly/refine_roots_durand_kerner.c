@@ -162,18 +162,18 @@ _fmpcb_poly_refine_roots_durand_kerner(fmpcb_ptr roots,
             }
         }
 
-        fmpr_zero(fmprb_radref(fmpcb_realref(y)));
-        fmpr_zero(fmprb_radref(fmpcb_imagref(y)));
+        mag_zero(fmprb_radref(fmpcb_realref(y)));
+        mag_zero(fmprb_radref(fmpcb_imagref(y)));
 
         fmpcb_inv_mid(t, y, prec);
         fmpcb_mul_mid(t, t, x, prec);
 
         fmpcb_sub_mid(roots + i, roots + i, t, prec);
 
-        fmpr_set_round(fmprb_radref(fmpcb_realref(roots + i)),
-            fmprb_midref(fmpcb_realref(t)), FMPRB_RAD_PREC, FMPR_RND_UP);
-        fmpr_set_round(fmprb_radref(fmpcb_imagref(roots + i)),
-            fmprb_midref(fmpcb_imagref(t)), FMPRB_RAD_PREC, FMPR_RND_UP);
+        mag_set_fmpr(fmprb_radref(fmpcb_realref(roots + i)),
+            fmprb_midref(fmpcb_realref(t)));
+        mag_set_fmpr(fmprb_radref(fmpcb_imagref(roots + i)),
+            fmprb_midref(fmpcb_imagref(t)));
     }
 
     fmpcb_clear(x);
@@ -38,8 +38,8 @@ _fmpcb_poly_root_inclusion(fmpcb_t r, const fmpcb_t m,
     fmpr_init(v);
 
     fmpcb_set(r, m);
-    fmpr_zero(fmprb_radref(fmpcb_realref(r)));
-    fmpr_zero(fmprb_radref(fmpcb_imagref(r)));
+    mag_zero(fmprb_radref(fmpcb_realref(r)));
+    mag_zero(fmprb_radref(fmpcb_imagref(r)));
 
     _fmpcb_poly_evaluate(t, poly, len, r, prec);
     fmpcb_get_abs_ubound_fmpr(u, t, FMPRB_RAD_PREC);
@@ -56,8 +56,8 @@ _fmpcb_poly_root_inclusion(fmpcb_t r, const fmpcb_t m,
         fmpr_mul_ui(u, u, len - 1, FMPRB_RAD_PREC, FMPR_RND_UP);
     }
 
-    fmpr_set(fmprb_radref(fmpcb_realref(r)), u);
-    fmpr_set(fmprb_radref(fmpcb_imagref(r)), u);
+    mag_set_fmpr(fmprb_radref(fmpcb_realref(r)), u);
+    mag_set_fmpr(fmprb_radref(fmpcb_imagref(r)), u);
 
     fmpr_clear(u);
     fmpr_clear(v);
@@ -596,6 +596,18 @@ void fmpr_print(const fmpr_t x);
 
 void fmpr_printd(const fmpr_t x, long digits);
 
+void fmpr_fprintd(FILE * file, const fmpr_t x, long digits);
+
+int fmpr_get_fmpz_10exp(fmpz_t m, fmpz_t e, const fmpr_t x,
+    long digits, fmpr_rnd_t rnd);
+
+char * _fmpr_decimal_get_str(const fmpz_t m, const fmpz_t e, long digits);
+
+void _fmpr_decimal_fprint(FILE * file, const fmpz_t m, const fmpz_t e,
+    long digits);
+
+char * fmpr_get_str(const fmpr_t x, long digits, fmpr_rnd_t rnd);
+
 
 static __inline__ void
 fmpr_mul_2exp_si(fmpr_t y, const fmpr_t x, long e)
@@ -0,0 +1,250 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include <string.h>
+#include "fmpr.h"
+
+/* numbers with at most this many digits are converted using fmpz_get_str;
+   larger numbers are split in half by dividing by a power of ten */
+#define DIGITS_BASECASE 512
+
+/* output goes either to a string or to a file; a decimal point
+   is inserted after the first point digits if point >= 0 */
+typedef struct
+{
+    char * str;
+    FILE * file;
+    long len;
+    long ndigits;
+    long point;
+}
+decimal_out_struct;
+
+static void
+_out_write(decimal_out_struct * out, const char * s, long n)
+{
+    if (out->str != NULL)
+        memcpy(out->str + out->len, s, n);
+    else
+        fwrite(s, 1, n, out->file);
+
+    out->len += n;
+}
+
+static void
+_out_digits(decimal_out_struct * out, const char * s, long n)
+{
+    long k;
+
+    if (out->point >= out->ndigits && out->point < out->ndigits + n)
+    {
+        k = out->point - out->ndigits;
+        _out_write(out, s, k);
+        _out_write(out, ".", 1);
+        _out_write(out, s + k, n - k);
+    }
+    else
+    {
+        _out_write(out, s, n);
+    }
+
+    out->ndigits += n;
+}
+
+static void
+_out_zeros(decimal_out_struct * out, long n)
+{
+    static const char zeros[] = "0000000000000000000000000000000000000000"
+                                "0000000000000000000000000000000000000000";
+    long k;
+
+    while (n > 0)
+    {
+        k = FLINT_MIN(n, (long) sizeof(zeros) - 1);
+        _out_digits(out, zeros, k);
+        n -= k;
+    }
+}
+
+/* writes the len-digit representation of 0 <= n < 10^len, including
+   leading zeros; pow[j] = 10^(DIGITS_BASECASE * 2^j) */
+static void
+_out_fmpz_digits(decimal_out_struct * out, const fmpz_t n, long len,
+    const fmpz * pow)
+{
+    if (len <= DIGITS_BASECASE)
+    {
+        char * s;
+        long k;
+
+        s = fmpz_get_str(NULL, 10, n);
+        k = strlen(s);
+        _out_zeros(out, len - k);
+        _out_digits(out, s, k);
+        flint_free(s);
+    }
+    else
+    {
+        fmpz_t q, r;
+        long j, k;
+
+        /* split at the largest k = DIGITS_BASECASE * 2^j < len */
+        for (j = 0; (DIGITS_BASECASE << (j + 1)) < len; j++) ;
+        k = DIGITS_BASECASE << j;
+
+        fmpz_init(q);
+        fmpz_init(r);
+
+        fmpz_tdiv_qr(q, r, n, pow + j);
+        _out_fmpz_digits(out, q, len - k, pow);
+        fmpz_clear(q);
+        _out_fmpz_digits(out, r, k, pow);
+        fmpz_clear(r);
+    }
+}
+
+/* writes m, which has n >= 1 digits, using divide-and-conquer */
+static void
+_out_fmpz(decimal_out_struct * out, const fmpz_t m, long n)
+{
+    fmpz * pow;
+    long j, num;
+
+    for (num = 0; (DIGITS_BASECASE << num) < n; num++) ;
+
+    pow = _fmpz_vec_init(FLINT_MAX(num, 1));
+
+    if (num > 0)
+    {
+        fmpz_ui_pow_ui(pow, 10, DIGITS_BASECASE);
+        for (j = 1; j < num; j++)
+            fmpz_mul(pow + j, pow + j - 1, pow + j - 1);
+    }
+
+    _out_fmpz_digits(out, m, n, pow);
+
+    _fmpz_vec_clear(pow, FLINT_MAX(num, 1));
+}
+
+/* writes m * 10^e in the style of printf("%.*g", digits, ...), where
+   m is zero or has exactly digits digits */
+static void
+_fmpr_decimal_write(decimal_out_struct * out, const fmpz_t m,
+    const fmpz_t e, long digits)
+{
+    fmpz_t t, x;
+    long n, z;
+
+    out->len = 0;
+    out->ndigits = 0;
+    out->point = -1;
+
+    if (fmpz_is_zero(m))
+    {
+        _out_write(out, "0", 1);
+        return;
+    }
+
+    fmpz_init(t);
+    fmpz_init(x);
+
+    if (fmpz_sgn(m) < 0)
+        _out_write(out, "-", 1);
+
+    /* remove trailing zeros */
+    fmpz_abs(t, m);
+    fmpz_set_ui(x, 10);
+    z = fmpz_remove(t, t, x);
+    n = digits - z;
+
+    /* x = exponent of the leading digit */
+    fmpz_add_ui(x, e, digits - 1);
+
+    if (fmpz_cmp_si(x, -4) >= 0 && fmpz_cmp_si(x, digits) < 0)
+    {
+        long k = fmpz_get_si(x);
+
+        if (k < 0)
+        {
+            _out_write(out, "0.", 2);
+            _out_zeros(out, -k - 1);
+            _out_fmpz(out, t, n);
+        }
+        else
+        {
+            if (n > k + 1)
+                out->point = k + 1;
+
+            _out_fmpz(out, t, n);
+            _out_zeros(out, k + 1 - n);
+        }
+    }
+    else
+    {
+        char * s;
+
+        if (n > 1)
+            out->point = 1;
+
+        _out_fmpz(out, t, n);
+
+        _out_write(out, (fmpz_sgn(x) < 0) ? "e-" : "e+", 2);
+        fmpz_abs(x, x);
+        if (fmpz_cmp_ui(x, 10) < 0)
+            _out_write(out, "0", 1);
+        s = fmpz_get_str(NULL, 10, x);
+        _out_write(out, s, strlen(s));
+        flint_free(s);
+    }
+
+    fmpz_clear(t);
+    fmpz_clear(x);
+}
+
+char *
+_fmpr_decimal_get_str(const fmpz_t m, const fmpz_t e, long digits)
+{
+    decimal_out_struct out;
+
+    /* sign, "0.", four zeros, digits, "e+", exponent and terminator */
+    out.str = flint_malloc(digits + fmpz_sizeinbase(e, 10) + 20);
+    out.file = NULL;
+
+    _fmpr_decimal_write(&out, m, e, digits);
+    out.str[out.len] = '\0';
+
+    return out.str;
+}
+
+void
+_fmpr_decimal_fprint(FILE * file, const fmpz_t m, const fmpz_t e, long digits)
+{
+    decimal_out_struct out;
+
+    out.str = NULL;
+    out.file = file;
+
+    _fmpr_decimal_write(&out, m, e, digits);
+}
@@ -0,0 +1,273 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmpr.h"
+
+/* 2^32 log(2) / log(10), rounded down */
+#define LOG10_2_32 1292913986UL
+
+/* sets q = N / D rounded according to rnd, where D > 0;
+   returns 1 if the division is exact */
+static int
+_fmpz_div_round(fmpz_t q, const fmpz_t N, const fmpz_t D, fmpr_rnd_t rnd)
+{
+    fmpz_t r;
+    int exact, c;
+
+    fmpz_init(r);
+    fmpz_fdiv_qr(q, r, N, D);
+    exact = fmpz_is_zero(r);
+
+    if (!exact)
+    {
+        if (rnd == FMPR_RND_NEAR)
+        {
+            fmpz_mul_2exp(r, r, 1);
+            c = fmpz_cmp(r, D);
+            if (c > 0 || (c == 0 && fmpz_is_odd(q)))
+                fmpz_add_ui(q, q, 1);
+        }
+        else if (rnd == FMPR_RND_CEIL || (rnd == FMPR_RND_UP && fmpz_sgn(N) > 0)
+            || (rnd == FMPR_RND_DOWN && fmpz_sgn(N) < 0))
+        {
+            fmpz_add_ui(q, q, 1);
+        }
+    }
+
+    fmpz_clear(r);
+    return exact;
+}
+
+/* sets q to m * 2^e / 10^E rounded to an integer, using exact
+   integer arithmetic */
+static int
+_fmpr_get_fmpz_10exp_exact(fmpz_t q, const fmpz_t m, long e, long E,
+    fmpr_rnd_t rnd)
+{
+    fmpz_t N, D;
+    int exact;
+
+    fmpz_init(N);
+    fmpz_init(D);
+
+    if (E < 0)
+    {
+        fmpz_ui_pow_ui(N, 10, -E);
+        fmpz_mul(N, N, m);
+        fmpz_one(D);
+    }
+    else
+    {
+        fmpz_set(N, m);
+        fmpz_ui_pow_ui(D, 10, E);
+    }
+
+    if (e >= 0)
+        fmpz_mul_2exp(N, N, e);
+    else
+        fmpz_mul_2exp(D, D, -e);
+
+    exact = _fmpz_div_round(q, N, D, rnd);
+
+    fmpz_clear(N);
+    fmpz_clear(D);
+
+    return exact;
+}
+
+/* sets q to x / 10^E rounded to an integer, using floating-point
+   bounds with increasing precision; assumes that the rounding
+   boundaries cannot be hit exactly */
+static void
+_fmpr_get_fmpz_10exp_ziv(fmpz_t q, const fmpr_t x, const fmpz_t E,
+    long wp, fmpr_rnd_t rnd)
+{
+    fmpr_t t, lo, hi, ten;
+    fmpz_t f, g;
+    int neg;
+
+    fmpr_init(t);
+    fmpr_init(lo);
+    fmpr_init(hi);
+    fmpr_init(ten);
+    fmpz_init(f);
+    fmpz_init(g);
+
+    fmpr_set_ui(ten, 10);
+    fmpz_abs(f, E);
+    neg = fmpr_sgn(x) < 0;
+
+    for (;;)
+    {
+        /* [lo, hi] contains |x| / 10^E */
+        if (fmpz_sgn(E) >= 0)
+        {
+            fmpr_pow_sloppy_fmpz(t, ten, f, wp, FMPR_RND_UP);
+            fmpr_div(lo, x, t, wp, FMPR_RND_DOWN);
+            fmpr_pow_sloppy_fmpz(t, ten, f, wp, FMPR_RND_DOWN);
+            fmpr_div(hi, x, t, wp, FMPR_RND_UP);
+        }
+        else
+        {
+            fmpr_pow_sloppy_fmpz(t, ten, f, wp, FMPR_RND_DOWN);
+            fmpr_mul(lo, x, t, wp, FMPR_RND_DOWN);
+            fmpr_pow_sloppy_fmpz(t, ten, f, wp, FMPR_RND_UP);
+            fmpr_mul(hi, x, t, wp, FMPR_RND_UP);
+        }
+
+        fmpr_abs(lo, lo);
+        fmpr_abs(hi, hi);
+
+        if (neg)
+        {
+            fmpr_neg(lo, lo);
+            fmpr_neg(hi, hi);
+        }
+
+        /* rounding is monotone, so the result is determined
+           if both endpoints round to the same integer */
+        fmpr_get_fmpz(q, lo, rnd);
+        fmpr_get_fmpz(g, hi, rnd);
+
+        if (fmpz_equal(q, g))
+            break;
+
+        wp *= 2;
+    }
+
+    fmpr_clear(t);
+    fmpr_clear(lo);
+    fmpr_clear(hi);
+    fmpr_clear(ten);
+    fmpz_clear(f);
+    fmpz_clear(g);
+}
+
+int
+fmpr_get_fmpz_10exp(fmpz_t m, fmpz_t e, const fmpr_t x,
+    long digits, fmpr_rnd_t rnd)
+{
+    fmpz_t b, lo, hi, t;
+    long mbits, wp;
+    int exact, use_exact;
+
+    if (fmpr_is_special(x))
+    {
+        if (fmpr_is_zero(x))
+        {
+            fmpz_zero(m);
+            fmpz_zero(e);
+            return 1;
+        }
+        else
+        {
+            printf("fmpr_get_fmpz_10exp: cannot convert infinity or nan\n");
+            abort();
+        }
+    }
+
+    if (digits < 1)
+    {
+        printf("fmpr_get_fmpz_10exp: digits must be positive\n");
+        abort();
+    }
+
+    fmpz_init(b);
+    fmpz_init(lo);
+    fmpz_init(hi);
+    fmpz_init(t);
+
+    mbits = fmpz_bits(fmpr_manref(x));
+    wp = digits * 3.3219280948873623 + 64;
+
+    /* 2^(b-1) <= |x| < 2^b */
+    fmpz_add_ui(b, fmpr_expref(x), mbits);
+
+    /* use exact arithmetic if the integers involved are not much larger
+       than the output; otherwise the value cannot be exactly
+       representable as a digits-digit decimal number, and neither can
+       a rounding boundary, so bounds suffice */
+    fmpz_abs(t, b);
+    use_exact = fmpz_cmp_ui(t, 4 * (mbits + wp) + 256) <= 0;
+
+    /* 10^(digits-1) <= |m| < 10^digits */
+    fmpz_ui_pow_ui(lo, 10, digits - 1);
+    fmpz_mul_ui(hi, lo, 10);
+
+    /* initial guess e = floor((b-1) log10(2)) - digits + 1,
+       which may be off by one (or more for huge b) */
+    fmpz_sub_ui(e, b, 1);
+    fmpz_mul_ui(e, e, LOG10_2_32);
+    fmpz_fdiv_q_2exp(e, e, 32);
+    fmpz_sub_ui(e, e, digits - 1);
+
+    if (!use_exact)
+        wp += fmpz_bits(e);
+
+    for (;;)
+    {
+        if (use_exact)
+        {
+            exact = _fmpr_get_fmpz_10exp_exact(m, fmpr_manref(x),
+                fmpz_get_si(fmpr_expref(x)), fmpz_get_si(e), rnd);
+        }
+        else
+        {
+            _fmpr_get_fmpz_10exp_ziv(m, x, e, wp, rnd);
+            exact = 0;
+        }
+
+        fmpz_abs(t, m);
+
+        if (fmpz_cmp(t, lo) < 0)
+        {
+            fmpz_sub_ui(e, e, FLINT_MAX(1,
+                digits - (long) fmpz_sizeinbase(t, 10)));
+        }
+        else if (fmpz_cmp(t, hi) < 0)
+        {
+            break;
+        }
+        else if (fmpz_equal(t, hi))
+        {
+            /* rounded up to the next power of ten */
+            fmpz_divexact_ui(m, m, 10);
+            fmpz_add_ui(e, e, 1);
+            break;
+        }
+        else
+        {
+            fmpz_add_ui(e, e, FLINT_MAX(1,
+                (long) fmpz_sizeinbase(t, 10) - digits - 1));
+        }
+    }
+
+    fmpz_clear(b);
+    fmpz_clear(lo);
+    fmpz_clear(hi);
+    fmpz_clear(t);
+
+    return exact;
+}
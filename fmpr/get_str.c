@@ -0,0 +1,60 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include <string.h>
+#include "fmpr.h"
+
+char *
+fmpr_get_str(const fmpr_t x, long digits, fmpr_rnd_t rnd)
+{
+    char * s;
+
+    if (fmpr_is_special(x) && !fmpr_is_zero(x))
+    {
+        s = flint_malloc(5);
+
+        if (fmpr_is_pos_inf(x))
+            strcpy(s, "inf");
+        else if (fmpr_is_neg_inf(x))
+            strcpy(s, "-inf");
+        else
+            strcpy(s, "nan");
+    }
+    else
+    {
+        fmpz_t m, e;
+
+        fmpz_init(m);
+        fmpz_init(e);
+
+        fmpr_get_fmpz_10exp(m, e, x, digits, rnd);
+        s = _fmpr_decimal_get_str(m, e, digits);
+
+        fmpz_clear(m);
+        fmpz_clear(e);
+    }
+
+    return s;
+}
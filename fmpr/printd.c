@@ -25,12 +25,35 @@
 
 #include "fmpr.h"
 
+void
+fmpr_fprintd(FILE * file, const fmpr_t x, long digits)
+{
+    if (fmpr_is_special(x) && !fmpr_is_zero(x))
+    {
+        if (fmpr_is_pos_inf(x))
+            fputs("inf", file);
+        else if (fmpr_is_neg_inf(x))
+            fputs("-inf", file);
+        else
+            fputs("nan", file);
+    }
+    else
+    {
+        fmpz_t m, e;
+
+        fmpz_init(m);
+        fmpz_init(e);
+
+        fmpr_get_fmpz_10exp(m, e, x, digits, FMPR_RND_NEAR);
+        _fmpr_decimal_fprint(file, m, e, digits);
+
+        fmpz_clear(m);
+        fmpz_clear(e);
+    }
+}
+
 void
 fmpr_printd(const fmpr_t x, long digits)
 {
-    mpfr_t t;
-    mpfr_init2(t, digits * 3.33 + 10);
-    fmpr_get_mpfr(t, x, MPFR_RNDN);
-    mpfr_printf("%.*Rg", digits, t);
-    mpfr_clear(t);
+    fmpr_fprintd(stdout, x, digits);
 }
@@ -0,0 +1,191 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmpr.h"
+
+/* sets y = m * 10^e */
+static void
+fmpq_set_fmpz_10exp(fmpq_t y, const fmpz_t m, long e)
+{
+    fmpz_t t, u;
+
+    fmpz_init(t);
+    fmpz_init(u);
+
+    fmpz_ui_pow_ui(t, 10, FLINT_ABS(e));
+
+    if (e >= 0)
+    {
+        fmpz_mul(t, t, m);
+        fmpz_one(u);
+        fmpq_set_fmpz_frac(y, t, u);
+    }
+    else
+    {
+        fmpq_set_fmpz_frac(y, m, t);
+    }
+
+    fmpz_clear(t);
+    fmpz_clear(u);
+}
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("get_fmpz_10exp....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 20000; iter++)
+    {
+        long bits, digits, e;
+        fmpr_t x;
+        fmpz_t m, me, t, lo, hi;
+        fmpq_t X, Y, U, D, a, b;
+        fmpr_rnd_t rnd;
+        int exact, ok;
+
+        bits = 2 + n_randint(state, 200);
+        digits = 1 + n_randint(state, 30);
+
+        fmpr_init(x);
+        fmpz_init(m);
+        fmpz_init(me);
+        fmpz_init(t);
+        fmpz_init(lo);
+        fmpz_init(hi);
+        fmpq_init(X);
+        fmpq_init(Y);
+        fmpq_init(U);
+        fmpq_init(D);
+        fmpq_init(a);
+        fmpq_init(b);
+
+        fmpr_randtest_not_zero(x, state, bits, 10);
+
+        switch (n_randint(state, 5))
+        {
+            case 0: rnd = FMPR_RND_DOWN; break;
+            case 1: rnd = FMPR_RND_UP; break;
+            case 2: rnd = FMPR_RND_FLOOR; break;
+            case 3: rnd = FMPR_RND_CEIL; break;
+            default: rnd = FMPR_RND_NEAR; break;
+        }
+
+        exact = fmpr_get_fmpz_10exp(m, me, x, digits, rnd);
+        e = fmpz_get_si(me);
+
+        fmpz_ui_pow_ui(lo, 10, digits - 1);
+        fmpz_mul_ui(hi, lo, 10);
+        fmpz_abs(t, m);
+
+        ok = (fmpz_cmp(t, lo) >= 0) && (fmpz_cmp(t, hi) < 0);
+
+        /* compare |x| with |y| and its neighbours U (away from zero)
+           and D (towards zero) */
+        fmpr_get_fmpq(X, x);
+        fmpq_abs(X, X);
+        fmpq_set_fmpz_10exp(Y, t, e);
+
+        fmpz_add_ui(hi, t, 1);
+        fmpq_set_fmpz_10exp(U, hi, e);
+
+        if (fmpz_equal(t, lo))
+        {
+            fmpz_mul_ui(lo, t, 10);
+            fmpz_sub_ui(lo, lo, 1);
+            fmpq_set_fmpz_10exp(D, lo, e - 1);
+        }
+        else
+        {
+            fmpz_sub_ui(lo, t, 1);
+            fmpq_set_fmpz_10exp(D, lo, e);
+        }
+
+        if (fmpr_sgn(x) < 0)
+        {
+            if (rnd == FMPR_RND_FLOOR) rnd = FMPR_RND_UP;
+            else if (rnd == FMPR_RND_CEIL) rnd = FMPR_RND_DOWN;
+        }
+        else
+        {
+            if (rnd == FMPR_RND_FLOOR) rnd = FMPR_RND_DOWN;
+            else if (rnd == FMPR_RND_CEIL) rnd = FMPR_RND_UP;
+        }
+
+        ok = ok && (exact == fmpq_equal(X, Y));
+        ok = ok && (fmpz_sgn(m) == fmpr_sgn(x));
+
+        if (rnd == FMPR_RND_DOWN)
+        {
+            ok = ok && fmpq_cmp(Y, X) <= 0 && fmpq_cmp(X, U) < 0;
+        }
+        else if (rnd == FMPR_RND_UP)
+        {
+            ok = ok && fmpq_cmp(D, X) < 0 && fmpq_cmp(X, Y) <= 0;
+        }
+        else
+        {
+            fmpq_sub(a, Y, X);
+            fmpq_abs(a, a);
+            fmpq_sub(b, U, X);
+            ok = ok && fmpq_cmp(a, b) <= 0;
+            fmpq_sub(b, X, D);
+            ok = ok && fmpq_cmp(a, b) <= 0;
+        }
+
+        if (!ok)
+        {
+            printf("FAIL\n\n");
+            printf("digits = %ld, rnd = %d, exact = %d\n\n",
+                digits, (int) rnd, exact);
+            printf("x = "); fmpr_print(x); printf("\n\n");
+            printf("m = "); fmpz_print(m); printf("\n\n");
+            printf("e = "); fmpz_print(me); printf("\n\n");
+            abort();
+        }
+
+        fmpr_clear(x);
+        fmpz_clear(m);
+        fmpz_clear(me);
+        fmpz_clear(t);
+        fmpz_clear(lo);
+        fmpz_clear(hi);
+        fmpq_clear(X);
+        fmpq_clear(Y);
+        fmpq_clear(U);
+        fmpq_clear(D);
+        fmpq_clear(a);
+        fmpq_clear(b);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
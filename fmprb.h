@@ -27,16 +27,19 @@
 #define FMPRB_H
 
 #include "fmpr.h"
+#include "mag.h"
 #include "fmpz_poly.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* the radius is an upper bound, so it only needs a few bits of
+   precision; see mag.h */
 typedef struct
 {
     fmpr_struct mid;
-    fmpr_struct rad;
+    mag_struct rad;
 }
 fmprb_struct;
 
@@ -55,7 +58,7 @@ static __inline__ void
 fmprb_init(fmprb_t x)
 {
     fmpr_init(fmprb_midref(x));
-    fmpr_init(fmprb_radref(x));
+    mag_init(fmprb_radref(x));
 }
 
 #define FMPRB_DEBUG 0
@@ -64,15 +67,16 @@ static __inline__ void
 fmprb_clear(fmprb_t x)
 {
 #if FMPRB_DEBUG
-    if (fmpr_is_nan(fmprb_radref(x)) || fmpr_sgn(fmprb_radref(x)) < 0)
+    if (!mag_is_special(fmprb_radref(x)) &&
+        (MAG_MAN(fmprb_radref(x)) >> (MAG_BITS - 1)) != 1)
     {
-        printf("ABORT: nan or negative radius!\n");
+        printf("ABORT: radius not normalised!\n");
         abort();
     }
 #endif
 
     fmpr_clear(fmprb_midref(x));
-    fmpr_clear(fmprb_radref(x));
+    mag_clear(fmprb_radref(x));
 }
 
 static __inline__ fmprb_ptr
@@ -99,68 +103,68 @@ _fmprb_vec_clear(fmprb_ptr v, long n)
 static __inline__ int
 fmprb_is_exact(const fmprb_t x)
 {
-    return fmpr_is_zero(fmprb_radref(x));
+    return mag_is_zero(fmprb_radref(x));
 }
 
 static __inline__ int
 fmprb_equal(const fmprb_t x, const fmprb_t y)
 {
     return fmpr_equal(fmprb_midref(x), fmprb_midref(y)) &&
-            fmpr_equal(fmprb_radref(x), fmprb_radref(y));
+            mag_equal(fmprb_radref(x), fmprb_radref(y));
 }
 
 static __inline__ void
 fmprb_zero(fmprb_t x)
 {
     fmpr_zero(fmprb_midref(x));
-    fmpr_zero(fmprb_radref(x));
+    mag_zero(fmprb_radref(x));
 }
 
 static __inline__ int
 fmprb_is_zero(const fmprb_t x)
 {
-    return fmpr_is_zero(fmprb_midref(x)) && fmpr_is_zero(fmprb_radref(x));
+    return fmpr_is_zero(fmprb_midref(x)) && mag_is_zero(fmprb_radref(x));
 }
 
 static __inline__ void
 fmprb_pos_inf(fmprb_t x)
 {
     fmpr_pos_inf(fmprb_midref(x));
-    fmpr_zero(fmprb_radref(x));
+    mag_zero(fmprb_radref(x));
 }
 
 static __inline__ void
 fmprb_neg_inf(fmprb_t x)
 {
     fmpr_neg_inf(fmprb_midref(x));
-    fmpr_zero(fmprb_radref(x));
+    mag_zero(fmprb_radref(x));
 }
 
 static __inline__ void
 fmprb_zero_pm_inf(fmprb_t x)
 {
     fmpr_zero(fmprb_midref(x));
-    fmpr_pos_inf(fmprb_radref(x));
+    mag_inf(fmprb_radref(x));
 }
 
 static __inline__ void
 fmprb_indeterminate(fmprb_t x)
 {
     fmpr_nan(fmprb_midref(x));
-    fmpr_pos_inf(fmprb_radref(x));
+    mag_inf(fmprb_radref(x));
 }
 
 static __inline__ int
 fmprb_is_finite(const fmprb_t x)
 {
-    return fmpr_is_finite(fmprb_midref(x)) && fmpr_is_finite(fmprb_radref(x));
+    return fmpr_is_finite(fmprb_midref(x)) && mag_is_finite(fmprb_radref(x));
 }
 
 static __inline__ void
 fmprb_set(fmprb_t x, const fmprb_t y)
 {
     fmpr_set(fmprb_midref(x), fmprb_midref(y));
-    fmpr_set(fmprb_radref(x), fmprb_radref(y));
+    mag_set(fmprb_radref(x), fmprb_radref(y));
 }
 
 void fmprb_set_round(fmprb_t z, const fmprb_t x, long prec);
@@ -179,7 +183,7 @@ static __inline__ void
 fmprb_neg(fmprb_t x, const fmprb_t y)
 {
     fmpr_neg(fmprb_midref(x), fmprb_midref(y));
-    fmpr_set(fmprb_radref(x), fmprb_radref(y));
+    mag_set(fmprb_radref(x), fmprb_radref(y));
 }
 
 static __inline__ void
@@ -193,42 +197,42 @@ static __inline__ void
 fmprb_abs(fmprb_t x, const fmprb_t y)
 {
     fmpr_abs(fmprb_midref(x), fmprb_midref(y));
-    fmpr_set(fmprb_radref(x), fmprb_radref(y));
+    mag_set(fmprb_radref(x), fmprb_radref(y));
 }
 
 static __inline__ void
 fmprb_set_fmpr(fmprb_t x, const fmpr_t y)
 {
     fmpr_set(fmprb_midref(x), y);
-    fmpr_zero(fmprb_radref(x));
+    mag_zero(fmprb_radref(x));
 }
 
 static __inline__ void
 fmprb_set_si(fmprb_t x, long y)
 {
     fmpr_set_si(fmprb_midref(x), y);
-    fmpr_zero(fmprb_radref(x));
+    mag_zero(fmprb_radref(x));
 }
 
 static __inline__ void
 fmprb_set_ui(fmprb_t x, ulong y)
 {
     fmpr_set_ui(fmprb_midref(x), y);
-    fmpr_zero(fmprb_radref(x));
+    mag_zero(fmprb_radref(x));
 }
 
 static __inline__ void
 fmprb_set_fmpz(fmprb_t x, const fmpz_t y)
 {
     fmpr_set_fmpz(fmprb_midref(x), y);
-    fmpr_zero(fmprb_radref(x));
+    mag_zero(fmprb_radref(x));
 }
 
 static __inline__ void
 fmprb_set_fmpz_2exp(fmprb_t x, const fmpz_t y, const fmpz_t exp)
 {
     fmpr_set_fmpz_2exp(fmprb_midref(x), y, exp);
-    fmpr_zero(fmprb_radref(x));
+    mag_zero(fmprb_radref(x));
 }
 
 
@@ -236,20 +240,20 @@ static __inline__ void
 fmprb_set_round_fmpz_2exp(fmprb_t y, const fmpz_t x, const fmpz_t exp, long prec)
 {
     long r = fmpr_set_round_fmpz_2exp(fmprb_midref(y), x, exp, prec, FMPR_RND_DOWN);
-    fmpr_set_error_result(fmprb_radref(y), fmprb_midref(y), r);
+    mag_set_error_result(fmprb_radref(y), fmprb_midref(y), r);
 }
 
 static __inline__ void
 fmprb_set_round_fmpz(fmprb_t y, const fmpz_t x, long prec)
 {
     long r = fmpr_set_round_fmpz(fmprb_midref(y), x, prec, FMPR_RND_DOWN);
-    fmpr_set_error_result(fmprb_radref(y), fmprb_midref(y), r);
+    mag_set_error_result(fmprb_radref(y), fmprb_midref(y), r);
 }
 
 static __inline__ int
 fmprb_is_one(const fmprb_t f)
 {
-    return fmpr_is_one(fmprb_midref(f)) && fmpr_is_zero(fmprb_radref(f));
+    return fmpr_is_one(fmprb_midref(f)) && mag_is_zero(fmprb_radref(f));
 }
 
 static __inline__ void
@@ -404,10 +408,12 @@ void fmprb_agm(fmprb_t z, const fmprb_t x, const fmprb_t y, long prec);
 void fmprb_lgamma(fmprb_t y, const fmprb_t x, long prec);
 void fmprb_rgamma(fmprb_t y, const fmprb_t x, long prec);
 void fmprb_gamma(fmprb_t y, const fmprb_t x, long prec);
+void fmprb_gamma_vec(fmprb_ptr y, fmprb_srcptr x, long num, long prec);
 void fmprb_gamma_fmpq(fmprb_t y, const fmpq_t x, long prec);
 void fmprb_gamma_fmpz(fmprb_t y, const fmpz_t x, long prec);
 
 void fmprb_digamma(fmprb_t y, const fmprb_t x, long prec);
+void fmprb_polygamma(fmprb_t y, ulong m, const fmprb_t x, long prec);
 
 void fmprb_zeta(fmprb_t y, const fmprb_t s, long prec);
 void fmprb_zeta_ui(fmprb_t b, ulong n, long prec);
@@ -418,32 +424,33 @@ fmprb_print(const fmprb_t x)
 {
     fmpr_print(fmprb_midref(x));
     printf(" +/- ");
-    fmpr_print(fmprb_radref(x));
+    mag_print(fmprb_radref(x));
 }
 
+void fmprb_fprintd(FILE * file, const fmprb_t x, long digits);
+
 static __inline__ void
 fmprb_printd(const fmprb_t x, long digits)
 {
-    fmpr_printd(fmprb_midref(x), FLINT_ABS(digits));
-    if (digits > 0)
-    {
-        printf(" +/- ");
-        fmpr_printd(fmprb_radref(x), 5);
-    }
+    fmprb_fprintd(stdout, x, digits);
 }
 
+char * fmprb_get_str(const fmprb_t x, long digits);
+
+int fmprb_set_str(fmprb_t x, const char * s, long prec);
+
 static __inline__ void
 fmprb_mul_2exp_si(fmprb_t y, const fmprb_t x, long e)
 {
     fmpr_mul_2exp_si(fmprb_midref(y), fmprb_midref(x), e);
-    fmpr_mul_2exp_si(fmprb_radref(y), fmprb_radref(x), e);
+    mag_mul_2exp_si(fmprb_radref(y), fmprb_radref(x), e);
 }
 
 static __inline__ void
 fmprb_mul_2exp_fmpz(fmprb_t y, const fmprb_t x, const fmpz_t e)
 {
     fmpr_mul_2exp_fmpz(fmprb_midref(y), fmprb_midref(x), e);
-    fmpr_mul_2exp_fmpz(fmprb_radref(y), fmprb_radref(x), e);
+    mag_mul_2exp_fmpz(fmprb_radref(y), fmprb_radref(x), e);
 }
 
 static __inline__ void
@@ -466,7 +473,7 @@ int fmprb_contains(const fmprb_t x, const fmprb_t y);
 static __inline__ int
 fmprb_is_int(const fmprb_t x)
 {
-    return fmpr_is_zero(fmprb_radref(x)) &&
+    return mag_is_zero(fmprb_radref(x)) &&
            fmpr_is_int(fmprb_midref(x));
 }
 
@@ -480,7 +487,7 @@ static __inline__ int
 fmprb_is_positive(const fmprb_t x)
 {
     return (fmpr_sgn(fmprb_midref(x)) > 0) &&
-        (fmpr_cmpabs(fmprb_radref(x), fmprb_midref(x)) < 0) &&
+        (mag_cmpabs_fmpr(fmprb_radref(x), fmprb_midref(x)) < 0) &&
          !fmpr_is_nan(fmprb_midref(x));
 }
 
@@ -488,7 +495,7 @@ static __inline__ int
 fmprb_is_nonnegative(const fmprb_t x)
 {
     return (fmpr_sgn(fmprb_midref(x)) >= 0) &&
-        (fmpr_cmpabs(fmprb_radref(x), fmprb_midref(x)) <= 0) &&
+        (mag_cmpabs_fmpr(fmprb_radref(x), fmprb_midref(x)) <= 0) &&
          !fmpr_is_nan(fmprb_midref(x));
 }
 
@@ -496,7 +503,7 @@ static __inline__ int
 fmprb_is_negative(const fmprb_t x)
 {
     return (fmpr_sgn(fmprb_midref(x)) < 0) &&
-        (fmpr_cmpabs(fmprb_radref(x), fmprb_midref(x)) < 0) &&
+        (mag_cmpabs_fmpr(fmprb_radref(x), fmprb_midref(x)) < 0) &&
          !fmpr_is_nan(fmprb_midref(x));
 }
 
@@ -504,7 +511,7 @@ static __inline__ int
 fmprb_is_nonpositive(const fmprb_t x)
 {
     return (fmpr_sgn(fmprb_midref(x)) <= 0) &&
-        (fmpr_cmpabs(fmprb_radref(x), fmprb_midref(x)) <= 0) &&
+        (mag_cmpabs_fmpr(fmprb_radref(x), fmprb_midref(x)) <= 0) &&
          !fmpr_is_nan(fmprb_midref(x));
 }
 
@@ -512,7 +519,7 @@ static __inline__ int
 fmprb_contains_negative(const fmprb_t x)
 {
     return (fmpr_sgn(fmprb_midref(x)) < 0) ||
-        (fmpr_cmpabs(fmprb_radref(x), fmprb_midref(x)) > 0)
+        (mag_cmpabs_fmpr(fmprb_radref(x), fmprb_midref(x)) > 0)
         || fmpr_is_nan(fmprb_midref(x));
 }
 
@@ -520,7 +527,7 @@ static __inline__ int
 fmprb_contains_nonpositive(const fmprb_t x)
 {
     return (fmpr_sgn(fmprb_midref(x)) <= 0) ||
-        (fmpr_cmpabs(fmprb_radref(x), fmprb_midref(x)) >= 0)
+        (mag_cmpabs_fmpr(fmprb_radref(x), fmprb_midref(x)) >= 0)
         || fmpr_is_nan(fmprb_midref(x));
 }
 
@@ -528,7 +535,7 @@ static __inline__ int
 fmprb_contains_positive(const fmprb_t x)
 {
     return (fmpr_sgn(fmprb_midref(x)) > 0) ||
-        (fmpr_cmpabs(fmprb_radref(x), fmprb_midref(x)) > 0)
+        (mag_cmpabs_fmpr(fmprb_radref(x), fmprb_midref(x)) > 0)
         || fmpr_is_nan(fmprb_midref(x));
 }
 
@@ -536,36 +543,79 @@ static __inline__ int
 fmprb_contains_nonnegative(const fmprb_t x)
 {
     return (fmpr_sgn(fmprb_midref(x)) >= 0) ||
-        (fmpr_cmpabs(fmprb_radref(x), fmprb_midref(x)) >= 0)
+        (mag_cmpabs_fmpr(fmprb_radref(x), fmprb_midref(x)) >= 0)
         || fmpr_is_nan(fmprb_midref(x));
 }
 
 static __inline__ void
 fmprb_get_abs_ubound_fmpr(fmpr_t u, const fmprb_t x, long prec)
 {
+    fmpr_t t;
+    fmpr_init(t);
+    mag_get_fmpr(t, fmprb_radref(x));
+
     if (fmpr_sgn(fmprb_midref(x)) < 0)
-        fmpr_sub(u, fmprb_midref(x), fmprb_radref(x), prec, FMPR_RND_UP);
+        fmpr_sub(u, fmprb_midref(x), t, prec, FMPR_RND_UP);
     else
-        fmpr_add(u, fmprb_midref(x), fmprb_radref(x), prec, FMPR_RND_UP);
+        fmpr_add(u, fmprb_midref(x), t, prec, FMPR_RND_UP);
 
     fmpr_abs(u, u);
+    fmpr_clear(t);
 }
 
 static __inline__ void
 fmprb_get_abs_lbound_fmpr(fmpr_t u, const fmprb_t x, long prec)
 {
+    fmpr_t t;
+    fmpr_init(t);
+    mag_get_fmpr(t, fmprb_radref(x));
+
     if (fmpr_sgn(fmprb_midref(x)) > 0)
     {
-        fmpr_sub(u, fmprb_midref(x), fmprb_radref(x), prec, FMPR_RND_DOWN);
+        fmpr_sub(u, fmprb_midref(x), t, prec, FMPR_RND_DOWN);
     }
     else
     {
-        fmpr_add(u, fmprb_midref(x), fmprb_radref(x), prec, FMPR_RND_DOWN);
+        fmpr_add(u, fmprb_midref(x), t, prec, FMPR_RND_DOWN);
         fmpr_neg(u, u);
     }
 
     if (fmpr_sgn(u) < 0)
         fmpr_zero(u);
+
+    fmpr_clear(t);
+}
+
+static __inline__ void
+fmprb_get_ubound_fmpr(fmpr_t u, const fmprb_t x, long prec)
+{
+    fmpr_t t;
+    fmpr_init(t);
+    mag_get_fmpr(t, fmprb_radref(x));
+    fmpr_add(u, fmprb_midref(x), t, prec, FMPR_RND_CEIL);
+    fmpr_clear(t);
+}
+
+static __inline__ void
+fmprb_get_lbound_fmpr(fmpr_t u, const fmprb_t x, long prec)
+{
+    fmpr_t t;
+    fmpr_init(t);
+    mag_get_fmpr(t, fmprb_radref(x));
+    fmpr_sub(u, fmprb_midref(x), t, prec, FMPR_RND_FLOOR);
+    fmpr_clear(t);
+}
+
+static __inline__ void
+fmprb_get_rad_fmpr(fmpr_t r, const fmprb_t x)
+{
+    mag_get_fmpr(r, fmprb_radref(x));
+}
+
+static __inline__ void
+fmprb_set_rad_fmpr(fmprb_t x, const fmpr_t r)
+{
+    mag_set_fmpr(fmprb_radref(x), r);
 }
 
 void fmprb_get_interval_fmpz_2exp(fmpz_t a, fmpz_t b, fmpz_t exp, const fmprb_t x);
@@ -582,17 +632,16 @@ fmprb_rel_error_bits(const fmprb_t x)
     fmpz_t midmag, radmag;
     long result;
 
-    if (fmpr_is_zero(fmprb_radref(x)))
+    if (mag_is_zero(fmprb_radref(x)))
         return -FMPR_PREC_EXACT;
-    if (fmpr_is_special(fmprb_midref(x)) || fmpr_is_special(fmprb_radref(x)))
+    if (fmpr_is_special(fmprb_midref(x)) || mag_is_special(fmprb_radref(x)))
         return FMPR_PREC_EXACT;
 
     fmpz_init(midmag);
     fmpz_init(radmag);
 
     fmpr_abs_bound_lt_2exp_fmpz(midmag, fmprb_midref(x));
-    fmpr_abs_bound_lt_2exp_fmpz(radmag, fmprb_radref(x));
-    fmpz_add_ui(radmag, radmag, 1);
+    fmpz_add_ui(radmag, MAG_EXPREF(fmprb_radref(x)), 1);
 
     result = _fmpz_sub_small(radmag, midmag);
 
@@ -627,7 +676,51 @@ void fmprb_randtest_special(fmprb_t x, flint_rand_t state, long prec, long mag_b
 
 void fmprb_get_rand_fmpq(fmpq_t q, flint_rand_t state, const fmprb_t x, long bits);
 
+/*
+  Cached constants. The value of each constant is shared by all threads:
+  it is published through a pointer to an immutable value, so that reading
+  a constant never blocks, while recomputation at a higher precision is
+  done by one thread at a time (the locking is internal to
+  fmprb/cached_constant.c). Values that are replaced are kept until
+  fmprb_cached_constants_clear() is called, since other threads may still
+  be reading them; it is called at process exit (not by flint_cleanup()).
+
+  If FMPRB_CACHED_CONSTANT_TLS is defined, each thread additionally keeps
+  its own copy of the shared value together with its precision, so that
+  the shared cache is only consulted when a higher precision is needed;
+  the copy is freed by flint_cleanup() in that thread.
+*/
+
+typedef struct fmprb_cached_value_struct
+{
+    fmprb_struct value;
+    long prec;
+    struct fmprb_cached_value_struct * prev;
+}
+fmprb_cached_value_struct;
+
+typedef struct fmprb_cached_constant_struct
+{
+    fmprb_cached_value_struct * volatile current;
+    int busy;
+    struct fmprb_cached_constant_struct * next;
+}
+fmprb_cached_constant_struct;
+
+#define FMPRB_CACHED_CONSTANT_INIT { NULL, 0, NULL }
+
+void fmprb_cached_constant_get(fmprb_t x, fmprb_cached_constant_struct * c,
+    void (*comp_func)(fmprb_t, long), long prec);
+
+long fmprb_cached_constant_copy(fmprb_t x, fmprb_cached_constant_struct * c,
+    void (*comp_func)(fmprb_t, long), long prec);
+
+void fmprb_cached_constants_clear(void);
+
+#ifdef FMPRB_CACHED_CONSTANT_TLS
+
 #define DEF_CACHED_CONSTANT(name, comp_func) \
+    fmprb_cached_constant_struct name ## _cache = FMPRB_CACHED_CONSTANT_INIT; \
     TLS_PREFIX long name ## _cached_prec = 0; \
     TLS_PREFIX fmprb_t name ## _cached_value; \
     void name ## _cleanup(void) \
@@ -644,12 +737,23 @@ void fmprb_get_rand_fmpq(fmpq_t q, flint_rand_t state, const fmprb_t x, long bit
                 fmprb_init(name ## _cached_value); \
                 flint_register_cleanup_function(name ## _cleanup); \
             } \
-            comp_func(name ## _cached_value, prec); \
-            name ## _cached_prec = prec; \
+            name ## _cached_prec = fmprb_cached_constant_copy( \
+                name ## _cached_value, &name ## _cache, comp_func, prec); \
         } \
         fmprb_set_round(x, name ## _cached_value, prec); \
     }
 
+#else
+
+#define DEF_CACHED_CONSTANT(name, comp_func) \
+    fmprb_cached_constant_struct name ## _cache = FMPRB_CACHED_CONSTANT_INIT; \
+    void name(fmprb_t x, long prec) \
+    { \
+        fmprb_cached_constant_get(x, &name ## _cache, comp_func, prec); \
+    }
+
+#endif
+
 /* vector functions */
 
 static __inline__ void
@@ -841,7 +945,7 @@ _fmprb_vec_indeterminate(fmprb_ptr vec, long len)
     for (i = 0; i < len; i++)
     {
         fmpr_nan(fmprb_midref(vec + i));
-        fmpr_pos_inf(fmprb_radref(vec + i));
+        mag_inf(fmprb_radref(vec + i));
     }
 }
 
@@ -853,6 +957,14 @@ _fmprb_vec_trim(fmprb_ptr res, fmprb_srcptr vec, long len)
         fmprb_trim(res + i, vec + i);
 }
 
+void _fmprb_vec_dot(fmprb_t res, const fmprb_t initial, int subtract,
+    fmprb_srcptr x, long xstep, fmprb_srcptr y, long ystep, long len, long prec);
+
+void _fmprb_vec_dot2(fmprb_t res, const fmprb_t initial, int subtract,
+    fmprb_srcptr x, long xstep, fmprb_srcptr y, long ystep, long len,
+    fmprb_srcptr u, long ustep, fmprb_srcptr v, long vstep, int subtract2,
+    long len2, long prec);
+
 #ifdef __cplusplus
 }
 #endif
@@ -30,11 +30,10 @@ fmprb_add(fmprb_t z, const fmprb_t x, const fmprb_t y, long prec)
 {
     long r;
 
-    fmpr_add(fmprb_radref(z), fmprb_radref(x), fmprb_radref(y), FMPRB_RAD_PREC, FMPR_RND_UP);
+    mag_add(fmprb_radref(z), fmprb_radref(x), fmprb_radref(y));
     r = fmpr_add(fmprb_midref(z), fmprb_midref(x), fmprb_midref(y), prec, FMPR_RND_DOWN);
 
-    fmpr_add_error_result(fmprb_radref(z), fmprb_radref(z), fmprb_midref(z),
-        r, FMPRB_RAD_PREC, FMPR_RND_UP);
+    mag_add_error_result(fmprb_radref(z), fmprb_radref(z), fmprb_midref(z), r);
 
     fmprb_adjust(z);
 }
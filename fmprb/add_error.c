@@ -28,41 +28,39 @@
 void
 fmprb_add_error_fmpr(fmprb_t x, const fmpr_t err)
 {
-    fmpr_add(fmprb_radref(x), fmprb_radref(x), err, FMPRB_RAD_PREC, FMPR_RND_UP);
+    mag_t t;
+    mag_init(t);
+    mag_set_fmpr(t, err);
+    mag_add(fmprb_radref(x), fmprb_radref(x), t);
+    mag_clear(t);
 }
 
 void
 fmprb_add_error_2exp_si(fmprb_t x, long err)
 {
-    fmpr_t t;
-    fmpr_init(t);
-    fmpr_set_ui_2exp_si(t, 1, err);
-    fmprb_add_error_fmpr(x, t);
-    fmpr_clear(t);
+    mag_t t;
+    mag_init(t);
+    mag_one(t);
+    mag_mul_2exp_si(t, t, err);
+    mag_add(fmprb_radref(x), fmprb_radref(x), t);
+    mag_clear(t);
 }
 
 void
 fmprb_add_error_2exp_fmpz(fmprb_t x, const fmpz_t err)
 {
-    fmpr_t t;
-    fmpr_init(t);
-    fmpz_one(fmpr_manref(t));
-    fmpz_set(fmpr_expref(t), err);
-    fmprb_add_error_fmpr(x, t);
-    fmpr_clear(t);
+    mag_add_2exp_fmpz(fmprb_radref(x), fmprb_radref(x), err);
 }
 
 void
 fmprb_add_error(fmprb_t x, const fmprb_t error)
 {
-    fmpr_t high;
-    fmpr_init(high);
+    mag_t high;
+    mag_init(high);
 
-    fmpr_add(high, fmprb_midref(error), fmprb_radref(error),
-        FMPRB_RAD_PREC, FMPR_RND_UP);
+    mag_set_fmpr(high, fmprb_midref(error));
+    mag_add(high, high, fmprb_radref(error));
+    mag_add(fmprb_radref(x), fmprb_radref(x), high);
 
-    fmpr_add(fmprb_radref(x), fmprb_radref(x), high,
-        FMPRB_RAD_PREC, FMPR_RND_UP);
-
-    fmpr_clear(high);
+    mag_clear(high);
 }
@@ -61,7 +61,7 @@ fmprb_asin(fmprb_t z, const fmprb_t x, long prec)
         else if (side > 0)
         {
             fmpr_nan(fmprb_midref(z));
-            fmpr_pos_inf(fmprb_radref(z));
+            mag_inf(fmprb_radref(z));
             return;
         }
     }
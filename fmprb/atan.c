@@ -24,6 +24,7 @@
 ******************************************************************************/
 
 #include "fmprb.h"
+#include "elefun.h"
 
 static long
 _fmpr_atan(fmpr_t y, const fmpr_t x, long prec, fmpr_rnd_t rnd)
@@ -45,7 +46,7 @@ fmprb_atan_fmpr(fmprb_t z, const fmpr_t x, long prec)
         else if (fmpr_is_nan(x))
         {
             fmpr_nan(fmprb_midref(z));
-            fmpr_pos_inf(fmprb_radref(z));
+            mag_inf(fmprb_radref(z));
         }
         else if (fmpr_is_pos_inf(x))
         {
@@ -95,10 +96,11 @@ fmprb_atan_fmpr(fmprb_t z, const fmpr_t x, long prec)
             fmprb_mul_2exp_si(z, z, -1);
             fmprb_add_error_2exp_fmpz(z, mag);
         }
-        else
+        /* use the table-based fixed-point code at low precision */
+        else if (!elefun_atan_precomp(z, x, prec))
         {
             r = _fmpr_atan(fmprb_midref(z), x, prec, FMPR_RND_DOWN);
-            fmpr_set_error_result(fmprb_radref(z), fmprb_midref(z), r);
+            mag_set_error_result(fmprb_radref(z), fmprb_midref(z), r);
         }
 
         fmpz_clear(mag);
@@ -119,13 +121,15 @@ fmprb_atan(fmprb_t z, const fmprb_t x, long prec)
         fmpr_init(t);
         fmpr_init(u);
 
+        fmprb_get_rad_fmpr(u, x);
+
         if (fmpr_sgn(fmprb_midref(x)) >= 0)
         {
-            fmpr_sub(t, fmprb_midref(x), fmprb_radref(x), FMPRB_RAD_PREC, FMPR_RND_DOWN);
+            fmpr_sub(t, fmprb_midref(x), u, FMPRB_RAD_PREC, FMPR_RND_DOWN);
         }
         else
         {
-            fmpr_add(t, fmprb_midref(x), fmprb_radref(x), FMPRB_RAD_PREC, FMPR_RND_DOWN);
+            fmpr_add(t, fmprb_midref(x), u, FMPRB_RAD_PREC, FMPR_RND_DOWN);
             fmpr_neg(t, t);
         }
 
@@ -133,15 +137,15 @@ fmprb_atan(fmprb_t z, const fmprb_t x, long prec)
         {
             fmpr_mul(t, t, t, FMPRB_RAD_PREC, FMPR_RND_DOWN);
             fmpr_add_ui(t, t, 1UL, FMPRB_RAD_PREC, FMPR_RND_DOWN);
-            fmpr_divappr_abs_ubound(t, fmprb_radref(x), t, FMPRB_RAD_PREC);
+            fmpr_divappr_abs_ubound(t, u, t, FMPRB_RAD_PREC);
         }
         else
         {
-            fmpr_set(t, fmprb_radref(x));
+            fmpr_set(t, u);
         }
 
         fmprb_atan_fmpr(z, fmprb_midref(x), prec);
-        fmpr_add(fmprb_radref(z), fmprb_radref(z), t, FMPRB_RAD_PREC, FMPR_RND_UP);
+        fmprb_add_error_fmpr(z, t);
 
         fmpr_clear(t);
         fmpr_clear(u);
@@ -43,12 +43,12 @@ fmprb_atan2(fmprb_t r, const fmprb_t b, const fmprb_t a, long prec)
             fmprb_zero(r);
         }
         /* interval contains only nonnegative numbers */
-        else if (fmpr_sgn(am) > 0 && fmpr_cmpabs(am, ar) >= 0)
+        else if (fmpr_sgn(am) > 0 && mag_cmpabs_fmpr(ar, am) <= 0)
         {
             fmprb_zero(r);
         }
         /* interval contains only negative numbers */
-        else if (fmpr_sgn(am) < 0 && fmpr_cmpabs(am, ar) > 0)
+        else if (fmpr_sgn(am) < 0 && mag_cmpabs_fmpr(ar, am) < 0)
         {
             fmprb_const_pi(r, prec);
         }
@@ -68,13 +68,13 @@ fmprb_atan2(fmprb_t r, const fmprb_t b, const fmprb_t a, long prec)
     else if (fmprb_is_zero(a))
     {
         /* interval contains only positive numbers */
-        if (fmpr_sgn(bm) > 0 && fmpr_cmpabs(bm, br) > 0)
+        if (fmpr_sgn(bm) > 0 && mag_cmpabs_fmpr(br, bm) < 0)
         {
             fmprb_const_pi(r, prec);
             fmprb_mul_2exp_si(r, r, -1);
         }
         /* interval contains only negative numbers */
-        else if (fmpr_sgn(bm) < 0 && fmpr_cmpabs(bm, br) > 0)
+        else if (fmpr_sgn(bm) < 0 && mag_cmpabs_fmpr(br, bm) < 0)
         {
             fmprb_const_pi(r, prec);
             fmprb_neg(r, r);
@@ -93,13 +93,13 @@ fmprb_atan2(fmprb_t r, const fmprb_t b, const fmprb_t a, long prec)
         }
     }
     /* strictly in the right half-plane -- atan(b/a) */
-    else if (fmpr_sgn(am) > 0 && fmpr_cmpabs(am, ar) > 0)
+    else if (fmpr_sgn(am) > 0 && mag_cmpabs_fmpr(ar, am) < 0)
     {
         fmprb_div(r, b, a, prec);
         fmprb_atan(r, r, prec);
     }
     /* strictly in the upper half-plane -- pi/2 - atan(a/b) */
-    else if (fmpr_sgn(bm) > 0 && fmpr_cmpabs(bm, br) > 0)
+    else if (fmpr_sgn(bm) > 0 && mag_cmpabs_fmpr(br, bm) < 0)
     {
         fmprb_t t;
         fmprb_init(t);
@@ -111,7 +111,7 @@ fmprb_atan2(fmprb_t r, const fmprb_t b, const fmprb_t a, long prec)
         fmprb_clear(t);
     }
     /* strictly in the lower half-plane -- -pi/2 - atan(a/b) */
-    else if (fmpr_sgn(bm) < 0 && fmpr_cmpabs(bm, br) > 0)
+    else if (fmpr_sgn(bm) < 0 && mag_cmpabs_fmpr(br, bm) < 0)
     {
         fmprb_t t;
         fmprb_init(t);
@@ -0,0 +1,174 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include <pthread.h>
+#include <stdlib.h>
+#include "fmprb.h"
+
+/*
+Readers load the current pointer without locking. A full memory barrier
+between computing a value and publishing the pointer (and between loading
+the pointer and reading the value) guarantees that a reader sees the
+complete value. Without compiler support for barriers, readers take the
+lock instead.
+
+A single mutex protects all constants, but it is not held while a value
+is computed, since computing one constant may require another one.
+Instead, the constant is marked as busy, and other threads that need a
+higher precision of the same constant wait for the result.
+*/
+#if defined(__GNUC__)
+#define MEMORY_BARRIER() __sync_synchronize()
+#define HAVE_MEMORY_BARRIER 1
+#else
+#define MEMORY_BARRIER()
+#define HAVE_MEMORY_BARRIER 0
+#endif
+
+static pthread_mutex_t fmprb_cached_constants_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t fmprb_cached_constants_cond = PTHREAD_COND_INITIALIZER;
+
+/* list of all constants that have been computed */
+static fmprb_cached_constant_struct * fmprb_cached_constants = NULL;
+
+/* set once fmprb_cached_constants_clear has been passed to atexit */
+static int fmprb_cached_constants_atexit_registered = 0;
+
+/* returns a shared value computed to at least prec bits */
+static const fmprb_cached_value_struct *
+_fmprb_cached_constant_lookup(fmprb_cached_constant_struct * c,
+    void (*comp_func)(fmprb_t, long), long prec)
+{
+    fmprb_cached_value_struct * v, * w;
+    long wp;
+
+#if HAVE_MEMORY_BARRIER
+    v = c->current;
+    MEMORY_BARRIER();
+
+    if (v == NULL || v->prec < prec)
+#endif
+    {
+        pthread_mutex_lock(&fmprb_cached_constants_lock);
+
+        while (c->busy && ((v = c->current) == NULL || v->prec < prec))
+            pthread_cond_wait(&fmprb_cached_constants_cond,
+                &fmprb_cached_constants_lock);
+
+        v = c->current;
+
+        if (v == NULL || v->prec < prec)
+        {
+            /* increase the precision geometrically, which bounds the total
+               size of replaced values that have to be kept */
+            if (v == NULL)
+                wp = prec;
+            else
+                wp = FLINT_MAX(prec, v->prec + v->prec / 2);
+
+            c->busy = 1;
+            pthread_mutex_unlock(&fmprb_cached_constants_lock);
+
+            w = flint_malloc(sizeof(fmprb_cached_value_struct));
+            fmprb_init(&w->value);
+            comp_func(&w->value, wp);
+            w->prec = wp;
+            w->prev = v;
+
+            pthread_mutex_lock(&fmprb_cached_constants_lock);
+
+            if (v == NULL)
+            {
+                c->next = fmprb_cached_constants;
+                fmprb_cached_constants = c;
+            }
+
+            MEMORY_BARRIER();
+            c->current = w;
+            c->busy = 0;
+            v = w;
+
+            /* flint_cleanup() in the computing thread, which may be a
+               worker of the thread pool, must not free the shared values */
+            if (!fmprb_cached_constants_atexit_registered)
+            {
+                atexit(fmprb_cached_constants_clear);
+                fmprb_cached_constants_atexit_registered = 1;
+            }
+
+            pthread_cond_broadcast(&fmprb_cached_constants_cond);
+        }
+
+        pthread_mutex_unlock(&fmprb_cached_constants_lock);
+    }
+
+    return v;
+}
+
+void
+fmprb_cached_constant_get(fmprb_t x, fmprb_cached_constant_struct * c,
+    void (*comp_func)(fmprb_t, long), long prec)
+{
+    const fmprb_cached_value_struct * v;
+
+    v = _fmprb_cached_constant_lookup(c, comp_func, prec);
+    fmprb_set_round(x, &v->value, prec);
+}
+
+long
+fmprb_cached_constant_copy(fmprb_t x, fmprb_cached_constant_struct * c,
+    void (*comp_func)(fmprb_t, long), long prec)
+{
+    const fmprb_cached_value_struct * v;
+
+    v = _fmprb_cached_constant_lookup(c, comp_func, prec);
+    fmprb_set(x, &v->value);
+    return v->prec;
+}
+
+void
+fmprb_cached_constants_clear(void)
+{
+    fmprb_cached_constant_struct * c;
+    fmprb_cached_value_struct * v, * w;
+
+    pthread_mutex_lock(&fmprb_cached_constants_lock);
+
+    for (c = fmprb_cached_constants; c != NULL; c = c->next)
+    {
+        for (v = c->current; v != NULL; v = w)
+        {
+            w = v->prev;
+            fmprb_clear(&v->value);
+            flint_free(v);
+        }
+
+        c->current = NULL;
+    }
+
+    fmprb_cached_constants = NULL;
+
+    pthread_mutex_unlock(&fmprb_cached_constants_lock);
+}
@@ -25,6 +25,7 @@
 
 #include "zeta.h"
 #include "hypgeom.h"
+#include "bsplit.h"
 
 typedef struct
 {
@@ -58,45 +59,63 @@ static void euler_bsplit_clear(euler_bsplit_t s)
     fmprb_clear(s->V);
 }
 
+/* sets s to the combination of L and R; s may be aliased with L.
+   The independent multiplications are done in parallel */
 static void
 euler_bsplit_1_merge(euler_bsplit_t s, euler_bsplit_t L, euler_bsplit_t R,
-                    long wp, int cont)
+                    long wp, int cont, long num_threads)
 {
-    fmprb_t t, u, v;
+    fmprb_t u[10];
+    fmprb_ptr z[9];
+    fmprb_srcptr x[9], y[9];
+    long i, n;
+
+    for (i = 0; i < 10; i++)
+        fmprb_init(u[i]);
+
+    for (i = 0; i < 9; i++)
+        z[i] = u[i];
+
+    x[0] = L->Q; y[0] = R->Q;
+    x[1] = L->D; y[1] = R->D;
+    x[2] = L->P; y[2] = R->T;
+    x[3] = R->Q; y[3] = L->T;
+    x[4] = L->P; y[4] = R->V;
+    x[5] = R->Q; y[5] = L->V;
+    x[6] = L->P; y[6] = R->P;
+    x[7] = L->C; y[7] = R->D;
+    x[8] = R->C; y[8] = L->D;
+    n = cont ? 9 : 6;
+
+    bsplit_fmprb_mul_batch(z, x, y, n, wp, num_threads);
 
-    fmprb_init(t);
-    fmprb_init(u);
-    fmprb_init(v);
+    /* V = RD (RQ LV + LC LP RT) + LD LP RV */
+    z[0] = u[4]; x[0] = u[4]; y[0] = L->D;
+    z[1] = u[9]; x[1] = u[2]; y[1] = L->C;
 
-    if (cont)
-        fmprb_mul(s->P, L->P, R->P, wp);
+    bsplit_fmprb_mul_batch(z, x, y, 2, wp, num_threads);
+
+    fmprb_add(u[5], u[5], u[9], wp);
+    fmprb_mul(u[5], u[5], R->D, wp);
 
-    fmprb_mul(s->Q, L->Q, R->Q, wp);
-    fmprb_mul(s->D, L->D, R->D, wp);
+    /* all inputs have been read, so s can be written */
+    fmprb_add(s->V, u[4], u[5], wp);
 
     /* T = LP RT + RQ LT*/
-    fmprb_mul(t, L->P, R->T, wp);
-    fmprb_mul(v, R->Q, L->T, wp);
-    fmprb_add(s->T, t, v, wp);
+    fmprb_add(s->T, u[2], u[3], wp);
+
+    fmprb_swap(s->Q, u[0]);
+    fmprb_swap(s->D, u[1]);
 
     /* C = LC RD + RC LD */
     if (cont)
     {
-        fmprb_mul(s->C, L->C, R->D, wp);
-        fmprb_addmul(s->C, R->C, L->D, wp);
+        fmprb_swap(s->P, u[6]);
+        fmprb_add(s->C, u[7], u[8], wp);
     }
 
-    /* V = RD (RQ LV + LC LP RT) + LD LP RV */
-    fmprb_mul(u, L->P, R->V, wp);
-    fmprb_mul(u, u, L->D, wp);
-    fmprb_mul(v, R->Q, L->V, wp);
-    fmprb_addmul(v, t, L->C, wp);
-    fmprb_mul(v, v, R->D, wp);
-    fmprb_add(s->V, u, v, wp);
-
-    fmprb_clear(t);
-    fmprb_clear(u);
-    fmprb_clear(v);
+    for (i = 0; i < 10; i++)
+        fmprb_clear(u[i]);
 }
 
 void
@@ -122,12 +141,46 @@ euler_bsplit_1(euler_bsplit_t s, long n1, long n2, long N, long wp, int cont)
         euler_bsplit_init(R);
         euler_bsplit_1(L, n1, m, N, wp, 1);
         euler_bsplit_1(R, m, n2, N, wp, 1);
-        euler_bsplit_1_merge(s, L, R, wp, cont);
+        euler_bsplit_1_merge(s, L, R, wp, cont, 1);
         euler_bsplit_clear(L);
         euler_bsplit_clear(R);
     }
 }
 
+/* sets (P, Q, T) to the combination of (P, Q, T) and (P2, Q2, T2) */
+static void
+euler_bsplit_2_merge(fmprb_t P, fmprb_t Q, fmprb_t T,
+    const fmprb_t P2, const fmprb_t Q2, const fmprb_t T2,
+    long wp, int cont, long num_threads)
+{
+    fmprb_t u[4];
+    fmprb_ptr z[4];
+    fmprb_srcptr x[4], y[4];
+    long i;
+
+    for (i = 0; i < 4; i++)
+    {
+        fmprb_init(u[i]);
+        z[i] = u[i];
+    }
+
+    x[0] = T; y[0] = Q2;
+    x[1] = T2; y[1] = P;
+    x[2] = Q; y[2] = Q2;
+    x[3] = P; y[3] = P2;
+
+    bsplit_fmprb_mul_batch(z, x, y, cont ? 4 : 3, wp, num_threads);
+
+    fmprb_add(T, u[0], u[1], wp);
+    fmprb_swap(Q, u[2]);
+
+    if (cont)
+        fmprb_swap(P, u[3]);
+
+    for (i = 0; i < 4; i++)
+        fmprb_clear(u[i]);
+}
+
 void
 euler_bsplit_2(fmprb_t P, fmprb_t Q, fmprb_t T, long n1, long n2,
                         long N, long wp, int cont)
@@ -163,15 +216,7 @@ euler_bsplit_2(fmprb_t P, fmprb_t Q, fmprb_t T, long n1, long n2,
 
         euler_bsplit_2(P, Q, T, n1, m, N, wp, 1);
         euler_bsplit_2(P2, Q2, T2, m, n2, N, wp, 1);
-
-        fmprb_mul(T, T, Q2, wp);
-        fmprb_mul(T2, T2, P, wp);
-        fmprb_add(T, T, T2, wp);
-
-        if (cont)
-            fmprb_mul(P, P, P2, wp);
-
-        fmprb_mul(Q, Q, Q2, wp);
+        euler_bsplit_2_merge(P, Q, T, P2, Q2, T2, wp, cont, 1);
 
         fmprb_clear(P2);
         fmprb_clear(Q2);
@@ -179,6 +224,83 @@ euler_bsplit_2(fmprb_t P, fmprb_t Q, fmprb_t T, long n1, long n2,
     }
 }
 
+/* adapters for evaluating the top levels of the binary splitting
+   in parallel; the state for the second sum is a vector (P, Q, T) */
+typedef struct
+{
+    long N;
+    long wp;
+}
+euler_bsplit_arg_t;
+
+static void
+_euler_bsplit_1_init(void * s, void * args)
+{
+    euler_bsplit_init(s);
+}
+
+static void
+_euler_bsplit_1_clear(void * s, void * args)
+{
+    euler_bsplit_clear(s);
+}
+
+static void
+_euler_bsplit_1_basecase(void * s, long a, long b, int cont, void * args)
+{
+    euler_bsplit_arg_t * arg = args;
+    euler_bsplit_1(s, a, b, arg->N, arg->wp, cont);
+}
+
+static void
+_euler_bsplit_1_merge(void * L, void * R, long a, long m, long b,
+    int cont, long num_threads, void * args)
+{
+    euler_bsplit_arg_t * arg = args;
+    euler_bsplit_1_merge(L, L, R, arg->wp, cont, num_threads);
+}
+
+static void
+_euler_bsplit_2_init(void * s, void * args)
+{
+    fmprb_ptr v = s;
+
+    fmprb_init(v);
+    fmprb_init(v + 1);
+    fmprb_init(v + 2);
+}
+
+static void
+_euler_bsplit_2_clear(void * s, void * args)
+{
+    fmprb_ptr v = s;
+
+    fmprb_clear(v);
+    fmprb_clear(v + 1);
+    fmprb_clear(v + 2);
+}
+
+static void
+_euler_bsplit_2_basecase(void * s, long a, long b, int cont, void * args)
+{
+    euler_bsplit_arg_t * arg = args;
+    fmprb_ptr v = s;
+
+    euler_bsplit_2(v, v + 1, v + 2, a, b, arg->N, arg->wp, cont);
+}
+
+static void
+_euler_bsplit_2_merge(void * L, void * R, long a, long m, long b,
+    int cont, long num_threads, void * args)
+{
+    euler_bsplit_arg_t * arg = args;
+    fmprb_ptr v = L;
+    fmprb_ptr w = R;
+
+    euler_bsplit_2_merge(v, v + 1, v + 2, w, w + 1, w + 2,
+        arg->wp, cont, num_threads);
+}
+
 static void
 atanh_bsplit(fmprb_t s, ulong c, long a, long prec)
 {
@@ -250,7 +372,10 @@ void
 fmprb_const_euler_eval(fmprb_t res, long prec)
 {
     euler_bsplit_t sum;
-    fmprb_t t, u, v, P2, T2, Q2;
+    euler_bsplit_arg_t arg;
+    bsplit_t B;
+    fmprb_struct S2[3];
+    fmprb_t t, u, v;
     long bits, wp, wp2, n, N, M;
 
     bits = prec + 10;
@@ -287,15 +412,23 @@ fmprb_const_euler_eval(fmprb_t res, long prec)
     wp2 = bits/2 + 2 * FLINT_BIT_COUNT(n);
 
     euler_bsplit_init(sum);
-    fmprb_init(P2);
-    fmprb_init(T2);
-    fmprb_init(Q2);
+    _euler_bsplit_2_init(S2, NULL);
     fmprb_init(t);
     fmprb_init(u);
     fmprb_init(v);
 
     /* Compute S0 = V / (Q D), I0 = 1 + T / Q */
-    euler_bsplit_1(sum, 0, N, n, wp, 0);
+    arg.N = n;
+    arg.wp = wp;
+
+    B->size = sizeof(euler_bsplit_struct);
+    B->init = _euler_bsplit_1_init;
+    B->clear = _euler_bsplit_1_clear;
+    B->basecase = _euler_bsplit_1_basecase;
+    B->merge = _euler_bsplit_1_merge;
+    B->args = &arg;
+
+    bsplit_eval(sum, B, 0, N, 0, flint_get_num_threads());
 
     /* I0 = T / Q */
     fmprb_add(sum->T, sum->T, sum->Q, wp);
@@ -305,15 +438,23 @@ fmprb_const_euler_eval(fmprb_t res, long prec)
     fmprb_div(res, sum->V, t, wp);
 
     /* Compute K0 (actually I_0(2n) K_0(2n)) = T2 / Q2 */
-    euler_bsplit_2(P2, Q2, T2, 0, M, n, wp2, 0);
+    arg.wp = wp2;
+
+    B->size = 3 * sizeof(fmprb_struct);
+    B->init = _euler_bsplit_2_init;
+    B->clear = _euler_bsplit_2_clear;
+    B->basecase = _euler_bsplit_2_basecase;
+    B->merge = _euler_bsplit_2_merge;
+
+    bsplit_eval(S2, B, 0, M, 0, flint_get_num_threads());
 
     /* Compute K0 / I^2 = Q^2 * T2 / (Q2 * T^2) */
     fmprb_set_round(t, sum->Q, wp2);
     fmprb_mul(t, t, t, wp2);
-    fmprb_mul(t, t, T2, wp2);
+    fmprb_mul(t, t, S2 + 2, wp2);
     fmprb_set_round(u, sum->T, wp2);
     fmprb_mul(u, u, u, wp2);
-    fmprb_mul(u, u, Q2, wp2);
+    fmprb_mul(u, u, S2 + 1, wp2);
     fmprb_div(t, t, u, wp2);
 
     fmprb_sub(res, res, t, wp);
@@ -333,9 +474,7 @@ fmprb_const_euler_eval(fmprb_t res, long prec)
         fmpr_clear(b);
     }
 
-    fmprb_clear(P2);
-    fmprb_clear(T2);
-    fmprb_clear(Q2);
+    _euler_bsplit_2_clear(S2, NULL);
     fmprb_clear(t);
     fmprb_clear(u);
     fmprb_clear(v);
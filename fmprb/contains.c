@@ -28,8 +28,7 @@
 int
 fmprb_contains(const fmprb_t x, const fmprb_t y)
 {
-    fmpr_t t;
-    fmpr_t u;
+    fmpr_t t, u, xr, yr;
     fmpr_struct tmp[4];
     int left_ok, right_ok;
 
@@ -41,10 +40,15 @@ fmprb_contains(const fmprb_t x, const fmprb_t y)
 
     fmpr_init(t);
     fmpr_init(u);
+    fmpr_init(xr);
+    fmpr_init(yr);
+
+    mag_get_fmpr(xr, fmprb_radref(x));
+    mag_get_fmpr(yr, fmprb_radref(y));
 
     /* fast check */
-    fmpr_sub(t, fmprb_midref(x), fmprb_radref(x), 30, FMPR_RND_CEIL);
-    fmpr_sub(u, fmprb_midref(y), fmprb_radref(y), 30, FMPR_RND_FLOOR);
+    fmpr_sub(t, fmprb_midref(x), xr, 30, FMPR_RND_CEIL);
+    fmpr_sub(u, fmprb_midref(y), yr, 30, FMPR_RND_FLOOR);
     left_ok = fmpr_cmp(t, u) <= 0;
 
     /* exact check */
@@ -56,9 +60,9 @@ fmprb_contains(const fmprb_t x, const fmprb_t y)
         fmpr_init(tmp + 3);
 
         fmpr_set(tmp + 0, fmprb_midref(x));
-        fmpr_neg(tmp + 1, fmprb_radref(x));
+        fmpr_neg(tmp + 1, xr);
         fmpr_neg(tmp + 2, fmprb_midref(y));
-        fmpr_set(tmp + 3, fmprb_radref(y));
+        fmpr_set(tmp + 3, yr);
 
         fmpr_sum(t, tmp, 4, 30, FMPR_RND_DOWN);
         left_ok = fmpr_sgn(t) <= 0;
@@ -70,8 +74,8 @@ fmprb_contains(const fmprb_t x, const fmprb_t y)
     }
 
     /* fast check */
-    fmpr_add(t, fmprb_midref(x), fmprb_radref(x), 30, FMPR_RND_FLOOR);
-    fmpr_add(u, fmprb_midref(y), fmprb_radref(y), 30, FMPR_RND_CEIL);
+    fmpr_add(t, fmprb_midref(x), xr, 30, FMPR_RND_FLOOR);
+    fmpr_add(u, fmprb_midref(y), yr, 30, FMPR_RND_CEIL);
     right_ok = (fmpr_cmp(t, u) >= 0);
 
     /* exact check */
@@ -83,9 +87,9 @@ fmprb_contains(const fmprb_t x, const fmprb_t y)
         fmpr_init(tmp + 3);
 
         fmpr_set(tmp + 0, fmprb_midref(x));
-        fmpr_set(tmp + 1, fmprb_radref(x));
+        fmpr_set(tmp + 1, xr);
         fmpr_neg(tmp + 2, fmprb_midref(y));
-        fmpr_neg(tmp + 3, fmprb_radref(y));
+        fmpr_neg(tmp + 3, yr);
 
         fmpr_sum(t, tmp, 4, 30, FMPR_RND_DOWN);
         right_ok = fmpr_sgn(t) >= 0;
@@ -98,6 +102,8 @@ fmprb_contains(const fmprb_t x, const fmprb_t y)
 
     fmpr_clear(t);
     fmpr_clear(u);
+    fmpr_clear(xr);
+    fmpr_clear(yr);
 
     return left_ok && right_ok;
 }
@@ -53,7 +53,8 @@ fmprb_contains_fmpr(const fmprb_t x, const fmpr_t y)
 
         /* y >= xm - xr  <=>  0 >= xm - xr - y */
         fmpr_set(tmp + 0, fmprb_midref(x));
-        fmpr_neg(tmp + 1, fmprb_radref(x));
+        mag_get_fmpr(tmp + 1, fmprb_radref(x));
+        fmpr_neg(tmp + 1, tmp + 1);
         fmpr_neg(tmp + 2, y);
         fmpr_sum(t, tmp, 3, 30, FMPR_RND_DOWN);
         result = (fmpr_sgn(t) <= 0);
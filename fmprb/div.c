@@ -29,7 +29,7 @@ static __inline__ void
 fmprb_div_zero(fmprb_t z)
 {
     fmpr_zero(fmprb_midref(z));
-    fmpr_pos_inf(fmprb_radref(z));
+    mag_inf(fmprb_radref(z));
     return;
 }
 
@@ -45,23 +45,28 @@ fmprb_div_fmpr(fmprb_t z, const fmprb_t x, const fmpr_t y, long prec)
     else if (fmprb_is_exact(x))
     {
         r = fmpr_div(fmprb_midref(z), fmprb_midref(x), y, prec, FMPR_RND_DOWN);
-        fmpr_set_error_result(fmprb_radref(z), fmprb_midref(z), r);
+        mag_set_error_result(fmprb_radref(z), fmprb_midref(z), r);
     }
-    else if (fmpr_is_pos_inf(fmprb_radref(x)))
+    else if (mag_is_inf(fmprb_radref(x)))
     {
         fmpr_div(fmprb_midref(z), fmprb_midref(x), y, prec, FMPR_RND_DOWN);
-        fmpr_pos_inf(fmprb_radref(z));
+        mag_inf(fmprb_radref(z));
     }
     else
     {
         /* (x + a) / y = x/y + a/y */
 
-        fmpr_divappr_abs_ubound(fmprb_radref(z), fmprb_radref(x), y, FMPRB_RAD_PREC);
-        fmpr_abs(fmprb_radref(z), fmprb_radref(z));
+        fmpr_t t;
+        fmpr_init(t);
+
+        fmprb_get_rad_fmpr(t, x);
+        fmpr_divappr_abs_ubound(t, t, y, FMPRB_RAD_PREC);
+        mag_set_fmpr(fmprb_radref(z), t);
+
+        r = fmpr_div(fmprb_midref(z), fmprb_midref(x), y, prec, FMPR_RND_DOWN);
+        mag_add_error_result(fmprb_radref(z), fmprb_radref(z), fmprb_midref(z), r);
 
-        r = fmpr_div(fmprb_midref(z), fmprb_midref(x), y, prec, FMPR_RND_DOWN); 
-        fmpr_add_error_result(fmprb_radref(z), fmprb_radref(z),
-            fmprb_midref(z), r, FMPRB_RAD_PREC, FMPR_RND_UP);
+        fmpr_clear(t);
     }
 }
 
@@ -74,33 +79,38 @@ fmprb_div(fmprb_t z, const fmprb_t x, const fmprb_t y, long prec)
     {
         fmprb_div_fmpr(z, x, fmprb_midref(y), prec);
     }
-    else if (fmpr_is_pos_inf(fmprb_radref(x)) || fmpr_is_pos_inf(fmprb_radref(y)))
+    else if (mag_is_inf(fmprb_radref(x)) || mag_is_inf(fmprb_radref(y)))
     {
         fmpr_div(fmprb_midref(z), fmprb_midref(x), fmprb_midref(y), prec, FMPR_RND_DOWN);
-        fmpr_pos_inf(fmprb_radref(z));
+        mag_inf(fmprb_radref(z));
     }
     else
     {
-        fmpr_t t, u;
+        fmpr_t t, u, xr, yr;
 
         fmpr_init(t);
         fmpr_init(u);
+        fmpr_init(xr);
+        fmpr_init(yr);
+
+        fmprb_get_rad_fmpr(xr, x);
+        fmprb_get_rad_fmpr(yr, y);
 
         /* numerator of error bound: |xb| + |ya|, rounded up */
-        fmpr_mul(t, fmprb_midref(x), fmprb_radref(y), FMPRB_RAD_PREC, FMPR_RND_UP);
+        fmpr_mul(t, fmprb_midref(x), yr, FMPRB_RAD_PREC, FMPR_RND_UP);
         fmpr_abs(t, t);
-        fmpr_mul(u, fmprb_midref(y), fmprb_radref(x), FMPRB_RAD_PREC, FMPR_RND_UP);
+        fmpr_mul(u, fmprb_midref(y), xr, FMPRB_RAD_PREC, FMPR_RND_UP);
         fmpr_abs(u, u);
         fmpr_add(t, t, u, FMPRB_RAD_PREC, FMPR_RND_UP);
 
         /* denominator of error bound: |y|(|y|-b), rounded down */
         if (fmpr_sgn(fmprb_midref(y)) > 0)
         {
-            fmpr_sub(u, fmprb_midref(y), fmprb_radref(y), FMPRB_RAD_PREC, FMPR_RND_DOWN);
+            fmpr_sub(u, fmprb_midref(y), yr, FMPRB_RAD_PREC, FMPR_RND_DOWN);
         }
         else
         {
-            fmpr_add(u, fmprb_midref(y), fmprb_radref(y), FMPRB_RAD_PREC, FMPR_RND_DOWN);
+            fmpr_add(u, fmprb_midref(y), yr, FMPRB_RAD_PREC, FMPR_RND_DOWN);
             fmpr_neg(u, u);
         }
 
@@ -114,12 +124,14 @@ fmprb_div(fmprb_t z, const fmprb_t x, const fmprb_t y, long prec)
             fmpr_divappr_abs_ubound(t, t, u, FMPRB_RAD_PREC);
 
             r = fmpr_div(fmprb_midref(z), fmprb_midref(x), fmprb_midref(y), prec, FMPR_RND_DOWN);
-            fmpr_add_error_result(fmprb_radref(z), t,
-                fmprb_midref(z), r, FMPRB_RAD_PREC, FMPR_RND_UP);
+            mag_set_fmpr(fmprb_radref(z), t);
+            mag_add_error_result(fmprb_radref(z), fmprb_radref(z), fmprb_midref(z), r);
         }
 
         fmpr_clear(t);
         fmpr_clear(u);
+        fmpr_clear(xr);
+        fmpr_clear(yr);
     }
 
     fmprb_adjust(z);
@@ -168,7 +180,7 @@ fmprb_fmpz_div_fmpz(fmprb_t y, const fmpz_t num, const fmpz_t den, long prec)
     fmpr_set_fmpz(q, den);
 
     r = fmpr_div(fmprb_midref(y), p, q, prec, FMPR_RND_DOWN);
-    fmpr_set_error_result(fmprb_radref(y), fmprb_midref(y), r);
+    mag_set_error_result(fmprb_radref(y), fmprb_midref(y), r);
 
     fmpr_clear(p);
     fmpr_clear(q);
@@ -0,0 +1,484 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmprb.h"
+
+/*
+The midpoint products are added exactly into a two's complement fixed-point
+accumulator whose least significant bit has weight 2^sbot, where sbot is
+chosen prec + guard bits below the largest term (or at the bottom of the
+smallest term, if that is higher). Bits of products below 2^sbot are
+discarded, each truncated term contributing at most 2^sbot to the error.
+The accumulator is rounded once at the end. The radius is computed
+separately using mag_t arithmetic.
+
+Inputs with infinite or NaN components, huge exponents or huge precision
+go through the generic code.
+*/
+
+#define DOT_EXP_MAX (1L << (FLINT_BITS - 4))
+#define DOT_STACK_ALLOC 64
+
+typedef struct
+{
+    long emax;
+    long emin;
+    long nterms;
+    mp_size_t maxn;
+}
+dot_bounds_t;
+
+static __inline__ int
+_fmpr_exp_is_small(const fmpr_t x)
+{
+    fmpz e = *fmpr_expref(x);
+    return !COEFF_IS_MPZ(e) && e > -DOT_EXP_MAX && e < DOT_EXP_MAX;
+}
+
+/* updates the bounds with the midpoint product x * y (or x if y is NULL);
+   returns 0 if the generic code must be used */
+static int
+_dot_bounds_term(dot_bounds_t * b, const fmpr_t x, const fmpr_t y)
+{
+    long top, bot;
+    mp_size_t n;
+
+    if (!fmpr_is_finite(x) || (y != NULL && !fmpr_is_finite(y)))
+        return 0;
+
+    if (fmpr_is_zero(x) || (y != NULL && fmpr_is_zero(y)))
+        return 1;
+
+    if (!_fmpr_exp_is_small(x) || (y != NULL && !_fmpr_exp_is_small(y)))
+        return 0;
+
+    bot = *fmpr_expref(x);
+    top = bot + fmpz_bits(fmpr_manref(x));
+    n = _fmpz_size(fmpr_manref(x));
+
+    if (y != NULL)
+    {
+        bot += *fmpr_expref(y);
+        top += *fmpr_expref(y) + fmpz_bits(fmpr_manref(y));
+        n += _fmpz_size(fmpr_manref(y));
+    }
+
+    if (b->nterms == 0)
+    {
+        b->emax = top;
+        b->emin = bot;
+    }
+    else
+    {
+        b->emax = FLINT_MAX(b->emax, top);
+        b->emin = FLINT_MIN(b->emin, bot);
+    }
+
+    b->maxn = FLINT_MAX(b->maxn, n);
+    b->nterms++;
+    return 1;
+}
+
+static int
+_dot_bounds_vec(dot_bounds_t * b, fmprb_srcptr x, long xstep,
+    fmprb_srcptr y, long ystep, long len)
+{
+    long i;
+
+    for (i = 0; i < len; i++)
+    {
+        if (mag_is_inf(fmprb_radref(x + i * xstep)) ||
+            mag_is_inf(fmprb_radref(y + i * ystep)))
+            return 0;
+
+        if (!_dot_bounds_term(b, fmprb_midref(x + i * xstep),
+                                 fmprb_midref(y + i * ystep)))
+            return 0;
+    }
+
+    return 1;
+}
+
+/* adds (-1)^negative * {p, pn} * 2^(bot - sbot) to {acc, sn}, where the
+   top limb of {p, pn} is nonzero; tmp needs room for pn + 1 limbs;
+   returns 1 if nonzero bits were discarded */
+static int
+_dot_add_mpn(mp_ptr acc, mp_size_t sn, mp_ptr tmp,
+    mp_srcptr p, mp_size_t pn, long bot, long sbot, int negative)
+{
+    mp_srcptr src;
+    mp_size_t off, tn;
+    long shift;
+    int inexact = 0;
+    unsigned int bits;
+
+    shift = bot - sbot;
+
+    if (shift >= 0)
+    {
+        off = shift / FLINT_BITS;
+        bits = shift % FLINT_BITS;
+
+        if (bits == 0)
+        {
+            src = p;
+            tn = pn;
+        }
+        else
+        {
+            tmp[pn] = mpn_lshift(tmp, p, pn, bits);
+            tn = pn + (tmp[pn] != 0);
+            src = tmp;
+        }
+    }
+    else
+    {
+        mp_size_t drop, i;
+
+        shift = -shift;
+        drop = shift / FLINT_BITS;
+        bits = shift % FLINT_BITS;
+
+        for (i = 0; i < drop && !inexact; i++)
+            inexact = (p[i] != 0);
+
+        off = 0;
+        tn = pn - drop;
+
+        if (bits == 0)
+        {
+            src = p + drop;
+        }
+        else
+        {
+            inexact |= ((p[drop] & ((1UL << bits) - 1)) != 0);
+            mpn_rshift(tmp, p + drop, tn, bits);
+            tn -= (tmp[tn - 1] == 0);
+            src = tmp;
+        }
+
+        if (tn == 0)
+            return inexact;
+    }
+
+    if (negative)
+    {
+        if (mpn_sub_n(acc + off, acc + off, src, tn) && off + tn < sn)
+            mpn_sub_1(acc + off + tn, acc + off + tn, sn - off - tn, 1);
+    }
+    else
+    {
+        if (mpn_add_n(acc + off, acc + off, src, tn) && off + tn < sn)
+            mpn_add_1(acc + off + tn, acc + off + tn, sn - off - tn, 1);
+    }
+
+    return inexact;
+}
+
+/* adds (-1)^negative * x * y (or x if y is NULL) to the accumulator;
+   returns 1 if the term was not added exactly */
+static int
+_dot_add_term(mp_ptr acc, mp_size_t sn, mp_ptr prod, mp_ptr tmp,
+    const fmpr_t x, const fmpr_t y, long sbot, int negative)
+{
+    mp_srcptr xp, yp;
+    mp_size_t xn, yn, pn;
+    mp_limb_t xtmp, ytmp;
+    int xsgn, ysgn;
+    long bot, top;
+    fmpz xv, yv;
+
+    if (fmpr_is_zero(x) || (y != NULL && fmpr_is_zero(y)))
+        return 0;
+
+    xv = *fmpr_manref(x);
+    bot = *fmpr_expref(x);
+    top = bot + fmpz_bits(fmpr_manref(x));
+
+    if (y != NULL)
+    {
+        bot += *fmpr_expref(y);
+        top += *fmpr_expref(y) + fmpz_bits(fmpr_manref(y));
+    }
+
+    /* the whole term is below the accumulator */
+    if (top <= sbot)
+        return 1;
+
+    FMPZ_GET_MPN_READONLY(xsgn, xn, xp, xtmp, xv)
+
+    if (y == NULL)
+    {
+        return _dot_add_mpn(acc, sn, tmp, xp, xn, bot, sbot, xsgn ^ negative);
+    }
+
+    yv = *fmpr_manref(y);
+    FMPZ_GET_MPN_READONLY(ysgn, yn, yp, ytmp, yv)
+
+    if (xn == 1 && yn == 1)
+    {
+        umul_ppmm(prod[1], prod[0], xp[0], yp[0]);
+        pn = 2;
+    }
+    else if (xn >= yn)
+    {
+        mpn_mul(prod, xp, xn, yp, yn);
+        pn = xn + yn;
+    }
+    else
+    {
+        mpn_mul(prod, yp, yn, xp, xn);
+        pn = xn + yn;
+    }
+
+    pn -= (prod[pn - 1] == 0);
+
+    return _dot_add_mpn(acc, sn, tmp, prod, pn, bot, sbot,
+        xsgn ^ ysgn ^ negative);
+}
+
+/* adds a bound for |x y| - |mid(x) mid(y)| to r */
+static __inline__ void
+_dot_rad_term(mag_t r, mag_t t, const fmprb_t x, const fmprb_t y)
+{
+    int xexact, yexact;
+
+    xexact = mag_is_zero(fmprb_radref(x));
+    yexact = mag_is_zero(fmprb_radref(y));
+
+    if (xexact && yexact)
+        return;
+
+    if (xexact)
+    {
+        mag_set_fmpr(t, fmprb_midref(x));
+        mag_mul(t, t, fmprb_radref(y));
+    }
+    else if (yexact)
+    {
+        mag_set_fmpr(t, fmprb_midref(y));
+        mag_mul(t, t, fmprb_radref(x));
+    }
+    else
+    {
+        /* |x| rad(y) + (|y| + rad(y)) rad(x) */
+        mag_set_fmpr(t, fmprb_midref(y));
+        mag_add(t, t, fmprb_radref(y));
+        mag_mul(t, t, fmprb_radref(x));
+        mag_add(r, r, t);
+
+        mag_set_fmpr(t, fmprb_midref(x));
+        mag_mul(t, t, fmprb_radref(y));
+    }
+
+    mag_add(r, r, t);
+}
+
+static void
+_fmprb_vec_dot2_generic(fmprb_t res, const fmprb_t initial, int subtract,
+    fmprb_srcptr x, long xstep, fmprb_srcptr y, long ystep, long len,
+    fmprb_srcptr u, long ustep, fmprb_srcptr v, long vstep, int subtract2,
+    long len2, long prec)
+{
+    fmprb_t s, t;
+    long i;
+
+    fmprb_init(s);
+    fmprb_init(t);
+
+    for (i = 0; i < len; i++)
+    {
+        fmprb_mul(t, x + i * xstep, y + i * ystep, prec);
+        fmprb_add(s, s, t, prec);
+    }
+
+    for (i = 0; i < len2; i++)
+    {
+        fmprb_mul(t, u + i * ustep, v + i * vstep, prec);
+
+        if (subtract2)
+            fmprb_sub(s, s, t, prec);
+        else
+            fmprb_add(s, s, t, prec);
+    }
+
+    if (initial == NULL)
+    {
+        if (subtract)
+            fmprb_neg(res, s);
+        else
+            fmprb_swap(res, s);
+    }
+    else
+    {
+        if (subtract)
+            fmprb_sub(res, initial, s, prec);
+        else
+            fmprb_add(res, initial, s, prec);
+    }
+
+    fmprb_clear(s);
+    fmprb_clear(t);
+}
+
+void
+_fmprb_vec_dot2(fmprb_t res, const fmprb_t initial, int subtract,
+    fmprb_srcptr x, long xstep, fmprb_srcptr y, long ystep, long len,
+    fmprb_srcptr u, long ustep, fmprb_srcptr v, long vstep, int subtract2,
+    long len2, long prec)
+{
+    dot_bounds_t b;
+    mag_t rad, t;
+    mp_limb_t tmp_stack[DOT_STACK_ALLOC];
+    mp_ptr acc, prod, tmp, buf;
+    mp_size_t sn, alloc;
+    long i, sbot, inexact, r, shift;
+    int negative;
+
+    if (len <= 0 && len2 <= 0)
+    {
+        if (initial == NULL)
+            fmprb_zero(res);
+        else
+            fmprb_set_round(res, initial, prec);
+        return;
+    }
+
+    b.emax = b.emin = b.nterms = b.maxn = 0;
+
+    if (prec >= DOT_EXP_MAX
+        || (initial != NULL && (mag_is_inf(fmprb_radref(initial)) ||
+            !_dot_bounds_term(&b, fmprb_midref(initial), NULL)))
+        || !_dot_bounds_vec(&b, x, xstep, y, ystep, len)
+        || !_dot_bounds_vec(&b, u, ustep, v, vstep, len2))
+    {
+        _fmprb_vec_dot2_generic(res, initial, subtract, x, xstep, y, ystep,
+            len, u, ustep, v, vstep, subtract2, len2, prec);
+        return;
+    }
+
+    mag_init(rad);
+    mag_init(t);
+
+    /* radius */
+    if (initial != NULL)
+        mag_set(rad, fmprb_radref(initial));
+
+    for (i = 0; i < len; i++)
+        _dot_rad_term(rad, t, x + i * xstep, y + i * ystep);
+
+    for (i = 0; i < len2; i++)
+        _dot_rad_term(rad, t, u + i * ustep, v + i * vstep);
+
+    /* midpoint */
+    if (b.nterms == 0)
+    {
+        fmpr_zero(fmprb_midref(res));
+    }
+    else
+    {
+        sbot = b.emax - prec - FLINT_BIT_COUNT(b.nterms) - 4;
+        sbot = FLINT_MAX(sbot, b.emin);
+
+        sn = (b.emax - sbot + FLINT_BIT_COUNT(b.nterms) + 2
+            + FLINT_BITS - 1) / FLINT_BITS;
+
+        alloc = sn + 2 * b.maxn + 1;
+
+        if (alloc <= DOT_STACK_ALLOC)
+            buf = tmp_stack;
+        else
+            buf = flint_malloc(sizeof(mp_limb_t) * alloc);
+
+        acc = buf;
+        prod = acc + sn;
+        tmp = prod + b.maxn;
+        flint_mpn_zero(acc, sn);
+
+        inexact = 0;
+
+        if (initial != NULL)
+            inexact += _dot_add_term(acc, sn, prod, tmp,
+                fmprb_midref(initial), NULL, sbot, 0);
+
+        for (i = 0; i < len; i++)
+            inexact += _dot_add_term(acc, sn, prod, tmp,
+                fmprb_midref(x + i * xstep), fmprb_midref(y + i * ystep),
+                sbot, subtract);
+
+        for (i = 0; i < len2; i++)
+            inexact += _dot_add_term(acc, sn, prod, tmp,
+                fmprb_midref(u + i * ustep), fmprb_midref(v + i * vstep),
+                sbot, subtract ^ subtract2);
+
+        /* every truncated term is off by less than 2^sbot */
+        if (inexact != 0)
+        {
+            mag_set_ui_2exp_si(t, inexact, sbot);
+            mag_add(rad, rad, t);
+        }
+
+        negative = (acc[sn - 1] >> (FLINT_BITS - 1)) != 0;
+
+        if (negative)
+        {
+            for (i = 0; i < sn; i++)
+                acc[i] = ~acc[i];
+            mpn_add_1(acc, acc, sn, 1);
+        }
+
+        while (sn > 0 && acc[sn - 1] == 0)
+            sn--;
+
+        if (sn == 0)
+        {
+            fmpr_zero(fmprb_midref(res));
+        }
+        else
+        {
+            r = _fmpr_set_round_mpn(&shift, fmpr_manref(fmprb_midref(res)),
+                acc, sn, negative, prec, FMPR_RND_DOWN);
+            fmpz_set_si(fmpr_expref(fmprb_midref(res)), sbot + shift);
+            mag_add_error_result(rad, rad, fmprb_midref(res), r);
+        }
+
+        if (alloc > DOT_STACK_ALLOC)
+            flint_free(buf);
+    }
+
+    mag_swap(fmprb_radref(res), rad);
+
+    mag_clear(rad);
+    mag_clear(t);
+}
+
+void
+_fmprb_vec_dot(fmprb_t res, const fmprb_t initial, int subtract,
+    fmprb_srcptr x, long xstep, fmprb_srcptr y, long ystep, long len, long prec)
+{
+    _fmprb_vec_dot2(res, initial, subtract, x, xstep, y, ystep, len,
+        NULL, 0, NULL, 0, 0, 0, prec);
+}
+
@@ -127,7 +127,7 @@ fmpr_exp_ubound(fmpr_t y, const fmpr_t x, long prec, long maglim)
         fmpr_get_fmpz(q, fmprb_midref(u), FMPR_RND_DOWN);
         fmprb_submul_fmpz(t, ln2, q, wp);
 
-        fmpr_add(y, fmprb_midref(t), fmprb_radref(t), prec, FMPR_RND_CEIL);
+        fmprb_get_ubound_fmpr(y, t, prec);
         fmpr_exp(y, y, prec, FMPR_RND_UP);
         fmpr_mul_2exp_fmpz(y, y, q);
 
@@ -152,7 +152,7 @@ fmprb_exp_fmpr(fmprb_t z, const fmpr_t x, long prec, long maglim, int m1)
             fmpr_expm1(fmprb_midref(z), x, prec, FMPR_RND_DOWN);
         else
             fmpr_exp(fmprb_midref(z), x, prec, FMPR_RND_DOWN);
-        fmpr_zero(fmprb_radref(z));
+        mag_zero(fmprb_radref(z));
         return;
     }
 
@@ -180,7 +180,7 @@ fmprb_exp_fmpr(fmprb_t z, const fmpr_t x, long prec, long maglim, int m1)
                 r = fmpr_expm1(fmprb_midref(z), x, prec, FMPR_RND_DOWN);
             else
                 r = fmpr_exp(fmprb_midref(z), x, prec, FMPR_RND_DOWN);
-            fmpr_set_error_result(fmprb_radref(z), fmprb_midref(z), r);
+            mag_set_error_result(fmprb_radref(z), fmprb_midref(z), r);
         }
     }
     /* close to zero */
@@ -188,7 +188,7 @@ fmprb_exp_fmpr(fmprb_t z, const fmpr_t x, long prec, long maglim, int m1)
     {
         /* exp(x) = 1 + x + eps,  eps < x^2 < 2^(2mag) */
         r = fmpr_add_ui(fmprb_midref(z), x, m1 ? 0 : 1, prec, FMPR_RND_DOWN);
-        fmpr_set_error_result(fmprb_radref(z), fmprb_midref(z), r);
+        mag_set_error_result(fmprb_radref(z), fmprb_midref(z), r);
         fmpz_mul_2exp(mag, mag, 1);
         fmprb_add_error_2exp_fmpz(z, mag);
     }
@@ -198,7 +198,7 @@ fmprb_exp_fmpr(fmprb_t z, const fmpr_t x, long prec, long maglim, int m1)
         if (fmpz_sgn(fmpr_manref(x)) > 0)
         {
             fmpr_pos_inf(fmprb_midref(z));
-            fmpr_pos_inf(fmprb_radref(z));
+            mag_inf(fmprb_radref(z));
         }
         else
         {
@@ -214,7 +214,7 @@ fmprb_exp_fmpr(fmprb_t z, const fmpr_t x, long prec, long maglim, int m1)
             fmpz_set_si(fmpr_expref(fmprb_midref(z)), -1);
             fmpz_mul_2exp(fmpr_expref(fmprb_midref(z)), fmpr_expref(fmprb_midref(z)), maglim);
             fmpz_one(fmpr_manref(fmprb_midref(z)));
-            fmpr_set(fmprb_radref(z), fmprb_midref(z));
+            mag_set_fmpr(fmprb_radref(z), fmprb_midref(z));
             if (m1)
                 fmprb_sub_ui(z, z, 1, prec);
         }
@@ -269,14 +269,17 @@ _fmprb_exp(fmprb_t z, const fmprb_t x, long prec, int m1)
     else
     {
         /* exp(a+b) - exp(a) = exp(a) * (exp(b)-1) <= b * exp(a+b) */
-        fmpr_t t;
+        fmpr_t t, u;
         fmpr_init(t);
-        fmpr_add(t, fmprb_midref(x), fmprb_radref(x), prec, FMPR_RND_CEIL);
+        fmpr_init(u);
+        fmprb_get_ubound_fmpr(t, x, prec);
         fmpr_exp_ubound(t, t, FMPRB_RAD_PREC, maglim);
-        fmpr_mul(t, t, fmprb_radref(x), FMPRB_RAD_PREC, FMPR_RND_UP);
+        fmprb_get_rad_fmpr(u, x);
+        fmpr_mul(t, t, u, FMPRB_RAD_PREC, FMPR_RND_UP);
         fmprb_exp_fmpr(z, fmprb_midref(x), prec, maglim, m1);
-        fmpr_add(fmprb_radref(z), fmprb_radref(z), t, FMPRB_RAD_PREC, FMPR_RND_UP);
+        fmprb_add_error_fmpr(z, t);
         fmpr_clear(t);
+        fmpr_clear(u);
     }
     fmprb_adjust(z);
 }
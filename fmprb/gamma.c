@@ -46,7 +46,7 @@ _fmprb_gamma(fmprb_t y, const fmprb_t x, long prec, int inverse)
             else if (fmpr_is_nan(mid) || fmpr_is_neg_inf(mid) || !inverse)
             {
                 fmpr_nan(fmprb_midref(y));
-                fmpr_pos_inf(fmprb_radref(y));
+                mag_inf(fmprb_radref(y));
             }
             else
             {
@@ -41,7 +41,7 @@ fmprb_gamma_fmpq(fmprb_t y, const fmpq_t x, long prec)
             if (p <= 0)
             {
                 fmpr_nan(fmprb_midref(y));
-                fmpr_pos_inf(fmprb_radref(y));
+                mag_inf(fmprb_radref(y));
                 return;
             }
 
@@ -0,0 +1,200 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmprb.h"
+#include "gamma.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+    fmprb_ptr y;
+    fmprb_srcptr x;
+    fmprb_srcptr t;
+    fmprb_srcptr s;
+    const long * index;
+    const int * reflect;
+    long r;
+    long wp;
+    long prec;
+}
+gamma_vec_arg_t;
+
+/* points handled by fmprb_gamma directly: non-finite input and the
+   exact special values that fmprb_gamma does not compute by the
+   Stirling series */
+static int
+_fmprb_gamma_vec_is_special(const fmprb_t x, long prec)
+{
+    const fmpr_struct * mid = fmprb_midref(x);
+
+    if (!fmprb_is_finite(x))
+        return 1;
+
+    if (fmprb_is_exact(x) && fmpr_cmpabs_2exp_si(mid, prec) < 0 &&
+        fmpr_is_int_2exp_si(mid, -2))
+        return 1;
+
+    return 0;
+}
+
+static void
+_fmprb_gamma_vec_special(void * arg_ptr, long j)
+{
+    const gamma_vec_arg_t * arg = (const gamma_vec_arg_t *) arg_ptr;
+    long i = arg->index[j];
+
+    fmprb_gamma(arg->y + i, arg->x + i, arg->prec);
+}
+
+/* combines the Stirling series s = log(gamma(t+r)) with the
+   rising factorial as in fmprb_gamma */
+static void
+_fmprb_gamma_vec_worker(void * arg_ptr, long j)
+{
+    const gamma_vec_arg_t * arg = (const gamma_vec_arg_t *) arg_ptr;
+    fmprb_srcptr t, x;
+    fmprb_ptr y;
+    fmprb_t u, v, w;
+    long i, wp;
+
+    i = arg->index[j];
+    x = arg->x + i;
+    y = arg->y + i;
+    t = arg->t + j;
+    wp = arg->wp;
+
+    fmprb_init(u);
+    fmprb_init(v);
+    fmprb_init(w);
+
+    if (arg->reflect[j])
+    {
+        /* gamma(x) = (rf(1-x, r) * pi) / (gamma(1-x+r) sin(pi x)) */
+        gamma_rising_fmprb_ui_bsplit(u, t, arg->r, wp);
+        fmprb_const_pi(v, wp);
+        fmprb_mul(u, u, v, wp);
+        fmprb_exp(v, arg->s + j, wp);
+        fmprb_sin_pi(w, x, wp);
+        fmprb_mul(v, v, w, wp);
+    }
+    else
+    {
+        /* gamma(x) = gamma(x+r) / rf(x,r) */
+        fmprb_exp(u, arg->s + j, arg->prec);
+        gamma_rising_fmprb_ui_bsplit(v, t, arg->r, wp);
+    }
+
+    fmprb_div(y, u, v, arg->prec);
+
+    fmprb_clear(u);
+    fmprb_clear(v);
+    fmprb_clear(w);
+}
+
+void
+fmprb_gamma_vec(fmprb_ptr y, fmprb_srcptr x, long num, long prec)
+{
+    gamma_vec_arg_t arg;
+    fmprb_ptr t, z, s;
+    long * index;
+    int * reflect;
+    long i, j, num_special, num_generic, r, n, rj, nj, wp, num_threads;
+
+    if (num < 1)
+        return;
+
+    num_threads = flint_get_num_threads();
+    wp = prec + FLINT_BIT_COUNT(prec);
+
+    index = flint_malloc(sizeof(long) * num);
+    reflect = flint_malloc(sizeof(int) * num);
+
+    arg.y = y;
+    arg.x = x;
+    arg.reflect = reflect;
+    arg.wp = wp;
+    arg.prec = prec;
+
+    /* the special points are kept at the end of index; one (r, n)
+       is used for all other points: the largest needed by any point */
+    num_special = num_generic = 0;
+    r = n = 0;
+
+    for (i = 0; i < num; i++)
+    {
+        if (_fmprb_gamma_vec_is_special(x + i, prec))
+        {
+            index[num - 1 - num_special++] = i;
+        }
+        else
+        {
+            gamma_stirling_choose_param_fmprb(reflect + num_generic,
+                &rj, &nj, x + i, 1, 0, wp);
+            r = FLINT_MAX(r, rj);
+            n = FLINT_MAX(n, nj);
+            index[num_generic++] = i;
+        }
+    }
+
+    arg.index = index + num_generic;
+    thread_pool_parallel_for(_fmprb_gamma_vec_special, &arg,
+        num_special, num_threads);
+
+    t = _fmprb_vec_init(num_generic);
+    z = _fmprb_vec_init(num_generic);
+    s = _fmprb_vec_init(num_generic);
+
+    /* z = t + r, where t = 1-x if reflected and t = x otherwise */
+    for (j = 0; j < num_generic; j++)
+    {
+        if (reflect[j])
+        {
+            fmprb_sub_ui(t + j, x + index[j], 1, wp);
+            fmprb_neg(t + j, t + j);
+        }
+        else
+        {
+            fmprb_set(t + j, x + index[j]);
+        }
+
+        fmprb_add_ui(z + j, t + j, r, wp);
+    }
+
+    gamma_stirling_eval_fmprb_vec(s, z, num_generic, n, 0, wp);
+
+    arg.index = index;
+    arg.t = t;
+    arg.s = s;
+    arg.r = r;
+
+    thread_pool_parallel_for(_fmprb_gamma_vec_worker, &arg,
+        num_generic, num_threads);
+
+    _fmprb_vec_clear(t, num_generic);
+    _fmprb_vec_clear(z, num_generic);
+    _fmprb_vec_clear(s, num_generic);
+    flint_free(index);
+    flint_free(reflect);
+}
@@ -52,10 +52,10 @@ fmprb_get_interval_fmpz_2exp(fmpz_t a, fmpz_t b, fmpz_t exp, const fmprb_t x)
         fmpr_init(t);
         fmpz_init(exp2);
 
-        fmpr_sub(t, fmprb_midref(x), fmprb_radref(x), FMPR_PREC_EXACT, FMPR_RND_DOWN);
+        fmprb_get_lbound_fmpr(t, x, FMPR_PREC_EXACT);
         fmpr_get_fmpz_2exp(a, exp, t);
 
-        fmpr_add(t, fmprb_midref(x), fmprb_radref(x), FMPR_PREC_EXACT, FMPR_RND_DOWN);
+        fmprb_get_ubound_fmpr(t, x, FMPR_PREC_EXACT);
         fmpr_get_fmpz_2exp(b, exp2, t);
 
         s = _fmpz_sub_small(exp, exp2);
@@ -0,0 +1,162 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include <string.h>
+#include "fmprb.h"
+
+/* number of digits used for the radius */
+#define RAD_DIGITS 5
+
+/* sets (mm, me) to the midpoint rounded to digits decimal digits,
+   and (rm, re) to an upper bound for the radius which also accounts
+   for the error in the decimal midpoint; returns zero if the midpoint
+   or the radius is not finite */
+static int
+_fmprb_get_decimal(fmpz_t mm, fmpz_t me, fmpz_t rm, fmpz_t re,
+    const fmprb_t x, long digits)
+{
+    fmpr_t r;
+
+    if (!fmpr_is_finite(fmprb_midref(x)) || !mag_is_finite(fmprb_radref(x)))
+        return 0;
+
+    fmpr_init(r);
+    fmprb_get_rad_fmpr(r, x);
+
+    if (!fmpr_get_fmpz_10exp(mm, me, fmprb_midref(x), digits, FMPR_RND_NEAR))
+    {
+        fmprb_t t;
+
+        /* add 10^me / 2 */
+        fmprb_init(t);
+        fmprb_set_ui(t, 10);
+        fmprb_pow_fmpz(t, t, me, FMPRB_RAD_PREC);
+        fmprb_get_ubound_fmpr(fmprb_midref(t), t, FMPRB_RAD_PREC);
+        fmpr_mul_2exp_si(fmprb_midref(t), fmprb_midref(t), -1);
+        fmpr_add(r, r, fmprb_midref(t), FMPRB_RAD_PREC, FMPR_RND_UP);
+        fmprb_clear(t);
+    }
+
+    fmpr_get_fmpz_10exp(rm, re, r, RAD_DIGITS, FMPR_RND_UP);
+
+    fmpr_clear(r);
+    return 1;
+}
+
+char *
+fmprb_get_str(const fmprb_t x, long digits)
+{
+    fmpz_t mm, me, rm, re;
+    char * s, * mid, * rad;
+    long d;
+
+    d = FLINT_ABS(digits);
+
+    fmpz_init(mm);
+    fmpz_init(me);
+    fmpz_init(rm);
+    fmpz_init(re);
+
+    if (_fmprb_get_decimal(mm, me, rm, re, x, d))
+    {
+        mid = _fmpr_decimal_get_str(mm, me, d);
+        rad = _fmpr_decimal_get_str(rm, re, RAD_DIGITS);
+    }
+    else
+    {
+        fmpr_t r;
+        fmpr_init(r);
+        fmprb_get_rad_fmpr(r, x);
+        mid = fmpr_get_str(fmprb_midref(x), d, FMPR_RND_NEAR);
+        rad = fmpr_get_str(r, RAD_DIGITS, FMPR_RND_UP);
+        fmpr_clear(r);
+    }
+
+    if (digits > 0)
+    {
+        s = flint_malloc(strlen(mid) + strlen(rad) + 6);
+        strcpy(s, mid);
+        strcat(s, " +/- ");
+        strcat(s, rad);
+        flint_free(mid);
+    }
+    else
+    {
+        s = mid;
+    }
+
+    flint_free(rad);
+
+    fmpz_clear(mm);
+    fmpz_clear(me);
+    fmpz_clear(rm);
+    fmpz_clear(re);
+
+    return s;
+}
+
+void
+fmprb_fprintd(FILE * file, const fmprb_t x, long digits)
+{
+    fmpz_t mm, me, rm, re;
+    long d;
+
+    d = FLINT_ABS(digits);
+
+    fmpz_init(mm);
+    fmpz_init(me);
+    fmpz_init(rm);
+    fmpz_init(re);
+
+    if (_fmprb_get_decimal(mm, me, rm, re, x, d))
+    {
+        _fmpr_decimal_fprint(file, mm, me, d);
+
+        if (digits > 0)
+        {
+            fputs(" +/- ", file);
+            _fmpr_decimal_fprint(file, rm, re, RAD_DIGITS);
+        }
+    }
+    else
+    {
+        fmpr_fprintd(file, fmprb_midref(x), d);
+
+        if (digits > 0)
+        {
+            fmpr_t r;
+            fmpr_init(r);
+            fmprb_get_rad_fmpr(r, x);
+            fputs(" +/- ", file);
+            fmpr_fprintd(file, r, RAD_DIGITS);
+            fmpr_clear(r);
+        }
+    }
+
+    fmpz_clear(mm);
+    fmpz_clear(me);
+    fmpz_clear(rm);
+    fmpz_clear(re);
+}
@@ -32,7 +32,7 @@ fmprb_get_unique_fmpz(fmpz_t z, const fmprb_t x)
     {
         return 0;
     }
-    else if (fmpr_is_zero(fmprb_radref(x)))
+    else if (mag_is_zero(fmprb_radref(x)))
     {
         /* x = b*2^e, e >= 0 */
         if (fmpr_is_int(fmprb_midref(x)))
@@ -54,7 +54,7 @@ fmprb_get_unique_fmpz(fmpz_t z, const fmprb_t x)
         }
     }
     /* if the radius is >= 1, there are at least two integers */
-    else if (fmpr_cmp_2exp_si(fmprb_radref(x), 0) >= 0)
+    else if (mag_cmp_2exp_si(fmprb_radref(x), 0) >= 0)
     {
         return 0;
     }
@@ -76,7 +76,7 @@ fmprb_get_unique_fmpz(fmpz_t z, const fmprb_t x)
             return 1;
         }
         /* if the radius is tiny, it can't be an integer */
-        else if (!fmpz_fits_si(fmpr_expref(fmprb_radref(x))))
+        else if (!fmpz_fits_si(MAG_EXPREF(fmprb_radref(x))))
         {
             return 0;
         }
@@ -24,6 +24,7 @@
 ******************************************************************************/
 
 #include "fmprb.h"
+#include "elefun.h"
 
 #define BIG_EXPONENT_BITS 20
 #define BIG_EXPONENT (1L << BIG_EXPONENT_BITS)
@@ -87,12 +88,12 @@ fmprb_log_fmpr(fmprb_t y, const fmpr_t x, long prec)
         if (fmpr_is_pos_inf(x))
         {
             fmpr_pos_inf(fmprb_midref(y));
-            fmpr_zero(fmprb_radref(y));
+            mag_zero(fmprb_radref(y));
         }
         else
         {
             fmpr_nan(fmprb_midref(y));
-            fmpr_pos_inf(fmprb_radref(y));
+            mag_inf(fmprb_radref(y));
         }
         return;
     }
@@ -100,7 +101,7 @@ fmprb_log_fmpr(fmprb_t y, const fmpr_t x, long prec)
     if (fmpz_sgn(fmpr_manref(x)) < 0)
     {
         fmpr_nan(fmprb_midref(y));
-        fmpr_pos_inf(fmprb_radref(y));
+        mag_inf(fmprb_radref(y));
         return;
     }
 
@@ -119,8 +120,15 @@ fmprb_log_fmpr(fmprb_t y, const fmpr_t x, long prec)
 
     if (*exp >= -BIG_EXPONENT && *exp <= BIG_EXPONENT)
     {
+        /* use the table-based fixed-point code at low precision */
+        if (elefun_log_precomp(y, x, prec))
+        {
+            fmpz_clear(exp);
+            return;
+        }
+
         r = fmpr_log(fmprb_midref(y), x, prec, FMPR_RND_DOWN);
-        fmpr_set_error_result(fmprb_radref(y), fmprb_midref(y), r);
+        mag_set_error_result(fmprb_radref(y), fmprb_midref(y), r);
     }
     else
     {
@@ -138,7 +146,7 @@ fmprb_log_fmpr(fmprb_t y, const fmpr_t x, long prec)
         wp = FLINT_MAX(wp, 4);
 
         r = fmpr_log(fmprb_midref(y), t, wp, FMPR_RND_DOWN);
-        fmpr_set_error_result(fmprb_radref(y), fmprb_midref(y), r);
+        mag_set_error_result(fmprb_radref(y), fmprb_midref(y), r);
 
         fmprb_const_log2(c, prec + 4);
         fmprb_mul_fmpz(c, c, exp, prec + 4);
@@ -168,9 +176,11 @@ fmprb_log(fmprb_t y, const fmprb_t x, long prec)
 
         log(a) - log(a-b) = log(1 + b/(a-b)).
         */
-        fmpr_t err;
+        fmpr_t err, r;
         fmpr_init(err);
-        fmpr_sub(err, fmprb_midref(x), fmprb_radref(x), FMPRB_RAD_PREC, FMPR_RND_DOWN);
+        fmpr_init(r);
+        fmprb_get_rad_fmpr(r, x);
+        fmpr_sub(err, fmprb_midref(x), r, FMPRB_RAD_PREC, FMPR_RND_DOWN);
 
         if (fmpr_sgn(err) <= 0)
         {
@@ -178,13 +188,14 @@ fmprb_log(fmprb_t y, const fmprb_t x, long prec)
         }
         else
         {
-            fmpr_divappr_abs_ubound(err, fmprb_radref(x), err, FMPRB_RAD_PREC);
+            fmpr_divappr_abs_ubound(err, r, err, FMPRB_RAD_PREC);
             fmpr_log1p_ubound(err, err);
         }
 
         fmprb_log_fmpr(y, fmprb_midref(x), prec);
-        fmpr_add(fmprb_radref(y), fmprb_radref(y), err, FMPRB_RAD_PREC, FMPR_RND_UP);
+        fmprb_add_error_fmpr(y, err);
         fmpr_clear(err);
+        fmpr_clear(r);
     }
 
     fmprb_adjust(y);
@@ -25,68 +25,89 @@
 
 #include "fmprb.h"
 
+/* the radius is computed with fmpr arithmetic and only converted to a
+   mag_t at the end, so that these functions can be used to check the
+   mag_t code in fmprb_mul */
+
 void
 fmprb_mul_fmpr_naive(fmprb_t z, const fmprb_t x, const fmpr_t y, long prec)
 {
     /* (x+a) * y = x*y + y*a */
-    if (fmpr_is_pos_inf(fmprb_radref(x)))
+    if (mag_is_inf(fmprb_radref(x)))
     {
         fmpr_mul(fmprb_midref(z), fmprb_midref(x), y, prec, FMPR_RND_DOWN);
-        fmpr_pos_inf(fmprb_radref(z));
+        mag_inf(fmprb_radref(z));
     }
-    else if (fmpr_is_zero(fmprb_radref(x)))
+    else if (mag_is_zero(fmprb_radref(x)))
     {
         long r;
 
         r = fmpr_mul(fmprb_midref(z), fmprb_midref(x), y, prec, FMPR_RND_DOWN);
-        fmpr_set_error_result(fmprb_radref(z), fmprb_midref(z), r);
+        mag_set_error_result(fmprb_radref(z), fmprb_midref(z), r);
     }
     else
     {
+        fmpr_t t;
         long r;
 
-        fmpr_mul(fmprb_radref(z), fmprb_radref(x), y, FMPRB_RAD_PREC, FMPR_RND_UP);
-        fmpr_abs(fmprb_radref(z), fmprb_radref(z));
+        fmpr_init(t);
+
+        mag_get_fmpr(t, fmprb_radref(x));
+        fmpr_mul(t, t, y, FMPRB_RAD_PREC, FMPR_RND_UP);
+        fmpr_abs(t, t);
 
         r = fmpr_mul(fmprb_midref(z), fmprb_midref(x), y, prec, FMPR_RND_DOWN);
-        fmpr_add_error_result(fmprb_radref(z), fmprb_radref(z),
-            fmprb_midref(z), r, FMPRB_RAD_PREC, FMPR_RND_UP);
+        fmpr_add_error_result(t, t, fmprb_midref(z), r,
+            FMPRB_RAD_PREC, FMPR_RND_UP);
+
+        mag_set_fmpr(fmprb_radref(z), t);
+
+        fmpr_clear(t);
     }
 }
 
 void
 fmprb_mul_main_naive(fmprb_t z, const fmprb_t x, const fmprb_t y, long prec)
 {
-    if (fmpr_is_pos_inf(fmprb_radref(x)) || fmpr_is_pos_inf(fmprb_radref(y)))
+    if (mag_is_inf(fmprb_radref(x)) || mag_is_inf(fmprb_radref(y)))
     {
         fmpr_mul(fmprb_midref(z), fmprb_midref(x), fmprb_midref(y), prec, FMPR_RND_DOWN);
-        fmpr_pos_inf(fmprb_radref(z));
+        mag_inf(fmprb_radref(z));
     }
     else
     {
-        fmpr_t t, u;
+        fmpr_t t, u, a, b;
         long r;
 
         fmpr_init(t);
         fmpr_init(u);
+        fmpr_init(a);
+        fmpr_init(b);
+
+        mag_get_fmpr(a, fmprb_radref(x));
+        mag_get_fmpr(b, fmprb_radref(y));
 
         /* (x+a)*(y+b) = x*y + x*b + y*a + a*b*/
 
-        fmpr_mul(t, fmprb_midref(x), fmprb_radref(y), FMPRB_RAD_PREC, FMPR_RND_UP);
+        fmpr_mul(t, fmprb_midref(x), b, FMPRB_RAD_PREC, FMPR_RND_UP);
         fmpr_abs(t, t);
 
-        fmpr_mul(u, fmprb_midref(y), fmprb_radref(x), FMPRB_RAD_PREC, FMPR_RND_UP);
+        fmpr_mul(u, fmprb_midref(y), a, FMPRB_RAD_PREC, FMPR_RND_UP);
         fmpr_abs(u, u);
 
         fmpr_add(t, t, u, FMPRB_RAD_PREC, FMPR_RND_UP);
-        fmpr_addmul(t, fmprb_radref(x), fmprb_radref(y), FMPRB_RAD_PREC, FMPR_RND_UP);
+        fmpr_addmul(t, a, b, FMPRB_RAD_PREC, FMPR_RND_UP);
 
         r = fmpr_mul(fmprb_midref(z), fmprb_midref(x), fmprb_midref(y), prec, FMPR_RND_DOWN);
-        fmpr_add_error_result(fmprb_radref(z), t,
-            fmprb_midref(z), r, FMPRB_RAD_PREC, FMPR_RND_UP);
+        fmpr_add_error_result(t, t, fmprb_midref(z), r,
+            FMPRB_RAD_PREC, FMPR_RND_UP);
+
+        mag_set_fmpr(fmprb_radref(z), t);
 
         fmpr_clear(t);
         fmpr_clear(u);
+        fmpr_clear(a);
+        fmpr_clear(b);
     }
 }
 
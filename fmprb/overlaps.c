@@ -32,7 +32,7 @@ fmprb_overlaps(const fmprb_t x, const fmprb_t y)
     fmpr_struct u[4];
     int result;
 
-    if (fmpr_is_inf(fmprb_radref(x)) || fmpr_is_inf(fmprb_radref(y)))
+    if (mag_is_inf(fmprb_radref(x)) || mag_is_inf(fmprb_radref(y)))
         return 1;
 
     if (fmpr_equal(fmprb_midref(x), fmprb_midref(y)))
@@ -57,8 +57,10 @@ fmprb_overlaps(const fmprb_t x, const fmprb_t y)
         fmpr_set(u + 1, fmprb_midref(y));
     }
 
-    fmpr_neg(u + 2, fmprb_radref(x));
-    fmpr_neg(u + 3, fmprb_radref(y));
+    mag_get_fmpr(u + 2, fmprb_radref(x));
+    mag_get_fmpr(u + 3, fmprb_radref(y));
+    fmpr_neg(u + 2, u + 2);
+    fmpr_neg(u + 3, u + 3);
 
     fmpr_sum(t, u, 4, 30, FMPR_RND_DOWN);
     result = fmpr_sgn(t) <= 0;
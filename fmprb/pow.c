@@ -50,7 +50,7 @@ void
 fmprb_pow(fmprb_t z, const fmprb_t x, const fmprb_t y, long prec)
 {
     const fmpr_struct * ymid = fmprb_midref(y);
-    const fmpr_struct * yrad = fmprb_radref(y);
+    const mag_struct * yrad = fmprb_radref(y);
 
     if (fmprb_is_zero(y))
     {
@@ -58,7 +58,7 @@ fmprb_pow(fmprb_t z, const fmprb_t x, const fmprb_t y, long prec)
         return;
     }
 
-    if (fmpr_is_zero(yrad) && !fmpr_is_special(fmprb_midref(x)))
+    if (mag_is_zero(yrad) && !fmpr_is_special(fmprb_midref(x)))
     {
         /* small half-integer or integer */
         if (fmpr_cmpabs_2exp_si(ymid, BINEXP_LIMIT) < 0 &&
@@ -29,15 +29,14 @@ void
 fmprb_randtest_exact(fmprb_t x, flint_rand_t state, long prec, long mag_bits)
 {
     fmpr_randtest(fmprb_midref(x), state, prec, mag_bits);
-    fmpr_zero(fmprb_radref(x));
+    mag_zero(fmprb_radref(x));
 }
 
 void
 fmprb_randtest_wide(fmprb_t x, flint_rand_t state, long prec, long mag_bits)
 {
     fmpr_randtest(fmprb_midref(x), state, prec, mag_bits);
-    fmpr_randtest(fmprb_radref(x), state, FMPRB_RAD_PREC, mag_bits);
-    fmpr_abs(fmprb_radref(x), fmprb_radref(x));
+    mag_randtest(fmprb_radref(x), state, mag_bits);
 }
 
 void
@@ -47,13 +46,14 @@ fmprb_randtest_precise(fmprb_t x, flint_rand_t state, long prec, long mag_bits)
 
     if (fmpr_is_zero(fmprb_midref(x)) || (n_randint(state, 8) == 0))
     {
-        fmpr_zero(fmprb_radref(x));
+        mag_zero(fmprb_radref(x));
     }
     else
     {
-        fmpz_randtest_not_zero(fmpr_manref(fmprb_radref(x)), state, FMPRB_RAD_PREC);
-        fmpz_abs(fmpr_manref(fmprb_radref(x)), fmpr_manref(fmprb_radref(x)));
-        fmpz_sub_ui(fmpr_expref(fmprb_radref(x)), fmpr_expref(fmprb_midref(x)), prec + FMPRB_RAD_PREC);
+        mag_set_ui_2exp_si(fmprb_radref(x),
+            1 + n_randint(state, 1UL << FMPRB_RAD_PREC), -prec - FMPRB_RAD_PREC);
+        mag_mul_2exp_fmpz(fmprb_radref(x), fmprb_radref(x),
+            fmpr_expref(fmprb_midref(x)));
     }
 }
 
@@ -79,7 +79,7 @@ fmprb_randtest_special(fmprb_t x, flint_rand_t state, long prec, long mag_bits)
     fmprb_randtest(x, state, prec, mag_bits);
 
     if (n_randint(state, 10) == 0)
-        fmpr_pos_inf(fmprb_radref(x));
+        mag_inf(fmprb_radref(x));
 
     switch (n_randint(state, 10))
     {
@@ -91,7 +91,7 @@ fmprb_randtest_special(fmprb_t x, flint_rand_t state, long prec, long mag_bits)
             break;
         case 2:
             fmpr_nan(fmprb_midref(x));
-            fmpr_pos_inf(fmprb_radref(x));
+            mag_inf(fmprb_radref(x));
             break;
         default:
             break;
@@ -57,25 +57,27 @@ fmprb_root(fmprb_t z, const fmprb_t x, ulong k, long prec)
     if (fmprb_is_exact(x))
     {
         r = fmpr_root(fmprb_midref(z), fmprb_midref(x), k, prec, FMPR_RND_DOWN);
-        fmpr_set_error_result(fmprb_radref(z), fmprb_midref(z), r);
+        mag_set_error_result(fmprb_radref(z), fmprb_midref(z), r);
     }
     else
     {
-        fmpr_t t, u, err;
+        fmpr_t t, u, err, rad;
 
         fmpr_init(t);
         fmpr_init(u);
         fmpr_init(err);
+        fmpr_init(rad);
 
         /* lower point */
-        fmpr_sub(err, fmprb_midref(x), fmprb_radref(x), FMPRB_RAD_PREC, FMPR_RND_DOWN);
+        fmprb_get_rad_fmpr(rad, x);
+        fmpr_sub(err, fmprb_midref(x), rad, FMPRB_RAD_PREC, FMPR_RND_DOWN);
 
         if (fmpr_is_zero(err))
         {
             fmpr_root(err, fmprb_midref(x), k, FMPRB_RAD_PREC, FMPR_RND_UP);
             r = fmpr_root(fmprb_midref(z), fmprb_midref(x), k, prec, FMPR_RND_DOWN);
-            fmpr_add_error_result(fmprb_radref(z), err, fmprb_midref(z), r,
-                FMPRB_RAD_PREC, FMPR_RND_UP);
+            mag_set_fmpr(fmprb_radref(z), err);
+            mag_add_error_result(fmprb_radref(z), fmprb_radref(z), fmprb_midref(z), r);
         }
         else
         {
@@ -85,16 +87,17 @@ fmprb_root(fmprb_t z, const fmprb_t x, ulong k, long prec)
             fmpr_divappr_abs_ubound(t, t, u, FMPRB_RAD_PREC);
 
             /* multiplied by distance */
-            fmpr_mul(err, t, fmprb_radref(x), FMPRB_RAD_PREC, FMPR_RND_UP);
+            fmpr_mul(err, t, rad, FMPRB_RAD_PREC, FMPR_RND_UP);
 
             r = fmpr_root(fmprb_midref(z), fmprb_midref(x), k, prec, FMPR_RND_DOWN);
-            fmpr_add_error_result(fmprb_radref(z), err, fmprb_midref(z), r,
-                FMPRB_RAD_PREC, FMPR_RND_UP);
+            mag_set_fmpr(fmprb_radref(z), err);
+            mag_add_error_result(fmprb_radref(z), fmprb_radref(z), fmprb_midref(z), r);
         }
 
         fmpr_clear(t);
         fmpr_clear(u);
         fmpr_clear(err);
+        fmpr_clear(rad);
     }
 
     fmprb_adjust(z);
@@ -33,37 +33,40 @@ fmprb_rsqrt(fmprb_t z, const fmprb_t x, long prec)
     if (fmprb_contains_nonpositive(x))
     {
         fmpr_nan(fmprb_midref(z));
-        fmpr_pos_inf(fmprb_radref(z));
+        mag_inf(fmprb_radref(z));
         return;
     }
 
     if (fmprb_is_exact(x))
     {
         r = fmpr_rsqrt(fmprb_midref(z), fmprb_midref(x), prec, FMPR_RND_DOWN);
-        fmpr_set_error_result(fmprb_radref(z), fmprb_midref(z), r);
+        mag_set_error_result(fmprb_radref(z), fmprb_midref(z), r);
     }
     else
     {
-        fmpr_t t, err;
+        fmpr_t t, err, rad;
 
         fmpr_init(t);
         fmpr_init(err);
+        fmpr_init(rad);
 
         /* lower point */
-        fmpr_sub(t, fmprb_midref(x), fmprb_radref(x), FMPRB_RAD_PREC, FMPR_RND_DOWN);
+        fmprb_get_rad_fmpr(rad, x);
+        fmpr_sub(t, fmprb_midref(x), rad, FMPRB_RAD_PREC, FMPR_RND_DOWN);
 
         /* error bound: (1/2) t^(-3/2) * rad */
         fmpr_rsqrt(err, t, FMPRB_RAD_PREC, FMPR_RND_UP);
         fmpr_divappr_abs_ubound(err, err, t, FMPRB_RAD_PREC);
-        fmpr_mul(err, err, fmprb_radref(x), FMPRB_RAD_PREC, FMPR_RND_UP);
+        fmpr_mul(err, err, rad, FMPRB_RAD_PREC, FMPR_RND_UP);
         fmpr_mul_2exp_si(err, err, -1);
 
         r = fmpr_rsqrt(fmprb_midref(z), fmprb_midref(x), prec, FMPR_RND_DOWN);
-        fmpr_add_error_result(fmprb_radref(z), err, fmprb_midref(z), r,
-            FMPRB_RAD_PREC, FMPR_RND_UP);
+        mag_set_fmpr(fmprb_radref(z), err);
+        mag_add_error_result(fmprb_radref(z), fmprb_radref(z), fmprb_midref(z), r);
 
         fmpr_clear(t);
         fmpr_clear(err);
+        fmpr_clear(rad);
     }
 
     fmprb_adjust(z);
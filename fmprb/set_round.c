@@ -31,8 +31,7 @@ fmprb_set_round(fmprb_t z, const fmprb_t x, long prec)
     long r;
 
     r = fmpr_set_round(fmprb_midref(z), fmprb_midref(x), prec, FMPR_RND_DOWN);
-    fmpr_add_error_result(fmprb_radref(z), fmprb_radref(x),
-        fmprb_midref(z), r, FMPRB_RAD_PREC, FMPR_RND_UP);
+    mag_add_error_result(fmprb_radref(z), fmprb_radref(x), fmprb_midref(z), r);
 
     fmprb_adjust(z);
 }
@@ -0,0 +1,199 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include <ctype.h>
+#include <string.h>
+#include "fmprb.h"
+
+/* parses [+-](inf|nan|d[.d][(e|E)[+-]d]) where d is a nonempty string
+   of digits (one of the digit strings around the point may be empty),
+   setting x to a ball containing the value; returns the number of
+   characters read, or 0 if the string is not a number */
+static long
+_fmprb_set_decimal(fmprb_t x, const char * s, long prec)
+{
+    const char * p;
+    char * buf;
+    fmpz_t m, e;
+    long n, nfrac;
+    int neg;
+
+    p = s;
+    neg = (*p == '-');
+    if (*p == '-' || *p == '+')
+        p++;
+
+    if (strncmp(p, "inf", 3) == 0 || strncmp(p, "nan", 3) == 0)
+    {
+        if (p[0] == 'n')
+            fmpr_nan(fmprb_midref(x));
+        else if (neg)
+            fmpr_neg_inf(fmprb_midref(x));
+        else
+            fmpr_pos_inf(fmprb_midref(x));
+
+        mag_zero(fmprb_radref(x));
+        return p + 3 - s;
+    }
+
+    /* collect the digits of the mantissa */
+    buf = flint_malloc(strlen(p) + 2);
+    n = nfrac = 0;
+
+    if (neg)
+        buf[n++] = '-';
+
+    for ( ; isdigit((unsigned char) *p); p++)
+        buf[n++] = *p;
+
+    if (*p == '.')
+    {
+        for (p++; isdigit((unsigned char) *p); p++)
+        {
+            buf[n++] = *p;
+            nfrac++;
+        }
+    }
+
+    buf[n] = '\0';
+
+    if (n == neg)
+    {
+        flint_free(buf);
+        return 0;
+    }
+
+    fmpz_init(m);
+    fmpz_init(e);
+    fmpz_set_str(m, buf, 10);
+
+    /* exponent */
+    if ((*p == 'e' || *p == 'E') && (isdigit((unsigned char) p[1]) ||
+        ((p[1] == '+' || p[1] == '-') && isdigit((unsigned char) p[2]))))
+    {
+        p++;
+        n = 0;
+
+        if (*p == '-' || *p == '+')
+        {
+            if (*p == '-')
+                buf[n++] = '-';
+            p++;
+        }
+
+        for ( ; isdigit((unsigned char) *p); p++)
+            buf[n++] = *p;
+
+        buf[n] = '\0';
+        fmpz_set_str(e, buf, 10);
+    }
+
+    flint_free(buf);
+
+    fmpz_sub_ui(e, e, nfrac);
+    fmprb_set_fmpz(x, m);
+
+    if (fmpz_is_zero(e))
+    {
+        fmprb_set_round(x, x, prec);
+    }
+    else
+    {
+        fmprb_t t;
+        fmprb_init(t);
+        fmprb_set_ui(t, 10);
+
+        if (fmpz_sgn(e) > 0)
+        {
+            fmprb_pow_fmpz(t, t, e, prec + 10);
+            fmprb_mul(x, x, t, prec);
+        }
+        else
+        {
+            fmpz_neg(e, e);
+            fmprb_pow_fmpz(t, t, e, prec + 10);
+            fmprb_div(x, x, t, prec);
+        }
+
+        fmprb_clear(t);
+    }
+
+    fmpz_clear(m);
+    fmpz_clear(e);
+
+    return p - s;
+}
+
+int
+fmprb_set_str(fmprb_t x, const char * s, long prec)
+{
+    fmprb_t t, u;
+    long n;
+    int result = -1;
+
+    fmprb_init(t);
+    fmprb_init(u);
+
+    while (isspace((unsigned char) *s))
+        s++;
+
+    n = _fmprb_set_decimal(t, s, prec);
+
+    if (n != 0)
+    {
+        s += n;
+
+        while (isspace((unsigned char) *s))
+            s++;
+
+        if (strncmp(s, "+/-", 3) == 0)
+        {
+            s += 3;
+
+            while (isspace((unsigned char) *s))
+                s++;
+
+            n = _fmprb_set_decimal(u, s, FMPRB_RAD_PREC);
+            s += n;
+
+            if (n != 0)
+                fmprb_add_error(t, u);
+
+            while (isspace((unsigned char) *s))
+                s++;
+        }
+
+        if (n != 0 && *s == '\0')
+        {
+            fmprb_swap(x, t);
+            result = 0;
+        }
+    }
+
+    fmprb_clear(t);
+    fmprb_clear(u);
+
+    return result;
+}
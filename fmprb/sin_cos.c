@@ -24,6 +24,7 @@
 ******************************************************************************/
 
 #include "fmprb.h"
+#include "elefun.h"
 
 #define MAGLIM(prec) FLINT_MAX(65536, (4*prec))
 
@@ -61,12 +62,12 @@ fmprb_sin_fmpr(fmprb_t s, const fmpr_t x, long prec, long maglim)
         else if (fmpr_is_nan(x))
         {
             fmpr_nan(fmprb_midref(s));
-            fmpr_pos_inf(fmprb_radref(s));
+            mag_inf(fmprb_radref(s));
         }
         else
         {
             fmpr_zero(fmprb_midref(s));
-            fmpr_one(fmprb_radref(s));
+            mag_one(fmprb_radref(s));
         }
     }
     else
@@ -91,12 +92,13 @@ fmprb_sin_fmpr(fmprb_t s, const fmpr_t x, long prec, long maglim)
         else if (fmpz_cmp_si(mag, maglim) > 0)
         {
             fmpr_zero(fmprb_midref(s));
-            fmpr_one(fmprb_radref(s));
+            mag_one(fmprb_radref(s));
         }
-        else
+        /* use the table-based fixed-point code at low precision */
+        else if (!elefun_sin_cos_precomp(s, NULL, x, prec))
         {
             r = _fmpr_sin(fmprb_midref(s), x, prec, FMPR_RND_DOWN);
-            fmpr_set_error_result(fmprb_radref(s), fmprb_midref(s), r);
+            mag_set_error_result(fmprb_radref(s), fmprb_midref(s), r);
         }
 
         fmpz_clear(mag);
@@ -115,12 +117,12 @@ fmprb_cos_fmpr(fmprb_t c, const fmpr_t x, long prec, long maglim)
         else if (fmpr_is_nan(x))
         {
             fmpr_nan(fmprb_midref(c));
-            fmpr_pos_inf(fmprb_radref(c));
+            mag_inf(fmprb_radref(c));
         }
         else
         {
             fmpr_zero(fmprb_midref(c));
-            fmpr_one(fmprb_radref(c));
+            mag_one(fmprb_radref(c));
         }
     }
     else
@@ -144,12 +146,13 @@ fmprb_cos_fmpr(fmprb_t c, const fmpr_t x, long prec, long maglim)
         else if (fmpz_cmp_si(mag, maglim) > 0)
         {
             fmpr_zero(fmprb_midref(c));
-            fmpr_one(fmprb_radref(c));
+            mag_one(fmprb_radref(c));
         }
-        else
+        /* use the table-based fixed-point code at low precision */
+        else if (!elefun_sin_cos_precomp(NULL, c, x, prec))
         {
             r = _fmpr_cos(fmprb_midref(c), x, prec, FMPR_RND_DOWN);
-            fmpr_set_error_result(fmprb_radref(c), fmprb_midref(c), r);
+            mag_set_error_result(fmprb_radref(c), fmprb_midref(c), r);
         }
 
         fmpz_clear(mag);
@@ -169,13 +172,13 @@ fmprb_sin_cos_fmpr(fmprb_t s, fmprb_t c, const fmpr_t x, long prec, long maglim)
         else if (fmpr_is_nan(x))
         {
             fmpr_nan(fmprb_midref(s));
-            fmpr_pos_inf(fmprb_radref(s));
+            mag_inf(fmprb_radref(s));
             fmprb_set(c, s);
         }
         else
         {
             fmpr_zero(fmprb_midref(s));
-            fmpr_one(fmprb_radref(s));
+            mag_one(fmprb_radref(s));
             fmprb_set(c, s);
         }
     }
@@ -206,14 +209,15 @@ fmprb_sin_cos_fmpr(fmprb_t s, fmprb_t c, const fmpr_t x, long prec, long maglim)
         else if (fmpz_cmp_si(mag, maglim) > 0)
         {
             fmpr_zero(fmprb_midref(s));
-            fmpr_one(fmprb_radref(s));
+            mag_one(fmprb_radref(s));
             fmprb_set(c, s);
         }
-        else
+        /* use the table-based fixed-point code at low precision */
+        else if (!elefun_sin_cos_precomp(s, c, x, prec))
         {
             _fmpr_sin_cos(&r1, &r2, fmprb_midref(s), fmprb_midref(c), x, prec, FMPR_RND_DOWN);
-            fmpr_set_error_result(fmprb_radref(s), fmprb_midref(s), r1);
-            fmpr_set_error_result(fmprb_radref(c), fmprb_midref(c), r2);
+            mag_set_error_result(fmprb_radref(s), fmprb_midref(s), r1);
+            mag_set_error_result(fmprb_radref(c), fmprb_midref(c), r2);
         }
 
         fmpz_clear(mag);
@@ -229,15 +233,15 @@ fmprb_sin(fmprb_t s, const fmprb_t x, long prec)
     }
     else
     {
-        fmpr_t t;
-        fmpr_init(t);
-        if (fmpr_cmpabs_2exp_si(fmprb_radref(x), 1) > 0)
-            fmpr_set_si_2exp_si(t, 1, 1);
+        mag_t t;
+        mag_init(t);
+        if (mag_cmp_2exp_si(fmprb_radref(x), 1) > 0)
+            mag_set_ui_2exp_si(t, 1, 1);
         else
-            fmpr_set(t, fmprb_radref(x));
+            mag_set(t, fmprb_radref(x));
         fmprb_sin_fmpr(s, fmprb_midref(x), prec, MAGLIM(prec));
-        fmpr_add(fmprb_radref(s), fmprb_radref(s), t, FMPRB_RAD_PREC, FMPR_RND_UP);
-        fmpr_clear(t);
+        mag_add(fmprb_radref(s), fmprb_radref(s), t);
+        mag_clear(t);
     }
     fmprb_adjust(s);
 }
@@ -251,15 +255,15 @@ fmprb_cos(fmprb_t c, const fmprb_t x, long prec)
     }
     else
     {
-        fmpr_t t;
-        fmpr_init(t);
-        if (fmpr_cmpabs_2exp_si(fmprb_radref(x), 1) > 0)
-            fmpr_set_si_2exp_si(t, 1, 1);
+        mag_t t;
+        mag_init(t);
+        if (mag_cmp_2exp_si(fmprb_radref(x), 1) > 0)
+            mag_set_ui_2exp_si(t, 1, 1);
         else
-            fmpr_set(t, fmprb_radref(x));
+            mag_set(t, fmprb_radref(x));
         fmprb_cos_fmpr(c, fmprb_midref(x), prec, MAGLIM(prec));
-        fmpr_add(fmprb_radref(c), fmprb_radref(c), t, FMPRB_RAD_PREC, FMPR_RND_UP);
-        fmpr_clear(t);
+        mag_add(fmprb_radref(c), fmprb_radref(c), t);
+        mag_clear(t);
     }
     fmprb_adjust(c);
 }
@@ -273,16 +277,16 @@ fmprb_sin_cos(fmprb_t s, fmprb_t c, const fmprb_t x, long prec)
     }
     else
     {
-        fmpr_t t;
-        fmpr_init(t);
-        if (fmpr_cmpabs_2exp_si(fmprb_radref(x), 1) > 0)
-            fmpr_set_si_2exp_si(t, 1, 1);
+        mag_t t;
+        mag_init(t);
+        if (mag_cmp_2exp_si(fmprb_radref(x), 1) > 0)
+            mag_set_ui_2exp_si(t, 1, 1);
         else
-            fmpr_set(t, fmprb_radref(x));
+            mag_set(t, fmprb_radref(x));
         fmprb_sin_cos_fmpr(s, c, fmprb_midref(x), prec, MAGLIM(prec));
-        fmpr_add(fmprb_radref(s), fmprb_radref(s), t, FMPRB_RAD_PREC, FMPR_RND_UP);
-        fmpr_add(fmprb_radref(c), fmprb_radref(c), t, FMPRB_RAD_PREC, FMPR_RND_UP);
-        fmpr_clear(t);
+        mag_add(fmprb_radref(s), fmprb_radref(s), t);
+        mag_add(fmprb_radref(c), fmprb_radref(c), t);
+        mag_clear(t);
     }
     fmprb_adjust(s);
     fmprb_adjust(c);
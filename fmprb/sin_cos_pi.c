@@ -35,7 +35,7 @@ fmprb_sin_pi(fmprb_t y, const fmprb_t x, long prec)
     if (fmpr_cmpabs_2exp_si(fmprb_midref(x), FLINT_MAX(65536, (4*prec))) > 0)
     {
         fmpr_zero(fmprb_midref(y));
-        fmpr_one(fmprb_radref(y));
+        mag_one(fmprb_radref(y));
         return;
     }
 
@@ -84,7 +84,7 @@ fmprb_cos_pi(fmprb_t y, const fmprb_t x, long prec)
     if (fmpr_cmpabs_2exp_si(fmprb_midref(x), FLINT_MAX(65536, (4*prec))) > 0)
     {
         fmpr_zero(fmprb_midref(y));
-        fmpr_one(fmprb_radref(y));
+        mag_one(fmprb_radref(y));
         return;
     }
 
@@ -133,9 +133,9 @@ fmprb_sin_cos_pi(fmprb_t s, fmprb_t c, const fmprb_t x, long prec)
     if (fmpr_cmpabs_2exp_si(fmprb_midref(x), FLINT_MAX(65536, (4*prec))) > 0)
     {
         fmpr_zero(fmprb_midref(s));
-        fmpr_one(fmprb_radref(s));
+        mag_one(fmprb_radref(s));
         fmpr_zero(fmprb_midref(c));
-        fmpr_one(fmprb_radref(c));
+        mag_one(fmprb_radref(c));
         return;
     }
 
@@ -374,7 +374,7 @@ _fmprb_cos_pi_fmpq_algebraic(fmprb_t c, ulong p, ulong q, long prec)
         if (100 + eval_extra_prec - 10 < prec)
         {
             fmprb_set(interval, c);
-            fmpr_mul_2exp_si(fmprb_radref(interval), fmprb_radref(interval), 1);
+            mag_mul_2exp_si(fmprb_radref(interval), fmprb_radref(interval), 1);
             _fmprb_poly_newton_convergence_factor(interval_bound,
                 fpoly->coeffs, fpoly->length, interval, start_prec);
             _fmprb_poly_newton_refine_root(c, fpoly->coeffs, fpoly->length,
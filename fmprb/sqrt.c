@@ -33,29 +33,32 @@ fmprb_sqrt(fmprb_t z, const fmprb_t x, long prec)
     if (fmprb_contains_negative(x))
     {
         fmpr_nan(fmprb_midref(z));
-        fmpr_pos_inf(fmprb_radref(z));
+        mag_inf(fmprb_radref(z));
         return;
     }
 
     if (fmprb_is_exact(x))
     {
         r = fmpr_sqrt(fmprb_midref(z), fmprb_midref(x), prec, FMPR_RND_DOWN);
-        fmpr_set_error_result(fmprb_radref(z), fmprb_midref(z), r);
+        mag_set_error_result(fmprb_radref(z), fmprb_midref(z), r);
     }
     else
     {
-        fmpr_t err;
+        fmpr_t err, t;
         fmpr_init(err);
-        fmpr_sub(err, fmprb_midref(x), fmprb_radref(x), FMPRB_RAD_PREC, FMPR_RND_DOWN);
+        fmpr_init(t);
+        fmprb_get_rad_fmpr(t, x);
+        fmpr_sub(err, fmprb_midref(x), t, FMPRB_RAD_PREC, FMPR_RND_DOWN);
         fmpr_rsqrt(err, err, FMPRB_RAD_PREC, FMPR_RND_UP);
-        fmpr_mul(err, fmprb_radref(x), err, FMPRB_RAD_PREC, FMPR_RND_UP);
+        fmpr_mul(err, t, err, FMPRB_RAD_PREC, FMPR_RND_UP);
         fmpr_mul_2exp_si(err, err, -1);
 
         r = fmpr_sqrt(fmprb_midref(z), fmprb_midref(x), prec, FMPR_RND_DOWN);
-        fmpr_add_error_result(fmprb_radref(z), err, fmprb_midref(z), r,
-            FMPRB_RAD_PREC, FMPR_RND_UP);
+        mag_set_fmpr(fmprb_radref(z), err);
+        mag_add_error_result(fmprb_radref(z), fmprb_radref(z), fmprb_midref(z), r);
 
         fmpr_clear(err);
+        fmpr_clear(t);
     }
 
     fmprb_adjust(z);
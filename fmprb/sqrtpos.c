@@ -30,16 +30,16 @@ fmprb_nonnegative_part(fmprb_t z, const fmprb_t x, long prec)
 {
     if (fmprb_contains_negative(x))
     {
-        fmpr_add(fmprb_midref(z), fmprb_midref(x), fmprb_radref(x), prec, FMPR_RND_CEIL);
+        fmprb_get_ubound_fmpr(fmprb_midref(z), x, prec);
 
         if (fmpr_sgn(fmprb_midref(z)) <= 0)
         {
-            fmpr_zero(fmprb_radref(z));
+            mag_zero(fmprb_radref(z));
         }
         else
         {
             fmpr_mul_2exp_si(fmprb_midref(z), fmprb_midref(z), -1);
-            fmpr_set(fmprb_midref(z), fmprb_radref(z));
+            mag_set_fmpr(fmprb_radref(z), fmprb_midref(z));
         }
     }
     else
@@ -53,7 +53,7 @@ fmprb_sqrtpos(fmprb_t z, const fmprb_t x, long prec)
 {
     if (!fmprb_is_finite(x))
     {
-        if (fmpr_is_zero(fmprb_radref(x)) && fmpr_is_pos_inf(fmprb_midref(x)))
+        if (mag_is_zero(fmprb_radref(x)) && fmpr_is_pos_inf(fmprb_midref(x)))
             fmprb_pos_inf(z);
         else
             fmprb_zero_pm_inf(z);
@@ -62,8 +62,7 @@ fmprb_sqrtpos(fmprb_t z, const fmprb_t x, long prec)
     {
         fmpr_t t;
         fmpr_init(t);
-        fmpr_add(t, fmprb_midref(x), fmprb_radref(x),
-            FMPRB_RAD_PREC, FMPR_RND_CEIL);
+        fmprb_get_ubound_fmpr(t, x, FMPRB_RAD_PREC);
         if (fmpr_sgn(t) <= 0)
         {
             fmprb_zero(z);
@@ -73,7 +72,7 @@ fmprb_sqrtpos(fmprb_t z, const fmprb_t x, long prec)
             fmpr_sqrt(t, t, FMPRB_RAD_PREC, FMPR_RND_CEIL);
             fmpr_mul_2exp_si(t, t, -1);
             fmpr_set(fmprb_midref(z), t);
-            fmpr_set(fmprb_radref(z), t);
+            mag_set_fmpr(fmprb_radref(z), t);
         }
         fmpr_clear(t);
     }
@@ -0,0 +1,169 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+/* use the thread-local copies in this file */
+#define FMPRB_CACHED_CONSTANT_TLS
+
+#include "fmprb.h"
+#include "thread_pool.h"
+
+DEF_CACHED_CONSTANT(tls_const_pi, fmprb_const_pi_chudnovsky)
+
+typedef struct
+{
+    fmprb_ptr y;
+    const long * prec;
+    int * ok;
+}
+tls_test_arg_t;
+
+static void
+_tls_test_worker(void * arg_ptr, long i)
+{
+    const tls_test_arg_t * arg = (const tls_test_arg_t *) arg_ptr;
+
+    tls_const_pi(arg->y + i, arg->prec[i]);
+
+    /* the copy of this thread is at least as precise as requested */
+    arg->ok[i] = (tls_const_pi_cached_prec >= arg->prec[i]);
+}
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("cached_constant_tls....");
+    fflush(stdout);
+    flint_randinit(state);
+
+    /* the copy keeps the precision of the shared value */
+    for (iter = 0; iter < 100; iter++)
+    {
+        fmprb_t x;
+        long prec, prec2, copy_prec;
+
+        fmprb_init(x);
+
+        prec = 2 + n_randint(state, 1 << n_randint(state, 13));
+        tls_const_pi(x, prec);
+        copy_prec = tls_const_pi_cached_prec;
+
+        if (copy_prec < prec || tls_const_pi_cache.current == NULL ||
+            copy_prec > tls_const_pi_cache.current->prec)
+        {
+            printf("FAIL: copy precision\n");
+            printf("prec = %ld, copy_prec = %ld\n", prec, copy_prec);
+            abort();
+        }
+
+        /* a precision up to that of the copy does not touch the cache */
+        prec2 = 2 + n_randint(state, copy_prec - 1);
+        tls_const_pi(x, prec2);
+
+        if (tls_const_pi_cached_prec != copy_prec ||
+            fmprb_rel_accuracy_bits(x) < prec2 - 4)
+        {
+            printf("FAIL: reuse\n");
+            printf("prec2 = %ld, copy_prec = %ld\n", prec2, copy_prec);
+            abort();
+        }
+
+        /* flint_cleanup() frees the copy of this thread, but not the
+           shared value */
+        if (n_randint(state, 4) == 0)
+        {
+            flint_cleanup();
+
+            if (tls_const_pi_cached_prec != 0 ||
+                tls_const_pi_cache.current == NULL)
+            {
+                printf("FAIL: cleanup\n");
+                abort();
+            }
+        }
+
+        fmprb_clear(x);
+    }
+
+    /* copies in several threads */
+    for (iter = 0; iter < 100; iter++)
+    {
+        tls_test_arg_t arg;
+        fmprb_ptr y;
+        mpfr_t s;
+        long * prec;
+        int * ok;
+        long i, num;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        if (n_randint(state, 4) == 0)
+            thread_pool_clear();
+
+        num = 1 + n_randint(state, 40);
+        y = _fmprb_vec_init(num);
+        prec = flint_malloc(sizeof(long) * num);
+        ok = flint_malloc(sizeof(int) * num);
+
+        for (i = 0; i < num; i++)
+            prec[i] = 2 + n_randint(state, 1 << n_randint(state, 13));
+
+        arg.y = y;
+        arg.prec = prec;
+        arg.ok = ok;
+
+        thread_pool_parallel_for(_tls_test_worker, &arg, num,
+            flint_get_num_threads());
+
+        for (i = 0; i < num; i++)
+        {
+            mpfr_init2(s, prec[i] + 1000);
+            mpfr_const_pi(s, MPFR_RNDN);
+
+            if (!ok[i] || !fmprb_contains_mpfr(y + i, s) ||
+                fmprb_rel_accuracy_bits(y + i) < prec[i] - 4)
+            {
+                printf("FAIL: threads\n\n");
+                printf("prec = %ld, ok = %d\n", prec[i], ok[i]);
+                printf("y = "); fmprb_printd(y + i, prec[i] / 3.33); printf("\n\n");
+                abort();
+            }
+
+            mpfr_clear(s);
+        }
+
+        _fmprb_vec_clear(y, num);
+        flint_free(prec);
+        flint_free(ok);
+    }
+
+    flint_set_num_threads(1);
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,171 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmprb.h"
+#include "thread_pool.h"
+
+#define NUM_CONSTANTS 5
+
+/* defined by DEF_CACHED_CONSTANT in fmprb/const_pi.c */
+extern fmprb_cached_constant_struct fmprb_const_pi_cache;
+
+typedef struct
+{
+    fmprb_ptr y;
+    const int * which;
+    const long * prec;
+}
+constants_test_arg_t;
+
+static void
+_const_eval(fmprb_t y, int which, long prec)
+{
+    switch (which)
+    {
+        case 0: fmprb_const_pi(y, prec); break;
+        case 1: fmprb_const_log2(y, prec); break;
+        case 2: fmprb_const_euler(y, prec); break;
+        case 3: fmprb_const_catalan(y, prec); break;
+        default: fmprb_const_e(y, prec);
+    }
+}
+
+static void
+_const_eval_mpfr(mpfr_t y, int which)
+{
+    switch (which)
+    {
+        case 0: mpfr_const_pi(y, MPFR_RNDN); break;
+        case 1: mpfr_const_log2(y, MPFR_RNDN); break;
+        case 2: mpfr_const_euler(y, MPFR_RNDN); break;
+        case 3: mpfr_const_catalan(y, MPFR_RNDN); break;
+        default: mpfr_set_ui(y, 1, MPFR_RNDN); mpfr_exp(y, y, MPFR_RNDN);
+    }
+}
+
+static void
+_constants_test_worker(void * arg_ptr, long i)
+{
+    const constants_test_arg_t * arg = (const constants_test_arg_t *) arg_ptr;
+
+    _const_eval(arg->y + i, arg->which[i], arg->prec[i]);
+}
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("cached_constants....");
+    fflush(stdout);
+    flint_randinit(state);
+
+    /* several threads requesting the same constants at different
+       precisions at the same time */
+    for (iter = 0; iter < 100; iter++)
+    {
+        constants_test_arg_t arg;
+        fmprb_ptr y;
+        mpfr_t s;
+        int * which;
+        long * prec;
+        long i, num;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        if (n_randint(state, 2))
+            fmprb_cached_constants_clear();
+
+        num = 1 + n_randint(state, 40);
+        y = _fmprb_vec_init(num);
+        which = flint_malloc(sizeof(int) * num);
+        prec = flint_malloc(sizeof(long) * num);
+
+        for (i = 0; i < num; i++)
+        {
+            which[i] = n_randint(state, NUM_CONSTANTS);
+            prec[i] = 2 + n_randint(state, 1 << n_randint(state, 13));
+        }
+
+        arg.y = y;
+        arg.which = which;
+        arg.prec = prec;
+
+        thread_pool_parallel_for(_constants_test_worker, &arg, num,
+            flint_get_num_threads());
+
+        /* the workers run flint_cleanup() when they stop, which must
+           leave the shared values alone */
+        if (n_randint(state, 2))
+        {
+            thread_pool_clear();
+
+            for (i = 0; i < num; i++)
+            {
+                if (which[i] == 0 && (fmprb_const_pi_cache.current == NULL
+                    || fmprb_const_pi_cache.current->prec < prec[i]))
+                {
+                    printf("FAIL: shared value freed by a worker\n");
+                    abort();
+                }
+            }
+        }
+
+        for (i = 0; i < num; i++)
+        {
+            mpfr_init2(s, prec[i] + 1000);
+            _const_eval_mpfr(s, which[i]);
+
+            if (!fmprb_contains_mpfr(y + i, s))
+            {
+                printf("FAIL: containment\n\n");
+                printf("which = %d, prec = %ld\n", which[i], prec[i]);
+                printf("y = "); fmprb_printd(y + i, prec[i] / 3.33); printf("\n\n");
+                abort();
+            }
+
+            if (fmprb_rel_accuracy_bits(y + i) < prec[i] - 4)
+            {
+                printf("FAIL: poor accuracy\n\n");
+                printf("which = %d, prec = %ld\n", which[i], prec[i]);
+                printf("y = "); fmprb_printd(y + i, prec[i] / 3.33); printf("\n\n");
+                abort();
+            }
+
+            mpfr_clear(s);
+        }
+
+        _fmprb_vec_clear(y, num);
+        flint_free(which);
+        flint_free(prec);
+    }
+
+    flint_set_num_threads(1);
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -75,7 +75,7 @@ int main()
 
         fmpz_set_str(v, "128242712910062263687534256886979172776768892732500", 10);
         fmprb_set_fmpz(t, v);
-        fmpr_one(fmprb_radref(t));
+        mag_one(fmprb_radref(t));
         fmpz_ui_pow_ui(v, 10, 50);
         fmprb_div_fmpz(t, t, v, 170);
 
@@ -38,11 +38,13 @@ int main()
     for (iter = 0; iter < 100000; iter++)
     {
         fmprb_t a, b;
+        fmpr_t r;
         fmpq_t am, ar, bm, br, t, u;
         int c1, c2;
 
         fmprb_init(a);
         fmprb_init(b);
+        fmpr_init(r);
 
         fmpq_init(am);
         fmpq_init(ar);
@@ -55,9 +57,11 @@ int main()
         fmprb_randtest(b, state, 1 + n_randint(state, 500), 14);
 
         fmpr_get_fmpq(am, fmprb_midref(a));
-        fmpr_get_fmpq(ar, fmprb_radref(a));
+        fmprb_get_rad_fmpr(r, a);
+        fmpr_get_fmpq(ar, r);
         fmpr_get_fmpq(bm, fmprb_midref(b));
-        fmpr_get_fmpq(br, fmprb_radref(b));
+        fmprb_get_rad_fmpr(r, b);
+        fmpr_get_fmpq(br, r);
 
         c1 = fmprb_contains(a, b);
 
@@ -86,6 +90,7 @@ int main()
 
         fmprb_clear(a);
         fmprb_clear(b);
+        fmpr_clear(r);
 
         fmpq_clear(am);
         fmpq_clear(ar);
@@ -38,12 +38,13 @@ int main()
     for (iter = 0; iter < 10000; iter++)
     {
         fmprb_t a;
-        fmpr_t b;
+        fmpr_t b, r;
         fmpq_t am, ar, bm, t;
         int c1, c2;
 
         fmprb_init(a);
         fmpr_init(b);
+        fmpr_init(r);
 
         fmpq_init(am);
         fmpq_init(ar);
@@ -54,7 +55,8 @@ int main()
         fmpr_randtest(b, state, 1 + n_randint(state, 500), 14);
 
         fmpr_get_fmpq(am, fmprb_midref(a));
-        fmpr_get_fmpq(ar, fmprb_radref(a));
+        fmprb_get_rad_fmpr(r, a);
+        fmpr_get_fmpq(ar, r);
         fmpr_get_fmpq(bm, b);
 
         c1 = fmprb_contains_fmpr(a, b);
@@ -80,6 +82,7 @@ int main()
 
         fmprb_clear(a);
         fmpr_clear(b);
+        fmpr_clear(r);
 
         fmpq_clear(am);
         fmpq_clear(ar);
@@ -0,0 +1,170 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmprb.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("dot....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100000; iter++)
+    {
+        fmprb_ptr x, y, xi, yi, ystart;
+        fmprb_t s, t, init;
+        fmpq * xq, * yq;
+        fmpq_t sq, tq;
+        long i, len, prec, xstep, ystep;
+        int subtract, use_initial;
+
+        len = n_randint(state, 20);
+        prec = 2 + n_randint(state, 300);
+        subtract = n_randint(state, 2);
+        use_initial = n_randint(state, 2);
+        xstep = 1 + n_randint(state, 2);
+        ystep = n_randint(state, 2) ? 1 : -1;
+
+        x = _fmprb_vec_init(len * xstep + 1);
+        y = _fmprb_vec_init(len + 1);
+        xq = flint_malloc(sizeof(fmpq) * (len + 1));
+        yq = flint_malloc(sizeof(fmpq) * (len + 1));
+
+        for (i = 0; i < len + 1; i++)
+        {
+            fmpq_init(xq + i);
+            fmpq_init(yq + i);
+        }
+
+        fmprb_init(s);
+        fmprb_init(t);
+        fmprb_init(init);
+        fmpq_init(sq);
+        fmpq_init(tq);
+
+        /* term i is x[i * xstep] * y[i] or x[i * xstep] * y[len - 1 - i] */
+        ystart = (ystep == 1) ? y : y + len - 1;
+
+        for (i = 0; i < len; i++)
+        {
+            xi = x + i * xstep;
+            yi = ystart + i * ystep;
+
+            switch (n_randint(state, 3))
+            {
+                case 0:
+                    fmprb_randtest(xi, state, 1 + n_randint(state, 400), 1 + n_randint(state, 20));
+                    fmprb_randtest(yi, state, 1 + n_randint(state, 400), 1 + n_randint(state, 20));
+                    break;
+                case 1:
+                    fmprb_randtest_exact(xi, state, 1 + n_randint(state, 200), 1 + n_randint(state, 5));
+                    fmprb_randtest_exact(yi, state, 1 + n_randint(state, 200), 1 + n_randint(state, 5));
+                    break;
+                default:
+                    fmprb_randtest_precise(xi, state, 1 + n_randint(state, 400), 1 + n_randint(state, 100));
+                    fmprb_randtest(yi, state, 1 + n_randint(state, 400), 1 + n_randint(state, 100));
+            }
+
+            fmprb_get_rand_fmpq(xq + i, state, xi, 1 + n_randint(state, 200));
+            fmprb_get_rand_fmpq(yq + i, state, yi, 1 + n_randint(state, 200));
+        }
+
+        fmprb_randtest(init, state, 1 + n_randint(state, 400), 1 + n_randint(state, 20));
+
+        if (use_initial)
+            fmprb_get_rand_fmpq(sq, state, init, 1 + n_randint(state, 200));
+
+        for (i = 0; i < len; i++)
+        {
+            fmpq_mul(tq, xq + i, yq + i);
+
+            if (subtract)
+                fmpq_sub(sq, sq, tq);
+            else
+                fmpq_add(sq, sq, tq);
+        }
+
+        if (use_initial && n_randint(state, 2))
+        {
+            /* aliasing of res and initial */
+            fmprb_set(s, init);
+            _fmprb_vec_dot(s, s, subtract, x, xstep, ystart, ystep, len, prec);
+        }
+        else
+        {
+            _fmprb_vec_dot(s, use_initial ? init : NULL, subtract,
+                x, xstep, ystart, ystep, len, prec);
+        }
+
+        /* naive evaluation */
+        if (use_initial)
+            fmprb_set(t, init);
+
+        for (i = 0; i < len; i++)
+        {
+            if (subtract)
+                fmprb_submul(t, x + i * xstep, ystart + i * ystep, prec);
+            else
+                fmprb_addmul(t, x + i * xstep, ystart + i * ystep, prec);
+        }
+
+        if (!fmprb_contains_fmpq(s, sq) || !fmprb_overlaps(s, t))
+        {
+            printf("FAIL\n\n");
+            printf("iter = %ld, len = %ld, prec = %ld\n\n", iter, len, prec);
+            printf("s = "); fmprb_print(s); printf("\n\n");
+            printf("t = "); fmprb_print(t); printf("\n\n");
+            printf("sq = "); fmpq_print(sq); printf("\n\n");
+            abort();
+        }
+
+        _fmprb_vec_clear(x, len * xstep + 1);
+        _fmprb_vec_clear(y, len + 1);
+        for (i = 0; i < len + 1; i++)
+        {
+            fmpq_clear(xq + i);
+            fmpq_clear(yq + i);
+        }
+
+        flint_free(xq);
+        flint_free(yq);
+
+        fmprb_clear(s);
+        fmprb_clear(t);
+        fmprb_clear(init);
+        fmpq_clear(sq);
+        fmpq_clear(tq);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
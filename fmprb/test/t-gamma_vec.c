@@ -0,0 +1,93 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmprb.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("gamma_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 200; iter++)
+    {
+        fmprb_ptr a, b;
+        fmprb_t c;
+        long i, num, prec1, prec2;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        /* occasionally enough terms and points for fast evaluation */
+        if (iter % 10 == 0)
+        {
+            prec1 = 500 + n_randint(state, 1000);
+            num = 40 + n_randint(state, 40);
+        }
+        else
+        {
+            prec1 = 2 + n_randint(state, 500);
+            num = 1 + n_randint(state, 20);
+        }
+
+        prec2 = prec1 + 30;
+
+        a = _fmprb_vec_init(num);
+        b = _fmprb_vec_init(num);
+        fmprb_init(c);
+
+        for (i = 0; i < num; i++)
+            fmprb_randtest_precise(a + i, state, 1 + n_randint(state, 1000), 3 + n_randint(state, 3));
+
+        fmprb_gamma_vec(b, a, num, prec1);
+
+        for (i = 0; i < num; i++)
+        {
+            fmprb_gamma(c, a + i, prec2);
+
+            if (!fmprb_overlaps(b + i, c))
+            {
+                printf("FAIL: overlap\n\n");
+                printf("num = %ld, i = %ld, prec1 = %ld\n\n", num, i, prec1);
+                printf("a = "); fmprb_print(a + i); printf("\n\n");
+                printf("b = "); fmprb_print(b + i); printf("\n\n");
+                printf("c = "); fmprb_print(c); printf("\n\n");
+                abort();
+            }
+        }
+
+        _fmprb_vec_clear(a, num);
+        _fmprb_vec_clear(b, num);
+        fmprb_clear(c);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
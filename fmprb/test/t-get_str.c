@@ -0,0 +1,113 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmprb.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("get_str....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* the printed ball must contain the original ball */
+    for (iter = 0; iter < 10000; iter++)
+    {
+        fmprb_t x, y;
+        long prec, digits;
+        char * s;
+
+        prec = 2 + n_randint(state, 300);
+        digits = 1 + n_randint(state, 40);
+
+        fmprb_init(x);
+        fmprb_init(y);
+
+        fmprb_randtest(x, state, prec, 10);
+
+        s = fmprb_get_str(x, digits);
+
+        if (fmprb_set_str(y, s, 2 + n_randint(state, 300)) != 0
+            || !fmprb_contains(y, x))
+        {
+            printf("FAIL (roundtrip)\n\n");
+            printf("digits = %ld\n\n", digits);
+            printf("x = "); fmprb_print(x); printf("\n\n");
+            printf("s = %s\n\n", s);
+            printf("y = "); fmprb_print(y); printf("\n\n");
+            abort();
+        }
+
+        flint_free(s);
+        fmprb_clear(x);
+        fmprb_clear(y);
+    }
+
+    /* parsing */
+    {
+        const char * valid[] = { "125", " 1.25e2 ", "+12500e-2", "125.",
+            "0.0125e+4", "125 +/- 0", "1250e-1+/-0.0" };
+        const char * invalid[] = { "", "e5", ".", "1.2.3", "12 +/-",
+            "1e", "12 3", "+/- 1", "0x10" };
+        fmprb_t x, y;
+        int i;
+
+        fmprb_init(x);
+        fmprb_init(y);
+        fmprb_set_ui(y, 125);
+
+        for (i = 0; i < sizeof(valid) / sizeof(char *); i++)
+        {
+            if (fmprb_set_str(x, valid[i], 53) != 0 || !fmprb_equal(x, y))
+            {
+                printf("FAIL (valid)\n\n");
+                printf("s = %s\n\n", valid[i]);
+                printf("x = "); fmprb_print(x); printf("\n\n");
+                abort();
+            }
+        }
+
+        for (i = 0; i < sizeof(invalid) / sizeof(char *); i++)
+        {
+            if (fmprb_set_str(x, invalid[i], 53) == 0)
+            {
+                printf("FAIL (invalid)\n\n");
+                printf("s = %s\n\n", invalid[i]);
+                abort();
+            }
+        }
+
+        fmprb_clear(x);
+        fmprb_clear(y);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
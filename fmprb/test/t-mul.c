@@ -26,13 +26,18 @@
 #include "fmprb.h"
 
 int
-fmpr_close(const fmpr_t a, const fmpr_t b)
+mag_close(const mag_t am, const mag_t bm)
 {
-    fmpr_t t;
+    fmpr_t a, b, t;
     int res1, res2;
 
+    fmpr_init(a);
+    fmpr_init(b);
     fmpr_init(t);
 
+    mag_get_fmpr(a, am);
+    mag_get_fmpr(b, bm);
+
     fmpr_mul_ui(t, b, 257, FMPRB_RAD_PREC, FMPR_RND_UP);
     fmpr_mul_2exp_si(t, t, -8);
     res1 = fmpr_cmp(a, t) <= 0;
@@ -41,6 +46,8 @@ fmpr_close(const fmpr_t a, const fmpr_t b)
     fmpr_mul_2exp_si(t, t, -8);
     res2 = fmpr_cmp(b, t) <= 0;
 
+    fmpr_clear(a);
+    fmpr_clear(b);
     fmpr_clear(t);
 
     return res1 && res2;
@@ -207,7 +214,7 @@ int main()
                 fmprb_mul_naive(v, x, y, prec);
 
                 if (!fmpr_equal(fmprb_midref(z), fmprb_midref(v))
-                    || !fmpr_close(fmprb_radref(z), fmprb_radref(v)))
+                    || !mag_close(fmprb_radref(z), fmprb_radref(v)))
                 {
                     printf("FAIL!\n");
                     printf("x = "); fmprb_print(x); printf("\n\n");
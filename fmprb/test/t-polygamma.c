@@ -0,0 +1,140 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmprb.h"
+#include "fmprb_poly.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("polygamma....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000; iter++)
+    {
+        fmprb_t a, b, c;
+        fmprb_ptr v;
+        fmpz_t f;
+        ulong m;
+        long prec1, prec2;
+
+        prec1 = 2 + n_randint(state, 500);
+        prec2 = prec1 + 30;
+
+        if (n_randint(state, 10) == 0)
+            m = n_randint(state, 50);
+        else
+            m = n_randint(state, 6);
+
+        fmprb_init(a);
+        fmprb_init(b);
+        fmprb_init(c);
+        fmpz_init(f);
+        v = _fmprb_vec_init(m + 2);
+
+        fmprb_randtest_precise(a, state, 1 + n_randint(state, 1000), 4);
+
+        fmprb_polygamma(b, m, a, prec1);
+        fmprb_polygamma(c, m, a, prec2);
+
+        if (!fmprb_overlaps(b, c))
+        {
+            printf("FAIL: overlap\n\n");
+            printf("m = %lu\n\n", m);
+            printf("a = "); fmprb_print(a); printf("\n\n");
+            printf("b = "); fmprb_print(b); printf("\n\n");
+            printf("c = "); fmprb_print(c); printf("\n\n");
+            abort();
+        }
+
+        fmprb_set(c, a);
+        fmprb_polygamma(c, m, c, prec2);
+        if (!fmprb_overlaps(b, c))
+        {
+            printf("FAIL: aliasing\n\n");
+            printf("m = %lu\n\n", m);
+            printf("a = "); fmprb_print(a); printf("\n\n");
+            printf("b = "); fmprb_print(b); printf("\n\n");
+            printf("c = "); fmprb_print(c); printf("\n\n");
+            abort();
+        }
+
+        /* compare with the power series of log gamma */
+        if (m < 6 && fmprb_is_positive(a))
+        {
+            fmprb_set(v, a);
+            fmprb_one(v + 1);
+            _fmprb_poly_lgamma_series(v, v, 2, m + 2, prec1);
+            fmpz_fac_ui(f, m + 1);
+            fmprb_mul_fmpz(c, v + m + 1, f, prec1);
+
+            if (!fmprb_overlaps(b, c))
+            {
+                printf("FAIL: lgamma series\n\n");
+                printf("m = %lu\n\n", m);
+                printf("a = "); fmprb_print(a); printf("\n\n");
+                printf("b = "); fmprb_print(b); printf("\n\n");
+                printf("c = "); fmprb_print(c); printf("\n\n");
+                abort();
+            }
+        }
+
+        /* check psi^(m)(z+1) = psi^(m)(z) + (-1)^m m! / z^(m+1) */
+        fmprb_inv(c, a, prec1);
+        fmprb_pow_ui(c, c, m + 1, prec1);
+        fmpz_fac_ui(f, m);
+        fmprb_mul_fmpz(c, c, f, prec1);
+        if (m % 2 == 1)
+            fmprb_neg(c, c);
+        fmprb_add(b, b, c, prec1);
+        fmprb_add_ui(c, a, 1, prec1);
+        fmprb_polygamma(c, m, c, prec1);
+
+        if (!fmprb_overlaps(b, c))
+        {
+            printf("FAIL: functional equation\n\n");
+            printf("m = %lu\n\n", m);
+            printf("a = "); fmprb_print(a); printf("\n\n");
+            printf("b = "); fmprb_print(b); printf("\n\n");
+            printf("c = "); fmprb_print(c); printf("\n\n");
+            abort();
+        }
+
+        fmprb_clear(a);
+        fmprb_clear(b);
+        fmprb_clear(c);
+        fmpz_clear(f);
+        _fmprb_vec_clear(v, m + 2);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
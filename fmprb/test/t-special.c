@@ -54,14 +54,14 @@ int main()
     fmprb_neg(neg, pos);
     fmprb_pos_inf(pos_inf);
     fmprb_neg_inf(neg_inf);
-    fmprb_pos_inf(pos_inf_err); fmpr_set_ui(fmprb_radref(pos_inf_err), 3);
+    fmprb_pos_inf(pos_inf_err); mag_set_ui_2exp_si(fmprb_radref(pos_inf_err), 3, 0);
     fmprb_neg(neg_inf_err, pos_inf_err);
     fmprb_zero_pm_inf(zero_pm_inf);
-    fmpr_set_si(fmprb_midref(pos_pm_inf), 3); fmpr_pos_inf(fmprb_radref(pos_pm_inf));
-    fmpr_set_si(fmprb_midref(neg_pm_inf), -3); fmpr_pos_inf(fmprb_radref(neg_pm_inf));
-    fmpr_nan(fmprb_midref(indet_exact)); fmpr_zero(fmprb_radref(indet_exact));
-    fmpr_nan(fmprb_midref(indet_pos_rad)); fmpr_set_si(fmprb_radref(indet_pos_rad), 3);
-    fmpr_nan(fmprb_midref(indet_inf_rad)); fmpr_pos_inf(fmprb_radref(indet_inf_rad));
+    fmpr_set_si(fmprb_midref(pos_pm_inf), 3); mag_inf(fmprb_radref(pos_pm_inf));
+    fmpr_set_si(fmprb_midref(neg_pm_inf), -3); mag_inf(fmprb_radref(neg_pm_inf));
+    fmpr_nan(fmprb_midref(indet_exact)); mag_zero(fmprb_radref(indet_exact));
+    fmpr_nan(fmprb_midref(indet_pos_rad)); mag_set_ui_2exp_si(fmprb_radref(indet_pos_rad), 3, 0);
+    fmpr_nan(fmprb_midref(indet_inf_rad)); mag_inf(fmprb_radref(indet_inf_rad));
 
     ASSERT(fmprb_is_zero(zero));
     ASSERT(!fmprb_is_zero(pos));
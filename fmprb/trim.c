@@ -30,11 +30,11 @@
 void
 fmprb_trim(fmprb_t y, const fmprb_t x)
 {
-    if (fmpr_is_zero(fmprb_radref(x)) || fmpr_is_special(fmprb_midref(x)))
+    if (mag_is_zero(fmprb_radref(x)) || fmpr_is_special(fmprb_midref(x)))
     {
         fmprb_set(y, x);
     }
-    else if (fmpr_is_special(fmprb_radref(x)))
+    else if (mag_is_special(fmprb_radref(x)))
     {
         /* midpoint must be finite, so set to 0 +/- inf */
         fmprb_zero_pm_inf(y);
@@ -49,11 +49,12 @@ fmprb_trim(fmprb_t y, const fmprb_t x)
         if (accuracy < -TRIM_PADDING)
         {
             /* set to 0 +/- rad */
-            if (fmpr_sgn(fmprb_midref(x)) < 0)
-                fmpr_sub(fmprb_radref(y), fmprb_radref(x), fmprb_midref(x), FMPRB_RAD_PREC, FMPR_RND_UP);
-            else
-                fmpr_add(fmprb_radref(y), fmprb_radref(x), fmprb_midref(x), FMPRB_RAD_PREC, FMPR_RND_UP);
+            mag_t t;
+            mag_init(t);
+            mag_set_fmpr(t, fmprb_midref(x));
+            mag_add(fmprb_radref(y), fmprb_radref(x), t);
             fmpr_zero(fmprb_midref(y));
+            mag_clear(t);
         }
         else if (accuracy < bits - TRIM_PADDING)
         {
@@ -36,7 +36,7 @@ fmprb_union(fmprb_t z, const fmprb_t x, const fmprb_t y, long prec)
         return;
     }
 
-    if (fmpr_is_pos_inf(fmprb_radref(x)) || fmpr_is_pos_inf(fmprb_radref(y)))
+    if (mag_is_inf(fmprb_radref(x)) || mag_is_inf(fmprb_radref(y)))
     {
         fmprb_zero_pm_inf(z);
         return;
@@ -46,12 +46,12 @@ fmprb_union(fmprb_t z, const fmprb_t x, const fmprb_t y, long prec)
     fmpr_init(right);
     fmpr_init(t);
 
-    fmpr_sub(left, fmprb_midref(x), fmprb_radref(x), prec, FMPR_RND_FLOOR);
-    fmpr_sub(t, fmprb_midref(y), fmprb_radref(y), prec, FMPR_RND_FLOOR);
+    fmprb_get_lbound_fmpr(left, x, prec);
+    fmprb_get_lbound_fmpr(t, y, prec);
     fmpr_min(left, left, t);
 
-    fmpr_add(right, fmprb_midref(x), fmprb_radref(x), prec, FMPR_RND_CEIL);
-    fmpr_add(t, fmprb_midref(y), fmprb_radref(y), prec, FMPR_RND_CEIL);
+    fmprb_get_ubound_fmpr(right, x, prec);
+    fmprb_get_ubound_fmpr(t, y, prec);
     fmpr_max(right, right, t);
 
     fmprb_set_interval_fmpr(z, left, right, prec);
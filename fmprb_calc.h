@@ -39,6 +39,9 @@ extern TLS_PREFIX int fmprb_calc_verbose;
 typedef int (*fmprb_calc_func_t)(fmprb_ptr out,
     const fmprb_t inp, void * param, long order, long prec);
 
+typedef int (*fmprb_calc_vec_func_t)(fmprb_ptr out,
+    fmprb_srcptr inp, long num, void * param, long order, long prec);
+
 #define FMPRB_CALC_SUCCESS 0
 #define FMPRB_CALC_IMPRECISE_INPUT 1
 #define FMPRB_CALC_NO_CONVERGENCE 2
@@ -50,6 +53,16 @@ long fmprb_calc_isolate_roots(fmprb_ptr * blocks, int ** flags,
     const fmprb_t block, long maxdepth, long maxeval, long maxfound,
     long prec);
 
+long fmprb_calc_isolate_roots_threaded(fmprb_ptr * blocks, int ** flags,
+    fmprb_calc_func_t func, void * param,
+    const fmprb_t block, long maxdepth, long maxeval, long maxfound,
+    long prec);
+
+long fmprb_calc_isolate_roots_vec(fmprb_ptr * blocks, int ** flags,
+    fmprb_calc_vec_func_t func, void * param,
+    const fmprb_t block, long maxdepth, long maxeval, long maxfound,
+    long prec);
+
 int fmprb_calc_refine_root_bisect(fmprb_t r, fmprb_calc_func_t func,
     void * param, const fmprb_t start, long iter, long prec);
 
@@ -63,6 +76,11 @@ int fmprb_calc_refine_root_newton(fmprb_t r, fmprb_calc_func_t func,
     void * param, const fmprb_t start, const fmprb_t conv_region,
     const fmpr_t conv_factor, long eval_extra_prec, long prec);
 
+int fmprb_calc_refine_roots_newton_threaded(fmprb_ptr r, int * results,
+    fmprb_calc_func_t func, void * param, fmprb_srcptr start,
+    fmprb_srcptr conv_region, const fmpr_struct * conv_factor, long num,
+    long eval_extra_prec, long prec);
+
 #ifdef __cplusplus
 }
 #endif
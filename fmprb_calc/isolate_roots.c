@@ -41,8 +41,8 @@ _fmprb_sign(const fmprb_t t)
         return 0;
 }
 
-static int
-check_block(fmprb_calc_func_t func, void * param, const fmprb_t block,
+int
+_fmprb_calc_check_block(fmprb_calc_func_t func, void * param, const fmprb_t block,
     int asign, int bsign, long prec)
 {
     fmprb_struct t[2];
@@ -78,29 +78,33 @@ check_block(fmprb_calc_func_t func, void * param, const fmprb_t block,
     return result;
 }
 
-static int
-partition(fmprb_t L, fmprb_t R,
+int
+_fmprb_calc_partition(fmprb_t L, fmprb_t R,
     fmprb_calc_func_t func, void * param, const fmprb_t block, long prec)
 {
     fmprb_t t, m;
+    fmpr_t r;
     int msign;
 
     fmprb_init(t);
     fmprb_init(m);
+    fmpr_init(r);
 
     fmprb_set_fmpr(m, fmprb_midref(block));
     func(t, m, param, 1, prec);
     msign = _fmprb_sign(t);
 
-    fmpr_mul_2exp_si(fmprb_radref(L), fmprb_radref(block), -1);
-    fmpr_set(fmprb_radref(R), fmprb_radref(L));
+    mag_mul_2exp_si(fmprb_radref(L), fmprb_radref(block), -1);
+    mag_set(fmprb_radref(R), fmprb_radref(L));
 
     /* XXX: deal with huge shifts */
-    fmpr_sub(fmprb_midref(L), fmprb_midref(block), fmprb_radref(L), FMPR_PREC_EXACT, FMPR_RND_DOWN);
-    fmpr_add(fmprb_midref(R), fmprb_midref(block), fmprb_radref(R), FMPR_PREC_EXACT, FMPR_RND_DOWN);
+    fmprb_get_rad_fmpr(r, L);
+    fmpr_sub(fmprb_midref(L), fmprb_midref(block), r, FMPR_PREC_EXACT, FMPR_RND_DOWN);
+    fmpr_add(fmprb_midref(R), fmprb_midref(block), r, FMPR_PREC_EXACT, FMPR_RND_DOWN);
 
     fmprb_clear(t);
     fmprb_clear(m);
+    fmpr_clear(r);
 
     return msign;
 }
@@ -138,7 +142,7 @@ isolate_roots_recursive(fmprb_ptr * blocks, int ** flags,
     else
     {
         *eval_count -= 1;
-        status = check_block(func, param, block, asign, bsign, prec);
+        status = _fmprb_calc_check_block(func, param, block, asign, bsign, prec);
 
         if (status != BLOCK_NO_ZERO)
         {
@@ -166,7 +170,7 @@ isolate_roots_recursive(fmprb_ptr * blocks, int ** flags,
                 fmprb_init(L);
                 fmprb_init(R);
 
-                msign = partition(L, R, func, param, block, prec);
+                msign = _fmprb_calc_partition(L, R, func, param, block, prec);
 
                 if (msign == 0 && fmprb_calc_verbose)
                 {
@@ -211,11 +215,11 @@ fmprb_calc_isolate_roots(fmprb_ptr * blocks, int ** flags,
     fmprb_init(u);
 
     /* XXX: deal with huge shifts */
-    fmpr_sub(fmprb_midref(t), fmprb_midref(block), fmprb_radref(block), FMPR_PREC_EXACT, FMPR_RND_DOWN);
+    fmprb_get_lbound_fmpr(fmprb_midref(t), block, FMPR_PREC_EXACT);
     func(u, t, param, 1, prec);
     asign = _fmprb_sign(u);
 
-    fmpr_add(fmprb_midref(t), fmprb_midref(block), fmprb_radref(block), FMPR_PREC_EXACT, FMPR_RND_DOWN);
+    fmprb_get_ubound_fmpr(fmprb_midref(t), block, FMPR_PREC_EXACT);
     func(u, t, param, 1, prec);
     bsign = _fmprb_sign(u);
 
@@ -0,0 +1,289 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include <pthread.h>
+#include "fmprb_calc.h"
+#include "thread_pool.h"
+
+#define BLOCK_NO_ZERO 0
+#define BLOCK_ISOLATED_ZERO 1
+#define BLOCK_UNKNOWN 2
+
+int _fmprb_calc_check_block(fmprb_calc_func_t func, void * param,
+    const fmprb_t block, int asign, int bsign, long prec);
+
+int _fmprb_calc_partition(fmprb_t L, fmprb_t R,
+    fmprb_calc_func_t func, void * param, const fmprb_t block, long prec);
+
+static __inline__ int
+_fmprb_sign(const fmprb_t t)
+{
+    if (fmprb_is_positive(t))
+        return 1;
+    else if (fmprb_is_negative(t))
+        return -1;
+    else
+        return 0;
+}
+
+typedef struct
+{
+    fmprb_struct block;
+    int asign;
+    int bsign;
+    long depth;
+}
+isolate_item_t;
+
+typedef struct
+{
+    fmprb_struct block;
+    int flag;
+}
+isolate_output_t;
+
+/* all fields except func, param and prec are protected by lock */
+typedef struct
+{
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+
+    /* blocks waiting to be tested, used as a stack */
+    isolate_item_t * queue;
+    long queue_len;
+    long queue_alloc;
+
+    isolate_output_t * out;
+    long out_len;
+    long out_alloc;
+
+    /* number of workers currently testing a block */
+    long active;
+
+    long eval_count;
+    long found_count;
+
+    fmprb_calc_func_t func;
+    void * param;
+    long prec;
+}
+isolate_state_t;
+
+static void
+_isolate_push(isolate_state_t * S, const fmprb_t block,
+    int asign, int bsign, long depth)
+{
+    isolate_item_t * item;
+
+    if (S->queue_len >= S->queue_alloc)
+    {
+        S->queue_alloc = FLINT_MAX(16, 2 * S->queue_alloc);
+        S->queue = flint_realloc(S->queue, sizeof(isolate_item_t) * S->queue_alloc);
+    }
+
+    item = S->queue + S->queue_len;
+    fmprb_init(&item->block);
+    fmprb_set(&item->block, block);
+    item->asign = asign;
+    item->bsign = bsign;
+    item->depth = depth;
+
+    S->queue_len++;
+}
+
+static void
+_isolate_output(isolate_state_t * S, const fmprb_t block, int flag)
+{
+    if (S->out_len >= S->out_alloc)
+    {
+        S->out_alloc = FLINT_MAX(16, 2 * S->out_alloc);
+        S->out = flint_realloc(S->out, sizeof(isolate_output_t) * S->out_alloc);
+    }
+
+    fmprb_init(&S->out[S->out_len].block);
+    fmprb_set(&S->out[S->out_len].block, block);
+    S->out[S->out_len].flag = flag;
+    S->out_len++;
+}
+
+static void
+_isolate_worker(void * arg_ptr, long i)
+{
+    isolate_state_t * S = (isolate_state_t *) arg_ptr;
+    isolate_item_t item;
+    fmprb_t L, R;
+    int status, msign;
+
+    fmprb_init(L);
+    fmprb_init(R);
+
+    pthread_mutex_lock(&S->lock);
+
+    while (1)
+    {
+        while (S->queue_len == 0 && S->active > 0)
+            pthread_cond_wait(&S->wake, &S->lock);
+
+        /* nothing is queued and nobody can add more blocks */
+        if (S->queue_len == 0)
+            break;
+
+        item = S->queue[--S->queue_len];
+
+        /* out of budget: report the block as undecided */
+        if (S->found_count <= 0 || S->eval_count <= 0)
+        {
+            _isolate_output(S, &item.block, BLOCK_UNKNOWN);
+            fmprb_clear(&item.block);
+            continue;
+        }
+
+        S->eval_count--;
+        S->active++;
+        pthread_mutex_unlock(&S->lock);
+
+        status = _fmprb_calc_check_block(S->func, S->param, &item.block,
+            item.asign, item.bsign, S->prec);
+
+        if (status != BLOCK_NO_ZERO && status != BLOCK_ISOLATED_ZERO
+            && item.depth > 0)
+        {
+            msign = _fmprb_calc_partition(L, R, S->func, S->param,
+                &item.block, S->prec);
+
+            pthread_mutex_lock(&S->lock);
+
+            /* the left half is popped first */
+            _isolate_push(S, R, msign, item.bsign, item.depth - 1);
+            _isolate_push(S, L, item.asign, msign, item.depth - 1);
+            pthread_cond_broadcast(&S->wake);
+        }
+        else
+        {
+            pthread_mutex_lock(&S->lock);
+
+            /* other workers may have used up the budget while this
+               block was tested */
+            if (status == BLOCK_ISOLATED_ZERO)
+            {
+                if (S->found_count > 0)
+                    S->found_count--;
+                else
+                    status = BLOCK_UNKNOWN;
+            }
+
+            if (status != BLOCK_NO_ZERO)
+                _isolate_output(S, &item.block, status);
+        }
+
+        fmprb_clear(&item.block);
+
+        S->active--;
+        if (S->active == 0 && S->queue_len == 0)
+            pthread_cond_broadcast(&S->wake);
+    }
+
+    pthread_mutex_unlock(&S->lock);
+
+    fmprb_clear(L);
+    fmprb_clear(R);
+}
+
+static int
+_isolate_output_cmp(const void * a, const void * b)
+{
+    return fmpr_cmp(fmprb_midref(&((const isolate_output_t *) a)->block),
+                    fmprb_midref(&((const isolate_output_t *) b)->block));
+}
+
+long
+fmprb_calc_isolate_roots_threaded(fmprb_ptr * blocks, int ** flags,
+    fmprb_calc_func_t func, void * param,
+    const fmprb_t block, long maxdepth, long maxeval, long maxfound,
+    long prec)
+{
+    isolate_state_t S;
+    int asign, bsign;
+    long i, num_threads;
+    fmprb_t t, u;
+
+    num_threads = flint_get_num_threads();
+
+    if (num_threads < 2)
+        return fmprb_calc_isolate_roots(blocks, flags, func, param,
+            block, maxdepth, maxeval, maxfound, prec);
+
+    fmprb_init(t);
+    fmprb_init(u);
+
+    /* XXX: deal with huge shifts */
+    fmprb_get_lbound_fmpr(fmprb_midref(t), block, FMPR_PREC_EXACT);
+    func(u, t, param, 1, prec);
+    asign = _fmprb_sign(u);
+
+    fmprb_get_ubound_fmpr(fmprb_midref(t), block, FMPR_PREC_EXACT);
+    func(u, t, param, 1, prec);
+    bsign = _fmprb_sign(u);
+
+    fmprb_clear(t);
+    fmprb_clear(u);
+
+    pthread_mutex_init(&S.lock, NULL);
+    pthread_cond_init(&S.wake, NULL);
+    S.queue = NULL;
+    S.queue_len = S.queue_alloc = 0;
+    S.out = NULL;
+    S.out_len = S.out_alloc = 0;
+    S.active = 0;
+    S.eval_count = maxeval;
+    S.found_count = maxfound;
+    S.func = func;
+    S.param = param;
+    S.prec = prec;
+
+    _isolate_push(&S, block, asign, bsign, maxdepth);
+
+    thread_pool_parallel_for(_isolate_worker, &S, num_threads, num_threads);
+
+    /* the subintervals are disjoint, so sorting by midpoint gives
+       the same order as the serial version */
+    qsort(S.out, S.out_len, sizeof(isolate_output_t), _isolate_output_cmp);
+
+    *blocks = flint_malloc(sizeof(fmprb_struct) * FLINT_MAX(S.out_len, 1));
+    *flags = flint_malloc(sizeof(int) * FLINT_MAX(S.out_len, 1));
+
+    for (i = 0; i < S.out_len; i++)
+    {
+        (*blocks)[i] = S.out[i].block;
+        (*flags)[i] = S.out[i].flag;
+    }
+
+    flint_free(S.queue);
+    flint_free(S.out);
+    pthread_mutex_destroy(&S.lock);
+    pthread_cond_destroy(&S.wake);
+
+    return S.out_len;
+}
@@ -0,0 +1,290 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmprb_calc.h"
+
+#define BLOCK_NO_ZERO 0
+#define BLOCK_ISOLATED_ZERO 1
+#define BLOCK_UNKNOWN 2
+
+static __inline__ int
+_fmprb_sign(const fmprb_t t)
+{
+    if (fmprb_is_positive(t))
+        return 1;
+    else if (fmprb_is_negative(t))
+        return -1;
+    else
+        return 0;
+}
+
+typedef struct
+{
+    fmprb_struct block;
+    int flag;
+}
+isolate_output_t;
+
+typedef struct
+{
+    isolate_output_t * out;
+    long len;
+    long alloc;
+}
+isolate_output_list_t;
+
+static void
+_isolate_output(isolate_output_list_t * L, const fmprb_t block, int flag)
+{
+    if (L->len >= L->alloc)
+    {
+        L->alloc = FLINT_MAX(16, 2 * L->alloc);
+        L->out = flint_realloc(L->out, sizeof(isolate_output_t) * L->alloc);
+    }
+
+    fmprb_init(&L->out[L->len].block);
+    fmprb_set(&L->out[L->len].block, block);
+    L->out[L->len].flag = flag;
+    L->len++;
+}
+
+static int
+_isolate_output_cmp(const void * a, const void * b)
+{
+    return fmpr_cmp(fmprb_midref(&((const isolate_output_t *) a)->block),
+                    fmprb_midref(&((const isolate_output_t *) b)->block));
+}
+
+long
+fmprb_calc_isolate_roots_vec(fmprb_ptr * blocks, int ** flags,
+    fmprb_calc_vec_func_t func, void * param,
+    const fmprb_t block, long maxdepth, long maxeval, long maxfound,
+    long prec)
+{
+    isolate_output_list_t output;
+    fmprb_ptr cur, next, vals, cand;
+    int * asign, * bsign, * status;
+    long * cand_index;
+    long i, j, len, num_test, num_cand, num_split, depth;
+
+    output.out = NULL;
+    output.len = output.alloc = 0;
+
+    /* the subintervals at the current level of bisection */
+    len = 1;
+    cur = _fmprb_vec_init(1);
+    asign = flint_malloc(sizeof(int));
+    bsign = flint_malloc(sizeof(int));
+    fmprb_set(cur, block);
+
+    /* signs at both endpoints, in one call */
+    {
+        fmprb_ptr t, u;
+
+        t = _fmprb_vec_init(2);
+        u = _fmprb_vec_init(2);
+
+        /* XXX: deal with huge shifts */
+        fmprb_get_lbound_fmpr(fmprb_midref(t), block, FMPR_PREC_EXACT);
+        fmprb_get_ubound_fmpr(fmprb_midref(t + 1), block, FMPR_PREC_EXACT);
+        func(u, t, 2, param, 1, prec);
+        asign[0] = _fmprb_sign(u);
+        bsign[0] = _fmprb_sign(u + 1);
+
+        _fmprb_vec_clear(t, 2);
+        _fmprb_vec_clear(u, 2);
+    }
+
+    for (depth = maxdepth; len > 0; depth--)
+    {
+        /* out of budget: report the remaining blocks as undecided */
+        num_test = (maxfound > 0) ? FLINT_MIN(len, FLINT_MAX(maxeval, 0)) : 0;
+        maxeval -= num_test;
+
+        for (i = num_test; i < len; i++)
+            _isolate_output(&output, cur + i, BLOCK_UNKNOWN);
+
+        if (num_test == 0)
+            break;
+
+        status = flint_malloc(sizeof(int) * num_test);
+
+        /* evaluate f on all blocks */
+        vals = _fmprb_vec_init(num_test);
+        func(vals, cur, num_test, param, 1, prec);
+
+        num_cand = 0;
+        cand_index = flint_malloc(sizeof(long) * num_test);
+
+        for (i = 0; i < num_test; i++)
+        {
+            if (fmprb_is_positive(vals + i) || fmprb_is_negative(vals + i))
+            {
+                status[i] = BLOCK_NO_ZERO;
+            }
+            else
+            {
+                status[i] = BLOCK_UNKNOWN;
+
+                if ((asign[i] < 0 && bsign[i] > 0) || (asign[i] > 0 && bsign[i] < 0))
+                    cand_index[num_cand++] = i;
+            }
+        }
+
+        _fmprb_vec_clear(vals, num_test);
+
+        /* evaluate f' on the blocks with a sign change */
+        if (num_cand > 0)
+        {
+            cand = _fmprb_vec_init(num_cand);
+            vals = _fmprb_vec_init(2 * num_cand);
+
+            for (j = 0; j < num_cand; j++)
+                fmprb_set(cand + j, cur + cand_index[j]);
+
+            func(vals, cand, num_cand, param, 2, prec);
+
+            for (j = 0; j < num_cand; j++)
+            {
+                if (fmprb_is_finite(vals + 2 * j + 1)
+                    && !fmprb_contains_zero(vals + 2 * j + 1))
+                {
+                    status[cand_index[j]] = BLOCK_ISOLATED_ZERO;
+                }
+            }
+
+            _fmprb_vec_clear(cand, num_cand);
+            _fmprb_vec_clear(vals, 2 * num_cand);
+        }
+
+        /* output the decided blocks; move the others to the front */
+        num_split = 0;
+
+        for (i = 0; i < num_test; i++)
+        {
+            if (status[i] == BLOCK_NO_ZERO)
+                continue;
+
+            if (status[i] == BLOCK_ISOLATED_ZERO || depth <= 0)
+            {
+                if (status[i] == BLOCK_ISOLATED_ZERO)
+                {
+                    if (fmprb_calc_verbose)
+                    {
+                        printf("found isolated root in: ");
+                        fmprb_printd(cur + i, 15);
+                        printf("\n");
+                    }
+
+                    maxfound--;
+                }
+
+                _isolate_output(&output, cur + i, status[i]);
+            }
+            else
+            {
+                fmprb_swap(cur + num_split, cur + i);
+                asign[num_split] = asign[i];
+                bsign[num_split] = bsign[i];
+                num_split++;
+            }
+        }
+
+        flint_free(status);
+        flint_free(cand_index);
+
+        /* evaluate f at all midpoints and bisect */
+        next = _fmprb_vec_init(2 * num_split);
+        vals = _fmprb_vec_init(num_split);
+
+        for (i = 0; i < num_split; i++)
+            fmprb_set_fmpr(next + i, fmprb_midref(cur + i));
+
+        if (num_split > 0)
+            func(vals, next, num_split, param, 1, prec);
+
+        asign = flint_realloc(asign, sizeof(int) * FLINT_MAX(1, 2 * num_split));
+        bsign = flint_realloc(bsign, sizeof(int) * FLINT_MAX(1, 2 * num_split));
+
+        for (i = num_split - 1; i >= 0; i--)
+        {
+            fmprb_ptr L = next + 2 * i;
+            fmprb_ptr R = next + 2 * i + 1;
+            int msign = _fmprb_sign(vals + i);
+            fmpr_t r;
+
+            if (msign == 0 && fmprb_calc_verbose)
+            {
+                printf("possible zero at midpoint: ");
+                fmprb_printd(cur + i, 15);
+                printf("\n");
+            }
+
+            mag_mul_2exp_si(fmprb_radref(L), fmprb_radref(cur + i), -1);
+            mag_set(fmprb_radref(R), fmprb_radref(L));
+
+            /* XXX: deal with huge shifts */
+            fmpr_init(r);
+            fmprb_get_rad_fmpr(r, L);
+            fmpr_sub(fmprb_midref(L), fmprb_midref(cur + i), r, FMPR_PREC_EXACT, FMPR_RND_DOWN);
+            fmpr_add(fmprb_midref(R), fmprb_midref(cur + i), r, FMPR_PREC_EXACT, FMPR_RND_DOWN);
+
+            /* in place, from the right so that no sign is overwritten early */
+            asign[2 * i + 1] = msign;
+            bsign[2 * i + 1] = bsign[i];
+            bsign[2 * i] = msign;
+            asign[2 * i] = asign[i];
+
+            fmpr_clear(r);
+        }
+
+        _fmprb_vec_clear(vals, num_split);
+        _fmprb_vec_clear(cur, len);
+
+        cur = next;
+        len = 2 * num_split;
+    }
+
+    _fmprb_vec_clear(cur, len);
+    flint_free(asign);
+    flint_free(bsign);
+
+    /* the subintervals are disjoint, so sorting by midpoint gives
+       the same order as the serial version */
+    qsort(output.out, output.len, sizeof(isolate_output_t), _isolate_output_cmp);
+
+    *blocks = flint_malloc(sizeof(fmprb_struct) * FLINT_MAX(output.len, 1));
+    *flags = flint_malloc(sizeof(int) * FLINT_MAX(output.len, 1));
+
+    for (i = 0; i < output.len; i++)
+    {
+        (*blocks)[i] = output.out[i].block;
+        (*flags)[i] = output.out[i].flag;
+    }
+
+    flint_free(output.out);
+
+    return output.len;
+}
@@ -39,11 +39,12 @@ int fmprb_calc_newton_step(fmprb_t xnew, fmprb_calc_func_t func,
     fmprb_init(u + 0);
     fmprb_init(u + 1);
 
-    fmpr_mul(err, fmprb_radref(x), fmprb_radref(x), FMPRB_RAD_PREC, FMPR_RND_UP);
+    fmprb_get_rad_fmpr(err, x);
+    fmpr_mul(err, err, err, FMPRB_RAD_PREC, FMPR_RND_UP);
     fmpr_mul(err, err, conv_factor, FMPRB_RAD_PREC, FMPR_RND_UP);
 
     fmpr_set(fmprb_midref(t), fmprb_midref(x));
-    fmpr_zero(fmprb_radref(t));
+    mag_zero(fmprb_radref(t));
 
     func(u, t, param, 2, prec);
 
@@ -53,7 +54,7 @@ int fmprb_calc_newton_step(fmprb_t xnew, fmprb_calc_func_t func,
     fmprb_add_error_fmpr(u, err);
 
     if (fmprb_contains(conv_region, u) &&
-        (fmpr_cmp(fmprb_radref(u), fmprb_radref(x)) < 0))
+        (mag_cmp(fmprb_radref(u), fmprb_radref(x)) < 0))
     {
         fmprb_swap(xnew, u);
         result = FMPRB_CALC_SUCCESS;
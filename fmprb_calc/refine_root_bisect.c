@@ -44,25 +44,29 @@ partition(fmprb_t L, fmprb_t R,
     fmprb_calc_func_t func, void * param, const fmprb_t block, long prec)
 {
     fmprb_t t, m;
+    fmpr_t r;
     int msign;
 
     fmprb_init(t);
     fmprb_init(m);
+    fmpr_init(r);
 
     /* TODO: try other points */
     fmprb_set_fmpr(m, fmprb_midref(block));
     func(t, m, param, 1, prec);
     msign = _fmprb_sign(t);
 
-    fmpr_mul_2exp_si(fmprb_radref(L), fmprb_radref(block), -1);
-    fmpr_set(fmprb_radref(R), fmprb_radref(L));
+    mag_mul_2exp_si(fmprb_radref(L), fmprb_radref(block), -1);
+    mag_set(fmprb_radref(R), fmprb_radref(L));
 
     /* XXX: deal with huge shifts */
-    fmpr_sub(fmprb_midref(L), fmprb_midref(block), fmprb_radref(L), FMPR_PREC_EXACT, FMPR_RND_DOWN);
-    fmpr_add(fmprb_midref(R), fmprb_midref(block), fmprb_radref(R), FMPR_PREC_EXACT, FMPR_RND_DOWN);
+    fmprb_get_rad_fmpr(r, L);
+    fmpr_sub(fmprb_midref(L), fmprb_midref(block), r, FMPR_PREC_EXACT, FMPR_RND_DOWN);
+    fmpr_add(fmprb_midref(R), fmprb_midref(block), r, FMPR_PREC_EXACT, FMPR_RND_DOWN);
 
     fmprb_clear(t);
     fmprb_clear(m);
+    fmpr_clear(r);
 
     return msign;
 }
@@ -78,13 +82,11 @@ int fmprb_calc_refine_root_bisect(fmprb_t r, fmprb_calc_func_t func,
     fmprb_init(u);
 
     /* XXX: deal with huge shifts */
-    fmpr_sub(fmprb_midref(t), fmprb_midref(start), fmprb_radref(start),
-        FMPR_PREC_EXACT, FMPR_RND_DOWN);
+    fmprb_get_lbound_fmpr(fmprb_midref(t), start, FMPR_PREC_EXACT);
     func(u, t, param, 1, prec);
     asign = _fmprb_sign(u);
 
-    fmpr_add(fmprb_midref(t), fmprb_midref(start), fmprb_radref(start),
-        FMPR_PREC_EXACT, FMPR_RND_DOWN);
+    fmprb_get_ubound_fmpr(fmprb_midref(t), start, FMPR_PREC_EXACT);
     func(u, t, param, 1, prec);
     bsign = _fmprb_sign(u);
 
@@ -0,0 +1,83 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmprb_calc.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+    fmprb_ptr r;
+    int * results;
+    fmprb_calc_func_t func;
+    void * param;
+    fmprb_srcptr start;
+    fmprb_srcptr conv_region;
+    const fmpr_struct * conv_factor;
+    long eval_extra_prec;
+    long prec;
+}
+refine_arg_t;
+
+static void
+_refine_worker(void * arg_ptr, long i)
+{
+    const refine_arg_t * arg = (const refine_arg_t *) arg_ptr;
+
+    arg->results[i] = fmprb_calc_refine_root_newton(arg->r + i,
+        arg->func, arg->param, arg->start + i, arg->conv_region + i,
+        arg->conv_factor + i, arg->eval_extra_prec, arg->prec);
+}
+
+int
+fmprb_calc_refine_roots_newton_threaded(fmprb_ptr r, int * results,
+    fmprb_calc_func_t func, void * param, fmprb_srcptr start,
+    fmprb_srcptr conv_region, const fmpr_struct * conv_factor, long num,
+    long eval_extra_prec, long prec)
+{
+    refine_arg_t arg;
+    int result;
+    long i;
+
+    arg.r = r;
+    arg.results = (results != NULL) ? results : flint_malloc(sizeof(int) * num);
+    arg.func = func;
+    arg.param = param;
+    arg.start = start;
+    arg.conv_region = conv_region;
+    arg.conv_factor = conv_factor;
+    arg.eval_extra_prec = eval_extra_prec;
+    arg.prec = prec;
+
+    thread_pool_parallel_for(_refine_worker, &arg, num, flint_get_num_threads());
+
+    result = FMPRB_CALC_SUCCESS;
+    for (i = 0; i < num && result == FMPRB_CALC_SUCCESS; i++)
+        result = arg.results[i];
+
+    if (results == NULL)
+        flint_free(arg.results);
+
+    return result;
+}
@@ -80,7 +80,7 @@ int main()
         fmpz_init(nn);
 
         fmpr_set_si(fmprb_midref(interval), m);
-        fmpr_set_si(fmprb_radref(interval), r);
+        mag_set_ui_2exp_si(fmprb_radref(interval), r, 0);
 
         num = fmprb_calc_isolate_roots(&blocks, &info, sin_pi2_x, NULL,
             interval, maxdepth, maxeval, maxfound, prec);
@@ -0,0 +1,246 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmprb_calc.h"
+
+/* sin((pi/2)x) */
+static int
+sin_pi2_x(fmprb_ptr out, const fmprb_t inp, void * params, long order, long prec)
+{
+    fmprb_ptr x;
+
+    x = _fmprb_vec_init(2);
+
+    fmprb_set(x, inp);
+    fmprb_one(x + 1);
+
+    fmprb_const_pi(out, prec);
+    fmprb_mul_2exp_si(out, out, -1);
+    _fmprb_vec_scalar_mul(x, x, 2, out, prec);
+    _fmprb_poly_sin_series(out, x, order, order, prec);
+
+    _fmprb_vec_clear(x, 2);
+
+    return 0;
+}
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("isolate_roots_threaded....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 40; iter++)
+    {
+        long m, r, a, b, maxdepth, maxeval, maxfound, prec, i, j, num, num2;
+        fmprb_ptr blocks, blocks2;
+        int * info, * info2;
+        fmprb_t t, interval;
+        fmpz_t nn;
+        int unlimited;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        m = n_randint(state, 80);
+        r = 1 + n_randint(state, 80);
+        a = m - r;
+        b = m + r;
+
+        unlimited = n_randint(state, 2);
+
+        /* without a limit on the evaluations, the depth must be small
+           and the precision high enough to isolate the roots early,
+           or the subdivision would run to the full depth */
+        if (unlimited)
+        {
+            prec = 30 + n_randint(state, 50);
+            maxdepth = 1 + n_randint(state, 20);
+            maxeval = LONG_MAX;
+            maxfound = LONG_MAX;
+        }
+        else
+        {
+            prec = 2 + n_randint(state, 50);
+            maxdepth = 1 + n_randint(state, 60);
+            maxeval = 1 + n_randint(state, 5000);
+            maxfound = 1 + n_randint(state, 100);
+        }
+
+        fmprb_init(interval);
+        fmprb_init(t);
+        fmpz_init(nn);
+
+        fmpr_set_si(fmprb_midref(interval), m);
+        mag_set_ui_2exp_si(fmprb_radref(interval), r, 0);
+
+        num = fmprb_calc_isolate_roots_threaded(&blocks, &info, sin_pi2_x, NULL,
+            interval, maxdepth, maxeval, maxfound, prec);
+
+        /* check that all roots are accounted for */
+        for (i = a; i <= b; i++)
+        {
+            if (i % 2 == 0)
+            {
+                int found = 0;
+
+                for (j = 0; j < num; j++)
+                {
+                    if (fmprb_contains_si(blocks + j, i))
+                    {
+                        found = 1;
+                        break;
+                    }
+                }
+
+                if (!found)
+                {
+                    printf("FAIL: missing root %ld\n", i);
+                    printf("a = %ld, b = %ld, maxdepth = %ld, maxeval = %ld, maxfound = %ld, prec = %ld\n",
+                        a, b, maxdepth, maxeval, maxfound, prec);
+                    abort();
+                }
+            }
+        }
+
+        /* check that all reported single roots are good, and that the
+           output is sorted */
+        for (i = 0; i < num; i++)
+        {
+            if (info[i] == 1)
+            {
+                fmprb_mul_2exp_si(t, blocks + i, -1);
+
+                if (!fmprb_get_unique_fmpz(nn, t))
+                {
+                    printf("FAIL: bad root %ld\n", i);
+                    printf("a = %ld, b = %ld, maxdepth = %ld, maxeval = %ld, maxfound = %ld, prec = %ld\n",
+                        a, b, maxdepth, maxeval, maxfound, prec);
+                    abort();
+                }
+            }
+
+            if (i > 0 && fmpr_cmp(fmprb_midref(blocks + i - 1), fmprb_midref(blocks + i)) >= 0)
+            {
+                printf("FAIL: not sorted\n");
+                abort();
+            }
+        }
+
+        /* without limits, the output agrees with the serial version */
+        if (unlimited)
+        {
+            num2 = fmprb_calc_isolate_roots(&blocks2, &info2, sin_pi2_x, NULL,
+                interval, maxdepth, maxeval, maxfound, prec);
+
+            if (num != num2)
+            {
+                printf("FAIL: num = %ld, num2 = %ld\n", num, num2);
+                abort();
+            }
+
+            for (i = 0; i < num; i++)
+            {
+                if (!fmprb_equal(blocks + i, blocks2 + i) || info[i] != info2[i])
+                {
+                    printf("FAIL: different output at %ld\n", i);
+                    abort();
+                }
+            }
+
+            _fmprb_vec_clear(blocks2, num2);
+            flint_free(info2);
+        }
+
+        _fmprb_vec_clear(blocks, num);
+        flint_free(info);
+
+        fmprb_clear(interval);
+        fmprb_clear(t);
+        fmpz_clear(nn);
+    }
+
+    /* fewer isolated roots than the interval contains */
+    for (iter = 0; iter < 40; iter++)
+    {
+        long r, maxfound, prec, i, j, num, found;
+        fmprb_ptr blocks;
+        int * info;
+        fmprb_t interval;
+
+        flint_set_num_threads(2 + n_randint(state, 3));
+
+        prec = 30 + n_randint(state, 50);
+        r = 20 + n_randint(state, 60);
+        maxfound = 1 + n_randint(state, 10);
+
+        fmprb_init(interval);
+        mag_set_ui_2exp_si(fmprb_radref(interval), r, 0);
+
+        num = fmprb_calc_isolate_roots_threaded(&blocks, &info, sin_pi2_x, NULL,
+            interval, 20, LONG_MAX, maxfound, prec);
+
+        found = 0;
+        for (i = 0; i < num; i++)
+            found += (info[i] == 1);
+
+        if (found > maxfound)
+        {
+            printf("FAIL: found = %ld, maxfound = %ld\n", found, maxfound);
+            abort();
+        }
+
+        /* the remaining roots are in blocks reported as undecided */
+        for (i = -r; i <= r; i++)
+        {
+            if (i % 2 != 0)
+                continue;
+
+            for (j = 0; j < num; j++)
+                if (fmprb_contains_si(blocks + j, i))
+                    break;
+
+            if (j == num)
+            {
+                printf("FAIL: missing root %ld with maxfound = %ld\n", i, maxfound);
+                abort();
+            }
+        }
+
+        _fmprb_vec_clear(blocks, num);
+        flint_free(info);
+        fmprb_clear(interval);
+    }
+
+    flint_set_num_threads(1);
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
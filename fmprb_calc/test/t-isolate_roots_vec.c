@@ -0,0 +1,273 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmprb_calc.h"
+
+typedef struct
+{
+    const fmprb_poly_struct * poly;     /* NULL for sin((pi/2)x) */
+    long calls;
+}
+vec_param_t;
+
+/* sin((pi/2)x) */
+static int
+sin_pi2_x(fmprb_ptr out, const fmprb_t inp, void * params, long order, long prec)
+{
+    fmprb_ptr x;
+
+    x = _fmprb_vec_init(2);
+
+    fmprb_set(x, inp);
+    fmprb_one(x + 1);
+
+    fmprb_const_pi(out, prec);
+    fmprb_mul_2exp_si(out, out, -1);
+    _fmprb_vec_scalar_mul(x, x, 2, out, prec);
+    _fmprb_poly_sin_series(out, x, order, order, prec);
+
+    _fmprb_vec_clear(x, 2);
+
+    return 0;
+}
+
+/* either function, evaluated at all points at once; the polynomial
+   uses fast multipoint evaluation */
+static int
+test_vec(fmprb_ptr out, fmprb_srcptr inp, long num,
+    void * params, long order, long prec)
+{
+    vec_param_t * param = (vec_param_t *) params;
+    const fmprb_poly_struct * poly = param->poly;
+    fmprb_ptr y, deriv;
+    long i, len;
+
+    param->calls++;
+
+    if (poly == NULL)
+    {
+        for (i = 0; i < num; i++)
+            sin_pi2_x(out + i * order, inp + i, NULL, order, prec);
+
+        return 0;
+    }
+
+    len = poly->length;
+    y = _fmprb_vec_init(num);
+
+    _fmprb_poly_evaluate_vec_fast(y, poly->coeffs, len, inp, num, prec);
+
+    for (i = 0; i < num; i++)
+        fmprb_swap(out + i * order, y + i);
+
+    if (order > 1)
+    {
+        deriv = _fmprb_vec_init(FLINT_MAX(len - 1, 1));
+        _fmprb_poly_derivative(deriv, poly->coeffs, len, prec);
+        _fmprb_poly_evaluate_vec_fast(y, deriv, len - 1, inp, num, prec);
+
+        for (i = 0; i < num; i++)
+            fmprb_swap(out + i * order + 1, y + i);
+
+        _fmprb_vec_clear(deriv, FLINT_MAX(len - 1, 1));
+    }
+
+    _fmprb_vec_clear(y, num);
+
+    return 0;
+}
+
+/* the roots are the even integers in [a, b]; blocks that were not
+   tested because of the limits must still be reported */
+static void
+check_output(fmprb_srcptr blocks, const int * info, long num, long a, long b)
+{
+    fmprb_t t;
+    fmpz_t nn;
+    long i, j;
+
+    fmprb_init(t);
+    fmpz_init(nn);
+
+    for (i = a; i <= b; i++)
+    {
+        if (i % 2 == 0)
+        {
+            for (j = 0; j < num; j++)
+                if (fmprb_contains_si(blocks + j, i))
+                    break;
+
+            if (j == num)
+            {
+                printf("FAIL: missing root %ld\n", i);
+                abort();
+            }
+        }
+    }
+
+    for (i = 0; i < num; i++)
+    {
+        if (info[i] == 1)
+        {
+            fmprb_mul_2exp_si(t, blocks + i, -1);
+
+            if (!fmprb_get_unique_fmpz(nn, t))
+            {
+                printf("FAIL: bad root %ld\n", i);
+                abort();
+            }
+        }
+
+        if (i > 0 && fmpr_cmp(fmprb_midref(blocks + i - 1), fmprb_midref(blocks + i)) >= 0)
+        {
+            printf("FAIL: not sorted\n");
+            abort();
+        }
+    }
+
+    fmprb_clear(t);
+    fmpz_clear(nn);
+}
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("isolate_roots_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 80; iter++)
+    {
+        long m, r, a, b, maxdepth, maxeval, maxfound, prec, i, num, num2;
+        fmprb_ptr blocks, blocks2;
+        int * info, * info2;
+        fmprb_t interval;
+        fmprb_poly_t poly;
+        vec_param_t param;
+        int unlimited, use_poly;
+
+        use_poly = n_randint(state, 2);
+        unlimited = n_randint(state, 2);
+
+        fmprb_init(interval);
+        fmprb_poly_init(poly);
+
+        m = n_randint(state, use_poly ? 20 : 80);
+        r = 1 + n_randint(state, use_poly ? 20 : 80);
+        a = m - r;
+        b = m + r;
+
+        /* without a limit on the evaluations, the depth must be small
+           and the precision high enough to isolate the roots early */
+        if (unlimited)
+        {
+            prec = 30 + n_randint(state, use_poly ? 200 : 50);
+            maxdepth = 1 + n_randint(state, 20);
+            maxeval = LONG_MAX;
+            maxfound = LONG_MAX;
+        }
+        else
+        {
+            prec = 2 + n_randint(state, use_poly ? 200 : 50);
+            maxdepth = 1 + n_randint(state, 60);
+            maxeval = 1 + n_randint(state, 5000);
+            maxfound = 1 + n_randint(state, 100);
+        }
+
+        fmpr_set_si(fmprb_midref(interval), m);
+        mag_set_ui_2exp_si(fmprb_radref(interval), r, 0);
+
+        param.poly = NULL;
+        param.calls = 0;
+
+        if (use_poly)
+        {
+            /* the same roots as sin((pi/2)x) in the interval */
+            fmprb_ptr xs = _fmprb_vec_init(r + 1);
+            long len = 0;
+
+            for (i = a; i <= b; i++)
+                if (i % 2 == 0)
+                    fmprb_set_si(xs + len++, i);
+
+            fmprb_poly_product_roots(poly, xs, len, prec);
+            _fmprb_vec_clear(xs, r + 1);
+
+            param.poly = poly;
+        }
+
+        num = fmprb_calc_isolate_roots_vec(&blocks, &info, test_vec, &param,
+            interval, maxdepth, maxeval, maxfound, prec);
+
+        check_output(blocks, info, num, a, b);
+
+        /* one call for the endpoints and at most three per level */
+        if (param.calls > 1 + 3 * (maxdepth + 1))
+        {
+            printf("FAIL: %ld calls with maxdepth = %ld\n", param.calls, maxdepth);
+            abort();
+        }
+
+        /* without limits, the output agrees with the serial version
+           given the same function values */
+        if (unlimited && !use_poly)
+        {
+            num2 = fmprb_calc_isolate_roots(&blocks2, &info2, sin_pi2_x, NULL,
+                interval, maxdepth, maxeval, maxfound, prec);
+
+            if (num != num2)
+            {
+                printf("FAIL: num = %ld, num2 = %ld\n", num, num2);
+                abort();
+            }
+
+            for (i = 0; i < num; i++)
+            {
+                if (!fmprb_equal(blocks + i, blocks2 + i) || info[i] != info2[i])
+                {
+                    printf("FAIL: different output at %ld\n", i);
+                    abort();
+                }
+            }
+
+            _fmprb_vec_clear(blocks2, num2);
+            flint_free(info2);
+        }
+
+        _fmprb_vec_clear(blocks, num);
+        flint_free(info);
+
+        fmprb_clear(interval);
+        fmprb_poly_clear(poly);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,159 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmprb_calc.h"
+
+/* sin((pi/2)x) */
+static int
+sin_pi2_x(fmprb_ptr out, const fmprb_t inp, void * params, long order, long prec)
+{
+    fmprb_ptr x;
+
+    x = _fmprb_vec_init(2);
+
+    fmprb_set(x, inp);
+    fmprb_one(x + 1);
+
+    fmprb_const_pi(out, prec);
+    fmprb_mul_2exp_si(out, out, -1);
+    _fmprb_vec_scalar_mul(x, x, 2, out, prec);
+    _fmprb_poly_sin_series(out, x, order, order, prec);
+
+    _fmprb_vec_clear(x, 2);
+
+    return 0;
+}
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("refine_roots_newton_threaded....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 40; iter++)
+    {
+        long i, j, num, found, prec, low_prec;
+        fmprb_ptr blocks, start, region, r;
+        fmpr_struct * C;
+        int * info;
+        int * results;
+        fmprb_t t, u, interval;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        low_prec = 30;
+        prec = 30 + n_randint(state, 300);
+
+        fmprb_init(interval);
+        fmprb_init(t);
+        fmprb_init(u);
+
+        /* keep the interval away from the root at 0 */
+        fmpr_set_si(fmprb_midref(interval), 41 + n_randint(state, 40));
+        mag_set_ui_2exp_si(fmprb_radref(interval), 1 + n_randint(state, 40), 0);
+
+        num = fmprb_calc_isolate_roots(&blocks, &info, sin_pi2_x, NULL,
+            interval, 40, LONG_MAX, LONG_MAX, low_prec);
+
+        start = _fmprb_vec_init(num);
+        region = _fmprb_vec_init(num);
+        r = _fmprb_vec_init(num);
+        C = flint_malloc(sizeof(fmpr_struct) * FLINT_MAX(num, 1));
+        results = flint_malloc(sizeof(int) * FLINT_MAX(num, 1));
+
+        found = 0;
+        for (i = 0; i < num; i++)
+        {
+            if (info[i] != 1)
+                continue;
+
+            fmprb_calc_refine_root_bisect(region + found, sin_pi2_x, NULL,
+                blocks + i, 5, low_prec);
+            fmprb_calc_refine_root_bisect(start + found, sin_pi2_x, NULL,
+                region + found, 5, low_prec);
+            fmpr_init(C + found);
+            fmprb_calc_newton_conv_factor(C + found, sin_pi2_x, NULL,
+                region + found, low_prec);
+            found++;
+        }
+
+        fmprb_calc_refine_roots_newton_threaded(r, results, sin_pi2_x, NULL,
+            start, region, C, found, 10, prec);
+
+        for (j = 0; j < found; j++)
+        {
+            fmpz_t nn;
+            int result;
+
+            fmpz_init(nn);
+
+            /* the root is an even integer */
+            fmprb_mul_2exp_si(t, r + j, -1);
+
+            if (!fmprb_get_unique_fmpz(nn, t) || !fmprb_contains(region + j, r + j))
+            {
+                printf("FAIL: bad root %ld\n", j);
+                fmprb_printd(r + j, 30); printf("\n");
+                abort();
+            }
+
+            /* agrees with the serial version */
+            result = fmprb_calc_refine_root_newton(u, sin_pi2_x, NULL,
+                start + j, region + j, C + j, 10, prec);
+
+            if (result != results[j] || !fmprb_equal(u, r + j))
+            {
+                printf("FAIL: different from serial %ld\n", j);
+                fmprb_printd(r + j, 30); printf("\n");
+                fmprb_printd(u, 30); printf("\n");
+                abort();
+            }
+
+            fmpz_clear(nn);
+            fmpr_clear(C + j);
+        }
+
+        _fmprb_vec_clear(blocks, num);
+        _fmprb_vec_clear(start, num);
+        _fmprb_vec_clear(region, num);
+        _fmprb_vec_clear(r, num);
+        flint_free(C);
+        flint_free(results);
+        flint_free(info);
+
+        fmprb_clear(interval);
+        fmprb_clear(t);
+        fmprb_clear(u);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
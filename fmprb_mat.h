@@ -113,6 +113,8 @@ void fmprb_mat_mul_classical(fmprb_mat_t C, const fmprb_mat_t A, const fmprb_mat
 
 void fmprb_mat_mul_threaded(fmprb_mat_t C, const fmprb_mat_t A, const fmprb_mat_t B, long prec);
 
+void fmprb_mat_mul_block(fmprb_mat_t C, const fmprb_mat_t A, const fmprb_mat_t B, long prec);
+
 void fmprb_mat_pow_ui(fmprb_mat_t B, const fmprb_mat_t A, ulong exp, long prec);
 
 /* Scalar arithmetic */
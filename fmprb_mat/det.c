@@ -107,26 +107,29 @@ fmprb_mat_det_inplace(fmprb_t det, fmprb_mat_t A, long prec)
     /* bound unreduced part using Hadamard's inequality */
     if (rank < n)
     {
-        fmpr_t t;
+        fmpr_t t, u;
         fmprb_t d;
 
         fmpr_init(t);
+        fmpr_init(u);
         fmprb_init(d);
 
-        fmpr_one(fmprb_radref(d));
+        fmpr_one(u);
 
         for (i = rank; i < n; i++)
         {
             fmprb_vec_get_fmpr_2norm_squared_bound(t, A->rows[i] + rank, 
                 n - rank, FMPRB_RAD_PREC);
-            fmpr_mul(fmprb_radref(d), fmprb_radref(d), t, FMPRB_RAD_PREC, FMPR_RND_UP);
+            fmpr_mul(u, u, t, FMPRB_RAD_PREC, FMPR_RND_UP);
         }
 
-        fmpr_sqrt(fmprb_radref(d), fmprb_radref(d), FMPRB_RAD_PREC, FMPR_RND_UP);
+        fmpr_sqrt(u, u, FMPRB_RAD_PREC, FMPR_RND_UP);
+        fmprb_set_rad_fmpr(d, u);
         fmprb_mul(det, det, d, prec);
 
         fmprb_clear(d);
         fmpr_clear(t);
+        fmpr_clear(u);
     }
 }
 
@@ -25,10 +25,19 @@
 
 #include "fmprb_mat.h"
 
+/* use block multiplication when all dimensions are at least this large */
+#define BLOCK_CUTOFF 8
+
 void
 fmprb_mat_mul(fmprb_mat_t C, const fmprb_mat_t A, const fmprb_mat_t B, long prec)
 {
-    if (flint_get_num_threads() > 1 &&
+    if (fmprb_mat_nrows(A) >= BLOCK_CUTOFF &&
+        fmprb_mat_ncols(A) >= BLOCK_CUTOFF &&
+        fmprb_mat_ncols(B) >= BLOCK_CUTOFF)
+    {
+        fmprb_mat_mul_block(C, A, B, prec);
+    }
+    else if (flint_get_num_threads() > 1 &&
         ((double) fmprb_mat_nrows(A) *
          (double) fmprb_mat_nrows(B) *
          (double) fmprb_mat_ncols(B) *
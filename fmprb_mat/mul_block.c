@@ -0,0 +1,694 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include <math.h>
+#include "fmprb_mat.h"
+#include "thread_pool.h"
+
+/* largest exponent range of a block = ALPHA*prec + BETA */
+#define ALPHA 3.0
+#define BETA 512
+
+/* smallest number of rows of A in a task of the parallel block product */
+#define BLOCK_MIN_ROWS 16
+
+/* exponents are restricted to this range so that sums of a few of them
+   can be computed without overflow */
+#define MIN_SMALL (LONG_MIN / 8)
+#define MAX_SMALL (LONG_MAX / 8)
+
+/* scaled radius entries smaller than 2^TINY_EXP are rounded up to
+   2^TINY_EXP, which prevents underflow in the double products */
+#define TINY_EXP (-500)
+
+static int
+fmpr_is_small(const fmpr_t x)
+{
+    fmpz e;
+
+    if (fmpr_is_zero(x))
+        return 1;
+
+    if (!fmpr_is_normal(x))
+        return 0;
+
+    e = *fmpr_expref(x);
+
+    return !COEFF_IS_MPZ(e) && e > MIN_SMALL && e < MAX_SMALL;
+}
+
+static int
+mag_is_small(const mag_t x)
+{
+    fmpz e;
+
+    if (mag_is_zero(x))
+        return 1;
+
+    if (mag_is_inf(x))
+        return 0;
+
+    e = MAG_EXP(x);
+
+    return !COEFF_IS_MPZ(e) && e > MIN_SMALL && e < MAX_SMALL;
+}
+
+static int
+fmprb_mat_is_small(const fmprb_mat_t A)
+{
+    long i, j;
+
+    for (i = 0; i < fmprb_mat_nrows(A); i++)
+        for (j = 0; j < fmprb_mat_ncols(A); j++)
+            if (!fmpr_is_small(fmprb_midref(fmprb_mat_entry(A, i, j))) ||
+                !mag_is_small(fmprb_radref(fmprb_mat_entry(A, i, j))))
+                return 0;
+
+    return 1;
+}
+
+static int
+fmprb_mat_is_exact(const fmprb_mat_t A)
+{
+    long i, j;
+
+    for (i = 0; i < fmprb_mat_nrows(A); i++)
+        for (j = 0; j < fmprb_mat_ncols(A); j++)
+            if (!mag_is_zero(fmprb_radref(fmprb_mat_entry(A, i, j))))
+                return 0;
+
+    return 1;
+}
+
+/* the exponent range [bot, top) of the midpoints in a row of A or a
+   column of B, restricted to the current block of the inner dimension */
+typedef struct
+{
+    long bot;
+    long top;
+    long index;
+}
+block_line_t;
+
+/* extends the exponent range of *line to cover the midpoint of x;
+   returns 0 without changing *line if the range would become wider
+   than limit, unless the range is empty (a single entry is always
+   accepted) */
+static int
+_block_line_add(block_line_t * line, int * nonzero, const fmprb_t x, long limit)
+{
+    long b, t;
+
+    if (fmpr_is_zero(fmprb_midref(x)))
+        return 1;
+
+    b = *fmpr_expref(fmprb_midref(x));
+    t = b + fmpz_bits(fmpr_manref(fmprb_midref(x)));
+
+    if (*nonzero)
+    {
+        b = FLINT_MIN(line->bot, b);
+        t = FLINT_MAX(line->top, t);
+
+        if (t - b > limit)
+            return 0;
+    }
+
+    line->bot = b;
+    line->top = t;
+    *nonzero = 1;
+    return 1;
+}
+
+static int
+_block_line_cmp(const void * a, const void * b)
+{
+    long s = ((const block_line_t *) a)->top;
+    long t = ((const block_line_t *) b)->top;
+
+    return (s < t) ? 1 : ((s > t) ? -1 : 0);
+}
+
+/* sorts the lines by decreasing top exponent and groups them greedily
+   so that each group spans at most limit bits (a line that is wider
+   than limit by itself forms its own group); returns the number of
+   groups, with group g consisting of lines start[g] to start[g+1]-1
+   and using the shared exponent bot[g] */
+static long
+_block_line_group(long * start, long * bot, block_line_t * lines, long len, long limit)
+{
+    long i, num, gtop, gbot;
+
+    qsort(lines, len, sizeof(block_line_t), _block_line_cmp);
+
+    num = 0;
+    gtop = gbot = 0;
+
+    for (i = 0; i < len; i++)
+    {
+        if (i == 0 || gtop - FLINT_MIN(gbot, lines[i].bot) > limit)
+        {
+            if (i != 0)
+                bot[num - 1] = gbot;
+
+            start[num++] = i;
+            gtop = lines[i].top;
+            gbot = lines[i].bot;
+        }
+        else
+        {
+            gbot = FLINT_MIN(gbot, lines[i].bot);
+        }
+    }
+
+    if (num != 0)
+        bot[num - 1] = gbot;
+
+    start[num] = len;
+    return num;
+}
+
+typedef struct
+{
+    fmprb_mat_struct * C;
+    const fmprb_mat_struct * A;
+    fmpz_mat_struct * BZ;
+    const block_line_t * rows;
+    const block_line_t * cols;
+    const long * col_start;
+    const long * col_bot;
+    const long * task_row;
+    const long * task_len;
+    const long * task_bot;
+    long num_col_groups;
+    long p;
+    long q;
+    long prec;
+}
+block_mul_arg_t;
+
+/* multiplies a chunk of rows of A (all from the same row group) by
+   one column group of B, and adds the result to C */
+static void
+_block_mul_task(void * arg_ptr, long k)
+{
+    const block_mul_arg_t * arg = (const block_mul_arg_t *) arg_ptr;
+    const block_line_t * rows;
+    const block_line_t * cols;
+    fmpz_mat_t AZ, CZ;
+    fmpr_t t;
+    long i, j, l, g, h, len, exp;
+
+    g = k / arg->num_col_groups;
+    h = k % arg->num_col_groups;
+
+    rows = arg->rows + arg->task_row[g];
+    len = arg->task_len[g];
+    cols = arg->cols + arg->col_start[h];
+    exp = arg->task_bot[g] + arg->col_bot[h];
+
+    fmpz_mat_init(AZ, len, arg->q - arg->p);
+    fmpz_mat_init(CZ, len, arg->col_start[h + 1] - arg->col_start[h]);
+    fmpr_init(t);
+
+    for (i = 0; i < len; i++)
+        for (l = arg->p; l < arg->q; l++)
+            fmpr_get_fmpz_fixed_si(fmpz_mat_entry(AZ, i, l - arg->p),
+                fmprb_midref(fmprb_mat_entry(arg->A, rows[i].index, l)),
+                arg->task_bot[g]);
+
+    fmpz_mat_mul(CZ, AZ, arg->BZ + h);
+
+    for (i = 0; i < len; i++)
+    {
+        for (j = 0; j < fmpz_mat_ncols(CZ); j++)
+        {
+            if (!fmpz_is_zero(fmpz_mat_entry(CZ, i, j)))
+            {
+                fmprb_ptr c = fmprb_mat_entry(arg->C, rows[i].index, cols[j].index);
+
+                fmpr_set_fmpz(t, fmpz_mat_entry(CZ, i, j));
+                fmpr_mul_2exp_si(t, t, exp);
+                fmprb_add_fmpr(c, c, t, arg->prec);
+            }
+        }
+    }
+
+    fmpz_mat_clear(AZ);
+    fmpz_mat_clear(CZ);
+    fmpr_clear(t);
+}
+
+/* upper bound for |x| * 2^e as a double; x must be small */
+static double
+fmpr_get_d_scaled_up(fmpr_t t, const fmpr_t x, long e)
+{
+    if (fmpr_is_zero(x))
+        return 0.0;
+
+    fmpr_mul_2exp_si(t, x, e);
+    fmpr_abs(t, t);
+
+    if (fmpr_cmp_2exp_si(t, TINY_EXP) < 0)
+        return ldexp(1.0, TINY_EXP);
+
+    return fmpr_get_d(t, FMPR_RND_UP);
+}
+
+static double
+mag_get_d_scaled_up(fmpr_t t, const mag_t x, long e)
+{
+    mag_get_fmpr(t, x);
+    return fmpr_get_d_scaled_up(t, t, e);
+}
+
+typedef struct
+{
+    fmprb_mat_struct * C;
+    const long * aexp;
+    const long * bexp;
+    const double * amid;
+    const double * arad;
+    const double * bmid;
+    const double * brad;
+    long n;
+    long bc;
+    long k;
+}
+rad_product_arg_t;
+
+/* adds the radius bound to row i of C */
+static void
+_rad_product_task(void * arg_ptr, long i)
+{
+    const rad_product_arg_t * arg = (const rad_product_arg_t *) arg_ptr;
+    const double * am = arg->amid + i * arg->n;
+    const double * ad = arg->arad + i * arg->n;
+    long j, l, n = arg->n;
+    fmpr_t t, u;
+    double s;
+
+    fmpr_init(t);
+    fmpr_init(u);
+
+    for (j = 0; j < arg->bc; j++)
+    {
+        const double * bm = arg->bmid + j * n;
+        const double * bd = arg->brad + j * n;
+
+        s = 0.0;
+
+        for (l = 0; l < n; l++)
+        {
+            s += am[l] * bd[l];
+            s += ad[l] * bm[l];
+            s += ad[l] * bd[l];
+        }
+
+        if (s != 0.0)
+        {
+            fmpr_set_d(t, s);
+            fmpr_mul_2exp_si(u, t, -arg->k);
+            fmpr_add(t, t, u, FMPRB_RAD_PREC, FMPR_RND_UP);
+            fmpr_mul_2exp_si(t, t, arg->aexp[i] + arg->bexp[j]);
+            fmprb_add_error_fmpr(fmprb_mat_entry(arg->C, i, j), t);
+        }
+    }
+
+    fmpr_clear(t);
+    fmpr_clear(u);
+}
+
+/*
+Adds an upper bound for |mid(A)| rad(B) + rad(A) |mid(B)| + rad(A) rad(B)
+to the radii of C. Each row of A and each column of B is scaled by a power
+of two so that its entries are bounded by 1 and the products are then
+computed in double precision. All scaled entries are rounded upwards and
+nonzero entries are at least 2^TINY_EXP, so no underflow or overflow can
+occur; the sums of 3n nonnegative terms are therefore correct to within a
+relative error of (3n+2) 2^-52, which we add at the end.
+*/
+static void
+_fmprb_mat_add_rad_product(fmprb_mat_t C, const fmprb_mat_t A, const fmprb_mat_t B)
+{
+    rad_product_arg_t arg;
+    long ar, n, bc, i, j, l, e;
+    long *aexp, *bexp;
+    double *amid, *arad, *bmid, *brad;
+    fmpr_t t;
+    int nonzero;
+
+    ar = fmprb_mat_nrows(A);
+    n = fmprb_mat_ncols(A);
+    bc = fmprb_mat_ncols(B);
+
+    aexp = flint_malloc(sizeof(long) * (ar + bc));
+    bexp = aexp + ar;
+
+    amid = flint_malloc(sizeof(double) * 2 * n * (ar + bc));
+    arad = amid + ar * n;
+    bmid = arad + ar * n;
+    brad = bmid + bc * n;
+
+    fmpr_init(t);
+
+    for (i = 0; i < ar; i++)
+    {
+        nonzero = 0;
+        aexp[i] = 0;
+
+        for (l = 0; l < n; l++)
+        {
+            fmprb_srcptr x = fmprb_mat_entry(A, i, l);
+
+            if (!fmpr_is_zero(fmprb_midref(x)))
+            {
+                e = fmpr_abs_bound_lt_2exp_si(fmprb_midref(x));
+                aexp[i] = nonzero ? FLINT_MAX(aexp[i], e) : e;
+                nonzero = 1;
+            }
+
+            if (!mag_is_zero(fmprb_radref(x)))
+            {
+                e = MAG_EXP(fmprb_radref(x));
+                aexp[i] = nonzero ? FLINT_MAX(aexp[i], e) : e;
+                nonzero = 1;
+            }
+        }
+
+        for (l = 0; l < n; l++)
+        {
+            fmprb_srcptr x = fmprb_mat_entry(A, i, l);
+
+            amid[i * n + l] = fmpr_get_d_scaled_up(t, fmprb_midref(x), -aexp[i]);
+            arad[i * n + l] = mag_get_d_scaled_up(t, fmprb_radref(x), -aexp[i]);
+        }
+    }
+
+    /* columns of B are stored contiguously */
+    for (j = 0; j < bc; j++)
+    {
+        nonzero = 0;
+        bexp[j] = 0;
+
+        for (l = 0; l < n; l++)
+        {
+            fmprb_srcptr x = fmprb_mat_entry(B, l, j);
+
+            if (!fmpr_is_zero(fmprb_midref(x)))
+            {
+                e = fmpr_abs_bound_lt_2exp_si(fmprb_midref(x));
+                bexp[j] = nonzero ? FLINT_MAX(bexp[j], e) : e;
+                nonzero = 1;
+            }
+
+            if (!mag_is_zero(fmprb_radref(x)))
+            {
+                e = MAG_EXP(fmprb_radref(x));
+                bexp[j] = nonzero ? FLINT_MAX(bexp[j], e) : e;
+                nonzero = 1;
+            }
+        }
+
+        for (l = 0; l < n; l++)
+        {
+            fmprb_srcptr x = fmprb_mat_entry(B, l, j);
+
+            bmid[j * n + l] = fmpr_get_d_scaled_up(t, fmprb_midref(x), -bexp[j]);
+            brad[j * n + l] = mag_get_d_scaled_up(t, fmprb_radref(x), -bexp[j]);
+        }
+    }
+
+    arg.C = C;
+    arg.aexp = aexp;
+    arg.bexp = bexp;
+    arg.amid = amid;
+    arg.arad = arad;
+    arg.bmid = bmid;
+    arg.brad = brad;
+    arg.n = n;
+    arg.bc = bc;
+
+    /* (1 + 2^-k) >= 1 + (3n+2) 2^-52 */
+    arg.k = 52 - FLINT_BIT_COUNT(3 * n + 2);
+
+    thread_pool_parallel_for(_rad_product_task, &arg, ar,
+        flint_get_num_threads());
+
+    fmpr_clear(t);
+
+    flint_free(aexp);
+    flint_free(amid);
+}
+
+void
+fmprb_mat_mul_block(fmprb_mat_t C, const fmprb_mat_t A, const fmprb_mat_t B, long prec)
+{
+    block_mul_arg_t arg;
+    block_line_t *rows, *cols;
+    long ar, ac, br, bc, i, j, l, g, h, p, q, limit, num_threads;
+    long num_rows, num_cols, num_row_groups, num_col_groups, num_tasks;
+    long chunk, num_chunks;
+    long *row_start, *row_bot, *col_start, *col_bot;
+    long *task_row, *task_len, *task_bot;
+    int *rnz, *cnz, *rnz2, *cnz2;
+    block_line_t *rows2, *cols2;
+    fmpz_mat_struct * BZ;
+    int ok;
+
+    ar = fmprb_mat_nrows(A);
+    ac = fmprb_mat_ncols(A);
+    br = fmprb_mat_nrows(B);
+    bc = fmprb_mat_ncols(B);
+
+    if (ac != br || ar != fmprb_mat_nrows(C) || bc != fmprb_mat_ncols(C))
+    {
+        printf("fmprb_mat_mul_block: incompatible dimensions\n");
+        abort();
+    }
+
+    if (ar == 0 || br == 0 || bc == 0)
+    {
+        fmprb_mat_zero(C);
+        return;
+    }
+
+    if (A == C || B == C)
+    {
+        fmprb_mat_t T;
+        fmprb_mat_init(T, ar, bc);
+        fmprb_mat_mul_block(T, A, B, prec);
+        fmprb_mat_swap(T, C);
+        fmprb_mat_clear(T);
+        return;
+    }
+
+    num_threads = flint_get_num_threads();
+
+    /* infinities, nans and huge exponents are handled by the
+       entrywise algorithms */
+    if (!fmprb_mat_is_small(A) || !fmprb_mat_is_small(B))
+    {
+        if (num_threads > 1)
+            fmprb_mat_mul_threaded(C, A, B, prec);
+        else
+            fmprb_mat_mul_classical(C, A, B, prec);
+        return;
+    }
+
+    if (prec == FMPR_PREC_EXACT)
+        limit = LONG_MAX;
+    else
+        limit = ALPHA * prec + BETA;
+
+    fmprb_mat_zero(C);
+
+    /* the exponent ranges of the rows of A and the columns of B in the
+       current block, and the ranges with the next column of A (and row
+       of B) added */
+    rows = flint_malloc(sizeof(block_line_t) * 2 * ar);
+    rows2 = rows + ar;
+    cols = flint_malloc(sizeof(block_line_t) * 2 * bc);
+    cols2 = cols + bc;
+    rnz = flint_malloc(sizeof(int) * 2 * ar);
+    rnz2 = rnz + ar;
+    cnz = flint_malloc(sizeof(int) * 2 * bc);
+    cnz2 = cnz + bc;
+
+    row_start = flint_malloc(sizeof(long) * 2 * (ar + 1));
+    row_bot = row_start + ar + 1;
+    col_start = flint_malloc(sizeof(long) * 2 * (bc + 1));
+    col_bot = col_start + bc + 1;
+
+    /* each row group is split into at most num_threads chunks */
+    task_row = flint_malloc(sizeof(long) * 3 * (ar + 1));
+    task_len = task_row + ar + 1;
+    task_bot = task_len + ar + 1;
+
+    BZ = flint_malloc(sizeof(fmpz_mat_struct) * bc);
+
+    /* Split the inner dimension into blocks such that the midpoints in
+       each row of A (restricted to the columns in the block) and in each
+       column of B (restricted to the rows in the block) span a limited
+       range of exponents. Within a block, the rows of A and the columns
+       of B are then grouped by exponent range, and the product of each
+       row group and column group is computed exactly over Z. */
+    for (p = 0; p < ac; p = q)
+    {
+        for (i = 0; i < ar; i++)
+        {
+            rnz[i] = 0;
+            rows[i].bot = rows[i].top = 0;
+            rows[i].index = i;
+        }
+
+        for (j = 0; j < bc; j++)
+        {
+            cnz[j] = 0;
+            cols[j].bot = cols[j].top = 0;
+            cols[j].index = j;
+        }
+
+        for (q = p; q < ac; q++)
+        {
+            ok = 1;
+
+            for (i = 0; i < ar && ok; i++)
+            {
+                rows2[i] = rows[i];
+                rnz2[i] = rnz[i];
+                ok = _block_line_add(rows2 + i, rnz2 + i,
+                    fmprb_mat_entry(A, i, q), limit);
+            }
+
+            for (j = 0; j < bc && ok; j++)
+            {
+                cols2[j] = cols[j];
+                cnz2[j] = cnz[j];
+                ok = _block_line_add(cols2 + j, cnz2 + j,
+                    fmprb_mat_entry(B, q, j), limit);
+            }
+
+            /* a single column is always accepted, since each line
+               then holds a single entry */
+            if (!ok)
+                break;
+
+            for (i = 0; i < ar; i++)
+            {
+                rows[i] = rows2[i];
+                rnz[i] = rnz2[i];
+            }
+
+            for (j = 0; j < bc; j++)
+            {
+                cols[j] = cols2[j];
+                cnz[j] = cnz2[j];
+            }
+        }
+
+        /* only the nonzero lines take part in the product */
+        num_rows = 0;
+        for (i = 0; i < ar; i++)
+            if (rnz[i])
+                rows[num_rows++] = rows[i];
+
+        num_cols = 0;
+        for (j = 0; j < bc; j++)
+            if (cnz[j])
+                cols[num_cols++] = cols[j];
+
+        if (num_rows == 0 || num_cols == 0)
+            continue;
+
+        num_row_groups = _block_line_group(row_start, row_bot, rows, num_rows, limit);
+        num_col_groups = _block_line_group(col_start, col_bot, cols, num_cols, limit);
+
+        /* convert each column group of B */
+        for (h = 0; h < num_col_groups; h++)
+        {
+            fmpz_mat_init(BZ + h, q - p, col_start[h + 1] - col_start[h]);
+
+            for (l = p; l < q; l++)
+                for (j = col_start[h]; j < col_start[h + 1]; j++)
+                    fmpr_get_fmpz_fixed_si(fmpz_mat_entry(BZ + h, l - p, j - col_start[h]),
+                        fmprb_midref(fmprb_mat_entry(B, l, cols[j].index)), col_bot[h]);
+        }
+
+        /* split the row groups into chunks to be processed in parallel;
+           the chunks are independent and each entry of C receives
+           exactly one exact product, so the result does not depend on
+           the number of threads */
+        num_tasks = 0;
+        for (g = 0; g < num_row_groups; g++)
+        {
+            long len = row_start[g + 1] - row_start[g];
+
+            num_chunks = FLINT_MAX(1, FLINT_MIN(num_threads, len / BLOCK_MIN_ROWS));
+            chunk = (len + num_chunks - 1) / num_chunks;
+
+            for (i = row_start[g]; i < row_start[g + 1]; i += chunk)
+            {
+                task_row[num_tasks] = i;
+                task_len[num_tasks] = FLINT_MIN(chunk, row_start[g + 1] - i);
+                task_bot[num_tasks] = row_bot[g];
+                num_tasks++;
+            }
+        }
+
+        arg.C = C;
+        arg.A = A;
+        arg.BZ = BZ;
+        arg.rows = rows;
+        arg.cols = cols;
+        arg.col_start = col_start;
+        arg.col_bot = col_bot;
+        arg.task_row = task_row;
+        arg.task_len = task_len;
+        arg.task_bot = task_bot;
+        arg.num_col_groups = num_col_groups;
+        arg.p = p;
+        arg.q = q;
+        arg.prec = prec;
+
+        thread_pool_parallel_for(_block_mul_task, &arg,
+            num_tasks * num_col_groups, num_threads);
+
+        for (h = 0; h < num_col_groups; h++)
+            fmpz_mat_clear(BZ + h);
+    }
+
+    if (!fmprb_mat_is_exact(A) || !fmprb_mat_is_exact(B))
+        _fmprb_mat_add_rad_product(C, A, B);
+
+    flint_free(rows);
+    flint_free(cols);
+    flint_free(rnz);
+    flint_free(cnz);
+    flint_free(row_start);
+    flint_free(col_start);
+    flint_free(task_row);
+    flint_free(BZ);
+}
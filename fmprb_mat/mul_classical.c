@@ -28,7 +28,8 @@
 void
 fmprb_mat_mul_classical(fmprb_mat_t C, const fmprb_mat_t A, const fmprb_mat_t B, long prec)
 {
-    long ar, ac, br, bc, i, j, k;
+    long ar, ac, br, bc, i, j;
+    fmprb_ptr BT;
 
     ar = fmprb_mat_nrows(A);
     ac = fmprb_mat_ncols(A);
@@ -57,21 +58,22 @@ fmprb_mat_mul_classical(fmprb_mat_t C, const fmprb_mat_t A, const fmprb_mat_t B,
         return;
     }
 
+    /* shallow transpose of B, so that the columns are contiguous */
+    BT = flint_malloc(sizeof(fmprb_struct) * br * bc);
+
+    for (i = 0; i < br; i++)
+        for (j = 0; j < bc; j++)
+            BT[j * br + i] = *fmprb_mat_entry(B, i, j);
+
     for (i = 0; i < ar; i++)
     {
         for (j = 0; j < bc; j++)
         {
-            fmprb_mul(fmprb_mat_entry(C, i, j),
-                      fmprb_mat_entry(A, i, 0),
-                      fmprb_mat_entry(B, 0, j), prec);
-
-            for (k = 1; k < br; k++)
-            {
-                fmprb_addmul(fmprb_mat_entry(C, i, j),
-                             fmprb_mat_entry(A, i, k),
-                             fmprb_mat_entry(B, k, j), prec);
-            }
+            _fmprb_vec_dot(fmprb_mat_entry(C, i, j), NULL, 0,
+                A->rows[i], 1, BT + j * br, 1, br, prec);
         }
     }
+
+    flint_free(BT);
 }
 
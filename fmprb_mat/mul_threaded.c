@@ -24,51 +24,48 @@
 ******************************************************************************/
 
 #include "fmprb_mat.h"
-#include "pthread.h"
+#include "thread_pool.h"
 
 typedef struct
 {
     fmprb_ptr * C;
     const fmprb_ptr * A;
-    const fmprb_ptr * B;
-    long ar0;
-    long ar1;
-    long bc0;
-    long bc1;
+    fmprb_srcptr BT;
+    long ar;
+    long bc;
     long br;
+    int by_rows;
     long prec;
 }
 fmprb_mat_mul_arg_t;
 
-void *
-_fmprb_mat_mul_thread(void * arg_ptr)
+/* computes row i of C, or column i of C */
+static void
+_fmprb_mat_mul_task(void * arg_ptr, long i)
 {
-    fmprb_mat_mul_arg_t arg = *((fmprb_mat_mul_arg_t *) arg_ptr);
-    long i, j, k;
+    const fmprb_mat_mul_arg_t * arg = (const fmprb_mat_mul_arg_t *) arg_ptr;
+    long j;
 
-    for (i = arg.ar0; i < arg.ar1; i++)
+    if (arg->by_rows)
     {
-        for (j = arg.bc0; j < arg.bc1; j++)
-        {
-            fmprb_mul(arg.C[i] + j, arg.A[i] + 0, arg.B[0] + j, arg.prec);
-
-            for (k = 1; k < arg.br; k++)
-            {
-                fmprb_addmul(arg.C[i] + j, arg.A[i] + k, arg.B[k] + j, arg.prec);
-            }
-        }
+        for (j = 0; j < arg->bc; j++)
+            _fmprb_vec_dot(arg->C[i] + j, NULL, 0, arg->A[i], 1,
+                arg->BT + j * arg->br, 1, arg->br, arg->prec);
+    }
+    else
+    {
+        for (j = 0; j < arg->ar; j++)
+            _fmprb_vec_dot(arg->C[j] + i, NULL, 0, arg->A[j], 1,
+                arg->BT + i * arg->br, 1, arg->br, arg->prec);
     }
-
-    flint_cleanup();
-    return NULL;
 }
 
 void
 fmprb_mat_mul_threaded(fmprb_mat_t C, const fmprb_mat_t A, const fmprb_mat_t B, long prec)
 {
-    long ar, ac, br, bc, i, num_threads;
-    pthread_t * threads;
-    fmprb_mat_mul_arg_t * args;
+    long ar, ac, br, bc, i, j;
+    fmprb_ptr BT;
+    fmprb_mat_mul_arg_t arg;
 
     ar = fmprb_mat_nrows(A);
     ac = fmprb_mat_ncols(A);
@@ -97,42 +94,25 @@ fmprb_mat_mul_threaded(fmprb_mat_t C, const fmprb_mat_t A, const fmprb_mat_t B,
         return;
     }
 
-    num_threads = flint_get_num_threads();
-    threads = flint_malloc(sizeof(pthread_t) * num_threads);
-    args = flint_malloc(sizeof(fmprb_mat_mul_arg_t) * num_threads);
+    /* shallow transpose of B, so that the columns are contiguous */
+    BT = flint_malloc(sizeof(fmprb_struct) * br * bc);
 
-    for (i = 0; i < num_threads; i++)
-    {
-        args[i].C = C->rows;
-        args[i].A = A->rows;
-        args[i].B = B->rows;
-
-        if (ar >= bc)
-        {
-            args[i].ar0 = (ar * i) / num_threads;
-            args[i].ar1 = (ar * (i + 1)) / num_threads;
-            args[i].bc0 = 0;
-            args[i].bc1 = bc;
-        }
-        else
-        {
-            args[i].ar0 = 0;
-            args[i].ar1 = ar;
-            args[i].bc0 = (bc * i) / num_threads;
-            args[i].bc1 = (bc * (i + 1)) / num_threads;
-        }
-
-        args[i].br = br;
-        args[i].prec = prec;
-        pthread_create(&threads[i], NULL, _fmprb_mat_mul_thread, &args[i]);
-    }
+    for (i = 0; i < br; i++)
+        for (j = 0; j < bc; j++)
+            BT[j * br + i] = *fmprb_mat_entry(B, i, j);
 
-    for (i = 0; i < num_threads; i++)
-    {
-        pthread_join(threads[i], NULL);
-    }
+    arg.C = C->rows;
+    arg.A = A->rows;
+    arg.BT = BT;
+    arg.ar = ar;
+    arg.bc = bc;
+    arg.br = br;
+    arg.by_rows = (ar >= bc);
+    arg.prec = prec;
+
+    thread_pool_parallel_for(_fmprb_mat_mul_task, &arg,
+        arg.by_rows ? ar : bc, flint_get_num_threads());
 
-    flint_free(threads);
-    flint_free(args);
+    flint_free(BT);
 }
 
@@ -583,6 +583,8 @@ void _fmprb_poly_riemann_siegel_z_series(fmprb_ptr res, fmprb_srcptr h, long hle
 
 void fmprb_poly_riemann_siegel_z_series(fmprb_poly_t res, const fmprb_poly_t h, long n, long prec);
 
+int _fmprb_poly_riemann_siegel_z_rs(fmprb_t z, const fmprb_t t, long prec);
+
 /* Root-finding */
 
 void _fmprb_poly_newton_convergence_factor(fmpr_t convergence_factor,
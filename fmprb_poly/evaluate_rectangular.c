@@ -29,7 +29,7 @@ void
 _fmprb_poly_evaluate_rectangular(fmprb_t y, fmprb_srcptr poly,
     long len, const fmprb_t x, long prec)
 {
-    long i, j, m, r;
+    long i, m, r;
     fmprb_ptr xs;
     fmprb_t s, t, c;
 
@@ -61,15 +61,13 @@ _fmprb_poly_evaluate_rectangular(fmprb_t y, fmprb_srcptr poly,
 
     _fmprb_vec_set_powers(xs, x, m + 1, prec);
 
-    fmprb_set(y, poly + (r - 1) * m);
-    for (j = 1; (r - 1) * m + j < len; j++)
-        fmprb_addmul(y, xs + j, poly + (r - 1) * m + j, prec);
+    _fmprb_vec_dot(y, poly + (r - 1) * m, 0, xs + 1, 1,
+        poly + (r - 1) * m + 1, 1, len - (r - 1) * m - 1, prec);
 
     for (i = r - 2; i >= 0; i--)
     {
-        fmprb_set(s, poly + i * m);
-        for (j = 1; j < m; j++)
-            fmprb_addmul(s, xs + j, poly + i * m + j, prec);
+        _fmprb_vec_dot(s, poly + i * m, 0, xs + 1, 1,
+            poly + i * m + 1, 1, m - 1, prec);
 
         fmprb_mul(y, y, xs + m, prec);
         fmprb_add(y, y, s, prec);
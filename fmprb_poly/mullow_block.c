@@ -59,26 +59,28 @@ when the lengths get extremely large
 #define MIN_SMALL (LONG_MIN / 8)
 #define MAX_SMALL (-MIN_SMALL)
 
-int read_exps(long * xmag, const fmpr_struct * x, long xlen)
+/* reads the magnitudes of the midpoints (rad = 0) or the radii (rad = 1) */
+int read_exps(long * xmag, fmprb_srcptr x, long xlen, int rad)
 {
     long i, mag;
     fmpz exp;
 
     for (i = 0; i < xlen; i++)
     {
-        /* steps of two to read midpoints / radii */
-        if (fmpr_is_zero(x + 2 * i))
+        if (rad ? mag_is_zero(fmprb_radref(x + i))
+                : fmpr_is_zero(fmprb_midref(x + i)))
         {
             xmag[i] = ZERO;
         }
         else
         {
-            exp = *fmpr_expref(x + 2 * i);
+            exp = rad ? MAG_EXP(fmprb_radref(x + i))
+                      : *fmpr_expref(fmprb_midref(x + i));
 
             if (COEFF_IS_MPZ(exp))
                 return 0;
 
-            mag = exp + fmpz_bits(fmpr_manref(x + 2 * i));
+            mag = rad ? exp : exp + fmpz_bits(fmpr_manref(fmprb_midref(x + i)));
 
             if (mag < MIN_SMALL || mag > MAX_SMALL)
                 return 0;
@@ -90,24 +92,34 @@ int read_exps(long * xmag, const fmpr_struct * x, long xlen)
     return 1;  /* all are small */
 }
 
+static __inline__ void
+get_mag(mag_t t, fmprb_srcptr x, int rad)
+{
+    if (rad)
+        mag_set(t, fmprb_radref(x));
+    else
+        mag_set_fmpr(t, fmprb_midref(x));
+}
+
 void
 add_mulbound(fmprb_ptr z,
-        const fmpr_struct * x, long xlen,
-        const fmpr_struct * y, long ylen, long n)
+        fmprb_srcptr x, int xrad, long xlen,
+        fmprb_srcptr y, int yrad, long ylen, long n)
 {
     long i, j, k, a, b, count;
     long *xmag, *ymag;
     long mag, zmag;
     int xsmall, ysmall;
-    fmpr_t err;
+    mag_t err, t;
 
     xmag = flint_calloc(xlen + ylen, sizeof(long));
     ymag = xmag + xlen;
 
-    fmpr_init(err);
+    mag_init(err);
+    mag_init(t);
 
-    xsmall = read_exps(xmag, x, xlen);
-    ysmall = read_exps(ymag, y, ylen);
+    xsmall = read_exps(xmag, x, xlen, xrad);
+    ysmall = read_exps(ymag, y, ylen, yrad);
 
     for (i = 0; i < n; i++)
     {
@@ -131,9 +143,8 @@ add_mulbound(fmprb_ptr z,
 
             if (count != 0)
             {
-                fmpr_set_ui(err, count);
-                fmpr_mul_2exp_si(err, err, zmag);
-                fmpr_add(fmprb_radref(z + i), fmprb_radref(z + i), err, FMPRB_RAD_PREC, FMPR_RND_UP);
+                mag_set_ui_2exp_si(err, count, zmag);
+                mag_add(fmprb_radref(z + i), fmprb_radref(z + i), err);
             }
         }
         else
@@ -141,14 +152,15 @@ add_mulbound(fmprb_ptr z,
             for (j = a; j < b; j++)
             {
                 k = i - j;
-                fmpr_mul(err, x + 2*j, y + 2*k, FMPRB_RAD_PREC, FMPR_RND_UP);
-                fmpr_abs(err, err);
-                fmpr_add(fmprb_radref(z + i), fmprb_radref(z + i), err, FMPRB_RAD_PREC, FMPR_RND_UP);
+                get_mag(err, x + j, xrad);
+                get_mag(t, y + k, yrad);
+                mag_addmul(fmprb_radref(z + i), err, t);
             }
         }
     }
 
-    fmpr_clear(err);
+    mag_clear(err);
+    mag_clear(t);
     flint_free(xmag);
 }
 
@@ -170,10 +182,6 @@ static void
 add_errors(fmprb_ptr z, fmprb_srcptr x, long xlen, fmprb_srcptr y, long ylen, long n, int squaring)
 {
     int xexact, yexact;
-    const fmpr_struct * xmid = ((fmpr_struct *) x);
-    const fmpr_struct * xrad = ((fmpr_struct *) x) + 1;
-    const fmpr_struct * ymid = ((fmpr_struct *) y);
-    const fmpr_struct * yrad = ((fmpr_struct *) y) + 1;
 
     if (squaring)
     {
@@ -182,13 +190,13 @@ add_errors(fmprb_ptr z, fmprb_srcptr x, long xlen, fmprb_srcptr y, long ylen, lo
 
         if (!xexact)
         {
-            add_mulbound(z, xmid, xlen, xrad, xlen, n);
+            add_mulbound(z, x, 0, xlen, x, 1, xlen, n);
 
             /* XXX: for tightness, assumes that z is zero to begin with */
             for (i = 0; i < n; i++)
-                fmpr_mul_2exp_si(fmprb_radref(z + i), fmprb_radref(z + i), 1);
+                mag_mul_2exp_si(fmprb_radref(z + i), fmprb_radref(z + i), 1);
 
-            add_mulbound(z, xrad, xlen, xrad, xlen, n);
+            add_mulbound(z, x, 1, xlen, x, 1, xlen, n);
         }
 
     }
@@ -197,9 +205,9 @@ add_errors(fmprb_ptr z, fmprb_srcptr x, long xlen, fmprb_srcptr y, long ylen, lo
         xexact = is_exact(x, xlen);
         yexact = is_exact(y, ylen);
 
-        if (!yexact)            add_mulbound(z, xmid, xlen, yrad, ylen, n);
-        if (!xexact)            add_mulbound(z, xrad, xlen, ymid, ylen, n);
-        if (!xexact && !yexact) add_mulbound(z, xrad, xlen, yrad, ylen, n);
+        if (!yexact)            add_mulbound(z, x, 0, xlen, y, 1, ylen, n);
+        if (!xexact)            add_mulbound(z, x, 1, xlen, y, 0, ylen, n);
+        if (!xexact && !yexact) add_mulbound(z, x, 1, xlen, y, 1, ylen, n);
     }
 }
 
@@ -286,7 +294,7 @@ has_infnan(fmprb_srcptr x, long len)
     for (i = 0; i < len; i++)
     {
         if (fmpr_is_nan(fmprb_midref(x + i)) || fmpr_is_inf(fmprb_midref(x + i))
-            || fmpr_is_nan(fmprb_radref(x + i)) || fmpr_is_inf(fmprb_radref(x + i)))
+            || mag_is_inf(fmprb_radref(x + i)))
         {
             return 1;
         }
@@ -402,8 +410,8 @@ _fmprb_poly_mullow_block(fmprb_ptr z,
                                 fmpr_mul_2exp_si(t, t, 1);
 
                             ret = fmpr_add(fmprb_midref(z + zi), fmprb_midref(z + zi), t, prec, FMPR_RND_DOWN);
-                            fmpr_add_error_result(fmprb_radref(z + zi), fmprb_radref(z + zi),
-                                fmprb_midref(z + zi), ret, prec, FMPR_RND_UP);
+                            mag_add_error_result(fmprb_radref(z + zi), fmprb_radref(z + zi),
+                                fmprb_midref(z + zi), ret);
                         }
                     }
                 }
@@ -63,6 +63,15 @@ fmpr_add_abs_ubound(fmpr_t z, const fmpr_t x, const fmpr_t y, long prec)
     }
 }
 
+static void
+_fmprb_vec_get_rad_fmpr(fmpr_ptr r, fmprb_srcptr x, long len)
+{
+    long i;
+
+    for (i = 0; i < len; i++)
+        fmprb_get_rad_fmpr(r + i, x + i);
+}
+
 static __inline__ void
 fmpr_abs_round(fmpr_t z, const fmpr_t x, long prec, fmpr_rnd_t rnd)
 {
@@ -109,7 +118,10 @@ fmpr_abs_round(fmpr_t z, const fmpr_t x, long prec, fmpr_rnd_t rnd)
 /* Converts fmpr vector to a vector of blocks, where each block is
    a vector of fmpz integers on a common exponent.
    Optionally, we also generate doubles on the same common exponent
-   (minus DOUBLE_BLOCK_SHIFT), where this can be done exactly. */
+   (minus DOUBLE_BLOCK_SHIFT), where this can be done exactly.
+   The input is read from the midpoints of xb if xb is not NULL. */
+
+#define ENTRY(i) ((xb != NULL) ? fmprb_midref(xb + (i)) : (x + (i)))
 
 static __inline__ int           /* returns new can_use_doubles status */
 _fmpr_vec_get_fmpz_2exp_blocks
@@ -120,8 +132,8 @@ _fmpr_vec_get_fmpz_2exp_blocks
     long * blocks,            /* start positions of blocks (plus end marker) */
     const fmpz_t scale,       /* compose input poly by x -> x/2^scale */
     fmpr_srcptr x,            /* first in vector of input coefficient */
+    fmprb_srcptr xb,          /* or vector to read midpoints from */
     long len,                 /* number of input coefficients */
-    long step,                /* step length to read input coefficients*/
     long prec,                /* prec */
     int can_use_doubles
 )
@@ -152,13 +164,13 @@ _fmpr_vec_get_fmpz_2exp_blocks
     for (i = 0; i < len; i++)
     {
         /* Skip (must be zero, since we assume there are no Infs/NaNs). */
-        if (fmpr_is_special(x + i * step))
+        if (fmpr_is_special(ENTRY(i)))
             continue;
 
         /* Bottom and top exponent of current number */
-        fmpz_set(bot, fmpr_expref(x + i * step));
+        fmpz_set(bot, fmpr_expref(ENTRY(i)));
         fmpz_submul_ui(bot, scale, i);
-        bits = fmpz_bits(fmpr_manref(x + i * step));
+        bits = fmpz_bits(fmpr_manref(ENTRY(i)));
         fmpz_add_ui(top, bot, bits);
 
         can_use_doubles = can_use_doubles && (bits <= FMPRB_RAD_PREC);
@@ -208,7 +220,7 @@ _fmpr_vec_get_fmpz_2exp_blocks
     {
         for (j = blocks[i]; j < blocks[i + 1]; j++)
         {
-            if (fmpr_is_special(x + j * step))
+            if (fmpr_is_special(ENTRY(j)))
             {
                 fmpz_zero(coeffs + j);
 
@@ -219,16 +231,16 @@ _fmpr_vec_get_fmpz_2exp_blocks
             {
                 /* Divide coefficient by 2^(scale * j) */
                 fmpz_mul_ui(t, scale, j);
-                fmpz_sub(t, fmpr_expref(x + j * step), t);
+                fmpz_sub(t, fmpr_expref(ENTRY(j)), t);
                 s = _fmpz_sub_small(t, exps + i);
 
                 if (s < 0) abort(); /* Bug catcher */
 
-                fmpz_mul_2exp(coeffs + j, fmpr_manref(x + j * step), s);
+                fmpz_mul_2exp(coeffs + j, fmpr_manref(ENTRY(j)), s);
 
                 if (can_use_doubles)
                 {
-                    double c = *fmpr_manref(x + j * step);
+                    double c = *fmpr_manref(ENTRY(j));
                     c = ldexp(c, s - DOUBLE_BLOCK_SHIFT);
 
                     if (c < 1e-150 || c > 1e150) /* Bug catcher */
@@ -302,9 +314,7 @@ _fmprb_poly_addmullow_rad(fmprb_ptr z, fmpz * zz,
 
                     fmpr_set_d(t, ss);
                     fmpr_mul_2exp_fmpz(t, t, zexp);
-                    fmpr_add(fmprb_radref(z + xp + yp + k),
-                        fmprb_radref(z + xp + yp + k), t,
-                        FMPRB_RAD_PREC, FMPR_RND_UP);
+                    fmprb_add_error_fmpr(z + xp + yp + k, t);
                 }
             }
             else
@@ -318,9 +328,7 @@ _fmprb_poly_addmullow_rad(fmprb_ptr z, fmpz * zz,
                 {
                     fmpr_set_round_fmpz_2exp(t, zz + k, zexp,
                         FMPRB_RAD_PREC, FMPR_RND_UP);
-                    fmpr_add(fmprb_radref(z + xp + yp + k),
-                        fmprb_radref(z + xp + yp + k), t,
-                        FMPRB_RAD_PREC, FMPR_RND_UP);
+                    fmprb_add_error_fmpr(z + xp + yp + k, t);
                 }
             }
         }
@@ -416,7 +424,7 @@ _fmprb_poly_mullow_block2(fmprb_ptr z, fmprb_srcptr x, long xlen,
     /* Strip trailing zeros */
     xmlen = xrlen = xlen;
     while (xmlen > 0 && fmpr_is_zero(fmprb_midref(x + xmlen - 1))) xmlen--;
-    while (xrlen > 0 && fmpr_is_zero(fmprb_radref(x + xrlen - 1))) xrlen--;
+    while (xrlen > 0 && mag_is_zero(fmprb_radref(x + xrlen - 1))) xrlen--;
 
     if (squaring)
     {
@@ -427,7 +435,7 @@ _fmprb_poly_mullow_block2(fmprb_ptr z, fmprb_srcptr x, long xlen,
     {
         ymlen = yrlen = ylen;
         while (ymlen > 0 && fmpr_is_zero(fmprb_midref(y + ymlen - 1))) ymlen--;
-        while (yrlen > 0 && fmpr_is_zero(fmprb_radref(y + yrlen - 1))) yrlen--;
+        while (yrlen > 0 && mag_is_zero(fmprb_radref(y + yrlen - 1))) yrlen--;
     }
 
     /* We don't know how to deal with infinities or NaNs */
@@ -467,11 +475,12 @@ _fmprb_poly_mullow_block2(fmprb_ptr z, fmprb_srcptr x, long xlen,
                            = (xm*ym) + (xm*yr + xr*(ym + yr))  */
     if (xrlen != 0 || yrlen != 0)
     {
-        fmpr_ptr tmp;
+        fmpr_ptr tmp, rtmp;
         double *xdbl, *ydbl;
         int can_use_doubles = 1;
 
         tmp = _fmpr_vec_init(FLINT_MAX(xlen, ylen));
+        rtmp = _fmpr_vec_init(FLINT_MAX(xlen, ylen));
         xdbl = flint_malloc(sizeof(double) * xlen);
         ydbl = flint_malloc(sizeof(double) * ylen);
 
@@ -479,8 +488,10 @@ _fmprb_poly_mullow_block2(fmprb_ptr z, fmprb_srcptr x, long xlen,
                        = (xm*ym) + xr*(2 xm + xr)    */
         if (squaring)
         {
+            _fmprb_vec_get_rad_fmpr(rtmp, x, xlen);
+
             can_use_doubles = _fmpr_vec_get_fmpz_2exp_blocks(xz, xdbl, xe,
-                xblocks, scale, fmprb_radref(x), xrlen, 2,
+                xblocks, scale, rtmp, NULL, xrlen,
                 FMPRB_RAD_PREC, can_use_doubles);
 
             for (i = 0; i < xlen; i++)
@@ -488,12 +499,12 @@ _fmprb_poly_mullow_block2(fmprb_ptr z, fmprb_srcptr x, long xlen,
                 fmpr_abs_round(tmp + i, fmprb_midref(x + i),
                     FMPRB_RAD_PREC, FMPR_RND_UP);
                 fmpr_mul_2exp_si(tmp + i, tmp + i, 1);
-                fmpr_add(tmp + i, tmp + i, fmprb_radref(x + i),
+                fmpr_add(tmp + i, tmp + i, rtmp + i,
                     FMPRB_RAD_PREC, FMPR_RND_UP);
             }
 
             can_use_doubles = _fmpr_vec_get_fmpz_2exp_blocks(yz, ydbl, ye,
-                yblocks, scale, tmp, xlen, 1,
+                yblocks, scale, tmp, NULL, xlen,
                 FMPRB_RAD_PREC, can_use_doubles);
 
             _fmprb_poly_addmullow_rad(z, zz,
@@ -503,8 +514,10 @@ _fmprb_poly_mullow_block2(fmprb_ptr z, fmprb_srcptr x, long xlen,
         else if (yrlen == 0)
         {
             /* xr * |ym| */
+            _fmprb_vec_get_rad_fmpr(rtmp, x, xrlen);
+
             can_use_doubles = _fmpr_vec_get_fmpz_2exp_blocks(xz, xdbl, xe,
-                xblocks, scale, fmprb_radref(x), xrlen, 2,
+                xblocks, scale, rtmp, NULL, xrlen,
                 FMPRB_RAD_PREC, can_use_doubles);
 
             for (i = 0; i < ymlen; i++)
@@ -512,7 +525,7 @@ _fmprb_poly_mullow_block2(fmprb_ptr z, fmprb_srcptr x, long xlen,
                     FMPRB_RAD_PREC, FMPR_RND_UP);
 
             can_use_doubles = _fmpr_vec_get_fmpz_2exp_blocks(yz, ydbl, ye,
-                yblocks, scale, tmp, ymlen, 1,
+                yblocks, scale, tmp, NULL, ymlen,
                 FMPRB_RAD_PREC, can_use_doubles);
 
             _fmprb_poly_addmullow_rad(z, zz,
@@ -527,11 +540,13 @@ _fmprb_poly_mullow_block2(fmprb_ptr z, fmprb_srcptr x, long xlen,
                     FMPRB_RAD_PREC, FMPR_RND_UP);
 
             can_use_doubles = _fmpr_vec_get_fmpz_2exp_blocks(xz, xdbl, xe,
-                xblocks, scale, tmp, xmlen, 1,
+                xblocks, scale, tmp, NULL, xmlen,
                 FMPRB_RAD_PREC, can_use_doubles);
 
+            _fmprb_vec_get_rad_fmpr(rtmp, y, yrlen);
+
             can_use_doubles = _fmpr_vec_get_fmpz_2exp_blocks(yz, ydbl, ye,
-                yblocks, scale, fmprb_radref(y), yrlen, 2,
+                yblocks, scale, rtmp, NULL, yrlen,
                 FMPRB_RAD_PREC, can_use_doubles);
 
             _fmprb_poly_addmullow_rad(z, zz,
@@ -542,16 +557,20 @@ _fmprb_poly_mullow_block2(fmprb_ptr z, fmprb_srcptr x, long xlen,
             if (xrlen != 0)
             {
                 can_use_doubles = 1;
+                _fmprb_vec_get_rad_fmpr(rtmp, x, xrlen);
+
                 can_use_doubles = _fmpr_vec_get_fmpz_2exp_blocks(xz, xdbl, xe,
-                    xblocks, scale, fmprb_radref(x), xrlen, 2,
+                    xblocks, scale, rtmp, NULL, xrlen,
                     FMPRB_RAD_PREC, can_use_doubles);
 
+                _fmprb_vec_get_rad_fmpr(rtmp, y, ylen);
+
                 for (i = 0; i < ylen; i++)
                     fmpr_add_abs_ubound(tmp + i, fmprb_midref(y + i),
-                        fmprb_radref(y + i), FMPRB_RAD_PREC);
+                        rtmp + i, FMPRB_RAD_PREC);
 
                 can_use_doubles = _fmpr_vec_get_fmpz_2exp_blocks(yz, ydbl, ye,
-                    yblocks, scale, tmp, ylen, 1,
+                    yblocks, scale, tmp, NULL, ylen,
                     FMPRB_RAD_PREC, can_use_doubles);
 
                 _fmprb_poly_addmullow_rad(z, zz,
@@ -561,6 +580,7 @@ _fmprb_poly_mullow_block2(fmprb_ptr z, fmprb_srcptr x, long xlen,
         }
 
         _fmpr_vec_clear(tmp, FLINT_MAX(xlen, ylen));
+        _fmpr_vec_clear(rtmp, FLINT_MAX(xlen, ylen));
         flint_free(xdbl);
         flint_free(ydbl);
     }
@@ -569,7 +589,7 @@ _fmprb_poly_mullow_block2(fmprb_ptr z, fmprb_srcptr x, long xlen,
     if (xmlen != 0 && ymlen != 0)
     {
         _fmpr_vec_get_fmpz_2exp_blocks(xz, NULL, xe, xblocks,
-            scale, fmprb_midref(x), xmlen, 2, prec, 0);
+            scale, NULL, x, xmlen, prec, 0);
 
         if (squaring)
         {
@@ -579,7 +599,7 @@ _fmprb_poly_mullow_block2(fmprb_ptr z, fmprb_srcptr x, long xlen,
         else
         {
             _fmpr_vec_get_fmpz_2exp_blocks(yz, NULL, ye, yblocks,
-                scale, fmprb_midref(y), ymlen, 2, prec, 0);
+                scale, NULL, y, ymlen, prec, 0);
 
             _fmprb_poly_addmullow_block(z, zz,
                 xz, xe, xblocks, xmlen,
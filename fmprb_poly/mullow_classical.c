@@ -41,35 +41,49 @@ _fmprb_poly_mullow_classical(fmprb_ptr res,
     }
     else if (poly1 == poly2 && len1 == len2)
     {
-        long i;
-
-        _fmprb_vec_scalar_mul(res, poly1, FLINT_MIN(len1, n), poly1, prec);
-        _fmprb_vec_scalar_mul(res + len1, poly1 + 1, n - len1, poly1 + len1 - 1, prec);
-
-        for (i = 1; i < len1 - 1; i++)
-            _fmprb_vec_scalar_addmul(res + i + 1, poly1 + 1,
-                FLINT_MIN(i - 1, n - (i + 1)), poly1 + i, prec);
-
-        for (i = 1; i < FLINT_MIN(2 * len1 - 2, n); i++)
-            fmprb_mul_2exp_si(res + i, res + i, 1);
-
-        for (i = 1; i < FLINT_MIN(len1 - 1, (n + 1) / 2); i++)
-            fmprb_addmul(res + 2 * i, poly1 + i, poly1 + i, prec);
+        long i, start, stop;
+
+        for (i = 0; i < n; i++)
+        {
+            /* the terms poly1[j] poly1[i-j] with j < i - j, counted twice */
+            start = FLINT_MAX(0, i - len1 + 1);
+            stop = (i + 1) / 2 - 1;
+
+            if (start <= stop)
+            {
+                _fmprb_vec_dot(res + i, NULL, 0, poly1 + start, 1,
+                    poly1 + i - start, -1, stop - start + 1, prec);
+                fmprb_mul_2exp_si(res + i, res + i, 1);
+            }
+            else
+            {
+                fmprb_zero(res + i);
+            }
+
+            if (i % 2 == 0 && i / 2 < len1)
+                fmprb_addmul(res + i, poly1 + i / 2, poly1 + i / 2, prec);
+        }
+    }
+    else if (len1 == 1)
+    {
+        _fmprb_vec_scalar_mul(res, poly2, n, poly1, prec);
+    }
+    else if (len2 == 1)
+    {
+        _fmprb_vec_scalar_mul(res, poly1, n, poly2, prec);
     }
     else
     {
-        long i;
-
-        _fmprb_vec_scalar_mul(res, poly1, FLINT_MIN(len1, n), poly2, prec);
+        long i, top1, top2;
 
-        if (n > len1)
-            _fmprb_vec_scalar_mul(res + len1, poly2 + 1, n - len1,
-                                      poly1 + len1 - 1, prec);
+        for (i = 0; i < n; i++)
+        {
+            top1 = FLINT_MIN(len1 - 1, i);
+            top2 = FLINT_MIN(len2 - 1, i);
 
-        for (i = 0; i < FLINT_MIN(len1, n) - 1; i++)
-            _fmprb_vec_scalar_addmul(res + i + 1, poly2 + 1,
-                                         FLINT_MIN(len2, n - i) - 1,
-                                         poly1 + i, prec);
+            _fmprb_vec_dot(res + i, NULL, 0, poly1 + i - top2, 1,
+                poly2 + top2, -1, top1 + top2 - i + 1, prec);
+        }
     }
 }
 
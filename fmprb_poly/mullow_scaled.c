@@ -88,14 +88,15 @@ static __inline__ void
 _fmprb_set_shallow_mul2exp(fmprb_t y, const fmprb_t x, const fmpz_t e)
 {
     _fmpr_set_shallow_mul2exp(fmprb_midref(y), fmprb_midref(x), e);
-    _fmpr_set_shallow_mul2exp(fmprb_radref(y), fmprb_radref(x), e);
+    mag_init(fmprb_radref(y));
+    mag_mul_2exp_fmpz(fmprb_radref(y), fmprb_radref(x), e);
 }
 
 static __inline__ void
 _fmprb_clear_shallow(fmprb_t x)
 {
     fmpz_clear(fmpr_expref(fmprb_midref(x)));
-    fmpz_clear(fmpr_expref(fmprb_radref(x)));
+    mag_clear(fmprb_radref(x));
 }
 
 void
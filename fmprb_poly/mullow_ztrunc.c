@@ -84,6 +84,24 @@ int _fmprb_poly_mid_get_hull(fmpz_t bot_exp, fmpz_t top_exp, fmprb_srcptr A, lon
     return have_nonzero;
 }
 
+static void
+_fmprb_vec_get_max_rad_fmpr(fmpr_t error, fmprb_srcptr A, long lenA)
+{
+    mag_t t;
+    long i;
+
+    mag_init(t);
+
+    for (i = 0; i < lenA; i++)
+    {
+        if (mag_cmp(fmprb_radref(A + i), t) > 0)
+            mag_set(t, fmprb_radref(A + i));
+    }
+
+    mag_get_fmpr(error, t);
+    mag_clear(t);
+}
+
 /* convert to an fmpz poly with a common exponent and coefficients
    at most prec bits, also bounding input error plus rounding error */
 void _fmprb_poly_get_fmpz_poly_2exp(fmpr_t error, fmpz_t exp, fmpz  * coeffs,
@@ -101,12 +119,7 @@ void _fmprb_poly_get_fmpz_poly_2exp(fmpr_t error, fmpz_t exp, fmpz  * coeffs,
     {
         fmpz_zero(exp);
         _fmpz_vec_zero(coeffs, lenA);
-        fmpr_zero(error);
-        for (i = 0; i < lenA; i++)
-        {
-            if (fmpr_cmp(fmprb_radref(A + i), error) > 0)
-                fmpr_set(error, fmprb_radref(A + i));
-        }
+        _fmprb_vec_get_max_rad_fmpr(error, A, lenA);
 
         return;   /* no need to clear fmpzs */
     }
@@ -123,14 +136,8 @@ void _fmprb_poly_get_fmpz_poly_2exp(fmpr_t error, fmpz_t exp, fmpz  * coeffs,
         rounding |= fmpr_get_fmpz_fixed_fmpz(coeffs + i,
                         fmprb_midref(A + i), exp);
 
-    fmpr_zero(error);
-
     /* compute maximum of input errors */
-    for (i = 0; i < lenA; i++)
-    {
-        if (fmpr_cmp(fmprb_radref(A + i), error) > 0)
-            fmpr_set(error, fmprb_radref(A + i));
-    }
+    _fmprb_vec_get_max_rad_fmpr(error, A, lenA);
 
     /* add rounding error */
     if (rounding)
@@ -153,8 +160,7 @@ int _fmprb_vec_rad_has_inf_nan(fmprb_srcptr vec, long len)
 {
     long i;
     for (i = 0; i < len; i++)
-        if (fmpr_is_nan(fmprb_radref(vec + i))
-            || fmpr_is_inf(fmprb_radref(vec + i)))
+        if (mag_is_inf(fmprb_radref(vec + i)))
             return 1;
     return 0;
 }
@@ -166,6 +172,7 @@ void _fmprb_poly_mullow_ztrunc(fmprb_ptr C,
     fmpz * Acoeffs, * Bcoeffs, * Ccoeffs;
     fmpz_t Aexp, Bexp, Cexp;
     fmpr_t Aerr, Berr, Anorm, Bnorm, err;
+    mag_t merr, t;
     long i;
     int squaring;
 
@@ -235,16 +242,23 @@ void _fmprb_poly_mullow_ztrunc(fmprb_ptr C,
         fmpr_addmul(err, Bnorm, Aerr, FMPRB_RAD_PREC, FMPR_RND_UP);
     }
 
+    mag_init(merr);
+    mag_init(t);
+    mag_set_fmpr(merr, err);
+
     for (i = 0; i < n; i++)
     {
         fmprb_set_round_fmpz_2exp(C + i, Ccoeffs + i, Cexp, prec);
 
         /* there are at most (i+1) error terms for coefficient i */
         /* TODO: make this tight */
-        fmpr_addmul_ui(fmprb_radref(C + i), err, i + 1,
-            FMPRB_RAD_PREC, FMPR_RND_UP);
+        mag_set_ui_2exp_si(t, i + 1, 0);
+        mag_addmul(fmprb_radref(C + i), merr, t);
     }
 
+    mag_clear(merr);
+    mag_clear(t);
+
     fmpr_clear(Aerr);
     fmpr_clear(Berr);
     fmpr_clear(Anorm);
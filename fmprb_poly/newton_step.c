@@ -40,11 +40,12 @@ _fmprb_poly_newton_step(fmprb_t xnew, fmprb_srcptr poly, long len,
     fmprb_init(u);
     fmprb_init(v);
 
-    fmpr_mul(err, fmprb_radref(x), fmprb_radref(x), FMPRB_RAD_PREC, FMPR_RND_UP);
+    fmprb_get_rad_fmpr(err, x);
+    fmpr_mul(err, err, err, FMPRB_RAD_PREC, FMPR_RND_UP);
     fmpr_mul(err, err, convergence_factor, FMPRB_RAD_PREC, FMPR_RND_UP);
 
     fmpr_set(fmprb_midref(t), fmprb_midref(x));
-    fmpr_zero(fmprb_radref(t));
+    mag_zero(fmprb_radref(t));
 
     _fmprb_poly_evaluate2(u, v, poly, len, t, prec);
 
@@ -54,7 +55,7 @@ _fmprb_poly_newton_step(fmprb_t xnew, fmprb_srcptr poly, long len,
     fmprb_add_error_fmpr(u, err);
 
     if (fmprb_contains(convergence_interval, u) &&
-        (fmpr_cmp(fmprb_radref(u), fmprb_radref(x)) < 0))
+        (mag_cmp(fmprb_radref(u), fmprb_radref(x)) < 0))
     {
         fmprb_swap(xnew, u);
         result = 1;
@@ -0,0 +1,403 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmprb_poly.h"
+
+/* number of correction terms C_0, ..., C_{K} available */
+#define RS_MAX_K 4
+
+/* Gabcke's bounds |R_K(t)| <= d_K (t/2pi)^(-(2K+3)/4) for t >= 200,
+   with d_K = rs_gabcke[K] / 1000 */
+static const int rs_gabcke[RS_MAX_K + 1] = { 127, 53, 11, 31, 17 };
+
+/* C_k = sum_i (rs_num[k][i] / rs_den[k][i]) Psi^(4i-k)(p) / pi^(2i) */
+static const long rs_num[RS_MAX_K + 1][RS_MAX_K + 1] = {
+    { 1, 0, 0, 0, 0 },
+    { 0, -1, 0, 0, 0 },
+    { 0, 1, 1, 0, 0 },
+    { 0, -1, -1, -1, 0 },
+    { 0, 1, 19, 11, 1 },
+};
+
+static const ulong rs_den[RS_MAX_K + 1][RS_MAX_K + 1] = {
+    { 1, 1, 1, 1, 1 },
+    { 1, 96, 1, 1, 1 },
+    { 1, 64, 18432, 1, 1 },
+    { 1, 64, 3840, 5308416, 1 },
+    { 1, 128, 24576, 5898240, 2038431744 },
+};
+
+/* Psi(1/4+v) = sin(pi v (1-2v)) / sin(2 pi v) is bounded by
+   cosh(pi rho (1+2 rho)) / sin(2 pi rho) < 24 on |v| = rho = 9/20,
+   so its Taylor coefficients at 1/4 satisfy |c_n| <= 32 rho^(-n) */
+#define RS_PSI_BOUND 32
+#define RS_PSI_RHO_NUM 9
+#define RS_PSI_RHO_DEN 20
+
+/* adds the bound B rho^(-k) binomial(L,k) q^(L-k) / (1 - Q) with
+   q = |u|/rho and Q = q (L+1)/(L+1-k) for truncating the Taylor series
+   at 1/4 after L terms before shifting it to 1/4 + u */
+static void
+_rs_psi_tail_bound(fmpr_t err, const fmpr_t u, long L, long k)
+{
+    fmprb_t q, Q, b, c;
+    long wp = FMPRB_RAD_PREC;
+
+    fmprb_init(q);
+    fmprb_init(Q);
+    fmprb_init(b);
+    fmprb_init(c);
+
+    fmprb_set_fmpr(q, u);
+    fmprb_mul_ui(q, q, RS_PSI_RHO_DEN, wp);
+    fmprb_div_ui(q, q, RS_PSI_RHO_NUM, wp);
+
+    fmprb_mul_ui(Q, q, L + 1, wp);
+    fmprb_div_ui(Q, Q, L + 1 - k, wp);
+    fmprb_sub_ui(Q, Q, 1, wp);
+    fmprb_neg(Q, Q);
+
+    if (!fmprb_is_positive(Q))
+    {
+        fmpr_pos_inf(err);
+    }
+    else
+    {
+        fmprb_pow_ui(b, q, L - k, wp);
+        fmprb_div(b, b, Q, wp);
+        fmprb_bin_uiui(c, L, k, wp);
+        fmprb_mul(b, b, c, wp);
+        fmprb_set_ui(c, RS_PSI_RHO_DEN);
+        fmprb_div_ui(c, c, RS_PSI_RHO_NUM, wp);
+        fmprb_pow_ui(c, c, k, wp);
+        fmprb_mul(b, b, c, wp);
+        fmprb_mul_ui(b, b, RS_PSI_BOUND, wp);
+        fmprb_get_abs_ubound_fmpr(err, b, wp);
+    }
+
+    fmprb_clear(q);
+    fmprb_clear(Q);
+    fmprb_clear(b);
+    fmprb_clear(c);
+}
+
+/* sets P[k] = Psi^(k)(p) for 0 <= k < n, where 0 <= p <= 1 and
+   Psi(p) = cos(2 pi (p^2 - p - 1/16)) / cos(2 pi p) */
+static void
+_rs_psi_derivs(fmprb_ptr P, const fmprb_t p, long n, long prec)
+{
+    fmprb_ptr h, num, den, c;
+    fmprb_t u;
+    fmpr_t ub, err;
+    long i, k, L;
+    ulong f;
+    int reflect;
+
+    L = 5 * prec / 4 + 150;
+
+    h = _fmprb_vec_init(3);
+    num = _fmprb_vec_init(L + 1);
+    den = _fmprb_vec_init(L + 1);
+    c = _fmprb_vec_init(L);
+    fmprb_init(u);
+    fmpr_init(ub);
+    fmpr_init(err);
+
+    /* expand at the removable singularity 1/4, where both the numerator
+       sin(pi v - 2 pi v^2) and the denominator sin(2 pi v) have exactly
+       zero constant term */
+    fmprb_const_pi(h + 1, prec);
+    fmprb_mul_2exp_si(h + 2, h + 1, 1);
+    fmprb_neg(h + 2, h + 2);
+    _fmprb_poly_sin_series(num, h, 3, L + 1, prec);
+
+    fmprb_mul_2exp_si(h + 1, h + 1, 1);
+    _fmprb_poly_sin_series(den, h, 2, L + 1, prec);
+
+    _fmprb_poly_div_series(c, num + 1, L, den + 1, L, L, prec);
+
+    /* Psi(p) = Psi(1-p); reflect to have |p - 1/4| <= 1/4 */
+    reflect = (fmpr_cmp_2exp_si(fmprb_midref(p), -1) > 0);
+
+    if (reflect)
+    {
+        fmprb_sub_ui(u, p, 1, prec);
+        fmprb_neg(u, u);
+    }
+    else
+    {
+        fmprb_set(u, p);
+    }
+
+    fmprb_one(h);
+    fmprb_mul_2exp_si(h, h, -2);
+    fmprb_sub(u, u, h, prec);
+    fmprb_get_abs_ubound_fmpr(ub, u, FMPRB_RAD_PREC);
+
+    /* shift to 1/4 + u by repeated synthetic division */
+    for (k = 0, f = 1; k < n; k++)
+    {
+        for (i = L - k - 2; i >= 0; i--)
+            fmprb_addmul(c + i, c + i + 1, u, prec);
+
+        fmprb_set(P + k, c);
+        _rs_psi_tail_bound(err, ub, L, k);
+        fmprb_add_error_fmpr(P + k, err);
+
+        if (k >= 2)
+            f *= k;
+        fmprb_mul_ui(P + k, P + k, f, prec);
+
+        if (reflect && (k % 2 == 1))
+            fmprb_neg(P + k, P + k);
+
+        c++;
+    }
+
+    _fmprb_vec_clear(h, 3);
+    _fmprb_vec_clear(num, L + 1);
+    _fmprb_vec_clear(den, L + 1);
+    _fmprb_vec_clear(c - n, L);
+    fmprb_clear(u);
+    fmpr_clear(ub);
+    fmpr_clear(err);
+}
+
+/* sets r = sum_{k=0}^{K} C_k(p) tau^(-k) */
+static void
+_rs_correction(fmprb_t r, const fmprb_t p, const fmprb_t tau, long K, long prec)
+{
+    fmprb_ptr P;
+    fmprb_t ipi2, itau, a, b;
+    long i, k, n;
+
+    n = 3 * K + 1;
+
+    P = _fmprb_vec_init(n);
+    fmprb_init(ipi2);
+    fmprb_init(itau);
+    fmprb_init(a);
+    fmprb_init(b);
+
+    _rs_psi_derivs(P, p, n, prec);
+
+    fmprb_const_pi(ipi2, prec);
+    fmprb_mul(ipi2, ipi2, ipi2, prec);
+    fmprb_inv(ipi2, ipi2, prec);
+    fmprb_inv(itau, tau, prec);
+
+    fmprb_zero(r);
+
+    for (k = K; k >= 0; k--)
+    {
+        fmprb_zero(a);
+
+        for (i = k; i >= 0; i--)
+        {
+            fmprb_mul(a, a, ipi2, prec);
+
+            if (rs_num[k][i] != 0)
+            {
+                fmprb_mul_si(b, P + 4 * i - k, rs_num[k][i], prec);
+                fmprb_div_ui(b, b, rs_den[k][i], prec);
+                fmprb_add(a, a, b, prec);
+            }
+        }
+
+        fmprb_mul(r, r, itau, prec);
+        fmprb_add(r, r, a, prec);
+    }
+
+    _fmprb_vec_clear(P, n);
+    fmprb_clear(ipi2);
+    fmprb_clear(itau);
+    fmprb_clear(a);
+    fmprb_clear(b);
+}
+
+/* returns the smallest K such that the Gabcke bound for R_K is at most
+   2^(-prec) for tau >= taulo, and sets err to that bound,
+   or returns -1 if there is no such K */
+static long
+_rs_choose_K(fmpr_t err, const fmpr_t taulo, long prec)
+{
+    fmprb_t x, y, b;
+    long K, wp = FMPRB_RAD_PREC;
+
+    fmprb_init(x);
+    fmprb_init(y);
+    fmprb_init(b);
+
+    fmprb_set_fmpr(x, taulo);
+    fmprb_rsqrt(y, x, wp);
+    fmprb_inv(x, x, wp);
+
+    for (K = 0; K <= RS_MAX_K; K++)
+    {
+        /* d_K tau^(-(2K+3)/2) */
+        fmprb_mul(y, y, x, wp);
+        fmprb_mul_ui(b, y, rs_gabcke[K], wp);
+        fmprb_div_ui(b, b, 1000, wp);
+        fmprb_get_abs_ubound_fmpr(err, b, wp);
+
+        if (fmpr_cmp_2exp_si(err, -prec) <= 0)
+            break;
+    }
+
+    if (K > RS_MAX_K)
+        K = -1;
+
+    fmprb_clear(x);
+    fmprb_clear(y);
+    fmprb_clear(b);
+
+    return K;
+}
+
+int
+_fmprb_poly_riemann_siegel_z_rs(fmprb_t z, const fmprb_t t, long prec)
+{
+    fmprb_t tau, th, x, y, s, r;
+    fmpr_t lo, hi, err;
+    fmpz_t m, m2;
+    long K, wp, mag;
+    ulong n, mm;
+    int result;
+
+    if (!fmprb_is_positive(t) || !fmpr_is_finite(fmprb_midref(t)))
+        return 0;
+
+    fmpr_init(lo);
+    fmpr_init(hi);
+    fmpr_init(err);
+
+    /* the Gabcke bounds need t >= 200; huge t would need
+       a main sum that does not fit in a word */
+    fmprb_get_abs_lbound_fmpr(lo, t, FMPRB_RAD_PREC);
+    fmprb_get_abs_ubound_fmpr(hi, t, FMPRB_RAD_PREC);
+
+    if (fmpr_cmp_2exp_si(hi, 2 * FLINT_BITS - 8) >= 0)
+    {
+        result = 0;
+    }
+    else
+    {
+        fmpr_set_ui(err, 200);
+        result = (fmpr_cmp(lo, err) >= 0);
+    }
+
+    if (!result)
+    {
+        fmpr_clear(lo);
+        fmpr_clear(hi);
+        fmpr_clear(err);
+        return 0;
+    }
+
+    fmprb_init(tau);
+    fmprb_init(th);
+    fmprb_init(x);
+    fmprb_init(y);
+    fmprb_init(s);
+    fmprb_init(r);
+    fmpz_init(m);
+    fmpz_init(m2);
+
+    mag = fmpr_abs_bound_lt_2exp_si(hi);
+    wp = prec + mag + FLINT_BIT_COUNT(mag) + 10;
+
+    /* tau = sqrt(t / (2 pi)) */
+    fmprb_const_pi(x, wp);
+    fmprb_mul_2exp_si(x, x, 1);
+    fmprb_div(tau, t, x, wp);
+    fmprb_sqrt(tau, tau, wp);
+
+    fmprb_get_abs_lbound_fmpr(lo, tau, FMPRB_RAD_PREC);
+    K = _rs_choose_K(err, lo, prec);
+
+    /* the main sum has floor(tau) terms, which must be unique */
+    if (K >= 0)
+    {
+        fmprb_get_abs_lbound_fmpr(lo, tau, wp);
+        fmprb_get_abs_ubound_fmpr(hi, tau, wp);
+        fmpr_get_fmpz(m, lo, FMPR_RND_FLOOR);
+        fmpr_get_fmpz(m2, hi, FMPR_RND_FLOOR);
+        result = fmpz_equal(m, m2);
+    }
+    else
+    {
+        result = 0;
+    }
+
+    if (result)
+    {
+        mm = fmpz_get_ui(m);
+        wp += FLINT_BIT_COUNT(mm);
+
+        _fmprb_poly_riemann_siegel_theta_series(th, t, 1, 1, wp);
+
+        /* 2 sum_{n=1}^{m} n^(-1/2) cos(theta - t log n) */
+        fmprb_cos(s, th, wp);
+
+        for (n = 2; n <= mm; n++)
+        {
+            fmprb_log_ui(x, n, wp);
+            fmprb_mul(x, x, t, wp);
+            fmprb_sub(x, th, x, wp);
+            fmprb_cos(x, x, wp);
+            fmprb_rsqrt_ui(y, n, wp);
+            fmprb_addmul(s, x, y, wp);
+        }
+
+        fmprb_mul_2exp_si(s, s, 1);
+
+        /* (-1)^(m-1) tau^(-1/2) sum_{k=0}^{K} C_k(p) tau^(-k) */
+        fmprb_sub_fmpz(x, tau, m, wp);
+        _rs_correction(r, x, tau, K, prec + 10);
+        fmprb_rsqrt(y, tau, prec + 10);
+        fmprb_mul(r, r, y, prec + 10);
+
+        if (mm % 2 == 0)
+            fmprb_sub(z, s, r, prec);
+        else
+            fmprb_add(z, s, r, prec);
+
+        fmprb_add_error_fmpr(z, err);
+    }
+
+    fmprb_clear(tau);
+    fmprb_clear(th);
+    fmprb_clear(x);
+    fmprb_clear(y);
+    fmprb_clear(s);
+    fmprb_clear(r);
+    fmpz_clear(m);
+    fmpz_clear(m2);
+    fmpr_clear(lo);
+    fmpr_clear(hi);
+    fmpr_clear(err);
+
+    return result;
+}
@@ -34,6 +34,25 @@ _fmprb_poly_riemann_siegel_z_series(fmprb_ptr res, fmprb_srcptr h, long hlen, lo
 
     hlen = FLINT_MIN(hlen, len);
 
+    /* Z is even; at large height the Riemann-Siegel formula is cheaper */
+    if (len == 1)
+    {
+        fmprb_t z;
+        int success;
+
+        fmprb_init(z);
+        fmprb_abs(z, h);
+        success = _fmprb_poly_riemann_siegel_z_rs(z, z, prec);
+
+        if (success)
+            fmprb_swap(res, z);
+
+        fmprb_clear(z);
+
+        if (success)
+            return;
+    }
+
     alloc = 5 * len;
     t = _fmprb_vec_init(alloc);
     u = t + len;
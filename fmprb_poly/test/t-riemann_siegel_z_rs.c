@@ -0,0 +1,135 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "fmprb_poly.h"
+#include "fmpcb.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("riemann_siegel_z_rs....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* the formula must apply at moderate height and precision */
+    {
+        fmprb_t t, z;
+
+        fmprb_init(t);
+        fmprb_init(z);
+
+        fmprb_set_ui(t, 1000);
+
+        if (!_fmprb_poly_riemann_siegel_z_rs(z, t, 20))
+        {
+            printf("FAIL (not applied)\n\n");
+            abort();
+        }
+
+        fmprb_clear(t);
+        fmprb_clear(z);
+    }
+
+    for (iter = 0; iter < 200; iter++)
+    {
+        long prec1, prec2;
+        fmprb_t t, u;
+        fmprb_poly_t h, b;
+        fmpcb_t s, z1, z2;
+
+        prec1 = 2 + n_randint(state, 40);
+        prec2 = 2 + n_randint(state, 40);
+
+        fmprb_init(t);
+        fmprb_init(u);
+        fmprb_poly_init(h);
+        fmprb_poly_init(b);
+        fmpcb_init(s);
+        fmpcb_init(z1);
+        fmpcb_init(z2);
+
+        /* 200 <= t < 200 + 2^14 */
+        fmprb_set_ui(t, n_randint(state, 1 << 14));
+        fmprb_randtest(u, state, 1 + n_randint(state, 100), 0);
+        fmprb_abs(u, u);
+        fmprb_add(t, t, u, 1 + n_randint(state, 100));
+        fmprb_add_ui(t, t, 200, 1 + n_randint(state, 100));
+
+        if (_fmprb_poly_riemann_siegel_z_rs(u, t, prec1))
+        {
+            /* compare with the Euler-Maclaurin formula */
+            fmprb_poly_set_coeff_fmprb(h, 0, t);
+            fmprb_poly_set_coeff_si(h, 1, 1);
+            fmprb_poly_riemann_siegel_z_series(b, h, 2, prec2);
+
+            if (!fmprb_overlaps(u, b->coeffs))
+            {
+                printf("FAIL: overlap\n\n");
+                printf("prec1 = %ld, prec2 = %ld\n\n", prec1, prec2);
+                printf("t = "); fmprb_printd(t, 15); printf("\n\n");
+                printf("u = "); fmprb_printd(u, 15); printf("\n\n");
+                printf("b = "); fmprb_poly_printd(b, 15); printf("\n\n");
+                abort();
+            }
+
+            /* zeta on the critical line */
+            fmprb_one(fmpcb_realref(s));
+            fmprb_mul_2exp_si(fmpcb_realref(s), fmpcb_realref(s), -1);
+            fmprb_set(fmpcb_imagref(s), t);
+            if (n_randint(state, 2))
+                fmprb_neg(fmpcb_imagref(s), fmpcb_imagref(s));
+
+            fmpcb_zeta(z1, s, prec1);
+            fmpcb_one(z2);
+            fmpcb_hurwitz_zeta(z2, s, z2, prec2);
+
+            if (!fmpcb_overlaps(z1, z2))
+            {
+                printf("FAIL: zeta\n\n");
+                printf("prec1 = %ld, prec2 = %ld\n\n", prec1, prec2);
+                printf("s = "); fmpcb_printd(s, 15); printf("\n\n");
+                printf("z1 = "); fmpcb_printd(z1, 15); printf("\n\n");
+                printf("z2 = "); fmpcb_printd(z2, 15); printf("\n\n");
+                abort();
+            }
+        }
+
+        fmprb_clear(t);
+        fmprb_clear(u);
+        fmprb_poly_clear(h);
+        fmprb_poly_clear(b);
+        fmpcb_clear(s);
+        fmpcb_clear(z1);
+        fmpcb_clear(z2);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
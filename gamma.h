@@ -40,9 +40,9 @@ extern TLS_PREFIX long * gamma_taylor_bound_mag_cache;
 extern TLS_PREFIX fmpr_struct * gamma_taylor_bound_ratio_cache;
 extern TLS_PREFIX long gamma_taylor_bound_cache_num;
 
-extern TLS_PREFIX fmprb_ptr gamma_taylor_coeffs;
-extern TLS_PREFIX long gamma_taylor_prec;
-extern TLS_PREFIX long gamma_taylor_num;
+extern fmprb_ptr gamma_taylor_coeffs;
+extern long gamma_taylor_prec;
+extern long gamma_taylor_num;
 
 void gamma_taylor_bound_ratio(fmpr_t r, long n);
 long gamma_taylor_bound_mag(long n);
@@ -69,6 +69,7 @@ gamma_taylor_coeffs_for_prec(long prec)
 }
 
 void gamma_taylor_precompute(long num, long prec);
+void gamma_taylor_cleanup(void);
 void gamma_taylor_eval_fmprb(fmprb_t y, const fmprb_t x, long prec);
 void gamma_taylor_fmprb(fmprb_t y, const fmprb_t x, long prec);
 
@@ -76,15 +77,29 @@ void gamma_taylor_fmprb(fmprb_t y, const fmprb_t x, long prec);
 void gamma_stirling_choose_param_fmprb(int * reflect, long * r, long * n, const fmprb_t z, int use_reflect, int digamma, long prec);
 void gamma_stirling_choose_param_fmpcb(int * reflect, long * r, long * n, const fmpcb_t z, int use_reflect, int digamma, long prec);
 
+void gamma_stirling_choose_param_polygamma_fmprb(long * r, long * n, ulong m, const fmprb_t z, long prec);
+void gamma_stirling_choose_param_polygamma_fmpcb(long * r, long * n, ulong m, const fmpcb_t z, long prec);
+
 void gamma_stirling_bound_phase(fmpr_t bound, const fmpcb_t z, long prec);
 void gamma_stirling_bound_fmprb(fmpr_struct * err, const fmprb_t x, long k0, long knum, long n);
 void gamma_stirling_bound_fmpcb(fmpr_struct * err, const fmpcb_t z, long k0, long knum, long n);
 
 void gamma_stirling_coeff(fmprb_t b, ulong k, int digamma, long prec);
+void gamma_stirling_coeff_polygamma(fmprb_t b, ulong k, ulong m, long prec);
 
 void gamma_stirling_eval_fmprb(fmprb_t s, const fmprb_t z, long nterms, int digamma, long prec);
 void gamma_stirling_eval_fmpcb(fmpcb_t s, const fmpcb_t z, long nterms, int digamma, long prec);
 
+void gamma_stirling_eval_polygamma_fmprb(fmprb_t s, ulong m, const fmprb_t z, long nterms, long prec);
+void gamma_stirling_eval_polygamma_fmpcb(fmpcb_t s, ulong m, const fmpcb_t z, long nterms, long prec);
+
+/* use fast multipoint evaluation in the vector versions of the
+   Stirling series from this many terms */
+#define GAMMA_STIRLING_VEC_FAST_TERMS 32
+
+void gamma_stirling_eval_fmprb_vec(fmprb_ptr s, fmprb_srcptr z, long num, long nterms, int digamma, long prec);
+void gamma_stirling_eval_fmpcb_vec(fmpcb_ptr s, fmpcb_srcptr z, long num, long nterms, int digamma, long prec);
+
 void gamma_stirling_eval_fmprb_series(fmprb_ptr res, const fmprb_t z, long n, long num, long prec);
 void gamma_stirling_eval_fmpcb_series(fmpcb_ptr res, const fmpcb_t z, long n, long num, long prec);
 
@@ -101,7 +116,10 @@ void gamma_rising_fmpcb_ui_bsplit_eight(fmpcb_t y, const fmpcb_t x, ulong n, lon
 void gamma_rising_fmpcb_ui_bsplit_rectangular(fmpcb_t y, const fmpcb_t x, ulong n, ulong step, long prec);
 void gamma_rising_fmpcb_ui_bsplit(fmpcb_t y, const fmpcb_t x, ulong n, long prec);
 
+void gamma_log_rising_fmpcb_ui(fmpcb_t y, const fmpcb_t z, ulong r, long prec);
+
 void gamma_rising_fmprb_ui_multipoint(fmprb_t f, const fmprb_t c, ulong n, long prec);
+void gamma_rising_fmpcb_ui_multipoint(fmpcb_t f, const fmpcb_t c, ulong n, long prec);
 
 void gamma_rising_fmprb_fmpq_ui_bsplit(fmprb_t y, const fmpq_t x, ulong n, long prec);
 
@@ -0,0 +1,78 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "gamma.h"
+
+void _fmpcb_log_rising_correct_branch(fmpcb_t t,
+        const fmpcb_t t_wrong, const fmpcb_t z, ulong r, long prec);
+
+void
+gamma_log_rising_fmpcb_ui(fmpcb_t y, const fmpcb_t z, ulong r, long prec)
+{
+    fmpcb_t s, t, u;
+    fmpr_t b;
+    long e, m;
+    ulong k;
+
+    if (r == 0)
+    {
+        fmpcb_zero(y);
+        return;
+    }
+
+    fmpcb_init(s);
+    fmpcb_init(t);
+    fmpcb_init(u);
+    fmpr_init(b);
+
+    /* group the factors so that each partial product has a magnitude
+       of about 2^prec, where |z+k| < 2^e */
+    fmprb_get_abs_ubound_fmpr(b, fmpcb_realref(z), FMPRB_RAD_PREC);
+    e = fmpr_is_finite(b) ? fmpr_abs_bound_lt_2exp_si(b) : prec;
+    fmprb_get_abs_ubound_fmpr(b, fmpcb_imagref(z), FMPRB_RAD_PREC);
+    e = FLINT_MAX(e, fmpr_is_finite(b) ? fmpr_abs_bound_lt_2exp_si(b) : prec);
+    e = FLINT_MAX(e, FLINT_BIT_COUNT(r)) + 2;
+    e = FLINT_MIN(e, prec);
+
+    m = FLINT_MAX(1, prec / e);
+
+    for (k = 0; k < r; k += m)
+    {
+        m = FLINT_MIN(m, r - k);
+
+        fmpcb_add_ui(u, z, k, prec);
+        gamma_rising_fmpcb_ui_bsplit(t, u, m, prec);
+        fmpcb_log(t, t, prec);
+        _fmpcb_log_rising_correct_branch(t, t, u, m, prec);
+        fmpcb_add(s, s, t, prec);
+    }
+
+    fmpcb_swap(y, s);
+
+    fmpcb_clear(s);
+    fmpcb_clear(t);
+    fmpcb_clear(u);
+    fmpr_clear(b);
+}
@@ -0,0 +1,172 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2012, 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "gamma.h"
+#include "fmpcb_poly.h"
+#include "thread_pool.h"
+
+#define MULTIPOINT_MIN_CHUNK 32
+#define MULTIPOINT_MAX_CHUNKS 16
+
+void _gamma_rising_poly_fmpz(fmpz * poly, long m);
+
+void _gamma_rising_harmonic_bound(fmpr_t bound, const fmpr_t a, ulong n);
+
+void _gamma_rising_propagated_error(fmpr_t err, const fmpr_t fbound,
+    const fmpr_t r, const fmpr_t h);
+
+typedef struct
+{
+    fmpcb_ptr v;
+    fmpcb_srcptr u;
+    fmpcb_srcptr t;
+    long m;
+    long chunk;
+    long wp;
+}
+multipoint_arg_t;
+
+static void
+_multipoint_worker(void * arg_ptr, long c)
+{
+    const multipoint_arg_t * arg = (const multipoint_arg_t *) arg_ptr;
+    long i, start, len;
+
+    start = c * arg->chunk;
+    len = FLINT_MIN(arg->chunk, arg->m - start);
+
+    _fmpcb_poly_evaluate_vec_fast(arg->v + start, arg->u, arg->m + 1,
+        arg->t + start, len, arg->wp);
+
+    for (i = 1; i < len; i++)
+        fmpcb_mul(arg->v + start, arg->v + start, arg->v + start + i, arg->wp);
+}
+
+void
+gamma_rising_fmpcb_ui_multipoint(fmpcb_t f, const fmpcb_t c, ulong n, long prec)
+{
+    multipoint_arg_t arg;
+    long i, m, wp, num_chunks;
+    fmpcb_ptr t, u, v;
+    fmpcb_t x, r, w;
+    fmpz * p;
+    fmpr_t h, rad, err;
+
+    if (n <= 1)
+    {
+        if (n == 0)
+            fmpcb_one(f);
+        else
+            fmpcb_set_round(f, c, prec);
+        return;
+    }
+
+    /* the error propagation below needs a midpoint in the right half-plane */
+    if (!fmprb_is_finite(fmpcb_realref(c)) || !fmprb_is_finite(fmpcb_imagref(c))
+        || fmpr_sgn(fmprb_midref(fmpcb_realref(c))) <= 0)
+    {
+        gamma_rising_fmpcb_ui_bsplit(f, c, n, prec);
+        return;
+    }
+
+    m = n_sqrt(n);
+    wp = FMPR_PREC_ADD(prec, FLINT_MIN(n, m * FLINT_BIT_COUNT(n)) + 10);
+
+    fmpcb_init(x);
+    fmpcb_init(r);
+    fmpcb_init(w);
+    fmpr_init(h);
+    fmpr_init(rad);
+    fmpr_init(err);
+
+    fmprb_set_fmpr(fmpcb_realref(x), fmprb_midref(fmpcb_realref(c)));
+    fmprb_set_fmpr(fmpcb_imagref(x), fmprb_midref(fmpcb_imagref(c)));
+
+    t = _fmpcb_vec_init(m);
+    u = _fmpcb_vec_init(m + 1);
+    v = _fmpcb_vec_init(m);
+    p = _fmpz_vec_init(m + 1);
+
+    /* the polynomial is x(x+1)(x+2)... */
+    _gamma_rising_poly_fmpz(p, m);
+    for (i = 0; i <= m; i++)
+        fmpcb_set_round_fmpz(u + i, p + i, wp);
+
+    /* the evaluation points are x, x+m, ... */
+    for (i = 0; i < m; i++)
+        fmpcb_add_ui(t + i, x, i * m, wp);
+
+    arg.v = v;
+    arg.u = u;
+    arg.t = t;
+    arg.m = m;
+    arg.wp = wp;
+    arg.chunk = FLINT_MAX(MULTIPOINT_MIN_CHUNK,
+        (m + MULTIPOINT_MAX_CHUNKS - 1) / MULTIPOINT_MAX_CHUNKS);
+    num_chunks = (m + arg.chunk - 1) / arg.chunk;
+
+    thread_pool_parallel_for(_multipoint_worker, &arg, num_chunks,
+        flint_get_num_threads());
+
+    fmpcb_set(r, v);
+    for (i = 1; i < num_chunks; i++)
+        fmpcb_mul(r, r, v + i * arg.chunk, wp);
+
+    /* remaining part of the product */
+    if (n > (ulong) m * m)
+    {
+        fmpcb_add_ui(w, x, m * m, wp);
+        gamma_rising_fmpcb_ui_bsplit(w, w, n - m * m, wp);
+        fmpcb_mul(r, r, w, wp);
+    }
+
+    /* propagate the radius of the input, using |x+k| >= re(x) + k */
+    fmprb_get_rad_fmpr(rad, fmpcb_realref(c));
+    fmprb_get_rad_fmpr(err, fmpcb_imagref(c));
+    fmpr_add(rad, rad, err, FMPRB_RAD_PREC, FMPR_RND_UP);
+
+    if (!fmpr_is_zero(rad))
+    {
+        _gamma_rising_harmonic_bound(h, fmprb_midref(fmpcb_realref(c)), n);
+        fmpcb_get_abs_ubound_fmpr(err, r, FMPRB_RAD_PREC);
+        _gamma_rising_propagated_error(err, err, rad, h);
+        fmprb_add_error_fmpr(fmpcb_realref(r), err);
+        fmprb_add_error_fmpr(fmpcb_imagref(r), err);
+    }
+
+    fmpcb_set_round(f, r, prec);
+
+    _fmpcb_vec_clear(t, m);
+    _fmpcb_vec_clear(u, m + 1);
+    _fmpcb_vec_clear(v, m);
+    _fmpz_vec_clear(p, m + 1);
+
+    fmpcb_clear(x);
+    fmpcb_clear(r);
+    fmpcb_clear(w);
+    fmpr_clear(h);
+    fmpr_clear(rad);
+    fmpr_clear(err);
+}
@@ -25,14 +25,197 @@
 
 #include "gamma.h"
 #include "fmprb_poly.h"
+#include "fmpz_poly.h"
+#include "thread_pool.h"
+
+/* number of points handled by one task in the multipoint evaluation;
+   independent of the number of threads so that the result is too */
+#define MULTIPOINT_MIN_CHUNK 32
+#define MULTIPOINT_MAX_CHUNKS 16
+
+typedef struct
+{
+    fmpz ** polys;
+    long * lens;
+    long m;
+    long num;
+}
+rising_poly_arg_t;
+
+static void
+_rising_poly_leaf(void * arg_ptr, long c)
+{
+    const rising_poly_arg_t * arg = (const rising_poly_arg_t *) arg_ptr;
+    long i, j, lo, hi;
+    fmpz * p;
+
+    lo = (arg->m * c) / arg->num;
+    hi = (arg->m * (c + 1)) / arg->num;
+
+    p = arg->polys[c] = _fmpz_vec_init(hi - lo + 1);
+    arg->lens[c] = hi - lo + 1;
+    fmpz_one(p);
+
+    /* multiply by x + i */
+    for (i = lo; i < hi; i++)
+    {
+        fmpz_set(p + i - lo + 1, p + i - lo);
+        for (j = i - lo; j >= 1; j--)
+        {
+            fmpz_mul_ui(p + j, p + j, i);
+            fmpz_add(p + j, p + j, p + j - 1);
+        }
+        fmpz_mul_ui(p, p, i);
+    }
+}
+
+static void
+_rising_poly_merge(void * arg_ptr, long c)
+{
+    const rising_poly_arg_t * arg = (const rising_poly_arg_t *) arg_ptr;
+    fmpz * a, * b, * r;
+    long alen, blen;
+
+    a = arg->polys[2 * c];
+    b = arg->polys[2 * c + 1];
+    alen = arg->lens[2 * c];
+    blen = arg->lens[2 * c + 1];
+
+    r = _fmpz_vec_init(alen + blen - 1);
+
+    if (alen >= blen)
+        _fmpz_poly_mul(r, a, alen, b, blen);
+    else
+        _fmpz_poly_mul(r, b, blen, a, alen);
+
+    _fmpz_vec_clear(a, alen);
+    _fmpz_vec_clear(b, blen);
+
+    arg->polys[2 * c] = r;
+    arg->lens[2 * c] = alen + blen - 1;
+}
+
+/* the m + 1 integer coefficients of x (x+1) ... (x+m-1), computed as a
+   product tree whose leaves and levels are processed in parallel */
+void
+_gamma_rising_poly_fmpz(fmpz * poly, long m)
+{
+    rising_poly_arg_t arg;
+    long i, num, num_threads;
+
+    num_threads = flint_get_num_threads();
+    num = FLINT_MAX(1, FLINT_MIN(4 * num_threads, m / 16));
+
+    arg.polys = flint_malloc(sizeof(fmpz *) * num);
+    arg.lens = flint_malloc(sizeof(long) * num);
+    arg.m = m;
+    arg.num = num;
+
+    thread_pool_parallel_for(_rising_poly_leaf, &arg, num, num_threads);
+
+    while (arg.num > 1)
+    {
+        thread_pool_parallel_for(_rising_poly_merge, &arg, arg.num / 2,
+            num_threads);
+
+        for (i = 0; i < arg.num / 2; i++)
+        {
+            arg.polys[i] = arg.polys[2 * i];
+            arg.lens[i] = arg.lens[2 * i];
+        }
+
+        if (arg.num % 2 == 1)
+        {
+            arg.polys[arg.num / 2] = arg.polys[arg.num - 1];
+            arg.lens[arg.num / 2] = arg.lens[arg.num - 1];
+        }
+
+        arg.num = (arg.num + 1) / 2;
+    }
+
+    _fmpz_vec_swap(poly, arg.polys[0], m + 1);
+    _fmpz_vec_clear(arg.polys[0], m + 1);
+
+    flint_free(arg.polys);
+    flint_free(arg.lens);
+}
+
+/* a bound for sum_{k=0}^{n-1} 1/(a+k) <= 1/a + log((a+n-1)/a), given a > 0 */
+void
+_gamma_rising_harmonic_bound(fmpr_t bound, const fmpr_t a, ulong n)
+{
+    fmprb_t t, u;
+
+    fmprb_init(t);
+    fmprb_init(u);
+
+    fmprb_set_fmpr(t, a);
+    fmprb_add_ui(u, t, n - 1, FMPRB_RAD_PREC);
+    fmprb_div(u, u, t, FMPRB_RAD_PREC);
+    fmprb_log(u, u, FMPRB_RAD_PREC);
+    fmprb_inv(t, t, FMPRB_RAD_PREC);
+    fmprb_add(u, u, t, FMPRB_RAD_PREC);
+    fmprb_get_abs_ubound_fmpr(bound, u, FMPRB_RAD_PREC);
+
+    fmprb_clear(t);
+    fmprb_clear(u);
+}
+
+/* a bound for |f| (exp(r h) - 1), where |f| <= fbound */
+void
+_gamma_rising_propagated_error(fmpr_t err, const fmpr_t fbound,
+    const fmpr_t r, const fmpr_t h)
+{
+    fmprb_t t;
+
+    fmprb_init(t);
+
+    fmpr_mul(fmprb_midref(t), r, h, FMPRB_RAD_PREC, FMPR_RND_UP);
+    fmprb_expm1(t, t, FMPRB_RAD_PREC);
+    fmprb_get_abs_ubound_fmpr(err, t, FMPRB_RAD_PREC);
+    fmpr_mul(err, err, fbound, FMPRB_RAD_PREC, FMPR_RND_UP);
+
+    fmprb_clear(t);
+}
+
+typedef struct
+{
+    fmprb_ptr v;
+    fmprb_srcptr u;
+    fmprb_srcptr t;
+    long m;
+    long chunk;
+    long wp;
+}
+multipoint_arg_t;
+
+/* evaluates the polynomial on a chunk of the points and multiplies the
+   values together, leaving the product in the first entry of the chunk */
+static void
+_multipoint_worker(void * arg_ptr, long c)
+{
+    const multipoint_arg_t * arg = (const multipoint_arg_t *) arg_ptr;
+    long i, start, len;
+
+    start = c * arg->chunk;
+    len = FLINT_MIN(arg->chunk, arg->m - start);
+
+    _fmprb_poly_evaluate_vec_fast(arg->v + start, arg->u, arg->m + 1,
+        arg->t + start, len, arg->wp);
+
+    for (i = 1; i < len; i++)
+        fmprb_mul(arg->v + start, arg->v + start, arg->v + start + i, arg->wp);
+}
 
 void
 gamma_rising_fmprb_ui_multipoint(fmprb_t f, const fmprb_t c, ulong n, long prec)
 {
-    long i, m, wp;
+    multipoint_arg_t arg;
+    long i, m, wp, num_chunks;
     fmprb_ptr t, u, v;
-    fmprb_t r, w;
-    ulong s;
+    fmprb_t x, r, w;
+    fmpz * p;
+    fmpr_t h, err, rad;
 
     if (n <= 1)
     {
@@ -43,51 +226,88 @@ gamma_rising_fmprb_ui_multipoint(fmprb_t f, const fmprb_t c, ulong n, long prec)
         return;
     }
 
-    /* TODO: this is useless if the input isn't as precise as the working
-       precision to begin with. We rather want to convert to an exact input
-       within the evaluation, and add the propagated error afterwards. */
-    wp = FMPR_PREC_ADD(prec, n);
+    /* the error propagation below needs a positive midpoint */
+    if (!fmprb_is_finite(c) || fmpr_sgn(fmprb_midref(c)) <= 0)
+    {
+        gamma_rising_fmprb_ui_bsplit(f, c, n, prec);
+        return;
+    }
+
+    m = n_sqrt(n);
+
+    /* the input is replaced by its exact midpoint, so the guard bits
+       only have to make up for the numerical instability of the
+       evaluation, which is roughly proportional to the degree */
+    wp = FMPR_PREC_ADD(prec, FLINT_MIN(n, m * FLINT_BIT_COUNT(n)) + 10);
 
+    fmprb_init(x);
     fmprb_init(r);
     fmprb_init(w);
+    fmpr_init(h);
+    fmpr_init(err);
+    fmpr_init(rad);
 
-    m = n_sqrt(n);
+    fmprb_set_fmpr(x, fmprb_midref(c));
 
-    t = _fmprb_vec_init(m + 1);
+    t = _fmprb_vec_init(m);
     u = _fmprb_vec_init(m + 1);
-    v = _fmprb_vec_init(m + 1);
+    v = _fmprb_vec_init(m);
+    p = _fmpz_vec_init(m + 1);
 
     /* the polynomial is x(x+1)(x+2)... */
-    for (i = 0; i < m; i++)
-        fmprb_set_si(t + i, -i);
-
-    _fmprb_poly_product_roots(u, t, m, wp);
+    _gamma_rising_poly_fmpz(p, m);
+    for (i = 0; i <= m; i++)
+        fmprb_set_round_fmpz(u + i, p + i, wp);
 
-    /* the evaluation points are c, c+m, ... */
+    /* the evaluation points are x, x+m, ... */
     for (i = 0; i < m; i++)
-        fmprb_add_ui(t + i, c, i * m, wp);
+        fmprb_add_ui(t + i, x, i * m, wp);
 
-    _fmprb_poly_evaluate_vec_fast(v, u, m + 1, t, m, wp);
+    arg.v = v;
+    arg.u = u;
+    arg.t = t;
+    arg.m = m;
+    arg.wp = wp;
+    arg.chunk = FLINT_MAX(MULTIPOINT_MIN_CHUNK,
+        (m + MULTIPOINT_MAX_CHUNKS - 1) / MULTIPOINT_MAX_CHUNKS);
+    num_chunks = (m + arg.chunk - 1) / arg.chunk;
 
-    fmprb_one(r);
-    for (i = 0; i < m; i++)
-        fmprb_mul(r, r, v + i, wp);
+    thread_pool_parallel_for(_multipoint_worker, &arg, num_chunks,
+        flint_get_num_threads());
+
+    fmprb_set(r, v);
+    for (i = 1; i < num_chunks; i++)
+        fmprb_mul(r, r, v + i * arg.chunk, wp);
 
-    /* remaining part of product (todo: this should use binary
-       splitting as well, to minimize numerical error) */
-    for (s = m * m; s < n; s++)
+    /* remaining part of the product */
+    if (n > (ulong) m * m)
     {
-        fmprb_add_ui(w, c, s, wp);
+        fmprb_add_ui(w, x, m * m, wp);
+        gamma_rising_fmprb_ui_bsplit(w, w, n - m * m, wp);
         fmprb_mul(r, r, w, wp);
     }
 
-    fmprb_set(f, r);
+    /* propagate the radius of the input */
+    if (!mag_is_zero(fmprb_radref(c)))
+    {
+        _gamma_rising_harmonic_bound(h, fmprb_midref(c), n);
+        fmprb_get_abs_ubound_fmpr(err, r, FMPRB_RAD_PREC);
+        fmprb_get_rad_fmpr(rad, c);
+        _gamma_rising_propagated_error(err, err, rad, h);
+        fmprb_add_error_fmpr(r, err);
+    }
 
-    _fmprb_vec_clear(t, m + 1);
+    fmprb_set_round(f, r, prec);
+
+    _fmprb_vec_clear(t, m);
     _fmprb_vec_clear(u, m + 1);
-    _fmprb_vec_clear(v, m + 1);
+    _fmprb_vec_clear(v, m);
+    _fmpz_vec_clear(p, m + 1);
 
+    fmprb_clear(x);
     fmprb_clear(r);
     fmprb_clear(w);
+    fmpr_clear(h);
+    fmpr_clear(err);
+    fmpr_clear(rad);
 }
-
@@ -39,8 +39,7 @@ gamma_stirling_bound_phase(fmpr_t bound, const fmpcb_t z, long prec)
     /* first compute x, y such that |arg(z)| <= arg(x+yi) */
 
     /* argument increases with smaller real parts */
-    fmpr_sub(x, fmprb_midref(fmpcb_realref(z)),
-        fmprb_radref(fmpcb_realref(z)), prec, FMPR_RND_FLOOR);
+    fmprb_get_lbound_fmpr(x, fmpcb_realref(z), prec);
 
     xsign = fmpr_sgn(x);
 
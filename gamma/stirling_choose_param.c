@@ -31,18 +31,44 @@
 
 #define PI 3.1415926535897932385
 
+/* log2 of the binomial coefficient (a choose b) */
+static double
+log2_binomial(long a, long b)
+{
+    double t = 0.0;
+    long i;
+
+    for (i = 1; i <= b; i++)
+        t += log((double) (a - b + i) / i);
+
+    return t * 1.44269504088896341;
+}
+
+/* log2(1/cos(argz/2)), the loss per power of z in the remainder bound */
+static double
+log2_argf(double argz)
+{
+    return log(1.0 / cos(0.5 * argz)) * 1.44269504088896341;
+}
+
+/* deriv is the order of the derivative of log gamma: 0 for log gamma,
+   1 for the digamma function and m+1 for the polygamma function psi^(m);
+   for deriv >= 2 the bound is relative to the leading term (m-1)!/z^m */
 static long
-choose_n(double log2z, double argz, int digamma, long prec)
+choose_n(double log2z, double argz, long deriv, long prec)
 {
-    double argf, boundn;
+    double argf, boundn, prev;
     long n;
 
-    argf = 1.0 / cos(0.5 * argz);
-    argf = log(argf) * (1. / log(2));
+    argf = log2_argf(argz);
+    prev = 0.0;
 
     for (n = 1; ; n++)
     {
-        if (digamma)
+        if (deriv >= 2)
+            boundn = bernoulli_bound_2exp_si(2*n) - (2*n)*log2z + (2*n+deriv)*argf
+                + log2_binomial(2*n+deriv-2, deriv-2);
+        else if (deriv)
             boundn = bernoulli_bound_2exp_si(2*n) - (2*n)*log2z + (2*n+1)*argf;
         else
             boundn = bernoulli_bound_2exp_si(2*n) - (2*n-1)*log2z + (2*n)*argf;
@@ -51,18 +77,22 @@ choose_n(double log2z, double argz, int digamma, long prec)
         if (boundn <= -prec)
             return n;
 
-        /* if the term magnitude does not decrease, r is too small */
-        if (boundn > 1)
+        /* if the term magnitude does not decrease, r is too small; for
+           deriv >= 2, the first terms may exceed the leading term by the
+           factor 2^(deriv*argf) and still decrease */
+        if ((deriv >= 2) ? (n > 1 && boundn >= prev) : (boundn > 1))
         {
             printf("exception: gamma_stirling_choose_param failed to converge\n");
             abort();
         }
+
+        prev = boundn;
     }
 }
 
 void
 choose_small(int * reflect, long * r, long * n,
-    double x, double y, int use_reflect, int digamma, long prec)
+    double x, double y, int use_reflect, long deriv, long prec)
 {
     double w, argz, log2z;
     long rr;
@@ -78,8 +108,11 @@ choose_small(int * reflect, long * r, long * n,
         *reflect = 0;
     }
 
-    /* argument reduction until |z| >= w */
+    /* argument reduction until |z| >= w; the terms of the series for
+       a high derivative only start to decrease when |z| is about deriv */
     w = FLINT_MAX(1.0, GAMMA_STIRLING_BETA * prec);
+    if (deriv >= 2)
+        w += deriv;
 
     rr = 0;
     while (x < 1.0 || x*x + y*y < w*w)
@@ -91,13 +124,27 @@ choose_small(int * reflect, long * r, long * n,
     log2z = 0.5 * log(x*x + y*y) * 1.44269504088896341;
     argz = atan2(y, x);
 
+    /* for a high derivative, the remainder bound also loses the factor
+       2^((deriv+2)*argf), which is large near the imaginary axis; move
+       z towards the real axis until this is at most |z| */
+    if (deriv >= 2)
+    {
+        while ((deriv + 2) * log2_argf(argz) > log2z)
+        {
+            x++;
+            rr++;
+            log2z = 0.5 * log(x*x + y*y) * 1.44269504088896341;
+            argz = atan2(y, x);
+        }
+    }
+
     *r = rr;
-    *n = choose_n(log2z, argz, digamma, prec);
+    *n = choose_n(log2z, argz, deriv, prec);
 }
 
 void
 choose_large(int * reflect, long * r, long * n,
-    const fmpr_t a, const fmpr_t b, int use_reflect, int digamma, long prec)
+    const fmpr_t a, const fmpr_t b, int use_reflect, long deriv, long prec)
 {
     if (use_reflect && fmpr_sgn(a) < 0)
         *reflect = 1;
@@ -144,10 +191,14 @@ choose_large(int * reflect, long * r, long * n,
                     argz = PI * 0.5;
         }
 
+        /* z is too large to be shifted, so if the argument factor
+           for a high derivative is too large, give up like for argz = pi */
         if (argz == PI)
             *n = 0;
+        else if (deriv >= 2 && (deriv + 2) * log2_argf(argz) > log2z)
+            *n = 0;
         else
-            *n = choose_n(log2z, argz, digamma, prec);
+            *n = choose_n(log2z, argz, deriv, prec);
     }
 }
 
@@ -165,13 +216,13 @@ gamma_stirling_choose_param_fmpcb(int * reflect, long * r, long * n,
     }
     else if (fmpr_cmpabs_2exp_si(a, 40) > 0 || fmpr_cmpabs_2exp_si(b, 40) > 0)
     {
-        choose_large(reflect, r, n, a, b, use_reflect, digamma, prec);
+        choose_large(reflect, r, n, a, b, use_reflect, digamma != 0, prec);
     }
     else
     {
         choose_small(reflect, r, n,
             fmpr_get_d(a, FMPR_RND_NEAR),
-            fmpr_get_d(b, FMPR_RND_NEAR), use_reflect, digamma, prec);
+            fmpr_get_d(b, FMPR_RND_NEAR), use_reflect, digamma != 0, prec);
     }
 }
 
@@ -189,13 +240,48 @@ gamma_stirling_choose_param_fmprb(int * reflect, long * r, long * n,
     {
         fmpr_t b;
         fmpr_init(b);
-        choose_large(reflect, r, n, a, b, use_reflect, digamma, prec);
+        choose_large(reflect, r, n, a, b, use_reflect, digamma != 0, prec);
         fmpr_clear(b);
     }
     else
     {
         choose_small(reflect, r, n,
-            fmpr_get_d(a, FMPR_RND_NEAR), 0.0, use_reflect, digamma, prec);
+            fmpr_get_d(a, FMPR_RND_NEAR), 0.0, use_reflect, digamma != 0, prec);
+    }
+}
+
+
+void
+gamma_stirling_choose_param_polygamma_fmpcb(long * r, long * n, ulong m,
+    const fmpcb_t z, long prec)
+{
+    const fmpr_struct * a = fmprb_midref(fmpcb_realref(z));
+    const fmpr_struct * b = fmprb_midref(fmpcb_imagref(z));
+    int reflect;
+
+    if (fmpr_is_inf(a) || fmpr_is_nan(a) || fmpr_is_inf(b) || fmpr_is_nan(b))
+    {
+        *r = *n = 0;
+    }
+    else if (fmpr_cmpabs_2exp_si(a, 40) > 0 || fmpr_cmpabs_2exp_si(b, 40) > 0)
+    {
+        choose_large(&reflect, r, n, a, b, 0, m + 1, prec);
+    }
+    else
+    {
+        choose_small(&reflect, r, n,
+            fmpr_get_d(a, FMPR_RND_NEAR),
+            fmpr_get_d(b, FMPR_RND_NEAR), 0, m + 1, prec);
     }
 }
 
+void
+gamma_stirling_choose_param_polygamma_fmprb(long * r, long * n, ulong m,
+    const fmprb_t x, long prec)
+{
+    fmpcb_t z;
+    fmpcb_init(z);
+    fmpcb_set_fmprb(z, x);
+    gamma_stirling_choose_param_polygamma_fmpcb(r, n, m, z, prec);
+    fmpcb_clear(z);
+}
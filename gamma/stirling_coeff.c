@@ -41,3 +41,16 @@ gamma_stirling_coeff(fmprb_t b, ulong k, int digamma, long prec)
     fmpz_clear(d);
 }
 
+
+void
+gamma_stirling_coeff_polygamma(fmprb_t b, ulong k, ulong m, long prec)
+{
+    fmpz_t d;
+    fmpz_init(d);
+    BERNOULLI_ENSURE_CACHED(2 * k);
+    fmpz_bin_uiui(d, 2 * k + m - 1, 2 * k);
+    fmpz_mul(d, d, fmpq_numref(bernoulli_cache + 2 * k));
+    fmprb_set_round_fmpz(b, d, prec);
+    fmprb_div_fmpz(b, b, fmpq_denref(bernoulli_cache + 2 * k), prec);
+    fmpz_clear(d);
+}
@@ -0,0 +1,236 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include <math.h>
+#include "gamma.h"
+#include "bernoulli.h"
+#include "fmpcb_poly.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+    fmpcb_ptr s;
+    fmpcb_srcptr z;
+    fmpcb_ptr logz;
+    fmpcb_ptr zinv;
+    fmpcb_ptr w;
+    fmpcb_srcptr coeffs;
+    long num;
+    long nterms;
+    long chunk;
+    int digamma;
+    int fast;
+    long prec;
+}
+stirling_vec_cpx_arg_t;
+
+/* logz, zinv and w = 1/z^2; without fast evaluation, also the sum
+   of the series using Horner's rule as in gamma_stirling_eval_fmpcb */
+static void
+_stirling_vec_prepare(void * arg_ptr, long j)
+{
+    const stirling_vec_cpx_arg_t * arg = (const stirling_vec_cpx_arg_t *) arg_ptr;
+    fmpcb_ptr s = arg->s + j;
+    long k, term_prec, prec = arg->prec;
+    double z_mag, term_mag;
+
+    fmpcb_log(arg->logz + j, arg->z + j, prec);
+    fmpcb_inv(arg->zinv + j, arg->z + j, prec);
+    fmpcb_zero(s);
+
+    if (arg->nterms > 1)
+    {
+        fmpcb_mul(arg->w + j, arg->zinv + j, arg->zinv + j, prec);
+
+        if (!arg->fast)
+        {
+            z_mag = fmpr_get_d(fmprb_midref(fmpcb_realref(arg->logz + j)), FMPR_RND_UP)
+                * 1.44269504088896;
+
+            for (k = arg->nterms - 1; k >= 1; k--)
+            {
+                term_mag = bernoulli_bound_2exp_si(2 * k);
+                term_mag -= (2 * k - 1) * z_mag;
+                term_prec = prec + term_mag;
+                term_prec = FLINT_MIN(term_prec, prec);
+                term_prec = FLINT_MAX(term_prec, 10);
+
+                fmpcb_mul(s, s, arg->w + j, term_prec);
+                fmprb_add(fmpcb_realref(s), fmpcb_realref(s),
+                    fmpcb_realref(arg->coeffs + k - 1), term_prec);
+            }
+        }
+    }
+}
+
+/* the sum of the series on a chunk of points using fast multipoint
+   evaluation; the points have been scaled to the unit disk, and
+   the product tree on n points loses about n bits */
+static void
+_stirling_vec_chunk(void * arg_ptr, long c)
+{
+    const stirling_vec_cpx_arg_t * arg = (const stirling_vec_cpx_arg_t *) arg_ptr;
+    long start, len;
+
+    start = c * arg->chunk;
+    len = FLINT_MIN(arg->chunk, arg->num - start);
+
+    _fmpcb_poly_evaluate_vec_fast(arg->s + start, arg->coeffs,
+        arg->nterms - 1, arg->w + start, len, arg->prec + arg->chunk + 10);
+}
+
+static void
+_stirling_vec_finish(void * arg_ptr, long j)
+{
+    const stirling_vec_cpx_arg_t * arg = (const stirling_vec_cpx_arg_t *) arg_ptr;
+    fmpcb_ptr s = arg->s + j;
+    fmpcb_t t;
+    fmpr_t err;
+    long prec = arg->prec;
+
+    fmpcb_init(t);
+    fmpr_init(err);
+
+    if (arg->nterms > 1)
+    {
+        if (arg->digamma)
+        {
+            if (arg->fast)
+                fmpcb_mul(arg->w + j, arg->zinv + j, arg->zinv + j, prec);
+            fmpcb_mul(s, s, arg->w + j, prec);
+        }
+        else
+        {
+            fmpcb_mul(s, s, arg->zinv + j, prec);
+        }
+    }
+
+    /* remainder bound */
+    gamma_stirling_bound_fmpcb(err, arg->z + j, arg->digamma ? 1 : 0,
+        1, arg->nterms);
+    fmprb_add_error_fmpr(fmpcb_realref(s), err);
+    fmprb_add_error_fmpr(fmpcb_imagref(s), err);
+
+    if (arg->digamma)
+    {
+        fmpcb_neg(s, s);
+        fmpcb_mul_2exp_si(t, arg->zinv + j, -1);
+        fmpcb_sub(s, s, t, prec);
+        fmpcb_add(s, s, arg->logz + j, prec);
+    }
+    else
+    {
+        /* (z-0.5)*log(z) - z + log(2*pi)/2 */
+        fmpcb_one(t);
+        fmpcb_mul_2exp_si(t, t, -1);
+        fmpcb_sub(t, arg->z + j, t, prec);
+        fmpcb_mul(t, arg->logz + j, t, prec);
+        fmpcb_add(s, s, t, prec);
+        fmpcb_sub(s, s, arg->z + j, prec);
+        fmprb_const_log_sqrt2pi(fmpcb_realref(t), prec);
+        fmprb_add(fmpcb_realref(s), fmpcb_realref(s), fmpcb_realref(t), prec);
+    }
+
+    fmpcb_clear(t);
+    fmpr_clear(err);
+}
+
+void
+gamma_stirling_eval_fmpcb_vec(fmpcb_ptr s, fmpcb_srcptr z, long num,
+    long nterms, int digamma, long prec)
+{
+    stirling_vec_cpx_arg_t arg;
+    fmpcb_ptr coeffs;
+    fmpr_t t;
+    long j, k, e, num_threads;
+
+    if (num < 1)
+        return;
+
+    nterms = FLINT_MAX(nterms, 1);
+    num_threads = flint_get_num_threads();
+
+    arg.s = s;
+    arg.z = z;
+    arg.num = num;
+    arg.nterms = nterms;
+    arg.digamma = digamma;
+    arg.prec = prec;
+    arg.logz = _fmpcb_vec_init(num);
+    arg.zinv = _fmpcb_vec_init(num);
+    arg.w = _fmpcb_vec_init(num);
+
+    /* the coefficients are shared by all points */
+    coeffs = _fmpcb_vec_init(nterms);
+    for (k = 1; k < nterms; k++)
+        gamma_stirling_coeff(fmpcb_realref(coeffs + k - 1), k, digamma, prec);
+    arg.coeffs = coeffs;
+
+    arg.chunk = nterms - 1;
+    arg.fast = (nterms - 1 >= GAMMA_STIRLING_VEC_FAST_TERMS
+        && num >= nterms - 1);
+
+    thread_pool_parallel_for(_stirling_vec_prepare, &arg, num, num_threads);
+
+    if (arg.fast)
+    {
+        fmpr_init(t);
+
+        /* scale w by 2^(-e) to make |w| <= 1, and the coefficients
+           of the series in w correspondingly */
+        e = LONG_MIN;
+        for (j = 0; j < num; j++)
+        {
+            fmpcb_get_abs_ubound_fmpr(t, arg.w + j, FMPRB_RAD_PREC);
+
+            if (!fmpr_is_finite(t))
+                break;
+
+            e = FLINT_MAX(e, fmpr_abs_bound_lt_2exp_si(t));
+        }
+
+        /* no scaling if some point is not finite */
+        if (j < num)
+            e = 0;
+
+        for (j = 0; j < num; j++)
+            fmpcb_mul_2exp_si(arg.w + j, arg.w + j, -e);
+
+        for (k = 1; k < nterms; k++)
+            fmpcb_mul_2exp_si(coeffs + k - 1, coeffs + k - 1, e * (k - 1));
+
+        thread_pool_parallel_for(_stirling_vec_chunk, &arg,
+            (num + arg.chunk - 1) / arg.chunk, num_threads);
+
+        fmpr_clear(t);
+    }
+
+    thread_pool_parallel_for(_stirling_vec_finish, &arg, num, num_threads);
+
+    _fmpcb_vec_clear(arg.logz, num);
+    _fmpcb_vec_clear(arg.zinv, num);
+    _fmpcb_vec_clear(arg.w, num);
+    _fmpcb_vec_clear(coeffs, nterms);
+}
@@ -0,0 +1,116 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "gamma.h"
+#include "bernoulli.h"
+
+void fmpr_gamma_ui_ubound(fmpr_t x, ulong n, long prec);
+
+/*
+  psi^(m)(z) = (-1)^(m+1) (m-1)! z^(-m) [1 + m/(2z)
+        + sum_{k=1}^{n-1} B_{2k} binomial(2k+m-1, 2k) z^(-2k)] + R
+*/
+void
+gamma_stirling_eval_polygamma_fmprb(fmprb_t s, ulong m, const fmprb_t z,
+    long nterms, long prec)
+{
+    fmprb_t b, t, zinv, zinv2;
+    fmpr_t err, u;
+    fmpz_t f;
+    long k, term_prec, z_mag, term_mag;
+
+    if (m == 0)
+    {
+        gamma_stirling_eval_fmprb(s, z, nterms, 1, prec);
+        return;
+    }
+
+    fmprb_init(t);
+    fmprb_init(zinv);
+    fmprb_init(zinv2);
+    fmprb_init(b);
+    fmpr_init(err);
+    fmpr_init(u);
+    fmpz_init(f);
+
+    fmprb_inv(zinv, z, prec);
+
+    nterms = FLINT_MAX(nterms, 1);
+
+    /* remainder bound, for the (m+1)-th derivative of log gamma */
+    gamma_stirling_bound_fmprb(err, z, m + 1, 1, nterms);
+    fmpr_gamma_ui_ubound(u, m + 2, FMPRB_RAD_PREC);
+    fmpr_mul(err, err, u, FMPRB_RAD_PREC, FMPR_RND_UP);
+
+    fmprb_zero(t);
+    if (nterms > 1)
+    {
+        fmprb_mul(zinv2, zinv, zinv, prec);
+
+        fmprb_get_abs_lbound_fmpr(u, z, FMPRB_RAD_PREC);
+        z_mag = fmpr_is_zero(u) ? 0 : fmpr_abs_bound_lt_2exp_si(u) - 1;
+
+        for (k = nterms - 1; k >= 1; k--)
+        {
+            /* magnitude of the term relative to the leading term */
+            term_mag = bernoulli_bound_2exp_si(2 * k);
+            term_mag += 2 * k * FLINT_BIT_COUNT(m) - 2 * k * z_mag;
+            term_prec = prec + FLINT_MIN(term_mag, 0);
+            term_prec = FLINT_MAX(term_prec, 10);
+
+            fmprb_mul(t, t, zinv2, term_prec);
+            gamma_stirling_coeff_polygamma(b, k, m, term_prec);
+            fmprb_add(t, t, b, term_prec);
+        }
+
+        fmprb_mul(t, t, zinv2, prec);
+    }
+
+    /* 1 + m/(2z) */
+    fmprb_mul_ui(s, zinv, m, prec);
+    fmprb_mul_2exp_si(s, s, -1);
+    fmprb_add(t, t, s, prec);
+    fmprb_add_ui(t, t, 1, prec);
+
+    /* (m-1)! z^(-m) */
+    fmprb_pow_ui(s, zinv, m, prec);
+    fmpz_fac_ui(f, m - 1);
+    fmprb_mul_fmpz(s, s, f, prec);
+    fmprb_mul(s, s, t, prec);
+
+    if (m % 2 == 0)
+        fmprb_neg(s, s);
+
+    /* add the remainder bound */
+    fmprb_add_error_fmpr(s, err);
+
+    fmprb_clear(t);
+    fmprb_clear(zinv);
+    fmprb_clear(zinv2);
+    fmprb_clear(b);
+    fmpr_clear(err);
+    fmpr_clear(u);
+    fmpz_clear(f);
+}
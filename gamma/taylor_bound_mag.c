@@ -53,8 +53,7 @@ gamma_taylor_bound_mag(long n)
     fmprb_div(t, t, u, FMPRB_RAD_PREC);
 
     /* upper bound */
-    fmpr_add(fmprb_midref(t), fmprb_midref(t), fmprb_radref(t),
-        FMPRB_RAD_PREC, FMPR_RND_CEIL);
+    fmprb_get_ubound_fmpr(fmprb_midref(t), t, FMPRB_RAD_PREC);
 
     v = fmpr_get_si(fmprb_midref(t), FMPR_RND_CEIL);
 
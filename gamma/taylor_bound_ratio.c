@@ -39,7 +39,7 @@ gamma_taylor_bound_ratio(fmpr_t r, long n)
     fmprb_pow_fmpq(t, t, q, FMPRB_RAD_PREC);
     fmprb_mul_ui(t, t, 3, FMPRB_RAD_PREC);
 
-    fmpr_add(r, fmprb_midref(t), fmprb_radref(t), FMPRB_RAD_PREC, FMPR_RND_UP);
+    fmprb_get_ubound_fmpr(r, t, FMPRB_RAD_PREC);
 
     fmprb_clear(t);
     fmpq_clear(q);
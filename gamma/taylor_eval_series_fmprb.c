@@ -31,18 +31,23 @@ void
 gamma_taylor_eval_fmprb(fmprb_t y, const fmprb_t x, long prec)
 {
     long i, n, wp;
+    fmprb_srcptr c;
     fmprb_t t, u, v;
     fmpr_t z;
 
     n = gamma_taylor_coeffs_for_prec(prec);
     gamma_taylor_precompute(n, prec);
 
+    /* the table may be replaced by another thread, but an array that
+       has been published stays valid */
+    c = gamma_taylor_coeffs;
+
     fmprb_init(t);
     fmprb_init(u);
     fmprb_init(v);
 
     /* note: c_n is actually stored as coefficient n - 1 */
-    fmprb_set(u, gamma_taylor_coeffs + n - 1);
+    fmprb_set(u, c + n - 1);
 
     for (i = n - 1; i > 0; i--)
     {
@@ -60,7 +65,7 @@ gamma_taylor_eval_fmprb(fmprb_t y, const fmprb_t x, long prec)
             fmprb_mul(u, u, x, wp);
         }
 
-        fmprb_set_round(t, gamma_taylor_coeffs + i - 1, wp);
+        fmprb_set_round(t, c + i - 1, wp);
         fmprb_add(u, u, t, wp);
     }
 
@@ -23,47 +23,252 @@
 
 ******************************************************************************/
 
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
 #include "gamma.h"
 #include "fmprb_poly.h"
+#include "zeta.h"
 
-TLS_PREFIX fmprb_ptr gamma_taylor_coeffs = NULL;
+#ifdef GAMMA_TAYLOR_STATIC_TABLE
+#include "taylor_table.h"
+#endif
 
-TLS_PREFIX long gamma_taylor_prec = 0;
+/* the coefficients are shared by all threads, in the same way as the
+   Bernoulli cache: the table is only replaced while holding
+   gamma_taylor_lock, readers access it without locking, and both
+   gamma_taylor_num and gamma_taylor_prec only increase */
 
-TLS_PREFIX long gamma_taylor_num = 0;
+fmprb_ptr gamma_taylor_coeffs = NULL;
+
+long gamma_taylor_prec = 0;
+
+long gamma_taylor_num = 0;
+
+static pthread_mutex_t gamma_taylor_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* working precision of the current table */
+static long gamma_taylor_wp = 0;
+
+/* replaced arrays; the first retired_num[i] entries of retired[i] are
+   not shared with a newer array and are cleared with it */
+static fmprb_ptr * gamma_taylor_retired = NULL;
+static long * gamma_taylor_retired_num = NULL;
+static long gamma_taylor_num_retired = 0;
+
+/* set once gamma_taylor_cleanup has been passed to atexit */
+static int gamma_taylor_atexit_registered = 0;
+
+void
+gamma_taylor_cleanup(void)
+{
+    long i;
+
+    pthread_mutex_lock(&gamma_taylor_lock);
+
+    _fmprb_vec_clear(gamma_taylor_coeffs, gamma_taylor_num);
+
+    for (i = 0; i < gamma_taylor_num_retired; i++)
+    {
+        _fmprb_vec_clear(gamma_taylor_retired[i], gamma_taylor_retired_num[i]);
+    }
+
+    flint_free(gamma_taylor_retired);
+    flint_free(gamma_taylor_retired_num);
+
+    gamma_taylor_coeffs = NULL;
+    gamma_taylor_num = 0;
+    gamma_taylor_prec = 0;
+    gamma_taylor_wp = 0;
+    gamma_taylor_retired = NULL;
+    gamma_taylor_retired_num = NULL;
+    gamma_taylor_num_retired = 0;
+
+    pthread_mutex_unlock(&gamma_taylor_lock);
+}
+
+/* computes the coefficients of 1/gamma(1+x) from scratch */
+static void
+_gamma_taylor_compute(fmprb_ptr c, long num, long wp)
+{
+    fmprb_poly_t A;
+    long i;
+
+    fmprb_poly_init(A);
+    fmprb_poly_set_coeff_si(A, 0, 1);
+    fmprb_poly_set_coeff_si(A, 1, -1);
+    fmprb_poly_lgamma_series(A, A, num, wp);
+    fmprb_poly_neg(A, A);
+    fmprb_poly_exp_series(A, A, num, wp);
+
+    for (i = 0; i < num; i++)
+    {
+        fmprb_swap(c + i, A->coeffs + i);
+
+        if (i % 2 == 1)
+            fmprb_neg(c + i, c + i);
+    }
+
+    fmprb_poly_clear(A);
+}
+
+/* computes the coefficients a_k with lo <= k < hi, given those below lo,
+   using the recurrence k a_k = sum_{j=1}^k d_j a_{k-j} which follows from
+   log(1/gamma(1+x)) = gamma x - sum_{j>=2} (-1)^j zeta(j) x^j / j */
+static void
+_gamma_taylor_extend(fmprb_ptr c, long lo, long hi, long wp)
+{
+    fmprb_ptr d;
+    long j, k;
+
+    d = _fmprb_vec_init(hi);
+
+    fmprb_const_euler(d + 1, wp);
+    if (hi > 2)
+        zeta_ui_vec(d + 2, 2, hi - 2, wp);
+    for (j = 2; j < hi; j += 2)
+        fmprb_neg(d + j, d + j);
+
+    for (k = lo; k < hi; k++)
+    {
+        _fmprb_vec_dot(c + k, NULL, 0, d + 1, 1, c + k - 1, -1, k, wp);
+        fmprb_div_ui(c + k, c + k, k, wp);
+    }
+
+    _fmprb_vec_clear(d, hi);
+}
+
+#ifdef GAMMA_TAYLOR_STATIC_TABLE
+static void
+_gamma_taylor_load_table(fmprb_ptr c)
+{
+    fmpz_t t;
+    fmpz * m;
+    long i, j, k, n;
+
+    fmpz_init(t);
+
+    for (i = k = 0; i < GAMMA_TAYLOR_TABLE_NUM; i++)
+    {
+        m = fmpr_manref(fmprb_midref(c + i));
+        n = FLINT_ABS(gamma_taylor_table_chunks[i]);
+
+        for (j = 0; j < n; j++, k++)
+        {
+            fmpz_set_str(t, gamma_taylor_table_man[k], 16);
+            fmpz_mul_2exp(m, m, 4 * strlen(gamma_taylor_table_man[k]));
+            fmpz_add(m, m, t);
+        }
+
+        if (gamma_taylor_table_chunks[i] < 0)
+            fmpz_neg(m, m);
+
+        fmpz_set_si(fmpr_expref(fmprb_midref(c + i)),
+            gamma_taylor_table_exp[i]);
+        mag_set_ui_2exp_si(fmprb_radref(c + i),
+            1, -GAMMA_TAYLOR_TABLE_ABS_PREC);
+    }
+
+    fmpz_clear(t);
+}
+#endif
 
 void
 gamma_taylor_precompute(long num, long prec)
 {
-    long wp;
+    long i, old_num, new_num, new_prec, new_wp, shared;
+    fmprb_ptr c;
+
+    if (gamma_taylor_num >= num && gamma_taylor_prec >= prec)
+        return;
+
+    pthread_mutex_lock(&gamma_taylor_lock);
 
     if (gamma_taylor_num < num || gamma_taylor_prec < prec)
     {
-        fmprb_poly_t A;
-        long i;
+        old_num = gamma_taylor_num;
+
+        new_num = FLINT_MAX(old_num * 1.5, num);
+        new_num = FLINT_MAX(new_num, 2);
+        new_prec = gamma_taylor_prec;
+        new_wp = gamma_taylor_wp;
+
+        c = flint_malloc(new_num * sizeof(fmprb_struct));
+
+#ifdef GAMMA_TAYLOR_STATIC_TABLE
+        /* start from the compiled table */
+        if (old_num == 0 && prec <= GAMMA_TAYLOR_TABLE_PREC)
+        {
+            new_num = FLINT_MAX(new_num, GAMMA_TAYLOR_TABLE_NUM);
+            c = flint_realloc(c, new_num * sizeof(fmprb_struct));
+            for (i = 0; i < new_num; i++)
+                fmprb_init(c + i);
+
+            _gamma_taylor_load_table(c);
 
-        _fmprb_vec_clear(gamma_taylor_coeffs, gamma_taylor_num);
+            new_prec = GAMMA_TAYLOR_TABLE_PREC;
+            new_wp = new_prec * 1.01 + 32;
 
-        num = FLINT_MAX(gamma_taylor_num * 1.5, num);
-        prec = FLINT_MAX(gamma_taylor_prec * 1.5, prec);
-        prec = FLINT_MAX(prec, 64);
+            if (new_num > GAMMA_TAYLOR_TABLE_NUM)
+                _gamma_taylor_extend(c, GAMMA_TAYLOR_TABLE_NUM, new_num, new_wp);
 
-        wp = prec * 1.01 + 32;
+            shared = 0;
+        }
+        else
+#endif
+        if (gamma_taylor_prec >= prec)
+        {
+            /* the existing entries stay valid in the old array */
+            memcpy(c, gamma_taylor_coeffs, old_num * sizeof(fmprb_struct));
+            for (i = old_num; i < new_num; i++)
+                fmprb_init(c + i);
 
-        /* TODO: cleanup */
-        fmprb_poly_init(A);
-        fmprb_poly_set_coeff_si(A, 0, 1);
-        fmprb_poly_set_coeff_si(A, 1, -1);
-        fmprb_poly_lgamma_series(A, A, num, wp);
-        fmprb_poly_neg(A, A);
-        fmprb_poly_exp_series(A, A, num, wp);
+            _gamma_taylor_extend(c, old_num, new_num, new_wp);
 
-        for (i = 1; i < num; i += 2)
-            fmprb_neg(A->coeffs + i, A->coeffs + i);
+            shared = old_num;
+        }
+        else
+        {
+            new_prec = FLINT_MAX(gamma_taylor_prec * 1.5, prec);
+            new_prec = FLINT_MAX(new_prec, 64);
+            new_wp = new_prec * 1.01 + 32;
 
-        gamma_taylor_coeffs = A->coeffs;
-        gamma_taylor_num = A->length;
-        gamma_taylor_prec = prec;
+            for (i = 0; i < new_num; i++)
+                fmprb_init(c + i);
+
+            _gamma_taylor_compute(c, new_num, new_wp);
+
+            shared = 0;
+        }
+
+        if (gamma_taylor_coeffs != NULL)
+        {
+            gamma_taylor_retired = flint_realloc(gamma_taylor_retired,
+                (gamma_taylor_num_retired + 1) * sizeof(fmprb_ptr));
+            gamma_taylor_retired_num = flint_realloc(gamma_taylor_retired_num,
+                (gamma_taylor_num_retired + 1) * sizeof(long));
+            gamma_taylor_retired[gamma_taylor_num_retired] = gamma_taylor_coeffs;
+            gamma_taylor_retired_num[gamma_taylor_num_retired] = old_num - shared;
+            gamma_taylor_num_retired++;
+        }
+
+        /* publish the array before the new size and precision */
+        gamma_taylor_coeffs = c;
+#if defined(__GNUC__)
+        __sync_synchronize();
+#endif
+        gamma_taylor_num = new_num;
+        gamma_taylor_prec = new_prec;
+        gamma_taylor_wp = new_wp;
+
+        /* not flint_cleanup(), which runs whenever the thread that
+           filled the table exits, e.g. a worker of the thread pool */
+        if (!gamma_taylor_atexit_registered)
+        {
+            atexit(gamma_taylor_cleanup);
+            gamma_taylor_atexit_registered = 1;
+        }
     }
-}
 
+    pthread_mutex_unlock(&gamma_taylor_lock);
+}
@@ -0,0 +1,2102 @@
+/* do not edit; regenerate with
+   build/examples/gamma_taylor_table 4096 680 4200 > gamma/taylor_table.h */
+
+/* coefficients of 1/gamma(1+x), rounded to the nearest multiple of
+   2^(-4200), with radius 2^(-4200); the mantissa of coefficient i is
+   made of the next |gamma_taylor_table_chunks[i]| hexadecimal chunks of
+   gamma_taylor_table_man, most significant first, and is negative if
+   gamma_taylor_table_chunks[i] < 0 */
+
+#define GAMMA_TAYLOR_TABLE_NUM 680
+#define GAMMA_TAYLOR_TABLE_PREC 4096
+#define GAMMA_TAYLOR_TABLE_ABS_PREC 4200
+
+static const char * const gamma_taylor_table_man[] = {
+    "1",
+    "93c467e37db0c7a4d1be3f8101",
+    "52cb56a1cecc3af65cc0190c03df34709affbd8e4b59fa03a9f0eed0649ccb621057d11056ae9132135a08e43b4673d74bafea58deb878cc86d733dbe7bf38154b36cf8a96d1567899aaae0c09d4c8b6b7b86fd2a1ea1de62ff8643ec7c271827977225e6ac2f0bd61c746961542a3ce3bea5db54fe70e63e6d09f8fc28658e8",
+    "0567a47cfde60ee741e5d85a7bd46931ced8220365594964b839896fcaabccc9b31959c083f22ad3ee591c32fab2c7448f2a057db2db49ee52e0182741e53865f004cc8e704b7c5c40bf304c4d8c4f13edf6047c555302d2238d8ce11df2424f1b66c2c5d238d0744db679af2890487031f9c0aea1c4bb6fe9554ee528fdf1b0",
+    "5e5b256223b2f09215f3719f9c7ccc69ddf172d0d6234217fcc0037f18b93ef5389130b7a661e5c26e54214068bbcafea32a67818bd3075ad1f5c7e9cc3d1737fb28171baf84dbb6612b7881c1a48e439cd03a92bf52225a2b38e6542e9f722bce15a381b5753ea842763381ccae83512b30511b32e5e8d80362149ad030aaba",
+    "5f3a5798bb22aa7ec1b6d0f17903f4e1f3a06731072b10e04218380c3f5be7d44c6937b6e79cf67655f07230456f98340336e1166330fbef5f3cdbe29b7929c3bfbcf4298c94ecfa77dbb06ab26c11890ea9e63440b10921fb25361b34c7b9342a13e3fb6a91c35f67b95163a91f916aa7b253cc82ee520ec006866584424e7d",
+    "a7e7a01357d16e75c24856f3bd",
+    "611d648ed05db9d08fb45c2d816c1dbcff260a1e0a48ef96dcd8c5e15a6cbb232bf00f5977a634e44ad789ec1ee8cfedf114df86f93595c7473287d25818cf9ec407ed645ef92e8f1a86ec2d89f1e94a1e52bc1af586d0ba7acbaf30bc3e04d8eedaf994ef0edb08f7e03de6f2cd9342fed427fa7cabd23f65391b4e335234dd",
+    "941d01eb323ed631d4b4c0803422ee5f42c8eb725da3a8135f63b9c51d77bb812e6230097912890ade1e9e9a1f90ddd8b597b8862a96a383a8e1e06595d9538002e7d80352517396f573ada3b7721f7e92b6d01a937aace1674d69a63ad266af21a29df1e5778b5ec1b7188c2a1b45f72f5b2512c4585aad128bca698ca36039",
+    "56f4b4456e5d0581ad3ffe1388b48e5cf9734f55df6b322359b8a759c80c6a6ff3e41bd4bad52a182a865c1588a81e4ba3c3ef2cffd33a8fbff045806423c319f9bd13db3059f0977add8dc58aee6e2302cf3acdb6fa0a8781a84d690c95ad83d8d9cf14f2cd2a2f09194bf0288d8ab41a7dfc04920c541a11d46e4756ca1102",
+    "1a094b6885062b294dca79ef1c2900f35f61ce76b55cc4f9580af65c379a008f1877ab7357380d9e243683c6dbd2d9f490bcd3360f65df776eed5ab59d476f203f5d29c4f38fab678cbcefdd82a4db40fac70e498b7bcce0b261185da5559b27b3353e54285dfb95b4d6042cc12133f935b9bfeec81d7e4ad116604d96a84537",
+    "ac0af47d13823e47a15a643c9",
+    "c84b0421403ab71a9b55a20dfc931dcb5a0bec289b4393c359777d7f8d3efe83f0060e409547d0dd0377dbaa9824b0e69abc0cbb13611450e94d2886cda2beaf4b4d62ab8d50305212081552273f947043eb9c3047b6a05b829d2462731a5a69abff0db7c1e561fa293a76de5c9ce60310e33ac9bf2daee8c603663e0bb7ea2b",
+    "6e6b7b94322ca0faf813a368cb9a696988a127b3d794b9cae33cc14ac34dcbc4ebf569500c4393a35174f523378bb7630f904709e1f93068a82e06b3e24751038bb5e92be7783f91ce99bcbfdbd1f9122044511d03a085a9702df3c8b11fcbe7b86b03ec56fc7e484f82135d424bb8fa3a4b94cd8913717f8be9c9f9325e4539",
+    "7fa264c930256fabc0da5074786c982f78ca6c91b69edaeaff8e561291e5de3dae2519ec3478ad69420546538bd9b08532bac681d8b96baf60c0df7a6f5d49fa4605c6438594742582e38c23b920d0d3e7bcea8a18aec7afaf32c0ad2b87c32ff625deb233427d767a6c86db7579e07859911dc791e06e8593c3b9ea1f3ff047",
+    "14edf382d6cac75a83da736856dde8e309115e1b95e7dbc365bca4b909e6e1e565580c589d1de52840ec0a00f5755fa762c98bed4a0d2343d4f1c2ada5a20673e1d697af2b5adb11945131472290063cd9d03bbded7f5b2e02fa8fcdadfefee9be1fd5d3d6c58aa61218fd8a3581a736a042bb2f4f50d4d526a2e8dcdc91ca6b",
+    "15512320b43fbe5dfa6ff61343",
+    "df09b43816bba7a10e80ac159a2def376b2d6c96e64cbf20036ecc0a077137176d61b0d043fa0283a39ecaa17d72336b8fc2ed70b8ad38171c4a8b4f3d1265cfcc64806b16bcacfef95877b0c120d5650590d75b5734a7763ea4f72810a95365b5691fe82e3747f351f2a513f7890ae97690701d6eb299749e38aa6dc28c72d2",
+    "866d831275986f4643fb104209c393ace2fc421bc228dd6142b5791f8c1f3b54a9e8f51fcc606391a07a93216a134c360e73c23757a9fa8da160000b69c10d41a6f81b2d393f9f0780ecc578d185b10ce3a1a3dafe1431e58301414e0d0a2da95adb47a67890e37a9ab4330b612b616d826044c1509bfdcbd41c5d99d6913621",
+    "fec5fe4e79a088cdbc97a8af9b3d4c70c5dd12b94be59d0d9f9b48c22194b6c171885a2bdd9b8adde244f3361784e226675670c392fa2bb2536b65dbbf462193e64ea3be41b7b839cf428ea040a6eadcc57c1f26c342a472b9774c5c701aa69f7c5f0d8a2aa59b9d07b0e0029a673bdb046a7f9ee4160816c147e2aa3c49981f",
+    "0df14cf3546fe4a6d7c819d069ebb03fffb22a92369d606e2f998f430d39d9fc0c859bc5b2bd2fe958f17d5dc55af0ed3458effd5f7529e7b7c4b125a3120ff51af4dd5954c95c0d193af67ef796d58fa6cc64b62a8eb7a5dddd721c0e07d3d1f48fa09b92350f3242373999a3f8e180185710b8c11afc26bcf5a9c6cfc6606f",
+    "acd7881e1a0493df1b4048388",
+    "caca42eb1fd891b10646d87e04c83b25b6a43ee2968ad3918040b7fa5d223639310b40b78f4f977fd9a3f9feb9ec7d83ac35dccfec1c9599297ffe5ca0c18346c1a14ff8d795ba8de6827de42075aebbbfcad3935eef6d5ad06066c85de1f4f063c8c940aac72ab987e12bdde95560ae683edc71769cf66787e18d7d356669ce",
+    "c66c0cfcb823de94831dbf439e5a5c9ad0b16d5c110359c425a08acdf9c4243789d06201ea4af969f5049babe977b616dadaf3ec2b42db00add4e2551a613da400c9a60ae63c7f2e76d045a3955943c15aef90f9023077e5bb6b5ce90e40980529b13f4f26d4c47b9738d6ecd6a6ef13754b9ab420070cea2b1bed6aacf3c361",
+    "367866211092edd092176be6cb536d1b079cd5b6cbffcd53dc0f6fdd72712c7558e48eb5b9323ab8a6739650020189ce7049c56e4d656c0a37732463a8fcebf904463b3020e7db2e817cf1bec6a5b115c7c94c1dd839ec7270d7a73b82ae4c60327f952f57d6799c2569eb32911d23498be1ae1bc7b7024bbecd2f67ba78b40a",
+    "3745a9498e5ee2a6aac09d60972a12f0fd4e2a5b3d64aa7ba5ca44598b763c2feece581950cba84c96cc3e624f1b1010e563c5874dc6e1185348771fe259fce1c42c07249ef9d258d998f81789172a282b2c4a2d9ce039722b94e59a66f4dfa4bdcf4030ac4f1cc7e84b861a420ad1fc00cedc310dab57292313e830006c3bf9",
+    "27695e50907c429c6de7a0609",
+    "cd4e6b707ceb157ebee66816439da1fecebd8f628896d35810b9d35922f9088af1c5636ee1a040f7f17cd8aef6a670c982d97f4ccbb69ee40ef76cba65331d763c6576285234d84aa2e98359e037d20179b4fc1582e79e2b25895f8d8b604cc978b2689ac8614d0eda292762cf0f48426ea2f585601e9bc56348e801874f0fa2",
+    "f1868c25044a8fb4ce3e725bf4c4e5c7373f701e201e558ab44af182abcdf134fa0646ce2f30a610345b0b946089a2f26040c1d6ff93a68049290a657a6cf6c58fd2cd837131f6d6c32ac01b538409bd90675b474a9b556579e30699ede7662733423eb04b6c1194cb17461bd9dc7b5b1401832ad57bfd27582f38969a22d002",
+    "3577b4e560a5f32f375b688eaf1d3bc4eca1551c245a5e5f491fec2c38c6f5188eca093b73e46fe2fe347b2aa7e7c9cf75cb8a674ea83c4d2a08375d8136ee9e613fcabc21d6f2989f1ebca1b36c456258f491489847754ee7b823b1b70db5ff96e49b841f6cad4c85bf6ae0a0e7efe9a83eac3b061610030a2d5cbf1f02d57e",
+    "42ba2805cec3f342b9e1713daad7b8c034ba922f4d850b3fa4072c5ceedccc30f9bd83b7ea803ad31f0910c63f3eef893912099f02a1046ae26c327a3e8172d5f3bdd7daecf3f0a0b770bb5c322a10ecc2698e20001e320672b4b375faed5a7fc37b4e51564be95ca880209d8e0f7a8311015bba5eb3822365e47f828e434699",
+    "1d919c527f60b195ba3ad3ba7",
+    "b83c2630d00fc5c603e2d246e87d79dfc899fd095819a04b1f323dbcb8022385ce95b2b37e4ef79ceb18489a0698ac13114420f5c03ebb4e78d271cd41eb469e33c1dfe2ef52d3395feb891be63b087ebcba95601479a564b394bb7ad137947f658cabfcbd76c2b6eff98ea200c8de9516e4a1838fc5177b95c920552bcabfd8",
+    "4cc77dfdd7c888bc9b83764f292574fa257f495f95bc92d93ef03ebbc6ac0076c494e79358b4fb483caacd3dafd668efb36bed0d28cf5860391177797a2a1ee8111c88510c2ca7b5cafa3e5266978ddc5b686274541f05b48f0690dde086e454f5ed67c17fcf051c46150dce837cb4043ff96e313fb46d3b12593e44b02f4609",
+    "2bc96781c6746001841f7bea4c1aca0e52704e46a2d39d242348f890a33aa11a371620d65cc5f9745b076637ae62d806a068822ac07054f7f6e4f80a7eaeed30a67efc182e8639a72f4ec903099ea70853e9076667698c3f2e2fb46efc3d26ea5d993bd9c1ee4654de3eeeec44b3da6552fa711b8a11f1d8b706fefb7a1def26",
+    "26e1bf82a34f083fbc0c40a9d1e8a0e4a265d62f9ef7d61274daec3e935f39ff185d0a2d6d0aff910db53f020b29ef25701d978e878896f58c50af8f4dc39206561fcdea5eafb1eedaa5a3023fd6f7a7cf2205086a9050489667da0385fb409995b91190c59e01d48aa17daca608f2073b9e2431e3ee943a46e6684ea4af9fdb",
+    "1317112ce3a2a7bd2ddb7506",
+    "b11d2b38dd58b2fef37fcee30c274850a0b6e77bd97519a5103bbf1c7f036231c2f223c786aef78a25ba4432ccbd9a9a268c954ce163b156cff9203e800c764e87a5b293598be144c46945ec2021e59f938d40d2af144c3be0868894556ed4068e01b669ae95640d64ed657cf2b6b527ac0376aba4547dfb75233bb6e55875ce",
+    "02efb1df5245a12b784ee6ffdc5862b6ff3a5a94f9f05e10c26541ff51db1f11f7b1a5ad301a34be2228fdebefa457ecce9f30faef07afaec7418bb6d2453a7706841682f7e52c3912a4284de8afe1860cace26d7d1f7d154eeaf2a4b655942e2d288bdcc6edab49ed4ca20c460ff1966eb3e05b98a39095392d8ff22506ca4b",
+    "84511f2118336a65676a2e6d6eceb3e67e0ef5d078bd2d20990de3df0b4bdad6e14bb59a1f201bc6c399950524fbe8e385f445a00eb1469ed46d660c93f53382cc332b1b4121bcac58d6a9cf3ef6e7dd437fa8ce6727c3c219cf29f9e373d844a37246f20b10fbb00639cdc586f442682096e8bd9ffc7cf038522a4da5f78b32",
+    "4ac3203eb041b6d5945d482dbbc0d21e94a882a533a8c1915df25c2fdc7e302bf0499ff15e50bf8cd5389e71733f939a7c7e05014d4213352912f4de15542e82bc0734eaff843316f13940e460c43356b7300c36c4e235122dbce3621a52df27c4e279eeb23018a1bb874e3034f41fa168d039079b42d083c37e352d0471e69f",
+    "386c9fcde2ac79d31f011c0",
+    "f21a46dbb5ad1b25da1e741a22fbcef9ff23b63d5f4636a048f0c0fcfdc4e1cd9acbd5c4352b3d202cdd4b5ea863eb1c0e58fa2d56b07ecbbb4bf4a9eed118f8ae996d08056d52cbe14eef0cbd47fb0e625a1de0a9e33cec5680f32013388c55042b978d065e01b13e5d7203be160e4131dcce0fa1a4bbcb1978702affd55c0a",
+    "424ee5f1ff55ff1aa30939c451232e3f040a6a683b2413cf09c198730f06789162f98d88c93367e080a23260d688c1bdcdb94183a020b34caf61063adf26ff7dd7fb784c8775787460e70be10416e1b2a5b3a6d21cb87bc78ad5b7a9344e205eb496194ba55f7847e751c20c9fa0311274320102ced1e1aaff80d8aeb07cd757",
+    "ae1ed132e07c7a3d2404364911ba8aa1fd452ccfb276378ca4e0709776609416b93cc69eed8cad6e041b32ecc62c79c891cfb3c031244d14bd32a52ee81d8383b7bb3ee1b558591878ad134bbc599bcb4acc0d60460a5f0f98743b5527c59e6d68241a0b3452eca32a14aa8f39afa81b262e662765fd5e27237fe786ff01fc45",
+    "ddab96632828ef25428a0111cbb88dcdc8e1b0706629046cea71afe2e61d7c4c62ea61dd287c33dbc2a5a8076dc5838f10f951f6ca67c6f1f277df2e8eea6fb8bb9e4af415216ebc63fb1b97fd7dd7bd78c50c172ff27e4b7489c4458b4fec682b4844d91fbe234754ad0b3d2a042733fa5cab8a107355bd0e5e3b72e6cffe4b",
+    "86453c66cfce8d3cd83432f",
+    "acdb927f8a4b18b2b27b1abb20814ad95552dc83b16a22d6cc1c2fe74fd07d290accbfae6580d16fa9eeb9e4e190a1b13dac9c8aea1046ef89a1b822b50548ae09aa579863703e87e6d3b6cc0eb519c4326f506b4673e3a3021fe9a28122c4170e76694814f38190c621771846ff1ac62f47b540ae0740aba3501846b8116190",
+    "7a79a10a7853a2b46babbc550cafcaf7e2c9089bc85e48d48a7b240edcdcf9547ee06b9d80461081936883c2e4b4da73e37fb02b953824836649154db210b80ee8fe359ae3b074329703e46f2b39d68cc887be2812ff2b4063b28de86b81f3f002e80d8c8ca168459840b9be0dbdc048bb274138a5cb3ea324170bcfbe118526",
+    "552344e7517cf4a23b94933da1fe1012967801cf3096182ea0ab1be1aadb71820ae8ba841bffa0717fb74b71b91f2718748a53726484e9a708b4c1f4c80eb7ec4be4b8ecb3134893555c526b69dbb2bafa9c125948a34b11dccf64e0cc43fd3e0e8141cb88240985b2496b512cdc4b472633ca9a8422ef7fbd4cfb64e7f9498a",
+    "aaeb7c641b50a13de707e89412fab53f301b9a90f08643fc43dec9233ca30d70d719043917c3d5476e4ddd05dc0a38ac2b3fffbc7bb391a53a541706d13eeb546109c17ba097ecba731073abf2c838587e1896dff954cf5cbeb7b299a1e2739d27ff4b3dc661ffec2446fac35b4f7f41b79494676489f087c64fdd1e5b54d51d",
+    "a8e7457a3f55efed92173a",
+    "fe34b827daa78edf4e8468170addbbda779fb44b732c1bc14d5c16001580e8eefa37f0c3edeb27e8702f6de019f452f8cfb7ed9d5b2c90c164ba4d4691a31e9613ce3d177abc633b57f7269612f2c4bf0759e4bf5a322aba35e09915384add3e25df8e5902126908555185979137115c619cf023be2df4519c8d10ac4bd61a97",
+    "6514944a930c4f62f968d716013e598b2235b2c2c85650e6c9862fe7757f5353a4131223b1dec1073b1a4fd92f6a36a885402445a881cefe21e3689ee5ea13eb11a365323398f25a771fd2365cdc75df89b8f343cf0d2b8cef14dedff6fb46a1588b3a1edd4e392763d9174f757f742b36018b5b16a80a7c8a2865b7ce87874e",
+    "30a2dc0a23bc8d62968ffcc437fb024a7d28bf71408513293e60bd1d29c2399a6641fb800a04085f2d53452496b58aa6c6c3665344936183861dc2ae11ffe7525f8b6a6b0de62152b89e9d96496a72590cd90a5716dbb86fb38574fb5aa5422c79033201e50d48570877f58fb3e563f90eee452e6b51ac9e884798f56d4b951b",
+    "1458fdcc4d4a3dc2d3f4276425f4b569cdd1acbaaada2c6db74acc61a2c8e968fa417db143babc965dfbc26eee572e274b2d18298e4f5022283467d6179b8513d52cb89986c3ae24d12e96ee974b6275c483d90a3fa9a15e70eb20cda95fe0079a7e07760cb79dd16602ce9955259ccec1622286d4aecba75827961a06652ad3",
+    "14fad41fc34fbb202eed56",
+    "2c1b8f996d90f9f29f3187207947954285e0ca07e28b1224b0231b9239949105d37276904a8599fbd84fbcd5c4db60df6f34331fd0263ac377e9d2195800f410ddc2efbbb6f23a2361647f1a6d402d8c80b55e8809348c362a221b9329b3d1df193596856ec80588ca7ac67e9efed833f6caa7f641d98592d39996287f128ceb",
+    "a8a728d531ccb5f038d82e9d0136a42e0de8aa7a09727c120b32e23090579b33690b5f35d8304b20dd2c32fe0204c59deb45f39388af3bca5b2e9b2761cacf7ec4b43967bd036450139255b9d668d197f1983f71e068e988aaa65a4b1456f8b9bd68b4e010a119b74d7b4f212a1ac20907901d11ac4b19d8cefcc8aaa1557fa2",
+    "0b34426395d2bf7b4fdc327dc7f90069c645c34684095be19b88171e026f769829fb0b851941de0f8bdfca9d1fc798498ce2eb2770600a755d75c9732972df188df33dccbbc3f73d81ccb4d95deb3c71e2804260dbd3808ea986ce9ed38bb7de4612f39fc135a290b817ac9a8db406dbbe45a99bc494ac906878698898bb265d",
+    "ce341d81b7ee88e54c1017684959e7b201e4d733828c9808da3ed9b038262e49049ad8e8a749fd4274caa6fd90821cc5b741aa559dc843cd62d451a323959c92fd922de72991b4b140999480bebbfbd4d9acdbcc67d3a61ee31a176e4abf36359dfdf1d5685c0616344de2c1b9055224f9d68820ad382876e508c21d825abc43",
+    "1302509dbc0de2c81edff9",
+    "6fc9cc9e170e5b2f87c1139ee4a9fd173e07174bc5bf19f4eeeeceae93c05c847dc0956f6c070b87f3e8c6dab799d882b53944e1c9eceeec005fc5c5ba23951b0976440db77b4f774c1e41e029a23305eb450c5589facd8ab608395ac7da6f8c74778adcda46c569fcfafa77c79de67918c99dfa5e017575799ba957b56ecd3b",
+    "a7e116c5a81f969fab7f0bc5efe75f49296c1978b1bd364cc639dd9e743705b8be1bce5bdbce1d8382bec5c28f2468aaae3d0318227b816e6a582cefc200d73092124957ec5a0832251e165dcfde2917f2ea02e2fe8b1a4cd015022bc19c32d6f122b7fe232d590b33dd3d1bdf1a8b3e56a6bcdbb16c205cf553895b579782a7",
+    "8e5233ef8da2c6749b0a7f63c5a60537b78a614d10fd087532d92962563014b01db88a50f6f093558b34e9e25557847f3041784cadf9fee0f9bbe1c967e3f36ac1c98a6060192f18af93dc01702b0006cef2e96e02f3870b339b6b553b20858d94aa84cf9313667de08eaa3954963d3c972cffbdba5c84c26feb63261decb9c5",
+    "4df2a136d3665b7057ae00abf4e6673a934428ad556ce2b7ecbd438f631107e7bb0f60cd1ca9d2b2391d70027d2530280a8ad732c1f7926358246a1826e8b4178b9617f1d0ece9304e7e7a27718e7abc3b8536adba5ec5379d113508024b6d75f35ba4e63fa63962af25a58cae1faae739d9b6d5b85c153dfe5759d095f666ed",
+    "dccc33336112e8e89722",
+    "ef2ce809707c9375b64f49bcd39b3a10a5606f4f606f6a9ed9e42dec20650d5c5a9d4fa2bf1af101a4f13966d13ebc9d598de9d636d4fbf41beabc464f11e2d161af8d09c8b4bc88fb06274ba938a0c2c0a0220a67f54e952a58ebae09a881295f39aa48df6237a2f13f850e54ceaf8b0f1b04664879ba62c50779a8db09a81c",
+    "65ed838f0ede321aace25c379f799486f827ebfd5f50d9400b978997e991e518f6b17eb9cdf2a621484f78a07c652e2cfcdd5e343dfff1bac200855f1fd1849fa3efe5a8f47b5579186b41c115f2f3e81a10592ddc102e2fcb01782a31627044587d3b234dde4e121ed437489a25420f7029a268b689dad6c61fc4d2aeee3c47",
+    "d9ef84c25fa4aef1e5fc6c557d40fe60e39b4f107f699a2ce73bba6a85bf703b74651661d23c9073b402fc92fa5c696313e627d0d7a762a051a509a53e536f10d68fa27f64d95fe6bcd259b1ba9c3f271889090106041b6799adab3d1e521df9e334674a4cb04a20abae2415000b0e50b3ec2a369ab4b14a642d86183f6353b7",
+    "fdfb8b3ae0e9ffe2a1b13ffbbd910c9d6ee9a2dca2455a0510b54b087f06e3cfa2aa2a5458583d9b979d4b16557e2e9338f7dfc3564537aaca924755854480b99878cb4ce10966d1dbb0d9485bb060107997ca30be03f9198aed811acd350f6eb0c0e16e6d7d644f3d73e20503f225dacfa9099b5fb052b19d410fbe68687477",
+    "1a44b7ba22d628aca439",
+    "8dfb26833b810438aebd6cb6dd3d35dd877acfab6596baaa070f302e5fd88e8d0ef70193a65f33ec3e2bdc12f80b742e8547ba797d8f16b63f9b9728f93e3b738ea7990a3fc598365a4da6ceee713adae2ba3e475046c1f75fd4deace0c28e8209da2ee3180258a5b0c293da28bd5a51fdd1cdd93525c514fa98e1e76fc6ed89",
+    "e699c12afc077d7ca313c5b7d12420153b1bce49c01f87beede45ddd5c9a278d440a3dd261763a7f795f277189aec750ce88053fd04fe558e47d6e39f8fab3572419354824225d9420e12626be82c6e1cdf1a5c2cde62ae7d3dc07a90012b5368bb08d3dde0cc325e5a9808e2d87e86537507aa48e8623da713e687c7a7d91c5",
+    "d326836ebc2aecca8fad3d0f4e64a2dd35d23808fb865598d42a4b83afe5e2fed2b0274074208228da8257f6d070d507fcd707c8d3a3104e650440246eeb1244d903ba072d055e45e01c90dae70f02de73055a8331ec92ecd3c611e453ffa280846af65720079280f9a82c75130ce2b51e0a92db0ed777a04052cd1fe661d295",
+    "ba2e345cc9b587b96f8836ae9c07a6aa9a10c0e208be698028e7fc71be9d8aac44ebd715b02502d4f539183795f13e14f4e4deeee54871e36beb03c49991d202829b9bc13dbe4af54679ba57f91a14ec0ab9409f6ac0232b99659fd652a17dcfe81a5fba36218e8ac3f5cd179e861ffbe500e4ea8d399a09366dcc7c88f07643",
+    "abde1fe1c2199fd9eaf",
+    "bbf416e76d1e04447e34f48359ff56d6d05c40f8da642a5d3fd83ccf010f99e4254863bbf2854a1c8b028ba52685531ecdf9a7e8f9e25940538184f120fa98a0a84a585cb8f083bd457a7fab51efebf11b00e74fa1fda68f56761cd9ce1df6b887aac997a6d8b8f433e3c8df603d76a01d52084bd1dbba1ecdc59590ba3ee86c",
+    "b914f98f5609cd2748ad56573e03e202d0adfaa79c85fe1c3fb0a7c3486ed09cc2dca52c396c614d76b218e61e2bbee571552ec255b6512bbe393f9d7aaafe572fe69761a8d462931c44d935aad11aafef9a1651cb191341f98c819d8698b6aba7a620523aa81fec4fca3e749f324313c56a33100286f72fdbba3528bc7cf63b",
+    "f97e07e803728fce746377fc74a1e30a008e1576a83765eee09cb470481672614012b72aa1cb7cddda15773f349357c887fd6979ed26b6e9155cd36cdb0e1d040016e07293273edb0e71fd52a28ed6511329eef60b7800b2546d7bcfe21402a62f9ad5c6fffcd6af2b036afbfcfdca0a0814279897b42bac0350c9da3b989394",
+    "46cbd7a7786189e25b566d85a00268ab539bc2caaac5d34d44cbed2238972be9aa9465245ef31c4350135558399ecbeb6f10e710236a4608d5dafe83a3e07c4ce43b7eb6e4c112da94635045666e0c4ebcb27d8759b2e50f75bc30011e59f17eaaa27ccc2aa88638dfd0ff8bc8874be165aaaf89547b99b309fdf3dc680798c5",
+    "512d33b728e23df1c4c",
+    "0ce1c9c4bffef357593b91b172d2ac0d8fca4dd299c73da600c47d89273b79f800782474fc3e03daa31d99a08953c59a38e5988dee5477d32abcf772b6fe962844d035efaff44d972bbdb61a82ce63df64e1b66e0455f9981c501f40a611202c77d406ced563f63d295a16b553eb8157f87d787ba58dfa2d4d8d433d3a83baee",
+    "5a7b3f7a146d849ae85bb396da99777a32e8718ce99f721cc622b238cf746e35ae0e9a651986bb58b6538e5cea3512543ce482082ff76465c0bffcf6c32ef67601418c0da2e26977f8b9ee312a82008a44e620239f58a6d7106349ee6ed0d15703526a116b6c2e636effb82dc28902f84740cd2e49fc1439827577e1b1dd133b",
+    "e474a3459f495e23b9ada1cfed1980669e24a5fcc6fdd87112f128ff84a400412ccbe4360ec3e51595c29d549dacdedce3be25ab051f645bf21e7e87f3a4ad719d74bdb17909c6eaac8415c35ba6ea3968d1a1e99be5653a6a259d2085538fa00cb5f61153271fd5e1b6b7fc3cd02273e293d3c036c476643773dd1d51052df6",
+    "c1ca79994793b2191ed1036a7f7d2d4dec23c4dc221d7196d3051afe3e8f42cedc096ecf01dbc517925eb918ce8c90967e9105b0a65686213752f6fd04830b6baeb111b35256acf3067510bac267ac19b4ef6e52cb647dcefd268e8872ca7adb22e0e80c99e0d85fcdb3a99bc558c09209c6ff9577e4cff1b4181d3d9bb0804f",
+    "72b9d9d706181b17df",
+    "be9c1ccab1db01af98b7dab6522c5a40cdb1d0c51f121e7f263bf679fad42eb4c96e79e06893399ee66161bca54e9557c2f38df037df6523e20f88e393202941140fcf0a295a1b201e9d66dc5f5cf676836b06fefc46460ed50f87cf461e9cf4516402658ba58eb0aa7c8b67362e7ba615c0558d73338e03071b9aa87cd8a376",
+    "b90bf3f0b249479f142149760989fa986c2001a61a4cbdf2616cda5b075108f8c4107be1dbbfd6cdb503b12cd81693b8a2b6a0fc85435ecee3ef1155acd546d12b7f1bd7e0a38826925459fe4a89eb22c6bd6a632170877537714308d6106b0afa9ff605d3d86cda2366ae0786f492f5eddc6fb84117e7e8d97de5a4854b48ee",
+    "14ec3a605b66be135206e6374cc9535a1d1fe4e3f160532f48bf0aad3057d9867f4a4941fd642ebf7de059f0e045980f4d42877e417d68ec265edecca3ec6387c6f519ee0d56b10fc40f3c4d7f73d90938c95cf26ceaa740210b8f6ead96c855c91bd32863bea54a387e5072b3180706f9914c7aca9c7e40611f0d5caab1cf67",
+    "45ec0e9561c51361b0c8fd5bf6dd96b52adec1ce5105c79a943f5ecd2cb88d8f9c0173d6ea8ffffeebb22ed65e3fb8f79b3a4c257851a814cf451a8de6f743738bd5809a78ea44c8c0a5d5b9c2670615205eb453ca420f42906c29126ae449a996fd4063d8a6f693c522687d42640f6421328da5528f56b6179aa8f3d861413b",
+    "88e832dfd7833a2d6",
+    "b19f0b77e71c665c0b0146edef531ceb6b7b3d1a0f4e7ff6fa185df1abda1faecfa87b7b6bacb97245cdcfc8ee4944375908e5d61990bc46e0a75ac5374557c242e456ba7225f5c53960d0d2c56599457d0934bbb5e0d83569476156453dd1ddba5811709c7a3f6b940d44a35c578a4c8c72d668d1f2e1ce7b5ee825536b7ac3",
+    "e2e5fe4b60f0103b27d014795d0c14185ea82dabd556e67826986cc8e09073ddd6484e7aba19d5bfd99933f2e9865e00f4e9fe3593266a7381193914285f9bb3fb56ddf446a5195c613e4576c8b0f61077149d27a774777037ce182535f37a2c3a764d3031edb3a4fa5caef34df480445cdfe4a13120af5c3242664f437ceeff",
+    "6da9411915e2b0f0371ba957920014a334e2f526530bf38b269591b78c910f26142d49e0251999f7b65a8e456af163f7ad92d4ed6fc9c3f333ac2f2fe653d9d354ce09437f40376be9a51e483ad02f8725a218dbabb2635248e6dde78efcf3a19f9c4fe69164be2ddea54a8c8ecf1fa063a2695dc99c22a4412a7f45457ea19e",
+    "395b974b07dcc442fe201aad54665e5ed81e9768c156914cec745a64b36da3de5a4ec109e9a2d105eb4b2f27be35a58d0e8d49551d7e8771e6e00c332038e5d7ed2949df8770e484869c568c7387b7d5eefe4770878719a33ebf04c226a6c65069e57c3077c949f416fbeedfd895893cc91cb06c9d7de35a03f2863fa346f0d1",
+    "10423bac8ca3faaa4",
+    "6678bcdf13f40828c1f38ad1e34f2b97fdf03e07051fcd164afe3bdeabf669c26c576fedc6310ad49375ae8ec9f2f54edc40ed2eea562792d550f8900817f3955991c9c3adba97c902e49e2af025c4c6cba37e52c16d6334d9f8c72bebad7f281577e0e7c182d5e45f7d3cd1df48b7fa419288e0090b8817cd285a5b16561201",
+    "5227f9342cf0f4dc744558b8faa41cd052f148587b1c21730bde769e5059181cf4d83ad2be89c251e33cb5f63ceefd4eb15a911942f09c40c19b3cdd0d67f4b4ea7fd6275aed419f942fd5e2521a0c5ee84a1a9acaaf21ca4bf50f7c930240bcb72749ee5f50389ebb4a4695bf654966902bb6a51b3d6598c68d35dddc88c84f",
+    "3c07d594c21454a85988e5ae78f9000b4d2a0d5089216653380100759f8ae820566649260667cabeb0b3afefc2845e6c4d157276cf8a138a7030760a1c7503d8c99158541f6dd85a07b005f2a80f282f399fccd8d6cfff3eadf1195d234306a5a799b1cea37986f0a480c94cc89b3537c37589ae633b4d2c03afafa8076f0707",
+    "7d1c8457e53b3fded991cd327d804772c408740900d174113e92af4f4db887624ab9e15b7e6c97b67035eeb5b0f8b0ce073e24c1fc2acd83da4d998eeedfab1e85312278c3993a962e243828d08c55d48ad443cdd5a4331fd16805d8a031eb8811e60f8a5787064a039c15eda22c7aec20e5c5eb5d109a0651518fa5c1e653bf",
+    "47c80544c8f340e4",
+    "7b431545eedd49199c5b33e3551369e6671dee691fff5c59a68e38f4e702c3376be682966acc7f0f409e6ed81cfb83b19090cda07ecfa06ad1de47ad60c3696275a3829c951c3e7b2e619eee4200212493cf23d3c94719bb4cde1db1237886eb1c7b83fb3cdaf93f60e1baf2edd27960a20a81c8851eb935e5a6e97b0b729703",
+    "e15aea787bef2e5fbe556722d17e23394519d1945b610ab0a17ec041aff31a77b403aa716c5f18a5ca90c0f56e63b8d408e54dad70e06c6cdaa2e4d84aa20a20b2eb48aea5fc242a26743687612539687e325da40161917743434f60b089f453b4ba9d35b578f5d83080b14bf8271f401d471607849a410486b79582777ed082",
+    "a76ea3515220197488e6e60eb64f80c3b7d5e06d3ef3b247d39e4c0072783702682751739a60755df6d52041d6f221979ab1422949278ec0e0ead71d046ed72d4b92bb77f420768aa56affbac43d0826c0cb198d8f6e020e852144e5e445c9366d5d87ad263fad782de7d552c0d697b1d407df5097cb02f2b57adf8658f77669",
+    "6dcda394ce8b3d580715b9718fb2808e2ce48b2ead88e5cbc05d9182ba64d2a5b6932099f209052b63d7da11d4f00ab9a669905ca02c84d6d88e0859ea2e5d24b77fc54639d3f7c13c2c2a777ca7519badc32a9c6bff2d7d71cc2dc987fe3c2070af7943326b546892a450337b8f83e684c88eac95d6c5abf0fecdd4b8d63609",
+    "172cb88ea5ae6e7",
+    "7a5521b482ff3ed4c9104e5afc210fa047b41556d290a999a5b4e9771116dabd5ce562ed8ea0d757e3f4cb8a7f1ef7f68a16963c37a635cdc59bb2d506755e17cb688ad4e87f86ae0b19a8e935c331f5e46bdf00710988102c34f2c1521959e6a4a92a695a3ec9870f1fd2951e5353954b07490d09e100ab340904c67168d049",
+    "a62f406123a51c5a0c306a290d4df20f8e0b9271f2e100f6af9919b30c0ab919bc8cc8b4dae343956b40df2261a9eaaea570e721ff55eba1b596e7e0e7e755c51814175302a2f8e769c5b642487a40957fa9a01a1e5fdc02ec0509c53967f77d017460c5b107a0c962a1306be861a132fb40be209ec25ba52cdbc36f33368922",
+    "a68f525f4012636fd6dbe776c9c8157dd26b831dcc1602326c30624f871458a2dc00a8c3d519d31282573c942115ffc9de51097ca3ff529a3610bec58e66b78ff42c5892b44da9fcb877829cdf2e18e9644c49bc3e64c1d70cc7127c2690ba39fb471b30a57a01403edf4bdc08fabe55935460b47b907572a892a0db7f999545",
+    "738acefff8c8103deb645e3e02c1ee841b1314590231d88f6299ea029604f70003463ccc790335a94ba95048e88097e8380ea44633cbd4a19a2f4161d0c373984842fbffadd38c1e141dbad389e8403bf208f52832ddf8c4607b24e78b15954da52169cbd028cdd7aeb5bb3df6a8a9a154ceebb3f95e92f328486e5c739cafb7",
+    "1815f72a05f16f3",
+    "4996630ce608fa6faef9c3caff078c69fa07f58cbbce33bf68cbb419525f4572ab3a5d56b93e46e15f274949b53414b25d952556effe38ed6c4aab00a6d8e85555501f0ab7de7e0eff10b574cbe4f338b8b5257e9c385d0dd263b477b372c60da2970e8ac74a267a4cf4d982309a3150383e863d85bc4b2162567117242e01f8",
+    "15bf35c717fa7e9dfc62bce3e66f9bc8b6ebb5535d2d9bfcd483f070e38ff4122225fc714ae930818dd89e390b841e818e6e891aa01f2c8bde17d12fc345f434429364358545a8f89f3a0b3fab6427c9974bd97efdde2389c6cc8eb4040bdf95d2b08ea6ec5f5e4eb65d9e2bf018c012d374082dbd0e7b78059a85ae995f39fa",
+    "eb946dc66675a9f21507126ba15fdf572672edaddffbdcd6a837734bccb9ae63a6a3ae303b386082cfe49b8df3799241bb23d297dc72f3aab45b45b2240aac821956976b658156f440f837d8db3a67ca25b4859203a5cf23f2ca748bfabbee7529ee68ec3e3cf145bfa46a9a128cb75cad947b36202812cae3d3e1ef45c77ca8",
+    "733929e4e335694eb1232dbef413fc1f1140f044ec01fad08245e6ddb1459b48166b69a627132e1d84a378a6e60646cdbc6b8c1d9a79bd2ba831d2ea140776e40904454f269f5b81b746e009ce331b50549c96beb94ab5a979be0a9f83f3942df40e0e06d73bafed11fd53445014b036a01d203a1daeddd725922b44088e4a29",
+    "58661246a0ef32",
+    "f8996444eb8cba433122afe2dd6ca9eca08af6ceddcab010e61525fdedc681e1050c28412a6b3c5103d98b3948d9dd8d3cd0373b7e3f879c8e7f696577e2b171ffb9a92b20c4baec60645dc7e203e1ebfafa1bc085ec9685078235856b35c33bea1d8001d2cb24490c15ef9840b62df840bd059bf0124c911824dbab10a8ee42",
+    "3e7af3cfbc05701887baa41be215c69995d4439c7bf97481839aae1981dedecf24c162b6cac63ba55bb10762e19c653cc7f1a19f3e5a6dde195d462555737099c47605f333d95ff3bbe2c7ce50e9bb213736716f464d4eef566e7a6dc51bb6e5795acf31785b25650aa1a8a46a845c594873d8e4b9d14dcca6e8914640e5079e",
+    "8f1f9a40fcc9a805181f0fcc3c9d1afc9e8ed2fe74481c574717e42269a1e6e9a8d980294cfad6c4722f5b5b5807b40eb18eae66017e4b6f75cd932e6bb31789673b70cbcfd2d0143c5c815e884ff61ae0771211d8c0601304ab381caf9ef2d5ab2714ae74d4471782f2a827df3fefa1952fb9979aa8f91264d015bd1c7a7a45",
+    "20aea7bb4c7ce75df7d4cc320eeb51be742955312a356292768d387010490c78f2547a69f1809540d9fc1c693b684beef34d4ba3c0fc3008b8a5a57006c25198485d71ddd45079910896ea878b232a3f0dc27647efc57ba6cb814f8ff4af26a7c2b4c0e42eb5fbad344295cdca3c836213db2347f043e28fc869bfab68aa3087",
+    "88309eef2bd44",
+    "5ea75ae6e0286820761900736d9157f2143590c9c940b79f89b9613e55421cf3dc84d503fa6eef608b784b5117a1535959971dca628424205a2cd06704994df8174a2fd0e8901753cc7a4b2b1165620cd87980e8f302249f807ff96efb5bddced5c38083a10ce2f575772323d62f7ff538074784a16fd979819049c0d2e0bbe0",
+    "d1b60ee289ae6682a09f78f45cf8e290691a12092e6eb42ab5b01a986f28988dce4df96e25c160e11debacec4ceaa4c169c30ea3925c32a48a32d13f323346f5ac8bd7f15ef299c14cd32c6cc16920c0177b6354d4bee93ca354812a71662d1c65fcf81208da7c4d2867fb8e4ca5a39bf4102235eb00246b72ec442c303fab8a",
+    "54333bf867a36451a2ffb1b3a76dc43c0b31de4610fcf160a2bdcc4ad8da5eebcb445c135b3674c7561bc09e0b66a31ae8f97269f22798ac5c5670d8e624cc1c4e34bbe550c4fa711fb790210cb96d12cddb02d70c37c493d432faf92707d6d144b8e137ee46cebfdd5d1b398ab41a521e08c93b4bd71a4ad6c7b3dd99bf3d45",
+    "6c563447a5a799b494e6f742c2a22670cf54a885848a4bb95eec05de5cd70ed1b513ce8e18508da987c61b949e80547d175aa9db7fa66d82575b6120f44d346b32093a6c1d9d9f3e29485275621676004c254bb0bdfe88b4cb9381d21e6a74ecb856838adbe6c15fb11de3fd743db6b398b1da63fbf58ed818eba0f935a5e005",
+    "15e3fee81de0",
+    "e9c81f75b55ecacf9e9856f1a4a0123babfb53fbc301d44de66288964994193b34d3271ddceaa6ed0320bd78c04c481931e23d0844b1db92e9f3539e50dc0754eb0b9810a9777c940818d7317d0db80630b7f78e557c1d32b475344e47da66889d24e16cbe18d72ff22c7d7281c78ed287e1b44aff9ce573ca7670be68ed8f23",
+    "0c95c2243b2c7e5d4d0ef31e7a22408c3184e947370e74a19cb895b635e74428c43d935aa421d276fbcf911e734f10cca282b58774b3d34cac2219d50868ad9ebbbe7cacfc6baa3098a012efe5a16c60caa535106f9f42d84456e017f4bc554352c854c860dd2f2769654cadf233cecd06fb154747a28bae5baa3d282f02d247",
+    "920196426394f5ef26ee11c8abd76c61c3558af493cc338e40166a37b66d740d68237d5f718a01133431ca4fdff1d63be38c0373daad016e293ebf19d1db29d2fb3607fd68367042057443204e641118d08059f01933e5c49888b4344df9e0d20f5ccf22ddcaa67f0b7c8eaf1aa70138a1a933ce06eb45dc7dd9491c1d96358d",
+    "6bf2b1e6003424e73f37c58943aaaa1078801e527f14a915066a4207fa7aad8587e24bc90955958ccb41c77d01a66cd139a4dc390cac3feca4350551d8859ed729c5353e257cf6a5b31fdf70bff3c7fc7d63346679bb473bf53f9fcb05aa95014ec47d8c70e05459664b52ad99704273ab5ed88675f6b53bef3c0986f4da0275",
+    "341b8ee1f71",
+    "4933691f90cb60f0edbdd45988dd936ddf39cd60cf70cd2c553369ffe9719a22363100382d27eb498c32dafd2e3840c82b800e76193c9c221f352628c415b5e3f7903ce7023103c17f889e50ab1d3ac00498633cafcd2a8ce5eba3b6ac8308153939a76ced99a8de22dc689b281dd61d59ef41a9ce3556292095d7a75542cc0c",
+    "bf0d6850cdcda26dff13e34ac310aa702b6f90b97a60daa6c9749bb49b4cf7700fb90024f0b089c7f8c8aacc701ce16843a09710d727f7cb6119b1e01316a61fdb16825d1d0a0b2451444a8b651eb9d01d19b3702b4099e3f1d52bf9de7960b6a3efbd38fe4e769a8826888ea7e044a713d63ad3ef8842ea9e2aa91190a198d3",
+    "ae695043359b1b8f4aa5140538de55cca8ee21b5b2f44bb0a3237261b0ca2ee2db6a10c8d67c8228c0cdb1548122a0413e737c68a20f44ace9102f21ef4ad90b8379cde0ad9e2fa2e22b451fb2fd943d847fff8da9a951f86be780274a4259dcfeb1128569d99cb1f3ea173ad3676031f1f0d025210d18ad71c4f8345c4e45be",
+    "9becc5b485db38c92fb047fa3c04d9134d4735b465c98be9509906dd8d30ce75fbf374cccaf3e91f749a5a09839c40f6cb6019ad3766d8053395faa450f9d8b23d3c6eebe628594ff9cf8103b7f1639709e8424cfd7f702c6b48158bba06f34ea069e068db62e7ebd35384ced8002041b99a853cfceb70f2d61873b5a8a8329f",
+    "43d8d4d128a",
+    "7a7e3a37919118ae06766bbec9065156c3fa303b8b8c4cdc24bd90c83a4ccfe312c61a58a4fb69f0fb2da436dac98a3a62bc80fa144905ac8b77ad9c7908e135d15d0228619511eed1075a3cfb58a4959bb1822f7853405fcf76d8713030b3c637f550ef204406b5cca3eb05bc334c9e21203fbfbb6519d2f7cf7fb0ff6e5aad",
+    "7b044030b3930c52467a331ec4dc16c6fc42109147a8fe66220b9c420e14228745859bf620c1083737a791acc7c589b549c9dc1bc81f5253f7f288234a8b2d689aae235479f0e7023eef3f4b0232eb1fadfeb0a87cacfcbcc2fa3e429af5008826f54acb7cc4252d54a44066978747ad17eb56a939162d084ed3fb13fb6f5296",
+    "fc5fd2010b6f2566061c5ac0f5be4962afa0b77cdc2fc86e0261dec6479296e6ac4c4e2b479fafe04a2d29899db20d2d5b550a1ca1ffd382715c0fcd15adfc39e57a7dbcda876d4f845911fed3d36affd9e78667eb5a07021760bf0f9a61c3484e4d44879d45dab1a7ed34e3ab896ad439599cd2082bd26c6d61e2386988769b",
+    "243bda1ab6c59333a85621764e17c7a10eb9c558d74397b7d0a9d533f1f26edcb0ad5ac9ed44876d93fa1276c0178719414601f95cbe1c98d8e7676b39e9fad44d95d5ff647f64a2a7304cd1ac448d165932a01b244f7ce69500da341136f714e9d7532f904574aa6d99acaf270e0fa7b552d667f8da9b9a8c5d716290f37895",
+    "143d79a4b9",
+    "0ce80473261d4be6bc730061349de6be402b6bcfbe14c903735ecb39dbc24ad361318ec11f9a809168c388f7523cf4bf15a32f88c60a09886a8f2cf45f3b3c30ac95c2b80f20557d9fdbded712d708823e7b1ffa8c174b43ed77a36782255f91083aa212373eff907129d996ad962fbdc6d5b5613c48f6b74189d0371c679eeb",
+    "1fa92f2d6002364a7e7e1ec0bbda5cb2a55188a2bd34a747030aa3e50f3eb8e861c5dca0eebd47a84be70fe66fe8d20cc94b7087966a33987a8c7c4992b45057da67edfb9b21bb84e59de99b905496216ba04010f871c15b8b30cca9e812065fd4232a83df84d23fdc87fde81a0c64b4c35bbfc5001a1ebdcc3e1268776d2238",
+    "9c3e41e498d982fbf36992ca7364ef520f87d86cb527b33c407a34101f851aa8f785976554f965f849fa6c8c542a56c07b578bd8cb317d51860e57a4cc12bb2fe32ab95e1d1cb1013831cdcb1b02029ca87f56d06e589fc737a48b5cb11259362e48898c083fd9ccdecce438cc9664663efeef885d221332c72f3108eb2b9383",
+    "a3978e73594d420df649e20d016b7798518482e95eecb13086ff9e10a629e3afac18cea6df3e998fe6a09840139760119c12b2a478c3d1f02220366c6cb02578a2fee5cbc6160b96ad4b42db79cd0f133c603aedbf3c734af477cbadb418cc3df04b4a597736d7694913b215b335579d86bea57014a7ac1fbfe35f0421962491",
+    "a1ad0806",
+    "33da10e645ec41d7dc3d48fa1c61174270b83fe77c856ac39076b5ac6230577588fd49525b27dea8d2bca8522206e32db6bf2968bdb7df42302ba5eeaab89149514ed7a41dc82c8cf7aff23f6a63eace4bddf6646bb9562af87ef469324c8c6645f872dddaef41db3fa6d4b9d93774218e2330c51d7e24cc26815795a237a8ec",
+    "99b4b1d40c6a4e74ac92dd8f9f1965dfd50c9aae7121042c61763c0a621031750d92af7004847f6d224acf7bd6fa50c3bc29a6130c9ad13e9f045891c8a3dca8eaa1c8a4dc8fe1cae3e026ed62d2967093cd7b93bfaa4dd46a364ce9e955d3cf45f5f9787e7c76457b4245eb398e36efe9e5f435234f93ac3bfa564ac3204908",
+    "dd3b6407f7c20c9296cc26f788a436b8c8162cb20087091a35a272765f467b48fc499e946d8f413daa5098b4fc97e263c2ebe392838868840c513a4f522bdd665e10b01771dc7addc2b54ef2ba86e66b2cc376f02f9c584ef23ac397589f3a27ddecba8eb9a57105095f234c277d101badf2205a9c277f3de0262563e9b5ff60",
+    "ecdcb1c7ee6a331257361b1820b1286928c5142062c4315d7bc30d4002b7b5f8321089597f932b7d97ef25e514b9afce24d9fdc74cae7fe1fbd9fdb8270cb5f783192c05b800aaac734ecce48258e13fd2114b1275314e257177e838688dad229e38e61318311f52b97acf801dfdcbb4d1e7b51a93fb85f08983edd6ca72e6ff",
+    "7c2bb97b",
+    "ecbf2f5f773110ba69c2ffcc4963b4228c0ac0e49cae4582f279c504335caa6c77b7a4b1e6f479879589fa2eb617597a4e04c6f8f04e6f9709e2d8380fe293c708d1a8c7c9b30e5988673f22660fc3b94764e973709d7b1ddabcb3a70e85f838f9996b5d3268e0168209d5ec52dc57cd6968773080c61849f4a681057283435c",
+    "2466de254d9d496f914dc68c116b031992d73754f5e8efd8072b59b8358ce081b8d1c806469090f4c9a0fa0903e90b9b913ad81ae28e2b2bd95eb28d14bbfae8a00f8f3ed47dfc9825684032f419c674b5814b8efd93ce613c914d5f542860120a8259156a4e067f067c855f40b2bfa0fc2ce35712b57dfede67b8688ef8c912",
+    "1cb84e127af394b8bd6839d7c9fa8f5d5dc570c96cb6b3731178eb2f5cac671ed5483a58058eb77984c29f0b4d473ea1d80f1a56a8b1c9eedceffac77229c21babf9f6a7c2176ba5bcbac3e6474e2f2cb2635858e6082ec6ad6508888a5fd5adbff906ec9b8a14d28422b83c1f73fae2475acbc3bbfe15ef777944f0a432917a",
+    "55b99e6556523d17ec88e13ed6b95f80d04c51a08dad42037228dfdeff02f16ab661dda9c04faac24bc93035791657d2422ef49cf1f16654f84c7affbc2bc95ae7dab355c4c78b8a21c3ce547294ba570393b5c089b4179f7893a371dabe0aa05934d35ca13e8e099149416d2f0e02307dfd8f9fe407f8c8baf8347c6f7f7f55",
+    "21139a55",
+    "56712d06dd65393d3a5d37bd92d95a9cf25e89ac5c2bc8b3c3e04e4331e5e3019f1e7cb7ac5ad4d77ca25659c6656bfc812df883637e2b1e18cf5566b9987b5154a25b44bd6b8e131c592a2fe3f3fcf86a39da722e4eb48bc1ad24e32f034d3b15ac01c0204f5f8044b3a6006ecaa2764e03e2b3c92f785c636ec62148b32d59",
+    "5d4937bf785d7a6571f27706580e17a4f3202e42bb3da41cc01c4e824046fda3f8bf3fec49364365a9745c6fe78993b05f97ae8d8e5c3a95ac6d0cb25d94974983545eab841dabb7f1d1322cf9f62b2892ef7e33e5b47f947d6bf0ec15dafbb82693345de10c77c032bf15335a3d39a417dad5a40ccc480b9bd7bbc166f02db3",
+    "d38cdb753b17ed032de317d213b20f4dbbc59ce4736173a18719d058765f7326dff61d52453ef848a136bd5e946cfefb3e1631eba68c1e969475d80baf3c8bfc245b0124124c50eeabf082857aa318011802fb5a0e3521383662d5c9a20d2a39becdd4c2525730b62a81aead446c39381d994ea572264e57a11856ebef690e05",
+    "7e596ab430b6d474c19d5524a6172ce518bcf951c368061c61a7a053bce6a01da319091d04bbdf0471a3265b8c0b83b0baea127732ad895458ced687f08cb4362d25f28e41e6504e8036adcbee59350531b8d717e969967b51413ad6b4d04b117900a7729832fd12585e055d88e195f7976305d72f3c4f5c75419b73353acd01",
+    "43046d",
+    "607ed6e9e8f7ed7596708cce25149193b78975bb146069b429d6e64073668fcf0dfacf70de85d23193f0665f9314333614cce253fdfd19743a215398e4565b35c88a498783c54ab70ce95dacb1ae62c7117917090c701468d4ab4a2d8de8ccef2d4369f642b6ec403b24de379a884e9ff9c52a961421d00110f1fe9bfa8333f7",
+    "e2725761881ed39bb9e9857167e41a47dfb61ac6bb18a277af52727df756f3ddc7b664691ba9ebaaf0add19c441ec8da66362c5f105a235a9a0beb76f4aa09e417b09660d6c30b23aa985703794d962973e053c8d4f6d9ac63e574888395e664e99d84ca9b1e171c84a635e5fda53f074f773e32e4fbdf30329d68c1fc39fb63",
+    "25dc6dafd97fa65bb910ff4f72e0586dc6d76da3c747d17ff6a65e95e2c79afa2ba2b3af60c624a1fd9508ab197e75d1e6b74b230070123e95c604d54141e46bdd9b15ddd59a61a39ec1ec61f4241b610fcbcd826bad4ad792c3eacc653ce8d83dfe7dd6edebfba6f415663102945f23f5556a491f66c97e9dc2f45a1b145cb5",
+    "6d88f22651e3b778d0661eecf5683f4a861ed59d3574fdbaf5ab735dc21dd156c3798751296ae92d03b9f9816401b464dc63fa34abfb267b6b1f79f9b6402c68082d8ab778b0ce11507911146c998b9bacf37360298d4943bf6e9e9e944d74712c50f4832a8e17c16d31155eeddd06d98d1aed09904f35ad3f7fac8406f6e56d",
+    "74e4",
+    "66b7378249c1a9cecfd9ade804712e5cf3067532c4faf858468e705b5dacbe10d26214f47ddb63ac25c7bda7713b59e9c08f8917e247cbdd37de727805f6498af1da6ee52fa51b156b475f98a99404c5979418fcdd6fd9d245b3414d981ee92427065bb2db3163ac7e02109bea6fc82e3681d9fdb1d031b79d2df354618098cf",
+    "97dfcb152466afcbb6edf64a5225ad8e9d485a943f925864ded690bebb25f6154d0f4879aebd6ad556c3c8b2c5f807d594a4b301aede18b0aa598423fe3ea747b8b383329df1dcb8cbbc64dd62a852866e2e8edcc32e0e736a64015019522310db9ff2be78e26c8ce355b31bd48892bc444f10f19f081c81c48b771871cc2445",
+    "be0051a1d9b218c43761805a856f021f8a61578f84ee66072f891070a4d6ea50a874c22f40ba4ef946bf25cb964f9fb71b32c95c18271766c1036aa3b9ea701077ecd9987863ffb9a37cebb8af0a887943c6e6a5366a11587f233903155c46ba5d6642b6519480e86911689e33d6aa2dbabb8ec8ceba002dcd8a2df966e30738",
+    "0b853b57d13da43a081accc577c9fd17aefc212f22203773063c949b556e5380cf6f651ce5106e2cdb6f369823c414f6faaea3df55dd8c0c20c1ff6bed31c2ca16e2389b94a484499a766376dc8b50f3b24130a7c203e38f0a79f71ddd618c755945605a0ce76d54634175f5c28f5b842d5fec67f6cb015f3a6ff50353c7913b",
+    "2e2cb",
+    "bd58f5ad89c8c17253fdb47c1a59a5ab7cee94b3a1b57ed4757ac548f06e3d077364d0b06f237ad914696ee2ea896fef93901d621fb56e820324dd75b8642b85ae8b179fc3a561e039245b7b0f8d77b51e3bb486739079deef2a773974e78a83129b5ff0d2961c95d364749cf8c2b6ecac7eacbb6bb53364e15ac748f60af7c9",
+    "ec2100b0e64130e80dfef12b8ec594766d233a84e1f59b90cfa5549795013ae08872c695492a169d671596e0a5502b78c6bbd54eecbf91ca46ef688b6bc8aee954f384647fd439e987c4d95a7af8557d951c3b329a7685566e330663094de3d7df169c508731ca68a87d7a5e3a0a51717ceb88aff6f190479cb5f5f11b200677",
+    "608dd34f2be4d59f271a7927966e4a6d6680985d0d1d0f90b0ea99e2f21bcfb4e0496cf51bf390c30c08b23e16d6168dcdf3518ed975084ce5e608a77b02df21455179c1480edaca435eae1d847d1ce603611836f4d99cfc3143f46c0b784f505e719ffc5b2246e1a15d4cc6b486d4c899fdf151c10786c9fe7e0e8fa4e67dc9",
+    "3ced01b29dea7ba97b79763681a5b4127bd72cb87c09767a9bcca4e6502ae2bada841fb6ab11a9f24a548de9ee828e1118a5b8934063b85f25b90a3a3c84195a56cc88c4b60ac47727f060025c59c4bfcf81a27d1142552c5402a12fa67a79e2010a675d96907d9ca4993fd9a9a08b774f15035bedf7eb2475ee2e84c1a394bb",
+    "afbc",
+    "52f10633967b3cfecbef6c57926e9cd52de943f150f3f61e23d5b1b5e13fb6a55e6d9034f43473c61008dad0a3d83e90481e579b73b7be137ad670dbd17adeda871d2b6933ed8d11c07cd3ee945978728e2c1d44efbe763c895ea3d623cb37a1d510ba5b39338fc76060f6d8a8d2bef87b4088f5d1ca6fe5f7edcccdb83f45f8",
+    "a72828a7fdc7aea7b89bca67401bfa4d2378769ce66f29fea2391cec1aba9fe3a8d8db812b0cb209eb3689be96280729cce647a04f10a5e72b53b31ba5bd1f840d2476ff1b2ff87f58695f78d889b0efa6235c047408775d69cbedc4ba9568dc2068144b6fa97a95331832da7d014b0f66811359b63a6f87d260ddc9662605af",
+    "61e590ceed96a11e2c8988a8ed29645ba8f3debe718ba83c625619b051d845708d427df495d5a1c27f75a5f7abbf04e382752b00bafe3d6ea890c11b61a383fae8265f2735ebbd1c15a53a368607ea8d8ec24e0b6dedf0f77fcec0b8ef8d9f5cc28ff64f35419033fe174208d152d98daac9633ce2264214e0e4931fbf9af59e",
+    "1cc57bced64929bbdbc57c7b06066b86c6954001a471b92acfeca788a2dc6dd04673c5736ad9de859971042e8f0982d721bf47f7bd74ff79dcde128a6aa6540d4c10ce7ff6ec7ab395993ab5d29d2fbc41bcbcc2999ac5d19b6a6baf51942abfea45ed28153d0efb88e0a75bc1fe246e1845ab772743d0952b87683ef6710b2d",
+    "524",
+    "1b76ad21b4f681bf5ca2a6cf3bdbb629f11c2bc5076190a228dc9cd49c15485c0a49ac6f079d16c3f64edd6a788239319c6afe574fd37457333000e70621bc4e40fb4900371414b76833c48159e1787067049e23f0c63d55b833d46cc71a876a4eb344f0929fab5114b3de2d8278db9c442de38adbb165762aff354196c22ce0",
+    "ea5a4efb1729a35ea48845233a129f42c397d57f66436c0a1df47a46d89c2a63d08ee0679cbb29ee4b8c0d4a5c5f428a5f22372bf19594986bba4b1522d772da134b323d1ecebef185e2d5131d894f76d8e9ef4c727bb6f77f458df07423acdf8a51cef09428adcd067b211352de0c91fa8907d6466a4374bf83b3deb36f6290",
+    "188b9448bf5f90a4f0c498720be042363d4d0ed3d42fc7014e0da63e99138453c58a6d420610e02bc0ed1c5099e4a469d9ef0dd02cfb97c7004807aa8e0d85e741c721c17dd5b26bdbb0d3b8dd93c8be65b3ec3fbfc04a7f60c5f8b9e347d78a9a204c75f892c4204a41f374e38f51c5719187143031d87a57035cafe2b44fda",
+    "849a22d8e214667f4a6e2d0a188b2799b904545a3f0c5a1c34e8dff3ffc061b23374572c751185955194d3b7d598ce77688478b08fc14b0656df6f0e6323ff027b72c3dae3c7924a5a23804f784d8ac75262658ab194c98bd592ad1c932cae4955acefaf8a550a55ca3a296cd450bc129053210b38c3c815ae061250359dfd55",
+    "17",
+    "f28823663109f9e2397e555349e39c532aa26134c8aa8c9f02d10c6bf5a24f21068e50a3b110cd15e48a390e6c59f0613aad9b993c178ccc517023ece3c8d5b80070c08063543870d2e4ee6d6c2037b9b77223656af559aaa55f15ac2166b6113c7035767af420f38c269ab2510636859d4abab1fac5c11cb204154dcc515a77",
+    "dfc32951cad91411626392faa0d7ef3b11906591df5f0c16ffa5996d876a8a72234b2a2550fad8121c8b51569266e396f64e49f603fece7b711ae13caa35dadd4e5619be54d93bedc7c2d754064ba464e8bde38fdddac1b797dd961e9b5f4539e274b3d23ccbbcdb8444a5317f7323c4fb78b7f96e9946857e2b40628db2397d",
+    "84653362af27a19dd18ed97c42186a29f9deb75ba418b10e2f17ac25c3d56b6ea26b5e29a5e34df188bf96f312d52edcbc4d1b7348ca289e82756ffad0d1e2fca36305715f619684db127687ed092d64887f1be06fcd3da9bd0befc11cfc9de83c1f3eb19cc1eae151f5a454d6c8753412e76be71b3f663f96fcaed9cd929ae4",
+    "c2fd634e2e4b31044e03ef5e6b4014bfe8041ff75ab6dd409d64fc79db3953962508778fb2e92be1c117f82c0f82b8430104a10b68554fc9cf2ac9fc503a7e80a41eb67a0476f2a59f717cc8e011f545f9a575d8bc38596d893827148623390e39c0ec5b1d1467ea6df5b3847734a754f425c7169d1e1a2e4e32970bc6fe5b3d",
+    "b679680164dda8ebfeb0bc08ceca1988202b2fac83a0bf69e805dc7dcd29b207e3c90d84453e3fe143722ddbd6d36831f230436ac75daccbab39b1ce36d255ef79976359fcbab1d56a112cd3e4ca08790d278922ab20d76b74bc96e5c226f4ce11270d43f34f00ca58e3717aceebfcf4d7d01850aa5fa14c808c7f644c7af17f",
+    "a517cf18d9a478871996a4c7cbc0636d7a369efba92f2431f784222e84f3663d03006c984c46274567676e004ad0bea9933e162b40a48ec326d2a612b1d38d77a4d59b5da250e54a13e42a03c0fa5aa528088802cdcff96276247f82b8e49b25d57747e29c3766a019890f166c77ce45ccbc2ee48bfd1670a3b027fc044e7e7c",
+    "d2fce3ba2083af71e816fd98c0529d15d277a212f0acc618c1861c9937444bb04b9d9384887adce0dbc693b85a8d64f774683042ef3410cde797ccea5e23da36d4d89405ed279834b6aa28f58693e780569f406ac1a15531a0bb2192cf093f010eb344df6e178fda11e16a631f8a7202254b80cda06f0f62c79bc29727e3043c",
+    "d90885dd7196b8d29dba72023c1190697cfae701254cf631328e877df9407695bef5bb8438a868c064a6f6357b380769369dd548d39d73195cbb731c6417c9bb8962cf61f21a99c91de686cc653bb1cd7cb877f8d0ff873fc07e67c95c7b89e6419013f198b4a63fd008284176e6f518a964f1e6583bb91a8d91e4f1fd3b4251",
+    "29719bc9d9bbb2f65d919fbcecc6572831146854471e6de48b6e62c2898a8767639b6031d8921c5301dedc1ae3cb2ae660bed1b5820fe158daa3513fdfb4b0810683f49999c1ea919e3e8293c571f5c55b4c9cadb2db45b1fca744c67ef0e04b1989e9e605c87a5bcee6a45379be61f751d2ed6182cdc48469f6a9d6007e240d",
+    "77b98122b4c059bba22600b98a81bf49080681ba75f75919ea8a17faf24408fa9eb53f79b027eeb4d322ab4a70f0418ec4b704bb4271a82253ff2f4ffc240b5e7dc5f34f13e0f75279fa483781da6b4fd61ccf3625571b3061d80b1a0796c97a1e7fd9c83f7015fe7ffc86884ea27570e420a47310c93b2fa263149fac3ea002",
+    "08a920bf85ea7aac0b30b2cb81412fa0b6590a6386946de151f512e0c228186b05b6585254a843c11dbd6a676b9e1b63b95f9ce574f19eed317c4bfa22ec320a36655342ecd07e61c6a1eeae49d2291b4e0a8cb7abe3b48404fbb2d2b3043fb0ff4be61df3182ace134b214575c7028c1bc5c7d90d95c39e0663f03d19f22a23",
+    "5a6ee735572b83cb9ddc84ada3ef3529931eb543ecbe48ab516680692c5c7bc91aaa5421516e237f8a882e769fc4d7ad970365dc604497eb8a0827c617cc222c5692fa1454b967abe439b9e7c169146250042dc1a8b082d864beb741ff3e1ba462b179890f451ce60da5f2ad89eacb2630ea6fe6ec84542103a33561bd037081",
+    "2660ec7fbcf7e9bc39fe05bd32636684980baa704a3c084018a430ccbd5b35cb7bb082939435749df9dfe4cb05f4c219d6d168e5189852390288809b2e78e2fd45feeac20d924372ec242ccf5b9896c7e215980908d482a5d9606852947586f49457ef7988795ffbfe0aa884977e1c56deb6f0bbb857cc5e36aa6688b4f98646",
+    "78fbb3686634d01b4a8f21a393289b32c5a250c8738d4cfdfab3336eb04f99d0153cd441267e661f1f226c7b7e079f70171ca1d59209514b7b5d45922ae61fdfb271c8cb7a491d63b40505166b65257b9b5a719e521f6d6eaad50e7fe87af61594fd1974be9b2945b8fbebc0a2aa18d73b586ad54c1ce75927f552d0c6c2757f",
+    "aaec5bc0edc0dd8c925dcce09eb88b8deb6e917d44cf07407bf1b32724c289704bda1b426f874229ba4fb1d659aa02fb3c9880cb13c366267280f2bb2536b7f0ca0212134c72acf5a59b1e9674c04176445e3f0c6373d30c5f451cf411c561ccfaec89f29a665bb3e37dab59ab048e15d48365ae1e0d9ebff55f5f6caa904458",
+    "c88ffb04e00d5b0bee6cfc1470f6d17fb588b24e537fd506587eb1b568d0e637f9156f83f0aa03fac086093c2dbf91b67864a72a6735f7f63666f33ca4ee28bf1cb2849c4170e93f103fa04f77a82a300b39fd7e0850c8c7b72057e86636e8d0ddc4a57a49d3cde3c4cd9560d38f89d99c9664eac7dc0f47d902afc23ccb1f37",
+    "f155ae393ab80504f4496de7ea0cb1087ba69b5d58dafab07cc0550b07e082b9be01e8060b6dd799332eda9a942e7554e59aa0dbdfbef02f8329cc91e18cea66900aa6d60ab4383975987d8b7a0daaf03399ca34f12199ef095eab7c811c3e0452ac24dad0812a387dda0911d90fba0ccd8f3dbbc4118115213ced49cf9bf",
+    "99e01ec1b118fa9e5ce4cde6f823ac4a1f8defec5756e81ff06f34fb3a8c164ea12e81fc1920dff15f1826ba890bb84aad1bb1688ca8624b69e7b076f465a8ddffd045b26bdf42b592494e3e43c38b91fabc82579fe3b87aa85da919a86aa7ea837ba98a9c2f2ee88e7154f775447798c738da528dd230a56d8892aace06fbef",
+    "26c26d0f1aff6379310dffeda26f9a21ea2bab8c0810f9961c62c0641da7c5cd7adc69b21f61f22634220c7d9e6ed29af0b0786ff3bc180ea9fa70a4e04effe2d4464d8ad735386bb987864457d17cdfae0d0faba6332486ada8cd086df720d721e88734b40aac8e8b9a8243ef7aa1bb6da1cce500761404a2f1712b487574ba",
+    "65b302ce07cc2255a9297ee751a30da21ee301a9f0c35bf6508a9face81397e20a9567370b014ac185c90b7b13f43978ae2a62a8ac9bdf3f80a6f5c5552e8c3276392a0a81bd65ca959a63082fa521a77c1a8b1323dec99095a4d4219e1af0afc6fd4b06c79a74f4c41d48633ba330f5bedda7117afbdf9552d72586bfa79851",
+    "3daa283bb8225418f125248810f45fae71ca5a252e342fe10af13f29bf69c3db77f04497ccdf03a2006f447634097748f5d112fb425aa7afa62ee17a88abce4b884d8cbf98a03f3e7e82232e8211dc83c8f6e0bcc5f4c2eab9b8da9a57c6d52c57a5be4f19e628aff68c909950ff796e00fa1359a5bda6002706796bbfe5de",
+    "00548a5fd9ab13b891988b4c41580234991a0e003ac5fe9fdc393751537b2313e5771e8c959189ff70fb582ab9d3ca1322e34da47122a0d21ac7351d4d69404e099520547b8e96050fc5239305dfe0a8d3ca68ec415c861156cb3ffaaf39d72ca15a357976d06caa057b7f5e314f987d8b092375a0f0dff86bd1a33b0831d1b1",
+    "3d7959f6272fd9ba8f782e15c0f873d5d9c483a4defc1f36d2467e93bde878a73a5d5588bb5c5faa8886f9a0658226eb44363f995b48c4aeb91e4742ebdb4938bccd4ad029bd18d81d3e1bebfd5582de9efe27b2679a0747663df09d60f984e44a0845d5c99170a0323f93e90dd7f3d03d80e767a09af8beab802eb3cf3e9da4",
+    "dbb5850f60e7db9c9caef29c3eb1f8a54b12aef1ffb6012ce6f447438043098973e79fa42f7e4f5e5971b68617db92b93f19336edef46424381e9d8309b0638b48b7ee08f0dd1c9b796b8054ddecd76288f08537634699694c91e1842b11d5818fb9a6987b1d8b63dccbb7b7b318b53f8f335241d10138b8d65c4832a9f88fdf",
+    "38dcd5df07a5aeb11a3e8e44d0b9d73419691a9f6b43193af774f9cb8e3386344db04b7df651b807d6c19a97733e2c21962af5679c763e9107401a3ef7c944bf09f2d0b30cac2a6ea96ba50a45deb686459e01fcb57b1a1e989ee66b38f48a0bb44cbc9356a2510c30440bbcca83136f71f7f64a967d8799d7293a228290b",
+    "98abb32205220f6ee5b17c25886e766252e3f16d106594bf2382ee3298cb2f1a01bfb03c8740adc9ea2f01f443ac4a453cdb841e6d0d76c926f1aba6c4526e2b0bfd4a7b900ce55e039e0b6a2e5570d6606549262406ee9abe85a924df7fc29a5a0cb71d9525ebfb54699541213312bb1c4becf205b03af37948b34c3dc7312e",
+    "8e5d18afd7161203e8bb466e67ceb7599af40823caf0aeaaa3302f1a09437b94eb32c315f8dacb1cff95309aa39db1fe04beb93f7e383df88ab2c474fd7ff493a26e20929cc0269bf54042f2c9d173b94723571ae6bea2c46645a772a9b17fc7b860324947f02f8d2287cc5e1101458451e6810462d062fc288088850a99f242",
+    "214ff1a3804bad6d5d0d66477fbe629a8e330db8f3685688cb6df9512a2d20d60b88a196a65d9619bfe4a81eab2483d0542c934c1a31068aa9838cefc746ac7792ace0b8816ff2088ac9e54ee60e17a88b30bd69ae50481239494f84779658dee53d71e758468bedc7725bc9ca8ceb36820939ddc878f600a2e96a947b6abebb",
+    "da532bf0265afbd612cbf01539d158db7bd85d80db061a3a9ea1dd8ff482f33a915771f89be370405e798c7bf25770d5c51e4b9e8bd6f7de9d66a7362fdf6144029e1a567739173ac65a83279d5f9d1f55aebe939a6e4405b16b59167c9d429d29875053f0f3bb4b2b40e53ec4941d2ce43f8385fb2c2202ad701555993",
+    "bd03a8842c4e79884f10945741d97b112f4b9e8972046b339755e3b3fd53da78438c3652f90813a7793ebbe1e435915fc88e692308a593c2e1eba72c102c18d22327ae68177064c60b61abf3c761c1722075d886b63100d4c73595e0860e574184a4ef581db1899d54908bb60cc7ca28d41752ae0754236b725953100712f0e4",
+    "599c884b694938275e1b44f9273760ec6c005faef4ec38ce6790f2165603863d7de6fb046fb53f36097959d6df2dd842d981ec16aea723e7ecb2cd3441175218546a6d20262eccce5d5a645d9126d64662bd21b47f91dde9f1fc42c67d626560b4dc55a162266b73c960cb37a3216f8fe1051c39f8c3c986d999953e1109316b",
+    "2e4d4e3158284d2bb2ffa8906a162bdd2121c9ba5464d734467590d3617ccfb6d60fe48f623ad02cab0dddc4874c4571c6a462d9bd63636e8c65da32d92c4aa109a926b0184a3d5f189ed906435d219b19c0ac0c41512ab68529b929eae3e7db24f72ade547a7bb2ffe019cc1602442e8e9556f313d3f4c6eed84140713536db",
+    "60d2543bd0dab15ca77309c941a7e85efed1436ce1321414672d4fadfb6b0792d5bb3da8066b0450f579e1388526d74495a5345ade6cb53fff2fc4ff6905297725a0bf60948e50d9b0a64c42b619fac2990dde807bbc955edce8419279fa98509d18a568dee6f02dbbee90fe0f907f3ee9c4ef2f17a1196809523312c5",
+    "0fbe31e20d694e4cb82fa24dc810ebff2a2a05993c1a2c40c618144e3da78a55ab9e05177228861b10e31d1a11ddf3a713dfbdd3eb11f8d80b991b4df88124b6797f4c9ff2a8320bc27b8e9259e66920930c9a9df6313c9ee25aad30be92217990fa8581c60e52c9480de23d22c2fb1f51343557776ee263c4db6383bf06617f",
+    "2cb563ee8c058e703b320a508d882915d7b98ea34262426878570b4d620e8ab6fa5e7709f77c6c0740525b8e37ed27eac78d9fb98ecbbd26e9cbdc3f29715ef8f70601b7bdb4ddce16c49f694bac7b866e8fcb70088e362499f8dceca2748f61a3bcebe647e58117e2cd1de4f028e7d78e658280956c15fb104b847450ffd03b",
+    "e4ee44bd0d8f4088762df6439183270068f415d082e4677061769e4bdc96c0aa622a692d7671743a5fa4f3aca4c0b07fb0a4ee471934f6bf95a760f607a4b16cef4ee666891ace23bdb3332775c07dfd1c5e376b859f1cbfc88e38a28acc328386c088be7030a679703ee29562f9b0b0427a2454e7fadc688823910a491072bb",
+    "e4705674585d1cacf84cf908dcda61fbf87c480e3787e4d1e5a1555269e744d16ef0824c5302ed27882ded2b74acf836de017f9372a9ec3b4674a4ee674094f0135a6266a0c25b1bfbcaaac4a5cad3305f076cef022e62c11c73c4239a146fdd19a9fe8cab67eeb64a066680732f031a969539f4d094b2f2b7dc826e2",
+    "97018746589338e98375d014931b4b61844d7758ab7e8f5290f1e6a28826dd5df5bcae0e6adef088de7858ba5adace82236f2c9345731f43685db3e5a26e38dd9da99453e09fa01e69f50666b52e5397f78b496c7ca31acfd1ca7bf2c7a466b08401a089d2810a90e1162f3fca18bcda08c612303b4268381a1fc7ad04a051ae",
+    "7bdbe632ded035fb65cf0623a437dacdc09f55f5970f16094f407d63e786ba850b11b9d973c04417b0f6d1116d6ff7e88dc59e9a0e4dac511fefaa921ff1152e91e0b095e0d3acda457c8079945c480c63c4ea5e71e9747eff02254d76c51700ce1549657daf2c8f49621468030259a3dab76f54375683f0801785a6b33725a0",
+    "dbff58c0a02708522d3faa40e9a464fc3eaa4e7e5530ffb1d26011827594946f3797a18162ee36284356cf3d7b5e998bda16ccfc82ea61a9705e126d87eb0c802229562d1e18f61e24a8405ba6c3da0358b58745a8ffd19429267869db7b3d755975dbc4f5d24e912e888a43f476cf66fd48773620b061a0bdbc23ae5f192ce9",
+    "72c80e912f638365d4b74a9d970c4777b81ce12424a2979038f086534bd9e36952df22c179b0c25427cd1813fbbb5328b83999d3183fff7e826982e9a302c400f047b2fc1ed76cbcf3bbb6770a8ce705388abf17504389d3e37270d942198f53a84375bdfb7a98327922ff03fcd7c97b52472573b8990e23f6f2c3c25",
+    "ed2e0b6be278e60122fc58b0cb52ba20414e9b12449526c0e714850aa758d8ab7c34c89b000f84a553679bc8b5da78c32316bd84a8a72d629f50753509c6d26f68f7b26fde6fcd7b209cd5e13f0770c30da9bc68535f87d4d45d076d5503e0cf8453844dfdebce10064fac258843e02448d6559516be1051df25035d98dc07e7",
+    "b65683731943c8836a39f74ec0878017a0fce18088eca105b98c8bbc28bbf11d3cebf4c131d22b09c4f1e3217f69b45d87ff5826048606ce3bc48cc28aee7ee8fe19889dd3cdcb6a0f4149e30f2a43dd609a369f79a7c7b0d5e3b14c0bbd82d10bfe69f2bcbfd6c5cfb0d61be0ab10f1a2677df25b38b9b6ff12a82d81cd4a13",
+    "0e1efcece4fcca3c328510f2d0f74cb71ddb88c828f7caa9f156fdc823ebbac6a9054bbe3da4dab981d6c9b50a67098c635404e64d3d1b67a2d5b3da64c0cb1eea58b848388d34fad55a2e059b375cb047be6e9efbe161f9a98fea08f4afc45777dc6e6dbfc911a4f209ec9ae5210d7da976f3bff060d0541ee0924eb0504d67",
+    "75c62099538b691dc06b232ad201077a92bbdbc0ddc2e31327bc6e33188bedf579540cc94790c959dae53aa4470f0409933aa4fbc6df08908d0b2884348e116ac1d642304c9c05ee3bde6882ab412fc8e99b7ff0f83e405fc687629f720ead978ac90a4f0b91a5262e6c4d51d55a35af3249612964cbd0b023be6f9c",
+    "0780423e0869fc5270d6d4f45d2bd085a7f35caf46c6dd834ffced96f396d0cf2a19c153b9537d1b66053c4f51a0fd7c443f7d84cdc905f00b1cb3e7dd1d89f0d400c70c5788510eda2558aad3343353adf36670e705a043ec1d9ce6b45c7f7de0f3949ebcf8fc70374e8219a5e7b9adeaa40b9fd4a418511f8c9f65b9fbdf3d",
+    "c299898e4017d99ab88012ea8e16c1c20b2af949a9a3962eb862b956d4553b1a7cbfbe06deaa27a0d9e91fd1ddc1b6b0f08c5e7cf312360b1de57458826551f6bb51a0cdeb386d7cfdedae2cfca3c4b24ed061ee58040d663ff190e7feb19d0793131fed54ac41840c41c83a83cd052a69265b34e1be8ed26af78a188861729e",
+    "f5c06446fe0d5f694640ad04b4f4b3da08d5aa094f183744b3421e81bf0aac47173c8826fbb5cd34c49f44f2b180b693a7c693358265954f2644740931824c2c707af32fd7cbb6781adfb1e7c00be860bb5f7b3335d7596b00859a8431fda724cff05b71af655c27f51cd05f17d0f43cb29676d5a3998461340f14d6bba0d4b5",
+    "5f91ee166066850810d5f2c91fffdf257854a6289ae15d8e9636dffadd9709d1354828165deefe4f888301dddbbed31e02b1420b65a82ab0132a2982e6b49aeb119e9119ec83881c0dcfa00542ee2ce8d0a2ad1f4ae6c7c7285badab6f13f0e9ec2356a86c8e1b893093d25f4d5582d612f2fca5521aa9e6408e493",
+    "4ba90d6712574a56352013f79bce70f9064f3a343a3742883ad0822f4e897a2461f1565ef1a537e8fc668c765488592dcf0f4193024d3ffef4322048ec0a6075c357242c29491aec0938367c5aca8473ada755cddb65838ec0540a18c705626157e0b2ca3a6115a80ba466d4c9d989a22851ccdce8932942020ab12fbb1a95a4",
+    "9657a7b127ec6e6af621d1a24ab637348983cfece2b83b353d524522821ad2c281db1f527a3dcdc906caae3b0595979c60b57dcf89cfbc489f005c1735584818ede901592cc23b3598bbc05aa67a30e5b8889fc049e65bbf2bb839a944bf3960f7696ecfdf1bed93b5b648be86ea665b6c6c825707445d25e0f6cb8f7ea7342d",
+    "7a850a5b2e800237cffed8465d0465b699097f2dd632bc3c6a13469a8075f81c9e8c4243bd809b722d86dd1609d68467bbdced631c3027bfae2d2ff612b6997ea7b56f9b90645ebb1c0084992b3aae745b5f6a0ca6d0c3b21787320b922af857f9ca2261bc8aca5ce35f7f8a06ef2521e460731cc64a72c3718d20b82cd56ac1",
+    "229b506d1526bfb2cd6af48ca06050a7b7bd839a74e34d89518270c6368a4eb0f8565195849e763e4b9b0c82ac4c9dc9b8adfb75e2be1e9b8c6c047c93c838fe06f367ebb97a6e68fc2b75e2a23abbca416fdc90afc564477e0b45bcff9296f052b828af1c760f0c796c5bd71aa42272e3ca2c8f4504c01104aa47",
+    "4843ea2e9054c933cab5fe3f01459fcaea575460db226975066e4cc983a5700d9d9cb41c5825352f1b6a3970db2e408f5457b8df5b710ff220c49c59be6f9f93978aa2345a394587ff89c24d59d35275b0a16a49c5df04c1c65b38c326d26cc2d6808010f714e6506e9c5f42bf04b26db0682a3fa1a386512bb922748a50bc1d",
+    "3f4df23d31ad7f9bb227fb14b0db5d44c0954c29926a8ab266bb6bed031efa26fc045f31189a603a7a12ae8e2dfca830305014d8dc20aa16153cd58547df07b0a19dbd141b46479ce6af0a178455918fea8ef4f2855c5aca9f1c3efe60cd283befabed09b25350c04cb5f8f3be5bc461d2ce690b9d3155f9520957774891123e",
+    "3a4e3bd611f0586f3667382c50a1c4633131c2d03e3199e5a6ae2a63ad58c636273d57eff31d166f217ef064a61327d83bd3f1a2610d7a3368984c4d54e02852f191e4a8cee423b0fb09b4ababa4f92c590b75cebea47ea8fe195d3c582d128c1b299af9165e8b4864c24bc1212b63cd670b21bb37a43ed66d69ce3a3285acf7",
+    "1555077c27ac40cc7c8914af9e394b14d39b7310e9c38e5b4a3bcc323bcdc39e0d8869b29408cd39d49109cf40575e8bee2c56089fb7bd9b30457b0f542bff0949b0bdff97ca8439287499c94dd70b42e5c4c2cccf6023c9ff470c59f664cab61b61e8fcf3b98ad62e875526cddbbe55580688c4ac445fcb036c4",
+    "94ca283bb9f7b4374875686b67971199826f621b192d0cdbf58f41ec06d605e49221c8489d41534ccfd78f76d8fdd741888bc5f6dcbddbdcb3490ee47500f60d4b7fbec20cda1a80ede5715dbd6e293d20f45062a6ac98ed659a262ef0313ce79be2680fe24d534f75337c9334ce459ed7723a007e767222271acf8a59ba3a34",
+    "f84a89b3d521c1da930f0fbcec270a535637c3777ffb93165f310ce7129599d19cacbaa3e5539275c8e4607096f17d90e75bdd1eafa8a4bf12045cb9f349651f3a294ae0c68cd541977b08211ef1c429f138ec60d5ccec39e3a4edfe9a6f54d0fbddfc0314dd426d834afecbbf1512a833fbb56bf320af2f3c2357fb2d181b9b",
+    "c7afc290402d6d10e1d8665b320e2411aa42d57760c1af090a771dcd336f7bf9cd714e8293e542d274a1e452a894b0437a58d8e6e2d6a6743837e7bbd58bb838b208ab721dcda96a87cbc6b0445e9e28cfcf5155f156fe8a11155a7a34f44e831b67dbac98ea0cc4a31a3296d7848d6d4d816b392d59c8080e32d1654330cd1f",
+    "c010ce4a8faffb60b418dd16fa4d7ed371a618b9ed5c8b43b7e2fc91a0f49051b14ce5575b0dfe810690d264554ff29e73e51576266d2a2222ca586ad76f9feb3c6585660828f2c96a49aebe69ea7467e8ae176841b461506e8f75eaaee57ff472458ccf22b543f25fa34eba7c2e9c88ea3e93dc7744c7fbf67d",
+    "c56961b6933eb6da7d556dd73dd12594a260a9cf354f1ba7de7aad2f119679eb676037de72925a72189557e8988b80a5b242404cd677af3794255aa4383df16389b4d35b66274b50af36f5d5a370907e9d7bb08bd9bd016b818953fb3ad8e6c22248795c5133256df53caa948ffb4070c77cc2789d6a7f59e538791d58f09ba3",
+    "b67da90a42694a4fae2a3cbfae47e42f898a4a31792557a5955acaec42af230245ca08680c162a8b9a4e56e98e5341395bf117be0e30089fa296ee66842199134ac3532988542fa62ab835d1dcffe5056b9d399020dd6773b5607e3c98bf4661480840c8675f47416b2280462b8eef717787acfff3662552e10353b8beb0b5f9",
+    "0198586f6fa9535907e0f2e83a89069de9cc013fd23840d0ea9943cc2fe1b28c35951cfb256bc1c4c0315a6b3814bf8284ba6dbe818015daf08d8185e744d625d2b9cab55f91d7d5b9a5b55106d8ffbce9777545f1859eb2fde6da0acc5a70d163c585cd7befcf47e1e772a047d205fe7ae93b58e53c8e06118a38bc9489aa27",
+    "d96dc540482d2e98c815cca896f7b431bcc6c1ac7781ea84788e418646b667974285b74a010d685d6328e8bd7682bb5429243f5ce7d8648ce18dcf8791acfe48b4f2d8cfc22e28b1bb4797d62a558477c9ef532497edb2c403d0d0d9b38c35c1e04ee07ee76f79bb5a50ff0dea202155eeb79f0b2ecdc6e4f6",
+    "8042be6ff706f1de65a82882fdece3f5565ee45cbbd14d469f6aedd79fadeed1c832e6db7f52f080f1c8b06f312529943b0688c660f792680b0c0d9ee8b0f039c1ea25e2dd2ec2f0c99fb85439cf9fec2d524f6ed0b25812cb199764e440bc6df1ff4ba0170b2fa3dd9d9a641d374877030f2d7a2a9a6e90ae2414258eef1cc9",
+    "04269908647914f88b39c50c2ba223cc6e8b8b375fee3c5c8fac0cc233ff6963440b9b295b5c3a2ebfacda0a376f262b28904f1187585ffd29d22a6f76ebf359bad400c495f840260daed86518a8a50b3fac5d813ee7c93805f10e926add002cfc0cac6cfb75ca3bbe2cb8be4d08d457c30c5ec4fefdf06158c8a0636fad7ab2",
+    "e240c26be426e8e0c23c5fad1b67acf605217ae7742d52c7f84e602024447422fa2903c44dace571a6d328d2896a5502ee5e1a99d44d1286d2f2497d24aaa80d12eda86433956b1ec81fd9ba6493c8bc3eb263cbcb65c1853b94f6236b2f9ca4c6b8e315122a6880c8c293763c12774dd0504f87aa36b2804f3d0e67ab9f50cf",
+    "2b8ca119d09fa02c5f6c84dd8e4d19c44b1303620b7a7063633572d081f540b96ddfed765e4d6edbff8005825d334ff68586471e10331a270254848afcf252fdb483e8f313bda5e88eedc5bac80870d47a8da5f0b3e166607393a740ad509bf720c723fc2af37ede86c7f45af5bf5de9e6a7a0649b1765050a",
+    "615167fec97318e690dfee7ce0c79554e30d704b336e99410bd9d7fd523f356a2e2d3bf4f2b4367d56ed675281dc3e5f20218b269260b391d53ec4270174a21f0e561d1c29d79962f6ae711a30f0ef6d10369edb18774340055a6f3249bf9f966a198a2e83830c0025dea4c71900da940fba15ec819c0a8268c38078b629fbeb",
+    "5ef2a614939168aebd36d1c13617fad160034947347794951004cc041040006c6e4260d1fd0c63381f4079feb85ebfe04fb901007531d155f5935942f9e81f3e89d3ca9cd0cd90e08b58e6b29cc7249103f3e7554747b3f62230996a59398d109edf3b39ed48b49dc0e67141229ff2f3fdd44fd2186fe3d9f96a849aa27ba452",
+    "38c8ec923295430230a5ea343cca903ba428b7aa83fd82de4b740294c873cc64e5d1b04c60c3bc3acc2561353eb8c0e8400fe650f3c19eae3ff2f5d14698fde6eeac8e93a4db8e8b0cee4e46d7976fbcd2525ee42d1acf988015c36855a42a87f07fff07e7a81c8fdc46a12934afb2efc93c90eeaaa5d914054cb1268ef42de3",
+    "b8aa950420921a9e5ef0a593341bc1258ae6aaffb55fa7771761ea505cceb92b4bda528f19170952730560cc6f18606ab040144a2d7263c3198d6cc5c415de32877aca0de7238ce2599acf062ad8c7c9167c07761736a34b6cb6f25622b45632b8c6cc7b0866514f19bfaa9aa89a59371f121d20d7c66c150",
+    "1da00e38d65ac02a7c60b652be2cbf67836c8c5f648cab8d3ba0eac690e04b2009d08dcb870766cf7d30fb318ad1c64f6bd319fdb76233b1e81c942847dbb8a84667dd396d5f0f87fcc6044563bb61004de73fdb0862a95d1b48aa15c33d27741e945f1ad95b90b2b98d2ff149816da8c1a54ac48d72a89f6854e77c16ffa27b",
+    "0c0b7d3422739b882044fea7f3635e8d7443783e216dfd978fd3370869828d610a5973e41c7ccf7ba4aae7f33a7ef35b2ad4cf7cce078efcaffa6af155b5014cedd2e4f748e7e82823355ae2fa3b1bdafb25e64e3d465a11379eed1f2cea1fa333b9a36a98ed7a4d61a0b75781912d1f3414520c311fa6fb6364aecb22a6bf39",
+    "ba1189333006ba1e005cc5808ce75570250ac364386788c13deda938fbdadd7065da15007946448d5c10c394ad0c4b24f628af2f97cefaee9875f428f32c16f5f159ab096f61e5d3294efbb8424ab30999815445b894b998d65f093c69bf2718408610a187c1a1ede08550ea37b58c1f59a6888a46f5f7eb657cf9b6420aaa65",
+    "1d80974c7bc69acb4566d796bb75c45cb3d80c0985a774e9d82d2f0c88f4318ec6d3b9e2dd93c89824939789ceea41b07c2fbf511c0167a3801f404712d38985f547ff154b1cb1376b340f84ef7f679eab907ea52cdf5cd152272d4d11f83a907b0fbc328f21de0d6d3933e771ba46d901302fcb7bdcff97d",
+    "12e2995231bf9fcab90649c669461e9c15f486f00757dea1519b5421e78758b0401ce2a54f23868906ede38c91b5fd99e194ff7a4464a14a73a71f47ab6039c78f59a3ab0446258a80b4a8ae3e014b08d0544c845eda52fe71304a4ce63ba3a2a0f6aa8b3f88c733600089cb7a5348acd3f242dba94f208c23b86936b319b5ce",
+    "db55a94823a09e87efa8517014fa48520cdd3f559cfd3bb3ea88b3768772d3361cb1a09b8023a52cc282b8632ff49f7376672749359a75e9ab39126657b50e9b5db6408e850848c67104d30b0710f89efc0e9279d0972831936fa1ef8236cee558a0d0e66b84fe746fde4f8892d7df5e51df0005541236302151a17925acd557",
+    "008fc37a4f2d430cd5af766c5c77610aff60e1ebbf3f791e9a112d4180a62f0220b464b08964695eea060e61bf7ec2871a665b294fe67e5ec019aea5afb91640713965c639c25558edba85c51cb7907189fcc064eb51ff1ae2c6f8d4a617462a67f757b6a166721d80e7bdea4495ae42a500dc909d2a0cef941ddce44e7f3283",
+    "14e9f57074fce0220d082f28b64d5f9754cbc01244dee698ceb37c773bb1a0b06dd26c37bf8c2b9cc9fac6866c61a7110578a73fbc020cee8076b5519d789c704308c6b1c6e1f28be44a0324b517dfffb12aaa96dd07d6bcd3d4e42e1f24ebb65608ce555a920dde7b349789371972e92db7058cc01754fc",
+    "4ae574553da3010c7114fcc1ac6b0f27abcc68dbb9b146ea2f77ec4d09152eed3f9b99ffc1651c938f8a004bd335e4a7c5eecf45f0111278ce43faddd4a97ebc21590a073e8e87a96cdeae9ea5f500ea8b07f79f73b72531598a56f7a7f9d68f9d41abd80a0cfc1aacc73f393f97c24c1bf1ba8e48b6a408e16e35415edefa48",
+    "5097f53fab5c2c9ca52eb46e622db64fd0ceb1b88f9b3f1f6eb9206607bb9eb8fe4b42200006e9ea5e8629d59f30e8aad5ec2fda05bf1177031a558e558ef8a434a369f21c54a71f689fa07474d322c4ff712891d418a8d641e35e1ffd93e95d9420c9d2ed7f795641b81152221537a1d72772667216ec5da161b5e504789134",
+    "d370f9ce788dd8651611115bc5d521d5f2de16abdeef878bd0a389be36dff37113be89bddd0982bb3286888d6b6968ae16834a24bcf2066cd7cf1a5f1e9ff55f196912dfb8a8d9a4122c6f6d36a2dd96c117c0cbc14587af341c1b9bf7fddcc256818eea3f3c3a14af3f9490c184256efd91b9db80a8d44ad4988911cacd143d",
+    "1de20b0d16721edeaefc1b254b1753847128f40627845b2403d0cd49402d7e2501024a2bde15d2eb29d6d82d47e2f3aea3df024db5c1352b0b13530c48f3c3dd27e0633c77de3b17aec381e6be1c0bee81bfe5a94042cd99454a181b476be0258c1083ee517f59e1f63ec91a9da3979752d26b93312b5e",
+    "3d2c7b76061adc21fff7dd0dd1efc7928c78e41b2dc36d055910648a322e918999199eaece616344b1cff83bb734671dd72469006d6b86170b9053461008ade2a8a4a80aaba8c70bdc54db086181b9cbc6b7bb995b3b0c3eaa6f19b2a99ee2153ef30ff6c6c4a2613e9052368c77a47b5e48588fa7d5567df9701ef78979277c",
+    "1f4049f3129b1a02ca5e7fa2132823bb5da46ecced7e9a6bc96fe856a12e4d6fa7a7ad2a0d3371c3571d8aa2ed847fc2268baafb8df62176031d29e7fedc0399e0f99ad069066063e858cb9d9c85adb7023681782e94c9998df4d6eb6c34c0caf4b773f415f58ee7cfadcf59fe0083f8d022f9744d70ff0d6e7506ad10ecc0cc",
+    "7bac52b892f774301bb9197281cf9217a499b4c9bb9e9a877f416e5ea933ce63afe90267940cc29e3cee165fddef7f51592e14740d84477638a0b043f6b6f7f19c587531f30a6ba84724af2500209df288c72cb77db409e9cdfe52de25209b83063fc5066eba072850d32f95d6151a070b1a589ba4e6bf6fc58086fcf03605fd",
+    "45cded2f6406f26e3789fa9d795d118d8c3e1e18ccfc5fcc5ab8fd95832f51a433f9b912c8f5e7aa6b919736784f547eba91b5bbdcf4808658bffaa41641a44338e56b6b03f42571061203ee28a3489efa33806ba02ef8ce8c8405055b352fb868b4b0ebd457e08ed2243295e087824ccab9c3109128",
+    "c1b0d9e329b4e0a7f2e53fc350f0c8facfb645f0392dae829fe2b1a30c1cf1144e333c7cbedd1a66d9bdf4d3ed9cae38f33051641a3a2957c174fe1d94823d59616aafe2b3214b98447070214b542566b4c25bb5e6db9477947a93d860bcd7902d9c4976fe8d6ab0be20304c09bea84e26a266e7af6c82c5a2653f18c4afd660",
+    "a9ae50818aeebb5ae2b1df82eef31148d3ed287f9e85719919d50026f02b6a135ddf8eb7563827938827bd77bf639a34c69edb7b299c8922d687a1d38a96c3ada8ae81d6dc612d1b8111656e8f33c4bd14fee7fc292188565fdb5cff144c16559366363177de1bee37f59db37454fa1a48a718a3cb2066ba2fa1fc9b857974d6",
+    "2e5d6157a31b9a50964f86cd2855887558fcebc785f24af58fa940e71915ba492e42638ac50712ea509243c1bfb5b2edd95bc83e9b655c78bb715502c06a6ea68d9fcf88caeea474541a746348dd065d7c5e5db7b54c0c629b0208c6d63666d1f4a38220b19d8ecb324d2e711e06cacb63ac6373f51abc9b4840812e4f22960b",
+    "364d06ccd420654253bc8837ac8fdbf54c5749355b434e58706d1405e4af5249b7482c29fcf25c16b911bdae4698c232ef215c38368ba5136217ef70cc349f3af9ff88946f9c4d4cf52ab7d967a2d0511ee10cda4ddd8e361a7d051eb673c3e9b12e05a383f8cfcfe691406a2a4ae141230376d9a0aa",
+    "0ca7bf6629d1f7b9cffb5012ecec5a15c790839212106a7d604e879e46543f32b49476073f9f5e230ebd9a21dc45df70499b7599658ca0183bbce52309c60dff1c7d4f7f66539b47d16f6bc559a5f20d8eb504cd98ffcced2ee94b682c9dda5121e53cb834601e9401b25478048a94486a41752f96a855c779b269ad87dc6281",
+    "23bc311e02af1be8b2a51a30c59158655c2d8b08a7dc5f694404a5751a8ec77feb54c4ecdf9a5ee2331b9505a10ed2c358240e8864dfcf9e324ac90bb6754a36f8797178b1e5098aa440668c955a76863888fac1d013a06a92c0622eecb908d2b28be5e3e26f7cf1103aa38cda4f46b05c4d76b20fd380a212bc2fa7d96c83b1",
+    "7b117331b58f429a6f9b77443401fc14ebd404b936b351d227398c2b84f18a517753f96e4a3e804087d7107475c7a9b09f26f4a2078755dc609c3f3b1d7663485a2e455280a36ef95d798108d54bc6d077dacc99705c3e44f02ed225785c0db237809ca2a49845f42974c9fa24f98d4ba62921c0fd8856da0f0836bc2f72cdf1",
+    "b89e78823fa7e488d13a8e718c4485834e7525317578b5831ed7f11122c7e802e58bc627f8e987f3a6b6f679e54aa52a391a560c2081f51a4e4bbb344552fef9e03b8e4512908219113bd6c77b69c199b6dcea6d56fc23db6465b9f7d2c4483621d411946ee1b303baf9df4fbe8611d374264606071",
+    "c068cdf87b86d0cc77608c28c15fc7141754a4f73ed163fd2fe727a35a470f0410f3819549f7e750201b5f75e04036b99b8543ddd1f12e3c8659279c8f5431e1ff8569840ee219b8b8ea9d9dce9696c0930988881662bc42627c69c04cae803094180e67be4648c7f29a760488345cb4ae90fb5ed48bb1862feab41f0b956036",
+    "126dbfabe790e8bd6411f9a2a5c41bd0c2c7652f3816f0ba6e370bc987732dcf08419a1e16fdd43f820bab51ef439a9a337f8f50494d45479b2c9097468b040357374738e650ccf463229b6edf98481bd80a899d6572049294e747125dff177b3d98c9ed40b7e19a7dce4c9012cb7e230f66251e9d844273c7f50995c30343fd",
+    "3958b8c76a00ded5dd9155f5c32db2e8c9d1092dd04a2a8265d03bcbd1db2e75204f959aa30c6951f439906f2701a34bda0d99098f075e26bb31d23e3d9d17a536f9c26ec33aebc2407c3ef15cc796d42c6b28432a5869d336487196a84dfc2176ba055efaaa1ee2e90fd716ca2d0f8310a0c1d1ecba942c3453b7ea83550f29",
+    "899a8acd071947965502fb212a5b60aad55946fe1330e758d192d7aa034c53e585844f903bdbcaa9da7ec99dfd93bf63469c41a54a0eed7f531c06dcd7de53b7637c02063ea356462ac64fd1df6732fef0b36adb52936042f743aa7eeb3dc5c54834c6ba86e7fed44d4edfe874222cfc2de3ee88a8",
+    "4856eb850c24936dc0153485960e6d8e7b83eeab35a2764c06355f275afe546ae617243127c3d771e213a0c030ef9cf251fa9fdbe1a874d33a20f8588946032d9afb5d0d8644d3e3ce55cf8e7ce9b43b3ff8785ee6b90fed2e33da6f27fd2413a62404fc9ce7ff044ed4c6dcc0a31978bf26355bc0dd9fdce0f4f4f10638e37a",
+    "f61dc8bce3c912fe0aa6454a61751ac5f7cc3a55264d984a699659946ede29a92be1fb05c8f3c58e2976e7b6de4201352e12c0728fa373cfd31c0b839b9b8f96fb9107d76990dfcdfc029a582e30156f53b9e73163a79dd032990fc195b375d39f14426e2fdd38c6cde42bbcd2e3bae082fe893baead6d927cac5f0e09df7f1e",
+    "f679dbc7d5c80d91948924e42443c01ac98f2d8d2b38a7b53e706cf25b17f777227ec55e6c3120c23de9256e7a8a34fff4f36357b72d529121bbd8c916c9d334af9bd8f7daf5e9e04c797923d2525c314aedbbe32f22c0e48ea73334f85b0adbcf1756fe5272272c5ba06378d738b5a5fc03251354691b893da8a60b575f12b5",
+    "7f9adb00e2fbcf46eea8037ad6399852d970beef69d9388b7f48815a4be34837e31bd019c91a11e2f021b57c95e122347eb8f4ada1832da1a37a20decb4d5b2dce94e81686a3e0fe0ab858baa95796dcc5568945cd4ba1dac115a91c81bab8de8fd90cc81381f01d01a61c64928495399660f33f5",
+    "2c65da591613f3878a6cf4f9be1605f94fe8ff23de6db3cf791d3a6035c29379d52f2c1f4cab58f81c523bea98331bf1c5f4a75021064536de1d4a3989b8462eb34226cbd7670b5fd8ff62f234780ceb58feac8e164f595738e2c64d71e4ff6b301fc84ab60540bb5ab98a1a3aa7e3b2515ff77fea4a0b87fb00a6114d8d3a68",
+    "a27d93b39f254ace2f0b7918cd42388963612348b815c676754e63ac2943200351dfc35a0adb7dfb003b8736db8fbcae795f1f97e6be649cc1ef268c0ae838d658a2d6d75c8e2015c07e89fa08d99ab4f3e119600322689dc447054d06b17e0a2a9a4d75e9dc0847296594a2fcc114cd7456484ccba44f0e16022df14d8badf4",
+    "82e9b331f4885e27a03e7cf42280e609618690f29ef616f835ea450d1b033946ec1aa1d69163841d8ef77f49d56b59f1aa236414762ecfe34791008a86be61e52e665b43d5ee363c31cabf0ca85fb4613389e36cd8e64281c8e73d76704b8d2fde63909e3b0bd7793b263b577a77e09011e5dc246f152dc698897807852c886f",
+    "4993e10187ea02fd52bca3384606ca1eaff9628d5f9c19d38c1d661320b552aaeb51e2b0916f7af83d85107edabb005d1881470109bc54b349439e140d0f3e2067d3c04cd1fd7543a472a430b66d251036133cbb19f18e7b864a503780b3e8472599033590bddb99ebaad90fda5bd3c9e9445540",
+    "c6543e5112e7b21747fc3bef27ad4592208dee0ec13e0ff3e172731e00dd51009c6f526ab34f45127cc981f4e8c293242327b7cb204b035cb6a7e33c224e57401519aa016b66509b1b0b53ec53c23e9c9a59dc0ebec0969aa9ec43d7650db937ba3391d2ab9f0391edfa5f0eb80149aa45ec4a065da37bea69f57bebd1029071",
+    "89b1f9413fee8b30a1838fc76b0842a461f91e86a0b9a3443fe3940a58de2195277f9d4ddb11ad2c42efd443fce1f63e8ed88e05ee7fd978ebd6ea03ec43eab02ca65d0ecd35fab406025c6a43308532e264b59f7ce91866e4536e73a9ff8ebc2cd2114e6bb6912b3756b8f2ba72137679c1b7e05e36926a9fed1810c50c284a",
+    "7ce92914e6309b30c1dd30de07742f3f5c4357e9642e9600ecc80b8ade03b660ce8348657a854146be477bbd5fa81f88fb9c57b78e954ed7a14c37226bd0af594e5225d9349392608167223a82cda90a6e14c5e42dfdf3163033a70b579b06b6564a7bc5b01ea4dd849c06f23845ec09bd71a1a0275e622e5f71bb4dfa33c32f",
+    "12b9875b7f5d7ef45eb64e7e78517d96910372c0a81af0607433b8c80cc60b2d11a5ed38d0a34b704571f1d362944d8f5e78d5d3d9e9b6011db4b01095d59004fda96bda7bfa16b87d607b490c5459ef6f110ca0f30e6e659d64000be21b8885775eb085a4a722aa5b54d3189bd46457b4e1a486",
+    "609e4513a0f372429d435abb79040e477d022f63ce8c7b0dea154883e371d775395be19ea32e76584d53137fa00c411f8a781ee622bb7c25076464e2aa21ce8e9e788b0f565d30efce485e9898a2a806e8582ba0ef68ac3c053a024b5e10eb708da6cdeeb68517745b9346e46c87cf1c0ba0c89903debacec55213f763bf8787",
+    "1d359d3b1da2ef9c96d6e9f29cdf990c64009034fb66ba2352f1edb371d3ab2848407703f295d5535f4c9befa22eab5547f9b203743206714e2c1c234ba58fea8b398c835a6317e1befe0b18c436296e5579897df461a712d416607182f9aaee978eae451ab300ffc3921e27ba4df11dbcbdae232b9ec8d616cb61baa14985f4",
+    "cd28210b62fda48b18e8b1a8dc85bc7133ebe55d962910727a912e775e8eea8b8d08535b8951452db8c7f3d30a43e545f768b56b5f5b8c421f3a0c31a8e106aa751e2d61932a92a6b9b25b0089d039b2cda37b455c8f7f1818f933da5e43e625f61cf2fa83a6115db56888aa691b6bf2c0ec49b5413e3e536c5b68026a8afb3f",
+    "2a9bfd5f8fa684a34dc85602a5208576f58c9d3b2c0ca7015bb760f5e082fb2593439f7b7eaf5dbd4b4ce5679c7cecf1cb6ce716193c8a86d942e4e2ef4f7faf0547099839658a633f24a29d684948c940f546c5a7f3865430a545676d7cb9ce26622535adcec1eef70e79d3224de20e9fd49b",
+    "d33b7745699c6e631d6c324e1ee0bdeb3518b36e1b979b9b29b04430038d083695a9a5f947245e15f4240c14abdaa1441c8c3a813ec66738cb71bf95670d0f01f165ff7259db85ea69afc5c06e1385f88f0572be677271e8f065e31e79287e16a9e651dda3f18a996c92a0734bc4ad8161c59ef4ee0ce3972157330469c9160d",
+    "c6349484d4424da4601b21a58967f0f8703b2ef04d28aab98f77f3b80a3f27158a825ebee25c218c6557a4274144195db69eff5c390b744f4a5c91ea9126908c89271a102374def2b0a260f5c3ec134389ad0f1d8811fa0a7cc725e04d0f124ecdfe168b7fa5a0f3b32bb17692423b6dfc1deeaca2b1d0fdbceefb4933ebbb7a",
+    "47d026ee47875857f99ba2e5e56aad8dab41705502bd66593edb0db34b025caad0a06740b4a25b54e5b265de4e347a74c941ea668d072502c32a4ac5e903c9b77113cdf565fc0455f9a9189adbe0188d89ff41dc029d074d67230010a8fc6352135bbca4565ecb8629bbc30575ecf71fbfe5c96185e746e66088896dec17821f",
+    "33779568a7089eec81a152a02335a350e2a7784eb8f96e9e0da93ffdfbebc779e3fbd713385f501cd6d5946842cc52a19a5a839742c3c0c99681f5aed555c05840af6f9511b5c6527e8686c6b451b03b5f570e628f502cf6b94bb6a832dff43c6e055cbe089ae2d5a8ca32c8f6f371d2130f",
+    "2923ede6c8a7dab28e80c4f7c78990caebb97bfd2349116d25f440d9912f70900dadc9b06b662e02c3eabdd671494fc726e4fc1fb1934222bfb985908bc9d2fc821c59da569adef80f42ad3141229a0b9ce977470b9ed1d6e656c59ad2e537c51bf34b8f2672302459416e1be617d01c6c0c02151d45a4f6f40286cfa74c9656",
+    "b737341aba1145bb4c4069c9f0399949cb2c71e137db1c72ff3806faba12789b8ca40386a1acdc90371fabdc761ef246bfe32de457796b41103b9479dfb4afb5a66da3d18510be85dd51f77e2ab6cad37cd0e8a5abf6714375239c82eddc1f32abfb23a6b6a8b9128f24b7f2a907ba7fb50ff8870aa2c86a990f478cb59c903b",
+    "649cd87613ccb297074ba679599debd90a7f6359f40b912da460f07b53eb6813b49326dd686972ac35213f9d063bffd81d1875e2f8881c8fa236c900ca90f853badaffb9f4066dc84897c1e7765c2947963fe2f8f9cdb453c25741b131180d0bb11293bc938c2d4b87cf5f69c4c69744a547de2c8f82d0ae2ef4096d04fea935",
+    "22f27aa89ee41131017f6284b0e7d5dab284a2e52f285c9ef5b5f2e9821d1752e5b1431149eeffc3332a01e555c2a57ef2c78bb9d825157dbe9921199fc26a9a8317edbd309899cf281bb5bdaa88ea0aabe473e5fe4a0b823776de43ec00c26a89e217836bbc2882db9ebe0c84eab86e1d08",
+    "4f0a52e334d0591e0bd39521ac32744c99f2c5cc0874d54d800ba78b291dc4f47803766149f60c85a3e1dc3c72629c6182b686b28a2c55838ddba28359c6736d4620bc40ad330095f750e548d36ae868661980e58c93e9e19696a462a390e1465a591fc3d16d8206a2952c96d51fb170cd3688f90e90ca9b44899811ec3a2a2d",
+    "b2ec5738a2e641aee62e5bfd3ea0843b42ef6db51a347df5c3d017a06f3bf5842fe95c353a58833520a01a2f1322656ba67f38aeb88e39226f960fa27fec9b4f31005967aa829e60927169059b59e10f63fd6147ec7ea4f96236a6f8c1e58e72d20039c580b249f3c9eb31ef109343ea62b7abf041b66d1a77408877ba0640e5",
+    "949003a4cb38a69f4d8218573b0dbf4a5f93efbd6456b9deb5a6031c222c3a54fc7467a2db8acbd8622dd6d9c079e89f0914d9e8a0e2e3f604222e56418460d7a1090326abcd55189c6347dd3502a484bf31cd8931453e29a70ffcefa9ddea17994b96cfe3869be52019f706de1eddfef8b77a279927f598d9a782a13aeb2ee5",
+    "59e06ac07e3584c67fc6450fea6c07e147a31b7be31f9d45203133e1a8d9bcb054a66d941ad99794e8406e8690d3c8d21b6e9499995527dff238a7ca747c8f303fa5ac610b89a6ed38b4cede47c3a8891e6c5779c2b91bb971465d5ff6d983ec17188bba8e65bffead893d56fab9156f649",
+    "baf76eed44a77f4ce09a9d3c53971d8caf9cd696f524d92c7b1748f9f7383c1c7df00923f5ed12e8c9e9feee94342fffb981b1bc4e440ab8691fb49e6edac436dc71e0893c494586c941cd93e2e60a27e3c0d3f847d94735f26cb133b52fa9745187911d89c524641f187b284f66fc8b1c216a5e06125992a19e7096c1b7224a",
+    "7dd81774f71e8a987d8e5b60b57dd557def68ee9b061eae0b5c216a62366f5b667d17143b19dc4d452939ff0041c23163507c9ef4891d2c1a4ead949aab8e21254da85a40e12e8677fee531418cfeb242bf31cd31dd74de5ee787591ef9bbd4fe87a7dff8b5f20d262ab6b4ca856f0b32dad1cd81ae8404e8292afd935019fe3",
+    "bec3f3a8b15de76915a303366388f1a6acd0da1231d351afde0e976b3e7edc050f36ef3ce1672c6fe5cb33267fd590978726fd008c86e7749c7ed1106b91f9858b2b11a58d95cdbf650a7b2007c34b3c272ef07fee955719d28073c3b3c14a9bc47b82806f502e90db19ba1e24b2f60421acb8147c927258b3b8f89882c06865",
+    "8441ed053662dcdd3f46b735c25c717db63db5252fbfdfd23adb995e1d27b7e94f7807ab106ad7ee7c1d879e6799fdfccbc1d9f9523f4d95b6067b95eb2876ba899be9a4cd4aa45e8bbeaca0a5a90145e2595c563d6ec30e3c88ae1f555f8230d7af88d2bff4cd3b3b29f32a58b3d28f82",
+    "09632dbb8aa694088c23e6bfdc725f1f06733a6a366499ca98e056874a06f72e0718a8f62f1c71e65881c3fb129fc79032513d268d334b94de6524873e131cb1a0aad3ea6873f460ade071a04f9266cb1699bd142a72be0bac8bc6578a4684298652b317acb4a209e45481bd2baac07b85903a0f859d20765d2d74d0b38871a8",
+    "83a9968179a55ffc3c8ba602846c81910cf9531c1e4692423479943c877d321a545ee60655838b416918038d48683f158c0a81b352c85ce6a73cacef45f84002f248bbc74a296e906c75fae4d9f15fa259cb945060ed4516ed51946f8516f8889ee15b4d6b587609d7681da774b15f494255a69cc8b0ae9323a8798dfa267baa",
+    "3a9767457860ec9a469623f1b35da29f5d2d2afb48a262b94a91ad085d14a5232f6c24617b83b7cd85086633274e312d5ba98eeb9655e05eb31c0f81fb8fa1374d880d4d3ebc160cb2280dbae215ee6d6ac17aae897b42d4bece5590d0d6a027c6b862567004a4de03d71b7cdd6f2a3fbf501dd1911cd6e836ef5520f8d8de5f",
+    "a83eada7c3df6255a2fb4a37b1181e7f56bb3b75b34ae921bd3b407752d2ab4d41c6cfad4efd6f882fcd5d09d83350a65fd0881fd131ef8b96cd05b2b702a2ae77ea6629a27495e0df24dcf4b0f6239f54cd9c40a7cf1b12490f5f93cfd0a09762b8c3f1efe83c35da936d5b266b28ff",
+    "e59ef086ddc91be776241b624dc2e1536ce4c917f893d9b721bae49a653387faa9e41245de994e2647a803142d2e9cf44431ce1fd4a76e8271c7e4cfff943d6f1fb238349df3033fb7e1f389d2d2796836e03878870685b92f5027923091073ba97b85f92afe61bd3c094201f41d4674afe4065675cf5c7be51c00c4ca8c974d",
+    "f90e50567b3d4444f3cbae103474fe93116e134eafeb3d7c20242b2e1c3b03827109a95b39f43a2083bf50e9a74fa06a3021444d80a6a0476dee9547536672c4a994e6f69108ac91aafa4dfc063d7ffbc6ce4df33d5e76b63620d70bf40cdf0fb6519c39e8aa64ea0ec91ddaa9b577e3c7b8ac27183f8de697b392080686b7ba",
+    "7c11ff84fbb10a6f19a8bbb25affc41d210f448fc5c363cd5cc9259b154997e32922add169b6faceea7ea14c52e253b90242ce27683925eabd4fab5a3f70d24b20a096031d865e9ef2ed05a59e92f0282fa898f6a3654d0b12bfbe8223c552639481d3393dfb0727679375b7cde437a3b69172eb028dd276e8a3f31ef84177b5",
+    "26fbc4917c96845e7edae97b86f4e4a5e20387ab865447ef35e02656d95146df296d43333ccaf82c9295ba08a888da6ef8115ae9ca649b6f2a4df0e838f6625562fdf36b8569358244966c9b6bd33c19c05618c142bd9f4da15f86ec044d8614911b4050b692ff8f47ed38124d361a3a",
+    "3933ad6fdc53fdeb12f236cccb0f18ef5d3556248479ff00b34e53bd193f3c343c7b6ee16b74bb63465ce36254365766e9ba18573cd6af8a02fc13e932db26723f50d91073b7e4f51f6b33781634ad2fc0203d7720a78248be16c7d129341e9dab3ccaec81af6fdf1e57acf61b1f6d6654d980aad0fb38cd76f42ef086d988d9",
+    "3cf986728d8a0fef01b4df03da1a03aba3cbcb47fb06ae9e18e11faf649ee61b4c0962af8332865ae63818cca5726b43992a7eb905601e1f21dcfb499dece3c4a0ac66d22746ef928415f8aa75c454e3eca465194790488e6037ddde08e4cea5b74b8379d6d18127be01950b45f74a76fdc723e962fb08e51345c3d15aa0f1c2",
+    "4e8fe90b8432f1d980735d8aed39f779301ae62914eec73b7cca64edfa7d17f1db8cf3b308266922809aeb7dd07fc9f28a08b8f8fc379e41f94c41d9fe09d01c12f6812f5dbd4634c158e6cd4cc24d4a8621f3ce06ebc03d68c4fc548a7c67a5e88e5507ec5eeebbff7b9307466f0fe0d7fe8c249f57469a8d5b04e905aa914f",
+    "4e5ea6e325743260e5a6aea7838f9c50b7019e39f3276a8a2c009d1dd5cdf2a0df32a75d2e942c306deda6052f70efa4835a0d4900525fe50aaa9f2add2d882be4c2d50efc2e3138d77e080616cf52a4dd04b6f6a56aeb487fbd2950a037ef7cd221286572036a76c23d840df110c3",
+    "cb9e116a1e7110b7e0674f926dc57db69f74f8017a0a7852d206f0dad1959cbb70d627171bc0b56d736e47e5edb4523d4dac21c685d005cce2b24a9a3fc9e2c1de3e57b052b1492316f1e452a044aef1867400be0a2a50eace0f944e10a41d602ec5ad4227a7dd98e93f96e3866174841b98e4d6fde602539235d7ec0e23a325",
+    "4ae30683ebc7bad1807920bdd533c1c489f6ca1068f764e376216a23c376361042f6a07f61b9e5a2da1e21a04c6f1ff93e822521a6d206278f861434e9da391fa282806404f81a571602d610101cd85ff50c2189e22993d6c707e1607707c86058fc8d11514c2dc0e78ae156314b832e28547c43ce10fc61ea84eb27c4d4ee19",
+    "fbb7942e108097a588d24f2ec316d119c143e4d2ffc19d992f077eb7f2880a2715a680ea8a9480aa8c96c2501fa7e08b3ef1ad6f666decd03432fa47fbee7efe866b3f56b52796b76b0352c068526610fa5fbfddb6c876ee95d4ca40e0caab3b2cb2bd9cdc4bacd5c25e8f4c15da58df00402d3a1e8628eb9d91aa66c7eeb80d",
+    "24283919675c182a3fcf15fdd0e8b3f0bb36a5c4533677a54c206b61974a5fe595c7a09e6c49f02411d41f0b025da2fb9f55376257925f6854439ffc9d498bc5155b7c4738c5bac08a7121a18d8c57557a14123b19dc77a4c568f311e80a56fc644040c7f9575d1d5e1c4a5810f466",
+    "d6bb033ad3bcf835579a2504b1dc97e07109fa9883766a3f23c3b95f6242c164c6842f9e0515508396cc5c9357523fe0bebea67606de0914fe7acfeece9c893a67999aeece9cf86e53fc1bad9d1f63e42149edaa8ce68d8bec36a5e2dc83f2f696de432228fe3fd700515556f6cfdd9177f92704b35bcff755254cebe38d093e",
+    "bc32ef5373408a5e35deaf928c96e3aec70a46d9a1033ea71114eb91c3d99b026d5ff722ef412454279dbbcbc1ac5344c2ef920f1aac3a00ecda8b2878151b1afd0f96488bcc332e5d878552f591d2ec70267d799d164fabadb9eafab00815b7ab79ce6adff2f5c6fb6cc56a539ec271a382eef5d6d7585a6b0da911173763e4",
+    "6c81ea3d3a23e95d5f68a941f0bdf3ece5aebf0e457d50f86d7a0848f142b8c9aba613fc5cc01b1ce43bffa74d5447ab2cca8e1a3cca6189275aa4af6676e7796f4bd943e8df509cba91082e5c66911a927df398e8dc4f450a7d266f27989d13d7dbd531086e89aad3cb2f3e0ae0453ff46a0bf9a1695ff8897df63b1c931ac7",
+    "133fdca7710f8b7a73e363e1e9424eca17865f888c646b346f5fc65a106cb2ebc9d9830e33c57d5e2ad3222b7f369b2354d2dfb9cf0c46b955122004a4740fe1747df4213874d7adee389e632bf2b8e30410928926a0afca9345b815e72cf6641f2a4c14529e842e18b2b0835cd5a",
+    "6af96be10ad92f5abd8e7d5bc19f41d9e7d9c81d2f1c822904dff8877cbf217107333238995fb044723106f8bbdcdf35497f68363a7fc2e5e2033005aa6d0f38b310015118ea85630fb53ec4ab9617b09ad4e79fd6db537a857d8c373b3a0e369302b3c727acc64bbf4052d02c506af2557fa27d6f28720a62aa60d8475af45b",
+    "9e3cf91aee6d57a9f69665895d2f5610da85294890ec75efa65d41733307a3e04e826a5efa47ab8c9dbb69bd1278d6b5b17eb5437af9d4bcdcc39346d9709ab14a3710d438ecb0da70e5c0efa787616c033e9a616b6880732a38c28a0cc0dea3b8ab71445452a0e780ff5bc5b21c2a0dc7f24d240a3d15b1ba21ad9e6e5afd6c",
+    "f64acf7b8be5146ca7639379089077e8bd906a567615664504bcc9c4aa721f9f3ef2bdd0c92ed36b856c5dd17c86084b1e9228a7892a2595f922f7b80b660aace8e9153a51618f67f4479f079b90aa84dc7a142b82375170226fd21186a41a3237f5b105a5f699c6bdab7326fc85d64de9c5d6b9a892f9ba052f14799565499b",
+    "3bab45307bacbda9b3ab032d58d94775e7310b4373c6d9e99a046f1418ebffd012db88385a3ba4dea299eb097842dc6365e008ec2c02c7d6a2113ee6001a1113c9bf443ddf19bfc4ceaa872f79ec7f82f084b5f0f0128d5b40e21075eb402dfecfcbc815f57027b096b2f49b47",
+    "88124358ab16bf91a121e3208e81e8957d8bddfb6903124c8c165004bb57fa230ed1fb7c5e956d3c2620b149495bc0abec58e53ab3bf34f51c869ce60f0bd990c4c9a5d3259a21799155c88d329a7068b81516d19ef3870fafcf07d79a459c05152f11243736c3ab130472ec01ac0a463e276993c6f40ecaa38f7c0d2d5cb53c",
+    "ff368430a764152fa24a23e3f4bedae234534c96788ca47aa2f91054f703f8469e1abe2e51a6eec28377f480ed0210bad03ed31d410510bfa32b197d703f153b77ac44e05f6a8a78ddf2125c19edb1f070859cde02b528cbc46c52118dd62a43b093659efe3857293b7dd88518f02403bf4d6f2a7448c2ad00e806d972fc7991",
+    "cf6cc686ac0ab0e859bffd87989e4f84f44f7fdf72c9ae7d9d46820c72a4d05553885b281a21a10818434048c78000a241fc275fb896896c9c5da8972de448e4c9ff643f274fa2ad8daf943810e6c78d90a49860119a8a3901f8ca73ef12ffbbabff1d1725b30e260ba1b339b263474e5d65aace1a5c69447cf0e2aeaa29188f",
+    "5c850f7da7955bcfd0c03db81e2055d56909beee1241f98c445a25535654e2740d22d7f4212fa8ef907fef7d40047d686bf74d39cc915155ebc13f2e3c7b9fb069428bec4932ff6e7773bf357aca432c3007c14021e74413e57bd3d116a817513e434397a387af2f4ce3cfa8d4",
+    "49c067ae9cc151c5bba5225c2bb18e1bed18f6f3e2418d253db08cabe26ffcea3d98a5f3989b3c540308f74c384abc28c445a99f355a0b140539fc3aa6a6e7288b26b32bc8bcedbf602dde0c86a4738dd3ee28052780bd09be0b306c38bfbf30719eb1ff6956875ce8bd30cdad63705af1050e108b1fffc2aa217410c25cea37",
+    "7d53e07824c07bf73940fc5d8494a4d4a1e6c0fc21d7efb4010df58ce16dbc0676e5b500f226b3b41610dec29682e23864acacbae9993ebf73ce62e84b44c3fa2c89b6011a27d2ea9cb2458c1b40970ca7b86382bfa6b16ed4f2d602443c21a5f4e9437d2173b828e680359f3443731b5d92a228affcf810c4ceb09e90326924",
+    "68dd7f10475da43f8725f29ecea257d98d66dcdf82720e65afdb61b0c32e683f00271e0ee50f44fdec2b0530b64b36fd0dd82ca354c20d992e7f933ca68ec1887fd8b028138c326d84f627f8cb2f4dc3e5be5dd22d2aa3da09ce85bd5856158575a766a8ba9be87dbc2bada9f32fbc9e34f1488b0bacce5d1b89854a578bfa7f",
+    "1c95c848c2d62e6f8b65898d10939f3f242492103e91af4de47801a19bb9ce90f3f6d4974d3b3d01f0745adb37cdc14e3af9ae0b0cb560dbc8d215180eb8a3ba6208ec7a242dd3971cadaa270374b476d60c651f70141e7529e306b3547f72ede2681988ead131ef4fbd24a8ae",
+    "96866e0c3cd6d84debc75aec4be16eddb5be56f151a759f49435eae2219db111c85407d2892387103646b23a9627f94eb9915b1f21c3236c25df9a80b03f1d9be7f6d361930950f85a719e39ab5ae7c2bff4223fffa3ff8d7c0f07ce411dba340cbabaccfaa0d2cfaa2f4dd3300c5e5334dc273b4a99a8bf092676359c30991f",
+    "34432f36d5005938f900348e990f647cfeb4227975eb542a2609e302752bf5eb2bcc0f50ce5f8d56b5caba8eabf61ebe8b3b3123fe33792cb65bc6d7df9828bb74a178b35291e527f4fbdb61b38bfd6acb704469daf42899c81a2ce60e2f9e4a9a4c0f7915a1d545341fca92b4db23159040fc3a11e16b3f8b027b4f0d1a7ea3",
+    "d3b703142ec19ffcf0e9fe905cdd3432eef94222223a8740df770970e7afe0ee7ed71e0ef2a2f0c31b17786b90ad7d34ab9bf5cd53cb031936611f8dac79e98f0b0ae237e8c6c8748f9f956522183bd3f5c25acd3750d919241248178648f8b5d43ade0f9f727244f4523ac27e2e456d4464dc4d92c77bb577df96ae72b1e1af",
+    "a2804aee6d433a27f53330900d55fd0d2fe223a6e4754b7a4ea7ef8bf5e090c3a6d713fb6742f95e546f8a30f036b2d372bdd279341b40bddd613ffd90ceddc04085466f1df291e351ccb430cf9e34d29aada34bc3ac7a92932fb704e77c8cd2c4fe4211d525f7288a50f92b",
+    "048ccb1d26363171695b80fa897c32d8b3eeb184c07b974c4900160ad22df86b4f46adb60a8ae742e837dfcf816649bafee868250be4ff067d48fed7a1aafef3c0dd103c3f4ee2b94439bf13b910984626946db96cca0d9c616956278d1999b256cddb6ba080f447ccee9bc23193740b085e216f7abac182db1ab4d511698ff8",
+    "1289969991ca86a12b2a330291bc3f93485dea16632ab8c084fe3992ff964711b521cd5748f24d2794a2f5ddeb28757fdf1dc93ee260c58337709216aee965549f1ce2b540eb3682a546bbf3c9febf13c00dc02166cd94e01f5f09fcd9360fb4f5981974ea7048ddeaa24286b709864c657ac1d2d75f3b2442c08e507ed11df1",
+    "b727a3d0facea0048a993f14dc5829928bec06b36b6b2059daebff050644061f654d2a9f7882cb1c5b67b510ba26f62be50d0ef1c1912eb9f0f1556a322624a17ff21be3a1cd459d2d16511fb189ea98d5c48ef7acf482800fe6b5e738ef6d26f170ef49e439108d2a287bb4b0e17c23596d5cda079842c031b1ed4fde8d26e3",
+    "39b9d3a1767829655edcf34b618fbe24b3ee7534cca7f0e399579b239873fbde0a400fd4e1f6f99d088c303ac7dc3f864c87beee126f5c8189e0fe37a3cafeef14981315ac22c33b2ce4f1174bd7b7b4afa7996c70c7a503408ffc0fbf4b74aa479a075729ea0d4ff55d2f2",
+    "a883a674f1e57cd38397a651de6e5afa5dafe474912c8f07b296ceab0fe9b1006762196eed54e52147ceb8cc368056c65d28afccde6c7967f5ab4b53ccd4a4a80bc62874cb42a361e50ea384e4121fcac2c7b95d3a176b624a588f832eff229fb1c1f1f1d80013c7f952d19d42b32c24f0556e54b07652fb457e1279d3dccb32",
+    "8b65713dc6ef586287cdd721776d7443fead6c94cf389f3a65d9a9e551071a198af670e7a5430e5b6e4c95e4ef4746443c4a8802498891ac1692c512e6471d15efabc6754d9e91dbbb62d3fc77f59342d9c51af83d8ebe90f520b333fbbad8bf87e3e7334fb5dfe1527a8a99b8f3a95efc56c18e5be34f9effe42ad4c1fe39e3",
+    "c1c75afcc29a756ea63cc0850de35f7c0dc2c4207fbf49a6b4f8b864f2539f1803cae5e7b546901f3811494aa0dfe3674d774586e6bb68afcc6d03a0cefb4b105da9b721b7d2f87284b8e94bb13fcf28d53fed62596a1fb5ea807784c566c6c1f2819125b7db74261006ae1a7dba734a81ad15eb51e4285e643cd4be09223b07",
+    "1a5a892eff18d946e434b347b2a7011a2fa1c789c1a22100dc1f451f0d814c73ef7dfa381fcb8e9ac77100a3f8578e80a2c60185b062b0a94b9f399a2b8fc7115e5791a38558c055051943fe94dacd2098f7cf88692f17e787be43def786f1390fc4b59216494b79522466",
+    "c681577c6bc1dc643dfd259865ac334d7cd28fa780d3080c982c3da27d4f73d2b40383cb81b4c9ce69cadb2dbeac765faf78d976a54b139d852b0adc40749a984aab4d585c9a94bb8b022e1167bb779e27cfc5545e48ba95b7b1e739f5235bf42fef621b778e05c6eeb037295c8537a2965857ecdb1e890f12814d8378003f7a",
+    "b9ba7dc82f0dcdc62d9ccc926406fdda95dd661baf50240db5f693475fa0fe812be4981485e99a901d9b24e226af482eb70af2d169636a508a3a337a6b1d4153f2539d53450cb231d83e14a7b429d380c41e5fd6239d68ac9e0f7d1087420cde255f63ba6964eccb551196db91d15bdb59924bfea3ec679d9fb0a9160d34b36a",
+    "526eb40f847cd3059267fa5d43cd4861817fe4904869da1e8f7c91d8ca846a9d533937d6a3233937042aec45cccefd75d5fe7c4c0a6d21fa2ba22f1837b2d2d440baeac2165412f87d5ed6f3affb9bcbcf955b47f7bfcd012c24ca5cb88788c34c1ce740ed7aafa7ffc5d4ee84a1f9efb4e83ff83b29870a3b726a3497515e43",
+    "7f578fc1eb91dce392d40d48d0bf4b91d2d6a0a2428903d887cd5ca2ac8e9692401ccff71a4e0506533e0a11a24bacc648c385470ed09beaeb34c19ac66a567c2dcb145d8b66ad9eefc54fe66fde2e56055e1b6fd9da724cc9f6ba9a4a8c78859c5f179906510951c300a",
+    "da533dc76fdff7d5fea3c1d288031fc5bfbf8e0d9a6e2e4dc5a365ffdca036d34181b958230b4a14a41261e2443cb965c6a940f6c091b56afce872ab8b19710e8afc0660b898a2c4c8e087f0e5a0d4554168f6ade5be5fcb06ed6278d2f1dc21ed7079673ed49722f0550ba8af9d6b23a2dbf60ce346dddb96b27c16acc57290",
+    "7b49bf7db80427516b9a701c0f20e752c4bd66751dfa58fa15e09b2380e179e998c6aad72b5baf8030cb9627e2f0f10100ddc09dac03bba5e76df82176bd510d7f056474a7f67514ba05de9375f1ac3d8a26c679accb64eb3819ae72cc95d4658a36f8e3b2ea687997784624930b003c432bc38ce48688736611f06c617f2050",
+    "da0f761a61df0b378e8d77cb70d0c3f658cb7b2f7713884c957b3845f6adfa1b86fff7d07fac69fec10b42cfb623713cb0b4c9c585215a6e02668c00aa9af185198bff5bb7db81dfc1e6ce9cde662ae8c18b537663544720ff2caa3cb172fd2ea36bd10d01a29a67d621827cca75c0e402346ef2d93efdaf6e15c37ed6410869",
+    "3b0a285bdd788bd9fb3713d68e82a3dc544c3f7d6d9006cffceea2ce0867ac8ce2c4cc1439a16c66a2a42d13e035910ec45547600d4e1567e516568315d886f28b7c0d8cd1a8c3da260c962335e4431ec6ae16c68635a72b259ed3d32ec0a4073e02ba07607b3a3325c2",
+    "906878e9fe55a724eb721a7f337c9104039238866340a3454475bec5e7525061287d208e6d7353f25c8ea2267a16d765aa05555672a12451b6595f37fd81314e461f1c03102a07de13462bcb6af8d97077587261895507b2cdc076b4bbc367dd2193cd147c97455eea7292430e5e8b97c4bf249f52d8c0999f5aec272e67e892",
+    "d3c1e222028fd918e504a56410f3725356dc5b732d4ae8c5be988a565d8660795a61a823b60c6d3706c3c6282e95ff66ec2fca0f8743379a7675cc671e9ca3f3d6d7bcfa397feb7738f0767d8d13c6b9be154cff555db3ff04130fac4b8164cdc474bfd69cd1b67a7096755bc3f104dd3b43cf24f3e2fa0104c265fdf549d10c",
+    "01ac3825d109624e9619c63ad206e56f69b2caef3db3f63e504187920881faa318183eb0a6a2eae75b2287aac47b9b2836c42a5e01a4a713ffe8b20f3699d4c83b4ca576641797892522e2ac5d4df81059e09d009cefd0370c66b47a873df5e1a500f7698e99535b602f5ab4d97c9566240118ba5a551668cf2b8e84a47d41c9",
+    "41dcba65c08eb9e8febbb45d1a77d54b175b346050468ae73f2c43b80d43144ae9c494896486aefdfb92f868dd3e9579f98e6148a62f5d2a0f67385847fd244b34e266daf79c68c546fce7614261d3bb2f19e24db960dfbd0f773f73e2a530be320088606bfdc98fd5a",
+    "aa90cf89012a28c02e5ae196f376df14608411da329a3062dd83e7d997030cb07fab7f234a196fcc1d52db914ab9898ab872a02c7ac20fec7bc007497324388f89479b712cdbfaefeeb1abdf0ec7ba84738702e7bb858c6f507d66a8d4a0631068f18e8f3b278d88b43eb6f5eb21f8a063a0d91daac53b64b2b30bc35ca541d3",
+    "b66e70cd4bafefb11e2f965321af5c469c1debf980e3d06c567f5e7c74452d64e714175374153f660161d0fc4c6d2c31a9515f8d3f8e6dd6a2a5ab6366bab5ed58191dbd6a7a025e797007bf0517728c0898905fd41f75a000330fa4e68ae2589644ab2a299ac1849c1268f947adec85149fcc0fd5e17e0baf694f7ffc7bab0b",
+    "0c7cbddbcdf96900115c74614d443bc902debe3010ac1444269efeebf61ea6cdfb80906e5de0fe3840f317c60df883676a87e27aba3d7ee531b17f60b263d72ffcd2d43c4f6ec61dfeeb5161817409bb48e4a3ab03c06581aede540523935907a1590a60d583c169f20df3af2c8ec17d7855caae7ac9f96368436f45fc743c17",
+    "b8cf5ecc586c47a4e0c38c011e3778186b1ea815d9117ac2fe0eef84e4931058d3a40ead207bc70de1a6c79e2a273de644ccea748269f9589e93ad703da985636e5dabefbf011931b252e08cc9c7233d1d46239ad22119eb18339c3db09f21d12d65003d29bfbe950",
+    "2942edde835834d66793e535952262c5e9ebca2ccb4bcbdd517210255f6d44541cd5233c17014aa24db0337296381810821b04bd538cdba03af6be87471d3522fea64356ddefdc9d32b30ec64d10835476d6a1e02535bf377ea44edfbdecfb594da158c23c6cc7811f20fb37f6ace3fe6fc100d2e8b78a3e82e5283fe9543237",
+    "806a933a05db085632cf1945cfc4d59fdcef086bc9a14d1a2cb6cde3b191dd173361733555fd93b1d9781a92c12181245829bc634b0ef944a95f5876eeb50d90a9ee22f6147f63c8ded75b7555ed278a57d7c067cff14e8d56ae93b98fec1fcdc544137321947caa8abe88171dca9abb7ef4f34a75b1ea5489aaa7d2af53153a",
+    "eacd0c4cbd7e3dca14a448d098da0c1cc3832d143071c43e34f2f05e4e6dcca28ba42a03c1e2102d079cf36f4f674ac5c021effe1036fbaafff57581893195df153249531dce93f0a39fb27902bbeb0e6b07b2499a7c44ca434314a18fadb4864fe7f23b52f67240d09d7303b47cb5b40762e45abe65dfa073afa5e173a1bc9f",
+    "ad7bab25b95c36a9e91fe18d7ce117e7603900d51677ec4ebbbe1dc327ee5cabe02f42f7a9bb854695b39ea31fd7f8706c214bba55358ef96d3ed8aa51b10704b38123dbeb518c976b039d3c732c1a0fc722313baca15b767641737578fe90bbe82e67ca6b820913",
+    "268bdaf7b6fb8890a17b8d0c05db695342a03db352887880b78dd828ddcc51fb949bdd8eeb71f628118e2176b025695a3b8a980e6bae497c21fd0747921a889e538f038768351f0e6ce65a3ab4b66a274655c36350b5267fbeda8a511a3aad0fe6c1ccdee491c927277cb528c79bb7969cc421fcaba3311f44fe6d044d3c49bc",
+    "f493c5c304d2c143c95a100c961549769954ada19687993794abcd6d7ad67e5fda25304299f5bb03afcf0d0c156ab6441a2b14c3d46db5a2031a06d161eae7d8afea4730baf39933fa7280f4927f6c9be1291e33a4d87d6569b64ea8c5df795c926f1b9fa243017acd0e59dfbe0f5b75b0436afa8b28083989203fee80b234d4",
+    "21618579e064f2099767d6e6f050e591f335a2c428962720c00ba52958c87681b4551b78ce401c26aff0f3896dca1a197b000260b6f09b4b234295c6511ae8fc4e63f2fdabc96301a5e2574b6a7ef577887ee18c02212f7242b36856450273ff34d025625f01eb1401ee9ca981f409f1897c604415bc508e48b48182036e6501",
+    "f21b3d34c4308cf6b1cb5410a0338ef7c472bc16848d976427658436b1cac89ee7e231d1befbbb3f36084b1d4413a657983bfa9019b684a06389910891d9ce6989d5f82925859d89fa88fe57c02308cd8cd67f7fc9115fbf94c84ea82e48aba51160eaceb29816d",
+    "c03c3146907769fbd1217e0cb94a2b9bbaa436bd00ca2962300651a5e67413bb377430549c6f0cbeccff82e383a0f086b9d45360b2203152f64e3f040b3b85229b71cb75deec996263738f82f4509190cbed8b4d499c4eeb999cdf86515e4ed0f102e07e04da824d2ac2354451a455c06623b38cbdcf961de6e777b8cc147ca7",
+    "92d32b6612aadcdc967e05630f21f3476a3e50fa80fc9da07b12b9ad88cf4d650271dfc8447bdec4ef1f8e07760266fe087011ad8eda4dd20ceb69ebc5ce2e454f3e39db05e35bdd9f378a2c6e56d072e0ad2701957a9e0262383ed5e106149947d55ff31aecb653ff02d237437eca352364d677fb762dd736238cba5758754b",
+    "291fecc6060d15dce7a1efa9ef75979c5bf9949ac76ec223cb8eaaf355578785e0e97e3471b58f342415a26c6f411bf0422f391f170b40cd43861ce1573a60b6445e6e97cfb39499f4848555a5f4771d04da750b69f7095d6f9a7c62d3eb94f8e478bdf26776e93f41c7e47a6743d8920c20e381838288f53556c1181379a0e7",
+    "1698f043db07d0c638a9dc034d331442f6b668c573d102a2719226329330146fd6d03c87392be676872f82415ce9e39af8722625a72e810fc431f0f8c9c9b0bd2d0b1732105be37e202c1ccbd8e69302b75c5c88f6cb91bd3d4209b0ca4e1e2354268aabb0c2afa",
+    "39004829f61e8f69912ebc07edd194365f8d9d3cd6b1408e27bb77947fda56759386e5a1ffefb046a5aca494568210a7c80724768b38d54d812780cf47d7e4273db3bd90e1c05a2a9e39b14ff1bfeec045094afdb9e78b69e95450ffc2b08a0d8b56ab06b7173316856ecc0982312b1f7cda1f580bda0cde1866e538394251cf",
+    "ec2b844597203ee48fbdae4cac5f40722221c78ee02a613091b5e1a2afe5abf3855559e11afef1f3d33edb6a5f2497df8819b5b6420cb230ed46e66e24ac31a2cc099065da18fd392de9b3d3e0ac28ecaa2a18e0db67a17aac8ee8fc565683c62a3fbf7322fbf9404805ea1ed16f33b3745140e1a782243cdb0e5d1dc5990d88",
+    "6ce90adc7939056aa6cc86bbf51377bbd857585891674597f24d28c95610b13d1a18bb38c0fe64210fe6c998cec334be7dc88913f44275a5b9c0e1e75bf5b75115100bc60814ca96fde194389a3f1f2b6446fff5d2294801afc8e28464a112236f62fb979248ebbcb459ac49da4ce3d48e71c0afb7d5155ba2fd45ca26a84231",
+    "9ccd8a632d6fc9c6a5102b67d9b6c13df19f59e7017526eb8e9ea4122a876649467f8094d0a65f19db23b2371e17a4b6d01af557f6f7e985400600a7994b845879eed1087ee13b9159c1e17a505fd732ddcb754bb2751c80dd81f161fa41815503cd58758695a",
+    "6e1e967b29c1bce3f028e000af8dcb89de459e92f50ff46868df4807e5975c119bebf75f4dd268f5b4cba983f794361eb1eb25b8df66b199ea6c072142e91dc56101bcbc84b9e7f904996bcd18b8d935aec8aba9fc4e20632ec1c073af4c15dfb857c2b6f4b3d47b922b8c5af7bfd8602edf6b2bc8d5062fbf54d7bbf16442c6",
+    "3e68dd2da65062a715f8ba4af2c95a11293af48de4c5174b6f87d9d60b50d3bdefad2c2af624b6a1848cd9604d7c5a01b4a257266b4542c5130d89fd19cf8934cb9033e0951c88200edcfc77d9b1d491ff45d2840e4a121653322e7d7ce70ad58ebb88b13867c2adf1efa10fb8308fdde3d7f0887ba17c0356eec4ee4fa485ec",
+    "700d6ea5b778411a18c6351ec75bc4c1ac9451767a448dd20778867f439d1ec0d2a96f23e1ee5c7e4dcf5ad1958339e52b9307aa4f91c1fd9771432abaf318945811bee7107594019662fcedd507c94721cab21edf9f0a22db02ebe0fbc61f2099a0091243f161015685b0739ddd40f40ab926250221d4e7a626c5fe1cad5e77",
+    "5bf5d38f7d6967d311afc387e457dd91337e4258c109b278d50fcdca06c2f152048508846ca9fa112bfd48380e57816027bbf1cfe0fa804386bc0666dcf55d1dbd158f5182d6997505950e18261a422ab5b446c1aab7b65bf89e77c9abfdd52de9e38b64568",
+    "6359318bd5797113437f51d98830eff3ecae809d939b633f54bd50bc2921516b461e3b91bad02feb41dab3dca33fbad9c0bbe7c3e1cdf2f28f5388085630e13c2241eed3ec1b04b1dfd74503cfdbce5d6f92c7051121a49cc21eaa7f49db9268813ef3aeccae5d7e2263d843f9d0134145d1592425f9cc5dc09203b7c5a326bf",
+    "1d3a5857b7c5593727e463939e43f96dd6a633c66155ac476eba4cdf51ddccae4e323ac83ac80e682c48e6defbd66ffe86739078575ea626adafbf48b01f993c1bea9922d2dc831e46d5d9045ceda782c6d5271f30ca1b95335a66f56cf783acca92ce38ba75e6e1dfae15f422d9731740f937daa068fc4be93c1c2b66a6cd01",
+    "6142ae8c06452d9519ac6b29d7bcff7f931f1636648f9d46ba91196750fcaaaedf9909dd6d36b421370185616d05d119885e401472e84ed1b12f510e5282cd5abbe94928504680e03ebefa991843b83d243e3e8b71296371e3061fee0060d991be46b5de64b0836384a3e3678087047d94c9570d0908e354621347df51c243af",
+    "51ad33688996e1f97415f96af4bf61679d50e8066364a2570af1893050e6abf298f42f18213a93fd31d5aa97ec524971e034122737f93116475eb410057b8ceeec8a46055b30f316bc0d984f6d929357aa48aead187bec2260cf6e2f7ac3700c491ac13a32a",
+    "b13a13ee9410cf8261b0cc0cc0a024240745fea6dad52240e3f370754c61c6e3fa7fef947a89c26b4af88d24976220eaf1326c72e259d0f0d70cc7bd69c55126936142ac91eb4fe186e04269c4e349256c32ab9a6c4e8b7bc5cf5af9198212042ce16483f53f00b7341338ca0ef7b3105ec5072006417cc5746c31d36d8f626b",
+    "73d7e7e32120389b7337e42b91d1b1498e5655e58e4ab408cd7dbe3e5412e1736d6473123ab8c975ed070c92fde17acab6d1c20eb2f1910ec09881819d0ca7214cbfea31e9741ae4f27efeec8bd74be004dfd5240b55ac0eaa25ff8bf4115dd9d543d8de7ecde1b11bbf8f4b1dbefb854d2997272d731f8f92b6cd8a5e1b6435",
+    "4dc3a14427636206573e07467b5267af15238312a4b8fe529e04f40e34b7e4775ffc2b8116076484289cb4e875d5356864d8c331d7c3f3f627fbe12a20ffea8df4658ef8aa206d175628e0e73a281c331d3a5e34a62470fe1932934a6de16f8cdc60f1dffa62dd90267a833ba33c4e3c3dc58e915e244ec47d6d9d1019f2b365",
+    "55229f2cfba9d0a851f0afea6bdb122da704c9523a018c294e84aae58b8fe93dad6132b05658054a0fa69e3b3f6e4421d67166ec5991f30561b1e08d6317f31a5de9a153752a21870c9a43af0e29567d97f12bb087d5ea1613ce38a8832f2158902ff66a82",
+    "2364f9a3a2290241d6f32944cbfb0a9ea582188bfa3920b048d2fd8a091581dfe76297631e49d545a4622b40be68950922013fb87170ec04c2698338a6f910dbced0033249759611ba279c2d3effc3530758d37b2ae517229993b2a4236cf518c7aa0cee2520398f930cab0673ecbe144e1017da69cf29a6b24ec42eea6c71a2",
+    "d92af0caa989c49c3b1ba248fac353aca24be28bcb53f6d13c1d3e219769d44ea369ed91f2a1aa88be26a0b5e11cbd24c8d240435772aac7eee5635fabe5ae4bbba8d4075ede777a92418df9da1b74e19a947371cb4cb1ded007df4e981247f023699d96bef6742727a96ef7d50de7bb0f4281db7155815a9ca95c644be9a590",
+    "75c86667975a9b1857a544e8c437c24999c7ad1efaa0bfb130548a3a3c15335033b3293dfdb872932b15892a6e613281b2536900b10f80a1a9a9a237be1283a0ad0c156649e24d01fabf92720f748f4ce02ed8bd50a295c14d4a2e90e39478dffe48598485351cb7cdc77adac982889ce9452d4d1543ea71533ee445b8b63069",
+    "34ebef81ce402fa964e3a791fd1b83a8a02cf5c5feef84e109301314cb0778430bbf273e912c3003e3a54fe9f8d78c4989c6482af6aafd3a10d00af8eb377b67fe9e136e57626ce16dc65daa93401c9059989d393d77da4a4ab9e1abbfa8993cfa0ffd8c0",
+    "3937bc4a3c1b2a658b8bf2fb86160347a266f4aaf5a94cc316002ac60e15076b6348c5e542ac988dc4064703bea60b69f1e422154a51a768fe8f4dc29be7a2f75907dc544f9a219335cf59b1f681e3682e7389b91550e50ca1c709c1daffbe542303851fa1bb98a8007056fcbd738609f8de0aa339ca252566990d9514e6b7dc",
+    "1eab460c7a6ff765e4c8dcc460dfb1caecedea84584b258ca2b735f2ba7e07b7f83398a6cef628f18f02599ede1fb85604d6804e2c1fd79e933dea3125f733373004ed886287d48dc53a7bab89da5d46bc2734b6a1dee8e75afa4820e7a200e5d29b4728952181ab856cb2667489f41e27848ed5dbd02abe36df275fca905073",
+    "9a3b43171b9894313c950de2b04d690266e71b08b93ed805691e64ade30fe4970d0123266186ea2f4182a6ad7813c1d6207221175d47993ed54742ec4ebe60f854176231e965f4b82f4546423dd47f795cf83af7ae8c3711e56f00158bf00595d0e7f8af0d353a9cc1ee993a4f5e367a7379dd21b62f6527fb97eae7f62fe413",
+    "44b91958cf1c70f410b965cb642c942a3897f6b2f65c1c85a6ef8595297b98d22df8bc57c72c5ece3e24ccb3c2a3788262f80d45d36a86fa1da7c9c916c9c4c4cb793b8ca0125e99f1f11280bbeeb297239d66d683ce601a0c0fb75532354d099b65c80",
+    "fc8d7a88289e93e9536f15fccb43fed4f9116780b128edf2e3fbbce3fa79a41a1544f339c293422b9b995ff46c80107fcba4a3fe49ab06c8d7d1f5cff5dfe079490b6c08235fc083f3c0384784d8e9471a4dbde2e7b03d2d04c68ba3a5d8929dc67eb13aad290a139831ce681c9804a085ea25ba21dc9e268ffc1c24d8c829e6",
+    "0bc3ed3915d2f4bb74302ae36010ffb9f679af464f7657113c228b61a79072d33e012652019209bff4e1128de83f12769cbc080d7fffc9c60dac34ea0d98a29b289b474efbe69a880f93ca7a3629cea3f3ccd9e2207ba96c37634fb75ad823d737868b22c1caa4f7c8519b6ca37cc4c3e181109f154d27231642bf223ae693b9",
+    "168560e6771738e8ee2020c45ff5d6c204f6feb69d0b27d1827a692885238263937b6697a6f717b512275611391d7be4a32d7dcae20381809255928cf80551fed6623898eb298543ce98cf7a07fa9799bf2e8ed5dc78a76dd40e66b6b839613d63f43f131ef49d958e04ffd5294fc4186edb7cd08999af80a815c83534c950e3",
+    "16c32e588475750153e4fc875e7c264a8390448b6dfd78b825c90d6de0952d21511a449f2856ec49f80a226928e6150e73a768a0410aaed2e86ded3dc8c108a7c7a2a4aba73ec7e00f877401bc1c20c727feef77d8584781aaa0ceafba795135ab33d1",
+    "2283e385f452d202603f897d1a424eb7e145bfac394c8de7d4f7a74b6aca7e4935d7161501948703ee59a0f1b874a924d3fb86a480df11f3bae3e016a327781c95a644a2e15b914a9f4fb7b9a951ff0bbbeb13207e24616e692334b9d6167572fac8cdbd4b69be6dd86e19c703993d78c739833bf3516f5a2b70bbf6df25ad02",
+    "90c6dacb39ad2393ed30ff0396f0afdca0baddb0833f545d73260e158086a8128a0a15002e14d65e0af6e21b113dde3353eb8932f7e2157d45622b5900bc44669c2d2d3d95db772624007619c9deb6523179ae2f310af7cb028bd512636d3998c2ea311630475c2cc588180aa7556059fd0d4fe9cdece9d3e2c2505c123c5a31",
+    "847c8037683194e4fff6b9bfe307d65d8c7aadbe84604e84a09df82da7050d5e2dde44f60694e5ca7eddc0c6513266528996b3adf18b547f12cdf7ee8afe8cd6f7449c58e102a5a787f27479234b0b1309fd17445979a71bf0a677d0e7ad0f8cb70b3f6cb037e7655d0a768fc1ef6126f43eda312929a00746d80690d158a15d",
+    "6c1b39fb92d3678bdede215dd699d0e4031b758ca4e91f1a57069dcee8f8fb28741df63f8cb917d5e4d0542b2b3fbb0f61d5eab7472439c21594d53d8653382ba1762a4ecbb83596343a1ea9fd08456b61c400ed9278e4c6bcb892c4d2e3a2f8d6834",
+    "b849d93b11edc896f24b891fbe0ded504802ebecbd42954ab7704a90a02394c4ecbcb2a1efa3b083f4e10e070c42ed2808769949566b89392fbb81abff3236d11ba034850f9918b606e66cb9a1cf756bd77d844e64dcf02f0d4e226c2dd280e4689995f0ba793a54deb21267b012238b0d5639ecd3af566c2febaccdd57a6e65",
+    "06d432a744547c03edb95839d53552add47571290c278843986b1b68f594d470bdcf4e2e57dcc482c438d5d3ded91f355faae0838575a5b5476b7b0358a66f460861be6c184a5f7fdd90476fa9f141fd105851b76168ae311badb86fe098bb59fa8ce7f1e72ee6c1f568d021230b5eb9c16cbab35905092110dace7b808d2d7b",
+    "1799dda2505cc0922ddc464cb34409e91e3bdb241a1aacce8fa8177ed92725c870bc19f4c5ab1619d75df5a072951f12b7ada3f5bccaa9cc1017e79d69955e16359d58e7112b15491fb517bbab58070e14888f49ff1bcb14d4f53a38f4abe3c39ae5402c50b91923005e9f9a977d021cc3ef668cdfecec081e8127be4c03afed",
+    "b84c7c8ba9f5888526e4a2d0b00f53b5196adab7a22089426fbde1ba9abea01182645526533caefb730ceff83e0df34a0f797f38c9380ac4a54b709ddec49381bc7829003ef6ff1e5e52aa44a39253a2d25eab3fc4147f4f4325b6a748ecd832bb1f",
+    "61f9505b29fb454879a480524efe07e1758ba7e7dbe817ce4886152b0e16ac222c88b2be81c9f2e10e9c73797e0de52af8da4821ad8884825f3f9c5a214d7cd26e3bad78931875bdc115262e556b7ede721eb603e9d62bdfa68c8c85cce9ba950c3def145876bf727c08f06d9d39b5594e527ede1f06c8d77356003562bddb8b",
+    "6a3b6aad3ff296c28fae0636ada8e5458e28f6367dde32a8db376fa6263dfb230dce89f10a5f53b8b60ce858b7bba837df05579d86f7a5ec417a4b3320698ba172c6e58ab60e969240b3a37c6987b757b0f91a5ceeac1c293f685fc907f6bdfe158c1a11eb8ff62b2fc7f72483cbfdf95703f922e250e75d458fdb1ed883e536",
+    "26ac7f2b129d3d736fa94059787ecd94f8d1fd870f5d5575e890c6d1113b30484367d26a2a1d865e808971016e9d760da4def8226a7a5ac3ec487d2f7f85c158335672447bc5e664b3949b926d05a2b28970a29f9fff80bdba16b7f15f17cb6567a1a67fcf7d74d2cac7e01e1b496965a5620377d312dff320c9282dcaf884eb",
+    "308e0266645cf91d689a1e38efa5cac58a46ea1440b2d3999fff928de2514afa70397188cdb2f9d4dae9d57314cdcec2f903e9816c3d7d8f4217fab1fe6055cffd28e8b2be284ff69c71bfcfc5c12021df73469ab4607cdc5987e0f04ee4f67a1f0",
+    "279b98fc949f1661d1feb92834e18e357816e2d7127e1618390759324249f877008861d0a458f30f45d6ad43ba9d85459a5f45851767ce50ef8f54bb54c2e3ef1058bc80b7ca94149a3e7c5c3af792bbaed41948cd09ad372b0e2d8c01a4807ecd1bbb33e8234c2cd80a04bca6f461798f97bffc63d097aab42e337921f5be3d",
+    "ccb747d55e721fcbe9c344349cb39e171a3be7df358ba5f8e56fa607157c90ff3c150c323ebfcf2c3d731e8b57dcfcc62d5e5699315fdd4f8a48322b9580919a462df7114ddd9f25b8e77557816a96f41bfbb3e7cbd77614db06bfa402ff0a6cfcc711280c516e8c434e4d51098f746cecfcbc3957805a8c4a10df1ac4199e5a",
+    "8128577a29c082602406188e6857be76e9ce3c880226811fd92106e3ca1a45649a00c767c34365eab6e8c85186a3fc5946cb6e6403f56d17f3b16284930e89d4f190b03070f1f0a4c0bb398d5a14865f3227f1bfbc2802a48cbcb1eff95287c5eaba7069af494b79718fa22bd9ed5416cc30e9b50012df9937f7ac8663f8726d",
+    "15b39e882a480db0eb14944a5205df18d3e36bce4274ed1e0cc3bc442ad34ab7cb52f928de260eb11b163307dcefaca7fff65460f3b1a3753a8f379a6e9556ea377154c7459fdf5ce09713c9c46485557bc66159127906cc69dc5a772704ab888",
+    "3a9fa9fc09589474187e0097e93a2bf0fb1cfb4ae03601474af05a4998e221240068270f0d53560d35a893466ca378c8ad0322e9b1fd5bdd9829d71117af140d027fa2a14a91345c832557be0a8fc508df986bb7d2d14cbae7e85e039b2be8d92dcad832a789e486f5fdadede937f9101235f8c9fc73f1701cf619681fe551a3",
+    "6850846551afcd489ced88419ba28726d51ab547fffda3dd8b5574b3ef09d280f6a8e37ef7f7287978e52df33ac3c3b8458e82cd5035f79848626a50cf375b24023446357f896b5884363cdb663753c5d85b608d3c150ac78e2d3b9edb4bb2ca0131b284dc49ca9c4dd3acebcbd3c528a991bee06c7f30e8de4453be1824dd20",
+    "01a5df241e40c023d7a46165d741836479c750b98c5ae85a03bb75f674eb51cfdd30e011d89b564bedb7c5106b9462ef1c102b379582f9e6f76af1c591bd51477a3caee8199176737bee0f89882c9f0eceab225d711f8cccb4b3057f8f1ea99574bf3579c15499be5b7c6271494a2525aeb1b7a79430436fbd39f05449cf2327",
+    "121d5acaa899ecab520df1d92d121e6d6856c323f17bbd689146ec3094c0912c1180d2e44c4f90453f07f591c5056e62fe64297dd640c7e007c473db0d6940f2c3fd2c807d135cdb0dc655b62cb8dfdab07299f271a6db2bbe740262bac9081f1",
+    "bf6e508ec54b030906385e3572549fe0f6fe506dd1e48bd9a1612e56d3b5b3363756f2f2edd43d4bec74952483df1a98dc1dcc65b0f8363cdbc5d2059ece2745f6505790a701f9127829a2c630810286c5779ca88e2d44dad2e9143eec591487a1bd8ca560555a02d609499aa284506f651e7be9ddac0108c54336a81cd4798d",
+    "2c14a8269590ea5e28d050e52ed80333a3fa37dbc1c3fa327cf4a8b5f8b71e47cb732808e2dfa1b599730decde25f3db21b454b0344243651d45366b65c0ab1353a4b921a7d1f23ca2460003fd8e24b6f6cde243b848c4213b1ae78ecfc396091434f8179f26379eaad8d55dc2a3be3407be6c452fa270ea9ca0c2e1507727a6",
+    "b7ae3a3e991aa42aab3fe8faffb2745c6f41c3d2ca900406384728d91cdaf53e875668741fbc519e4f4a8b5b72ac06a06d9d41f6dbc0871a4f6a5574ce9809b98373c9406a8d9c9640edf952d00966823785d5b5730fbcebc5ba12725984f7a83783809f24a8a6e198b09f444bcd26ce5b17730a9e2661a3402485df9c7a9e09",
+    "d825d623620f32a608fca2f3c31a6c20cdf413348b7dd1ec50eb5448249e46c263c0d8b10d95e3ebfb8b25faef97e3276fe99ea19db63c13e6e1cade7962ceb4f11ed2535bd88e6cbdbef089a3e8af6af917a4809492948157d08190797a9c6",
+    "beeb742c834d2d34dbcd647c0f89a8f1dce03cba74c8fa8f8e4d5ffa58aba95a6190bd041c8b389147ae80437348c4309c34e85b9feda50973ef624a41e4213d2a4f7eec72ef9f400abd878b3046e111d6fac20f80b45dd27a39283b7ba9e71b0d6d6ac6b2e85e7ad6fad40c81fc0a5c13b91a99b0d386a5b0c5c096f95c3a33",
+    "7bc62181a1986884d4b1a434aa0aec251aca65b30401364cba016eb5c622cc63995b4b602e1ddd4c9157ab5936cdcefd4d87bf90a09227c50888a1ecc6ef524f4b5775855b64de2dbedbc53d3dd9400d8eb8a93b54f6638e9fbcc75f4607000c7665473946a26b00b8928302ac6f872beba720644a21d1cb9950501374c5e0f0",
+    "f9693e1d7760bd3f328713e3c916ffb25e9627fc90c24c74e04031fdca52eae826384a759d898ef8398923b814dc9408fdad8087ea1ecac4cd4d05081610829a0e64a05755fd005b6d62c4c40f899181ffba58507edac32c2e7ce4bb869e27f3b4312f44f2b490d54067f802cba35b1efb29a3bc74116d116ea0ff3978db82ab",
+    "9dbeb35906c258ce2e1f9161da125dfb45adc4d503df8d6419c2f56e0dbc32cf74697af326bd12c7d9bfba0ae0e4371f099a691bcb2573000b05bb9042195f70ddf87b9a5075a3d0ac0671bca8bd5c737f5ecbd62902e21874c5f0be86ab38",
+    "529bfbe4a3d090012638c92cf199def992ead451ea64709497ee277b864a3e605a0f9de99d0483721807358f85d9cf0f08a7afe5f97136a1d85ea2a289c18e44a04ed99d45ed1660e1291a37442bf94ae39cdfe9b189bdc6cbdf7b37cf501ea295ba626a84703010c24c0c6950159a70498a3a5a1c94a9af7445ca60effae830",
+    "8a8c07c857544c1e09996d9ce7e30cc63c744619b5443641244b473748a5b470f81d89366387cb2f75a5280dfbe6db0177b221afb68bbd984f92e9158a4afcc2fb12549887c6c118a3ba629d4d634f0d3cf38dd84465b2ae7e0ea0b745399eecc621352f90c5fa6dc870dc4f5fc032ffa46b2f6b5e89d822c219cda2ddee222b",
+    "86a85e0974a683f736b9dc10fb86d41c35aee745b4270c604e415f1e7e71a570d0f18a7e9ff3b112617f279a8f64c58134731e7bd1c812129c01d6b52fec69c33e178ed149c96e976b977bb7981c034119c775f0984aa2a6c4d09d8995d1ca9c35621982192f21ba77f3450ac1fe1d4cdb26e254bf19d4256aec40dd3516355f",
+    "8e7e8c43ff386a6f73302f85e7ae833fa4d5e97b8533bc393359db9d21f1d0b177977769dda81ce86072d800c4795568a59126c30c7bf813551c2920f66b7f295e023399aac953767f8696585951094d2f9a93c8685a7b76e29661c6a2138",
+    "074d4e7781634fef9a7a125ce9e020ae2fd8fe47dac9f8aa1ef0a9e7ab8905e519fed3d8383e1969b3fa036a52918f039a660a265d50ab030336a2a4488fce8785c6721eb63f79200271bd7f6e0cd066f772750fd2224d8f5d595e0682861e65e76c4e83582af8df44c112f161f2c06c3c25a8877c67bd925dd587ae37833525",
+    "1a05b265795338c9c4283378405262028558c6bb70b61f9d5fc012096557061c43d560d792ba61dc8b28d8916c353dccf965f1d64bdc46f57d95544a556f849353f62227827f628bfb44989973e5c6d12fe11d1d3b4a2e62e4ec43c647a002d244547515a2a324dc2bacaf47c3a25bf6822a94a7177d83749bbb00ae6d4beeda",
+    "686cde15de3a14cc22f8ba18dd65812a4a280a59273e7082cd71aa58f21304b2bcfd69a54ffc8b1700cca4e4d197128de84db7753552d6edb56abe632b53b1a849bd18e4283f08d9651f4cee5dbb3480197deb98f242fb0b59f6327fd71d158575ef9bd8cb8384d104b30175e8bc75bdd497cb9fa733668021c56585b2df070b",
+    "900b210f0e55c5598a978309b56402e3477a6c1ecb281b734cced297b61f1de95ba00fcdcfe0b28f8518235b74e36f6390284c3b396fd0a30bff6d1f281eff11161a0384304095b1a321876f5e04b492ca88e98e6e6f4b1ffef1ab6d0f5",
+    "aada1aecb4366fdffcf18258751307ba11d65ff949d3e291a064d6a6664ee19724fde9bd721d96d26e72983acd36549bf5bfcb47c68335ce337d82cb8344d57808b65ed577f29d6503feddbdeb1da40e10b34019245da5f9506dd0441f7028eac7d19f8d7fdc18c256305af714338040697f95be829ae0e3e2eda9491a0a4e39",
+    "2a82e33c258c87ae1d410283e9a67ed8e15f2059ccdc5922f5edafbcbd8b857adbd5a13d11db7039f36d0043025934e7f9b10c01fa38d004e721dfeef6f871d1dd46aaad634aafc19ac647578c7235521f46c4405e0126e06163045a8c0528d3e1a928c2fe866158835a6f61bbaf46d8c922d2382b2f33c3d681bf6f1201b418",
+    "ee32f9a2c7cc3bb45cf31032d8cf1eb13513420fdc4bacc6f9b339ff04cc9f7c6ad5eb9ab51f1b897ac3b35ebbe5a318b6c5f167b7e208c970334bf3f2a15c98b8ff3e1fbcaf9cdf3fc70a4438cdd62265d2533c6e30c189a411712edd5e991a037a90e330c86e70dd92bcaa16abf79a92fac484053e209db9dc4a9c710f7605",
+    "125de72e470e0cac079125cc418af77bcdbd22ea6c4415131552628b6ff6d14b086a2b8c11101548d259246a0210f467dbf5f2429050fa58445d8848c6392d41491f055e8f3d78d6e41d14a7f173a2abb26cb76899081a761c840cc7494",
+    "6318a17984e501d2fafaaf4cada932ac744aeb7a2eef706e5a1f176ccc5f2b771f8f5e4d94c6441f00c818ffb64e8f5481bea1b99bed824373ede9d6c62a46f5890d8a51faff07382d7c57a5751a8610ff80ede43451f138c6b32dce0bfa0199339502c6af0a623506eee1bc6da4d8c4cadb914df8e4357aab4d0279f8ffbc31",
+    "d6deb9f8ae64d54441f9fb42a7215434dc4b58223942a9ad4613d6a4230bbe2ce3bf5468121ee06fed97084cd63cbceb821ed77757ef9e760c90448f04ed22bf2de54819fa998920b3f9775f0d1580f380f0cfc4ad751aff6e04fa4baeb146c69b3250dda57a4a047e9b7f9b6e4d6799019e4c9a013ebd2d27a43c06f5ec8117",
+    "84476ba9d1b4e26f76c7f4dac0ad655f6c6482926149aae6ae27f73f9864a5d40776b7125fcedff9d930af4f9731a3840e5125700898a588fec51fdb8fa2b80ca5c41dd77ad4d1c5c5e0baba35f8035a4e5c0df246b6f52c12267eca54853d7a7d35dce41f977dd8d316521dcb0ab00a129d5d98f579030c5b8d26a4ec2d8c2f",
+    "a990038033327990d0614ee3a8f6a3434d5af47730bb32d9c5b2fa0084a0be7e25e3208f5a39b742ea47600f62d58e0209c5d1487332dcee7a0e053763cc4aa098434f283d12f37124e9da5e95b86ee327e16eb82b5c649ee3100cb66",
+    "5f1aa60b2294e2162c037243b359cbfda731fa95ff3e937dfa1efd919256df52caa06a9ca2004fe17c77790ab219061b8ea57a8e65cbb8bd34cc34f563591cb502ea8e454669238abd8c97f5134403fba27fc00bb76d3be9fa7eb6f6eb32e3832abb5c50a28cd0ac207802259e4bb5154cf5fb885d5753bc461b00aee4798de8",
+    "57ea8bb1dbd364cc64fe43738254794fb08a24b31fdd14ab92a2b9512e897fbd6ed94ea340503dfe24c0c8026714665f55ac98f59ee8214f71e26b27b4d4b6e8ae7b398a842293d025b3fd1d5eab813a91a1d7c7fb7947a623fef9839fdb8b91a4d6ea0a3b434fca593199ea3f7a93503b68478f657f780b0b16ecf6ee1359a6",
+    "a3cb5030c9271659b176573e9d115b997806abffc82d2dcd301aad3fd57704c05b5a551ae4f0d98e7179524bb480a0ff715c4c6c690a2ea1724d416198d3d837235f96a71431ce308a5c1ddc3fa0acf9d7f0937a9288818de535955f4685c6e3982e4ae1eca019423507eae389e72e5507696d3ee8635681bdd0bf66c38ba1c7",
+    "1b41fd924a5cc6d796dfa7f373738d0d063d8f5f2023829c963429e3f177c6e89aa1973170a782ef78d16c791e6054d51f688a8836e0aeb777d7fabd7f82856c59f12c9783747e40cf0297bab19d34b63557a871e470b2c83cb15b9c4",
+    "74eef7f9504f5083b359d82eb6a36f0f246c70ca9d5f08567cfd32e3be97be22d84e828659e520c1958e3b7cc91d900401119b0831547fdf3bd629421af4bc2d4535cb2792aeed043ba8ff35c09d9801e20b1cf394bf2b28b9ab65e222e12ac72b29ed6e29decd0f5e16dd17bfa40bee48fd11aad0f5213f3e80595888acddb8",
+    "33c46b874cd00ef5b34f757c184fad4d97861c13213baeeed4e7d4eb6661d135240c3f0b1413164bc8a43c4aa8173f738a8c5b781be0ad9f0263b21af9a3a3426f889da08ae2f2f8e5c98c70c5c101659fcb2a8a59a31682dc7a8b7d72d9aacfc9ac7fc14934ba4b9e61c78ece5453d91c95184f3f53d695e5800066a712e693",
+    "af431cde713671aa3b749500cf7dc4b928252f7a54f0e69660a24411b1ede07e08d324da549fb3cee314ac60a73d7ca311b9143fd36232bc2f0a51d20373bb14513a0492042a3e8936a2f42fd4ebe05d5d90d6702e2953fdc715ec4477cb9a5560a37f9a9ba0505305878ab853a73ca54de48af8a87be8f06914207bcd5ff5bf",
+    "154a911ee57e2ecf2d522a905cf14012379b62a50962fb4d7275b54fc8df87ef97dce442679fe17cee86c43ac2f9f06c6d5b07675881f34c0fb388f5a25501a3d041c34aa6cbc71e115d7b2b8b9a50147f90bfbe3786f9fa70c981a",
+    "8b22b165f9d81917d653c64583e20d63c595dc397bce904139ba7da6515a8546f32c179d7ff5ad3c93eeda89c9ddafbc9a31adfc55010464d240ea70eb4b3689e5d20e0f7a772ee089a17a36efcf6ca6a8f9ce032a5b67e95c8929a4b34b7ca1eba6e84cc1af362b16772f2d8686bb6ca4bba73a74f4eb91d5208cdf7ff76595",
+    "429f311a20a5b627dd247be46ffad950a73d6eb291444e7510b06fa4bf3cefc59b095bf4bb6bdd498a609be60b4188aa0bc41d53d2e8deec31e89917adfcf4117be2f8a10b871104457cde52f569605541a18079a17c3df3324954a992dcdcf84febcc9ad86e9136659f1178491e3656707238456e70763f92fd928d14699113",
+    "4eca93c3f10f399bdb73e9b94019460242de2670c0df748153e8168697bccfa6ca1e7182d9c0803b385721d62b7bd4b267d49f7515d0790cf3ba71524127cfed5911030c9d4fb69fcf025930c80fe48fc0f8356509aaa7455a041ef5861173177e5983b255bf0d375a4b22893df45e88bcc6fede503bd053440c00cced833753",
+    "2b9a982ced2374584adab666a66d931b4293cea191882310e87d1bcbd26e4da7747e8a91b679fec22098dd1c45e605015c8aac54090df78bb7183f40c9312131ff6c428f059a98b43de667bbd30b328c88c34be1aaac2facff2a6",
+    "4acb082c82866462db3ac36a7f77786ec7bb482eed9ed9e88d53677c1d566057ee94e0e6b6ea6935ddeb67c988d4f93edb20e49776afe6943860ac14d03e919b8236bc9958d6f177c4e1122bc4748d0d36448a7834d16d6cac75ad35ce582b3415233607baeb1eb69542a36646790ab0235602318f52062809bc0e3783d952cd",
+    "af93e1500ab81fa59aa4ee5e54c384d9002ffd421a1b18408ab7d091df029353dd3e926dfb222317277740a0e22a5ee0e4f9d207e0faf13584f7375c242b39c05911eacdbfdfbb07032ff83da9b18943bc091b6ee419f6052fafedbb570a833b69af0cbbd86231ef6dab2a7900bab628361a080eb4f9c176be3204eec67638c5",
+    "e42cfbe387253c99e0c3c9d2bad2dc47516a6b2ca6c8cf752efcfcf62bc5103a9c4f3447a93d60c2270deb7b9f212bb3e5c652754471ef472b025d70d00f477171acc15e3a868da24e6c577dc116c48ad9fafb03db8e6acf507a374c57a6daf004ef6ca2e14904abb28545900e8cf94b2b12d76719ef975bbd36926342bbedc9",
+    "1b84fd720bc234ae6b4744a9de4a8ac89d46c2569b8582d54b9212761c0ef8428c8ea97e6827339b42f93fb4bc48a47f3bb2aef1e2351bdbdf4804586a5f2bfadd85e60d70a4f97fa4e6bc97a3176104cd006c7ebc55656d77639",
+    "81f4d904cbc4a14ab8dadd55c300a3d00d3d402a3735090eb873d99e37b071177f063b88f8d6789cf28a7d2716ec588bbdb22af06402333202df9565779bface6a816cc45f9d8c2ae2a8a3c533a2ea2545cc618af1df6e1bdfc94482f24a56065e627860dc8a6d3c27b002192a48e27756d02e42397ff37f739f5a8044632466",
+    "8628a75b5a56fa8c277d6e5b389ae0eca0280428920035788ea593a2bd8624c39444eef0e4677430243d90b1badc9a8f30bbc9edec2b610c564b342acaf91da46c20df1f04ee89836591f674d96ff0593532940672659c5348123ef5b48a5c811c601744e1c60f8d88bcf524178726dafee8aed5e58a1abe625125246de5298a",
+    "d44bc365968c3536637d262d1d432ed43cea470192457bc0cf395d57b0847d2d9f833c1b827aa15a96b67b289c3d07ed24005f903448080cc0af07597285836d3f064f0358a9cce5db24e3848b49bc5120e9c0bfcc42cadaa16a0b2b1ff08d988b48a1a7820deb64baabb9c27f2dd7babb519602e00199736bc30b7d057b0cf3",
+    "1ac0a489a71f155c2ef2efd4bc216f31237d3b1d04ced91142fed543d9c24bfd1d7104ef90b932f9aa7ae71cff2499043da5081f0bfd96759cc8505ab123991b973b9b97f3302a47fd5b714354f0ae68514dcb0cd15ba67ed1a8",
+    "9889459cdcfe42e6bce33f104523ffa67e4b062d8746e8ceeea9b080abdf952dedc8653a905ebb06f662378cc7364eaa0e8eb47defd21822563644c20d0252cabbc14062ce57c7d13d11c517199978cba6069931f5dcab79f6b226d962323acfc9976cc29b91105f2e653bbceee5e68454d2a346a15f945f5fbb1529b83c9622",
+    "27ebb5ce73f454415398a82e833ab4b0a591c8a3cade7aab39825e4e607bfa79eadd2e56985252d3953fd1f1938aaf85df5a838711c2efce0dca4c19553a3714767f917bd55a3c700422957359bccad52e0d2d41c6f815b2dc5edd1d38e2dae2c99fb325c0a886ae26a878f4805b9e0dc73134e5b17600ca99534668cc1a201f",
+    "21b23e8aa0e1b2c7f1819b0883181c35f21ddac42bb63d55c823ba7c48e01018b36aea513ae9f706ce745f43f8dc680e46c44a0866a21a785dca7d757dd65acc1c5eb0bd6f7a445e64d9eb8c77527de7229a327998db0a66e24822c083389856f2374d2e02bbac9ea1a4f7306ddc839888af219199baa02c4d393b760a799d5b",
+    "1ef489f6e88a4fe23d7625c4c8930606c1e838ad13aff577518f19518c1d43f46c81cadb7d015ce0a27cc44658aa4ba890423abcd1cc9b92556e358622b34a8f984cc76da8b728311149c89d55e75edd78fb2b963eb510322d3",
+    "68e69bfe6070f8257557103ae1e002e14b5ac2e16f267fbe0e457d3d56302e8dfac2f187b414d267de0bcc241ee178d9484b1fc44adaf40e80c3a209eaf23194359fb713ab33748a6347529e4a2d253cf6bc296ad9123e298389542bdb0611baa0417c68aec5a2f0ebce41811aa785e33aec27a7505391e7163ab69b065d54c8",
+    "f1532668d2b425d8ae14bfab5f86992c1b0458c6b5ff495298658f09ad6b8de59fb5df04a52521304cd2ab41d26f4a03fca902c17c94dda1185f1fe3d9f6e64f02c683dd7ba6926e4165f83d7298c0602ed246fee2edc3a922305bb0d09423dc4dda2f4d7e6d0af245565d836b4a465c35ec5d17d23345c3478c3f3d37a29dc4",
+    "48ada250d437ee8fad8568118100993df6ba2f53ca36c53edb29128d98e5b455810c0ee7a439b1b39d896065d2733bd69a998cc0a50b07111f6e5d8259d46c6e03249306a30e700a7ff56b3128eb01a53dd3d6be6bd72c8de14d1641ab5ab10592631b2df2e310e01a907b4d49a314e8df0b628241b1fe938c839f9cff7b7191",
+    "151b4d0037f8e0c2d71c68e30703d85cb08c2ef76e41cf534d6045118e28aa77e817b0c6a2cac4b19f249ab6681a15ece15f91ceef50cec76e6f87450e531bbd66bd24e3e8140c5294997ebcc59b0bcc6a6be88eceae4b67e",
+    "d6d27206dc0baa1eeb766a36c67cb7148dcb4e5179470d2123879efb1aad59533decd13e5bb56f51a5afc5c2a9d9d006c1e6410877d29e0a1526e6b84be6885e07b6b493eedd9b7088601c135a3013d654fe9b3bbb07bc6c41f5ca31cf7ce4c2fe0ec4e297175dc36cf8988137514e809ec242947176a844ea4a41b9ef5817ef",
+    "75c7ae3456320b6bb0cbd0a4a5ebdadfdbd26541416551132528504d5f4d0d401e72c6699aa746a8e2bbd5310f4c84f518ca5f7ff1f16cf901ac312009425814399aa0991f138af1bee3826f7c7c02c0cb4c3a3f1e154882a7a21f73ab736941c134c92c9b6542caf72922ba8421e31b4536e803da462f348b357ad78a47579f",
+    "bdba96d715ff84f74445c7afa2d6485223772a5797c1ac746bdbbb1dc8c2570919fac5b598bfbf18ca4c9db1921774acdec2a6a71ed3a8614dff7a4e7fe5ab958fcc48711a51982d3f4f242bb6ec40b9a002c51367e2eaba929020611007e8f4c6724bea048d19f22a2515b9b6a0eb42967d835b7e7bc891ab4edf2df83ff827",
+    "2759b5de5d001cd2a5a65e93b4a23fe4de6cab42de3a1f313256e46be1f026c1034e3cfc236bbada012061c81bae18d8ec5b7cc9954a6a364044cc3e4565d66b42355605b3f031b839797727be69438389e784073811cea",
+    "6c3546a4eea80cff7094a2c51315d44cf08b9fcfaeef81107330d6c8b113f4b1bec15570ac7c9428ba85bbfedc57c3da57a660cea704e0a6fd5334403a71b6cc09dea3e0bd417d142d813fe3be2ec1314c07ba777c3ab7917955bd59195b338bf5f4f796df76c46e607c93891950a54b1da176fe15f7acc10d601223b0a13921",
+    "b0d5e019a0a353c65e0a4dfbe70257d3c66775798cd6929c0235e8f33152d19326259f1ca6ba454b5d0b1a9f795582350d7ef1ab08c5c1248f44aa1e21024eae7f637ed96bebf386933c430dc97a8fa3af02b2774f8ad974f2f2c1265acbdffdde9f5f928e776a60435eedc53cb448b40d4415fe1804cc55dc2b8326b7a1b0ec",
+    "65cc5c83266252684d2353c42808f1ca4a11a4a2d33ca0ed5cd9818932075e275792e0321d76a3d03d4abc4504cb9685a5b2770145b3a96aeb92a629194e4d83249cb4d1c863e26d46a3e9e6131a916646ab1e7367edf934121a25771ab71f64341c84df624b6d1db1aac145a5f2f5fec43d6f95734779be91e361f125ef5ff5",
+    "203b934bb439a86c6cdc8c21d7867ac0558c55278cdab8c608ea6fc0264819d5b8ea88aad0b197ff0546c70127546801e588c7609769155120203449290132b52c01618f6e08f442c6cc100aee7d5bd6b5e036473d16ffa",
+    "f231e159aae23117e8c81c01d53c5d6fec987efd0e2bbbc7e36d01f78583f7edd012037962a4a32f68ea25e59346fea8dd0ee137e9ee8b4dec3d740330742e2b84b319869588587b253afd68622b3f64dc0be419cb75d0cfa25e762e121a51603de4bc2cd521f5bea094ac2862ddc6735245c0f6a1dc56bb01237ea440836034",
+    "17c614570df08dae8a757f5334b856baa5ee4ba6f78fc4b61a4c8c78a80b5a3a8960a3728fb7f5d1816d5855f6aa42e055238545292ce655fee8d0914f5ecf9337d837e090dd9e9041b44c92cdc875135fe67100b24d06301d2b3317b4652198cfa40661a125e016a54698cbc3ccfe02b6ffdc5eaa8c4ff40553bb71df5e37ed",
+    "5b4a1eafff00911b13c6b7eb5f8e370de7d529ed446e87e3bbf01413e103c7a4c31cc5206e8ab25f00d25789eed9f7f1ae13c214aaab855916825f737e6ab8a09c1a2ce7b9984de0d035352cc05b0dfdfcc14f3a796d1bdbccbb412481c81e5dcbdaa50049b4ec50fbc7ed783b0439f75bdc0daccf16ddeb3d29e3d247de2165",
+    "37528f8eec7cb8cf9c0d603594a50b6a1456aeeb90d42dd27dd89c2b1b1f80f7790c43afcad8b6f465dd6f3491f0a488f0d3745ad5e5f925392a8b0d595cb42567a58f4dd50051507e7febd349ec93dc70ad4bded48352",
+    "2ce6372cdbcfa0f756b9d71ea8b8764817fa02260a00e24dc71d8977c162592be8ea5545b80f7fe2d24610212a90d4ff6476f1fd3bc934f8f8a46ccb107b76711012ba1ef86e317e7ef54e18bb33ec1975c13da7e42a083bf66c2e010f9d4fbad5821143d0f8857e7e37e1c2e209763c2dffa9a502d26eaa0acdabffd801fbd2",
+    "f07432430840c3a6e04b8631ab674eda10a8b352e24834df4a4278605ff57de9f9f1e0a01bce371b6472d511c0e1d3298851de929969e29400a789262f63830dc1c6f7e4a90c5f764eb04f83f1457eb3767247d950a571c1879cbdc60eb6262be4b6563c3ed39b4055720096d4ee8d409228fc850f5a8772e7980957aab2d130",
+    "c89ddbcb6b1171c6e2f1f63f1cd327fb971ee200b72be2b1a03b9eb69d15826cbf408a6a2605b02415777045361b74c66f5309c7858a9f7243c8ce23c2a7d1ec8fabcada50cd65505634a866b1853a8484a7a421690ee2966118b471ea71098074c5723a247206754b4cac5d1ef297cf4a8de38d00365ba9836ca00f69ab22b1",
+    "ea68b42232fc4ecb0cdba2d41eafb19721d20f63fdd118fb3e07dcc89e773b5a7d8918dd94aa288e4973aed2570ee6dfff4cfde7c9bbfb3ffcebab835b0e2bdc9821651d611a770dd0da47a391d01327c4cd4b776217",
+    "89790160eb50d9209aba9e1f72692e08e4de2f9403e136e464dd0876e36d27cbbe4ad8710d98257d00c4cdc0592e59c639e8da01f60eaf011fcdaa7c058b74d00138057d1b80aab3148a7a440cca140621a0b95aa97119c13064848123931d0f8bd6701283f35ad50d5aeddcd018f20ea1f77f35ef60f34e5bb7b3c7d5605265",
+    "5182d75a31b8f32663dbac54986da51c63cc53095cad969569761a32062cd80bc2c86198214cdc593213f285f63f2231339a6192d08126dc072c3eaae9f71c59d3616bcee7db8d9b16489fb09793014d588d623d21a4aaeb970f10c6a4f4ddaa5bebc96012fb1d09bbabc60cb5719728074089bc7fe6b5c734080654d79342d6",
+    "fa1232dc9f0cc28dcca60bb25bcda02622866af9adcdb980c5d0ae3fa3b60f015c6e1b6c398847a0bdb7da0d4d183c7afad2f50e32d99d4e845bbb151d487bcad1cd43e794ac5114139d021994e00c1090e629d0cafc8b6233538468063dae0371f519c60391fe6d5e21279a301226fd70df552c1034a33a8e3aab5b73e28e93",
+    "46a8d9b65344f88e72af541a659bd9f3a645a1d7c3a9077a6dd17a324f5f23765249fd6136beb22a191615fc347ebd89d1dc2d0f37511b8d9b5681406ecc18f33710507fc1206b82cdfd104c9318437bcbf2ffa6793",
+    "85103e7933333360b5895c85e1d0214856fd5f63905b340429b53af7ae79e4da3362437e9b8989bf6f9f599676c7fabcea81e89800a23339cebdd2d13cbaff1626844ca9bfdfa406c33ec0d96c22e6dd46cdbb836c4d372fafda5ca81def29d07a8b21d237f2980f90f944f88648d57a4f663b3da28d17c7c1107edbe5b6f219",
+    "9d025505a87e9018416eb7a24d8c9151098f3105ee966592bd11d6f1e2c7d91b2a58c4cfbbd69b5fe5f79beb11b538c7f9c3cc63e316099de0092c599119048c84ca3d032a11659d4bbb8bdfee7df41955f1be5d659d868fffb581c684fcde8f7e5021f57b2458cce6758bae4bd1cb4602a39b92c3bfe2a68175fbe977b9f00a",
+    "30c13445e50a89c5af811bf67f60f66a06e2721647e4316cf226ce21606edc36a9a297afc49c18a5b0346938e3e0dd1c606fc09c9fc893758e9a01da818955cea7e410f5c84b33fe7c15d0312cae643f5ce6eda3954f619a25504355023b72492587e6eeee97acffbc233ef4728c3660eff85096132cfb315785e53ce0d2c8ab",
+    "13cb403f92e9cd268f7aa50305a8f428e6f1f871046f91466463c3eb6d7726c7e21216ac5feb9f480f5bb78e5825cd3b90851e974ba482ffc47fa09a7d0cb27d43bfbf8fa45a662fc1a320447bd8114d59cace6450",
+    "ad6bf37bc500a983c5ee5a9a53967bf270896b3bd3ae4a7a5fbc3bb50ded6b3303ce9d86f20951972687cfe688a77f70517b8678c61d8dfde5dcf7a8693808f56566a728c6fd6200d28b1997fda46f027d80eb12b80a111ced7bf42b896b71dca02a0187e54f939014ab03c5cca0e44b078492e3f479983cf78d73669559d280",
+    "8383b3ffaf727f3466004b7435467c5ba77772aa11ce782d9670388f7e409c355c52211ebcf8f01ed4b70b5a0379244f83e56ca818bbdff198cbd00db0442f787c9471db85eabf0e1946063fc45ca19296cf07b359fa3594876e760628900c8828fcd4a1433041556d7da9ea5d5d626773db248f7b2a7242fcf9f68222f58e5a",
+    "7eb8d6af27d162c1f8e5b5eaa8d82baea6dcca15bee696799521d806afd28b259cd8397b02cf0091bac827b2b1bc1164576f920d0da0c11ddcd5b9367f44e8295b91dde355119722f41328dc723154a49c3d8a242171d1c16b7414d812979bc54be86e08d3c6377219cbbb9c5a515ce5ef4efe3c3f082ac8385b87f939498df9",
+    "f34d8801f207691fe7a7f105057252a35108ba7d0042eb1e9ec122f29878c5dc267a1916f284e0808ef98591f96b7bc4386af20e5c7f3a871a003ebc95b802a87b0ebb07753bcc1ee84a7365aaf18d53a51c8d22",
+    "9ce775368c7ddcc9d53797ca0e5fef9ddd60180bcaf642d240b70336b85f1ed8cb2ccd7259170a91313bfa92e503800d1f1b9948469082611174ccf5d55d00e67b02b9acb5decd200975e308030b413db8c79819108f93ad380a05049f6d1d2758168d22ba684379dd59eeb9aa953e2dc0a584a54476e3543e6ed7403424267a",
+    "7488c8708ae1cb8bb733792b1aa8b337b896ba82ed6adc9afa81df15d82bfa26bab323fc872c2b87b299c30fc9c5f4fbd5d62609c38caa09aaa9095883a39371e9b1137aecb57460091bca03e0c61a3524fc8089e64e9d3690cd9d57792d7c489a77d35aa463fca3f2365a46d0c997b06ccb9c524c39d2e693b2aa364574afee",
+    "08cea682fbbec9bdf07e4beafd2590d96e04f97d874ce2fcad29bc594c3c414be7fe1b52c51f5553d70a11632fa6cdc69a3f93d93789caeb2539a9bf88e5a650bf5497b5a8fc9dad3701c4d95ef271a55c1b636e5416842fedb2f3ccbe114e6720bb2ed884e1d600ddecfe66d61ba3ed889c112bf83e31ca32dddb859512834b",
+    "17c295d9a6e5106dd1ab9161ab7a9136497419f7f136d5e3a322caa8fa362b985f271a4c2301723d99d672b05dfb41eec1b036c4cfc875affbd490bfe57fe5b6df99bfbf65c30645c3b2095cf3f60075c3ea314d",
+    "29e1071dbe648037fc1ecf08f9bc0a84738fc1670efe0d73c4811fc3bb6b0c0caa3eb3c0183eb1347b9c23619d82088778b6f5aef0e929db89b4c2e082822b54e255988e94ca4513dcdad061537490342988f07f3e958676f368f907a55affd9d03ab8e515724decea38728668d55f040303dc1f1a6e051c695c4499d5eae91f",
+    "50b404a0879350a2799b994b24aa2581a4b2c2dbad5877e5ec16a547cf636608828cc2b1b523dd17e52e18db08ef09031a1917d676e76a5e821ec3a6175951a13989b98bfbd0d1dc79fbd544f0704ecab53b548ca48923c106ec7fcd2c1e6dbceea3fbd3ab8915dd4e1e60be87e29426741addbaf33cf4f8c5d8e0f95742d84a",
+    "fbaf4e49d4f2808a65016aa17dd064fd69b654157a536ca39219f0d239ae7b4885db7401b94f2d820f62ee98d771a3ff8cdb3cb1d13fdbf6f84a7d8acade83b3e77bdaf55eb925e481dc458ecf2b6df12fce6e1285cdf8e27170529f8285f0047c9b3da8e8f2a132aa0ca28f461578e275a8c2bf7b76c2f0230b410046809565",
+    "17674df2dfc8fb544e46b0d0cc61889b0426fa1d4cbbebdb819ba96d913534f6d53be941bdf2e32ca6a4f867df9ce8d0302331d9e96b64e6afc4a2594705d97f58f978acdb368c20c79f72cea433354e0497900",
+    "05761ddd80b476288ab1a01fc5f1e858d7a36fc15757362e634c56036e355c13b4bd905bad9a85a9cd3e431b2c705d10b78a9916223b7e2af0d226eb2199feca089472bf1ca13d1dad3e32a415a0f085ac1d229f8ae1fa8273a7fa22acef6451fdc71d367fbe786479f1336ca5c6343750e5c3a4004aa04d314498eebdb06423",
+    "a2ce3ef72cd3721a36cbfb44ca560d954d70191d9063bc17893d21e420951d73acc454efe54358f18dda333c1e917c99b5298e9296247b9c318f1b53823bc6999bc1b7851a7cf08b4bd7ef4d62d532ef60118ec43731a21bf41194dcfc48cde2abd991162679d2b4df72f89230e95b4d07945f42f3bb53427be8e0483048bcb7",
+    "7da3af241411d014298633bca48a935e7e8f9d70da909af55b847a7333c3b843d27a470922700a570c9250ae429bdc7c6b4cbe705d23bb38a7141070d9e757668201c291133336f5d2b29d215c4f9684315e889db7e3faf9adb3809376d1cc34acabb1e35d0a43d04cc31992d090edffdc87bfd860b9e0d3ad830257a3f3dcfd",
+    "65a2d10f37076fbcda4bace8ec71b23de928c6af78edf91d8725cc053eb1260011b057251863aa6278cc18c436a709da81068e105d7c36e8f3520a20cbd7b581e9b03c6bf009582a83dc255b4310e6f4e8c6a",
+    "b7f15313b07f1bb5c0ced2305d1e4f80576a1d342d28f5fe2b2004063d253c80cd33c4c7a0130b78fee95826188432bbc18e3e0aa92c0a446029494dfce931350ccf540e6f506492e46ae6ecc2717cd460ed30e5c25327201c67fc0dc2411993d452379301a73b03fcdfb737cd036f007a52d374fa279dc72080f0811f8f7bfc",
+    "b37bab591edbc90b1261d0a63f579aba2b2b7eca7a70c99e7553ef8082d398fc1dc1485b49acce7304ba532953f4d9cd7b0d9e0b71abe2731dc1c5ee2503f362bbd4d11d33423b3226221ca662b229fd8a50a14c87f76dcae10c9fa62eba31e27e470580da451b52c416863d9d74f464dc10313d3a62dc735d0ef32e1e50d593",
+    "bdfdfea12fa84e7a0f11a3d2fee77c79edbb3c364325a278d1fcdb3c1c696216723b19a2a26d3cdd0be81ddd6dff0fcd01f8a4fec05433a82844f4c188b230a4c2ae024a3f24d34ae98641e2cf361133c21155ab015c1a7bafb1db099545b156e2654e7f931b95c0940479f6681ef48803f9f545590887c8d603bf0b76cf6539",
+    "14f4f0775b6fc2b0a83f338258538f3fff58b6f160d5de31d40e3f39e2a1c63d2c23b2efc8d46ecb96dd3dbae21da91f0650837624ff8cdc1a89a65f889c0ebd810d60bd9342d41754e62e3b365dbb509b9b",
+    "321c7e6d348aa929f147190f8e4861339e2a2a44960aaeafbb1643ac457442734d7f9916cfcdeedefaf52d1f1e996e798b5e73a26476a25b49f627eefb06704ef979a02a5ce98af3ef5f364b7769bb2a97b8b1a6ca70e5527b7753bc0924566c6fdd38070ba87a4154e3e63495253d197ab151e8df79db5c9b214687b7485888",
+    "72f59daa5df42a6b764c69551c778ba71b33daa240206cf8208aa2e671bc086a0b1fa71fe9b5503f5dcdaea37d48d90affe4c39cecc3c027b8547b4aa2f826d1f3e06451a87b168d9bef380771e92966e43b1c5a643a07ef269a020c41a670fdcae0b9e636359e0de8852f99fc2ef9edd7ab90ef52834535126dc67d3ae230f6",
+    "c781ea4310492eb549191e7f9d26ee812d7fa99cd35b0bd56935d6be1bd7e3e4bad30006947b006a57632968d055bb6fbcff6f7aee608726e3e16f7231aa95ffee125685f0b625ed43d7c20bd804d1c2067ac5d05d5e11e0d10b9e141f284e51627e539f3f07995a9ce86d9ac7b770280718d8e08c0e21e7f76548b639c03c77",
+    "178faba6743cb6276bf157b3f183e98a3a93669a2970da958e32572ed6430087e35bacf355df25f94d98f87a63623977b20411014f9dbbab3984a03579b587051a089d9945d241083213c4e2277af55fc29",
+    "f193e346ce4822486d737c7a6575451c7ae193f3eb79d0b9761bc48045e63edc864ec5a59d45b05d7af5a0e909e05ad575a7d46b689469f57928fe8e8bd4c9111f6c47ce46cc109ababb45ea2d32416949d1e520af565db56263b9728720ef70da60ed58359fc150893bafa970f6a7f68efb71a1212df3263cc6a90e643a757d",
+    "237288e35150fd5fb0b427e9ffadc3c1c8847180b114defe70670c59e3d9aa4dd8966fbd6d7fcbae26331ce4ad505a1dfef611018b585a27cc78d45da70cb3126dbffde4225113f6c5e50921b29cac98eab8d58ca281a1520d6ad6ceb9c3cfaea2efc89215980cbbb001bb8edab92cfc31c1e0609b51fcdbec10f3e1c3ac570b",
+    "3a430f877abbc13df74c3250fd62278def33353505693a1ac77e75870d7ad6c9e180a57529f589fc035f27ac3b074941e927052f0094ac4479f3f611416f8f5e0c501ba42d7e877f329eb8655c78153641fa7ead83a6a7d8440f72526542505d456bb81277443cfe647bcc0b8e34056c69fe68de6d33b8dade2b17e4c5947129",
+    "1125391172153f2245c74498edcad4e409e6dcea8827b360abf6bfcbe1dcef792e366fd7c4f8b358070d76c2abc9bcfc68ba6349a8c4421c062ae1155a5e75ae1ca15874a08c050bff5c111fe46f5baa46",
+    "9cfbcbffa23da903679292a9942d92ffc0c38fc03fec16816e149c71a59cd7c4630c1278ae5b5291e9fa58ea401e3dad2dedf27ab62ce4277bb499ab0fef357e02fc6078e836e4e3b10b2ac925a712699fc4d98e7232084cf22c683f25a6a34fd46f2a26d26f10b9c19eab78553717716213e9418c616de8014d8daa65bc00d7",
+    "bfa5c28fcd2552ddaf31e55c572b8ec6ea071a77c92735efcb4f8a8ef12d923910f6e238ab81c40271cda4aeb25c7662c30dd851461078d169270ecc2197bda4a0d612c90d6101de43bd939c0b2786f50cacbadc2112e13f4f4e4e4b1a7142ad41d38c85c5fa7864bcb8648df1ba27140031fa0034853e12b0f9546b8d1b0eeb",
+    "f3d987c7f2bba7eb066bb926e88a125efeebb2037c0c9641c7d086e9372c85d487ad3ba832c0a3361deaeda7cc1876273e098d55182146168d15c26d63ad03e49b1ae862f80f15402d4a40870ee4c8eb06e22f0091188f8682ef6210f04cd5dbac23da22e65ad51643a7432740d8077116caa56178eefa0b9bae1ab1afefca67",
+    "fefe0ac0dd1e7c233c7587ffe9208332a337a159b2769a931a41ac2bdfc146f6e120b5450b3230f93d413e3fc6c30e101488b79fc044d4548f8b14effb85f5e8adddbcd821c24064d5ce92eac510a3ba",
+    "235947e7be455c12041f9f0ab6ea1cf49f10193482c757c37554c8070c6f9991a5c39c9c85230c4ca6ab9b58a6147a510f6946a45597d37efae3b10512076c46556cfe3cc92f33494dd2c4f5633d74008743185731c99582f9fe5a38b8f22634a59a87a0038a3476cf82f7fce3170844c144b94527044eae766c0503dd202e1d",
+    "3c5c438badddb49ee3537ffba2bb24ce30126888f897f469cd5781dbd61531de8f3ef60222263ab78f0b0a24cba042094598d75a23cd4ace6f434532b99633594a9a2aff3e6e975b7d07461b9abc1803f785fd5e1b95a40dcb7a0bdda9df95ecd6655d6330fb887397930d8908a5e627d17d82e4b5a3a4d5c94829e5b12ac0b7",
+    "049c9ddcb589ccddedfce6d17afdeabb6d86d4b645db0db20d8a4fd8078fef283dbba037e343a3daec92a87e48ed75b127ad426ac1a2f7c86b6bae08324ae068ab1cb739e9dded868974199fce93d226809ced085cceea11c0fe17eed04c288aa4d360cda01b1f4e4c8f3ba24d8e2093af844d8bac164bd94287bbd661acfb2f",
+    "3fda187012e7db2ede86be141465ba77d456efc4812ae1b4b870bf3cd1b253e3db22d55cd04f2ad6cefbdae208842b7ea1317baf114299c0d5c09d76a78b5fa4e330fb9e659d2ff22fd5cf6b1e44334",
+    "83ae7e696a970e0f4459f25d2094f2f1aad1d36d5b59330ac4d2b1fbcb1b0dba329f2486219a64eab68042b17bdf8f97c2e804cc0b5d93b3f1b7b73356e5d21f98cd0468ef312d08139c96c10a0ee5806b593792a7b217149aff95231c030c26cfd6d17e148cb390421cb3c08d201804704dcc563ea2ba3b083d9717f70c232e",
+    "00351b4d58242fdd4ded6b129953453baaa91cad48dccc0451ca6c3a85d36049c630af02ff48c30b3a8b6e564d1bb405dd9de42044e5cde31268e4ecc5bb187138297cab51542603144bffe1d96016fc30fcf871ccb7bd472b4e05bd43a9112977a4bef075926e36a0c426e12d20d74c91ab274f0e560750dceedab81949a370",
+    "b6cc0cd4c74f8d248c31b3cd5e71c0908430b75bd2ccc212ff55031f8466894c689918f124b4cd174ba956d04491195b41a3a8eb80fb1dbeabeee21217100d4f62c28c3af1c3fe374ba133f38a824e96390b28a79c69a490ff909bb78581f2176f114c31214dedfdbe643b5500a17047e286b659ef0c5e7a2ae433184b4b7ad5",
+    "7ecbe5b36cab35c4fabb65a7a0e81d21402e547442d79bb4c818cd5c0170c199a424d85b5ea63dbfabe2ed7fe0516c5b5821cd127a2f648fc5f68b0dbc86b6609eccedf73b5f70dfe0613ed64edea",
+    "db649b7b366b93481b0159284cbf0f4f75b6b9ca8fa3c865d374c129db18fd7b84a3fb30402b843c937fefad69d14d6c454b5b8430ea669adfd53a419ca6073470578b63fed9f77e52d01df3578a8662b4edad046c9dca76a5429a6e14364b4b85fc7964f44addb105a1569a238f7393468a953123a0f006bcc2dda9e404afe3",
+    "eb5b40c2f7d1600580b3060a35a91f3a906e86ad91eb553915f9b59a3d3a1bfeb34da1c931ce4e5f3eb25bb936f2d7c33035787055d19e8e0eeaa83b2d28b1a5cf5c30fae8043777a02a1b2902f250689dc7860af37b891f506440c994d2089d1d668db23893fa58848b19193a511a5f83fce7909df55dd76ad25ec9485f84f6",
+    "dc159546ad5e2e54641879795965112c65b7657a16f98df54bc7c9024efe964711ccc7d7e0416f45053829c006ac5e151408df34cf98cf2487933dfc6acb52c3776659f0c08095bed010f8caf4fd775dca5964663bc6aa5530c6bb5f05eac637f7db2356781f4c0b9afa3c215d25b4f6909327feddd142d4d9ae384672f403ab",
+    "1e5fcb871087c1327f8e7af288d77b9cb2d73cf802c99545f2062df25e6a54baf21a3d056f4c75b9d09988fccd48eb133d26fbba3b7bb8c123fc4ad1e5740bd000a5f731d9724779adba73364eec2",
+    "33a35d180ee4566b695000645372afc24590d23d7d23ab36108bce00336cb8a5e1ab94a63bd0530da496b7368f82273241bd1b1fc3846ad61a356ed48dbef5bce14c6e02c2165285f3ba0a1b3b4dc8ba4d35800a983838b0c239cfab13daecf35a2edae442b737f1624b9b00b7e2172989050ebdeb47517899a5620099edfaba",
+    "805afa2c623a0b66e988e1199e9b59c74d92859aabd8f40d18d2d2f57c281175be6601f7204da20e5a36e83f98616bb4959b7bf5ea3970695d59a6b158ac43f739d3e4aed00307904d1b5285ee02a894c8c8589e9ad45edc99a510d33738151907ed4ec3a77dfc463471ed64ebdd557ba7c66ca43e0d713ebd599a928d67d296",
+    "11acef92c42d351b4bf6140ff87b504870184d93d02f7e3210dadec2b4c9505a3e1e9a1f7360738de4899ba184916dde60a939df20e60301c1152020b752842cfb74aca30181ab4e4c188acd5e83845e87b76f061462e813b1f9e2a2fa06bf69c217536068291e2126918a675dd8133d9f62df21139b6f0112e1aa21d190d5b5",
+    "29f37e2e3686d1c2735df94c1a91f6384a6abdeb80aea5463475f924f5ac59af12addc678b282b33d76ec79a5dbb55d847e3d3f0d6d5bb7b19b78572f3883ec89663189b8284eee0d0b392643da",
+    "b3db4293eecc8c285c30933a09f0ef60d7f8bdab8715814afa496ef7a18d1cff990a65f6e7e6dfc84cd252fa5a405e611ab4ab65e2810b17305bff3a1bdf7a57f92ec98d0fb52d7f72f01cd936cf9056a23618923773925029a94d1a52e80e4161a190afb591eb313d943a5b470ce1c7ebb248beae1858331fde978111ba42cd",
+    "9016b1c01c770421ba2f0914bd88a161419082da5d63d5761e7fb41b71c65ca6dee26f27294cf41c9db6094af09ee136d89a9bfaa37849fed09aa4eb6cadcd0555582a077149a1221a968f239480103d4885815aceb21f0637702650fb56a17bfefe0120384b19cf624501efb2c79cba7300fccb20e09e29b61fcd620ed789ad",
+    "f622f3cd95f80799ab146ab1cc6f4cf7929e81a54a4e069ab8ecb784f1b36ead9cf3b2c5ad9254e25ec14615650ec827995617904a0fd145edb499b8487193aa78be7d12f67f3752f959cfacb2359f3cb7a5aafd34bb2e0f41ebb615b5b54b9f3987b467eb5599d93e77939615665816216c7b032eabc74f9561ca03ea351a03",
+    "12a960ae2baf1762e7bdec9078b26e17a08e5db87eb7c27be0e8ade19cf4596dd10d1429f35a249b55c2f13e5c73d932399676b22b7fc312af6eb2e43beaa019cebee3cf6ca850b1aebbae2a75",
+    "c4b1422fddc401f97e629254df1b95c1ef5128f728ee1330dd179b84a900543cf0485b4158a5bc1e896156c198385629f82d10d944daa65ea2a7d3f728484d6958b62a1dcef31a360d9b7c1b858c42e4695f8f0d1eb5addc678e5ecfa3f62bb64ebd40806358ab011e77ff5e5deda667b49ad277472054b2a2de4126e3566ae3",
+    "7c7662a230f0563392107e3dce9fd00880a6515915876e6f118dd4aa8540c606384bec972840eb62bd1e89d368586ef8bce432cbba8e4a62fecca5d59e45f34faf2ca4267962f1f527c2d4eeb02dfc44a21e3fca02b31e3740bb2247a0a551c4cf7fd5f418050282e46bcb02b7a871530199c6cf94d41596e194cdf237b20d12",
+    "430c595dcf8bcd81e1f1bd8867a297de292e678e37305958d2235ac6d610f5513656671b8c11a7247a58af200671a9d305abcf1cf9d4eb6a9f725d6813ef173532ba31a72c0ea091fe9667b87d246cb6db4224fdc168cfbb6188afa824100e11ce0bc92f48e76c8a37f18342582b504899e197f462711213daece11fc293e8b5",
+    "4703259fb1b34ec416f54bee24d804e338eb368b23512d447ff2bd50b3915467e7eb9faaebca92da0ac382ea9b725b1c149e3849dc8ce824d053e76aea64c4457105435fd13d86b6e68edb13",
+    "717ee4a1d0cb3f930df8d11cf769fa60d9ffae7a1067241010663e2a3c28098335aef55561d578bd32c24922e2db994e4dca995d015be46cd74779ed3a2fcb4f28584aed24d62ecfce5d472906eb7da263f787587684acf9dbbb26954980d25e741d6e6590d5ef2465be8c889a37459a9c96c670a19005933171f840e6f2b519",
+    "007422d709ea1875d08df6643ed15369a3fb96b86c182afb1a95990500caa775b217f87bc270f767635fa4d4549c7392b6146e26f599792f0d413ee66ebebc504ab6cd350eab0929718bb03a7c2451657d826dbad507f7c4931523917d094c47937360ef9cc2d4c4b882ac35b21cd8fb5029d2b541e08be71c0aec404adb5c74",
+    "b4cc06de1d540a3175800b7848dffd935caf53c6bc999371f618c55af3e4a2139a2d4932901927669ad81d950f0ff14d76148fec77cf60649f0787552a0891751605552b6f5ecc616ed5bc819bb1f3c72ea0f36c5675528a065b71de371ae8ae2059da3bb24d508d9a810d41468875da2234a7c24050903f9510677fb063e995",
+    "93a6cbefaf26e4235bb7e081098da5121939ff6820e9909f5eed6701eba0cc74991c18452c2cfce92a34e63b8049fa03cab998e22ea6becb702a6cd583afe269285f3e90f8bab6c546fedd3",
+    "36cd5a7be0052a0970c08df52ddc179549c9ea008dca425cd8afe5f0061b2ed55cac57779cae6a5ed43f5e1ee7bc0d3d9fb7185ce01dfb05142344330f1e1f7d54f362b62e0eb2eb40782ec375e183bd7fd03dbed970f4d17ebdda28cd3ff39d1bf607a64aaea6cdc340be36d6a2e159e7a2b3083a36aea8aff38a967682a3b2",
+    "9a4225596312d2adee4e39e61d2180f3086c0ee7db1afd8e71b874f1f93525da019cb7c6b244dd3342464905ba394c8b869bd8816fb6f621880677af06cfeca822ee4aa9375e3a4b7eaa575a3d3b9533b8df6dceb8843b3889a6f2f4a895cccc31bd169475ba779fbc86b9f32024873a8918282b14f90b3224e922221f359b47",
+    "3521b46d8778cbdd8f865cbeb1f91d799c9be8ada01d2c63e8ff53bb01d3918884797ebf98ad52a9e24ba6469173fe0f4ed6f4d7c0bcea3106059f00574d42beb713adef1e56351d30f22110b7dd2f0aa40e7f040199c05ab6bfbf5431977f152e74430942f66ce0aba8ac03e751086776bda63b4264b3ad64e41ecfc6f1b8a3",
+    "10728d12b81522a6a282cfb11d33acb70b0e5b2b99208a0527679883397c8345776e59d0db39c512f6c3c0b7a796de63168382a89a91482572af5299684c818c7b5f7d941cf5e4ceb8b439c",
+    "7e9ebe723ec318cdd6f6c713d33693720c75051bd7b01d37088b742e79da28267c1285f3c9a1199aaaa247b9b47060a64ab796a1abc2eaab0a063a854b2abd615173c5ff975fec4b01f882e58e2a77c434ed6bb8562b74545b8b03550cda7b10b24bc9083dd380292953725c8450fba2837023ec86312eb64ca8aa162ab93625",
+    "d55a600e230eb1f1de59ae189a42797c03d52b4eefd4651414bf27e77d02723486601840fb984fb13aaa0d93f867ab2f516cad6e2fa9225441518af8150d625a6dffddfd9c06ff4184b0922638ab587c2c22b2f4ad202354ae6266b294b9066b985f6569f7c5021d00b8b1d4fa3dd2608917860ff2a6a3cc01bef80582033d64",
+    "2d5cc7307cd0141dc18df233fcf22863a1823558a12df628da2a7655c6a182b62ca4a5371b641644851adcea366ef0df6e1429e878aede0433a9b107ae40b73cb32cdfa0308d0d1cca2fa58e14290481febf6ceeebd108f511f2af25f55a2e99ee8cb5f2b022e652da3b98866fef9ec17746272f60be29502a60e1fcdfdfa13d",
+    "af4a0fb0f88c9f9a6ae1cbfb5846e26766767c8a1cb50c844852e87cb24464088fbce82abaa826410f47c7fab1dd76c5d35435d96a22e4bba6aa093e220f8d184d5949f3493b030cd4e93",
+    "84ffb4df77bec7b7153a2085985c731783736e3a419a3b9cdd5495a9559e7e67bdd5b65afb204b266369f446915f545c91d3ceed4107b715073cf3759d04c8142dede463ab71a3f0850b01933a5531187a0d9aa5ae71db3a3507eee122025418c3212b23463c04aaf63edf859e91f4a475083a2ead0ccd3e78e71e3c85b8ef71",
+    "3a708c11d5c1b5e694848c91f2f76909e5566c67fff35f992f639324a48ce6506bb1f41b7174e43a223176ed32f8632b7bfe10668b0b93aaafa995ea1844a341f761e418fafef1cac0ba80b2fff57a454e760901507176b0585017ab1d62b4452c9c2869c70befe6a7b51291d5b0fb3dc650868fb02bba63903dc73c5dac2a59",
+    "3a3138ce47c93802c4c5dfc27323732124136de1028258a2a22b7d1a611eb52b3c0f0c9334dae87085fa9eddaea72cdf149f3e3baedbfacc27046aec95dc3e65fdb3d59ef6153b97dc854d1dd8c0b895de5751496a4a72b79167446b3150278fe10de0e753b4295ae57af1457a346f2be62f4e725c6e385b93c9e9594ec71d59",
+    "12e990d3d79f53e9a86e879e5a2d2d54bd1d9b04602546702380c48b1d499560941d42b3060edba03bb2f8dad9e9fce81a46d53e0e69657adee7ab92d0fab8bb11766eb4e619400f5406",
+    "5e93bf7d6b7ef9fa366400925b699f9918f0821fa9d175ce82d0ff1d32a8cb177fbcb4413c31a5d7b669a7fbf662f3a2ea222d8363073c77295f417a854f828fe55df4a89ebb0377c0f94d60c8311e8188d4e7e1c826716801b4ca1235df9e9d3afacf7fffeb65601305b9356dfe4f6980f4a5643f561739ae36f8bc2f8ba9c0",
+    "5f9a19e71e0712eb2ae958edbcb9bbe8d9b89e7e284d1adaf3f9e3f1240fa26611fd1f722cf6198b7f863d2bfbd3d93d45958180fafb5c567a1e75a11989e16abaa36ca6533c9f327eddb051134c234923714582d05b045dfa21db2d41618f270a7514d69cf8791957d21bd5572ceb8ad65e516cf3cbc938767ea48838693d94",
+    "a66c0ee203688033ddcea1c74908ce9804a75883cc2d858ff35470b83c7d98c3c91b01fc756784403e9f44d84a366f9036ff6f73d2d6f8245e90640725f2586f80d32232c8ddc4b80be798699d9ec866567babf594737e9836cf905cfdfa44b610c9897200456ad5e6f932c56f607cb5757c2f279df11f57157420c535f4d07d",
+    "119df7820c21b5de91d88da0a63e05d6b5de59c530a32fb48a70d7713ab133168fb49824805f65a2179d13b1691bc88365828061222f0675005ff21aaba53ea45c8bdc973b8e82dd9f0",
+    "aa755d278a67dd46bf52ac1312d858b345512be34abe83b9d6c9df0a64fe147cec6162dfad96fac0e20ddc6590052d8386513e75c432e9a6e41461e94ddef88d1186c593b516f1e6390ad0800feb212c9a3a7c556b6f3d95aba8c891543b87086051f8d06cb496f4124414b50d01582d808789ca19dbc8dac90b1e3a0a0693ef",
+    "57da229259dfcf6087e84a792f05f4f4eee49e3bff30a51a9a6fd1431759dd231cdd7b366835d889edaf6a01971d04e6f701512763ac7487c43ab786fb764b05d6ecc40edd22e34e09c62c05e7f35cb7d4027f890540a651c4ebc2af3e307aae28ec8c0d0c6ee957b888c10d02a6575a9cc3e5a9c21a7c77da8ec5f3ed73be23",
+    "daa14d41bf5312721038e5a91c679731761a93417bcd4372b9e7b362813bd9794225db1a97d69334f24d3ac3789c1ea153dd1d8d2bd25cd669e44451b5d564357409998aa210a15ccd020236795e2f987a5255d2ba208d694dcf055402d6551af67c78c3a093ad8532410de1bc5be1f7d7960a55b75c2aca5dd8ef44c9924503",
+    "43d49f88416886aeac1e73eb1405fd41bfe1162cdfb49de65fa4993b45e9f7dadbd69012f2cfd1edce2e0eca8b2b56d7af1755b7c7c569ae2b5252efad09cb7c3579bc1ff811154c7",
+    "484d2b22fef933f77dbbb8a60fdfbb183a918ee2b989e71a2c946563647f9114606cb9336db4034f581a957b93264936015ed50077d514ae054b2d8f630d92892e7797ae876324c9ea66dfba0d03009bf8a086bd1a443e9aef3321c00792ea4bd5bece69cd14e6a46371c45114bd3cffcec39e7fa499f8eca7aeec5bca556d32",
+    "be0cc421ef5810a2c5022763a4af015674347a6d7dd5a0f24f996d3cc864782abab25eb733af779cdafc3c006b9e8206d30360d59d5d19064241556482241a22a49b4e1094ac7871f1bd476db56953d24c32d10461f3d259fceaf7630ceef11cbf7a30a48ec1aac7f3c4c4777c6df715b6970d42c9171accadf61b42c7056708",
+    "f2983efcb44246d6fe92c19b9614bf9beeaf64a1c041cec4793ee8af6e6195d6d9fe77d4533cfd2b0626abd9942ee3132d151bc44c94daddc1761615f604963dcb5a1e975fbf19e5d117482590645444a9bfaa591fa6aa90271a5d136393e4c4af3845b0cb6f27ee2c77297934ac84c03725ff361afcc3e408dfa05d79cd7289",
+    "788d45bcd8e41d386f2d08f369c45e374b03519a17429fd82142e93008c8a93f4532b0bd395ac0d8b7c5654961c7849faadeebd60eb1e04c10757a504cb018bdac84ceec33f5d1a",
+    "7fdf41a0b93ffcdb37c7a7afccca93dfe1d54324c01514dc5841fabc2356003b0ea1c2c0f9fbfa12e6e0ca902eeb68b288b114c378a03c6ea618d851df6543cb1812c9163cb8e7a392d27b8d1635506026235ba030ae3d063d87308c757a5f549cbf8874f748fe9aa3a20551d39bac97f3cc3d0534919e6bb4430c06b391ec88",
+    "64645707658ce5d03564b863770f1db2764b17b6930d0a65d5f27381a0473fd0985d30fa8c33dc4107d4263b703dab795a70c1bdc18b31716655dfb3aa2b3731b450392363da31ccbcdf3a9e00f44006c70ef13f3978e5e81644789190d1fdb1713a5ad704c2287039a444dd33e619753170622b7ce9ea1b0c61905bd6500133",
+    "2c41121c4d2666681a862252f14c3973adfee5ee946d43169d14019acd347506f5a44607d27d2cd70aea0738f2f5faf2a206183db0bafa11e98e70866498ddb2152aadbbb5651948bc1fbee4acca5a0c619234d6fe105c154762471e93cff6b69cc91d631073994abfea55d7c6d8eb9ef28ce8f7d7854650895edcf109114383",
+    "4ea02cd87a8bfcd07415de4ea8220c6a8749cf7f6298a69701109ca5cd822a7127a90f8aad4f8062268f2a24814764487438a1b6e5a8c954c2e3191dd13272707336cc08219f6bc",
+    "c8a00d9079299e6d419b32a9175f4c1d7dab4937df3763fcbecec197267e6183c490aae800924c6c43e356fe847630e27d76d2b389e303a25a97272523b439cf4dfe7387cca6124fb1be86e3887771da8d1b2fe5b6d0b3bdaa7ff347227d0ef4aa0354335b9dd8d4902b6d8ea9aaa708f9413bdc51876cea6a0e7b6a5ad4ff2c",
+    "a84e8d51f1261ab3867add2de01348def17284f943a2592e2e5c25de9888ca7b7f36eda30bca091659bb1ee15db49ade088eb0bb84abe3b8a47067838cb116cd9919d8efb2ff1dd537eb6919ba9d1358b526059bcf914ff7991856205726b855097f3dc5253be00b0ca6aae46faec6b9c844a9d4ea9f7438b616aabff85bfb59",
+    "d8911401a77910f81621866e9f767757d30f9c8b17a92ed8f904ee06de7e715bb0557acb2530cde48bed011affe0fd98230832b5d042b743e853d83ddc9793ce0168e1706597d400d71f64d1f8d353c40964fa0bb858bb18d8bc109fe983b5c13a16c165b144118b03a478662c18950fe95989b25c3b6c32aca1da7c09ff7411",
+    "855c0716dc1b339d18c8f543aa150206c7874e5078948a5c755916acc95d7ba08aca661c67e3de7f887c6bb7f8dbf919d1639b8dc296f8342d8f990ddca05feadac8a66706609",
+    "7630aba4ff274346f65f3ebbc68b650e37d386624e0526f0ff7e7cb73c0dfa1f6f964131587341ba410c37534f533d5373666aa9d68b97538133587004741762eeefdf39988b68abebd5c6b7e66905706dff50939699b200c69cd6df0de88817346c897e7f31bd0a390051eccc22a2c5ad1f220cdc071d463674321bdebd9164",
+    "8fffea58906078996a3d84180387b142c79196e7c301f8ffb568f85ae6e12fa52fff79ec810c10d3bed956a44fa2e79112ec36b48cf6e64b08a3523b958d331919a59476f142e29c8903b528bb582b229000fafbe7e631e6b9ef74c27787d15a1ee960010b6c5ee6a08d70211bc270c6315818b6823763f4dfa04254dac102ad",
+    "dcf6a307d6f749eff9f4bbeee005a1f23d18e1d75a05e0efcadf426015f4553a3324a72d869ec70e84b62efee2001b4e93c2f33b03a637641064ae689a31a483b75f83e44ced920242e11986a6f8ec865a6546f7d57538608486827e8db248cba4e57a4f12e3f88d5599c22f2c32c29d3d1dd04059651d9fbe641cccb3ce9deb",
+    "7d14ef9392a94e4328b08e2899b7b8042fa2730bb78376e3615d35f1146cc90d4d3fbdb3674638fecef8ee566e7516f96bc95b40e026c52df807d283dac01f2d7d73565608db",
+    "76680c0c97f9ecfffd7fe43fb27829609e67714116102c3377b95d261f71f762312df7954c2eb6fb076798b10c5f6af8c457e789d70afdc3960edf4a7b0cb0221b3f8a4898bfa6ee8531ad3000a9d6644f9486c25c5677ea999d24dc6073e2b08bd183883ffcc2ab7b40f78ac7d80584de0b28206cd9f7f8a44088e3c59f09c6",
+    "d7383c4f106e94a8e5614ed5ec8d33a4228a8e7b72c4893b4701579fa15ae6a607cce91056703cd7c0dda8cdef6054cc4b9983b566169c967e6b973419c6847039b2f86cc04c393fd50567270dd39e881b0e5f195b7bb45771526238ee24fbce2ed7703be5305575f18d06be1deefd590eb13a2153a167a978eb0e3826bd36eb",
+    "5475fb486d99062b930f95072488caa2c8773f29a9e50bd94f8ec7bb349470629f8af68b0d4a90b0b1e684f292861a276bbf5200e07667b74d56a8bcbdefdfee48d7ecb2b274cfaa06d3ced2750988ff50e23cf0827f0bb9067b42599d744550a3548da8bd28c959e5c4ab9b203d0fad5be0c6462863e352ed7d467af593bfa5",
+    "188e9d150ae5afbea25d2cd4e36225dd616370df92cee14d4d36b9cde012fd12ff19e5b00236308f4b1b127b89120c3fab583ca864ffb3a7464011facbab6818997f5ed6aae",
+    "90a6f672d38ba84adf700dfc195dc4209e310f19e48c06904a91cd15d7830095c7ec792699829e83222510121e556269e456a23046fdf055b6232368956c8ec6232a61a7a676d544f16c1873a4a0ce63ff56a427dd119aad94bb8f1a6f36454e41aa8563c6a69f4f7a244e7d1e458707544f1ef38cedf95db6ebe3df5ef3a12e",
+    "72bb0de29f90c143fd54150db08659a7e223287b1b60b7f737221fadae0eec9706fd4f46652790edbc2ad9c866b96794c69a032c0212ffc02550a1352fb56e648088850a2b325538d57b0cb68f220f90100651cf6d9f6eafba6bfc4cb32cf48d11125e9fc9be8f90a19ae912acc4ceb5f481332996de023862d07a33452a8ceb",
+    "6047986f234c3f415163a780ccc6add36970844e8c582118b5eaa9a64152d5d14a622cdd58ee554b0d9538a065fdf42dae299e1bd1314105f33bc852b50e5d4d1a411e5536831b4ceec0d3246c6bd514ae561729f4fefdfb6a2f64b921f786da1ea967f2e158c452a00d41d378f5791ef96c0999433fbbd25dee462aa0e8efe7",
+    "2ef231c7d54bfd85c7adf435f3e2762cafcf19d268f6147697f93d32e8565504221b9172a971a9bc9b2f70c99dfcebb7a40fc10e1a334e41f8339634197a5351174ec756ae",
+    "62177080755b2ecde2afd24fb0c705c6c2a489b8b4cb40b7a12d57be0466a0dda6f916483526704e1de7d270ad1088894ff7172fb3dd91510de1c67a4bad0a0d1dab492c9d580449035af370e2ad0a59fcaf7ff67232643f981df14875e876ead2109f01ea7bf51ee6cc8c767035d20ac368dfa86f74fc3bfb55d16316c21989",
+    "1998fc3204d68642d36758f0dd085b9ed4ac8f60004cbd0987cf1d273026e4d55d5d581012cef35157ed0e08706cbee556343e5e4b9441c3fa7372cf7df3e6cd6ee572bf4fde5d28cd645a82e4650b73b91179df47d7e418c1af326d93f57e6a18fa4914c7321b6e6d7e82fde0cbdda810558729c040978ab3e1ff83015678af",
+    "a178b367d0ee5652533f0880459e01d15a8b72b5206b02495d893444f1bb9fb42d31904a049213063e4d5ea6fd3a38dc20222fb46096c35a1ea4f374f661e8974583d6be823a5e8724d176125a030ffe9d40b890747c95b99b7f8ffba1cfd6dc5023263385b06ee812275f2fb583ffe12e5437db483b7ad86dde193add79cca1",
+    "79b13bd1e259d44a3421831c0f80105ad52061a535f9167c5f5d6c4efc0dcfeb0d20eda65c7db12d282c60bbf0080776bb26e4b69ed98ae8eae743a972a9b751982792da",
+    "8e9395b96def5851b8aeca8711138ee6cb7eafb985583fd3f4b46c5f6dc809e2c9bbc1f4ea13812b81adc7d29bc3a47b0c993c449db3f5646dafea2dddca111404274f92ea109b7d1771c73c563576f71bc4f24fb6619bcc79a51b79fc1252d90432975386df3d8fc65a43fbe8293f08ad472fc3889c4720883335822070d851",
+    "bd061f80e2a1d00b89a43ce413b604a9abd503ffe95e6b0bc783d06e64e62bd006e2ce6c5b9b08a1e852796fc3d9eacd2095b8b9f27f67dc391ad9996bc25f2c56e08d31b2cedfd1d181af00f9b84890c0c66a4ea26b570976ee0e69ad7de7a563a8e5d07125eae2610f880fd826aa7fcc9356063b0b5b3091eb9ab32bf59d66",
+    "332214993ef06cf6d8af4e3549072e345e65b9794f7b6a4af531845e2406de94770c05052b4055e85909745be369c63f7db40a8b6ce1c04e1eefd82013a297e574053e3050e6d42b7d5f6dfe94407afce3bab74f584d41f5068d4be4508411733d29314ceb378d59d20c4d714b9ecfd7394ec4883af4c55f0cee7dcb6ed0308b",
+    "334bb8d5bf65f45acf89f51109c7a1c61328cbf9a749a985938fe0cd6735c862506c7a9b33d398be727edb1c99f4fe15dbd40665544ea9988336e520a3bd8c6063ef5e4",
+    "764c8e71d4983b86f48dc8683c520bb462b7c368c2107e47bafaa6329c77abad110b3b348e97a0e7e754a891488df52d11b24d8754d6d4388144bd6e9d0a9a2c61a1566adec2d0e2826ccc381e8e49093e9b1414f6ed4f90ec4922dbe67d6717414c4206ce3a542d25fbd474e2e43b589adc3fa9053d38ac68f45b7f938f6014",
+    "f7c03d798943c21dc232b10d5b401255004b8e023080fa05e7cf5f6bbe146e6656e6d2096a6ba36f2980d6e39e482bd427a2515d83797d10ad327d1d11f448b91e100aa7772a8ad19e55275bbe3fb4be2ab5c0c641e4052766bb98f668009d52520810fd3cbbcc7ed7634f7c19757678e3ce687e7fde1c04b000a885e1435589",
+    "78d4d68f2b4e8b1b55e9c3b237758dd7fbe4faec4de34a48f20ffc8bb8415b92dd8a561930165fbc1f2aa90f2109e245750a387f9997942f0cb514df07ce0fe455c77c1d20a5276dee3522e80408fc56b86237afdb3c9be0d05bc3396c851ebc6eb349a9ee8cd994d63555f76a772d38851f790136259a0521437b5765cb0fcd",
+    "631092f1163fb3559fddb3c070f01f7943831434f0977efc9d1e3927225b315b9be2b13737767202b56b79f59dabeac9b84cf9b89aab7de6bac20d8b1a2f548dfa5bd",
+    "33a39cefd6fe44dd5793e9c2dc61035a806f4073172001c06d0ada45e7e0ffef212a44e554a9d5a80d01909ca948fc91c1d7d771b362f680fcdd97d4f3998cc78d876f00fa31c0255ec1d3651b73fe2766bd70d61778a865c9438663f7cdbdd50cc09a44d8735aab0d9a3e6f935cceb8d101d9351bb72af229915dca42a62eaf",
+    "4548ad43bf4cc4d7eb391aceb883a505bca9663a05f34f793051a81aa1dcbbd6ff75283ce804920e64da1b7d59937a5f4470d7933d6afbb349d820d7a41bcfaf89773b8f07d8db36ac7a445cef1201d5730250c9a6adbc992192d84a632c01b44b09e66eadeed545fd53d8f54ef15d54374e0cc467fb7c9d23c7fbdbccfbb394",
+    "121bc1caa8b8f84138bb75d36d48e80f1028a0d93153615bae75d97248298ead660ccc295261a1a66b441489db793f6d1cd395b6c666f0da251f26fcb6600894c1405cb10300fef64758fcbc210fac03a2218177ef6a330539e06bdfbf808662950479cdb5a9de4a12e7c39ac5e26bfdc547b0cd35308f44ad1aa224e6af2283",
+    "6c56c77513f87fd8d2382107b71f30b29ca71023f7102c38c8bff92ad3782728639a4be5f7deaccf686aac9b4f6d2d042ed6cbc5de4201702e89f1aa55bbf5733a4e",
+    "df5cd71ebd30f70b298a14de4899524365622a7011995160fbae687218883588b97cca6d5f6273c3a230e3003bbd56c6ab4b8cf05236d29297de650f536c88f0173a39f089336a8b388b0c5afc0b698abb7fddc955e792fca74f0d680d8dc185c77657abedcc9c4569ee2aabfbc79eef5598d2983fc57181a5c92ce7ae9c9a37",
+    "e0f10c3f40918ec981f3373effa574ca1a1bb89d909c1e539a315f0e08298a1c3a153b9ce42c45c5de215b793dfba71476ec93784304701ca14b511d1790ec89e3be546df9cf75ff539064e75b59eb0da4f27681d2188fa82ffe0b436f65a6236d5b50fe96d571270185e9b6db6f7b5322cb50531045c3a5d83be534d02c8518",
+    "c97425abbf4ddeb1329ee9bd176b0a294ed1873c1aa62dfb0131327d9e66d4c83aaad75c3b3677d42c8fd3c9918ad1b7f5d10ddf8701130db426449908682687c23357b40cfe8be6e680179df34268dd10da36998ddc9531bec124e57fabaffea3e670877e2cece5dbb9cb942713a4950896db45626344049a4916d682e4dec7",
+    "f95e82c6ef1f77d5c85e3fd5c9061b1eb158b4ccf8b21e1189a3cc2cbc298348b24a4af9a4f52e75a1719607adca5f79ad6338fc8e2f9fe021a3a73782a8c1ff42",
+    "84b16e042b6024916cef9caa840f4b42a8768d346f83e827db6db12b8c5538d71fa87d6c98cf569ac69740caf3d4f3b70471b7c15e1c2b21e959237b328fe6ef4e6354907af1816a7917b093d21b22a71d908d921ca703e9faba7a658d1607d2f6ad351cdde0096da0f0e34de3cc192a164dd4814f0387d843387d76256e8fee",
+    "6f0dfa472f274009f23850fa0b13c4cae610979d81eb55a88c3b02f845cdf468055cb8c33141cac0ee85137506b0937ff989ba96a38ab6140f7ed47c5153f538deb3b5d7cfbbff4cf60a2113c49b6ca63f25d58c83dc3bfac3d022398916d80a119cde3c347bf83dea2f5eb39749cf1ae805986774f94bcf2c404ecd96f94dad",
+    "4b8c4b22fce5b75af537495e4615eb2423bf0f12750660aaf8b1403e5e3aac2b6ab2126a96377624a33f1c289435057e798c2d2edb47089d1a3eef31510b37a5f5aaf5db5cad55c205e3ad181fd82fec60834804845aa9afcf9da37012833317a3e089cf3862f727bf7e34faa2827dacf09d613014ceb612a41b53ea551851e1",
+    "a304f3e17dff5146f45384c9e9626d67c656fd3c29520a8a05120cb37a34ccd523c826c7d776411677340cc25ecc4c700debb9d2592dfd40ab7f27caef2308c3f5",
+    "88e00adbf9deb6ac695197f9afa603f3cf2309b441a4af36fc2c4a0b62402145fe5d0e7d683dc5e1b326f34c99b23ffebab07446e2b91a737fda5b323c0d7922334114a5ee43b6fe970f12e21a7e9d7ad162ad460df6416f4fcffe863363534a43169ea86b7524f730b811a56c3dd34c22df3ba8032e5974f7749a2ae80e9dd5",
+    "03ef96f941618392c2479c19f66386db5a7cb5fd4ff1a7c758790b3a36c55c67b8ebf075ce847e47f404c2627b5b0f0d79644683edbf4b67e5c4915df871728bf1e282f314b8f114b364f5b8cd9d5e7afff5cc4970758b50dfd02ed9c8d86a72070f4fd98df0f03fbab2f4daf512f317fb0c4660a8184d6b6cc4af08f5f8255d",
+    "b315bd92e208982e29edf5afca6cf780aa94a9312ae7f63524cb5cc03963f4243fc84a4fbe639310374a5605dfaaebebd91f62980273d2dcc68007b654d40bb4dc35181e2800f6c03233d5a0a402dd5fc31ad9dd9c8c0686eec3c646f537e100897496341f7bed7fdb2d2a04c26d25d3a6e97cc61c25edeb3597960b5302dcf7",
+    "8a1487d6b715eec00f5d9b53503e50cfbe710da6d6861dc88501d100eacc5bc520a6a43361f7cb366c005b36de8a054dbcc890779c7cff3d38f65c193b8ce899",
+    "fdabb2a1624cdc3bd0f87ce1b4e456f70e0d137fd22c7843e35e4bbfefdef86d675fc1f42ec7a941a4eedf8fd003cbae9227cb920de2d6786e88d40d199c27e076ebf0f7586b9ac86d095a8b10caa688437856236b7225952401612786622f049e64064be7f9b2ae6998f95a7cf119b5ed25d1a90d83015e28e9065bfd9ed41c",
+    "e6ae72f576734fd056dea8a060213c5af200c6e65d78a19cdb6befda3f6b0da4c8506dfd8663a6afc589e398d5c51e2d9bd231cee0356b7df95b6038edc8b2a9ed9e71e75f3210645537eda2e242e238d38bb7c3af35febbdfa6379b7be3c371bf66af66dc5093aa664f6f369c6adb93fa2b5251fcceedd1dd533bd2daa7ce67",
+    "33f4634e1ef2be13d74a9232312b70696f956b7bb4b1c0b31d15489b044c360b3ada4d322adcc722b3e4e93cb01fde4a7c635303900fbb1e0ecbd21bb1b8645900a5b683f25145c564f58ea5f4db1f2b002e42b8404442ad1cdf3394585d9f7b0912a2a083fe4d0a692e33947c1d519219d4cd7432e444d5ca312bb2c91bc2ad",
+    "45b3de0a067250499eb2aee59e33c4f1a59c3693c12670b4db1bda54527b81ff078f5ebb27cd74a8d02e1c2354fa8cb2af0fd1ca20d9f118ad28c9174ab1b7",
+    "49caa077401f832ea2ea961728d176690f12441dd80d3d2469e5aa757a860b3ecdec90903bc0b419e42a84ef13b0f68171388656b7b6ac252da5ef92ec0cf7c3d822a7598f5b919056034298be9c06e8e6a5e884c1255803a9811a7117a449a5cec7ac9c61d853fecb704478a447abcd7e1d215c57d315ab953b7b55b5d05ed4",
+    "c1ddcbda96653aa0d0ed07027598dd136d9515b2fe5cbfd88693d1888f1c91f60d029af66b34a59623a4d58be4c57d36e92843d0f6d3ad3c029e2df0779224b952012baf05e3b8ad48d3feb40fa501351c1bbaefa6900802f152f66256939630836e57f9d1d075c3850c52c1b21bdacd75ac221853612a97b4bb48b06b41eba8",
+    "492e40f6a3ff9c2c970dc5e2bc3b6b74826b3cbd05b9dc0e948933d4f95a2168ef96c083262c65f6b3296b93842d096275ccdc50b4c85920513f472acf6df19c645516f2e56097aa784660dd7678d960f59fcd0f43c123747567fab1c35e50ae5d5c6ea7537160c49d7b617dc39f8f11676ff087ee50babc196b578f1c0592f3",
+    "13ea9f5dcfdc87e79ffbd6f43321e3859b3a0a83778682b6da9f7bfebc15898b10532953aeaca21811157598c0f425cad20b1d827c60baea0f5e18a7d33f6f",
+    "cd06f8978f6c777e85506b90e91e582e150cf2ac6cc1d578ef1dd1a89c044e51167557c04b4316ba7674ec23a9bc005e9a3b43526bc90a57638183accedc40a3279a9542248b7bbbb748b41b9825571dc256257e0c20bbb6c54a508a5b2c2fb2f5e9e16fc06bc1683d7e6fb256321e28539b4ae1b4dd6a77ab07a5dad4aa63aa",
+    "11b4567fc96a83996824e87505dab2a411f06adbefa00fc3fd6584b78ccb8d2edf10eaf426864fbfa7af90efe46f02311ebb240f869fdf2c682f8a73af98fff49d47f9d391d8086f86dcf52552fa96fc4cba7b1600f6829b1ed59ff867dbed95f39ce8f0201a4611690670e521648c98d590260ce976e356aa48fdfc479f952f",
+    "ba9e9b6cf9ef8ad04a5578b22be70e5368bc2e72272817ef5e4ca6caf3ff74b6b5bb20ce6405a8cb071aa4c25e26c8c04fd986a6069496c93513d39d518a98eafec82c3d54d07d41dc1fe4261d110625684da948b667c3ed5f2369b731443e3ebacb2a383d4202c42bcfcdd7bee26f579abd9d0be90b27ba688105e07a53556d",
+    "469e4863212264773a152608896d2fd44be84541fc5414e10ae0e0fc0387f5c101ba16a9555158854875c2b587cecf32090c951c8ab91409a4ba4c130f55e",
+    "c3aa44d8a2ba0a8c37423c066cc99b243b39bcf4d44900e8c6f3877e926df972ababc29d07f2573330f8d9c853543229661e5417e0d6baa629599356bac4176210a1c6bae912986c86b7a0be6df59a7bfb66f9b3810768c1b3bab9d7f875d3753aed7482466d259608070009c4167a8ce7fee0369e6eb00cd28c81ed7ac044b5",
+    "e880547b58232d529d0066b2949e8709521ee7c3e3a63a4a37c7dab2d8d738ac2812ca4048c38645ed9473276df833c536ffd495636c7b6d2ca1551db26b322c5d57b3d0e76669d5eaf6eebcf4f6a7d907607dd139afcacf490ff210c607afc32dbdb3a2b97685df4df28d42f086cc24782ad57d29356245669f71f483ac8eb0",
+    "4fbf925909538403bb43e7bad9b24aaaaf8b0d026f79a96e89abdd35032dacd3a4c2c385c8c5c75d0b38aa6d6870fa911958d49cda8bcb0e8a7cfe940a0e63f397a6a5675efb8efde78291758301e2446159a7ccb0535d877f3dfc504f4b90e1c84fa9029685eb301c229103edf5906504d0bfcc8b4b912e72635563250e95c9",
+    "17ae49478ba617fb67142399923a30ba56721e87cd67077024481d3b4cc74c44103ef4252ecae07462b69c0ba01f6ed2ef6d8cddd0f0f3b822950f347b4",
+    "b32a8ece90fc1191b80707f0a234fd8ac914e6846efdf3130ef25c0bc114942e1ca2c6a44cfcab080511db3e463331efc599718d77ea25910dba7534e5760e34d08353713f925f2f35ab5be1ca020fb344eae906def2185f577f77c05416984a6626c61543f0f31be6110ebefc0fcce64cf250e0d26a2f1d2b30d088ea0da9b3",
+    "263e73cc584f95584fa78d67e881c6dd60148859fa0656780d95f4f77b4113032e2d4d7e680d24eaeaed067839869329d74dfafc951cb3ce675058f69f916786c1e644b3b05859ef6092445b1c8208d107f21eb91d6ae7edff724cdc3f024d5583b302f874eb5b7a7ba211279a4163d9f6b7201260cfdab19464b3ec2c17f6c7",
+    "713df250ac5e9125c730a5d5fef95b44c5f3977a2d3e1bdc45978cc5ccccd6ec76ef10205618fa7ebd50c0765ed6b851ccf71631b2a3ec7b6b89ebd68a5a037523952b5a29468663a7eda4b37ea54e8ab8c6af6a14cf1e815d451ee47028ee42ab3a1c9208fe3a7df238a028ee5be7c7213ab63ffa9c1d1282963905ddde1d2d",
+    "1459d8e492e597d955b2dc9a3fc18f095e28103801ee9c56ed21590f2809d0342a6d8da82c0941e8e2820576468dc28dc809fd00a55424a6437629b7d8a",
+    "b400adc0fda8a70a615c4e69fa5dd14405fdf33490b9608ddd6506330b568ec6945e151f62b9e471aa972005aa7a51fa92819308cec2994aaff4088c0986d505e803f5dc8d97d0be311c299fcbed546feec46fce1c5f286d9fe6d10aca49335ef86693b256317771650856bd406700323e4d284476d67284f773a91f42f56b26",
+    "c1d874dbf3f05d482c8f77549f14af9895904a3fa571e472fba2efaa18e8fcdfa42f94f5300bbbe205ea6f97f9f5fd70e39e7cb21925aaeace21ef7aa3d446541ba80242153dd775a57359aefad2921461bd956193086520b07e74f67626425e689183041595b6b708731914bbd662f4466d935592048f5a662771f7c80d628b",
+    "6707517cee51b343873b8ac1cf60d251bed9e38c4a8a28b6baab277ef0f28695c3e4d731d2e550328a4ec47ba3deda328e2be9d04a3a699bbe956667b1a0e7fff1f5c0149ed3854cb5a54e899bd905af786f51f21f81a84a9f4a5d7ae867beaccda1d70d2a21a7ea2da08d09796c8faef16b0706e04509d9afa7a134c57537d1",
+    "15aeac8559ecf8aa13508f8cfa963024d80a9a336ff37a68939f2b59e77e4cf05b1e2455f758c4359f66cd032655f1f0e16d1aa128554cf496eb428cb",
+    "90f52f1dd9053ea46fb27468094758477e3b4e05b8d33d539a196f2725c1ec77cd4ffdfd8ff2827037d5e07f368f8a16268c3dc6b0789da8ec90749e36686114ce0adb44d1e3ef8847fe0d395dcc89b1f2e7a3ef74c0d2e4d7a2603be41eb48ab2ac5092f3019036813041b06e6e360b35df0988178c803023d8c2c3ab77fd2f",
+    "66e881dcae0407130960db7dc0848de7909c04c5b60f4ba345c8eca84c88d2528be221da1d6ecff0b06f1c6347459462ab0534569b03e9182e89013d7fa4181cef9f98b685eaaf2146dc94319dfa0047f677d213c8dae7d4b62e7cd9f9bd0ba541b8e6ea048f4648fc8c9410ef5ddc71abfd90344b01ea96162db48be202d549",
+    "4651b535483f49c0549dc56232a1cb7a30587fd0cd266cf1755142587e103c04181a8d48bb9b4819540cb276e9e2e62a9ecf0eade967c57c0800007896a3cccddb76e1dfe58478d3dc6c0d0e57c51635cd89e4028705b3af8e9f699bf01cb1f8f554b32937e23318f8106c688562e4b686dda9a43fc4d4345545d2d40d88124d",
+    "a7e53f5f40a322461cb23304c2b30d61f9e2dd550038e73b53899ddc12c66c97d279fca26086044a8c87c5f5818c494f9c7c27f8d935aa0c14b123",
+    "617ba11092df5d20aba9e8f00e315e23c7df5768996ba852fc15a1cea220167c5373ceaeda1212afad18474e059c3e0053bedec84e895db5681c5e0857e306d2a88e9ff5883e01363b3a6b5880aefd0336f3c65e8e67f19e3063c5771c78fe92deb5cbd1311cb98d19ce36828c1f2e5608b817f1be7b00e3991a2f82fb637f6b",
+    "3982836b542bd0ec23a1f44cd2998659343f957e2cc75d140bc09adb02d51a4b16998301ba8b1693900e444b9f66ad63cb7e12213b82cd483123ebe41f0bc175cc6e706f35a67c165494c823d9c9bbfdad88462a2d2fe8e2f0395d7dd836a017186b5bc313f8304f36c44e99ed0599af728524b3ec9b42924b6575067f358286",
+    "6aba1dcc14b36afb86987fc207cd92dccfbfefbdfb391af378d3aff69768ad01452c083747db3b60c91207ce00c1be9bc37c9e34c1801ac475b0cf6c2f81643d6b910dbaf3adafd366512215ed5919290842b65a02f6bf5c11d29d075a641383d46b3699d9942435142812d67ff18e9e1f127f5ba1efe61f9849a8baa062cfe7",
+    "88251ef7ee329cdd21a816d32c00f9c77090eddf14a355e3e1e70657352e528fb0953172192daa12e6e11661273d262caac11329b342e57e4165c7",
+    "bdd80432c2361fb9c505973c3a9702a1b91598cc9e11a913c9d98209d9a348cd1da9bb21bcdf6ac43a3a2ca467a78ad89bfcafcbe49a2eb35ee6decc333d796a3836f53ef51da2c02ddca305af47f7a77a9260af0371ad5ee33aa4281f08972fed16c2d5fb6a743a173cb4709ac371546f2026d0226f2b16ca5bd31c530898e8",
+    "48f379098d3e0c00d10fa9907244d3ba2a3a83623964434ee6f1d378d4a445ef82d3f745e32b349d9041dd996547556467de8409f87e57779f743751213bfcd1ed437e3e63f70dd20e27edb8485b764b6e7235d17d79c4c9c1bc3b12d45089b7062a77e398137d7394b0ee01f9b0f75d366d80e1548e5b61a8182b9e952fe8cd",
+    "d03a91ece823cd7056ab373836c99f98fa45d7ca20c82d0c956e55f9cc31e26ffc3a408686f7198652538f4893ab4e943f6f996597ed2c0bbdd13bb405cec5e88f1726af6d349741d45ae09977c634f51ddebed2f50b22e3e74cc973d74a991ce29d6876b372b64d9f351f56efdc12fa9486150947f1b00de8ed34455adc94e9",
+    "bf3ac884445f8abf1e1d1f30588c63e093d293b63347b85eccd8f380a4f2a13bd69840badab17120191205cd0cac3d0f532f56012272566ca86d5",
+    "736413bf711f50e3581c8eb5cde16fbe37a2e71891678ce29bdae57f1d5ebf8e83ca0cd9dfc933c5f9fba2c0c99ea569480edeae20e3818d033a8b99234689c07767e7da00aab01e0fa396003d8c94f0b7b2737b38c1f6cfc4332930d0b876e30d3ff8894a74976624837e8dca4b9ec2f264d5819647ae8b69026313b0f46b86",
+    "973946c3cfac62f4f5d5d0bd8bfe433f83b55a5dd2352a2d6b3bd1f1e2acd96095288caa926f445617aa7bd5c1a5d75ef6b7e13bc73156c57cdfcafc9025f172c933cc708c9059c156c5ea2e235b0ffe725c7ba4ae64581538423ff409f8a17e2fd3afe86ef714a7c9e09a952365ec44a54b0639035f2c21ca562bfbc571a2d1",
+    "8417294ac7e76847474400a8ad10f1b9410b8e1fc4b7ae232b43116998d7dc6655147362a82d18683e29376cd236b910b3f1bd4b3cc0e3965747c8996917017c1c84716b690162af38fd95653ae6b13cfb6698a055e732bf8e240e1f201cd8a0d65fcdada5a62751597ceada53f92a192ee730d8d9b940d2130dbbc8d0c3418d",
+    "2a134fabd91287c80a99a57a133f82612493234fd01d8cc52100430fad500ad00a8ea5e89200acddb48607da1d7bfc598f9fa837d1bdf07cf688",
+    "093e74e9b64589de8659e933bc009d240654d6e6d6617268055382181cc6cd98bfe3bf54e38ee15f2d667aade83a8a8c8fcf8e7a39ca921ae769502e5a09312ae44c7b1a1ef3885ccec3b2e50afa8f18723a321c9b23081e2690387d643a46ed9bde54b3dba70676f7f58c6b76795217d8a014c3cf1184085cb75bb0720509de",
+    "7955e068a39eb6a56c3632e462e8bb5ebca98a7884cbf12f016049e3ffb26d22e3c5fe5d6d7f0904691c14690a33e7def9da981fc824a78637f0735916831e2a1743c1a6537bb667f9ffa656d10acbe67714513bbf88ab434c8efb67aa9b1cdd61749fce0a5c4e5006dfdfe867174d2495d90c9e0f695f29e778049014e8233a",
+    "276424e855ecf09ecdcf5a4cb2874ef9c346609784bb9820b4200630b8e8b3fac5447ee4406729161504dfe6ec8df0970aa39e6877bc76cdd3d1312cef853775fc6f390025996864627e4b2deaab3a7156b7ad58a135f1992541f5dddf5f9c04ed47ca662a84e7f72c3e1f6a3eeb11c1b0df945840b46903a6c285103b577163",
+    "17c3fd22c7eb925e1229ac70ec8fc0776e806f0004619bca78d341b9d5efbdadeddd83b9a3b3cc79888294120bcb1add6f14ad373ceec0f9434",
+    "a00edd55620e0639bdf18419e80ce9e55c3e5b485a91c12bfe5d583caf062c9778336c7e7c4ae3d32c0ff48506962190bc9b52382f072aeaead44dc480ff13443d828f21df856251953c3eae38b14544837b8c8dae4bba7c6fcf5ad1df108786031a5e34590cf200d9884ea3cef5351b9f0ca58164229385acd7cbe93a52511c",
+    "86ced27285c2e5886e107a01924be8a1ccb542879268c7081579db0d16007ac30ded05b9bff8e8d4498a9d91c8c14a61d9512eee425aa4e4a83acfaeef4a645b0027824e642cda19349c3a71ceb4c102069c4235a1efa214d3b99eba96f73e229792af90aa314b9bd441188015743c12295bfddbe0eade1827e4dfb47ed805f3",
+    "6d76b6742001e78a91720e9fd5d0cd3785361b9284b48babd95502bd51c8c66509f4e23882ee0330deeba1fe24da2c5fd6630d0796697c680ac0c91b9c2ed4ff7f9833fb9b99e670e22eab0be05672697e7c808e30e4265cceec5a6d753183d055ad917467d8212dcb754d5781654bfa0e5265e5eaa1fde55cd6cd1638cf8db9",
+    "1366ee029bf642466767b4e6c922df2a7b6e3b98508bcfec6802c73a6ec70730552e32fec0a64089e3b3c25373af908bdb1c592dad6f0ff1f",
+    "41e62316a73dfdb55d22e97ca355e47d4ff5ae26b5b64ade7a3aa49c48e3d149184184bcc54f4cc0c65b96d03573101c324496edac845e4a4def3ac63a9fe3df568ae4aca2092201eb033ecd1dfa94a91dc7efa98e6efca94f03991c05ca9d89f2c437711909b9c1b140b28ec95fa2fe81d9907039aa5ba772a079de34ef1683",
+    "fdcb8e4a0fa973b1652a391e71f06efafe47c5b1d3a901500409062d3a306600fd5504441c2ce06d7f52d5f0dc3ba9c0cec2410c4dc9d092faba566a7f5daa56ca593c19f8b6d50c13d631681442c0b893ea521bf9188492e2ac0d5ec172f08eb9415fcc778c5acce1b4dc293e2e346d350414394da734b43a2fe153f7cf6868",
+    "d2f02cb6a9364ec0b5f7a6f9439bc8d918fb2c5fa94880a019f7a7d997c40b5d32aad26577af379cff3e625a9a15f01f58fd66b14febc29e96345ba2651f390a1c43c9e7a2a83fd68f3b72a87f446ed393b38f9a622ba2003db715c589c7460df99cea46e6b62cf40d521cd4b251cab4ff2f7f85e2e88a5f288b74a7b1b28375",
+    "1bb9603a12cd008f927150a34c0747c4c99a423d276f41c2ddb59890f1563d568e3b0fe34133d7a3f81dbf870a0f50a87c4c097b2474d7df",
+    "6e2ffcc10cc74b02ff2ac2effa037699458f9fa70674c57d98c198b04fc8d2f9d910705b31edd47564a57f2a94f8685daa8029efb3d0be40d02cf291620b49ea2a72ce90934cd16764bd72f607dc3e20c6a5e4f69ae232bef5c3ee9ba32fd8440ecb3d4b939a8d2a5708309da349f6aad83a8bc1489f41718e708addd0df3f3f",
+    "e27dd51580a6bf82997ea862218869ed4f1e2548a5b729c03d60d6a6e7441850d97a00f8214927f06f979f8cad05eb588515921e3401c14c87695a3973131d478555430b0a8a15dd0b068c0978cd08bda120dae33d3290f532d3046c146b3c7c690ad82a6d8091a21e7eb2b7e37ed3a74991bef1ed5f735c7fdc0952ee0a5771",
+    "b56bd05085d39e55ab81504416916afc091e9ba30df1d76d84981a49477b3553be760ee062b2abe6b0c319c5c0ae24bcc1fcb25179107e97aefb4a2e871bbbbc8ec2c7ab96b469bee00f3282739aafe07649b2c4360b55b0e99fc94f54ad77582534e485467c8771df773ce674ccd1467d4de5f8f8ed46847190731e193bbe39",
+    "14f626a04752c7ecf55ceb07a170fb9566b780aa4612b9a6dc5f04f482f44b78e588a0690904c7f9cbbf87d535c2bea61f21078a8d7ccc6",
+    "694f14b37338ca151592c7e7cfa8ae15a1773c1b8c573a957959b83befaa0ab1dce7831380c5041e0c5aa6602979fa3d372400f7a650a52b3e4c2d704eb3f253f09ea1696973eaf231afa41b35bcfc68a9eae90f74f5bd651b54c751db335b9c10c7ba3172ae4ddbce59da2a037aaf42a98497bf560861aabd328cc9a7b19d39",
+    "b083a3b73abf405d3cd0b7e41dfa8186e2a9150056ab8c45267b5ac23f24fb901a788a3556f47aef77da22ec4f9b1dbfb3cabbe8aa201de382d5a1408221d06e860c63e7f564388715469558e627b07aa6ecf5f0856a03a6976d0681f8d3dddf7b726bef67378bdfe1dd458bce931b47fe29b8474a006b835b8313f0dbe2fdae",
+    "2eb11cc7b6bf2f382f0a56e9d07e8f16225079d078658030738f580f28c9379ba59069c311982e49f736e65c1350d86ee2b3fec1214443e9f2bea91003e87b4c46b0c899520d33b1d12e909abcbcef41362b4fb2a3633bae2c44772f5d41c81bfc826da63ff98ca4820357b623685e414063fcf854b7f39a7ca426fa78a46925",
+    "1312afd787c4dc4f7db4b074a9e7fbd850eb5f840d2bd572cc8cffac34e0ce5f59fb30d1bf94d8a623b10f1ee8faca97ab483a4df04962",
+    "d867e6422b36acd9afe84f8a91f79d4a3ed715b67ceb50442250e1b5233c380c7e46a380a1b39d96e63314b8f3d39e1a99ef7cd047697601c4ff08c3d167bf6923ff86aa2fed8cad4e8b14db2dda0f9f4baf828683a9739aee623e28074b804b9047a202a145b595317c386f63ca40c759903c137951b4547ee565a7c4979322",
+    "3f9e026a48f32d8e013ce9d6d859fcc66a1b7bdbb68affa767d270381437209db0729f2297eee575e31032ff7aa4fd13a9f78013d013886663a6484347f5815f9c800d6553b43cc38c0fa45711d575a9b623d3b600d47224bfa907a1361e56a01fb970d7526c631467309d0d373c7f3685db92b98086f59891ae47ea98481e22",
+    "f63a2bf180e70deb3157202bd7576f09dd19779642353a429ea3a29db72e0722bc4d9b7f8128f047befbd07a41b49345344de4128881a762a72eb59516edb4c903ff572600c54815a571da0fc55571563cf8f4cc9e1c403e6f8150b7aea87a295e352c76553715eac0189131e49caca1c42f2c1324912eaf71c50a392e8e1d33",
+    "5b8fad7ca2e5c37439b60525dd936f2da6d92224cc813d4f8224d1e3233f01726627e723f0de5c8aeafd65c06e4b2c90e3afd76baf96",
+    "f3c4cf5105db56836fd7ef9df33f8d0a34eeede0881a5ddd4f0c00997e493258b025e118c067c9c85a66981d1a43c45df3c123e6c584757bf550d82a80c4e6ee778ba0f4ea6458f1357560e430b1578c7fba4aa3474f6fa97e4fa48ea90a568b7523ae5d32691813b957ad92185b4e02fc2b5e4fe639e2f45793bc3188307b17",
+    "5279987fe2d071d0c48df0c79256e90a1af85768cb0d0769ae49892bfa8d6e4c7f3dcbb865e02f97c19fb8513b6e8b161c3f8339a37813a406ec2891d83ddf1b0a09d6d38edfcec2fc04dfa6026a5f785bcf964c20e5c191ab2c705f16186e11363bcae8f0cabdd29ed28f5e62b5b4d06736c652715e7c1756e7612c2a931a0f",
+    "c5f485e2cde682bd1407a7630fbdc7212a4e956ee1853a14470596e4f003008dfc6fe400c2334ed29a6b5ca4aa25885954144821facfebe79c0b3b784ef6f8fc2cd01f50a535e2d92998e06ca06c36892507b64a72812e58bc4c58c4b9a5a27c55e4789e011fa816a277a7edf191cd83b8ef4b5b1ba7f1291ac3ec7d5ac42ca5",
+    "25af9ffe384a13f6472cf4bb35abdd14b8431bd6ad443e2bba1ad8c61dbe36e4c44bd5ab5632a637616d749a6cd4b9ec4a77e42aed",
+    "8286d7d99538746d2d488e00539c6332c94755236ff6c3bc8a6c2013786ee1fc3ab249a5cc827d124e5d0b9401b875161220e57e5171bf8f779a518208dc74d948dad79db3f811860656eda427af91e89b47f45671e3c5f53c39584b7a9aab8f09451e96940faa3b1cbbc0222cdc53a9abf170e2364cf2e68c00b923ce926c41",
+    "f2d5df529b035cb78a23f623c892c454d44b71f9864b62ddfc09200ff29923d536afde0abdf85c593f0fc23fd6f021733f27e437968c9dafb20e38da647773496db4127c9138b2f156c4b4ac04c455a0e2316fa02df040f879a0a31e88347e1b4e5a00e52a77e60fbd443cace29419b8db62894ff82ed11135c8a3edeb1d71c7",
+    "23033d3ea58818a096f84717ee8a589d930927496483326bd37f20f8e0a4ad79c043f1a38e529d30eb50e21e8d2b3f3073294021db21e6457b40019be04fc50cb1e63c3770a6d28d3aa724c65057b4bca980eb7cb9e3a0884778e82c97716ad0e846aa3b818a9fc38b5dae1d9fa57d87ad90c67e9c07c990e92fa343c420d729",
+    "963ee8318e91bf420133b2797a3f7ef0ccf3e5d7269a93c080ff74dc2b34206ef157e43a6c78b99fd6b27f3d52055e246de2320fa",
+    "d7ae1b7b6c66c6fc17eeacf8a23f9150fdc2831fbb02610b5da39c070bd203da0ab7b9de01b48fad6e62337ba46e56a446da69501d648efe9f398587ea54a5b14946df8ee63826706af720090338ede629e7f9c8d98e93eaa48c7260cb1f323e0e1539ed7cbd1204c490c87195d9f50a52feeccb05409236d83e5856d5a8c938",
+    "d5cc645b92e8c16997fce3ad1152db041d2e363af19e783efa1ae2a2695ea17896078abc94ee58b0362363b3f47f6db0467d7b6e2fc7ac43ea460563d726a17a8d5405cce05e3aaa171a78b98ec091acd5107ed83565d8a4915b891fdfe00fb02315fab7938b958b54b45a0ed229f8388b0c35ab0f2dfbe4316521dd0beed36c",
+    "cfcf8084fba86ca94147d8277e83b7287dc0b12b8fd04459673c590c72003c36e995351d735c37760ae9499be69d9e0fecda8dc447375408559dd5009aa3d0f4a0799a559f49af560acdead74cda09589f6de4b37edcdcb18cd3476a4e2748bf0a9404a988daab361d5a58b345b52614771d9587722d02fd5c0e93a402564073",
+    "ff2fe4bb6384473095f6ecf8318de655788cbe2da2c6d51e18bb041dae9f6920264bd3d5fa8c207600ff3eea2102c6163061a6f",
+    "5622caddbf1586a5eb409b45411d5c129e8fd9549faeefc222360dbf33b4379f76747d6143fe537af8899cb91c03039e6a29ae754eee9d9592182635650fe7518caf8ca1d119c41c5fbb5c5692652d083a353ac8f62b71f04a9392c4ed969033ac55a7214c49cfb8cd9de534e581d559f05c042b4a0c91f9dee9327141bcca4e",
+    "0b4b5a2b657528a7785a15792aabbc51411a5201adeccd12dc2d10c8b2e1b828ef779d109e43e8c4d2b75566fb1cbe40ea42b85584249c36bf7e7e797f0f12e2c9bfb961691745eb581626e1af2c136759e72bb1da3fa58d072de0ba5cd76c0b2b2dbbc6dbfdfc91f989034f80d3d9dec44b9d321c637444013571a68a63512a",
+    "3f43cf487120e2a453b21003cd02d9d93edd5b7b4b97788f09fb41a53e7c70b133fedbe215dd57d9fe4949a1c1a09d90df18e2b5882fecd0ec639b996e895b0a432e49094b83ea3916e191fcae7c73c4f4a7cd690301d73ab66b4890276f91d2c5fd760754f2fb4d62e7151b0059c483f3caaef02e82dc54acc6414be3118dd5",
+    "3ca73f0b6627e240cc34b7f6a507d0b418251dfe5a920bd16720ec3952d66d56d731bde6b492c2cfd231772d2a6264a5aa14b86",
+    "e238c6a06e1647084d5af8ec6814e2bb05bc6eac19bb9e1aa1302d4b16c84ed5f277b69fd55349d11b93a07f066de11a6c3edce47efb4c2e5fadaab1862ec65bba6ce28a29c64bb5d0a190b3bb91de1c2b247f8e3e30a722a771464ea3ee35506659aadd8b6b80eb288bfbeaaa36b4feac46bb6dae6cfcc2806df3f9cf01bd05",
+    "ae77c934d3822def09d677c6ccac3012b50a82d3fdaf40ae2ad9824cecf6c43075f9d068cf5febe827072a9a2fb3d2b828806415f51d73cf118919120dd60779481ee007425a1cdd572c77053982ad4d668fd209cb55b24e3b12237665f48d439cf0c27f567f12d83f5192e9b48f219b9cf17339219c166543d6ad09d2d7b26d",
+    "6ffc51b68be555de9d90b780a62d952c4fcbf2c91d7248399dfa2df0a3a75005b1f0f5052b34e9de9bf226f397f774c55fb8ccd8ee3d5bc21b84741ca8384580fb1e2420afebce20832d41ffd0e9b1967be492a6657d37b45c5b4cf6d04035e7e1da1a9f421262a6a31744c246c57efffecb5aa33c4d1f7c82db9dc1318fdeff",
+    "4d64b3cb0248e7a6b3348a3f0301c01fd69196a601e91744e4702aff2b85d8485db91822540fbb11b54557902dafe81166ac0",
+    "a5a810401fe27e04ebf1c70a62b0a99802a9b44a43b2d83a9b816ea32eb3c22f31788948d27269eab7648d82d3afd2d7bf2b2c1246c888526c50ce193d9d07b2a88ad6fe4369e9e8e1cf6ddc3b0b2b6fd2678376067e7e5f36162d631ae0ec5cf595ae4a41f8a07fb0b6088614b3656e0b4724d9385f4bfc72bd6abbb5513e81",
+    "898ffce7f84a5f3b4e92aba1495f081f9f05a4751d6864367aeaf52ca033380e9f4d425ecc35fe26ca715235c15a35c2a3aa5a7898bed7da8a96410f2d55b3c4313212e4ed387af31b7169476c347b8238da3d77079afac72c4add83560e76cc879058bb154912819bebded3181f848b3eaa5b40bdebae7c3d066a3a6fb72a5d",
+    "b6ffe58ce0f6ef8da22392168653ca9422b36fa28fbf0d72becdf04689d0015f83150fc8eea36cc69c062e4b2283e91eb4498cd186a3df8fc5988700aa376ff9ed7c8ea7e28cd68d24539796043bdc1ebbc5889cd94587ac1504208c9fb8f8ac4a8a561e3621de542a66d2ea02408881d37872fd3a944635a5c04bd58d95b649",
+    "16ee478ba6ad1386158f4022dd926ee85452677fe0961256096d68ddd0fa61fcef0034d03da598dab708cf83726f156be9c1",
+    "6612bddcac97cada8ea2af52ca4a72f8a74357ddcb82faacd16f4481584014de8d4e2271b0f08c3fd92a4366467139602c07f9932459a0c1c105235000c9a3aa46f626afd06ed642c218ecc4143a637e3a8edccbb8aab10b716845d4313686761582977e48279e1d8d8eeb3aa8545ee24662be8bc476d26f37dd243a38113237",
+    "2525c41512d3bf69fc3ebb3efb742b079a1df8cad45b3faa6989fc7ea46dab3c4a577e183984474d873d4a7bf7b017dff8f3582394925b897a192def14374a40c294b9e792413557574cc6861171de2a303c9680db42aa842e1b5f3a072e7bcc0f9352be3932045379974f2bc71d49cbba23e0f4fa72db3e6dbb8ee0e0af13d5",
+    "9364d1530dd23dad60d8006e58ca5ea8e9ef51ce1f6aefabedacb3dcfedb0f47d847db292d5adf793468df4633aff027bc0939cf4f925db52aff7b47a1f7974b8b3c5270260ead475827652fb9735e3e392c31fb9ff2f0e6ea1d354945ecbcf0184486fdde06d8cf1ccd10e86d9c0940bde5f02e6a3addf0efe613474e30c527",
+    "a3210550344c500ee217da54c430dfcb11cf9e23bfd90336e8c4b007fbd05284b2a7e949b98a403e9a1b3aeeb23a288498",
+    "f2be9ae6643357100b05f59c6f0b1ed25167667fcbfcc4dd09a8ef50e6d18d1a8879962bbbce910eca36a838f41a5592422ff8db0ffe6dce85dabb6973261dbbf357813eb9436bf8ea8e77fd642e3eebed9cd82a26c6aedd4fa9e56dfa883778fc047928e891342fd4e9f1a3699c558a18776aafc36a074e05f85314a84fd764",
+    "c38ad94ffeabdacfeb69af8cb3a78698c1dbff61cdfb62f52d70c99d9cafa3d873bd57a7e77db29c4c7d01d71a0b6b7d850c676e0e2301597df77585ac881cfbb47b88843aa7b626c3cdf846981736765757af4c5636abdebae30cfd7af5df5a565035d3fd081f627283867e0bef29fa3c15b653a4212beb79c685cfb6fb4295",
+    "5aade6b60581253700ab70cd493ff8ad8f45adaa3951ca0b4c34a7d3b739187a2c1b186547be31734c6c1c203eb97d2d13fbb5804b94bfa707c7891a7e3c9eac304684cb025c72d95a95b5f75ca6ac3ec9e3d522437d103d2303a0cc9ab13dbe17dff3ad7872e8d46eec2df787266eaaf608622e173c67e5b133536c97b39483",
+    "14fdfd434e370bc8e7a85627560474a841256f1cc496802b5ad9664fb02d3488b0035a2ee5f9b355993ce028806de07ee1",
+    "ea50bb0fa2d652d9226c43e878426c0722f93a2c0794964df99425d5d49a90b2dc2ac1071c40c4062866492e85aff29d8a5ed0e5e62e7cb0d64e3c927b3b9bd4fb11c1ecd98e8d4532fc4acc0e02b7741c9fe20c351744f7d25a0aeb2912966bcba8bb5a2034a9a5b5bf586284b31d06f0e090020670eb523d62b164b4822787",
+    "9a25ed0e7d12c0290fe72c0377219f6fbf2b005b164573b153ebf96d36bc668a6e59b208b29e941757b82096b398a83aef5b8bec84b5087205c9ef7870034b0da029d547353100399e90528deccf8047e308cfddcd86a214ca25797839b59c11f44059befd71541b30f2be7fae48ad65fd6b1a32bff8aefc685581da8e476c78",
+    "4e49c5546d85e0a62d433ab937cf13ef2dc90f043d0bc196154dc3a4f2d0887d343eff9b6f1218cb62ede0779df0c10a77b6f551abc8241fe4fdaf45ae45fc6ce0ca95b8383a3db15c731f49a3d5e8ecb87b7625b96d0d09104ad1a81a129b17aa11477122bd1590dc6973974cce857300daedfe813b4a34a35ee084487a7fad",
+    "a908f4e24c6607b4d4406ce3c7a17a8c4a41d43e144911e694a49d9525d36ec14d817cd82637fdcbadf3da4af31ba770",
+    "1da5ba0a23db12506fca0f888bb7eb9eda5991258e00f590d05b2b01ad9eb07651dc4a1e9c960792a79f939bd27b7465d03a8528d4afb568c074eea8af31c37239a8f8b6e88c49cc7cf938f4c368c496e1024daf484f592e78ad18de4bca770811000ecc2fbd462ca8217ce8d1e929bb5b635553a1f1892df7d1438dffda8362",
+    "1b532f270272f90ae1841b3162e50df86717387e6538f8977bd5323f4d57bde4fba7fb13d5571a9be0d70865b1cd4a6202d2cf180c74502183ef5071b10378130fbfff1cb5d49c70dc1cd48d2b84f01b0aedaaa6a9cf1bf7a98e37444c98d891bff2adcfb9710f3f95795aacb4763b66831924ab122b5351649b9e532023390a",
+    "1a299a26f076b4f50ef4111cdb1f31ad88d4cbd9547c59ec518e6c6646d4bfdba52790d5516fcd67e8dfa20b106c558c82a527813ba282ec4569c0665d6095a1139698538bb1355e52e99040b23df93647385c4684c1676e9620e8786e292503ef3f37f28053023390ee7b567ba7d3b5981d3485576ac9fab238eb5629e6f063",
+    "3960db8eb1cf6310ea7e21b69b1582a4cf11a940b70a498a275810fa8b1fc4a34489ca4e95102cd3878f2438347f8fe",
+    "333418061eec1d057cbd08c582d98b4b93ea515fb2d8f69a70770e62c1370425235e9195ba85f200084fd6cc504cdf17cfbc0d1661cf59ba5dc04e01c63c286efca176c87db9b0445f8448d7f0d747e45991f2f880ab95669ddf33f9c3f7fed7efa3d7c377f5b49e28facd820ea83d40e4222829565f5cb647f3e4e90ae9e324",
+    "1825aebdbc28f8dcd30f962382db57b34e47e2b5d28c6adc4802d024f1d8f7a7d3396d37c7e8c18f06eef6a27a0603a28f3ee18555f01e9419f7aee5bd91a4dadf67985020f1e7764a5f6a1d77233fd6b1d5039b518bb4a7e21081c420ba52c75046a502b9463bbddf2db91fef1ad450bb9a256fe8ac6bda21d7a47f47e61c85",
+    "8c6c7f522a0e159e0a80d31b619fa7b5fce2dd8c652896474a43f0bd5ddbc7ff6d1107c917ae2309239b64a8f021714da7e638f39383c4928fb226974ec294819bcb0b90e617131ff9d85b8dde8a31149461726295b4dc7621eee7613ce12037a0fcd070992bf4951ca0bd160100e6e5a372e8c64696c71fb1243963c794f887",
+    "2b0f8d9362a7be5857755c49f02f5e2b7e3680d85f51f3f5507d245f650528ebb5231b0149fed05da29be04824db1",
+    "29582bef4d0262b8d22f7f4046b5f1b277d68efb703c19985ece062e8294791e27e795a39be95c0262462fb37092d134c2c3f46a1e517c7e7b86179342beacb16ad9afee67de299584ade8f83867564a3953e8ac8f4944dc95ec915bc24f4adbcd16dba2474a33a99b93bb2207e258a25f026bf31fc26d4ac85827db0341ca2d",
+    "a51a85e8fa218fabc59bc598dfa87d2f0ee1b5d46665e8e2fd059adbfb610ee0f423a19d3719dec5d82c8da7fe9f45e6118abc27cd6524930f7d7c0709f02a6582761fa9c7588ffdbfa922711e7a733f1a1c0eb0514580a3352f787f3d6ecb15a3612ac714bd08d78ba0687153bdb164900eff7b3f314c24cc73a626f8510bba",
+    "3ab7dcaba7d7212fd38ca745f860b17bdaebc3cfdae0a3de34bd66b7900b384853a38de7414fc987379cb181422381cf86caf57c107d7ac5aeb961dcd9ed3d5e50462053e1a88e95ba57ed7a53f8571c679fe7114e14d7311648adbe2e37d1670c22182d7c0e45c4fce4cf87a2852f6ea75a36c616bc9140750f7354aad75225",
+    "1fe4a7362ed1879c192e1a6ccf2c6590c9128bcda12b5dec5cde2b4daeeee9d5b58e5e45c8ece221fb993a6ffa18",
+    "3280ca9a0db4ede02181589b2f4ea8e51fe010f0a7df41c620bc4c3bc5cb2f6dd87d64a860e88c1f207c27d79a7de309d5fcec6867a5a7c9a86b04f89950a87af142dc94b96cdde26e246dcb2db10c76af553e7dc76e7dd05e7dbca9ef4c1bf61f96350f53be445ee58a723e68bcfb8db63c7262534c777b7ae31eae23b71cb5",
+    "effb6da7072c4f7dd22d35c713b773229357b5d02dd7cac100d2a8dcad93bc2abf17c38ce4db8a4a6eb8f3d6999bbe2333305425bb2f65996fc47d0d690b60dcb7a4fff624348b859426ab39baada0bd6d9ffbdbd8cef4af05f5cf033e1c4757cf21f606dce1409ee0695a3c13952f7d046b7c4aa57d9d5b28039ffb87a335e9",
+    "cc8194f72a0815f9241d5de65b66dc3d5cd0cf61a0f941261ef9c26d94faec1e5b9c748fed2d4469a27e9c73097227f425071fd5116095eeed3e8a150d90a20d69085b517c7f3ae5f39c61479df6331b4438a4f5f810ef5a6d63b462f388fa6754ac09a9ef3c1465a4f2454d880dc2d016349018e761fbb49ca199d1d7598ab5",
+    "17be9feefb3a8fbbbc347f0bf34b772673ce3d8bc854e11744c514a8a0adca700ce88597af2389d2aa0c54fc8a4",
+    "2b7f98e323a20a0757ce341253e75bba84be5f9fe1f90026eda8bd9637d22a845c8eb331df24df98ef84e341362d36f727e60cf68e5c3eb59b56ac0387e8374d3e453324b098e1da0ec2571eaa3895237c909b66a2837f9f8bdc37362347e02afa5710c040934b7e130f7689c70d9473105045143001e6ef82aa905f7fd20f0c",
+    "183a221b3846a89f8dddbb4af47f9317eea5ea4b9c1c16deea512bd765bf5a221b3238328798bf16998f218de1dccd5f9321da9f63059528237244ef8bc2394b05be701a01f171dd55d96201d1d0da10d126d106a67540e4b2a61eec5b35d9642d971fb96f8e545dccca21581366cbd22c5a902dcc84e4ea881312ae4f5fd817",
+    "650eb551367b2b619e55ae172827b5ef3de0461034ad84b64a76e3532aedd0c4930928341a5441263889609ff9e6503a3c475ad61b31ca8ff4e8ee65bd32d7ccae5500c97d85489de5f24beac55b870476d109c75d3882f9bd4e520c0a503fbb559cdd4371fe468d59270201c3b97a6befbd005b0a2a0aba533429538a12f2b5",
+    "671305574f77b4c0edb86835092f0e50d6396cd464a5a367f73ef2a739e0fe639be9e21583b703225eaf29ba1",
+    "d69678e8dbbdee1dc072193aff6d32fec1b695574a92d3d95cda88db2e77b91f8cffbb8019f07f489ca7f747269ec99ca9290f3761150afe1946ecadd6349d417c2cf4df38b4f4cbd262a7fe0a33dced3e40face312de987b56b2670e414eeee599dc803c27147d14b5efb69ce811609bbff6d636da2ee54af123fe88d34941d",
+    "0a7d8d85e5cd65fddfb117876e9e0464cfe79289aa4970eb7aa954df5fb8b4fd278709493150828a426cd9d498f3ce161930d7e78b89d5fdc0516b652c5b614cbfd54bc170a08233fcb94ce92b431a8846f92df5861835d03783f304822e9b0d1bd3790f43d0a85dc2e985bc643d6664e2b2bcb4c96e59a3cbd7b815ad248982",
+    "3bd72876a65c7518bcf12a374e02b632007d7324d0a980c538cefab5ba5b7ea2b839617d2c6554f457b7792d080425feed735deb453adba07f4d4fdc58b7abdc39eda43075eb0d2c1947e3a392731267cc0fe0b687f8f19e6f09ecaf5e114b1f1153f98991634eaca656799968471bc949cb8e9b99d20d610385d3c0d96e8885",
+    "953891b078e3d613c9dcc6a6f9d09438d09896c700d4e1f2763ed744a905030aaf229323b38455e27ee6f16a",
+    "9195a4870d45525d413ca3274615981827c57f6e55e63cdbe1acb9d48b4d00cf9e0f3ff28023345f32e6029f406c4c5670476178f0b17bce20b9f5fb493a5b7a0ca860cf2d0d71849837517ffa8dca70b014a63607cf0bd8aa872f4d778e07e3a1a856c32abce623483c0438cad531a6eb917f74ccc5b710e3a544dc8daae11e",
+    "976addd74aab98b2f100bca0d2f5fa0024cdd67da2e414b35f2446a848f05fd1a09b0715185a975926c2b7bf587f07ffa980581a3f2e557f5f0b79ddba78c60290cefe1630e38c170003c8624f1d11584ef7ed40d1a3f3ea2f71223bdf960ee61d423a0b328a0858958e49b3dd164031fa2ce09b4a3ac6f1cbfd7b9319a5d281",
+    "2c3a852f7e8a258abdf7f3024213d437bded63aac80719a82eee658c2e14f465c8b0744844e7d4fdd3ff3669c846aef36a131412d7edc9b025818e5f4480cd1853728ab8077bab2aee93d364dccaf8911b4b604335b3d4a5ab39df97a4f161e52d4bc7683d14eb5c76193c0f5521ec62fe3469c2901abb00b8a1ffa32f0eca7d",
+    "213398b3b3c4c8cdcb5771c0a93b98782e17150b5a7e206b8c954bee16d8896af14f116d99be326ec695094",
+    "8b70b57a8679c45a835510cf521f0530bf5f8d8758142aacce949a71169a7e19b939599416569c341fa64b695af2ddcad74115c36b3ea02f918bdd485f5eb570bc678b02f8558ca35642deae76afbf9340ed920f55a23a315730ccca4d93f906ab4141a9d52a509cb1ee54512d283d5f359bc8558a4d758d7bef788fde226b3b",
+    "d421324528f9942b47a77ac85e9aee05de5683328fee0735043a31bb67291d1a2388406189ff71a12953befb6c0dc85d2db075b8b9d8f22fcf7ee9842cbcf6039838b07a370cb62b4288373a4d15d4f5fbae6f9f64d3ebb0564b345b8ee90174ccf89ab1a76939c5c180e99d7211c81381f5aa55c37aeddcb9e5aa2168d5ea4b",
+    "b8e32e6ae95517bd381b109d331f2b25adc01574a91ac7af785c389fadbfdb3ec22fd4f799ed3ff5b8d3b70303a645a521411a22761c345e5df53a42d01691f6e6f7fb531052ab73d531280da62a40cbc9cf14b899ae50216498ce543965e02b8e01642b23fa2833e823e2b18dfac4a0cec83d2a312186c0be7edd944a19d02f",
+    "4cd2b64800c1dc073c56ac210b0d25733dcad04b78a61659fe76dd7947fa5e4e7e965cb79ab0a5fd8ded",
+    "332af512dddaa20fcb367b7c300b644ad60224ec9203fc883c47692b469b603cfb0bbe8490c41440f3d20d2d3cbe6bda57ea5c099e6c67497f0e750cc044de8b0908905e6f486eb45a8c9767d6e38a463e5a9b58644f90ede76d2b147736f91f63221ee9fdb7583a36ee78d75605363ec9bc4f6777becb995e756b8b4526b8d2",
+    "8f202e351142554dba3d2f41a2916fde9045a03b9b1bee4e59cf601c0e7434864c00b82c94094e324a9253ce885e8d93a82399c22eaa1859b8ce4643dbe22e39dcd7d1c568fb1249915e1f00451ea7c00daf4d0f6ca9b042ccaeeb7cdf10ffa61cc3b73a0a4265e0530cf9a50a0a4d529e441bbdc9cd0b7a5b3ae211b2f295d6",
+    "b01593e1988a165703daa3326e24edf695476231288635d5607f0d39a07257b02a4ef7360c04e96376f8404c9db9e6c8d0dfefdcf63ec52bb81098d0b9322720a23c7d286a09d920bc57781c38b5e388943d71327c55e4760926aee2288fdb11dc669517957afbc6258c37bdec7395a7cd4ee6cc009c8b43b2888a2e277481f9",
+    "5b2fc6b895a4fcfff25efcd697a4816e9ef40ded71b20d813eb23ec972f7db8af028e919f615c4c2f373",
+    "303f1cace85c919088a7fe4fb604d929cf9412a8beb58ea656d63a2d5592f356b202a1deb84042c006a52f35d09f0ecd2fa3f31e85580fe72b59c739df49a2504cf7edd30fbc238e8e9ed64cde2378710f72320ddb29dc199338d50bd4baa1e9063c62f439a75c70ddcbd2ac6c949a708cdaf5cb3ac874b0bde669031084bdba",
+    "fa164d085eb728decf69b175f9c08655da69c2ae39cf3e1a6e57e3b9c9202559fd4a8a7447cd7113b82b21702eb21c7ce77e21f55f17898c151716048f4ab0e4d1cc9206b61617b6ae3308b6c8b89fa3e57313fbbd2cd39f48ef29a0b9c682dda21e6cf8d4bcad0aae7817793e6002ac465cb7a0ffe88d7828e8b2f4ed471a8a",
+    "07d46785fd9236725cedb925b571067a0452d6d8c0453e7fb37b16aa75a133ebfa8e6595c8a053c95c4cad3d51c1578c1fd1f5046ce53f9108cfd3876c22fa4b2cbbea5cd215aeeb1b68c653e9ac3b5b65c1733a73a8085d0456df79b2906eaf9e96e3edbca71fa0b5161f4f3b698e48fa21dcdd4b2accba098d1094bd51dbdb",
+    "36e02fdbe4ffabdd5fbf91c723878a1839050b1ad5d959d4903fb48d76c7a1669cc6cf139e82a0d06fc",
+    "53acaeb54b9cdeee7ed7a12ec13324fdd69e6368365f4eae2cc632f8e042180ee6ce6719e79ed1a2dd079b5a25c2d26ff6d1c2e8ee50a0b0c2e4ea9c1c7622cd4866384ea988746445b638408ed166c159aa88ca66d379ef7b3ec54aa4e979be81a79d27a597cbe2b6b034d6032878f4393c68d935fbb85bae60c4bb486984fa",
+    "a17683233883e62e69078f0e66af2ee2b9bd330f542377e3b6abdc09461f4ad404f0e138f9effa9d94190a8eb1f657daead86c25bc9927976d297bfbc7640bf70b656071062948dd8b71388da75a22267eb2ee6ddf4ea6d3adb30ec2c48d200fbc1e18982e27d2c44865ae951b6544ec0449237dab1772a9589ac83e98dc3614",
+    "a367b7e597f00ff42a8c34b7d9788e1e06555facc40a03a6bcc76ff42744a128a2c3d3fe0aff84f4a81bd81181a9645a5ad4eea5b57e7663bbfc011643371e20d6924f893ae6a281da06cbca667d6e7bc29d55d532160f384790d3a6f5e965e51d0a101940ded5174eab3f42abdfa8979847ac0c6256f5e1173b36a6b4bb84ad",
+    "15442a42bc8c31fab20e48204148143afbf9e48c03db4ad6800fcfb38c198e9136977bd39422e34722",
+    "b83d0a081da87c2c47313a7237e106f9d12e1554dcd8d52edb501b3e9c1d14725e67f8575950f660d1568eeca86749cbf2bb7e08e8df014bd2ae527812788650d2786fb792062348a22de810b4869221982adacaae5fa32bf277aa61859450f75dcedcf1004cde695bcf8e61789d7dbdf7fd7059186cf26b00e7eab995ca7985",
+    "e614980b41c95bc8f42b2cf42c2270f869f2fd72a9a90b01b9fc8665cfbe90acc004d208c21f0fec828b8132ba297f3b06b82dfd7a866db6d2aa2d0fdde09b8e44efb78391b58b8b8ccbc50714be78b60c52440beba007d9e8e2c21c36e4c9e438a79fddb81ad916d254166f31d647099f2f06eb161cce51904ffddff4491b85",
+    "802a7f9f0a1f365db34d10162a71bd3090223ba7d38dd17d356606ef15a13d4abb28428b644f1a98c52a8fbe18a4a398e503b7edcd1a27e39db8cf4892ea6ed513552515506656f7edd2ac9be5f58f8804c91941193bd6c5758d336bd9ecadaa098d312ca12ede486355a8ae6dad376a17b0d0fd0a5a2403de814a35b482d3e1",
+    "2b3a630b87487ac9bbc7058162a3a0a0640db653da5fa4a4c3897a25c86f71a800099bb1d066faad",
+    "366de3c11c68f8d42fa3d00837837173d94917db8329e7a1dbbb00494fcf1aa60f905639b18f919c542d0599288032fae952b6223d7354beced23c534c348042903f6c7ad5bf354154588ed33a117e15a5f5e559d93bfb5605e91e5643e61b196e0a598a7cb4c2711f56a087c7870ade7bbe2966e391b17bb145b60962dc0e58",
+    "fd0244a7408db58e61645854b657e92e2949b7f98a487e4bf606e68f503f3de6b593cbb857257a71e86603bfd605f8a423a61a02112861b682a2433c6b2b8ce93678bb15f1d42ffd90a01223dd24e94872bd8bd939f85bb3d94aedd1f25cc8195ebc27ed953c6e344ea43729ed6a8cddcb16f3ce8182b8ec6e1bdcdbc0e74f8b",
+    "2b00638d780e19caee0897275893501ef017e3727d8dcd8ad1ff9daf486f2bf8f1a5082452d3f32bded5080bac7249fced5cde1e3d14ca3dd070baeeb747a247f44ecac669855afcedda5b198e7780b45d6b1c9fa1968a6a14437f18b1ad02d413ce61a9cda229bf9b711de19aae1fe3a069574c4b105203ab3d5d8af4ccf141",
+    "14db8432c78406ed63e4ac4e67179bef58586d8c372fbab23a05d1632eef9e23e7f63c08b85ea7",
+    "e0eef0fbdb7add0e89fd7d0c4a436277642485d2046ea5eab637ac8c81e21e04ba01ccb658e4a9578e530063a347d1c6be5aeb883d4a3947f93222df8ef379bee89bffee5e743cce5bbac46c677e6f483b28412dbdbb0a32b38320fef68689a62451463d03185072fc8e4f2ddedaa01b0d1a251a21976739f18f0dd8236d7c62",
+    "79f858e52a5402296c5fdb704fda41a77b8d13985c01758942873c97677320ba06ef20ba1d051617045d0da2a5575df8afac81b641eb3197c285a87c40a50ce37c15bf9a31f05403788186668a711477fb9769af26d7536f5ffefb30e2ca87d9a24bad46758b37fd371d3731f40dc2b93a75bef493e4833a15ed9d5939e3dab3",
+    "3fcbe018b458b6399062a690baf8d4e758b52a154cf98b3ed48de64cf2849904e1318f734b523e8fc4001dccf8f89555427d3ef8f64597866bb2868adc5b2078136478bb0743934caeba406b59a3f95202f97d08c530eaf9158d4794333e9af03a26f1eebfce1de119bf5dae90364fd057e635522c8e2a6f91721ace503f6b8f",
+    "2436ab97781b77bdac755d15ca924ec5eab8b96eed2885ac2e7fc6ba4924369300818ba734839",
+    "4b2ac58d9adeed807ad1651f14a731817fd424f875a6c20a5e0d8626421b87cf65398d50b8223b8c9560844a9275bfff9f12f3bd4e744b4d4f4ca8cfcef93b03e6e05210b7c9b0bbdac0de8939aa3338dd1f6ecd8abd733e11477019d5a8b461a9914a2c78b94ac85a5b5f623a9910bbf6e2326d2ff937be88d8d4c743955859",
+    "badc52fd9e5d231350cd937886a1203f0e2080d17b0c7234b23bbd9e94725ed6c5f5d107368be41694e45eb17e4c721d430f5b4f51c2146473174b8b4651822ccf6dccf19d5e07b97a4186b5b154531c20db62992b14c6258c0c43e5892a4499390537229d97ffeacdaac8d34503a4c979b0b57b7c3f90906054cf78cb3b9555",
+    "d06318ed70a48fcded354e4b362af86a115352f245a90e790dedb2324039712101782e20616c18301ea9ef196ec52b4fd295d18ee43a939322dab53b5aa614a5474acb9648cf6c20d14d586ade1bc95909472bba0da7892a90edfa9caaacd77efb6d14012834ddd1be6bfa7327d3b7288562b9d591d59ae80e82b48145af467f",
+    "cb2fc73ad7ac905747acf453fe72a71863afa2b8c695d8d4917c8a415b7e08c01ee48e7db0b",
+    "9e0e75bdd7f913c21c225b078a13b7aa09696c2aca536c114407466ef06870350da4aecbd7a289e016ae44a3828ba15ffa51bbd3fe9cd006d3c7851b5610c8899457c09641f781c388e5f11fb4c25b5c98bb137a37e798a993cee24a1313eaaeb5f4683d775aa7d3a7780fbf3f6e08cb914d08b42076b6425dfacd01d3980c93",
+    "b2762429c2ecd530fc16203b4503f91f1d81a96a911bc947bfb3b2b56477e5065ba8f933e086642cc28eb2fccc86d8759907e0f4dee4388ccfe268f0bf98a643f9d82f1eae9174724f3d0b7a9f58c1044d7079e0933010d7cb0313c373bb63aa5ef043892fdccc8abca0748d649e8d5d6d8f07d2012c01083822f18ca0e6e7ae",
+    "5d8f4f778893a95271f999e717ff3155fb4541342a5055184aab16ed6875160bf8ace3c83f0d65ec63aa6f1f9c398dd885df5401814e786f0279a18a15e85ecb4df2aa469ab6572463d013d9d3f7e9085654b2bf8c555766037e833fd69f3b2a2922a183001a44d46c8b6eb7368d3d787a7e2377295f23a747616bf9b326cc39",
+    "2a7e7298482aa0cff6833508e2287a3c66117e79cb6053d958e57dcc7ccfc937de0c443ef47",
+    "6827cd560506d49273d6409a8f648a47b1be208ba13fde03715f3b28c5465364cf8866802103b4510a2db7cabe50e5a0df9905f3439357ea7efbcc2709e486cd9281d324722d7a00dbcaf2049f9c34f1c87160996fa6953c3e84cc01de1776fe4e577ee33dfa58f559c47c6a440ab5b3dc6b7b2d13abb763c9b728313821c0c6",
+    "46b15ac2b14af0a1422723e30d4f22c9602e411f36b12cebbe04f1759605e3a8d3107d1e1289b564ebc199805fe50e2dab432a071756aa42230b22a6b0c2fb55ed1e98820e0274eb12db81bc09f3ae1132c25716bc4661db310575c1f629165f52d3c82b1044e57a95a29d0f18f7d5c1a7d88b2c6f33f6aed402e2d9c2faa57b",
+    "a9be0563f5141b9b257cf4dced310fe96cb15166280def980774530a2a4abc98c84c57fed941bf6b7df1d390fcce98cdf285daf734e0fb0f0b0801ab670fd1b3f45e562ea90fc0c2a7c0f4003304a539dfae286d63ceff4179a6a0574422a112eb398a3c46ec99830b976b9f3a485da52f0cfbf499c569d99fce99706cd18ec3",
+    "181db0503f758b3e1d6ee32f00d174edc991514b0683defb3b3ec304eac270a1b5df27351",
+    "6adefb97272a3d03491d1bfd50c585fad37500e03d76b9acd77f1a74e9baa39eea1a63faa1c1bb2ee8b8162ae5463f0dafa54650bd79e1d6192633830ea34b435a3aca0dd3dbb9ecdc241e368312a5c8ec96fc64dd49e4494cb53a4576e83b0d7cdccee9e147e4301258d8c9a9683674b1e27eb33cdd1a178c0201308ee73959",
+    "1cd1355ca8c66d3d4f140b4a73ae65ea771eaf4a4d0ec9c5b3912fa93193d5f962f4fa98e5f3ee8446fd139c4784cf220a78e986693775cde88f4487429f31da24447559bd6a210db4dd77f66a46fccfcbe2ea581616396f8daf086670e4819916c761a2d43142310c2f7eab34b01e0f08e4e70eb32b264cf4e65fb1d03c5b8b",
+    "1336d6293ad510720cb7c061708b4fc18db79f74f3dfefbe760ec256e2631fd5fcbfef3e8c79f2c363e835f2326259d86d23039e4218383df956dcd0fa7fed1e6c75cf5141ac113b41e6400fd61f3cf75ebe76b17b3dcf8bd64f7e456c2d83f0aeaea1b8897073e88a0f2f268e5c2f6bfb27dbe6579bf613172d7c15a683db6b",
+    "18c419a34ba4c1f0adf1c033dc42a6c840bed11f6aa511898f9187078ddb05354e0aecf3",
+    "db676eaf60d06373abcdcccefc073d8b5e82b13a204fe0447fc43e35f0c155cf3cbf397047b95972f72d90dd3f1d5e80329c5ce4836f27d08240753d9155cb00e5ef1188e0d224f5c44b60e831dea77858e6c0f97e4850c81d3082b0da47e534d83a12528123f7658ed3ec5e71cbb806f0ee4a980f66ce789f9d263131135420",
+    "e885d75f9e555928780c0d59b419a4455927245d2fa8fdd1e0ab8d7977052f4603a13310063ed9da36360aa6f3f63f24ccd90c9d752a2ae23fdc4cb0216e9c43613cd08977b6a34b278f353e942eb754335634dcc8c0133b132f2ed458d28c188d7a34b05e7c91a1da65bb1d8561b6c999d8530080c78affc5065bef852575fd",
+    "307a19eeaaddaeb0b9412ed1c0ac78842e9ad5611622329c69ae79000ca63d37c2eb2e1f82e871b7fdb060601a2c13730bcb847c29411616462d5d4318785d4dad70694356a51c83f6d719570a52522e51468ceabbd4e4b1ddd00ddff58bf517874d3ebf45503b98032536a0b457901aa423773078303b0bab983f65a1c35757",
+    "596aaa96baf40d7407ce75ccdc23295833d5b58fb4b9d9f44c5809d1dd7365585ffd60",
+    "aee12b7740646661efcfb3e116ce4372445a46ee13fcbea33a16d0e88c82ecdaaa532f16fdb8e4a380be55acc5063d7a371fd1e11579322fbe87d15ee741610b876b06b3a50d8101b7c078057c32b01019f40ff97addd64c466006fcf22c5ce235e951e813caa48b5af1f2ef680d8212432f11f122b6ba746fc85a56f50983cc",
+    "df9c584a77bb087c00c234d43ac0877789dea4ea5a1f37a5627ed28b38b4cd8c78fd051ff675f3e969c7f1570452f1e9ae4c35f6c98706f0555e6c771b777221be3b0fa3aa10b9007a1c40b23e4da0c2df6e21c012b63ee62adb5477d58f5174dd56ea1091477f1b9fb15b6bcafc4f17316cd5c64e12d78199685eedcea4c277",
+    "441dc1c1e6c946300b58325218ef45d63407a16229b1583a373f50e8ab28f070f0705259a37808301aab11ca0a85dea5eca866e9b9efddf6af0d62d6d78bc690797b68d8432c5d615e604c9af0a791dae447d9e5b472979671c784a9ba07c285d26d8c63fe9e7445fc76ca80ce32a0670c318e07388404bee9f584c1342a40d9",
+    "a245175f13977c1c7d9e6b1c9d02a80379945a878d544caea378fd3d94c7957acdb9f",
+    "0a806ac449fd0d5e59cf0a53e02acb85b11844bf085d03556f28e04d3a72f6da052f630218e8ea1b5263018eacb141f515e55e6e609242913712cd6d010a6b18b1bff9ecc6e74462897f845e1cd182609fe34d129e0f1a46e969ffe10a74918b1ecd17919b3ca638068facfe46e3789c5bc9b2f74ee1acd4a7d99000ce67a6a1",
+    "8b7c8762f55f29e3480bada1359c07bf2621fcfd8d6e6bb0427022230d080d8e55d4359d077ff138a12d663b65b9b96e0a6e7724a296771ee064d77cfd1d685468d967f2743a049aa3152be905d00a4f49a7062e2fde02824e7fe962aa9819cff7e806fa86a1f9eaa6f72f430179bf9e9f2af385315fc836f31fff5a123be555",
+    "1f924e01427013532dd22b3dac6b40f4649f31635646cf262b4cef6ffd9d0cf1a2f7e8b651551b6615d218095e697161a6753a68cf428d99604f12f6a506429a6ab87dd857f026d7463f4a4ff837559f51dd35857421ae5a6557e7aa4e2b260c375a78ca91a25ebf786ab887da40a87a1cfcd70ffef8f425ed24a2dd35b2b365",
+    "2526e8ea0da5a69b2ebc6fd3c09e22656c9f4bf5c11f4055ebe81aed1456589b7b47",
+    "fb1b1ab62c8433df5f699cbfb24540db259e559f7a378f5b04d982827e582a57f43b9036266a099b33d4410df45923ef79c510abf8d90a17213a87accd5400d3046ae7d3381747678af566df85086ad645a70fb78e76f9d06844cdaec319e8c096b23f4d651b28b372c43eea1ea3b10055d1b6fdb418b15c1aeca8c99a2c51aa",
+    "822700dc90dfb11c7ffdb380f07fb322b23c19b9efde0307438739063b094a1dc721577f06809d85048787a8d7c4a046c4c1cbac1202602c233398cd0f4751d4445905c8a9e6b6de9fc08f8c382a6227d3f6a2f53076658eb5748971c9db4d3f68a708d543d0d7670503fb6e47d86577d9dd122fd86c66f29126867b0b18bb0a",
+    "7613b9a75683021ba751a2421766c6d4d7623bcf2c9240b8161445cbe4f758ffe432d2ec3b59060276db7cfc13f6ab29b0137f4cd92e00ac1dd96cfce55b3d67efdf2d3af2ae9b78cf002dfd02f7a2b132018b7b618031213a921c825f81c28277d969ed95da94becf687ad9a4d90e93f0cd92ce07da052b86b5d92c5afe3a1b",
+    "2e850e6bc03c791fd034348a7420151529e5ec775568d463aa3ca6ee8c8ba216dc",
+    "b45a515faf2358654dab4b55909a0d6e11f7bb0b45ca6c8edc04363833e98fa116e4752dfeba4ae4b855a800f6ea406abf081850ab6783224b94b95081c93fa8b926844d4d647c062bd0cf0e901ee707735fa5a243969a166f630c0bffca16358984f566a7c97dbd5fa59542f2bfbac5c637a384555dd7a6c167abb7e33f2625",
+    "fef950df37df1548e537b9c75f8bbfd77645fc06f64ef22046677d1219fd5c506cd23aab0a3713940d05ab9ec2192bcb568d07e290cf85b1f8f2d6873b81e457f41ff8ca3ed212e9320146d579a21935e250f6f9527104ca84a6a95bc35240a12e8a64ad56c1d5f1cacc5d913ac9c6fa9a5264fab7ab47c06f7084b8b9faddb8",
+    "38e3f7931d4cbb1ae0f99f1edd9d36eb07d3a44d7f8680e801d77b1e1d8346302145d8df4463bccf72f9310014f7e7fb034ba5e1827d2ff4207b5c9cecb2c59582e9a216ae426fb3add72d4b21a9d55bac2badedfe7969f26ab94fe7772b49d02ac0d04284ffcd2a90de907ef043d7c266623ad0a3d3251b8aa15124ad78927f",
+    "217b8acbbdeea6944ae2351b774ac884d5dd9f68ff253dcd18fbca89b63436fe6",
+    "35b5f09cf09ddab96edae564760a467cd47704726fd293641af52eea2b2fafd306aa6bf2c41adef421798e0a14ed0d74887a0b3ac7e736065828837fd93ec8152678692718f3e636937ce7fe3c3c15ad5703ec5b1be3a4692b50bb6b39b100e498ce2dfbeb38f942da22f4f02d766496d55ab321094c93bf835d0311504ae9b7",
+    "515aadab53399220d5dd106d94ee0f056e0ce87252dde702ce0e7a77dd90d57895e0068432d101456a63ba38aa4414ca5499e17b2b3ba80afcda2f1732d4c99fd1be4c71a678cfb91e08b9dbed92a8e4a15ebf4946ade7612888addc887fb2357bef5d9daec50b173514e331cab591ced61e09057cee554c181ae41448e0d9c7",
+    "bbca2ab52fc2dce960a374a8338e46f8b0946f4d49f3ac1608b739d3af67e86d6c5a386456e19dcb9514e44f5e8aebb70720236e708daf1ad4cab691761df26e871426f79cfa165750826f69f71556d54db3923e4a150047d689cca5c83577bb84b6e2212a0a27b1c17c4dbc27eeb813f5755daf11222e2019c78e980db03b93",
+    "88d3c8759cb172b76a1f9eb04ee1d26d6aadcf396e210a0026f21bb720c3f3b",
+    "ae3756d3b434e1a0ffc3f13e058eee97706a38e01f7a3d15a4a34b019d1175b84303171004922beb871f74b7c464ff83b3e8a4b7bd423f1e8a864074992fa21a6089614e8b858b4e7f52c8cd2e36ba645e54cd16c2ae13d1396234295a42137e7d0074d5bcd2f3da83000e78406146f1da98b90e970c8f888662665cf4caed4f",
+    "8c8234314759ab9344797a28ea8c08a63aa2d9d9430cd121006ea1c11d4d04c1d3d7a8ac382a5aa1e6cf68aa8f305e52c1dcb2791cd6b5ddc2a493cd46bbf4064ea1e89d8a252c846077d05cc95e09aa858e16a2f322fd0f360b8413eb5a6032a5422b5ec61744383fea97efb904a2ca872ca9898a24db612e49a955559c2053",
+    "7feeb1c629701d6f2adeab1bfac1f6ad5d2983f4128255ea51612f0971af860e204b571ae8d15c5d99d00a3ab8288601ae61001f6c4b7c19171f19ae0f82b2a3b6fdf33a4251b8f13760e890ae7dcdfb8b34076755accfee1754a2f1885eb04d59e48ae9006df1c89c4c90649286672b93e5203b24c93029a95475f5af9f66bf",
+    "371da1b6ae721191371e9f0c8b4eb3b851aa49f93adc013f9907cdf681818d",
+    "ff7821261001d2f7aa2881e61163737c97ce6bdf112d3a03e9249f9589a04604db2cc0eea8508519a1f324197014c0906b7207d57ea27b853570716c0519a9396b6e77e4ede119ac9b33bc929a4c3474454ec2f77437450e8a641313c00fbb1f9b51f51f0518a731b07c396953612d2a8b92612379f1d5b3b25a44f7193e8336",
+    "7c4cd9dc027959ab4f2d77516f81dd130fef9c67c4bc2df53ac2c05d9fb09a8ec29c708553c9d56a1eac58849d9b74ff4c26e8ff1b4854a301d50d0fdf6e2ac91154ba9c3d5132107c93c004359104f349409f23dfc6157e84318352cf2b0c37309a8b16109264be0f3229f56e351e263100aff47abefc1e8f10e7b681e41341",
+    "192c037f44515310a10b232e6d714f970205a5c4fe98038dd5d67a1b6f0b9dfe45376440c27739143a10de2f7c57e8cf2f0e945ad27fc2a4c32336c6c79231a46054f12e27307d3f376fa2a5d38c9179183bf814d615783d7dcc6450c823bed675a395c79d8f10a29ea89f35d6693cdb486bea90f571b0ac39d202a809c3b403",
+    "715f6b9d641f0b08d781bc0ce668c12934ed5d91e127e91ff60c64b6a2ed6",
+    "4e9c03e19103418ed0a5e51ffbe35114484d17eb6843266c97b3b752c2862402eccc7563417b0fb7939a27081d63378a94184c55b9ce87aced9e75f3d0f8fe5c6b19174a6d6b57d50198a4faf519e8d16c0b1f636f5f71ce782e775c689b669b588efe5c84cdef551253b419c42b4a6ccf8700f0c1d12156aed1a826f05e91d5",
+    "2fa6b51928d831a9fb2e544e528479cad084e023e1427e252278fd1d27409abd94173dbe7276ae82849d915914b476c3524518758a3eeef2bfda03871bd61168e252d298b004665cc98cfc622f03d2cc9f6746b01bc07bb76743849fc56a9e1aa00f1586f04d0377ef680ba6b632dfb41f079a45ab4e242924c3408f8d4323fe",
+    "66fb9b3b2209a92f5d6c1631bddfe180ebc0ac73bf1acbe07a623359474d62466fdfb2ad55a3d858beb751e3ca002014166b322b04366ef3d942bfaf453ad80bf6407a5b81213c907d6a43a663ab54481eb4ed68f566e84980aa190c8b6a6ab7ca77caabdc795b22d037cd547313b850a9f6859c1d5dfa49ca537316ba9d6a21",
+    "26fb5f449a418200dd2619d6280e917da149f118be6da8f43525efec0a8a",
+    "288ae9e69e226593e1b32d60b4c596d23f2846c3c5aa8ea6c2ebd01ecf97663cb5430e4d04b60ec503d17494672ab1eeac59aaa92fc17949c08d091b56afdff7a31241435e64cd21a721b315414fd9892697f2f1d636e9b38539a906d98991bfcb20fc57dbbb308163bb1e3a3273301b7ecd52e9f914b023eb9d433b491d89a0",
+    "4df4538904718797343843ad3fc0fcb553dafc6fc591fbdd94766967fcd0085f77d4770b291734199ce6e176fc03042faa0f7d2241adf62644082a9b50ede0c9513fe803d2d6903b9d7f7376d3ebc088c6c97691c7ed9063f1be14e3a83066010361e1829dd2c339a77c7d241febf2c2972eac35ad2f30ef64df5b5e3ef7bd0f",
+    "dfa73ea7367046871ebedc955f746d9b94fe8ccb6ba8811ca339d8fec7758ce1a19aca781bd91891b201bd75073150178f015c5b2b4d3cba1cbe643e2c835bbeea2ff4d056f15b977c7fc03189aeb617fd41f27225dbf7ba8b932a6e17e914b935a079bae5a42e34048c79f41151865297797d51466f776f50ad759968120555",
+    "8a4bd5d9243b4352619005f59fb59f1ded68e0fc72b6387ac5e10291e1",
+    "178a2e09f646c38a31f8c5be61d6525fe06c06e27c2e2581eeeb2b7524d28b989be821bd2d2e1cbe6327f609a7a15a1a0fffc1c02fd68c0cb988d7cd2f0eddbbef38ada05efbf61dcb41fccc5d3b3e5b780ff8c393876b13ba47afbd8c0a3f668c14fcd02b8dd8749fc5ff7d9d49bf74cda7e0d08ff8eefd3975889fac1b60c1",
+    "159f1e81ea7d9b69a080e53eb3f97a77ae081af2a27bdb2276a7f42549c028c369b05e9f304d851503cb19ca6d32cc4a83808ba1dfce22952354016260ba6d959e7d0f18ee4fed66911152ef580996e0e867e0abbbf34d7119ffc35e5430998a265a5dcada6a6373be392f4a9b537e2ea8af18bd80a7f6c24fdb9289bfc90a48",
+    "f1d99d613cd5f16b2422c8a4420522dbbe2e4b943a84774a6c8d447e59b48a22ad1432449483af2a0d0a9082ba7b71ee592be08616e1ec7e044603bca4ee74b958906b2b7a2c626f2305a7e3d3891ec30d13a852c3f0f031a5465287f1c94c01a09ef81d54e4e8bbae5d83e0c22adba75283da62f674394a391b9e81ef5e54f5",
+    "17dc2e89db764582e599267027ab90a69483eb78af51d2044680bb9e",
+    "cb174613e584081f05f4ca59a6005b2b5a25b5dd21acc50464bd20a06c9b3c9655015a260f814bc3b71140a565e83f2cc8e0d71b124cac64f43fcbf535fc5dbfde571d78fb9b494c271bc58bf0537e1ee71038eee70cc8531215555f6b8566cc505d463ae9e988888a0a9791b5a089202cf763047e8b3622e8599f796ae8b47b",
+    "f2f0bd1fb2903360a0c2f62086ee3b5a2ec17acfa08b63915cffc55c858c980b2d0e4a92869539aba3ddc1b7b9f386a1cc3be189cadbc4a20779085e766c425d20305b4068c5427f5c2bea1013084b1483092c81659844feba396b56d550bafdb9b4dfb7b7505c9c8e0ba5116904b8627e5185bc7d2aa49f77688725d98255a1",
+    "51d53270f43bcce9e25da0ff5971b64e7dbfad971553111f56fe21116680eaca9750152d156d9763c0dd542c20c475ff6789f0cca51cba092c79a24437860d28ae23a18ab2b172544c156662e3e4987a3efb4c3d74b0d2858ba0b8307bcca34355b45a7865363ff412ceee1cb5c99789445810cc56bafaaa24927e980366dd79",
+    "7bb71c3fec0185a33991432b1bb9d2999877a275df9860026dac43b",
+    "4697c233f611dce2d974a9b0b0d333fdfab989b2d87a94a9d29850cf4d05ecfa9f4d82f58cc0172cd5f894a7ff3d54a2cfb52c842569361794c7defd2892fc8a2cba7f27765892b4b57abc18772912868cbd49c932e4b5a65ac504909ba64770852784f30181838cfc0c23b2968cbf5facccd03f71e454c957914247e6a492c5",
+    "81d1202b262ffd740f7d8d0b115d424e9bc49dda15d87b4b788909472681a7a93df52470b4e8db075befc387161a992d9d15b71c3162fae8f6654c8b535554f4eb5290e0e0fcc0d35dfbb96df90e2f4dc2b34460ae964c85a77d0b791634722d4c8b070c3b309d661521dc36959ada94f994c106723d684db8335b6e858c4f0e",
+    "99362cf19e53fdb11a276099c9324fbe158f6e5f8ae5070df47a48c9cb19188b790913f534ea6a2282d1d1dca0b22e5f3fca87fa37e1b79c109e62fad97fd48a891e5c182ba5c25544fd05da17428caedd5c4b9d3ca427aaaf155a1971ce73fc2be36158fc511b18513487d6993010b51fbba9c77c6f6f8669dd81d2177ea5ed",
+    "258877bab5da2b6eef514e3ea0c37c9afda192974bf29b39c5c643",
+    "1a356dc000efc7c52cb0608be5cdeda9df245cdd7955f3b054b914eecad97dd56b8b6851ab60e8fe70ed097c65da26e619399826c963a6b562bc468b26c779f59995be2a6ad30f93bb80e478ff717196108beb1f0b6ed8bd53a48effc3fd096ddff244638cb7f6831ece2ca77a1e6bbebffe1f26c8a99d50fd5e870472a86d43",
+    "9faea11fbe4730fb2e233bb646512461f8a917edb9d9debaa380e83b8bd0aff8e52e2e15a2dfb1fba22ea61d0bca5c25ee5bf195a9d055fcc7514d2444a3793c334a0d58485c261dde31839624cecc614d8a86d4d26c233b8352fcc80bdf6b4f3def25c3bda006550622aa93f8a4ae6cdda8ed20d7ce79ac8bee03ac63a8a8d2",
+    "0cf5d44ae84f9b1d158d36fe6f7a6ac3ad028a6e5b27e09532b6fdb710c6af6d4443434a08a6b5aa4a7a9b031eaacf4ed9d34da4a27fa07ec0d2d2ddf717ece10f99b1a3098641e76ee13b17087f06399b38dddf9163c389e86547bdc24e379aae6e19ceb85036cd379104a95b850ab1d3e8db4d24a62fe3ed2070964a5c8769",
+    "71ca89f7c0314280a3c9c1f27c8cfa38012d9fa6566bed865370",
+    "9e371f6fc3b8d51b4fc996139c1378a50642931dde0a0a0b4856a11ba6b5830f9aac33bd4c3c8a0073f339b198231b4aebdc58dd3bba1733badcc863ee45cf908197781f086bd86a50cbaec0fb7c0d98ba16b2ecc0408becc24e1e0d008c5dee25e7fd6fc6a8d0cb92443d6de3bdeacd1bdf3854aeea29811e761164ad197d31",
+    "df8277b7377aeb521df4beb8dac311c37eeafc7bf90892d0da9891e59dcc0879765aa55c0d914e1ce177f828b1420adedb20fe813a3f994247fb6fd847b031d9a4e9eb85e57c70553d966671923dcf2dfba8b617b5b9ae39afcd5ef1406219b68df06a2d99e1d8706f9d5c26375cb904b4201c0fde0cdd10c470225089438adb",
+    "fc41757b5991b8949523a683c27c0452ee4d999c312bec11f90408bd0e8b3a7c79cbdbcecf226fe5713ece3bdd13961ec0d0d5a534f133e85da5da704da0be198edc66c0c96b10ea83898a613e1eef674d6fba8cce2096495c6bd9059441deaadcf49df2dc60a670d8aac01f897c69678a11a1dfd28b08d1bd65f68bb2e271b3",
+    "eaeddae938a3265d70c2310098ef790de0e05e9e3b8bc47a1b6",
+    "80dbecdd83b9b2411fc0460897aec42668c60e141e0fbf6a65b91daf69535fb23296cc270559a9c6709cc21866d3e96aa9971d72c3ae6719c0d9a668c25c7cfc8990e664e32f3c9f2380600813c9abcf17d7af314b3abe05da6cc76d866766ef450ed984f970002fbd99d5d02a4c4f882184deb5180a3aff7871e7fb81ee3972",
+    "854b69d9c19dbf04922f580dc506c58fa31baafddc324f849dce0aedcf2dab08d8942c78f6a24c33df6fc0da26cfe14521c3c6038ebccc46462a001c13eb90552992cfa96d02d4ec0ec8185ef8c3b70dde994e893b7ee856c00354c749446fdf8e5c2d57bb8a506d6a912e87ae715c8af55f0403dfa31f6851cabb34932d4768",
+    "b9a56aa67a26e7a8f05d813c4693a0451f818dcc18915db2633773906716acd21bb20be21c99f150bce9888ccefd7562500eb0ef764bf9f4ac7070038016e9cf5df358dfa799da7453669433396351dfe797870bda88ff8eb5e0f8d37e961202ca117503118a88d56f90c5dc59746e55c8a40933cb9df763982f00db42db8769",
+    "19b7ee3ecb28f35ea0b12abd23caa28c57e1b4411e5e2a40c9",
+    "7d08908727aaf638046b4a959ed891c6b87c61c74da5761b04a853e9fe10383e86eedad7ce3171ca822478557f82abf71d8a5342c8dd08a9e4265925a08ee78466bdecdf12861c5e9cd4b5cfd8852954373d7742134b5826da7cbf8588e68a476a5f0474b45b807b06f373b022a5b00e4c72a8ca078e471412fd7751256a09f8",
+    "4524bcd861e73bc816364f0eed83bf0c4625550e7d7fbba4fe05e2049b28e4730300857252488a9e72dd3b5ae8cc4d8db296280eb77c4e7b8b0f6b9dcfffdb52110a7360408adb21128649e4c130235e4f6ecb3b463ff7398523e60e2b4d15238ec9898050d04ae6e4def822ee511230cbed0678158f1a209b6ee629108ff4fa",
+    "dc2ceac82a2168b42e329803f791623afe89efc9ee11754e5bc2f265bad129075959b0c8808f24d22e868e753b511a33ea15a41deae493b1692e8632bb49fae07a13b28cd31e045bfd4713d9583249cb0a78a00141445d47c4489ca7358ff52ee547f689e92ddcae7c34446f99248028ebf7297a80f9e46780a7980ea7045ccd",
+    "d523ada63a9f988d23ec1a745e0fb23611f91345dc1cc271",
+    "7269bad71ed1a0db9c9c72df71e6f17aea1576fe2c42942aaf9387bf6d7ebeccc869ad60c742bcc9e64ae14d20e34ab20f1c0fd062c0ea01a6e452727ca275bcfc08a7396e298524a42a30f21c06f1cd07079dfcd1d6b84c43624a4f150a2f4b7177d2e4951ccefff228cbe1ecaf6c3a0c7aac7944f24725be67251d19761aee",
+    "e427d8ef44c98aaba78a7ceba6484d5343c990f604327ce24a0775de6b2a93725f9ee9e5dddec51c2d2c49f7d81effcc31c5eb47ab6b10e5395c2bb039f6865142025cd0ec78807c5682760ad94e566bccc62f558735397b9e818c1219a1401133adc5ffc30d9ae1a5d2d20a7c94052712d37c9ebf512d65eb7b06e6a3cb8109",
+    "8479a9f82a1ed5e6161ccd6ca6a76cff7d46db872fc743210549ddbb06161c9aa004e23528f968e12232ca15cdb37aab392ed809f1614c0e04900238ee34ddf63ab2e87bd0f9c4e4b14f7880cdaf9caeda237a2246e0e70558e2f3e216331a80627c6c85e97815d73311fecb983c48ad0765b4206a5369a47b9488b355b5f549",
+    "aacf8e6e84f5b28018f05c3d6c6ccf508f21459301b86e4",
+    "49df4bf487fd5f9a5615915e580d629fc14a2e2edfac27958ef1b5d52a847bdf86dfe697116d557de3caea6a9c562ca42f27f566100b277bba09992f6796184f669ccae3abeade43f2c1e770ace6bcd766da37ce0b091a93c750cad2b7e85a42083135c13456dbf485f5a4833faf6b86c82442938682a93351a38e0911397254",
+    "adc07ae5e63199baf9a8b608ed053b46181f0fc33d0d55fb377fbd32312e510b107b7785f8cff4851855c32d847f133aa79bbc199f4d29ab3b886a3165664cf665585296c50b7117c14cc2c23691cbc3470650c9c717bfa1fd7fb023c387c24e3e0c7248961d7deb7e81c0be514a944e2ff657e45a2545bd039520cf3340516e",
+    "3d64b2fbd2e9fcb77a58fd1c1e4b5c74ca763910751173eafbd3bb94cf0e3d3480bcd09add0dca35b432a12ebefe5cf26791ef5858b2203a3ebe3921e532818a14c48405309054dd93318af3147cb930d18b0a858c2e4ebbbc7d98c572fc4b9fdba7640e61081099c1f0591a9609641e9961662a105dcc4ecee001160898ee0f",
+    "48501dfc5c04ceeb2455df22e3031d1239c16a66be46f7",
+    "24a94e4c03fa044479e42152486d07be1b083ec1ba8dd8a3cc35453b466bbccb74a059594cfdcea168de6d54e2faff30da1fbcb947c07c65e89727bd96846e2ad234e8973b0708b3021f13ef6c6017b104f53314dc60cc5401a41a34f8958acd2c5969987430af1a0417ea78c310da517dafa4e1325f310ecda569c35e7891ef",
+    "43c5c0562d399e079abb6569756b1541a3f3d16b85730a4ed260d2cdc27ac8fc48ec634fc346ea591d3ca10eb2529992cc6af90101ff8c157e9bff1aa77864ff1ec51db0f1ebebba297446b2dd39cbabc2d11c69d7657438f5e15c1f8a104384ada5423b6ec10761b875585c92f1149bf8a96493f8d87e642f8d4a4f51734a26",
+    "a7ad22716bb041ff5609c75ceffcff4d5d045c1233a35a159f8199d7eb3329e6a602dc2d2fa4d6427fd92c741a93305d1e9311316c01d4aeeff68a8e2b6fe31e3dfd02aa5852254cec757ef3f8ebb0aa6d3983ec75577481a5857b51286e61299ea80089e752b69d604d3ebf7fa388dca1e9134467d55f6028c073c3027fdce3",
+    "a91325789e96a708beda85c3e92aa577321aa2492b24",
+    "ca5533ac36880808a9be2f1a84b2b39e81ebf95e574097364ac986d4ffce34303bb553c2904fb48f3e68fb50acdb8e511cfc657577aba7e613bba3b8fd4dcefdaf16517b9d3bb0af5f1ee6c04c0b4ccec8451c63228a37c23bd2504b46c910fd30821afd28cfd625e295ab1f88c353f04181c65c49b7fb6db42edd561cefac99",
+    "acc470a51a960a271dc3d3b922c5db1aba7eeb0ecfe7914ff7123719520248bbf5fa558bfc7129b25b98741fa18e5cb8217350b38ac71b112d114ece0ea311454856f3f3053fa7b599511047c68454d735a71b038b45cd45fde9758240ac332c23bc07f39ec7fed7377ba7e38d91ec29e3227a0a03035f3003ecfc467b2a01aa",
+    "00a222f976b297c15dc4ce757d41b5430ec0612bf48a38eeb32cccc21c9cdd26896403758f59213ba56ffa0bde07f4c271eee5e4c9e4d01a1aeabab9b48f8564e943cbeabf8bcacd5c0f4a2bf17d1d97955cf100cc45c25622af8b89e5664bdab1c5c23d7a2e3024f8793cd784db0aa2faed91ee1aa44ff184afbd909618368d",
+    "1caa1773bd89bf7c70ad456da69c34d9fae3a1b9db5",
+    "632452542d701f8047a31124b153c91e9ad22d1f6b7175ec946cf20b14e2bee44a8bbea9594154856a3645065043ebf7e4022217a1cd971abaab56068eb2cf161fc0888c86bb956b9f98de43537d52e34e9f40b2c0976b09dffda8e39cc6a152bc4f932575b22573f3060f3586d1567fd13e0d08d602fe39c1597c60673d204c",
+    "da4db2f0fdef99f0a11cf0c3fa128d18558caf6a54b284b78876fdede6f72bf2390a194d0eb712dd8958b01d322f263259dbd42e514486bc0621770265a9d4cc52b4e84949d11d74595035148fe4c013973a903aee5ff90ffabda5732b02098fb3dd2ebe60d0ca6d2ef2756998c2304fcfcd37124841c273f83b00610f0722e8",
+    "523ef46e2bb0b4b3707ca9431f2aa69131b5aad7f161b379bee4a57e1273cf2b991e000026085addfa7818b27734363fce5984edd054036650d84a2ede694efc4c648b23c9d65050cfe7de6483c731df97e0e43b4abbc19773655041b5f7e4d6cffc079feb8ed32df699222ee7306054ebd7cf6c1190198f576cf327dfa6ca19",
+    "1a38afe119c67be95147f6dc818a147b1c2bfa30f",
+    "3ee7a1b7c3a65de67bb653d7544a26b638e46dfa909937b4826d0e041ba5dff2b4eb558197d55fb3c08e6dab2deae34262d076b4005b62ba2339288582994abc15c440fad3087c3d41abe10a2c7d360494774e63b9c9747f4f0689a111154c9e27d8e3c745a9dd6ebd3e1942045448cd813a8630be9491d8096ebf7e7bcc9e2f",
+    "a839e9a4bedef702e000af182b57cb2116a99272d4b5dbfe6045b26ce899cf958d54fa5bf21f5b824d3b68b63885486c6f6d0c2ca8c065a5c1b02b0dd82b955ad35a1fe6bc1e51a1d2db7b2496627d8c141d4291294ade6a814dece4b022e91927553e7a74f71555135e6c079964b1b7f97cea12ee6d9f7cf729514b0ca80b51",
+    "fc2dcc955fdc75b005db29e2877b6b3cc9ff0b829886f5071b61f66d07f5082416af66bdb506f338ab58c1bcb743d8929483604a51952c91cbadec62763c8e663c572647cfe1cdda413597b50de5dcbc8cd436c80cec00e0ce49e272706beef2c686eef0af6b1dfe03484100fdc18327ff874c80ac02df26893fb57b23c29677",
+    "a3a963c5e4594795ffb3bc328ff115a9d32b8157",
+    "52d33073459d9f62da502d910e0b542ef169ae28078ccfa33152a5fd78add210dad5d9cf1b9b087322997ebc860e697192613e38dd166627a9a2b4479455c285adc9d9cc0bd2910452e0bf81e431ba12c7216dcb48d28ac257220ec09b7b6ce2fcb1e87dfa4ef178cd3be04c6be69f44088f88a707ffacebbb263a81391f9301",
+    "67b64e3d052467f2cc5be07675770ac2adb47cb849098e88983fe53b025e60dae188808e441f0813570187784b73a717b92a9557af8b5018bc922f9547410c232165d46c7a11b580107bf2e482b033c5375101f3b1384e38705719cce2e8d2195722601d997f3505c76009e9a615ab2ab72996b0f564cdbaad5f40a682ec8497",
+    "51a4e69ab1e0f7c26b17e4d7e0a7c680ffad040374e10b752e0a944f7394ecdfd3ac8dfe027e08aa0239d85dd62e69bf4ec4c3c5b85e2602e122af096f41a309a98439b1ca3700bee7dbdd9cfed3a7c454b86e0cdbadc9d6e386ced320f593794b8cea3415e13ee8b6d32ff8bb97dbdbd6807082679cb15adcc128d08d04e3cf",
+    "13f28b57368bcd4d344347951c0b9392e07fa34",
+    "87d3cadab6dba387cf574baba912c73052b9357d1c74ed22e53289f9018ee2b116bba8a36a880306ccfc6f7b9f48c48bd74c481625236254f18d1eb0fabffb929cea1c07558254c2c34fbbb7396395dddce941a29d167480e799270245873618dd33aed077995f2d4b265b06961c477eead011a9942ae239ec1b13215535a77b",
+    "be89ea626c1b16ecfdf877ec781d294d8d640203c94fab099e6c59d300478617df3ce2b5bfdc9925ccaaee8c0f5e4123b84083639a43c0fd6814add8f46314aff9d36376071e011601ed76717137a96eb085edd64965310bd7aa7515fbae57c65db09f54d4c29a16e2ee999f3034877c3cb9205a9dc9895b15735d695c0a5e8c",
+    "4c51872e3c5ec221952debdeaec02e9e7bfb3bfd9eb46f80cbca86f43f7f867103cc06987a467c37fee2885d38b82663154de254aa80c264368bb7ccdc639c8f165290a004802de37a8de2fb1e44a5420a32ec5d7f39dc70531bf1ed8495504ec129e7cd0eb5b982ac9dd16a9c9166db2e036361630cf909c8b924e411826ddd",
+    "1a22a8acbdb608b769441f1443245de00f324c",
+    "af84e790fd0f166322f9b1f0cf6d08809a3c27ef9f99cde6ebf131f9840474c0bca3f48c5f7551a354ec44ccf7f03577b65b4afd8b18553fae3a6312d6c202c1892cf37349b6914a2b84f94aec41aa32678c70046b85a12b1daf1733af42d84fabf738c5a3b2feec524038109d467a1a49158587130d0412db99e652632feba8",
+    "556e6a8b19bbb1fba637a6fea3b47976b9c3c3d89548cfeaae3aca7e64b95a4d75f8fe090e1d60d9ca4e3189c90403095bb226a901c015a91e9805ba17133b57466b622418837525af07ff74c1de38528acd0027539a47e77f362b8cde329ab6435998ea74ad9a924136e33d715d414cfb56af4c6e9d6156366c9b5295690522",
+    "928dab32ff238b164c43cf2a44593c4306cf87c9bebfc49ce3a8630d68d52533e3999ec96c1409f4a66ec2b4bf66a82a8db339e407be0b65b54122abdad86c6a3debebf01e8c7c36465e89f3a712008b0d49fffde91e14b192aab67af399ef767ebf503a5463af2700a060fceed9843385b5c676f40bac4ede38709911937aa7",
+    "5a237fa9ceedbf1f9e277c25ce889f15130c",
+    "fd9ab7964c0dbb60a7cf25fb4bb7dd38e86e313c8050d11ab402e00891625f3d08c2e586a1f7740ea611f94e34b8ecf682ad128936e9e6ad1732a839b073ad74af1a02b25bddc5a168627eb7177079d4e4fdb0ee38b66e0fd8653ee9a4964a5bda37516134c6fa96254678d5a44538672959d4129fd35dd3dd8a7c6792c109be",
+    "0ca1686d4a41aea79f357ef965b772dff1dcac9c5ab66a0064bc8e907dc6357dbfe030d7c78e585345b7d415ad60d77dd607c99f41e3f6b8aecc97a28126f2a424bd74a032d8a0cd40efe84740a34189e85aa605772e4b2536eb04e78a51bf99cc22f6526d8b84293fb493544d34bc5f8b1e80aeffc574d5c33a096f6f36d8b0",
+    "8201a3d358d9a8777c08f77d26959654fba94014b5c7ff1280eb304b3ec7079b9d80cd69d4521f6ad8445e40225af9e8a82856ff7eb64ced1f47baa1cb04255042e173057414356641f6e59bb2beb33871b9ed5a505526dc29cc035c51b9eb4854cba26315d52c9f9772088e1a4a8b91a683ea78a71d973198119ff2db41d05d",
+    "3a6f24a1208f7289dfcf8e2617a006da8d",
+    "60a43b8f8d43fa2d75f455f4b9e7bcca6be6266cb1155692568150e2b8ee7a11572198ac0f873089dadc2516d1b21381d539dcae97d36a5dbb3f681cd4c133935f96a12dba99c6817fc39d855a1d833e0de797cd9891d888eb5200513d2005d62d1ddf3195bca288353819e41c0aa6cd4ed420ec0c5cd189bf9c789de3ac344f",
+    "78f08e040acdeff0724fa7d160f724015ef878362ae04de5a604720920020d592913dd5dae4825e7ffa3ec2d8f3095f883b267f77e7dfba392296a7ce93fe14ae4e0290bf1caba92e2f781b50210a6d70bf94a0b7c155f3a31a42bef77fdb4d02d46d2029a2dd9ef0fd3c808e5754c7944cd7bfd9d8603c31a5f03c47a0f1957",
+    "2660b41c506d0e0233ae3e911f6bd35f5ee9783dcd1fa4cd3383ba2f45a96e4c97521483786daff44387dc79396faf8a576dd3c495f61d7926f0cf4285cede74e1c82c81e1c44686445efdda07dfbc5c844589fd98b04993d4b80a0f5c9784d35269a05b79dc8811241d2748fcdcf1b0492849d7ec6ae09de001d7116ae4d0e5",
+    "1f8f3ede6fe6c7270273a4ef411871fb0",
+    "05b26ac11713cdfc82a47edc2000cd261171951783156062a1bd144f463b2330f6eee4ca95aca45c63b989babd83e1c81ee999ba6e53f07546615af04413fc9ec142e1a81a10bc81245563d726a8428a89b52a6905ecea5babafdf74cc3c836ecad4cc3a9dc6ec7840ef56e47fef5a5249a16e7e64f3546617284bdc6690b171",
+    "dc528041b3eb01f4aebe2b554c364d8750e87c89d6ec148bcc5bb0a45d6aea7bc51b65b68ba59d595748b2a2286ffa60f4dba28da3a5fed3a0ebe4e740225bc46ec6658ac502df502d69d1dd09499fabcecf16e91376299a57af691292f9c42c1c70e9e803ff71f8bd1607bf365758849bc0223bb57705eb733fc1b2a266343f",
+    "9c29b666b4e38ae13bb448d4484984cc0b318e8aebd01a01d487d32a6850e8edd8319728bf05239b1a17f0867e30e50d2e558ea957ff6fdfa06a42c918d8acbff83409a798a7d1ebfde41dcb5fb3aef50575ffab827c4f6b41e74139522ec6b37366ffdaaf5c2ff1efb4544ba4818d0d22f7841b36c0161d5933f47082f950c9",
+    "4bdab4914e8dac88c12c5cd4ff9ce0aa",
+    "0f0e3f08832e156dcdb8a56361997331921e69225b95cc31b5d3e21f2a9aafc8aafa046b61b777b3deab2342adce3b511ae4b72d6c8824a08aac572bb00cf49e563be3d461757014d1c9b8cc911038130adc311c700017a57b112e9b0bc736c1d04f046d36daa6d30f2bee68317fa3ecda8eb059e0b4ede78e261268c5bc5c2d",
+    "e870d0111b16e40c1585cdc846129c7c9e35e5b5964531900e2618473b3a817622001b0606074cbc2caec16e52f5b5a31e0c0c0eb4bc8a2f517ee048be50e7cb9c4de8b4f451743a2f3601bb48e93720195694ee99cd0a70bf967a60d6b37cf26f8e6b42460e922cb0ac7884841e35eb3a5b72db7bbca050822f9c4008828519",
+    "8d6f8a261acba4d1d69bf5735c45480d1e0a4c56ce964830801f120bab006eac47d461890ebf0477ef064b7a1832a5789fb77fef481fb0bf4b151e97cedb6921b26c246f811387bb9a698e72a89e543bdcd15e98fba020a4f677273aca9ee0d8a2319c1fbb35e3b73a731e33d5bdbd9823db6d3ccaf0dfcbce29da892f1af5a9",
+    "1bef7ae571acebd39e268e886754334",
+    "1220977570fff59e1977f911935e3f473ada9ef168641bd19ea755093dd56334e27c0e7e1ec0eb11363685bab89ea57acf1d610a1a36be31e3522e35bb66ab8a53d7de6e9f2385b48d5e9da879b5925af7be5bf44db2d1eb024fcf1fb618139b03f3d0cb307d294fc167a0faed1c2b5c593f8a21e8efb36e29acfc31e6c57288",
+    "fa1fd873739d07ca5af44fd5cfc5fa085b51510918c3d422edf377da73835ece55ddf195e32d8d79aebbe59aa81078bae3a9f447e6c0defad69b3d3af7e00e8216b7bdef6dffe41ecfd86b2dca0737459cf6de087e174df782e2e440a608c91a5be643dd833d3555e432a18d2e3529c6eaf322fe1652b094dc645eaa3dd9eb9c",
+    "7c67f85316f232fb49cbbefa2433ccb010824d2115536169b1866e37896250bdd1f12b5aa37a440c2bb270a9298e50274b7ec5badcb0bce9766deca1c359b5e27c05cf59063a8830bd1b742b187168d3d7d87c80e3b4911834608a7f77acb4893e9c4473984a482f49d308911f4c5f6251ecdda5f094352cfb392b7aed6cadc9",
+    "71dc6c71ce5f511cc3797d5dd630d",
+    "eec5cba92505d623b35abb7f3e4dfaa72542173020aeda39c3373e914631da31c618c78ce3a00c7e3208a04ae34ef91df80a552b4a05bc690ff5a0d915a8bc832f385104d4e92ee8341baa33ead4c7bf6f47133cb175dd8afe44e0a7e7f31d88a59cd0e5d03910d7a22411bc796e64f4a666b30c47257f35020291ce8afe5804",
+    "e4a1ec18ba92c76a26c4b556c5c56d9944932efb4a838d1dddf90f05388361aba5341a992d662cf36958ee44d5ab0791fa80a97b96475ea458580641bf2a9ebb207a557abe27871901dc98e745532fb052832c434aaa5d1f18cfa23b97314080cad6cf38172eb0731a82a2713908243d4b35f4fe7da3f6297160daefce046634",
+    "5b49f4d4122e120bfb87494e6a371f116b16e29c975f8fd7583cfd4ffc44a70a30bc1a50204122d92cbd7753b558f7dccd5b42a5bbeb1068c0892e45db71066acefa63219bc59b65000e7101e1dff2a3884739dfd46a2d46d94890db603b9d945e3660e55315e7a8edabc2f60774ebd9a1eabac08ebf3ad54daeed49dd40f5b1",
+    "1caaf63c85db5347ad9265d8f32",
+    "96120a8b9f44bfd77c42dd7dc9671349ba4ca92ea58455d63841f1bb2cb2ca67a55a4f93ed04c03c5fac338434424189c75de1ea4f1fc0ed8f3bdfa657b4f1f0882675e58640a7131a20ec43f20354af4a1fdd2ac8f392abb8630655259087dff962d8495af6bd5267d9b8b1ad13e4dcb8b04629668884638dab1f574a4bc420",
+    "3e55203b45c4dc51b331b013162ba6fffbaad58f0d84bc839bf5051edeb537252aa04f1a05adc2d993cd197634d04fd07db1f00150361a90d2843b243f1e683d9a0963b143ec12cb4b39565caf2372c52726b7956d89f876fcb6cecc4ba205c35d21a3bbd21fd0982c9b8037dd9bacd923f2ed3740c80b113f1621b15f2f5cb0",
+    "c498f48b8d02eead28e31c7595b7b2bdc0cd98039322bdc2b5dccaebf495a0e97a4d9410d1516dcd89db670da35a754e4e88208eec395b62d43f8d0da4907f247511a7d782ce78c386bc08d8fb4ce1aef3e15472f500dce457c4c44acf10b90e9ddbf368a75bc83380c57fc09e7f0979c12e08a5647b3a1e5d38fc641858aa8f",
+    "111cb3d67067419d55c54c9258",
+    "afc1bc3ae499b2da1dbf5f444bc25891ee8d8b8869d97c0dcec1a61c2d43a91ce0a6e2b7b00ad572648e51a38eb3ecad7d5f049fb5701a091b3ab98c7f361c3cd1edfbf88a48f3c8828fa6adf98430a8ce1b0b27cc8bcbc0cb3d77424aeaf23cd27d0fb8845a00b4ee94ddc2cd5d4dd2110528c519f3540a260ec8448c1539ef",
+    "e97a99b7022752375f3b61f43cdf37ab0c17821af9435b9c965242bf5cd2d957c881a9f9bc7a5ceeb7a6c2c562db5395aac9fd4ccd40f009e97b16cac3e94d92eaaea7985fcb05941fc069746edbb3d924457dd6a8b8e542439ee553327f9a10cbc758bf908144c18f76a5fcb2c7679f105c55984f24b8c2535b492644f3c166",
+    "24ed44a53508544d3baae21550d7068c014a5c520b3b8480801686fab9f79c889204cc29cc2a0eac4ac28265caa024a41e16ddff8b916b5ca78bc4a333ad0d2f9decb11ac9b626e7fee2bae86e7f8f2604ca55c7ae9efbbe8ef6a28bb327e6950a8a972f65b99a6512eefdcd8275f423c91b04c40b91a338a6ec6a77f52126f7",
+    "f4943a65a489c3fd09e877d3",
+    "fbc968db672839e62e283bafee9ca31a7672e77b35f7906ead7ebf2f4ac13ea033b375d4f8c0fc200270d41980bc42d9587fdd9e1a98c25dafc7389b8b8b23880004ebcde90a72a8a5a668e58e80a982b53798ce82bb4abab522fcc0bedf794d099faa13aaf89f159532a491902d11e74413f45df070c1a95deaf7adbb8486db",
+    "2893f33ac1fe05ef82d13f946a7b1cacda4eb473483cb9f8731bea6d2354ee2891a1284ed25ac32e462c87339464eb9ab6dde0c73b7aec87680b686dc26f9ff08662bf72633602af7a13870ee301c24dc08fdb436675f9daaff34003de0006a10393bdb6dfa1539d1393e5e7c35346512e407e1f6d541837936dfb00f6af9a66",
+    "a3bc24ac4ac1c0f2b712756d654b26fbc280694044535b9d10c3e77489cd86d845413a38e0b7792c4065fca6dccc5a5b4b8b060b54b307ddc5ef2c7bd31e1b116d565faf9d945133bb852796aa6235531ff3fe1e60f12135ab6de0545e2a4a4f5a6faebf337fafa49c133fcb5e2d13c121760dfe53929c040ba6249b5d899943",
+    "19d2ccef8e9a76bd5f1a6783",
+    "203677b1e402654e51104aa7d8758d78f492f3cc6b90805cd29c221ac2857a28ed35bf47f656f955e10c89591ed451b02099cf88f193e0e664b02d83856aee37b1e33ca7743fbb1aa7d1fb0bb20a94f06decb375ec6079b2f16e54f7da1b0b48850906c57c3ad80f032a77ed494931d45a0bd10126b063628b40198e39bb4d75",
+    "a271f9656a6dd7d5e20045acf83b6be585a450c60369eae500976965e3bb40d0df19bf479b8131a50106db862c6368e2b705fb01eba5893f669695c3129ec2ab9096a76ed5f4a522007f23963437c1acb2fd2ae0303b331a038041e20a2c0446d5ad892e2053650278a4730ff1ce4ba81e2500fb4df264ee2dc1077bb750a074",
+    "f77832b7e8e09076c6bb343f341c409fd3f74c83787cd4a28e3edf615ae72965c6fc0352c30cefc53e4d0970a203500d99548643585fc41db71e0d73f467640e059e0c8bcd8f8c25be6775d2ea6e6043c30c118b9ea42a115c7e13c7c193936b2b7258145d11c289016baa40f1f2a3a0e407fd31a190a46300acdd8b09d19c83",
+    "78a5786cdbcc49a9234fab",
+    "6c7eccb6fa984b98d9a3b90ce86bdfe865b50965065a5257cf7545b64072c1d0b64583098889aa2ac1dd044067202c3ea3b7cf741c74ad1e51755e81e786a55915b742b5db2a420b752f323deb4bff6648c4da14ab777354277a44df9b39c1e43ed2d1e7a020ac0eaff1dfc0c8e3a048b945fc8c5e108a4df996ee926bfe6332",
+    "903528cbad0304e0779851cc228c39467b033ad57f885a82b7d816a8be34e6fdca2327769b97f99dc7a0795f6454939381d89f0d7b331b95c3d01a55c5ec73a292087bd25dae5ffa4287676ed70798c0994c072f9a3681059c3eb4e7a70bea78040f443d76e53592e1738c0dccfcc26a71b165569b3620ec8a67fdcfc293e9bf",
+    "2c67c1cc1b3d67ccdccc4c9314e36a80c64993d33c9030a14da50df186c631b25443258d8f0816d325827f4fb784b1fc9c3bd946807cb64bcf2931238e7b31e46d1cba1b741187ed78035786450c7a3b0d32abc462964755c74e54e806d43299f83fd727ec5ffa3cc8797e18bfc2fa5129a9653be771e24e89e61a5b3da43a75",
+    "586c333fdc449b5aedcf",
+    "8ce0366803f2511a768a2f7c19a06fa680ece7435186bb7b844565f9302b62fe441ae37d80a4902e483713677da7c8798af1f57e1947c310d89437471521f4f2cabdfeb7a811798a7d8b171dfa7b5e3263e45ac25a9d9c766a5f217c2d9e1637ff17cea4604b8ecffc2212d2d7cfaf6dc197f286193b97547a0be51502881ece",
+    "2da4a0c2b851838cd3b0f3627ce1a3bf872cda52e49f7eb0c49f5fdc8de01e575faab57352e265858acb8be42df7be8db933f015b183b9be1d47dd4f42f0e0cb810a9b999face016bed6ffc16244c7c21ef3571bcd79866d3ab4dd113277f97cc0f3ac75a71f2ef17e23a6d5e4f43d7aec61a9033f74076cd7d6dcf61d16e28b",
+    "9c51ad8f623b98d0393aa1d36abd9f7ad0d24fdb4a9f53e97645f941706e98c7dfc0d7472423d1a04d68a72280073786c5a291543097c054ffac7928acd6fd0d01c223b18a8f7169fbc00750985062d43d4eba6d1a621f6902f8851c3052c37c1e5b790c92162b760134f15adafa6dafeff28f711787643dac53c0af1f1ef44b",
+    "430f464642791333d4",
+    "a212f8b022b6d75960610e22ccc55b5d7bd5457036c766e5ca22ac79e7608eebc75f22b7b8dce8b7a4c6de5d896212ee8a53e685c521f65f07420dcc78c45dfd52fe42cae380b33ac8654a567a5a0052a7177d6906fe2b591daa3c9060807b0956d5e25b6dbd2f8d55cf7abde89ef291b4ef518091350dc2941c4f75169a788b",
+    "f85c74a6273bcf20089d1d581e8793f90d7b98cf0e9d10e216bdcc10b442fcaca13bc685f03911c0dbced4cfb26454195117e9e586d4c796a9bdb42cf60521aac8695a4bc540ca216dfccb26345ead0aaf5e9574d9e428698822c8d686bf5cf7b723c64f5c721cb9291538e8489e05e329bfb38463bb701fd042f3a11bacb21a",
+    "2fc526106bb24f8fe21ff14f072e698265cf4091f07d71ce8bb51ac724391740afe7b19370d59db64d3c0f71c2c5dbde174eefd164239680fb77b0363ed94d49e669cb1f4527b614bddc72dfe9c786d1138fe42948a28d7d4c96d8e039109b37f7e4dd161ffdae240cb0404018345a29916c3a478faa777371628c9ec1155a0f",
+    "28540cf0e4d2a0a126",
+    "acd8ce4cb749a47a4152985f65f2fe10d42b49c3b6858eaa1d4a1c277008a687e96ed990ff05a8df0d44fef34421d2d378db942789ef76a7dd447e76f9f48003bd203d9bcda840788c3224be0e3d89b147305f341f07ba285323713018e501eb5fe45acf9967d4b0c2bc1de973f6f6e72bf66401f04dc9a2b34b78dbe4d677c8",
+    "4a165688ced3b0b3ebf929edf7c3eff41fd049269610d1f8857460032afa019e32e4549bf3676d730d5e8496e38104f66a99ec4d38a6a7798bcc134da747af57a75b30d06e57d6cb38b9cc22f02afda1f1033ec3ed35413609f1f32c7db5fde45af3a1c8a5dd33bd689d4fc5e66e06d34f21d329b846006b17da6bc12638b56b",
+    "c550088c42da1cc7c629900c16c0ef83b91591aaf1d125461a2f5cdabd4357f0800aa2b9e4dc1e8e2e8e8f647fb7ea4d4c7ae3e2ff2aafb2680591aa2e3edc9573bdb23de4c928e450a66d69f8d71893a4084c175052533193e83490cf9b1975815f5a276275bb5c3d40677f4e52c8ad4ea6f698b44df8f325dd17ba594d8e97",
+    "1489e8be372a8a84",
+    "bcc7a5d542906325e81bc0542bbf74763468b51842a99c0ea54bf22375f2aeaf84a2c26da6e13728a142f87028cd8fa343357f403c71b28c20bd2668091cf6aea70ceda1f19aa9fe9fcf65a1ae71708f1fc9c9670ba27ee35c042fd76c86ba31bff679aefe97eb4a8fa6766097b59fe454a1a038cd8aea5c0262d2a77b4cfec9",
+    "87c11b035b8b0c0a5cf48aaac4df801d8859e4683480a4eb59e2848e5342c64323671bd6982672600ae2deedd5c5fe83e1f4bd36a3d035c969460a8c6f3a4fda74f14dbe8822744cf89e38befd204c0617535487c4da1a9aa8f41507e2f3e7482c9eb8199a14a75dcddb9f20da5ed5be37eb19923ef23b45bbda078132876e77",
+    "b89493fd79221f57768ca08325979dc443500566afe41bcd66513449e582c79751cb7aa979dea2f5ae46e7189734f12fe1663d96703f2d5360ccf1769a691d08c2991a13f40c9d4b2b62edb0f5bb3c84c9dc77e39919b1887ec12d55031718c4caaec53a0f15259e8b5a793bffb7a122f9e41a81ccdf1d79abd296a8e0224bb5",
+    "36934568b6a2041",
+    "6d9607f725d90f5b2377319cec37235bf97f6e4b62d99c23f51cf84042bc4189582e6cabb0417560d913346cfa3397a11817ef224ffca39366f6be4ea3aedaf258831875bb13a2d50e5f2b8e7ba4c784e451b1898212f5f4de4067d3d62deb27c743e30d1bea526bcd3cdd56e923996af450027c127bbc1a496a588a818bc00b",
+    "cd72a8b6ea69dd6c0350f78d549b5c3074c96522ef3fecb2b78737e949cc0a029409e3d3f5b68bd95b781f7bf5e9095bcbde158538114a81227232535ab29492a719725662cee76e53585aba1e6655d60834516070b3be59713e2954e206b3f09edda473700ea7d742baa3ba292e45f7e66c258ebace3cf83ac19f62194f25ba",
+    "e109426fc34f0fbe1f4e6c5d4a042bc6acf93bb7c3c83ec1bc70ce4514e5ea15f0212dd748c9e12833ee94f1df400bd796c4b8ed704501cee36a341dd9fb0fd8e87b2d095079162104ab2028dbe5bb80d945772a4e7d58a7922a57d7983c3632c922e245660ad334f48db75758b9b2eb259d9bb963ab58d7654659f5b0fc94f7",
+    "6378dee2bc0f5",
+    "2a4cc4b3ad2b5a0a8b4b7bebcbe4934b5521afd7b98fe4a1a1297e90c84727c4d777469277f712aac0609297ae1c1019323c170919e1bdb73bc3fc07e6760382cb8fb51094596a4ab08aa09519efc69eeacf0234e0da26ca77209d1f0cd3e98da896cd00b02d5df3aa9b0add845e5c4ea3bb314235f95ec6f7b1b2c1b7486dd1",
+    "3ceb16d46d50d65f4119501323ffa2e7db679216e309ab46bbcd1466f452dd0e61fcb04022973ae7596ec6a3f2ebac20413c2b3c216c788ba36ea5cf9d446cb241721bdf0601bdb04cc3486f167d887654ada3fd3cffcf04e82c38285724867980b23ab759ce80f04c6f9b59e8b2b3021e2160c6438164cef34b0b4658ad27ac",
+    "c4894251a97d3d23777e7aae88deeb76ee0314c52d6e97f1183811133c06c1f37b424a7997407dd4dedb7a4c8adf40eae895f116394e85708d9ffbcab6b7867db6c32be872d4256d108a0ab2f204170ca6685da979dfc6b232fd54d1f0ab8f17b33628fb8344a759e1d127bfdbc0599e0aec9a5792125644438c06953f893d8f",
+    "92eabe8977e",
+    "d7e32e29546d55f17bff331447178f5f4236757831ddd0f50edcb87ec24dda01b17e3af0a1b372c07f089e934078e18783932e83df52199f414e22af286614276d942ef948a3cf1a78984467244911c90f7e87a48ac54ab696d48687d82be424fe2fdf91a74dcde7146ae49a220d5d66f840535fd05a9f3378b80f5bfbe95f35",
+    "a15b1fb6a2a98930f18b2bfa3e6c16f254236fd99813aad59b4ed125670db8959a2c24d2f33b43bdeef8be5b72e2e2937ae37885869bc0987815910e2abb260bceb520d4bbb084b2e09d24ed08c113e497bdd19ec389d3fe0e335b1ac5fa1c3f2b082b090e999c587a86a16ca315cacbe97b554569c2ecfa54d09f9e1b33808c",
+    "73fa07cce1a1e2dba22280068c40885f5a59f7bce75794704b0738c26da617fc6d20cb1f9643c06fc1828107833454823e5f9d79f07410ca8543c596370e1126f10c566da8fa52d2393b2810c1bfaddaa59992e25e7d7bcbaef81063ae0801568be1a2810d44ba55c3d21021595e1d350efb7a0e4e56e9c2a017037e7417403d",
+    "13badeb8c5c",
+    "c8d2523c2346e91db178394aace8783f4fd0b1bc3a22cefe79655c4d803720eb7c50b4607016c24536bbb9950e1a8b2967f05e339e63c196e60d79d40740ff245b3a4471b3824f53bc2dc69097bb28f5b72b8eb707c23d7e9057af0369f38a72f89b1fae60605d581d45245e1dc1c2e1a3e1c03d0e283ac1bd144b6294af24fe",
+    "1844599f7fda47b9b65a860eb7ee9c36a03412123e2ca3d56208dcfcb0a11ea780371391bff1d9229633bf05cd0183c4b100fc18946900fc82dded96677325d36bd6c2f80a7aaaea1eb780949e4a3685b135f944fb83a939675509c9922d0dbb2b22bd7958c15bd17917aa1f5519a7711d455efdd8e00e9e018e969a01ce9d71",
+    "373848e7648ea79b0f12dbc402ea5cf39957b2004cefde95a72a87d781ed9273f93500053979d8360dce31aa79b0af39f4a395002b96097e1264e04ed068613e7a3348683165b18b20a24f09de1db8cb58d8069997b4a95f408e631bb7334d39877465551086be642beb0901ccd5b7bd3e50af9c230254b9c7a84a310c988163",
+    "ddc72a04b",
+    "a51bc80f1cf3f9b63d8196ed85f8ba31c21cf94c4c1a0ecb435327e2dc4f65cc498f408dacd36b534fc86da824c9b2af0dd358044badce6693326a354baffef77a86b6a4c092e0ed9ba46960bd48d9eba83c45f40920db154e49c38906217ff53f9cfa0f3b96f32e684513736dfa120cbd4f9d2744ef929a94d0de120e43a8d3",
+    "9ad5e4b78d23a4feebc0309c7c6db30466822bf9903ea6824b83823a0e1a0a87c852f846e3d937473093588e051242b2aacaa5afb86cd77ca883405bdb75556fbcca4581ec8a18773c162792a42a009eb75c1133bcbd8bea02aa01f4e6ad7df7c3343fd72ee4b8f2ac558d2aceb0a394661edc4df5dbe13355d51e362a39ad6e",
+    "5e7973e08cbf90722cf000bd50c137f4dc89af74c7afdaf66e0e7d406e303e2ea926418cad58318ace47a60631617d3a10d47cb2bdd4d91332ed7b0c592830266c3c22a67d61f8346426baa4fd4d486ee3eb608b6dafdf581870ea859edda5f47e1cea7425ba5a97efac4fa1b5cbc52af722490f7d85c31534f0f24fe0a2ac5d",
+    "a9a65e2",
+    "5240c4baa0bff6c82525330f507c2797480afd8af23aae73066a6b1042aaf66d34a32e9f63d6bc29b48d059d21deced7c069159719bbcbea39f29e360b8992c1349cbe723ba515f92b035bf38bb7e799cd60ee5b2e772e35013f8429a110812f4630c486f35aaaf4d185ef97f5b6ef3fb29ea8d34477b988eee004b5fdb86e59",
+    "e0adcd0a7a4076872aa2b095d33d79fc86742ee4f48d0144f4d5c268cf98d1768ba1842e44ab05b3da9bdec25bda850e1f6601a346397cac76df5bf56f84f07f692cad68e457835a0a059c9f91e15681ab5060f5d607517409bd441e35a9decef57ad2c44061d5e8ded89adea05abfe953716c9739445109c6bb9fddcaa74f61",
+    "70a1fb245cf2a0a4334f5f9d106cfb5f0f9ad9a0994a7d1b9d5bf5f7a5332ae4a55a46e75ae09bdb0d61710df49010ab9bd0d7aecc834dab62f1418bcdf2ae5c2d132a65d9a86418ee91eef48b3fffb6578e369035c1c5c9fb9c577338546bf9d17e684eaf20594961f437c705c6bc2cacaac1ef10cef1729697da94c8c9a869",
+    "b58fc4",
+    "7e8caf5bb92a3dab0b42244ac74da07cca5073acc44fb495e0f8152ca3b34beda84cffeec6f7884fe9a78178f1c6f9d3632addbf6af74fbba467c0f1f7f14966c43f510e4b0459e7f4ba4e5b6252c605d2d3cdb8d2f1b8568658c076e76d19e59a13923e0aa01ac0b6fc0c83a9322a172bf072b4307da88f32ab7db9e6d2a34b",
+    "70449558911802c32f2058824697c20e9fca1d58ea8884d576bb5a8917db7afc267a6023ae934df9e35264fd97d9f4c24da446665143dd87c66fcabe86678e824c7b25f161eb3a87c5f753265ef4ed09bfd0cbcf019f1a266bd1fbb33a2b76106887bfa96a9486eaca1e7af9fb80f76ff003f1d701cf10862edd8021dd25e3a5",
+    "2c361241db93261398f5b74b38b9b6c4409d95e317e4258d41c0844a062144fe9c4d1b5c7ddbc97c088d4a51af6986497e3400d42050ab1fb863a04e5b9b2a284bdd01d4b6d75351e3a09412f3bc4af98ef2aa52a69f3a062e64fe990670145b650e504b738f1f751a3b9b7d20576b4d6a4ac3d0c9fffa4b6fde0d427451587b",
+    "1d2ca",
+    "3eb28dac90b62981a87e900ce5924fc631efbebc4cbcf4ba1998019817be3cb819f4139b9de049baec31cc0f8712d7c404ad94895517421548f6e3e92cc1efb7825ee6f74d3853b63bcb3c3d3c16bc0b4f28678f49d973ff4d96b16a89fff6f9993de833ed21285dbe8784be0fb13ed5cc250f6477e733a402a82f5314c0ba83",
+    "cb0915df1d6c122c59548a4bd295eedcfdfb52dccef878f469040b32bb2ee774cf49f654d2958c73af6084ed2e33f56246c3b340bbe662a871c96f5cdbfa2129bd5af54d92580fce40f4eb172b70da23c8658ddd3986aa847acf4e88f4785e22968695dbdae82bb4bf3252da1abcd72da3325988a1f8fdcc5be3873d9ea4a4bb",
+    "9571a9c0b4f9cc777783a9cf886a5d413cf78426367253bc4a6ed14c20a284049f86a0317757ebc1cbfedee0fa168b0f9213bea548e3743141c82a4fecc19808715c7f93fb7bfd2a87f03020c8e7b360db1dcadfad89281e7798d9259b24195960e86732e79522d770bf9dc868b2b592e3567975b8a84cbcdda8b9bb8d5282cd",
+    "44b",
+    "14e5f8227f34d44a47cc1631b373058bbc0278ac8bf74b2e0cd11124b40b9148d789a0ee986037fd6cc7c99a5380707c52355a4a89ffcfebc0848f7ad1bae2638942ec6b0bd02ea7d91ed90e95abf6de7c7670c93b432b954a188dbb2fba0535eef74b8ecb663e16c011f45b39afdae0cddb2f57c1e69e01104926887464f457",
+    "1d7f56ae23a09ab1159733f185493133b13368535a25e2fea23037a9fb8997e0a02040ac31716f7ec1ef713809c42b6f0354bacaa9cf311bf6e75c827b5fce8eb9d1775139130b28a84691b1e0145c2f6d0ca5453c428edd6b1a34d5442e880992d6d1397e4a2389910a63e5c12f0180601b9245be730f732313d9a50648ca5f",
+    "62e4587ab5af57516d8994fd93e5b6b1c9356dd120678e4a4db55af227a8dcb1fdd3fa7e7fd8c88efd13b79a510257a05fd3711599aa46271283e2dd8e2ddca261d46a72593284287e09ff835fa851c12ebc30b58beed25b0a1b41e9d2bf0ac7a86558a5e23356a2f2ed3e3ce64b18acd83e60c85c5b068895c687d01bd7e091",
+    "3d",
+    "772d4eda3e2ee9a5c122275bfa40fe89ca3764c2de5bc5453233405326b02879eeabba1ac7f62ee40c78b12e077a0472c3c38b843ba7fb73e695d89e2d0d942b6ef9fd87779faf2b47b6a64ba524f5d89d56a7dc9b99ca5ca4678aa1d88bcaa5b06c8764218e304ca2fc16a416af00202ef567a9de4a6266f42e4c52c42d0706",
+    "846935d04256dbf0b8187d89f15e3228346f61753946517e8457a3fd940b2d1d41922c00440ace4549c68281b31bae4dd9c07906001b6fbe4dd64e1a41c349a640af12024df507dc50b8a26978eeecf9265590a93aad0053943cbbe45bd31e502631bd472d519bf24761b82db3948c9192ef5441c9055bee33291f96bcfb29b2",
+    "e93933bfec7f482850a03e10b0371bb69b4d0915856abeacadda03bc15835cf532ddfbfcfb92a140b54d7ab4d2259b524f41bdc96d54fa01cf44eb41f906962504ed721ce466fa5f88084f8c34d2e7ecf85f63031f23f8c822c63819c98521d7abffe10c6196634027eda4704422c58b7f3377bb9797863bfd8b10a5f24e8a07",
+    "3",
+    "87c41731c3ec212d5b40b7e5ddcacf95bcb979322d202a508eb520d19585ee3fac13183675576da96efcb6be10d1eb1859795a690662eaf8486e53f334476e8ab4c739e93f3542e54f68abaf8521f4e7ba3dd0614988024f4f652a0033cff71225132a65d0f9404f3184311cb26b656d89142c3009309f201e4b2db6c6a1e684",
+    "a419ecad55edb264afca0a9bb5d23514366a9c73ac1f351527786fef0e58c4ed0bd0d0b4a1facc7b367a66d8711de99f9116bb7b6cd8713a833ffd099d6ebc329b2123b778fb9659bb5a0d00efd91fcaeb93fcfc52525456e9b53f49ef180544df169f4c27dfaa77f3a47ec54123a60d6044b146a5d88e41d801f9bcc89d922d",
+    "7e24d7f68e835d6ce0d63e314a91326aa0a5eab24709f58dd486292204ac362ed675c408259b22d73845f7712514c273188be6aa40c13d9e7487e23b28e1b3897688f8bf2aaa95dcbad53d9cc9e89e529fa3505f21d4da26625c13632dbddd99e80e825996d8c307e8cb06955cc2a7c61c2ec06720c26c0e152ecdaedbe2e6ab",
+    "116b0a30c705d31a9d347530b33c802a5b96b2a326fbe85c2369e45fb0a3db2388e4176f9f1b8f1110b07c76c4a5b57a997af6e9ed969686aaeb4695f54dc5ad00ceef66f8f7284795afcdf87e7564938ee9d515f35f3aec7f4f69e9f5337426cd498a245067f36c17f12bce25e7ec3cd3e9ec5470d52eeffb1c2a2ae618ab8c",
+    "034bac4c74ed92e1059496690328081e687d3125df26dec8ff8c0957418922f16656f4e7877783a721c614d2cda56e0d0165f4a071d3686d7fe9793ce271832e1f1ec7c7c5c8a3b59dba4a449861a4e0fa2cf329beeec71ae1d74891028fd2d1101ce4ba39373fcc3733a5a40e2b7327d1119ac93feba8fe18654d59bdb0476d",
+    "efe487fb0312451ab7cfac177730adbeea6edd38279e75c5b9c34f08d267343cb85f12812ebdb394fe7e5646e9a96fc386c08ed1b342c11159abc279ab72626d006676dfae2c8337e16c77f8de9bb3ed09ebd2da5a57bd327c9f4c48956ad1d9b3066332fc72f9f10c018001258a40c955f254b68733d704c716d3cbce0d1cd1",
+    "3a843c5040e787f15a28d323384ca1be6f4a3072af10991681277af772459b97259e50ee18869420d34b8dd4b3ec24ba709437630e5a3c7ee2913880347d514aa42509cbc815a809f00ec838f698f61248ea33efab07d5486ac28011cc69b78e12f7a41d6a2d9a976eef0e7b337892f948042513fc70c38ef8a989efbb3016",
+    "2262566ae3add4242904058b18f63110e7afbaaaa179687bfa7ee2a81ae4fdb023025b99f167d214d5099f88d32fc5c48d00735a78587ef7f84741ea9b2a717f570db50000aef96236a371d8689d5d644593c11df07396c1081923d1f6fe0bad3281b5c0264c5eae9cd837b1764947013bfb13bd6e7cb0001c9df1a5f9e1129f",
+    "9056e7cf77d125782f30908429f0cec95491f8e2df72c5c35f40f888da7ec2746acb9b4036ad258d332219cdfba0a2cf632ff29e4d3f53aa89a03f6e20d4b3470ee54f25a2db0870fce354e14874e1fbea3b907400b535f5a6aeefbd09fb6cc9af2c9cf951d3a77284bf0ac441ccf3dd4de62ebc24233e0d05912cf8e1cfb16f",
+    "42eb8702e7659f2ce4bce2a707d3976f4445a424158b0fd5d2aa967f462d7ab2f5af7dd1908e2507e043684f57c844c91e443d23c5c0eaa56aa45ded70059a938e3c1295bff48231a5dcfe20cf1594c16e932f92b646cccc878909d7aa9677fa5d7ec116080927a9ac6674ea675ef61dc21bf43306b5192d29f7f60703ac",
+    "de2d7fce441794b6ddf7e02d1f22eb4087f9c9597c3fef87ec4a0e5215059cc76a10a1cb8495243428c85ab6bc04e1608808a34ab8e2101db8197d4d493eea420c9370b19407dc28b063ff16edbada8f9f50de9db074b4e024e9bab426f4dded4829c03ea507618b2ad624820a2336bf8b012ad0367cebe4ad5a1c1b06c62636",
+    "9c422701af94b8609d817994b65f2a71760de862c8ec2d70540a48a0b289d78a99e7413bc2e1aab8607b793168c9ef41409e8c98de728ceda83babd2fb723533f2b5fb4f11ae6fad7a8f774f29c1d50372a843d42700ff362324cb1e13219e9994853019d2c6ebbe6e4a474e52f78ea9283b1e5968decd513cd3529c29aab77d",
+    "333214081ef5466215651f181465a18a23269d26264f54f516eb9fe324798ebe54df15fefe94610beb0b5cc836d7dcd36d4511fe75edc3c4e1177d53e77cc504cf8689b9bfe19fa1dd790fb2380d89873e97d444569424c81dcf1ca8233e3dcd1873e63a3557d76f9072c711584524ee2563b4aa7af9e31a65001908c07",
+    "7cdbf257df0ec2acf26c7ba9f386eb318bd40a012621ba7123faac7a6f9520c918b038989813a383030abdb7a0625968dd7f0f781cd7d65a0c5ef6f7715146b40ce23771edb944586e0a46ab6ae4c8adb41182443ae64c579b3ea910023ffd343b12b923342b70d14c43c479e0cf13c47dd56e2277e521781e62127ef97b3550",
+    "b4d051787086e7ca311ed38d103cb0b3dc535f5694beb6670f41026aa233350f88ab57f886a2352cfe5b0a5fc8c6de816c90a1b8223cd459e6bb63bd8a414c5f2017026e272f1d112cec9343dfb2cec524e97a69996513f9009282638255ae52a5ab800d49822ff3c8c3da864acaf93d11985bf70f7e095a4dd60456584919bd",
+    "1fd173432cc3d36bd46a401a2d5513b0f4e17102b35ceb6853bdefad3b072657be2b739ed6870032bea7d2aa2690b223a5993c8549d664c194bffafc3b53e3e57e34485a127767c234dc67d3e295cc4654e7e7f24efa3a0448933813245d4be1286e63ffb28b28b4f65c028e7a959ed8b6bcbb66bf854a9509f11a6941",
+    "645b82dc14f6a19d3beefa0988916e6200259fda129add6ccf78db59c48ce6f481885bd4065922516dee5751a5aeb5d3a471be4bedd9a4f6bfaf74d9125d4e332fb1d54e2e7177281f116f4bca22511760d649bbf5ef0c586e111ce1718aa70b032b0b4028f1d43a10af5f1a5c2bf14aa174ef72eb2852da5da6d6cc0066b3b8",
+    "e6cdc4a838cba99ed66db4ccca9906fac1d87cfa5e86eb37a5d55e72a3fbf238359b14f9dde13d8ad957b416f6ea7d5c0c028fa74ea39846af67d50c3160ec663f63a78f30bf66cf20333e2e15f5c0d33af72eebef75dcf642e4d4d0f53ea4f3881d081d4683f22f4bd60e2884164d14c75dae438169dcdc8d455fcaeb040a9f",
+    "b63505aa295b8947138d5a87066a46bfc01c9f5afcac3f5b4dd47cf29ae0e69ca27cf32f68cdbb611dbeb865a5400d1e944da2437f1adc9f5aceb1db03ab412c874b5ee213705b045dcefef1d7c070193763dd66212b15ec097de10ac7335625f10f0c8cb7c00a328c1e02274ebf9b9e056814899965d3701c810ab8",
+    "e9c2bbfe804a36aa49e5b1cfd4b726310c58d361cc2bc1451b9d086084652722d1bb8621ce2a61cf82efa1741276768db88b7bcaa2b25b0b6639b97a9b2ff61782c3f6b3cf764b363633ddbb56eeaf2f7031ff9e8a47fcbf33447464968b3d857ebcf61c937e9ebe2fb0ecc439fc13459d0fdea09820856423154d6b97a45dd0",
+    "b5467b2488b73070fc2970ef459ffd71a2691e79e6e29cda14548c752fa074c4496ab34de865ca3d1ce5ed2518699e17417b83be8730e98f36d469c6b80b7497c56dec078a9f9abb01c60d6fd5c731b0c755211dde3ae42d94937e0cbf4d9c51a01e9a794db8c8b1125adaf585afd70fbf8ccaca7a5f70f01a14ac83bbf49dab",
+    "2de35da459f305ada1959d9eaba076256751612cd09c2e5ee1620ef2b96b9eaa6ce672904d1fded9846ea847d572d451d977045a1779516544ae8b05e8403a76c4bd54261d13a813a8150bf6a81bb443ef298251c828cca366b806206f912aa5920a622948e093549a419f8b99dd4e3a4effbcd124fb3412038bb45",
+    "5aee753560bc7d61d1c0b59a7d349b4cac00481605c59ce7489821be48a44204a97cfbf8bb740e7205c0ad3733b82fb59fea311170ebaadf592630d71332f96329fbe8799279057743e2f4eceaf85f29711a10cfcf068b12e2d21bc327791c65466004eb278bc505294b1cb376000262a9de1ca6bac24628ea2e086ad62d1cb7",
+    "02b671eb357ca42c4e62ccba3ae1bf526a9bb5c539bafdd9fd89c19a4119947f72f39651264e43644314f3ffdca994101768b2d4556446681bf5b8964648a8f20490ec94c68f915740aef68c8b28e34fa757f5d3af84da815acd0a60ce1786b70d8c3551578691ed4c43f17e1573adba8864da4aa1cc0831873adf011b69f6b7",
+    "6c99927a3289fa33aa0ce5807d4fdff545890feeb4d4f0c9020963c6c6870fa1da848b40cf93353dd15b0c6a42c7da74d8b55325b7b29216ba8c5fabc6834d486d529a3f101d149df6ddb8cf825c14b2e2f02ca8d2ca9c4b993851f99ecbc0551decc699b4bc0bc0946451974cc49f91b094b57b9d73be4bcb431",
+    "5d7c6c2fdd91de041914cffb13c0a8b063dc8e79fc4cdb412c327220abf2c88e336f01d9d1ee438aefb41595510fd3368ed01f1699e88ad2269135c5dc0b3825313e92a80658f3d0b4580494126f6e80ddca1cf3c03e0509a23132d99d003f0ceeb67e3a1b3b2c5b822b1e7ded1d1de33aaf20030505f7bcc01838021b9d1295",
+    "881182ca061bf514ef449f874511caf912e41d6299bd402ade016242c1db2b43bc722abb7cb567d10f03cec718b662af0c59787c62ed93e0c96d97a35422f39f262c0d08d0b09a99216353a85123cd196efad01cc566c381495bc622e952139e023b6ed3e6347353aefe1cf9264e293776703dbc44a332607abc6445fd924975",
+    "53b702d2b2b60021953507b4e47147ea5aaa674cd3fd83e451af84d2c81fb679a9f885211f52db1579e0b94897433356c92ddec1fcfef8ed629f5d5c08caf617c993a50393e5836e10a3b23580831be12b4685b5a42c5dac747d5efe53713bb9d3a2bdccf96054b447fa9e6b363a126de9df46c663415540567",
+    "e8763275f8175421f7edea46c243d18e41d5048dec3949fdc949a16da726e1725862f5f3eefd9ef676d51aa7deb676ac8d33f584e304867beab6c26e26c804ffa6fcb6505aa5c1500635c8692b0a442c6ec154c990d32c4a2d18b529e398f318efe689adfe21eca7b8e51168311c619921c8ed04ef4a65a8c466bca5c329683f",
+    "980b4b5a202df7ed148c37efbd3c67f3a95f99c972cfa6c6ffc3c92aa2aaa1080dd643ce74cd5a8d37cfde36eaec0b6492abbfac26e0d91fc22ffca59ac2aeed1fc1a4d75f4994c02f8cd22cf0ca066e6e0aac5df88ba29270db7bc5705adc565b0a6fcb3586059bee7b34d7895e3db4d6133da8830e0ca1099e9a87d6814f49",
+    "7551d708400ec698e2bc9744385e391ccacc530acf4e88b54b5ad5b9b621b500410e54ac2a3b909a3441497aa742008095da0fe0503ce46c6d23f0b57b58816868c610706db9c5f50567e9b82ac18de09bd07e369d8825aaeec1ab9f4df22eafa0ee0429598be19306e4be2314ed6a90f576f9aa57171c4aac",
+    "c27cbdb267beacf435625b7e538cccb9976d62dfdedc07cebbc660f153d28a04a28c4de4ec28850d7c94e6274789b9d15ffca969464845761f86b97d7cc2f776df070835d2dff6062db9c0db4ca0c518ac5d29f7f4380505d3ebc16316c1c65550b4cc02f647281848bf3f32a937b0f3f42c3a10179c38d54b58cd84a991255f",
+    "f22eb895f6e8e50db20c9e2f153c80f668b8059794777bd6cce7e33faa89c9a13f85a595820081d4c05eb1c8333c262eccb34610141878b08be3e222188c8859f9431b0f0e1f652a7f01c15974365621b575bc462d844a0024fbe0d636cc582cca557ea64632b74990c0aa2639714bb2478130407f2f87d99c1b590177b0c331",
+    "caf9bf04097ba7bee89d8e6d6518517397eb32808640216029eb43a120537c5d46d3334880cf17faead0a1d93e88fa73cf4e47763c7cfcfef7bd3e4a370f13339bfa3a214117f41256680c695350b4dd915298db1e7830144286700af5d57c4ead576c772ef6ada12ee2ef8a035de03c6f8678f6f101fcf6",
+    "cb284d2ad6d65e6c45fb9d35634c83f8f902a73c26d0795000a8ef45fc06815a0703f1e26a3d374420b44b00d6097a8aad398128388b278952669e67e3cb19a195f0da7b3fb4c1f61f9f13c3975be84ec671a2e8b0fed025fd16ea94f8ed0d2c8a2a9188cf38669e55088be27519c55793b88f0f720a040b591ce745bdf5363a",
+    "b15e037d23636603f105e4c6846eef5da4c9e50b3adcd1a10cb3bd10ef64203e2a007f04ae9a207360d12015f9466c5611fc0ad15acd1a5e11d953de8fb0858c4489355f993665006778627ccc22021868a0b83909fa45d654f5113adf151f0c4101c5b37d1f92746795acc41c8e4ab92e3b347019072c05d184ace8566cf81b",
+    "1dd035d6c8edcb0dfbbed9d14af06af867a15cc32f749348f545e7004f5e3fa3796ad358485b5d1bcfc929e8fa24be62a21cada06762a2d05ec251d2f4bb1d98c84dd0226841a81c7ca90b021b470a1e4e352377541bdc56a398eb9bee8e43b9ed292b6778e8c1bff5aca6b73604bad719aeaef3424cdb57",
+    "fe53f196a063bd5b47d73e705843c4c5d07b199bd008ca1fec1242c40442a8015178ed27f601ae5a2ed9aae79ea99f56b011eb74ec4f3208d29cec9b869c5ea189110bbbd7c8ed0df2cdfd08731207be6f2f3af73798a13604f188407b240f879685449efd5191d30bc2f07255f872d2932df130be68acfb5a41d20d6af976a1",
+    "6358d9d3a4adcf7c169ef0ce0a4ba38a42af02dffb8eec203818593b6a98ce2d1803c020b5fd4a39652b716d3259af108876fbe88c5e2f43a15b355921e7c393580447460766f05f4eb69d332bdc4fdb4cb1ffe6c1b99a79643fd23d614cc801f4cb55d7d9c9d1e637316eb16d81c03c83cede6bc74eeedc962508d4fa6af7f7",
+    "5f74456a4eff19e20af21ff9bee3ec7fb9031a51ae40dbe0cd102521146cc2f5bb6733b247ecca0e649c76bbc0b64adfa77f2b47931ddc71a4cbbc3f9c77d9ee58753e5c0f6dbeced29605bad9ebb521b07cf217a991075f3ff8b02a6adb9b77d338116e13a65c05d7020d40100cffe05444b39a509e9",
+    "867e02242254df8ebe1bf1f912ef046ec81ce20d3d685fedc34b639eb4c32f91ac159a36ef1344f9b615ab084af925b47aa4007a4d8c7931d73aee594147749e486910da3fe051d270ff7efb96e0f1601d4b04dd3f50c2e1dc2f5e89dd58719a79a0b2951d94dced3482b2d1fab60dc9a309092747064fd8d63e57e96ad0fd75",
+    "e419c0f2f6557a63a8a47ebca4e201ed9c748aa9a47c36474913842e33e63eaf83b129d8529cdf6b61408d16a33f4fb478f9b4c0f21fa6957e58a7b80d20fcd90af84b3ef873637b6c68d90e015deeffca5676a1e618f91c25638fc6a6472e46e4d79158f11397a9241686fe589979f892c255175231d3a31b80d1171884790d",
+    "635ae22acb564dff05fa7729811097d75c8f94cee5cfa5d5cddaa93d65ba030af45234e54653157d34f32cd0ebb2ee59812f27adf86583725b941418cb8dded3e4530a9b0329b41830c9baee9596fea3949c0e34f892819264bd24d65b356a52aeab23feb9c32b07838fdecea0d11d9093d80c1215d4",
+    "e75793af0e5864ab2833b9e8ed17cbad60f7ee7c17a90b5c60c06e479b675e22b8437e49850b9a2d359b8d7b2ef1e7b38be18a460349037fba5c2e7b0a5c5b490ea44aedbff14126499c6eab08218abdcc00a5ad2fccd86f4d997eeee39997651bc8287a176df0039277d420a54931bc7bc64bd543c32ed8beaf87f7dfa38ff4",
+    "f226b99404f990dec4fe330cf6a62dd113b20fd168ca1b6058d680295018a7ed7a43cd4d20b7f8a237b692169b8cd42e4ca655a8cba89af228c6aab47662936a7cbc4df83e06d89bf2dfcfa04ac24f1919492b881d36e04fabf7dfcb74bc3e5b07909f50f3020ab1aca769f44a05d7cad6b1f135df7e953acf93d1baa58f7e93",
+    "507b17c6de6d5be38a2072e57f2f34281988720ebaaa90562b5f6915593b8d39b42a2f8d65521737dfac948ee2c2dcf6c843abdf29d4e757488fd6b3b4f119e3bca927addb1e7c5402ee581c55280f3332d5f58b6e985f77ac9b9d2f327b0074da14b6cebdcdd41fc501cb5eef2bdfabf107f41c79f",
+    "202621b29648616f26202c137f7f83bb3b750ae2aebd7ef912b9720f663e0554e234de4920d339ca23d0497c3e73480a1e20f785b9db8cba1191a04d338027fd998be68bb1c6c2d342e95f5e65cea3b1751fb429f7fbe15eec47013addabeca463c642217d4da8da94184d76f6545759b7cad6f48252015161e6cd9b7c6e8cf8",
+    "11fe5374cbeb3eaa92e25939221b694bff60fe98c26581c211b16fa1b75e6603ba93c1fb9515ca6e49528dfb8ed1288598bc4dbe4950855261e05502f296221fb91ffd669ddb6ee20aa5297df5adaf02e4c57e957ea958c5797f50a98b4ac39876a4fd171b12a71c2cd8e3620278129000c451824858c589c9e23361e6cf41a7",
+    "2f87c4305cffd927b2f134b40a26ac41a64b7e94efa0f5603d7638c62269d7795ad209ae81bb0a880e4c0efbe4579a8e79ef5c259dbdbfe9958352341662f63d577d4418ef07d2eae576e1c6da8d1134776fa62e5e364b1863cf6e951b3c607c70d79bc15256da5f0ff01d60eb067d3f2d6c7f9865",
+    "3b62fd3a94f488a6ddcb19389df3043a34a62baaa8a380cd35a4bdee3453522f94be33e740d6c1cf0163d47eb84a8b753dc94155e23388fc9b9584e3d4dce9cce8a9644a5dc4868d18ac63a09b94a49d0d9259f3cb3495ca744fcbdc608c7a44693fcd28a16b5f1176726ad25cd002769d5faa6e2b82ae1cc021a9a580735bc0",
+    "2af80404ce75c8a53ba0aa10a1d25a7e42020f03edfc4cbda89d9f39ed6592041fbb2b59468342d19adf967e27d50d28fcfe6f25c7fb01f609877a52d5e6b56b2719149718e2fc4dc4c2be8fef216be62edd5e585a1d5211b3036b45d4bb97b91b2926ed13ddda9c37596e83563133c943e1a522848f361c2f690a31a60ff14d",
+    "82eb036ee72a8add12ec0a89efe6998db4ceee9bd7d485d4c6916edda94ab1f73085d1b178792c330cdaaed69330f095fdf95967f5436bfbca07fe8286848536fb52e736a471e317929e9e405e72b0ef1422b16e6c77c06c9f4c7fd34ac0073885a99cbbd123a8a663d4b8f973ee2e4adf52d8d5",
+    "00e54dd829535179e308bde2781942c196934cc0dfdc345d2fc91629060fe2e34feece8ff24f4f294f767fc854dd8046f38aa569d062a9a6d9225531ac9d7639e58b6088b268140dd85b0871a2ad6403b7aff58c3de6d6efbe858fd08853bbbf20c96f5e5ebcfced2f9dc889afd4bb1e40951d9b7321a97ccf383168e6a36b30",
+    "8617a282095c8f37da8359c2b69468e40111942db49d14ffde29c9fd4c086d2306593883f34667fe675ddfa27bd32b6b25ae1c04ba1ceeb191c536b1505766604cb717657ac6e3b95854dc740730621975d658c9c31093b62a4e6890f2f63e9080b72457187e1e876885df3e9522df19515798c116e7d89b2e049da838eb12d7",
+    "3fba203909b14e7f4f3c5c9ddc41b1117364dd3811d04264fc790c0ab32e4bf29d7a04b75bc4f3caeda491da342437dba548a031fa65f1bd3dc3c29e92971632dc79ee1d4e50b0270f9ca726758632bf0c00ad42f09d95acb10a589009e3ab84a690ee8447acc514f969a5cc154b2c9a6a2a7b",
+    "674ea953199b159da3ab2c06e3d003af09bd20ec0cd5959d7fa77f809376e066266b178baca0fcb9cfdb934979f24b877643ae23c6803544fc316e832e8038ee5ae014a6e032a8cae6e61324a8eeb2053ff3f7419f5d0138540b2032083c5663703d9d05d3e9399cf4068086c0c2f0cbbdde948b82631b6fa11259ae8cf03331",
+    "ff97b6028872c85e87e52eb343d1c6c98f3af00a52fbecc2df69bd34798614b15e6c3038476dc71ce71cde70c5a053cb7b0a9950113aa6ff0f3a3528a974b37226af38bacf02ce11861c79b43054e2e835611d2d8b74062e8d0c989c76160af38e4f4e5d4a2935a5ed9c769bb104195327d8d749974b2f41d618a62de93c3c49",
+    "9323eabf936c1975aa41141724d090f50ada618b12bcaaee7e88afa89b9577acb4faa517033090fad640ca8c2ce25d7e9cb9d3a3abaa8d611abd1a79e82c038c9fdc1b2deff584235d77f30a0c0dbfe12fd3bef3ebaae95e5cbef7a81e059a5cbcd506bd7b8800f20f80a7c0cfd818b1251b9",
+    "2c6d82b01cb9bb75a4de7bd7ce83af0934ec13ef384f603e75e488063f7d981b276e23e9bde0b9c287ca907024d50704d95c9bc8958eb6235907e3cc92f0930492004ba2f1bb412b07a15ab829cb0b0df6a6975fcbb03c36f5e92e4827175ebe74401f69b1cb09cd52214e3cbf0d0a98b63d6ef07a967b9e75c1b67de2ab6fe3",
+    "2a88b451eff2ce909c3f5927049586f55217b49d2d3ec77cca19094f185698a70bdd825b9aa7eb85a3821c335df7461047eb6ec35a2d016961449afc696578005ce7a55e974315573a50f581df4ec235f7aafb3d727736f4e3505cab0e142308c2e85eede3286f40008120b4fa20ef2e3dbf1b65d5821ba3170c943efb11007d",
+    "ca05f6a7722df837c8665508e008e01827052c6e77fa2227a1eda073ac6b15c33950295811e5f94df5d855f20a9f8fb64be63dff96da36c454aeec10903fa6a5d3a86cea45b44a0b8db8b57aee92edbd036ed785daf6ef8577af2a479c48dc8996e58322dc468415456cf6cb42a2f452d6",
+    "fdc95aca6cfbf37dac119424464bdf7f4da506197d0f84ea98a3a143e1231ba8b3d1d6f0d7e4b6222ff0b7ce1cdefa12603f3debb0852004fc20a1e323dc242124c721bb627cb880493e6901acf5cdeeb5c231abf376287978789da6bb76af0f0b86fbd459244225be2754dc29a2a9ce9bec6a79ef126be5265406cd8884f0cb",
+    "de8ba32fb656874111c360f53edd40de917a87f810dba8ede9f62419f519443813b144936a7a9b58fd503c96427d3679f0e37867df1f0b9a5bd725fa94e627a962b88b9fb5dfc8b111700e0816d5e0383d625c2712e8cc2cf46ff554e4b51196357f529fdb6f693f937b28456cb4755fb7204004b95e77fa424bc79a013bff87",
+    "240b64c2e1369679a01bcfa7b67a0b84f93c26b04a405ccbec4c3f46d0c3447332a53c1443cebaba1942e66ee8b75163cbdc5e7cbb56e5e1607c78990dc4639e380e3e011c952d3c7ff6e991ae06eac20e660f23425cc6a1a85580774ed1cebd053beeab656582373886a40f088f351ee1",
+    "d09a43fa9a47bdba4e82c855c8c7737427e1ddc15370f930cfa7ef03ed11a35f2562829e98398dce1abf9ee82359d52cd84293dcb32e5b283259bce45d7ab3f2f84c5d7971e83bc9d45db0dc8880e4b89a581c146714d665e3b31d4e6b70f76e283fe3cbabcc2fb04090387afc153ece8af2403b960c7e3d3f19e6af229e5715",
+    "8854c5a37444c2d1d51500cf506450eaad5f25477b9e7361249a3cf88570aa034c663e04dd8776dca172286621e9328b982bfaf37909348054ccdaf596ec0287e025923b11de833045f9fed2a77cbca2cc8741c0f6f341e537466a03427dc15c8f68068a0eb90f947fd63d6d702c7e3a4bd25a540714a845c22d44ddc77c82f7",
+    "3ccf6ba9685dd87c0743e70abb9d1c1a151d62ae2ff7b70fd3ea501e39bb7eb1f4786b482c19a2defd99342bbde649f448085fb6de4f25cb3072ee543b847c3157a0d832d79186c894ba15f3c8c70b0bc4753c9a1a052b09bc80ace296aa5f88c8937264e1dfaf83ac321e22c1d1f251c",
+    "bc8fd9fc6ebd13987cc2032d85927d4a7f65efaa0d9a580c8b1fbb7c9baf29942cd8bf26eb972d6f599adec37b0d4ce281c1f7088facb079371e16c9ba969d3290246cc07ec22a6790acf61db785667aef2b982ce34a36cdb36d7501af9e2495be3c81f9193be7869addf15fb8cdf9de94931014af2ac4a51a1083f3c4958b67",
+    "a97ded3cacda878960986118686d81f888953a76197c989d79ff682350d91a1a8c7c03e3cd40b3b18dd345d49acde9fdaec814c4d2366222f2843a07163c4ff4d04cdfc0109740320cd7914be3264dba67daba132c8f85789db2582c5af282ae769db8e0a5a1a5abd313ab1814cc3a23db81d8e0d2c62f6b42b0077feac95335",
+    "45b655db3e324e6974095f92815d0b4d3f1140a52b14b16a0b8930e98213283741bd0891ea68225b621e846f718d37ac1bfcc7ce86e7727b23b01d851af184535a53fdf3688ec7af06c972ce2556aff7338f127d77711bc85cbddb151315dab97b39bb20ccee8962d499784404980d0",
+    "19fc29d6002db0540b197aca99c8e284d2879b8628f65cd727e7be69d1c19e49e856d8bf0acc83fe8f2b2dfec12ae1e91c8e7f5fb53b6f805cec91979c3f05de8a3e96c06b621a1fd111344f283c60edf38d7aaeb0e2072d28827d46294e7e17eaa67ec6243989586ac30bb01a211e89dba1aa99702b9dca504b0fadf16088ad",
+    "89aec250cc051a0a03120963e28131b0bc106d9eb79e938dc6ce567fa38ba94204bdb96bbf87100ba98020054e2ac8c2c0e65b6492096b02a2824a5a0fce132384dfbab49b7c70f78cb00eb08bdc8617590c3a352eb719d91a069c51459c813520f5e8975f6760cf79bedde1c899925493b3a58b69b541798d3cce30f207785b",
+    "6df3500311cb211c01dd396312133ca7e7342772cfdf11f1949697f72ca94f0a8fdeef0484cb91bbd797351c724145ac1bdb5f984405f26b69fbc1c5d4ad7b4d9ffc0cb87bbbaa239a781999ff7a59dce2638545740b5adbf272bb69bdc574ab32595d41157400e9d3069df311ff89",
+    "3739ea26f771b7100dfe01fc6af809126785b7d32af0c6aad7a38022629aba81136e225393e2c2a5c4818f88eb0e011e8851329eca78018b64ba3fd53803eb6da3c251967ff610803017f310cadb3921f352ed156ce6935fb3ab57604aab67f808790615152cffaafd26a7f7780669e7de147a550d5e1376aea5595420d67e72",
+    "1d1039fa713990ba86b82cda31b4a5754b69f40f8ca1fbe319662a23c711c1d0cd5b27c505a525938fbae4bf4a55071aade1615d5ba1437a19cf320a9ea2c6e41db35293dec8cc9d704abbdf156550b5e15c113e8befe89aecdf8968d20d8aad7029a54304c46d6463c933ec2a5d4889bb00a9da1a4c36cf337447f55254eadf",
+    "7e90054515d220fad18db1049711d2e31c3a8115335739e18a7f72993dbb8498be4266a6fb8fdd86faf95649450e411486d39b5e31ba1e9f0d792d48cd84d79ca9838c79f4d816f63c51f3b5d73c7f2f08cf423415cbe3bc868fcd9452cb9c97644078998be84bdcf68021aea84f",
+    "6714f98dddd983d55e14380d25cb4929fdb7f44323cd6d80b2af2b6bd9e4a4c985686cd4b72eb97e6547830b3f6c118927abcd348071cac5f9d90a852795d7e3a69d0554c4cb3b64dafe2f0a2fb05c1fb94178b80f83ddeedb18e8f584fabad8dcdeab8060540e868649f2ac42aca5f8c8d22582ae1be822bc165211dfb4edce",
+    "dbf17c4a3e668c28235e4e9f9315c78fcca9382147a7e4702c23635f1e108c8c0cb5a5297ec53cbb7cb86d9648506bb72ca63efcda5d183ae0b0905ac54fb4dcb4809840e460131b65f7716de18afd6206022b7e9c978cc9a6a35aea325a71531413a9e9bca2f6c1b3ff63f3e48b6de11f2d3c5f6b934621e71e739d39469395",
+    "9da1847c84a4ed61945289abe7726d018cfea891162a205e2cb874935873ecb489c21f6341a1de8b8c585338d4e4709192770e9826b5c81158de48c6c8fa2b4c3edba99744ca4738edaacfeca20a7f2eb0300016f8c83742ab5e44f286fb897857e73a308c251e95e23b665a60",
+    "aedb5893e86f4a6cea0d01511427ade0b0c56275727dc4d9ba6196d3955b8f8517a664f2469124acfd967c476f7bb4a310b73625ba83623962ef3cfc9d655bcca3129f95d8d52983d793866048e67c904cf330f3edd6f36a6166da3944ed861c5038b715c2c5de39129f8b5731da9a9423f79158436112e8d133a169576e3eb6",
+    "ad7a819996bdc54f7020149f82a88f4636639aa92b722141be7bf106095369f4c757af69f594f9e1edd1b00ea436a9c1de68be4cffa88ba6e48aad0b9f55019f34c54d08272c772e0ae42db5ad8f516038d2a44cf07c8928010e2e8575f2ab672d83632caf42157c319c7846b88b8167ffeec33072036a45cd54b40f1d6bf989",
+    "2f1304854cf8b454201e754ffbe77f02189fd95afa869efa619b31564ba05f19f85d1e1380c74c808391d108c92948071c5d2c48f8b6c3166483033d158023f61e75980c6418d7e5725f83f7a3cd23ca01395499f3c2329f5ba352eded9ad1f5e4002cf51aeb96c5f23ff09ce7",
+    "b4cd3be74860d4e1bf9a999734d153d36f9ffd8fc9f469ff89665eec38a5a90026ff58c97ac1f4554ac20b9b0c54abb671332f189a7811ba21f04f38c712f3d0d875c4e215172a404f6789728b21616f07f892a7c561f95d4b5365c03238afe8253681a7851eca12fec52be485b92b46f1e753086611f670ef54725f2a7b4817",
+    "51efb148dcd64232fc408f690b3d93420fa96dda91e791aa5cfbf61647e30bf366e8d621233966b747d1c9a4ffcba47970a49d9d0b777b8afacc417dc07b963294bab0b3cbbf787aaef461a563cc5ec9bd913f7b7b55144a4f9d4acb0d1b26ee32ce21c66240f9e0a5cb62c91198b055995ef3b23cc802290fb217fdfc984e99",
+    "1ffd381ba15a73cafc1737a7c4edee4193ec6f9e03382d71f10b498b9c9047f40493ffe4cfc375eda8ba6625811e458051d3a9d91c2c32236f64d23cc3075e614b0a48d5c21603b490f890d30b3e7ac1d7f4a89e098ba163b0b9228960f2e60f142ca59cccfc7a940bc84464",
+    "4dab20b9396f08780ddcbb0899f82eb3869bee76bf9786e7dae9e43d5c8a328405d3d2bc2ed2c27c4eca9546566e3925e60443b3d456ab3df378e752ea19cf364855b751f22b3d74357cbe8152132bc9c1e6356346a3e4d65af1f1486bd2a832020984997d3cd0d057e4ed0df05d4f1c7327903e24faa897dde2f31587db9fb6",
+    "1b682dfc620d49a4c4b8bc96323d8b7be7bb6e63edf36a8521c9c06e81bbceb76a0e320eb5f5650dfa79f6b08733240358118ac68a0c35a5ae77c2246697af8b88fe026a2fe351789d286826500310a3d6daf79c48b06947f331cfe9d46ec21dd7e30e6a9ae27dcd801e551b0af4af2500cafa723104ad4aaa5636c42d7fa93d",
+    "3daf1c0b7d198cdc0501bba075cf9ca45d845591383a58c4319494ce260e39c9539e22296a750eac702f0ccc29883d002c956d763d7ff4f89b25adbc02663c1f6f9937ef78da5b92abfe18512b4ce385b10e13223557386d97b96d426c10474de13d7f8970a821d68275744",
+    "4e723dec00bf2a2a05c28a857a06a259c9cc348cb824f87093340d882bf84637fbb29fd8170596a445f94360c8d6527545f2234303914a0badb74a6ccb705a58e7e7838e803166189b0a83837411d67d4827c89a0c7fa02a6028edb2dc58d9ca279850ff6bfb5a87b42059545eac412547fd3df5015bd3059fa1e2283bce153e",
+    "1c7fb0c61522e23117bcebb2614a195cfc4fdad41a44e6f77e30f1198f37297c5d6e9fe1389f4d8a5e23e55cefee343ce2d033d2c97e239c658bf75adaa04bea5f9572042fa58fb77224f1b6ef034ab8f5911d398407780bca2a6adf323455d078c8913ccc59e489288a836b54d364a008e3be19bed71c7d39ba6cd0432777cf",
+    "926acdb44bff0b49e7d242ec0af175f7f7e89d581db1148b601b4832ab9df290733f9492f43632dc07281f4e2ad78545a939c623e475e5ddb1337100ae6459fce3cbf0a5c079faf45b254b5d0610e4e19245794809b04cdf023c1de9b4a20e9e439f49f2f326c26478cbc",
+    "8b646d1752399f993d2c383d4088633b54c08be7474916b608357a5430177a6a8581b0770466efaf126a185879f25a11bf72c6e64fb7414c638736a68e2f6f378e5a5eed11dc576d9e90b2e13a9a60f95bcfe2077da81e0c760d4b1f52c7f25ad4145fdeb1e00c32017e16c0aacb49bd120329ad7370250f62322e459f886e5f",
+    "67c7e2f48d3df21e12db77a42f051cebde026c627d58dd4fd933467f917b129406fb0983d4effcf85e68d575a0acd9dec324f6e7d1e5f5169ee178557f7e2d0dc15122c731f3c0832a4328ce9a5348960a63084aebee4984e68437539e4dd7a88e3f253d56b28a4379c4910eab8d7e5dd36afaec538d2096557061336020dcf5",
+    "7336c02b026daf421b382e956d65a54c6a5ce532610ef5fb855cdc3bc8e5b2ffe92e03078a2bbbb166c810342b1648723a90d307c9eca6472098de2c5d724715561ce1c74f5ec6058bb0e332316045dce85b2627edee6ffa3e71b212f7329cb334e60186cac80c5f42c",
+    "f31d198f1b0f970d802b98ccd694aef6cd712e126333743c82bba31656d5697ca727be245411edd0f57fa5783775167fe5de26e21fa36b83f107724b3ed119fcc9bf88b042fa77854218c996444e942d737dffd177a66d2d3ca722fc33fcbcf79fb39dbbd6b293ea4784d49cb84fe1be7ce63403d2b35580f9270217c9d9b814",
+    "132e36982b7bbe933217497659f872ca9fd9c9eafa823307a097f04a3443e97e567784a7f139d5171262cc42807e3e73fd25925a9fe4342e54e22efa882306b89f2604b3dc8c062baaedfece8ca0a76d3b3e3a92f3c55047b7706acd4bfc25c678a973efacb515e327f4cf2107c29286480692691546708d70e019a17845c68f",
+    "e78efabb7f752ece0c45a68a6e0cbaccab2adbe10780aaf521056b5e0ce13157225c9f0906de30f6ce78fe44ba2d19379913930abfd97c74984d08f62e50482d7f88858cae981c12c903e40f491f5f7b398c03c6dcba30dbebf591d8dab34c9c70424a5c027bb53276",
+    "c36225b70702db86b45f3c5fcc8b90a8023399cf98445b560a011230791612c5e84d845cdce7efe5193221032f043ba5519ecc379089384ba875a98fc1c11f9b527157631a8349c922064ad20d6b5070457baabf96ec3139dbfd9119a38dc2cb118b03d85bfe2eee7b4ffff033e20102555d6b490d26be48a3496711ede70161",
+    "2ca33099ff9bb831cdb411ad60f6e185f4044495351a37fed6f1304c38710781305fc213593fe1f027e7191ba471cfafda6da41c3b12ae5ff392c432ed9597b053a08a352ebc04a549bdf03f34cba83b6751c266435d71376380d96da99960b9d4f310520c5c251dc9c4657a9219c7546c725ba9574452bcc2bbafcc45111a73",
+    "629efa8deeaae7f64b26b2317f37c8507208a804b01fe0affc106a259a2f95ab09a37fa1c1777de060736a8e36af32feae3ba7df5c3e4e549d14fa43065cca47428a2a60ded533e8b8d346f0181ddf94c3941a9adcbfc90586c6fe38d90945a81191297c93b53b279",
+    "015062cf86a80b2d7cad58940d04660a935d6fb9781d8d32878ea83cdacbce1122eb2715435412e693f3383efdaa338c78de11ac6b617a2e229e1220784ee875fae95f85f71391f5950655f1d70fd7c6a1409780422da8edee79a9d7d9a4d10d17200c0b37eaa14334af645b8628e22b75efadff161c0eddd964deda242288c4",
+    "9acc52f99af898c5a5337a4a3df2eaa8fbe5cdd35fafc4d27b477f29ab44d9e71202d0db10d86779e0952a410bee6eb06d406c2d38a7201a18dc288f14ef2cfbe540bbc01714de5247e454f30f63fdcf61eb78b091617bd657d38dd048f5956bfe4eb3df0aaf8503c07932ea0181065ab5beecabf47b65a309a230338e39d863",
+    "1c3224f9babfdfdd41732b9213b0bc243df8048cbb064043b53e1cb04df30e4d8ba0abefa822dc42c984868800007f9aefbaaba316ee3e1f5a8973dcaac74d2bd616f1daaf94f9ceb4d99300684e162703641975889a97b762f62d7c6a08fac6479567ae0e442a28",
+    "aa1208324d89eedb64efdb0e2053f6171ad4c825da8db2c9880dd38aa8b12e4f561ca4a09fc9c1691bdbaeff33f169df0bd248c123f5c1ba090ad1b8a2d17475f643bbfc7bd694fdb10665f1d88e63ebcaae2971cdf02fe1ee795734b1d9dc203b0465c352195c107b3ba048a8abe0ca98eb9e1b8e614dac8f6d235edb5cea1f",
+    "c3ee0fffed9b2b04923d875a6b91151bee919c876f4ce6308acf14f9a368ebb9738b2dfd4ff53284a55dcf423e02c90d2ef50e682bccd3979e578b2eaabb27f693bfe23306ce7ae2a9c95788a7b3e039a48eeb1f5571c8981522a827262eeb1146894bf7e813a53f1ed768aa73128ee4729c9769d1f043db1956f1b8bb5c12cd",
+    "5a294044f883c57b8d35d378351671bcc1bfaeaa3b0ca3cb5b32f50f84a2e7fb0036bb54bb54044647472493784e99ebde57889c27247b578ef893d56007f976e8e1399f87316a3f63ec934faf286137fbbd50e4c7812c9b2b602c08f6f20d96c9d0196b75275d",
+    "670be5fe249df27a775f3b196869ab83251495bb0750941e15088fd260c1c90dfef227b82af713ec73f9efc2fb04864c99b7b943e517c35ab1799c3655cc57774479c381fe8ff6b194afe05688af72b104366ef009bc3ce0addce01e011ba4f0c3da52c0c64f6f144606f7c404e7686ef7c536a2cb4d4637fb3b789d65bbda06",
+    "4a319492b0e185b74ac42e2d308a515b421d15d233c347fb2fddec3b14f47ee104d9c0994eb29ebfb0e03d6776682b27112140e618b1cf4ab40c64fc05a7af1242e61373513f1cabf0cfad2ccf8c765b753b7b9c0d2ff96e01d7cced373818c34d5a99b65e1538a31bd64ad885bd684057c560325d462f89abcdaeb4159e4b23",
+    "7f8764620d21dc8ebf30fbb75f31d93d7cedc067a90f9c8407010b77f478164b6280f8c5b4077c65cb4bf63a99b2991a6fc969167c14b83d02171cc3cfa7afedad140cd4f000653db85c95a75b900972f72d760999d981963b098f1972c5f7f7e7e21914e0f9",
+    "dab9cf10fb108c6f568480055246eae6a639e938c49327d146b9ab072472742f6e13738df2731e2e1ee687f61086410252b23791df28df919e4ab43d70d0458b5172e9c2f699d2e380f181d40efa458a7bd02f83670755a3520ec73e893245290154552aae2ffaf4a5af8252f3a833460908de00bf3706ebbb66adc3416b14eb",
+    "d0448b7093821e1311ce8f7d2d518958a14974c9a23bdd7e85f75429cea7ac7c209ecd3d92935060dce4b22ea6d4856789823c1d2346aa56960b3e34d544df0e725b28144d5063c095df51fe51a21ec11723beb27fbeffa9b08be1dd918649f7cd7cbbed149bc27c698d0468ceae0a1a4e701fa48fd68de8c7faeb3aaf2430f5",
+    "2feeee7bf718f592002b7c6ad2836abcc7c05587baa535193313ba7273f3dbc9be6f68e1e8d27a25e04a3104741aaf89ad7b4233d967357862473d784f56df3323f74972d6d318ab7132206524d7dab77fd6a6e992803af31e774b58e7dcb1d8aab057b779b",
+    "ffc1942d5b8d7caab2e79292ce82688c30770f247e5500e367bc246d35af8eec6ff587c516c14b0644560e699d59c763c3e4df9b8a1394e0bcad766b5642e52cc604fc736bb138bb5faaab8b72b78c4b201ad08a27090954b524e61d0c164d5dbcb3c9f371b84d540d3f004428af1c7073733e989275aafdf94003c3c5e58e6a",
+    "d657ef4569e7080e19d969ae8116ce8b9d2f28402b35823320f9c33a837d28f7c10eb7083eca06270b3075986abcdcffbbf72e03ace10e7b4083bdc939b35a1c2ce0ca30ac2aa0ede52a1ed94f470bb4888f592e015bc6e83a62c6752c364a8ba62257394d58a0b9e095e5e4da863f2c1520dc4badc8bf5f572e5b1b8bb37cbf",
+    "1f419bca440ab00352ee8fffa05ff976fe6dbb6b791f1d924a5ea78d92147850b3cf146f6e13c0ef496318651382d86c4fe31aece0cbf368869c2babfdd402d123eff72f3ccc359397571c927f0a68a4aada46a8acfd89c767322b47165998b4f1ab9e368d",
+    "87b9ee4288e9221110ff6009ca3eac36708b1517b1ec88b0e57088b7af49278449a06ed73312de127921df69d40963ceca6ae49e375264e69dfc5c8164dfae02dfc4a36cf609710376c00a2b669f06e69fb66b7ca193a3973a45923161bd16209e93fd32fc6174e69cf2c905a46e8a62c1b03adafa8e52807bf623fe9a8e1fcf",
+    "687bd0abab3f38d31bf553919aad1f0f9fc125e5159f0bdb7f5b5e6de705b636bbaf07a5aca37c21f46a8aea7dbc8788dc475d43c97d4b38590cfe0e94eeabac06b47a073cc8f363fc12c344cb382eec5d02f200b3a4acd60ba7dfd26a93dfcc761bd0d3d945a0d0acafd9e4c5213bd8704964a0210363ec9ebf1ee3ad03bbf9",
+    "5605464d3b3ace5a39dd0a2c02ed06c5c3c187e41ab10f5a245e77ab833080a2d36f9390f848a839c230dae46524ad922cf8e5018852e24b14663ef1acc24f2270925d26948ca0a0b73b11ed47dd01a931019cf8cc78ae526a20c9629df8dcf2b747e776",
+    "1201bf643f3aa5098a2dc2f1eb2259ffbcd354c5a8b284ee66b5e4eb0ec63baeb919a28b50dbd81f5012766e035f2a3cf4cc88ff496e4b0187376cdcb3f336ff6577956c30c0684ece2681fd17c5b6230d61890cd54f970ff0875376a60f363feeba3c72200cf39b92f242177305198a606e2e07aecca7ab0d4349553cdfe45d",
+    "64fdc51b46acee5fee990f42d1f025954c3eab59119ab5ddac9ba6ccdaf816710bfa7e5e85641ec614850b1a03f9463864be3c4c437d6749c9845ddc5d8bca4af0fc5ce2d13f62f7648492f31db258035855cf9bb819daf9d0ac876524c0f2fd73e854a4effeb3d8731bae7fd71661b67020680e9466dd0147ca861fc98c33b7",
+    "53ed78e23a0a9f20a85a0ef8006cd69365cfcb45c788585ab09c8041b5de1d4bfa57cd962ae85581bb0ca34a039e7a30277ac0c3f8e4099f9f7c9e272c16e01ba8bd85c9ccb5f172698303d5d08b38b048255fecdec2173782c49023d9c3c1c000ef32",
+    "928a50e7bc7fd96ccd2600260c1c2855b83d1d3675b5c93afb370c39f236f05e71df9ffdddc3ecad414c1ba2882ec340501ad61c303e92c170eb2961f55ffc001c2623d2402427449919385c972d14aa485a8c57096283df36de2c8a1785d7828dcb5adb24910adad3e0e34c5978b9e57672a2ebb5da617448da213f097f60e2",
+    "cf4e16276d37e13947e9379a247721d0bd030807a3fa91b19fe5e98cde22c3c3d8d72b407043f105aa850f93dfe2070f5dc238d7102e71c56a621c9cc113661efe3be3a54f17bf8894a14ee39ffa455e442911cc014d147d40be6e6f71d7b4c2a7f617e52d763aa9391cc69497324732850aa615647ab6b19d8a6995246e72dd",
+    "6a12666588869999bb4870699ef6c0316741e53743eec5d728c6468fa6ac15a284031fb637d3424b944a3da4063727d67f792b01873e92827c8691a33bca40a26e4ce787bc52f361cfcb7c75fb5a67b7f01ee212144221bb77a244a5be87cf3d8bec8",
+    "1729c5b3438613873bf5cf847d621815d9204f85ee1b916db29ed7c118a8bad85ceff31c9d50868e08371d993269170df4063662272f164860358cc23d6963bbf8a045f8aeb4e516cdf61d85427acd984b3a442e6e7ef6155330aa660f9eb0f5e0fd59f010a4bfd3bf19c67533d5a8c9077db90b91c47a3a78593354f995516f",
+    "7052acff8d59f3444b0162e4eee5db27e8d42419273a0d4cb10034450d960927978d136c2b923afb619b877a361023ed7de582480600cc8bd4c0de2489689037ac292a4318f6289753cc443df96b93c7429184650a5bc1898b27d7fb7c4f140e597c5df190d50e0b787e8fc559df06ebc7a94f39ee1c932e1d956bc79e07e43f",
+    "215ca3cd5e2bb093f0f0980b169dfed36a58684f308bbc76dcff37fbe99a3e46040d9f502d069e8462a1871413dbd1623fec02954846b9daae76283af718c9ba7bba9272ef461eb9c0e2a7b512bee9ad357dd3d022e0f87e8ab11549e4f4ea1dd1",
+    "9e07abaa5ec0f6083b3f0854feabbed312f95791a0710c683ba1b07f2ce47317b3e14c206561562afa62ab99aec60406df028a56e3ca969e5dddedcc5689324a8bbd560ab439a2563e24dea56d188b0ac837361b86a9b3a8d5de0473743984f099f52077acc980780ecc72097141bd21e0c6a26d4a31396fe32965f6efe586e1",
+    "246dd2e81a4727dd1c399290d1cf8964f6fd5cf518f2aab7fad9f341e68a34ae9ba940cb93c66a9b344c6a4e6c27dd8b32c00841da4601b46405e33aa0c278b7b327db7c5eecd85a0cefff4e331e468a494fe2ef669564052f6a07908ed0f4f4adb85e48dfeb78d0cacf56a8a71e3887782328e8c304f0cd80576b5b5b895ecf",
+    "f384c84229154aa7607733de2cd704d834db510a6e7f69ab9203d9a948e2a3c51543238728d2ce91a39d9dd58ac117b471a1d60c7254253322041a46cd881354bbf1344db9a769f605892927b872409656aa061fd59a9917b636c9277ce167fdc",
+    "79c9e84fa0e9feac22ae6ea0e9a47601b66600fd8735255e4c78afd85e630d5885517fac4e7ed7f634bd88654380361c1145c7a25c20877a6b5b07f6f40cee2d65d988d5e401b6461379a62396daf4826b1cb439e9a55d6818b2cc0e55be9201719a471420606c3e5eecf9c33449cae9576394762d4821e9920cd10f0b2d6b75",
+    "44a387590ae43a6d452c70e065bd1b443a8cfaa6fff771525866e1c82b4e12d6e74f7ee11fe32b2d61b7d801d17b20fbc528f34968a09a9aef2a213a759c6b7b561b0b83d9efbb170d4e2d70fbc99fb22d342c682f8dbe1e347d8e66506d4a0dfcf8872a18f57fa8737af8fcc82a1e62a5e440d4bf7db6282128cc60297874d9",
+    "369744d0402ad75ee7edf3ec93d550304504f4ee060f6bef0f763e85d93830a418b9f6a138eb122def66193a7d54c5429c40100fdf8b9ce47fb4ca5798ad9ebe687038d9ca2da1b45ffcf9881b2fe915df0fe2559f0d90a4eb34212653e1ac539",
+    "64fd2ea0fd67e0a8f46c8a38e05aee165b4c65b0cdd1ba777abc45eccaa24414629a77ec45d86169a391186fd29e321c586f56987ce09f0d90cbb94fc8ed339f9fc3a4def48502d3b6060fdd6af1a1f8f4b2da1ee7bf00e819dc17dd8d92bf124a536c4f659e5691f1d22f0fb90f5102578e4dd931d6639a83daf9ce2e0fc05e",
+    "a1974456ba7b0f4d97004be78a1d944e0d9ccefcc6d9e237ef31025036dd0a00cc80bd266c0a93b9ad505f929e61b68bc394ece70fcd16b83114f4be44ca810118b23f77ab1573b88df3d065bf5b7c9954444b375e2c6935299be221d6e474c53bee62749abc07b9f068dca465c1003798e27c98e50c02ed6f2d9702eeeb89db",
+    "fe847877066241aa3af3e809c957e169af5fabc59141093114c7ec370b9f3d9cdbf2b465ceff8802a19c7c8264df27650728837890b1a16588691d37d806f787419c67c976f4b4a4ae1aa7decc2773ec17435b25043545f927ed24a327d5507",
+    "b254d755cb1148b65fbb562cd0174c330968ea93b9b3c4d61e9a0daa3672311b4f40e0024f2eed99a96ae152682d96baad215c40d35b7bc32b67112f3d406ee38970efd5e1c9dd97f6efb405030ed74d9595fc4c48b30b320c21e90a909e7f615a4e5da07b1d262d18e01b1471c1f19e9be2879530431f795802c10836999e28",
+    "47ca99db4e92bc4991683d4877ea9ede435a315503d609d65102315485fbd288dae003748a63a98b7ea1e9363b4de511a3c14df9d1adfd33ad4402b1e126ec36d0cff2b5df1573ba7468c548598c08f98e073791b65831ce8f9450a87ed2cae6bc47e8533cd9f2db22376e3e9e785c8f98181a870ec10cc83158656e0fc4c971",
+    "34b1112d8f331f7f89c81e861e10482038c5bfe5f2ee643629b4bc4b0ec94a6d81b07a20828e2b97562b1d13231548b81632ff7719013f4c25e1356eced10638a9eaed3f34e5b02e5736095ee5fd81377478f37f5d819d2ba684f42e21ac5d",
+    "9669b6a51f368b8dec31637b106265cfa591a474fd4c0166156298f9d4b2fc7b8d6c2eddc542d503438975feef3d3dc6f9e41ad33fb0b561a682e721eb476604338811f6d2783bd45c0cacd51eef6f4e1ac3919707aff7a5a3091c365145e6442b487e6e0aa15accb0106c06b1647d5e453a1e56bc1b35627b0d24e79b1f5537",
+    "b0f1ee2fbfa55774d02bade1f3709613f3109ed7f0eaf3c56baabc15d69b3cb664cb53f9795c1a0d425c59724b4bc563d0e0b307fd3c82f31bcd1e7a3a212eef4126105fe2fa12ee181838980810b5222116468d966090aeaae23b287c3ccd01ae5e7cffa515e5f0b409d8f4e99ace79db0be54e1346db1ca7808049908b8925",
+    "5ca9875cb6b59c9dac72201c517c3c752e11c4f7a9c54012f6c60c6dab419f795d598de23d17c23cde0ab3e7b9e63d720cf737f173fe94d04ac38cc8bff210b50f755504ffc8d9a7c5528a1c7efae5cfe5c67ca4f2cc9a4dcdfae3812fac",
+    "1e562f26b6418f78696e9da8d4dedfa58eb15902fb5e41eb2690759d807813e3be92f01c3c8ee16dd1b76063904ca137ffd864817f967e17a08438e72823be15dca3c6dc1b8bd9049ac46e17485904341892d53a6ef8e73658bf1c1f1198178b866a16f2abea0edf1530409d5fd6d211100beed410633f7aa1395f3188c054fb",
+    "587f12dda0d1d78f3be25f00ce82e89f5330c26ea4c7bd55addcca744cefb3bc2ce09fb84cd33ff45cc2d24cd8c365bedb9d932b98077c5de8a86d9947ca470eb02e29a6de9c7f2f6e57095f97f8701dc4f515cc572958d33ff1753d44f6562c93b8dacf9947745697e8bd063ef6d135c9c3f845481be23d31ad72f533bce1a7",
+    "88d1a024f463f1172c4bd82457eddfdd0a46ebf29c9bb98a5de9d76dd55e4b8877249f438c76603afc4241f7a01b810ce9fb97f813e554338f743bd7759241651f175952335cb07284bf96f4a6bb804d319fc670c94222b0c6cddcf2d4",
+    "69e90ea48b42ae03b76a46567c6874f98fdb64b2cddd017e8fe030f2a435a9d1da82aaf336e231d7f6161c8fafd0817b5b370a23e155b81133d57ad7adc7271869bee9d26dffda37151d49605cb03f2e4f7a15da06cb5ab4ab95fa074b5a3cb5b55c633f4297c15c4c37472014fc9e69ef68c8b7fb4e177afd85cdc7129d69d0",
+    "94b384c144ef4a6727137b0241e9c687df816515265d5303099a44df5b8eef12b27cdc4893d644ed3a2887c99d0c2106f14fec4ca025aa73b5f230225c16f104fcf85e2a735222f688df7790108bedcadb3f295ad3770ad30ef2f032668e846da4a287366c35e733a9df422303e55ae55d98a64a6caaa7e081de8d82d8e1c053",
+    "df545e0b4805c14459d04018f03c8bb8c26d23cbdcd4b26ed1d81194cc24aa735ffb2c1beb63b6c29376b166a99bbfc318c1794a26c9fac85e45a8fd645ade00234fe71abd9c2b69ddb3804f3a8b2ad759ea3bd91e84877d94869d04d",
+    "74a7486fbd173f6b2cbf7d9bf92f6d8957c8a1500ca356ae09a22b6c5400be14fda32d59ab1f1918a49e66631ea7acb49df291ca7c137203578d48e5533046f252f43121178697396a06692dfc786bc7cde9156964eeb27ad2af42c6cb8aced056d01b81326e92f372fd0eaa296b2bdf9f60e64485583acfe6071248968fab00",
+    "554a9608fc6a4fd27be91c2f63471d9863d8bc0b94e8ad4c8749f42298cf0b62a81531f2de946ac06764622ea3f17ead17836ead0f88e80c5af15c2cb76e7d5ff3d8bbc6de83512ed884a4c3caec750e62cb96101c05d9917541d1eeabcc7594882a86b063c4b835e5e9ecc119ea5907fc273c81095bb4767a8ef9f00b145c25",
+    "5013fc71577c2fd49a2235a0c15b8c33730f513c6a4cf4c3e024a197d96095daa0cb0ffe3643068de8a6c45866febc423906f858358717cf06a12f1213e70463da1f2c8e158c9d499d715a009b536601d2a9b4f6b187992ba13598c8",
+    "9b4c03e945290b6be1128bc9ad988493eafe4da779ffe9af5a8086944f32a05cc29ff5bec36e9487e4a7a31ccadadabf2af3d5a7e1e9cad47f3287041b5b18415bcdee54e97453ce9449aef3802663f9a0b17497e90e9aff745aa546e2d31c56826b8c7bfabd6f5a475fc3d3f1b9ab80ce5cff50c8c772441985a8bdb9d124d3",
+    "02166e20018fb281da15cb93fa4f1c476c2721599bd7a17b39d2a72ca9d1f9c3aa7f4890ae44f6ac5ff2ae30d2fb222342ab530fa09564793443c3b7a8f5cb60adecd5931d75e384a2f43b165f652555117b8f69dbd170c462fd2b6c060b9a701b2c592e48f5b18616ab792dfe40d72f4e122e1dbd59ba5af80a571373f4e10d",
+    "14249752e537e96556d34f879b7b2c52ec94fb231bc3a0cc5d31279d01c452defa6d6e33e0e336a810c967cd1c679cf79eadeaf7daad85b2edb5aba70fb7c837f07c0ad6ac0a5513f77af775dadc73da021262e2869dd52d5a6af06",
+    "338cae1ed90ddf903b7c5b568efc00be6c1a77f6f8a302a3683c049dc1b82dddaf3d9c71be7db63333103a308802a805c682bb8b5ac0cc125d197f68e07765139377e734a8cc7dd785999313c11683f556e60c1a4276dcc337f037f754e1b8bef38385b831145e1af60f2a33e1c62916a2a2e750767f5994e1c41d036b514721",
+    "58eeb91a38d3253cd4f72a54c98fc625b8682c2b5f47b9daa53f5a233cdc11f2c0756689c806de1f7bf39e7fb4177665b4581cb68397de1e7a381d0c0b001f8a95121248a9a3db138463ade1f8ff889ebca5140001fd8bed0ee8bbc3b39023b07c6d7ec2470b156888e922bdf0f5505edc9940f2217d6a1133df7b4ad34c0f97",
+    "372de498f82a30317da49ad3f053f58dd54400e189e4a1b0d681f6fa6b9aa0a769e7be16cd5de2a69b882e9c338006ceb75fa8470d99abee3b9689d35f888a07b22458c218d5596e745fb400e4bccf08116b1bbfafc24f7599659",
+    "35eaec6d188f77093bededf279f4010739f8367d0a66cb37ea7f26bcca85f29c4d58bb7dca499b073c3adcbff8e67cbf2d16b24da47b92538cd1b5a558605e7b1e3ec3e8c5e9211581e22bc2008c906643c8d489d00d591b94d8f901d670142be26a20846dcb922b1ddd3fdb41466d57d38969e450ca76d4945ebfea4b4dce6a",
+    "54ca72a1995a6a0f6cc570107240c77e5ddb66b48318d6bbbed8041c3af7050ec1b2a052b4c42cf2abde7e93e39d91aeb3037fad61dcdab7ac3954905b59377084276beb4279b74d0edc8c60025c969ed92476c2641ee5a5912cdb7d9ffeba7b8b494c98a76539acefe12dd1a6ae32308b9efdb1b9adfd763cc9704f6433a86f",
+    "28bf9746a0f92a57fec2495b592682f3d5b0dcd1a9d61a66681fa14d517205a9bd56a566f5671ff9a0641cb7cfb239c0d92d88b9fccd466cfd8c6f915391c3bbdb36f57176c366e26f4c1882571f8548e9859922775b2d3a499",
+    "d378e95ada78cff7ce9261231170e6a4e5932548461e1ec0a36a8997721e0948ec52c5bda3f114aecaa48dae05afd4c7ba90f9f2833e11d74f78a1de9564a43d89e69f1386110ddd20bf403dd8598c4349910ade4ea66831919d8d880950e37446e51b83717766b71c9e70effdff691c879775f5633143557f5755072145b46a",
+    "f7fbe78203aecaf578262794303d90d5f10b9869ab49c3544729e173a18cbbe0cd7cb9a84ce3cfb51e6b439ea73b987b62a89c61c1b226a59a0570a2fbc9568d5f7a99514c3e5e95c48c17746cc124126a6abd3de9564938eacbee42d712cfed3eacd953dad58fa5a19c763c85cb7c6887fcc794efd31f31518eaea5aa3796e5",
+    "14984d2d5990b27892b20c3d2be9cf82767cef3bc989981e1dfa7d5867e8d38eb52def0ea9f51d06f63dae796c2ca3cd2d672d0160ff1833f9e6d54bd7e0f51b18721e42ecfcb570b17918c27606643b1cb431e729381a2cc0",
+    "e6b8eac419154ab3505345257bdc168d190cf514edc408bc312d5a898dc3b453dd0a293742f3810aebac45d7fa2047816b03a001d330a1decfb1561b6e061580e64cc6cfb47db8f941a094901bc80d8b77e3ab7dcf24b05a61108a7f242b9ea494a57e8626d0286b7f460d8aebdb83628de14adad752a8cd7ec7c567aff40aa7",
+    "dbfea5650ffde17c2c9879bd22266a4fa24086a99e7382819153de808cd22fd4bd976df73af55a48b50889093f3f0fa062e6d14701ac6493fe46a5a3452cf4093b1c29a219b6fcb3450783898eb67945095b00ddc0b1a7b3f7881fe6513b26a8ca4cfa87f1ea959a2cf5fa379e58722572eb15c1babdc18d8ca6e853d8990425",
+    "14b0928b09e16ef6804cf15a34cbdf8d913e74d532a62f754dd3a134ed9a430820555eb94b3eccdbbae41360c75cfa1ff0c978f27bf000d1e6c9d58113d93fba0e5b419af6ed6222d15307400c922625616e3e1c0b6054b7a",
+    "9b11d40766ee28e2253e420036d41ce6ad74c3445a04af21be3c07e34ba4037e540cb3c746550c29ec8548b1c7857c3fb8bc3c5759105e137f0d8a5be9eb27180b52ed0c3e14692f57a625a5c1d90d821f11d7c23f218f8b88f4ddb8514c74ef443bbb1d2590225aaf22eed325024d12e32d8c6d49ad3bfd062cf3994618cafb",
+    "f14c81aba9148c92fa4032225e41ff9a12cec4d2536267c9e9f9a6b4bbb9e4fbdf88a25d5927825bd187481bb330450f8727304561ec88ae9bc2131df52d71491c83d52757f5d65b5cec98086cc2284c4f02dfa303c64cd2dbaa4b2a4c8e3d6604eb5d550d278e653b6ffc7a4cafc0bdc3c3e479b47f7f0dd9aa38da4c5b1ffd",
+    "1923be279ba747561b83b45404884bf528a28f58295abdb04860eaa4a0e8bd701c2c4be8f0ca797740fcfb2865a6ee91ea3f3a49da181f7bbd8b3bffaaf9022882dff7a4fcd7011b5b80e6d69887bf2773578ec3b788991",
+    "6fab9709ed612a31c1f13422d88c6193608120fb9fc82f7f9bbc1fc7eb42569035e90072b7668080d411c7539608c0424180c28eb730d37911349c5771f339772b0b6d816a38bc0d588f57c29355d2091f2f175eccead7fd05ebf0b46e83d0852224b97e2aaced4079ba57f955607eb6a29da7df10f4b32160ec9c90c8161048",
+    "ff4c0aaf1df623ff4e7fc8852d317b876f22ebe4747dda778da0e9bf6803f31c9340284fa4d6c90d401517568dd14b6566ec4474a62e124f3185dfd6f1aa6bdedc7e097c3128fbd4363db14c78ff5902380a527793309ef05f3cdc8b9f2656e27e125cbff3fc7ae571ed77bab374348f7a889c2e970a15102c68f706f86b2eb1",
+    "af3a3db6617ff84be1fff33a7f77939c4e80a33e2d54e4bc8490e5eccde8fb76bc0d52113cdbf085895a72b451328da9e0b4b0f99911c966f4e35fa71315515b12063b37af1a491564d692792e186ae652b61fbcb1194",
+    "b4f469f47c46dc72801389a36533d8daf0519725c5be7afc2468b3c1e724fd128b9344553212f8628c2661c9a5f367e657dc18ffd867d2021b705aea84ca621777c6273fad980d84b69f0bf38e97a8f92a1c5c4d259af04635a991bb7b5b32c5b97406d5b6d73f3f7bcdc6cbe5b479c3c31d6eeb599c63db788cf216008234a9",
+    "9c8bd657f8b802114e25f80defb1e731ee28cdbe23c623e524ebb865c47d8b97dd2b696368e4abb687cc573dc36f8545b4e46477862e898ff6e466873c93c9f5b8071cd06ccbb93e54c2ce8c2d72c44b5fda4f5beee46764baef2a95ce80c9aac6e72918e37a16f33a6636e7c43029ef23c65fe61c87892a0bfcc6e8a337ed3b",
+    "2e97ea7ae748348df7f9527a88d3f00301aee2a67fa17d217af9ae3203533153eb2be17aaaaff7293d2c02901e1d3c913a6091106786e34a41ab76326dfa66cdf793847489c0ba46762665c02fac8e5ea4b866fa064f",
+    "b09f8949ade0a121e74aff059725914aa0089dbe4281cde0fcb7336b00953d77ca2383b2f06d566c6b36a54750cc7c2fabe986d006ea49461ee6866e7354c96491226dda22df9ce7cb5bd83b7c006a54529e1022ff50b8bc627903ead71ba6b2ec7e253d05af152fbb5eb7ee97ec7800066bbe405c3864ab1598d8d2c0e44507",
+    "ea3f4ae78308619f9fb2becdbc2b288770104b31c5968e82694fa7bc85f9ccdcb94eda92649555fb3d7159d8f41be3253d019f8f929ac3a55461f973238eda3f38a0fb613a0749ded5f4107680df475d56ad931dbe927e2f8fbbd94c18ef0008da356aa5a8cb8c3a672ad795db38937626e13fc9e0b800c5a6e6aa28e04654e7",
+    "1545c476179cc9a319afeee326df808958aacc8c0403ad57f837d7ccfee185cbb3c65cd7aa21cb2f9db028551dcdd425385d0abdc5296649a11aa91377ad6c74e0828f69461302a72df5cebadf8ac1dc9d3ef7392e",
+    "5334f265feae6a2ccbf8b2617a6025026b61d3ed575fb664806de1aaca3f4aacd2ec9e102e2c4e33861b2bdec81cba546e967d6b96c3633de8bd93cc6e67c2d590981618ebfb51d8d089ca063584467ed6eb544ecad415a2c3ad043d9d752db5b999805b6a340b465423f1ecc0b47d6c99024ee72e645800b1ed08333bd1722c",
+    "d3884eeb2da7202bab1d3ba4730efcf8b748bfcb58db661f50cff3baf452f92abbd5dcd355683b91086b452ac3c88c764b7f63a81186e8c4a212005696312141ce097d2d0b5fa64420b31e0fb685b2ff78ac838fe03e7061269808cb2e8056441e7f3663e1fffab857256112ccc4b9d85520006878dc88a729398cb208ec829d",
+    "4289f8945c2887763ed7164ba4e10a8c4d079ab3816d01eb844e4f9cf3a87e599e94ac8cebef8ce3dc0f7a3ec3fa5670cd5b226f76eef9d996455917f4bb926f54c0575f5564a91f7b3265dc5480bf63ecd404b00",
+    "c05774b181f6675b2349d72054b151172f9bfe614687be3f6a64963578a65f7756965762db75520c42bf6cf67f00f5dc22719190d9933b2cef3344c0c0c72d53e6925688b5285e227c0c4d277b9e5b28d76d6e52a70d7f9f9fc0fb0325f0ec4ee58181ab229489e8fa6b2d635ef9aaeb05079967c21dfd555af3f97d5765bc4b",
+    "a4d6f7cd5caa8c6c4bc79d50112ebe1a999770717935386184670e63dd6e0af5fe2aa5aa6648b57bebb6baa00ee3bfd5ed8fdf0279c95a51e957e6db19b0bb98181028385227c33ad3c3005f1feeef122336afede1713da4f0127560cea1afe03396349a3670935b285f8e3c06601cc37b2af5667aa8ba288a7a667b1038c745",
+    "cee1996f351d4d20c8381cec943f9527a48f3c8181ba98f463963d9afaa15561bdeee6822be61a3045bc50c2ac4c0ee657eefd9010b5ea77e3bd2524bf72a56c16a497aa925a4791159962165c8c1f55acae12a",
+    "ab730d7866927af3c6f39b9f08117dabbe1822badd972eef1685e662610890336add417e5e1a37d183744e06ad847e14cf49ffd2fc2e83fa6dc226ee749974b0e9144fa5e502c1ad40fb97e22981008460a3e663e6907ec0c7eb6e047017e074e1385ca9792a85ffcd5c6db934d1e7b6e2086a5ac65bd30dd6b571617b648e6f",
+    "5aa892f1aa2b484842d1b27c155613745041de229185c3ec9505f3870b92353cd2600c99bdba825aa64aaef040b7b15fcf687c60b06088ea16bd7f5674cec656ccc2854c55404240fc34f5f02c3d9d4d350c3912b850cb0d65d3adffd38044498985053bf8ae1914bb94e43d55eac540143c01408270dd898e4ad37a505d82dd",
+    "6d457e43539b17f2c8c7af8fd775c102045a701a2c7f72cf8dc3801a7bf9e884d96945c18cda50e2f57729a34eaa46a0cbda9a27b98c60382aab075f62290fd9e125de81c41c9eac0859de593ed27f19a434cd",
+    "f92afb14131b77e8cb664bcae4388fe9c91e89bdf8df1a938f22fcf78c7180629b6e86243a7807cff5f3d7c0e59f36583df56e33c6eb0490b26f9514cdb3df0086598f02f26af5acadedfca25ddd721149327e2cbc52e884f0c6e08dde39dd261f2a49e5c6f13bc02b0c9a99af42c1e2b38c596b066e3126fc2b812aff50af5e",
+    "b984aa4680ecb9493cc95fc273acd933d755eb3c1522c51fdb42acdb64547b084dd5f2d729b8cd2fa28ca0034c42e41a7c7b2ee7d800712ab7a2dd78bf402e9fc8e5425d7a4c5a6312979ffab06c30937d548e824efcb64957d897cbafe88f5e2721d5f0a16b5ba683297a57d913218ba78f3369faa0858763d1fc612d8bfa0b",
+    "519a00a1c8423f50e2312c6ad72ea62353f00e17ad517d2360bde78e153b12a0f61fbac4e3cd573cd982818e6749acb488aabf6b9bb352299f10b5243d7185c8d95d13b34e687d8741adbf113ca5faaa4fbb",
+    "35aeb7abe27fe488d7f44f601844b1fcd80690cf23729a2fde3142d61adea4c4d4c0461ddb14929826b2386717d3ee39981105c81a3347f88dba1ad9db3107fbb25e630a930c7b9889abc5182332c1504b62f63dbb951b2d0891f51ea6cdd3af92ac3ee588e7f8fa1c74c6248a7e57a3d596a03e0215e6189badf4ff4dcb1ea4",
+    "aa2ec524e97d3e29bc137ea1bbb122cafcb91eec9352060341a5a18d675bb9a6df0a62fcd20be4883be5d88725d1325506d4b0c8c9b90c8b6122a0ca08d683df75ba6281b8148d0c6e1f36ea16922ad3911468d9993f3fbe99abc9a0a7b9cb2cf44a8e7bf125ca7fd5b05619a0a5eb31b74d829e0807d4b9be5a8d2434c9adf1",
+    "1c97567c82ba25c7142537f471c9d82c106df0a0043cc628d4ba3f604c15a97645ac8a599cc836d7f4cac9c0ccb30cd8e9a778ab72629acce6f000d8f81070bf3a42cbaf2ed29519afcd3469339ae29892f",
+    "16baccc7ca2dd29dbdfaf0e878de39906dc5bbdf44642b2548f21e8f88d65ce6b1002ac977bf6c7f1ad3aaa5c72134bfc7970983b1a0a34ddc0df6711e824e449636665243a0579bd19e91be24ed03960e567bcf67c1e6fbfe0efcb490a116b046d30906113270eeff1ce57c9ad7e484da73ee020527d6074506b0cbfc3e2161",
+    "0effea1e82ddca79413b66d741ef6aa2ac9060f822af4955e2a54a83150a1b171b1f43bf76f9d9ff2ff1e1f6c114d9426c8665dce0f1c05f4738537c5eb2b6c369db8ae571aabd0ecfce490d00c222be0691ce644a93c8cbace0175e34bd36de639e331b4e25381fbf627ba3c1b60f75900d0224fdb696aab68317653d70b253",
+    "8606dcb13f4feffdb40fe2cbfbe59c25a6c225c06f4798b8820eb267b208080b508e33c5f2015df676bf5e52ca2d99404d868da4cb2c91aef4e11304669063a1ac1d351c20752c275b0a9a74f24d28b71",
+    "ee65d10b155fd886856e22282c6442e6ec3e2e1c383376372d4385f4fa062522b1c90212da5b29f3fd3ee19a6dbf04797de8586851c26fc9665e3675b86cf4b6eb7d44623c8dfcfae6eef506a5c3f7bea29f33a3783ebb6b1f22ce167222a713f17e752c01fe63d7a0e405407d0a9cef445d4dab10977eeb747c1d22807da8ff",
+    "62619de79022f3356dc587df866c3245c539da70a3e7dd9a144c52dc7a9c7451205328d1c9e9d8f2f444e17534056a5a55437b5fac77a911c1baa7cb8fbf1effa90b5e1008f9e3fa09ff14fc60f9dfc618c48b9a4bf780c1ff433ff022ac28204253e85cb9fe022529743cdaf54d6efab582392b901253018da03b96b94436a9",
+    "557f81ed7935131f1c134127961b742b5343e96b7e2da24aec11a83441ab8be6716054bf5a95c1417fdd6267c632426556e45cfe9ac76ecf864d9d72517a626c8c9f5e713bb7a8a0d3c47177b7e1b5e8",
+    "c48a3776169c7da1e163068b6628b8ea4bb186164dff9217c5b7a4bf047babca2ce8c88800cb1a7abd372615dfdbad2d3a7105874e67fdbc063fbdd1a47bcf9885a0e0e73e3eb19948a28fa94e06e64960a92cbd7655fc56e6ff87e0847087aa25b66c89d8bfa1952fc16c1d894711c0d72697c1337c69f0cfae14da5956e70d",
+    "e933770bee9b4ebffb5c6326a2fb80cfc847f75a88749a60c0b514c55a576f5746fde66cd784e75b6504b52ef38fd6d8e6381e1805cfe3ff13aec67d737fa0793e984f660fed5b33ea44faad79eaab85b5b2abb987129269c41d42b42e7887616056e585eb19f8a2e50c75c811d893aaae58b6f1c0ad4ffd2bac988f89771a6f",
+    "6f5e6d99ec9c112a7583391fb3baa87e1ec609e47b4a43e6f2ab5809799c884fb0d4e88169d5d0d386625836fecaddd842fbf2ca28a0e15dc4e7cbf99018e7065870cb248b0a6034b8d9ce06b0f8f1",
+    "7d7bff596ea6524263c697770eaa4c7fceaf268ee07adafc2d9dab1a1c567a72f42603fdf86df682c027b8afc79afe19afe5398fec3c5ade897266811200e805c95fbb8aa12599978437e3418d2b27bc8120f4edc52aeea9a6198a579d82ed34bbe417d700eeb01fa7eaaeb8610c01df15e22c2d483d3918885086a436db27d0",
+    "1c59e2fb2afc0cc5c97e618226dff8fa53116630637be05eb2774b4409ca515050252ed9390b87ec1bf6517aff4437233365c4ca5d286b9807f4bdc7cd2e00800715f9a1fb292266ab096439fa948b598759863a8c3c860082854e2c38c98a61ba049e47c83d0edce4a11ced1aa66a2f19e205624002f7ddf53df967f3356a43",
+    "675d15cdef1bf3f50ab2f324118bc54fdfe69efa55a644872371e326d2577befb179c795a5f76b55a43440e62a4582f90dbc6aa1bc525a8fe9d0c4d85bbc71276c37d7783be02581246f431dc410b",
+    "8cb396bb7b74e954fb045fb77e6b37476a974440909aaa00358e480ebbcecdee3ebcca0f25cbfa49d5f314263ea6c6ac10728109c598d6d21aeef78ea3dbdda60e928bbe2ed32f6860d4ac1eea84f2df700f543cb3adad5ad6bb83c90be147c752dfb95a7b8929e132c63a72571121c420e7b13dc421606eb06661aba937b5a2",
+    "4062c6e627847f882241587efb7c9658f3ac2c4b96e546f78410be1f5b86443d5b2217550d2d665a69d71ef7c8b95c7c7f514da7d72f10c2464d5323a48ab9b5f622ce686bdbf3bc3ed868d4bcab0a69f6cdd06c547a45985451fb58ac76cdd98dbfcd8fef93d933f013904d8d34cdde0f9ee2628cf8b5e09b5c818f4bfbfd89",
+    "405de062967eb2b1b87f538fce49f6f3b5a4dcae1a99f5156cd63050d1044decf4de0af56d157e4dbc4f1481481240f971eb05a3e3b817e625c8075616b06c98799e97837a73f903518b69fa6c3",
+    "85262729d78b321fd1533667a30464cfa0b72ef48a119b335ed01549fd6aecd41b571b60fc079c9dc93c07f2db3f37b6d504534046e84ef2209c7912e5d3e46c5fe3d446c17031855998423ab9a47a1aa16cc58e429e9b01abfee5a08f0b7ea644a2e854f3df2e6dc71fdaffff92819df759310dbb15601c0fdce89a22941e78",
+    "c39ef3fc587a49a4e4d9881f34e4cb2b9cbd3162915671c92c7911f204317ed5c8664f91218915e13b2da93a1580dcc3fdfa377c7ce9b7fdb0e4476035281821fe3ed8981a459d266738a08faccfca2763203efd7cb6694763d18f2ec4ed626a756bc00cdac1ba066fad49aeaca1eba92bd9ddd7c0cb7f99e553fdff5c16d91d",
+    "6d6c2e76bd99751c7dec352c45a9d96a0756b84fe0cbd1846cb405d149bfef1e58cbd507eafdf65aa279c185f5d92e34d0c01d68da422e9bfbe4ca677e0858a42056e6f368274a6f61eefe284",
+    "62c7f8e237d90ba73fe6541114bab4cd59ebe5a419917a55d94e742c9d18ebabfe0b1f7192776ccad95da6867d3a52929db514f427665374e8da4f0397a88f25562f4755769f3ebaaaf8abbb6e9adba4ad5aac91200613bc5ee69514a0f13f77363660447162e86ac8c2ec33505afd2d0eab5007b529133a7cb675e903ba3d06",
+    "c889857c3c6b60ceefc16cebbe88e1e438b2a6534d243553a7a940182b1cb050dd939deadfe8e19288efce5585f1e6229c92404730556988e3bb61eb2a6d4e4e623da150cf372702d62a221d1f574c9779039e5e5ca45ffe20ac43da1d68dd5a08a4bce2487ce73a1fced90ac2dd9c6d2cb9b5609a79b67837b4b33ce4148d57",
+    "cd28b9f55228bdf8a052410a62d010a2791b514c5082d9d78751179e1f4f13dee72b4cb418eab72c4f06457168b0ef6d11769e7f0b38910e65f005c7354659c68009a3fdddbd9d20f1002590",
+    "5e4f8019fd4f06ae49fd82783d1c400a6ac0dcae59f6d145d474f849b0e183e4869fa241c897136d73c89f937a2f3b90ddb7ddb699785a4b0d92a8967794b64d5fcc462f92122d870d0f6320bb48291e13ce23059184c39ea823e91e12136ac69d00be5200b12b988669ab70179962ff1fc4f287769d9137114fe8777defd013",
+    "f30b1d4389600473f2cc29d4d4e12793ca13182f085f742d7ac24829ee1c82a427c7adbf2d19df48d7ca0b52e2ca965902924861364fa288cdb9ffb24e48e61de6708a6becc6a5ada54dccb194101e38f6516b35a0af2c80edc89f393a6eecdff99efb150d726d80181c24e23b68dd94f72ab2053da1c01f402e3b4fd5ccb78b",
+    "1718210f1742b25ac690ae40ba90c81b53ff42801127eea69102fa5b8d3daf986894d97879ca29d4e4c2e5350d409db6323330ebee8991535c7ad8a3c2b6495dd46c2839fd7d0825a93c8bb",
+    "1100ad0e320c77295a4804dcca01c518d4e67c253e0a5c25cb5ffa823388d37e6837bf8b589ebaa6ecb5f1499e865717b585fdd771d8a9fdb50b862bdd2cc0a787ada70ff4d7e82adc738f4afce3b46300ecf959d63e55b4e5846b10eb703ba280822a3e1e094282b3f8f4d438f5002700e05848116573fb43d289d87663f224",
+    "71ceb2113bb0fff2a020ea793a08ec2544805dd50664eaca67abe395ca5cf29d9bd2dab4fccfa11b4d52f1bd73875d5e2bdba760e94e620a9418e5582fcdf8e1afa5d0b233db03349c1f232b2f6cd07dd1a12295d1d32464e4451c262ee23298d104f29a3e548a814f6296d5b72934b13d37a57772c8b80392f3a0dd90b8ba45",
+    "1a24b8e8acd225dc4e293ae97357f7dce70b81da36271d45f531cfd685d52deb9f112cab435a8a2730e62f259f1ca74b0c0a25076da6efc3390e1cd1fc50180af20129abc0c93fec0914db",
+    "47f8ac8062033b45b4ccfb94a17430d309f140b13aebc57a8eb009df6e34a27ae46460baaccd768b21f4205fa6ed0ed3d818ec7d2c470a6599b189a15956c75c7e931e09c3d2dc3bd648544d59304e621a98e77278571c39198c70b1d99b14bd96b7921740a071d178f4f48fdf53e69c09d14254a64019f1d90443561e1f92c6",
+    "f1b94e62686b9b9dca731e512e68ca9eb8c615e095f76cda1e1fce58bae30490e581fc423aedbd2eb8d17df67f0259683c01001653b595fa04b11ebb1245df8b509699499dfeb6a270a87ad1ee53c4856323c6086247c4e4e54773599b61f7e7ef09db67296c71aa25f80c873c7ff0cfa585bdb8ac7d2b3726feb3d6bc26c15b",
+    "2aa85fd65b28553bb73a791fdcfe4879e7448d86c2c08f50d394c9e764df8e3aaa1c882df0160dfdd9524a2a5e9614ada525f58c5c9f7130491d8f051d28a74050dcb05fd4e1ac4c3c94",
+    "7dc755db323ce6788e6a81b59f607540664092d3ee16c3365b7123009c9c3ca42fb4faa1a0dcee90fea5f2a6c4f018f329be840b6e1a33a07ca90a64b8f5ecbcf6d544f6acbaa969fc62cd1ec945a376a6ed50a651de1c3a23aba29a27c90f2b9a94012f1cca2efd98fd297c55c0071df016c2ee71866851f7afea65f014aa14",
+    "869982d65989b0e9eb52e5c340ef85bde6274d9e7fcb32a957fcfead0b87887d875acb717de7b2485a0114f614dc5307825d1ba18b49550ad14f8f4c3abb1d8a0267cc9bbffe0961ac60ccd4428e32f95f2b98ecfbb848d2953a6e652e0c261541a64c94d4806c841687cfa397faf583248a882db744d4f1b92ac5d6c1d06edf",
+    "53809aaf8aa29f5e15d61606ceb554387e22a47fb1353cd53275a65876599c860b51268407c2c588c9e1c731c1854c69b91f3d5a173b15c20e9e1a1db082a20c9738b56819c62d1c3b",
+    "bf40083d2ff00936317989a9aff5986d054ca827a5d4ca9dc53cf81477d00ae9b762f47ae45f8ab542c444346d0f6b0fe109c63074dabcb331ee35dc99162b6a3c1520a7227650a7e001413d04358f92c34b7059cefe4d7f52b3545563fa2d33070dbab8601bd9070b8bafbc96147c17ef88bd390918aa355dbee4541df1ab0b",
+    "bc650fc5475ce359fcb9fc7ca7b20f2931d6e91e4da824a1e8d3ca1f02d5387c1d304eb2305bc326c913082e3b81ad5728e4895af8dbc4795f8591cdcb2a90adad0e2dc9b28696c457427140c7395acc6ee03396093078a6dd59c3440b48e7c07e9d835bbaf5f6c58ce66461a80662ab0a3299b5eee3f31ffaf9872a96ef3ddd",
+    "5f341796346183329754c005fdf407c0b60eaf825157dc80b6e43330092d82157173f599509b0f6de0bbd9df9fe3cfe0814e777abd8a141ded4274e48a360d2b3617055347b7417d",
+    "067b4a76264493c2c57c3989f4577993905d76a45b7c83463cd6800b3f2525d62e097de0d4196bb880f37440bb8ed6e23f388d61d393529d751ddb8c925d2a5e3a7a067a5b4a99584ca7fd3bbdb29d8b75781a7307d154c65271f5cededf137c44eb5073a6d21ca5d33d3f67ff7a6fed875e1d73df3653d6e5151de36b61a177",
+    "01086fc23a69055163f8a8b688b200ec708cef1ca61265bfb867bded64a7735f4da873795641282c36b93d89948f3922d1ebdc6d761a17db7d4e21e33445c5b055f469185e0ed93aeb67a7c3232ee71be0c15da5553cc751ed75260d3e6624bc01ea930e8f075d1b2adc3f8cebeba04591b25d125f7d718b7a5976faa507ab2d",
+    "762cf73fbc06b01eec6a4e8731359f2a336f8b8c59cf0cf8fa3f982269f2c3d7b6f0faa4fa78d144a315c2f95b3d9b60c53717309168b4da5d03a926b011497a4d8c53c3e357966",
+    "d324c986ed8f4808760cf658b9073a4df6447dafa3595a230fc29bd81c58b5ef255153712684f836697b018d714c264ae0082492a14b8d23bcd356afcb56aba4754944c9d9621e57694ffd21c3a13dbfc400df8e6dfc40314131966acbda14dac9b41ec4af46a6746c8dcb27e3fdad2a635505c7a87ebbba852a4cdc94597bb2",
+    "62359f9c656c791bc92334162d610265a53ca40d7e119ca18cfb7a104273eacdf0ff0bb2bddfc26270c21f6adb8fd4fd91c92d7ab79ccf094ca6c2deabf6b63a09185f256d66dd66270eb4621de80161a8e39d440cb809ccd6d739b2887a426c0d0b922e5c1563d3deaade4c7fe074615a6525f17d006af877d89532c7f1cf7f",
+    "2b1281afff33f139263a1a1461754a62fb8763557fde891bd9068e2219f776c8ec22b25f94560786a7608d5beb0f5dde7caceafd29ef2b4ab629bb75bd377f2b188142c78723b9",
+    "8a5c7efb0e1e5bd00345b61db7cfa0e7c7510a0afb96519a0837aa2b4c3dd922f0f2f7d7c67e741775fd83fc8a0d353a53614fc0d765a0d9be89f0e5d0ef6992706895e1ea4f852f5f85a91682d8383c0d8e4f905c2b7cb6db7a3672b3e14b8d92e8948c91f38d0b5160af0699b53c06af3b1f120b243e6a4e609abb24f3119a",
+    "91ee83242e6607fda13a3325ac4b9e3bd33ae8b4354e3c88219b1a849f40bf328647b3ab3ed56533e30b5ecde2f0618ea986ec07213f637b9f52c39dfde96c26a42755dbc2ae70edad09929e0122e1a88ea82ed74f8553ba4073461ed2329a999a7e32cb6ab6bace291421768c5fe5e988f086a7328d62c017310628e0771ce3",
+    "1593eaa26c3ecb4be5cbdbf6d0d6ba490b041e10009cc8a86ac4be8e9399cd58080caced25b3d22bf64d39d9fe4dca79c283d1a904e4f3571d6fe0f7f4364beaaa77a6bd5da1b",
+    "200dd4bda7b1ca4c39b71aedf407f004cffd488dd60319a6b2ec74a35132dbdbc880a2bf16514443b8206e97b2a758550821a9b596cb72390084665349541016c0bdfbcfb92628115b5c3b02e4563f825fb13ff608f6010c72c8916932a7411503f3bf10429ba7ae22bb04df3aa00569c701cafcddec4949f77986857a139d76",
+    "df49e10e7e7df2244e858ab1cbed5d36d55f722026e78cc093d6ed6fec3b8648e12818e2a0c18535f998fb5b4a70dd618476d940b3cc27bfa90dc3d94bf9e6d1fca3cf2d982825dd4ac24cfc7ddd5ad02c0c077ecfb07c34b3879b6e363d6bf041e819d34320ea73a36918d14007d22e2cccf5f75ea572544817d91beb2a6385",
+    "3d5cbe453e8a5073a5c582eb6ce1de8d02fdfcb76e9d11bc6bcbdbd8c3805ba0c8a5feb5e81c28963a1f994d8f371b988a9084ce15984a4f4c7c08bae85ff219dc56736c910",
+    "84b921f4f6cd5290662fc28d4939846e95ebb44865ff1ebeabfd2f516b65c45947ec686b73ebbd10bd5aa0256243051675eb0b5ad43684dce9a39d2b4e9a7e1cba26102cf51ba47e20f70427e036c52c66134b6eac295a273175f6f4a21e2d47d6707e2003f25dbe18fd4fe5f9c2b5efef8d577b5312467dba55f5a5d5e5f5e7",
+    "d0aa0b91b511fd789e455c714737f050084aa98dd86e55e8370d62bc5b74da5711a95effb90a00a804143a108edb606bced0420a91baec9441eba5359cd427d4f9d40b7f23a79784bd35a5e1c7f96cf1b98d77b325463a4627c1a06bd9c5e78c76d8536332fac4fdd895b38b080ccd7b02b1012cb67f7503f6fe77b9c7e60ab5",
+    "51ed4360da5f3e8af6fd1fec4fdd083f73c81c083dc5ac01a887bba11545f3f6bc000d8c9da68f770db0e3b010746f04d1ca0339ad6a7de30d159c7b038bf9e162872f959",
+    "22ac28b13fef8465722a8b879fac7be70457367cff90a27f150460e6b9b8b6e5361f9d0e3a60fd411ad5e4eb0ac4f4fa3598c168184a229c6b5a48107e67057810331821b0a0a7f4f417f104d268c11b85ae40a6a3d1280fea48cb6223f15fb98569c24679d40405ed439f5503f8683e6d3cbb7e8b5c0532c8f98efc2769e9d7",
+    "753e836e2a8a556f48da137555a374fbeb528e2554fb0d8fb961df884ade336043ffa55006bc2c809ecdbe44fafcf37e59eb6c76007415703caaffbe9588cce9c4709d90217d01ce0cd0f9b777b50a03139f3b980ec5777604629f21da3284bb2da6fe49cf2c699c6a7fa9e5f7e5ce617f026e6512657dc84288e5ea651aad89",
+    "1712393b9cfc61a40a457aa1f1a09bbaae4ad0c25b02f3e6968059bdb3e5d9d6b148cd9f99af3b2d5fc17accc2789d21244684bfa21d863ba943adc92b9d0a0cb3275d91",
+    "24918f9a6a4c4f9129eff8bd293a6c9365b532b0fcf3681ec5862637de603bf7e90ed5dd324ba9489483230767a7a943380c168e0dd404aac1cb6319f32842b020a47f4aff876308e54e333142af7889590424ede4b850ef8fbca6c71c12613b5801708188b829ef9f052cf05fd6c1800c76fa1caa21a2101b7fa8eb7b21095c",
+    "bd9fa69d085a3bca031740ef6221a5920aae8896edb773fd21bb012a7eafbf5e6229c1803726ea3165d62449c852c74b70ba59dc60318a2d62ad01c45ebbf3703b67767186e7e8c9574e62541fd620b793fa6c5470f5373d37b604d83a3bc3eb73fec943209617aa26ab10750f41fdbe825df3228a612204891ea182abbbc9bd",
+    "384c624003f8055a8a72941242e4ae4c285210b46e574be9d52343e5d0c293b3943297974bc23b08e3f8a4abe29414df41d2d150c403c8a4805f4d75511b7d92747fff",
+    "cda0ceb65d1c2ed92d682b012c16a8f46b33bcfb97605a46beb9d70a6d97f07a3a690242272aaf7dff25c8acc8c51367b7e6ca834382adc6ea287f75ce0dfbe0a3f79e2aafd8266dc0980055c04cb0e2199b4daf40a22ebc2e7fb594c45e3fabb6cd7bd191886f9f54b33d77edb838787b8bc5884c51650e688ecfd27e7f26e7",
+    "5643a3bfa944589321ebacb4e9076da1135f14398d40263a9087944f1a1d8f77c74cfe20bd6955e69d0d704077981e7ed158d5e1d770b161c2da69ec4845d9f8fdd38af1e8b365ad7af5de64255715c241ddf2311553cda899d272da4fb88e0d329770f5d245599e7f46ad217b221a1a88e645321235611875b29d2e2cd5062b",
+    "465f1c8ebbcb336366d6da0ef05b007d407a16d14304b2e202595468d445e6d2d3145e393b4d4461c48e32a64b1384ace23caf293058fabd43b2171e3f7ee0d966671",
+    "e79b0d252836f7701265edf2f5fa9b2058f71f1fcf5256e6d6a994190bb274702b860e632e66e413923767a9d21aa72c64aa2dd91a9778233427a3628c600ece4088c97c822e56f7155ab7e10058af560149ba9f47fb23ded1183c64faaddc9e118398254b70e0b33344d07ae98fe5aa22e318555fc7c67e5d4c12d52dabd911",
+    "ba9cc06a80838ead8aca1c2d7c28c7094e524018b5b93332357ca999b3951add9fa51e7b1af0c974d3d8773c32e52ed735816aba5b02a2491950dd7400da51568cce9972b2a7594de1fcaa5e50c8a5becd8486db4fced62b11a1df52f65cc444bf39a219e7c939edb13da143fd1bb5a3689fea56bf32d5d2edef84de50525091",
+    "7ddcf0232e0dc0270548634368bf9b8019442e3856a1196c0875c4b95aa8cbf8e13dd07d4395c908f147711db4bf8046fb4f39d2b5111c9567f113ca91bdbae6c6d",
+    "c1f7c3df43c519348a1e90f6ff274b71c354e6746979a4f1f2e18a0d41a63261edcb2fd1fc582e2a8b3d098521a8ec844fcfe44188a228396742522857c48002973de3c7398bcf1a31fc47c9bd2257fdeeebd0dd375b698d1b5fbdd09f11e5c6ea7eb3f352e87f5615876515f2667afe0e4b0e2588b0dbd269b15cecdc7d0fbd",
+    "13a1fb659de65164c6f9a75cdf9543c14a379598baed39da403af5a6964b124e1172bd4cd79ded9a3550f309be05f7cf1242951a1c440dc75feeb7dddc9e3c12d481f1b57d828459b323dc1683e340fa7e0daea69243766e0e30b9124c4e192db9a1915e1c99bf028daf43712cf6d44e8a01fa35ddffd1bf0191edb4369ca4bb",
+    "2634cc15247cb4550ba75f6c8d1d6f2d4cc8962e72ba9af1110e5fb63dc917fee2a7f0ab56a13d9abf90c71c4b0d81cb6e9c712d0d72fd59ff0627d1fe3fecc406",
+    "2e643b4e03a79b1161eb67b4249124b673b91bbbf746be0c566f434028197b928e44ec82decea7c80c846994df7953bc1d35fcb41c96a43713e163308f9ba4027254adb2f030aafaa17ce2ba21679c2b311a282d733bb724012bf655b0518a11eebaa6bc18f149b2a1ae339eb90416dfc28f566e83b69b8a43d7995d35fa1fa6",
+    "8729a4a41ab2e08dcc33bd85680c5d34ff9ff2f281c20ac7b1c69d81b2b18d89860f06d827c5869624d7a15ecf3a71ab5e1579dd2d5d0339d82e27730d342cf5a78f438addfe71627d0cc6fda545f365c0415624244fb1c341590f547115a75d78893ae85c7c1ea3866033545e06ea6623d4508d78fb35b7d2dc9873e9186311",
+    "51c4dc006267f3afe174b9af4a367222305f8367509813c6716c3c307ce58a814b944d9b93487ed797d78df77094e8d9a1d0ff25ce0e3c23b3de8f6eddcd980",
+    "b827b68f47c9de0233b640a2d10d6d223399b9742915620262afaa234ec11f99ed8202d2a3fc310188e555d8f0025e3270ad031924aa12d508961c9911f6c5339e6f740f34a312fff2b0331c5b692f9fc36a5d99deeb7084a118500bec9710203f555d45c933b937ea5ca0ce9129282f8fedbf2ccb0032d306607924c2477618",
+    "dbed9eca31d7d000a5848c5ddf19a8096a4e678d08e3ff847b456e9cc02906068d7be0d594fea4cf5f55a6529893494ec8477b4846609b4757fa60ac0ba6906f251d6352b8d39908ee32b0139aa17e17c4a1c325c19ddb40c04fafb86adaf7220d68214ca8348c77b3f22955c5edde4afa4fbab8434ea408f47261986aeadeeb",
+    "19e42189f9c9d2ba9a9129ce414e3f7c242d545f927d12bbf658cadcdb22efad5ff41072b5900eed7d5d0df9db01b219af0b258f739a8229a64ab7a9b224e7d",
+    "d28cfa697ca0668330b13e9d01205e3290fb15625a73e886bcd27bcf1afc448b2377cd53995001530ac60ab9548a531fc8bcdc0803182d08e7e5e7dcbd168cf2625b920f6a497e161ad2036892512169c76858c4c6f89f6f8744d1a790fddac0fc815e61de0905e6c290c26b53ca563d11648bc8ee7fcb396894eeeda86aa1b8",
+    "defa271bbc6337de039bb5034a0ec18692d099f208fe4d2a76802958f7b74bca25d595f6e61b020c0890d1c71184565c1b58aaa6bf09810c0583fd411c64423a217d3c1b892f13728fafc9d9656bc35bde1a766d51e0bcda30c97fde95c1c3efbd959b18c2fbcb44bc874aaf3532ebb2d314322a9d51b94689c572b983ad9901",
+    "b847830e00fef95feb63b6689d79764ebf35e5ae4c1aa2b5eccee2253772103ed2fde5ed7ebbf090014995242624e45591fb17baeab9c1e3262d0a06f0cc5",
+    "e25f7a839bb8e423a2bf7eefdb1329a75ea1dc872b8bcc8b67ecfd53cad0744db442007c1b2b38a25486816a5699b5e950bb60de064d95951c8d26aa74645c7600fdf5c400e8359fe7371eb5b2a5e2e6968e835cd1a2eb63b2bf2ea3294b9b9609cd0846dcc8420cec23984ca9c9740d3e371ae652d17013ce34ef42a952dd10",
+    "905eb8da4b05e7f381e3af665a68cd338b03798d99497ad8697acc6507929235eeb85fa056457a2748265bf2a328ad106da4826329f735aacba7ed6fda8310fdbd46f1fd44ae2e54e4fe51a70c8f59f805c358de17aad73e7c3f64a72906ccc35c6622100e717a79ff24729089aaa2765292d5408e23e5172321991a18a482f1",
+    "65ae472fa17c4c2efb4b803c052ac008d4c7b64905143497296cdd15439070e7b0a5c14b17bbe84a562fa192d0cbf2404696ff3ad405fdf715136ea9575",
+    "dfe5935882c4d7499fa6c2dace2085d625cd73de38c87bff98f3035f5531d7bbbe6840de92f9d2dc56314aab2a5f2264973bb20488681ad2d5a52806c8c1e61f649c85786366bd65eecb0be9ca2c24120927966bc452bb2fdbecc9f9298438f80180f149711191bd9ab3cafe97a3bc26ba7d0654eb4e3d5ba7234d92a2834d09",
+    "45288023ea70280ca996ac8275362b7615241bfb2aa8b2251e520ae85de9f1a4a3250770c7c73877707344860f893980f0835a920e40c484bc763c15d0c304549899b7b75ba7c73ae711ba9872aeae3c56aff550a2776e7f16e9b475392f241b4835427bd285d3cf94bb68ff046f9fb32536a04b29b9c924f39a0890270cfa49",
+    "a29bbef4ae78a68fe735a48dc125df6367ae9bc3c27be72fdcdc8ccf384c1f3d3303511286817382e348f131c9a38d350bcffa4f37d429205c4b1af86d",
+    "58c88652d49063c1ae5a33acd087ca6438ae9066d50802d3206c8c33b2a5de302d6db208d2e8d409c7031e2a45b755971aa007182f84bcd04f1049d59ccb50dff355fba726c84001808cf2c4be8de0af450832a1a010daf451b5f07785d99cfbd454245f2b94cbc6f4e9fe99cd768509ec196876981dc5fa25b4b9454d3c841c",
+    "4c17ff2900bc8d23692c52fee8b338a0729534a952e5531e0d13be10968d9d52542b1ed362defa5f260290dc78da1261b1e2b1804c22b434819d0fbd3b890e796b300e65b3ce6e49f5163f1ddf7d6732742447f8fa35b9be221c58558a4f6d9e4e889fadb62f90c8b73ffc5dd6ba265449d6109e4e95bf92af60142783177d2b",
+    "a2184e30752496d0b90edb3e0c1986548c20377faa83354654ed0d7cdb35e58d514574ebdfbd957286396afd8dd3c28b473def00cadbeebb1f8e56ee",
+    "e59be72fb1166acd2c5f774c872701285ed41fee81171dace36059d21e3ed9dd3b931cba7545a94dfecb43b1dad107c7851e68a57b7a81f4c24ba0128c9a269d4cb8df58b51c30c1ad9692c8d65f720a59184987abbf94055df5a5ef2b441c216858c9cb94fe561b9bbefe031425e52c047e1ccea738f7ccb7e5c202b8da0c82",
+    "acd54b45c5631df782d18ddadfdb55b506b91e77d1a2ff6a76f3a9acf8f4b0411bb24d8b58993fe96944c0eeadfa174ac47c5b96800b1041d58fdf47cf098cb547f20e99da495158b9c21291cd8b15d032d749258f4eb495b5d5a6359946f53cf9b9ec29b2e32ec35ccbb5a4bc9c793e3b6b123a930333203393a6945d497f49",
+    "6655f698cf883518d4c5b0d1ee43e8de031545a134d092bc94e7ca260a60d808fa85de896546fa483cb223d8378fd84087baface117b48e7860978",
+    "830d2957926960fc659e996996126dd601cb57a25dc3ba26a22788423c3ffb8c4b8f31e4bf8fe4a23952522b466489ce70b9ebef3ec5465fd9fc5ad5bed42c4c5325d115ff2a9443b0ff57958390d48676cee68c8af30ab20d0d9a4307d608369c8d44d580005483bf1c89636ba29f8f01cb879f07b4695a663bcfa90c7c6aec",
+    "18695920e10f22ac05835146204cdf59845b674f729ac8b4dc16bd99b7e24a0bf2b580858c55a2519b6acba1f5724335c3839720c43cecc04f054c44cbcb572f0681ba27dd46b8a8d3b6567ee4751789b2b842fbac3da57e9d6aab503b5bfa2e6af0aeb5cce610362363dad7cb4563ad5d44f3474b78de52972948ec9f922175",
+    "b4fbd3e1c7292b07e0f8623ee8e54c76b760e65db823d3839d50211e8553f90dd81a0c880f0120e4f02dfd393ba8d1ac44f402663cb6e1beb91c7",
+    "7bf8d95a1316fe36cbac62b9aa0912205a04368facc936cf8ffc4433986327a4c2fdec77c9c4b2abc0428a11449399ac4e25cdbcd5c3b9d6f7b777e2b20c922bb0937329e094fe1fffa212e09c2ada9b5f8edc279df97ca8e09c35cc3047a2376a33cfbd511254e41ea983071a092aa615ca9d955e12ef2bca2cc169e620f62d",
+    "cf4204476f1e29a83cd0c16d05f1bb52e1012c7ceb7fc750f33a8825aac7ea624fb3e1ec6f4e5fe22492639fe15567c73ef77afe3471e6c1765240b20fb5bbda64f100b5a39199767b7fd4adf37494931ed928d3271e73b0034ce69edd98f6ae549615241b13f4ff223fe4d9b791bd6c17639add1f0c0d3d81948e7a7e5d22db",
+    "8416ea57ef8bb5ffcab4d7c58423513ced52b0f5eb3e2e4587584913d1a8b83ad2dc182f9e62591d8adbd07852ac41b2b0f87fb66c09a49650a3",
+    "43c7c38546424f293537d19e32250e0f108deecc2a06148ce328dd268913b14a1e0fd449e6043673c0260ede895e7fbc56de2b0d2cb228f84ca92d7018a85418a47bd0d28eb7ead2cd07ea57304a182fc7b2e19bb7b743d6b9a812345ed4f55471e70dc08f80f39028eaec783cf1f851849e9ab6dd7dd12c56e5e263a4a178c6",
+    "ce6c421e2b710e41c4e35d43f0bca00157742e3b6e974bb8e520bfa8925c3f04fb20d0ac30ae5fc9351cc52aa0ac4305e954f98409100e80777bc5f7ab4210e24e4ee9a92b1ca2f3d83019cd6baee48c4cb46fedaf03b298480fed870b89cc7c1273fd70ddd0a6980f0e19923ce7613db369e273020999c165a63233c7dac3a7",
+    "20b2e943ba0ac0d8100931d06be913fdfc4f64288483db26a26a454727ff69ae186d2d8060e977375154767f6cb107a5a9afcf8ae958cd0000f",
+    "9dae9591c2a4e8960f748a7e1f1ce554885f6dc09100b7ed479ded21da67279657d5bfb0a3621e344dd0fdd213fa708d8b6910fd06e5db1b37a027501ce5a6bf61307274f7048fb79b5abda2ec5985ab10b16f6e8d8f17672478a0d87af4a497457674c82763e78de74204617bdbf51047e75be4547ca94cf427aa8c6a0ffa99",
+    "ce74706b0c391d298e7254073adddedc33d028dcadef039e60c08a501b1108f9ab9737de9a099661b71f9cc0dc4a57e6204bf4a1d5ed696b90f5b20d354d621c675213d2d0467fc7b8ab8758e090b8e5add33870937b88c02f4e8c477c727a734418754b23600b13848fba999683424df4eeb55ecbc1e9a338a5a88160dc7919",
+    "5d26311596dde465d444c022dac67f6f5866593ba3fe087b4b9e6cb66f3ae7f06e5ece16f37a56c284cdfb1f44e07364460d12ed88a964674",
+    "7acf0d4bd77be35049d40eeeadc46e6ce40881aacb552f2e76d344bf2e57f5fb36c2af926da8e97e3e959c6bea9af5f0bd7327cfabfe177e614e1421cbbe8467e1490788a1318e8e4a64f1105568ada27db0a9308e167b87001fdb086663732592405cfc28b53bcf75d8949adbf27cb4b3092a8c13d4412b5edf2d378c8f543b",
+    "f6668e27339ab61334f0c12813defc5f60fa21cc4bbe1c4b918b6bf8df492f4ffe5c80e920306a282c0162d2e7478bf8722d90518a04d5ad09eb8e8c4ec8ba19216938b6bc3555ab45f611a89d198c9a3ae6adc24acc3ef7d0590f2ece58b3775c7e424449ebadcfc0ef693679111bfd11582990b172781dafbc8403507e78af",
+    "4665b958f35b16749a5879553effa2a1d773234fd68095654bc25e0aa90b1dcfd2ae5be881b97c11e995167f4f48b97233114705da6de7d",
+    "024fa239d7b32f3d23f2074ce79a7783f2164e7aa49243bbe04889ba548922bac9dbb9fae6d3d6e8f29315160a1777379ff6886c566406d93f9ca78d3c57f7083f9be8f9f31e72e0e2490f178d2409d8b2811b85a36241afb87f834a17ccbf8962db54e6cfb443c94cdcb856583bfd52400aa34ee7ddd551eebc7b1187795ae6",
+    "345e45582e09d9f5772f4cc924dc9dd18f97703ae396f7eaf5dedb572890957182f7b9396e8040f7afbd47986dacd280357f6e808528962c9bba256663878b3dad0855706800ac49752a49162ab098e1a03c4a5e83ca236f07e03845a69a3cc84d13a3f1518b8dd598f72e753ab1303b44cd386093a3bf37df8fc80af8876a55",
+    "2f28f9e5d282deac64ff90cd29e58300af04e0353aefe5898557c7e204452b580c25da24f70b9520e9d17ab0b8434d66b202d8842967a",
+    "b2457d829304cf6fa0589c323d09425a187c0b37690779ae91778d49ca112b23bbb1e0ed51fe06ed1dba9258c5958435b6f96d0bb918c084c68c59f493a74edd5a375921a567b48b53fef5fe30101e90102c91fc891a664716137fd224d3ce0f97dcca7b6d6af064ec796c10fb39e58566e20332e26749ff407cb47a2c2a009c",
+    "d768b3de2328a457777e1f306adba729509e33447809088abcea216be608552fb7b7808f2be807ccb2b33c1ac7a89c7ffda39e3a24c1032171ccedcdc4d3526b1581f025490bd45cf910878ecd640abfdbc36ecc62911d80d847a3447aea090fb7ba3b6fafcba65111ea7e04aa918841f9d438f9097ddc6b7b53e3a9427b37b3",
+    "84f068a6deae75979fb39eafd88261944c80cddc021aa0ae57019f2b91aec46632fba94bd36c2ce5ea78348e69209c2aeb006d9b8a8a",
+    "24d770cc9e36d7c12e90c2a48fbb3ed55abf9c0b587798f17b4a43714d477315386b83a27f97e387503972b98143089bcb78f068db072406b1980e88c8a4a441575ae7bdc4b127b1fee4577ef3db8f7f74e1b8c4e7ffb870e1c921c59b02dd7fec63ba68cfe793f8690ce98a7a43645cceed911e2495ee5cd8f4c23eda77fd26",
+    "0290bb869279f2ca45c4e6cbb9c64035b9aa397b778154d5f90fa92547585a03cbff51188b5d77ffa11b1e9a56348b7a616fb620f9c6b33305838af373319c940fd64dff38f37d42bacfa98d371ed780414808969de50cdf551c46f1316aa65aff52d9ddfdb2e3e1a3a2f711d033493db18bc5d9a2b197ad210f61d1912aad57",
+    "53efe17cd1d28632a26fd54d0a597022547c45e638ecc7f522b038abb795cb119433e1d52d208e6219f2f5a931885d5c30cb1773f7b",
+    "cdea70056b62e9652cad5fc2a9d8f6e935a034a753e50fef6666ac0af2e50a402d2077a5b953287f2598b0e87e1fa663f8dcef7206d6c02d251de56d3c3077a951189a60e55ea25499e8b379bedc9b15cab4fafc7ecfa554a017aae28daa76377af7531f12f09448c478b17968681afe3ac04b4ad5ba288af5b0e6f9093ada02",
+    "d1e96cf93d8673595cbf0038494ea7f5b1ae770ebbfbee28d75e461734ae0a3ebff96e4e013117f44d19e9929cc44576aa91a5194c0956311f2435af2af90a4542837cd4a5716fe2d5c80cfb26f0f278b417784ed038f368559b62b402445ef3d9b86eca5f7fb616c816952b2b79af27f3538d42c1ca9e67cdd6d81a170f6ecb",
+    "9680a2f1d4db5c6d237db5f77dd90c2512a37ddaca042a303a0163f59c0c8328bc0a0c717d93875d513597f85b76c47cc602f5ddc",
+    "1b2696ed75f998869085f56b0d36ab2fca6a07fee618e02a1b3eb19347115b804f234259ab73f4755a2e4c8fb1928e7b4765a54e2e8bafa115d9a4dd9655f1d1c134a406e0ff5537159793e0d1e0f3927e385e782b077fdef4e1042a1a33f47d11aad458a7fd7049af670e22f672e0965a7a5d9e76030bd7d50729462c159ac1",
+    "b0f632304ef22073cfb4fccd5349fa1fb6ead09c424fdead88db76fb43d160229ade7dc85aeb7bf91dd88effcaa558d3503a73c1b29ae5de205ccacd10c863bfa46464942234813c85fcbf5ed362b235b05f41ae3637be3464a13f6f6f62cbcd62d06125db3c7fbaa8ae190647258d38cfd07afb885fc445a717e1694a4b1f0f",
+    "2f41512c399d50491bdb5c1b403e44bda4c1fd8ed371289fc4c96b391d2f43cb6c7c6408be93e301d387b7ec8ba0ec977938221b",
+    "acd9835eba357328b83bc7beb78330039bf2d68aa8bd67229a4573bf5be5cf90380a0e7a73a43d1858301224c7b2405bea3c935500ab6f48ecfc68c59ca037262063a79d30927cd1d26724e5808b942a437bc0371dccacb38797d577fd9afe0c23352a6e6dbaf8d260a76b4f483ab5a79aeee518fc7999eae1e2be459b41633e",
+    "fb6186ecc905db741a7cf6c712255a2eaec9de9116d3b094aed3ed58157b8be54fa364ba7d991324889ab97e5b39a33eba3688fa68a2d30bb81d6718256d6bb5cd4ed74199f6be5af56070e4045aa0b9557c941dbbffe1bc50b92849e7dded5e3f7ee0d3cef52760cfa66f8aca541dc0efca64eb187e33594435c8ca5975f833",
+    "163e74dbdbc2f2eaa24ac90b1384457a032166bf641482d7f8c5e38f2f0a032bfc6b858c2b30e2e057444f024605a61d0a3648",
+    "e94f4d0464e89c85abe5d564fde9cb0795fd648dae24a067250543918e88c2168ff085b956e135116dabadc551687369f9753947f6d236a7a4f66ec159c62a9ab24c9ef892646d25b236dec65c4172518ffac89bbceeb1b19832a54a9d91d1e654e10ef30758fb81998bdc70807aefed33487035b75dc7421bf677da86eaecfb",
+    "aa125afadeea867540386da8dd89ed9235ec967c9833f799bb5bfb9c565ddc51422d58d14673dcdb014de7b60389a0a95b1494d38f9c3122df94ad41d5b04b3b3c8afc1ed922474ea172466f96ffabf67f353f997e0997f0182cc11147d6db2176e59b4dde46f928781a54b2d2ea823a02f9b2a51115bad6d5c1689ee30ade5d",
+    "159b545e73339e7e488da6232510521df3838cf8380056d07cab3e41895bf45671f6183a66902c991e3e445df4f601da523c",
+    "2f60be853167b7b59072c9ae2767c64c42763ea9f5235ac30dd982535571ebca3785fe820afe1829047af9942212a006aef0e8d262f3f1d494c38b343f004779b5853db9160c263b0dbca315e62b5a45179f89787f0549caa3a9cdedb5b2059872296eeb2debe9c4370cc8ab4f9cda9960d69c48b974728fbb2e8dd3ba7adaa3",
+    "543ac8eff346fd91f9715647315f1a2b1b272311642a22aa4e28acfc58c05011d032fbda5ac88aab9fd2f9bf2682456403270cd0151dccb341a0329c2623a75f5722368ffae2a31983ec82aadfeb80131c3618bc1b2b8dcea7b9f9da863922d20e79017171ea8d840e80e81e18c391479b1943bbb71d87d448da47853a0a123d",
+    "a99fb1dc0c21b10ae3f043b0a0fb21ddd2c503d6b0b7e538a5d97b3158e03cd0116edfce4dcb1f3da8b4f746dbb12b2dbad",
+    "b327ba368c10183155412720c74ec2b55028806eb10ae3bbf8022bd9824f821e9f481e4079dda53de09f84f42591c2b2bc78bddcf31c29afdf8836b960094923c9416e53ac818fcc14a014a05f02e78e0c43bf25ed5bd740fa243df6bd59253dcc011bfe2af666a1a57ae577ba0b11086ebded84e83ebceff2b44b6b787340ef",
+    "a969f7492c8e965680ce8a12ef9309098fed568af5d20c425371415df1c2310e16c4ed0141a0d180c4acf8bf86783ff3309058512ab55e246b640653562536dc4cd98518752e3150686241aae25b911793de95a8fe0c8dce3b6b8f8bad1be3f1f2494b3ca693051fa4caa475d437434cba57408ffbab499c37a74acaa6764f61",
+    "2facaa8211d0b4b0e87314e4947608ae973a08e591f1071d314385b2bb898b6250d50c82feed5914155a76b415d5cebfca",
+    "d6b9191160dd6fad86753b39c1ae4c0a02a915e1e9b9266fee5cb91fcadd6799b586977fc09ffe5d249982b7169ebf27be9656293b229a627715c68ce13f9a0535ab3c78969e8c01d91ba7016000884d963471ddc0d8f61bc3a557a6057c55718a033475f711d1b16ff1511b3bf29fafe57714a31305634037957490434a82ad",
+    "b0f3b83f4642b876b31093fffb3b08613561c6ed61bba7644b4de4b407f1b87b9d03c241dc60d9f07e6d17ab2684fc93ee2894ba507711b397c8f7884fb43d94105011b57920869596762fc52e96548ad88ace98eddc77e21f0204671b97176a01055a747298e7cf3907fae164f66148e9edb9397ddf998421ddb732876fb78f",
+    "9b7744dbe2e7e5ce43f366aef34196c003a45348eb9ed434817edbdd838acc468aa5d126cfb965755162708ab872a1c",
+    "1b182833093861b12c6030a8002feb3b1a5e940b3ab7f451b98fa344295b4dacaca667aad88a3329d5f68fbc47aac2e97e63d3aeecb8e0472f5a177b75f8c9eda0238eb08acf831171df0bd60282d64faf531ae636d8633981b1e54811333611a1dce156bd189bc1413534f10b01525c260234a5e08bc67142f821cbf2bcef80",
+    "d0a754690c4d339027eb6860df0374f65c7004ab94cb9efd247f617887cb79214d5960d0796648bf00bc41c9ddaff60409f039a6279e2e7b51fcfeb7b441ed26a3acac1bc19165e07724b890a0a308eca843112645c62cd8ceddb1cf80fcaf947aa4931250bdc946bd3ead4a57640811dc94fa57362ba25ee8c091452f3233dd",
+    "1521844bdb024fd04493eeb6de9913827589f3752e9d64f08de4ff995c4e6b1fa4759759b22af1007bef0c22bb28fc4",
+    "4c21a840c291da58d3d0516091b7284df6f5c2012418db8468b5d0ffc1366b21bbd9c27b83c15e0be320bc0152e8fc46025918fd209d114d229a74dd51443c05922da14845af293a31e7772a3b0024f1069812d6db75230aa454725c2eb03fc24a41b5f3c32245e56589b908fe02e2598bf2c5cbb56ac69f2a830664eb1207c2",
+    "ccfe135cf0ccf8064946f99b69cc6c355f470e528f7c97b22850a5ec35594b671b632aa94b8315ccb86e665b3c13c04fee3dc057357a68d1ed21bfb393aa7a25babb8d1435f8b3a13d7a442149366de062877164d72cd39c38906f5063ad2789d5e9bf7f3edd8089cf84653124e228fe90b389166ce0f7e7bd59c756d42d1629",
+    "48bbf44e406c0ccbde9bf5fd0839f55b548642bb878b204d3a5b09c0ed60b3bde4ac755fa5c157ef8d0e6d438fe2",
+    "5ed4323a456eaa108388187ecbc022c8ed831ef6814ee3553d48c2d4a3b5eb0ac91a781715bed67134b2bbf3ab040c508a517d9824ffb40172e2639f16ac020b9a39174a87c9261c47399c8722c608dcce403044ab1ffce6be05f2320af6a6280311b164f52846a58f6514ca2c799425bef41a68d06a702b857fe979ab3a133e",
+    "5a68eeb68597ee41e69c54912f04ab7cbe4b1478797b7f143d78091aa1737db47139968207a687951e18aade7230fcf6a271c5d4d639023a6255f8614abbe8bdf8c9a6e7677540da6d56bf6ee2120624170c12aa098128f4d45d10ec772d85e320599a9b6c6079d11301ae1a4b2111704e4fe0dec1b220624dcbc84309ed975b",
+    "f20406511f0b4a69172a016b90637f71adb093eceba137dce0e842db2e80faf7041f69abde814369ee3dc019788",
+    "92a4962cae4d124806456dcb4f3cd3a10912a082ff617d49f8f0ce3cca24a8863448f6621b3edc4197a43c6bd2855dad76e1655aea6a10f6e67fa9d767d181c31c0591b7135d5cdbe3f204be44e6ce0dcab4b6ed74010f27f960001f4262220afecdeea82131a73aca178f171744f7929b88e54a72659625b2ecb65e1555a20b",
+    "b6a54537100d4a8c780e9c59a8322d871fdaac3f3ed2b9178f472b5a53527d0817503fe98c686c8dfa0211c18d5e0dea1c486a8806ac0458f0cffa4c82088edf747108eed239d77f1354fd67c9db885cbeecef0acca84212e22050977a3b12038bd11227f370c22c85ad50706a48cd9a38cb044f335f606851146451fae5f87b",
+    "5fa908e048937d8e95f835c0694223fc377d86a957e26989b692ea04e6e9d0d1ac772d62493eb210051718dad5",
+    "63ead9c8433d75606360229df0efeccde02615990ddcb913488ca40753d7491f35961cef1b8bda774e920468101976d4a27ad2de38a57706a5e0216671b9b4962b4e7918e9b1d8d83b2e93157b640f2cc3ccf0b269357fe4f3c06764eca81ee3b5296810c5a8cc1538cfcd179fa8b061b202d93db3e6388b9107326b4e9561e9",
+    "53139d90da7ca7237e66d10eee5478147cd43dc8dd56600382c56c9621de2f95f33140b84a761ebbb8c1397dbc3d4be6157248949cf757cc9a8cc771f7cfdef02d28e3ef85e71009d0c2db372948d09eba6b3c6dd5118f56f0639de4213d0bc576b146834bf629a0b9147041bee35fae9105dec168d2e55d027d1413b5932d45",
+    "18594db57d514d4420988e02b42e3d4f3d597c57dbd9e8bf3ddc8dc7702123b0c1b046cd7c0a82b36dffcb1d1",
+    "670489282fe6ca869359ff59a7e3c62d98a848da3f0830f6c7141cb7794d952e27bf1c068479072f4f742a11cffb8a4433237490910930af70ba03c4236680cea56e3b5b73b8a40edc9762eb042417902a32d0f5099fc9d3ad10ca2dfe5030c9243c0c4403e7d01e0b5321e01b39483caa30fb1ff6a21492ec7efb9f316011a5",
+    "2d130e64c08fde488e5eebf35d3c05f28e92317442cc65deb4545ba74f22b1e0c513a52920c5f52f0b31596db22c682e93a00b7815aa1330329472b91fd8dd0def7cae7dbe73b269cde65c43e3f8ff4e5b10d9b577b17a42a2f613e11099642904695999a7191d2151ba4a94d7cc2277b0d44498a0a66b8ac0668fadaf16411d",
+    "2422a056a39adae148b9467ec36a0f04c843272a0951c3811a7d6d16d5e18464a826cf029564546893535b5",
+    "57ba03b5273eed74f3ea284709ccd5c3032470b335b1f5ad38f21f8149d08289be278d7f41e4b67b6ca46825a569380875d80a1b931310d54a786622a3cba191b087d8dfb819b5b814a30989a3ababe9577d231525d20f01faa3c8dafd4e7aa8d4dd06987d78de44f0680b90537490100c5c3ca5c26cea96da3678f4b02e88a1",
+    "ccb789df758f0f8906a9b81641d774f8a7560510b4f80c06df8995ae2f8216b5170babf476f40b6dfba817e410031756e7f61b83ca5f6e88b3a0c94d8a850be538af1785ad6465f0d75740784081afa2a64c8e29a937dafeb310f289cb444805707c4b8c95d1983ea8d3bca88f4f1ecaaf42a5c3f766b389bd461dbe8f77651f",
+    "41eed1bafcc93f96e490f81473f68ff212c251e6c9ecccb5f15b7310258367b660243a8e377a16bc74aba",
+    "034030a091cbb80930aea732fe2cb4d75f5bbbcb4ed885ef4ab46e678d7b109c2275ed9c1ce334957a648fadf370976abab49335eec417d672a5535c23ac1bd9e1fdb141444a761bc0ba4d4c200b03c0f6498cad4a42a4d292efcad1be2db9015616368da2cb1d99445608555d1a7557ef0faf3be226f4de530a54dffec2b5bf",
+    "a4f457756249d7520432158bff08d5f0f085b1ee8540d3339191556141e0df3b6fc2100bcbd7f6195224b24f8d1054b73da78c2a4f73c13bbc1b33dbd909df6c9eab541347fe3617118f4a430bd5af9a043fda030951980af1afdc19646834435d24cbdad584e54aa237ea21df8b6f9a07502e5a1b8d25b9184058df3a0e062f",
+    "34ddb88f965e672d5a876451c87eb09117c205b4866cd2cb6ad6775bea00b52ce02048e420d8b74050",
+    "420f4ae4ec55c029b14fd2a71715faf074c3302ce6039a63ad24b23ebd2b5858133200859e9a7ed2115fd62d5e3c53775d86061f12c021ec098cf6f2f22ccc0d776a4b7d6f612260b8b66a7cada94a9b1a19319348505fb6f97d03c5888cd215662e30b8f14075104a511b9cc66563890f89302a8871971baae7e9b2102cb2d4",
+    "cfe2d6ba11230eedb38cdc2bd9aa68ec5edb59a821e13a0e837984a5509cc21aaedea7af827dd337205dc49c0f0f63269cd2e3724269a92757ec2c8027aa7594a0b1b04b1bab0b1a0fd7c637db2d2ea2920d07d6c387b4d685ab6e87214cd48a61de5897c39e54e57160f7e9dce198c4fdcc21d520927398df1d9cb409e41f6b",
+    "47076492785b8cecd3860479d943a2aa762339e549310883e9b6b55659bfdfd28dcddacee31908b656",
+    "a7458cfc6c6e3762113a4356f88483a47db376abf14dd2d840731f6494fb0fd29b740d001207d789d93e37905eb42e993832aea06404206c52256199db406969eb2a2fce46648053693ce709276a4076554e90f58b392b9d8aba9223280bc94ce2af714c2317bfd84b9d9f4cb6d5e2305181483dbeb5530758a472b02ef4d44c",
+    "2c0399bfd334fa4ee876bb2b7edbb37919f29af072b4291f5054c7178025aa236610a3abd62c79ca74a1aa34fc924bd7db7ebf1e6f728d68aaf51265fb44df5ac06f654c30f14682af897712593bbe6ec85a66062c4856ccfbcda4a74b4ae9a603922c81b243267830cd7d8baa566c534f758b76e46fd500b67360605c6ad04f",
+    "3037a5eb857e98fe69522c9fa940ec38d98b10c648854702e1c2f517b0772700e1491674c707124ce",
+    "60498e39464d2315875a58919f7e31a80b3d0e000d606fda1c5dc7de43b49711e942b994953b9dcd9921da93d7278be0510f829978add948ce5ed2eee65469b26a192acbd57289f2b200e325a42b205ea9c0c06648c7fb61464ea21271d2ebc701232d7ebefa0ca79d22cbd6962fa21fe271368ad50c6e2126937d1e6d605e28",
+    "13def20f8310cf7107bbe7f0f63259ce71076cf0682b28005547fd6333ca95a840dfca054611a9ccbe9cf1a62e79d00ae41eca2d2991f088a32b92f559854dcf12dcf145b5305b93527a88515092501201db8c490a53f5b57dc8971c624b363a560a4a24f42f0b08fe149ea1202baa2b915e71a229902c6a6a4d70e7eed6ae39",
+    "b3c1f3c0c4068131a28918800c75a4e9d661716cbd93e5416c7800e999f52a54824253088efb09e",
+    "fdb4d86f43cdaf3d1f0b4267ca7f55c09a2ceafefeb4ac384301ce849b77e43defd9039f344e1fc3498426a99c45383cbfbd409aacac0cb8961714ba7fa6724d257c99b207e6655748844f64240d5d651fd61e0c4bf6d2bf4abe312dc86bf76a52540f65df39a69f478d984a82399fd86c5a3ca08498cc5e5dcb679607c4fdd0",
+    "75ca07c34e8279c9cf8da7fb581b33dee987e75111dfad37da328501cdcaf802f6a91b6ba4264746a9381fadb7be7d9a091d8361bcae02d91910c30b3815dbfd7bcb9f36afc4db6d022f36c15c2d7ae08080ae62f3266cf0b35b5e1158c5c9c7091b1bc97b6a2d9aeb15fbdbe6458f95ce89b610fd12cea67d4b6a2f4d94ffc7",
+    "f252e857b8dea895ebd7c8f4352ecdca83ba748fc8ac9a7768eaef9a50efd3147073799d5ee44",
+    "d605fe8f7c64bfcebf31268a3cebddc57f7a4c5e03742c18850bfaadf64029f7935316ae1eeb43ed7b362576bcc394b544772b2f7695e67830c3db395b105a0da38cd9872e1afe90ebc2f078216a41d5cc8ac35764d62f350b0478e3fc0690fec29752585f4902f70eff5e16314c390f4ebb3e53de068a6c170ed1d06c324059",
+    "2a0336705b28f5607ebe3bb86040ade91cccff779032533841458c8da65eb8e6af0737f4b45fa34697325286891aa95c65fe63556fc588eb7661268b92aa85024c4d58f80c93ea450140a493634eb462364d803a7c674096b384ba254ce9c58dbd7267384774293d4c1d2438a44c453335ac4c3b75b8225f78f329e6ed51753b",
+    "15ebc9122c078c5831615eee9e3eeb605c4bffe97684d473923b4104a507a79e0f1c456276ce",
+    "3f7797dabf911879d3b714c083a6a67ab0515a56f56cef7318a77e8c6fe78c0c0cba45b2e5e5c3830367506280d08a9d860b4bb508528f870a1288b4adea2ca3224e720e2cb17ef444f51ec85c4edd9122614af7788a961d6642b201dcd1bec693190eb698e11697d774e2ba850d08ef80acdbd703e2d6698043e3a128a5db6f",
+    "53cb6d033da4add1fb1111d5e4f609216e8e9a03674420fb27abc75322863715436652bebbdaeb2ddf2b53500736b513e6e9aa140231e28d5bece5855acd32a3d85621baf0ed5afd99a1c7e9391bb6a2f4842c12fa893b47a678f9bd291dd880ad0cd657ef5d58bb2bc1b64687fb18cf9545fa5308d78e4129ac5567e2747ae7",
+    "352b53efe85c1e9525b470432477ac06761a5a5299386f638bcdfed25c318dca49c6563372",
+    "9ed4af71d9c26a7d238d373de8ec08bb6c1748cd873446bd66eb922b62d86c17876fa2b42047b96113e0f11c79834a6f59321f50bbcefd5fef0cea77b85118b6e96f399d530fcfd8c999ba2943e05db8d631875cdce9f382a4f97e0c9a0a8ee019c98b24c91ba2aa4840759c2ff85e2432ea1871fbf681c29d09ad9127046464",
+    "429b09652505c732c40be2038cc745b086101cc87bcd160f09c49bdda0eac947aef6f26aecb53cefbe198bf222df63e3495163490174663a1875e5fd9fee438114cc6ff13b256916555d79c19d50ec0a9da71bd4215caf46ebd0d4184bbb609d8d6f8bcc73970f4a078d6a0a90a4a23fd2da115984593ad9a015066f1f3ad5bd",
+    "24477165635205970d0ab4073c3e489d9b109448445f3233de78ae990a7a5a5471da3f715",
+    "24422b1e36a757a8a6d4cc7b7dfed4c0b56f3c6c11828e50c6b916c9891d9cb715546144d8834ebde2ca79ffec7556d05718dfc8cf2420ed0384ab6d0ca3025f80c5942aad6908a74db8871f01a65ce1b593e336f6ebf89836ba59a63b9dd06f26d98fbeee9bc4caef7de670d10b981e0b9f8b614d5f5a6fdbcadd4055a7d0fa",
+    "3f61140a767df95b3d4abcb5e051339e11da3dcd7c84dbdff82646b86d742bcb3221c087dd7e63d7fc064e4c132360b4d6db122ea33b7cf7213946f6687eb438a22fca5930e332bc40c7050fcddfa23e97683d65ed9622cd3b2f7d7733393d41feb78d0bb6d5a56bafa5b6b7242dc77bafb19aabb4a43d0278797aa1e24c5d09",
+    "af1c5a79ccefa5f1c07bede51ec0504ff583b568e3d70392984d34d33729806a849d1b3",
+    "7965cfae823f7dfda0a33d493aecc7e57880bd8b05326b4df2ada54515aad61432b5cff17d513705e0dfda43bebb4fb4c35781de7778b714499732e162c221575448d4bae82be857eb3f30994b48933d05700106bd8e559256712196dcb5b7bb4967e948ddb1a3a032afe2d246e5fdf0f3d9993f3d6a523368df984095a98bd0",
+    "2c8c4aba00d62f02a7c868911eec4fa799bbd79844b2d30f2459bc092b6acbb83a53bc28c1d77d7d1fd7c4a5c817cd6c72063beb4efdca6f94e96c0f2a8a52bdf9a81bce7084b506d2185eba05ae488b740f3e0bdb6ce3b42360ba7c07e53f6c66ff8ce7b72e2f54797e98ff9192cccbb9cd35db29477dde4968a2dc5e5a8a71",
+    "259c26a1b9e5af521f44de262c2dd70c7585bf2f97873d846a89eaaa9df1aeaa3af1a9",
+    "cb03eb97005f37bf7258690c14bff35b727f3c168f05bb43bd427694f3bf747ac7fe17493a433ab9d89fc666bb771d5217b8609da73aad6240afd3b256591eefe043f897e02d460fc0203d429667864b196a2e1d8b13c8979e6128f144cb9d54b28980d059d4f55cfae647589845aef4478c521a95fe02b11341fb10dfad4b1f",
+    "1920e658b4e8f9ad4a8a50c07dec8c2448ea81a4caf442d124bfae0b53da797d5e91546875f8522abbd69611440f6ab56ac82f8221fd68445f63fc4c7322c4f275fae6cca3f1cdd0aed310d500336f186cfc59b7b8b9548e78d9b442d666264c58c7e853a3596d3740fa03da3be7dbf2afa0b542f04e904120e39fa01fa43daf",
+    "5ba6ce682ea5dc12acbb45504131cb587a8b04d01db76a70cd0723906514838216d6",
+    "2012690e0f60c396e0765a3f87e30ecaa3c3590dca37ae1307e745ce9b67d6e98f3f39ec9c82b98e201afeb864e0163cfa6cdb5070a6b2f59a8f1f70290ac1feb7b1f232a9bc5b53e2b16f11323e06064a81be222fe178fc498ce0f43ccf913f03a6179665cdedf7ead2b1349182bac075c7b563e1bb5a445e207ad8c91b3041",
+    "ad0cc8ddfa73ac3be964567703a467bf4b11b972e05f8bb8f2e7983f688aaa8141d8433e1ae60be76128fbdd8c2fdabca94ffe87ca618bdbb31c2e31ca50d233d9eda9d294a0b47301e4a5251a994a6ec49b481636271bb0d0c711d110a14f60df9d4a412c886b106a61d45307bd2b4fa0ee258a4d1f71b2252df13ef9dbe223",
+    "bbe6a0df70b26008037100f05cd05ac7de4eb10d74c9ba10bafadf77a024e51cad",
+    "a2a402b61e83e33e942dd307655f55ac1c379d485ebe46e00ca4b3986c636a775602309a23fcb25d8d7a5991a8303ad89de4be17d28e37146b6fbd180944c07c7017fd730fab5df7f20f4f6b1b506f25c288d9c05ab78aa704a2f7e362082527de0b49bb96fe5b91fac86bd706a5361b8970a7a3df4518e9aad6d347dc359e59",
+    "8fc9a20871c3bab8578ece0afea04f47218a076c5a6a45a58f94f996991f86976f10d17349c1e15ba37f19baa44484e3a5488e8814b6d97c1ee010a7bdb300b7f5f1fb352fee50133e2e6f4d53233ed943e3ee7fe64bc22b4e21ea8897285d99b4e0243fd5fdb217b44d4965870e6f4c35619ed62457b14d193bb07caad635c3",
+    "108b053f393d8c65ef113873f3cad4c694156ca1673d242aae362a46a23de901b",
+    "a70e3af79f545dd4274142fb24197deae961487c57cc8097c17e89c069d2a67edb0e3f2d95d54ada70d2b53f11b836a9bb6913ac7fe65678d49e6bde7a10395cd20145cfed20eb611a02e6fd08b7b1de3bf298727782fc3086e7b4cec878eec2ece021424db07a8d91015f3ac4919fbf18f75854d2a5b93afc069e58bc992ff0",
+    "5504d1e7769f942f36fdd0b428a982b6dec45eace146f37a0101542e5fd7896aed820d2b819e28cd8bd63c42b9a1a402b6408f14a9b06c852b563461bd6139023f9223736a8001fd42c2cf77f82567593db386457babd57a8c553f95511a4932b8cc407e39630d73587e643cdf80f87a1a205d04d14009dadcc933115f712121",
+    "20e002b3c07046294a7f0324e2d74effd3ab99627516990e2c0627912e1de94a",
+    "d0174fa8c3813b90c28af0d8114887a6af94ddc40b557eb75071c6a5a3e76fb7e8f12ae4e66fa52d7bcb282257a85398e40d74419779e4711fa51b40e857028a183870fac8daf54fd18f349740b16a6471ddc59bb9f4960ab943b99c18eeda4b6d6fce374ad71af75575aaf6133e3ea2e8d300a279f61314624036ec66b4af32",
+    "c3cca446577b16b74d70424233c122db2086b449b7644fc48196546caa7c6de39875a9bcd8073763b243b3790267a205f1c173379c96e874b6f4c0ceb8991fdb756b9a1b9758a1ec9520cdb0047362d54ee7640de5747ac8e29ebe790b8ac786712de90c7b8528d60dde1f84c8b9c07f8c1df764b99e29f57c81fcd6464611d5",
+    "2400b7f3cf2f97a047dd8adfb2fdd890ea151e887e1419a6dad64e8dff2096",
+    "caa0f73195e5d9b1f4c148ab2befba1c7384306ad7930046781a1b1747db65a97ca1201a019c1a10a9bff656b63a598d25f1f1e123ed33b28a1a3d643ac13d36c993ad4a59199f6029d309063d128d44e4b598850ee11d2e5d291bb819946b09d39c27e7224477b5d9a993107b3696ec4d6f2849684d5818a2194fd5695e1719",
+    "3999b64a5704318e545c748c5c4c6ccd0f3e186fe9dcbc9432f4fa92c24c092d336bc4826c531fd502df090880008264ef33728850b756d9b56085f7d7ba96d8dc7d92ab3b28b5787e409290b7eec20e1c526246034962e4a880fa94fc6d7f9c2d7622c4da1c26ad93103050f6e138690b25eba090e2e2d0be3ddae458b1285b",
+    "1ca33a01cb1cc0989c6cb0d6d80472efea0684f4cc36dd359da170dcb9223",
+    "20149766eee4426378acb842c6c7183812282f24985b11ce193570f56161c69d857f0d76840df22a0031da27b693d921fc3fbbd1974ec874a7820781d718b98163ce3df92f5309477af1c82ebc9750d05e057931d897af78a904840c4340e174bb43d4ee1c274a444a757c318d8089e4cf0c8f75ef79c2b5ae0c976df8b49cb7",
+    "fd30317fc42219a9ae8f6c284ce0141a4daeeff623200d5c028ae3659d01f400de5001403492f778db9da4e512f9ace8d74480a624a412f26fd6027cfb229859473d448996e6adba8c8932bc56b4813b1936b671a86e24aedecc043d0840decdb44efa705575a5e9bd197e2d52e22da89473ed4cff8bd9788cbd076fb9774c8f",
+    "1f46ea07e1f59e47b9747e76084640b0e0ae8f36491746ba1345eae5f30",
+    "47fbb8b56573735d1bf0d3341d0af48fc3e0433f9ca1e0868f3226a67f27e0474e7fe6aa023531290baf64a88d39820f2a8cea1fca4d109ae1d9dbf5677e243b1a2b69aee8351bf7bc5db1a2f98ad8098b575b4ee6c262a27d11619da12d1ca74e13924adc6b12911cfe627fa402d82cdb5f116f56652e585d22e616349697ec",
+    "2b963fdff75a4b5645fd2dde72175ac12f0fbafb794df5e6e0af7b9842527894f00c7e21be3eb12a5185eb74b40078a9ae33f63b0dd32c22803b097832ffe0c96c312fd6b6b80059f3d9121226db43012f9d8acb08044c16322daa7b9c4079cf6ff2a8e066de781c365e8b2250cc5353b800dcf3550c9ce8b74a9ee8c8aa2f5d",
+    "214e945021572ea956b0ec2821a027bfb9303ce4b7c4d1652e41bc44",
+    "9ae4db550d48262cb6f41f17e30803959903ff344b0704bf16d09648cb532bb33ec3c09ebdc86ba0a36180eee791708e3870d73a26191a11bb0d0311c071cbaaecad82c77d8070c4d77b1dfdb21ccc9fbee4eed494217cb79e89074abc377542f7b419354fe1396ae3e1a803a7052e9a9b691b306e8cb9905dd20b559c0db69f",
+    "0f7b5262f2fa73bd0e7e028eadbfdcdcc357f54bd6e93c8163e0ab7ca0675b3c817dad5a404f37d02d133df4b7bb7999aa2c21e1f802c1bd7e40781e284763a1201d9a03dcb902c38e513fb8410a25d60ab83d9f398476c926e22fa7be98118f6c94a4c43a4b3fd55cbb9d691cdef82559f10ebd9eef3a69ba84dab8f9d5441f",
+    "41a9015bbd9873ed24ad03919de2edf758e809024f8de3ecb423a02",
+    "b33ada0640f79f497b1ae2d9718b977be53973dd5a233461b92f71c224e3f49bdeb55624e3c06af97d2b89dff9ff9e489428f1bfbf1dff02b7a75485a01635305c898b452af181faec7248a26edd2ee55cc0672ed7c9a95d1fc3d070f288c808bc3ff708da34f7876274ad8ad263c2cec4a2d0e1a8661c824908c4c70a99fc92",
+    "689c8203eec7e57932df2dd3ed81d342044981c638e051deb9dc1f1cfbf19899b444c11f957cd8056f262f6131186e5c04e1c1b4159a2e615470efa591e01c06158d02f63f023cb1cf0e0dfbebeecb17c8f1d9bf43c67837bc0e642bf9d5c1e87958e0efa577efc3fab67c75a25fdfebfe5dc4150bd0cf46605a81b246f0372d",
+    "d5e6024015147b253098c23b51c484e461a62f671e6a27c803f5e7",
+    "008a9aed9499aec8fcdaadb7d609fae7d64c501b584d744a2e54fb93284111c4a0a7c5b664d836eb6620e0e43e2c721fb78ece1cc178b823a6ea449c593485022e46ca02fe0d99e0dbfa1701f5947a7151859a09d4cda6e53ff58d2dce9c3383a0cea0a492cdc58d9b3d85d7f409256f679f6e5aaf7d0648aea4a0b802ca6744",
+    "3e4baf44cf80b789d411a92080edbaae28575c25a8ed28dd46b3f461e78bc17113cfd8f9a239946405b760e5f8dbc5f7baa8e2c6ba39224fabc71fcd5c7111cceee1c8d22056453b1065197b93642e2228ef498b71df3652eade6eae2b7cae833ae671898b7d0c65e0bdeec578e79e3b494f9da03bc77ddef8f1123a8257bbdd",
+    "35e248db36e2a00434541e1f2fc7c274da442b9b014d834206dc",
+    "7bbee63afd5fccad05631754b58a648cd1e9aae6d5569e27137ae558a2e9c7bc60afc37392f9cd4d791fd981e7ee2c3bb77c62a8d0da76ea4b612bb19be4d87e310f34d7051854893ff038ab7f2bad7d1b975cb991583ce56226fdb7fe98049cf5012dfda4842870263507d3249be549d28fc8e4b5e20355cc36e6c07be20b14",
+    "f6d91cb89db8e3e4e7c8cad90f38a5fbcc50556737c79c6e3a48e3a931e157cc2cd0639b3176be3bcb10381f6cb5c3181b72f7442533b88e17abbad35ab05ed757e3d85a44f03b8bf1fd4d2aad26479864305e684921a8a62990f5610e4e34d861e6fd6096bc472fce6478aeb2f79826325b1c6b700c2af473416ca83e69cf87",
+    "4f949e81383af3de7ddf71f32f87e7de410aff4841ef75eeb82",
+    "d7618bc07cfff8377a26e2cd56284be1e03f018c3551bf5981db0178909c401b5018ceb4860c93f9ab3d97522dbcf69c59d15e797647286534b34e280f88d6b6895dbcf027fd3f13d8f3f664803596c96c8540b9bc2f5ffc5c125827af7e9e80a770970bfeb5592937530dbc5b701b1fbd035a19e98d37d1a27f881e487dabac",
+    "1fb4b74c33da3be6e8fbc1fd8ceafde706d9d40e4ab5bb1b65c579cdc5218cd05a342ecbed229571f0565b6304d710581539a18043dca0270f3bcf9fbaf8b2300e7bd79d39408598027d05453852748cfef2cf92d9b0f62f41cd45cd2dccb33f720311e2750e11258077cbf0a3d7cde7192209bfae6be8949c4ad739729f40a7",
+    "133b9773d7496043900f01cc18a27daec60d0c7c9d6b738491",
+    "ffe7c0389c88491e3fe6a136020f8fc5fe2ec29616e959a362123c2d54662fbbe82c2c607bf85ebbe3977a5f078b9f49079544ee19bae9046e6d7aeaa5dd5241334c6f838a11f3949dc53934e1c71902e59516280c3531a5242a536a4cafa628ae2386dc0aa3201160b6912476745a8d8fdffd198f6cc2db9867ed6ca6f11eb1",
+    "0e59f30d0cb5278b4626362785eaafdc63e76b98ccdb5a796029b3b00183a2602eb6b43a840fca3d2f7eaef46565d97bbd6333ea5e9da0f5b3025fb31473c13246dc4ca3b6578aa7e176a78f2e01a332a967e2a4da4345b944660429df5dc3bd341617648b71536629d4e5658fac7878c6cc396426d1f8caec6dbf8e14e02ff9",
+    "aa69b71ba8df91ff86b1d86800812d588ad12e9d465f30",
+    "7bf1521d1334aaee3305f40424723a34023598e432027adf75014fd3eaeabeba2e30a39df3b816a33dd56cdbf754c5d7942062faf62a21c0a437205eedae63263dce15b1cf7dae8d1ff8400a7e27f5fb4151424ba58ab5b380ae4e89c43b9fe3488982340f738df1b1aa94686de199bfec756cdaa785481133dd852e57e12ca2",
+    "89025790985405a91431310489ab64488c1248be10b8dddbe0b9eaefc1f0f63c47294626112c6a7a71b6b2ba288e18bac765af9a9242cdec23647329603d7366d27fb489377dc2d5d6b38947cdec2e14833549b9e1918911fa2b63258b2489d64867237129f3dc35e4d28a4f4566828282666b2edd5021201663abca707a5a79",
+    "6f62d676df3d5e7631d507a24476518ab3305906e5379a",
+    "7d1ba1213bde5d23ecaaeb86bd02efe0656233c2bef329f77f864e84f4af90cea7b4eb207d005c8ae41d24a0696f0ab82d2b8c5ddd40852fef43786d5131e229fda0c24491ca289a95c646b57cdb2d6166123a5e70b51109803df22c214fb3acc3a7efc6add7e535cb4fef1e68a5e2725e0206cfc20e879dce527137d77aa4e2",
+    "a1067d56ee8cb709db0086aeea712900c47bf951271a6a8482dd79bf9d94dd2cedd0d784740f5bd905680ab896437f83ce1a2a202b895dc5630fff13f1145a8911dc6351235e23807f99afda5e046d051d7f9fae9dfb5bbe23eac358d18f05d0e5bd3206439c801515185886bdb9410d526d0ad831f5a0a768d68e504d22bab5",
+    "13ac20f8312ffdc3961093e212e49860cfde2896b7538",
+    "05c05d9dd368b31f82705adf53e7698347a9fbc5b329ca43cc9842e7bfeaa01f39be88e7ea5900943c39b32cceb878770d52f09cde99fc9cecc0ba1b48ce672b03a5a7e830fd393a75b4a33065d46731fc78e499832e39499059ec0fc8c305dffa24582a2d7702e97086b530eb298cc196b0d3494a31bc5cb8e36f38383516b6",
+    "ca360ef55a52037829c86216c5d31ce67c03e45ff25080b5b831e493e6a786c6f3ab9226d05b895424d8eddd98fbfd91d52974b7cec6eee6282b25a88a721733f2626d3406d7124fec2196cf5e22aaf5f2564f9cd48b0ec43a61e88cd596b2aab8b31026187b0d43cfb8594623a0fef10f15d5be24cd82371d7ae71471c4cbc3",
+    "126a42b401cee68bd0f55b5bef72e05da293f4eacd74",
+    "e53ce67e54f59dea2f04f60da1f43112eb33db3040daf091ba6142163e861dc6b4cf78fcccbe04c4d256da028c21a50871afe9003d41e8923f37538664bc771d1ab795108a027f286f0572b78c1e0c323496825ef8de0f833b5bbce1ae2d43a8872dbecc06e7ce70a7c6bc42e3e90b53a2de9bbbc1bf29663998dd9b47821d49",
+    "c7b47c661cc763127198331908469cb137aa9ee61175e01a48b759d546299e47278677beac1311e140a1823cbba25505c667f7e7453a191f34b5c9ceb532db65ec61aa6ff5863d94455659c74664038c1dff6e5bb205c7c471c3c0d997821efb7722bd21f7c22acf2901123d42fc6be35ea2e48b90e9021a4f68f1505b433f89",
+    "1948c27d92789e6db7feef3bf14f7e9182aa4daf4b",
+    "0a725e0a91bf45db00c654da3545db2e7fe3fa55d7dbe6bddee2f8ac7e960f7f5fa052d9b750401f14e3968a2d70990e27ef006ba30fed074c5594629a3d9a04f91427a9e03ea24b6167bd3cdb2cf2b067b71658703648beab9092227dbceffb2104a60e8409ae6dbdde718de86ff47900dd17640877b8d3e0b311c250139920",
+    "7df47560be7a60749d9ddbf9e1811f67e286be300078ffc47f9ae898e5a17d28f27ed47421b46934fbb6171391ba6b842e853e7903dbd6be4087cc0bf55a9c2ed04e477652b1f033e5b36e8b688dbda6940546ef5a5a17d242d6bd614a3de0eebcc94e9dcd6b95f67518bcc508b5dad309e8a46fc4e33f4e145027ae08df5225",
+    "2a78e8f6cb6c30f3a52e4a33e3c9fc8a21870431",
+    "d15d45368b2e10a87742f716954e852e96e6656e1dabb305f0c9f7658122aa0e7b263713fad64e9f29b81cc67fe7a3ba926d585066ad9ec668c717c4e49a9dd5aa5e9f084b9d6c6de801ed9fbc9e0e0a9eb010790d6ceb5a7f0fac1327ef2a418ffd6fc74b4ad34f257355d2cac1251e06f5c56a7aff803c7b3cd48ddcc53cf5",
+    "fa4b2562b0bcc73bc54417ae62ef82bd58000eb9c61eaaf4d111eaa68e5080c3c44828759fe2fa02b49d2609ff962ad61eab3bdb68c3c186d32c763b0af67b8490535dd5440378f5bb843cad8e494a9bb5bb0362323178d5974b2a4e7ec1714c31c56fc8edc972a367af59c02ab8decad0e4d65bed412135ffddcecc5738c3a9",
+    "47bd05991a7b9e88292c4234bb50382fd54d6",
+    "fceebecb73516d701f3e772c701abf192aeea6d0e3cb8ea567b317aba53f666c410611d691bfd65af490ca07a27d9720176f225ba73ed060f8cc912774f853a3c08bcb7a2ae043637560562a0a1ec4a87cd8f498c18e4075fdabc06e8e6d360f299fa379df9f7293f4049c0203b5fe4bd88a0284ad86efca22eb4fde427b2969",
+    "76267bddd7b06b76fe5f5a2d5fdd295dde8382a4f4ce271222718977560e35a66fb5d76d5489094d55e7dcd3b4301666c48d1b60794440b5c0cd1a16d00bdf20d516b5c19bce5d69cd9e7c75fca48191e34b56453ecfcf5f645a169253d73d7953fa5b8bcb9efd763357cfb7c38258b8a5aadce88269ce10b4fdb85ff50de7ff",
+    "533bfed309d306142815e5c67cbfe71d8c520",
+    "20ca183db3b8cc353c1a26a38a9d2aff5198ca74f4deba8b23d08ebdcd3c6ea70f5b870e6956313b777b9e785a004d2bed8adcc0a5ccaf86355bd532ecab4afd326e445fcae69a60c3a1e54552f130160e3c4871b260a87a54028cc96d60adca10397aedca839bb280bffcb6ec037b482a513771e87b92cc52f0ab0a40366a7f",
+    "b4ee298aeefb783126ae3949e44b03b22e646ae635ccc5cfe53db4f63b9a55edd3f7f5915994547e276b72804728c24a7f389f423634dd2e7e89b4afae3655915526034c3263d0291ebc0e10268b203c488b190421bf29c83752df7f668d9b5fca11652c3b667e812a53c0a313bb63f212f64cc317d467fd1daa047abf93381f",
+    "695e023a0c3208c4b3b936836c47fd9b081",
+    "1cb5d8641bcc520c808f654df4eeb5fa0da986c01180a72868b69707dd2ad68255d0a6e27f5f928901ecbd8e135ed4a62edfe485138a00466c3be0c958b16e1146756f6f1669d19039b61ca6b44a509b9b2a988e64f0c3fee84b2e1fa5ee6ade60de53b7cff5d1b15ee36b054230b05db5caf42fdc8b4980c994ae7f7b74b895",
+    "cf81f8d13fbc384f8e4deaabdede7815df5c6299a63708aaef3b20698b22545e0c2d96a2cb97d97c4a0ba3dbbfae751a7b50a98dcb6d326441f5d0bc28d07aa649ab96f8383d46bd99c5eb4813732aca4e5588c785f0bca6ca60b91619aef40283d157d126711a83cc053cba02c18f6fcdb9051a50033bdad90d7cbba92d7fe5",
+    "5c45f0c7319030d8dc1001a503561c7c92",
+    "cfa023db025131aad9001bd6890ff643f1b847c2c2d1ad93f39d2d59e70b76b8209955315214c4d185c86f1a3c0422768364305c2b349fe15adea1c6c5bc5850be7ac42761dd7005a1542c4b960cd169cf2f8cb7fb3f4891a49b78f24cb7aab93f36c90ce47811414bdc4851b6c00a6faa984510fa1f08abf73e8031b5e6e0f1",
+    "85d2d07384f54281edebcff4fefc6e1da56577e8c183e02b90e6102c2fdf9c20cfe79f2a4571c324ca34c6d50f983da49ed49525bac96ff311845808719c9cf7fef5047ccd71d31aa03dc56096cadeaeb4830493cf0e27d81d5ce09f85ab3112ee05e19b56ced2006276ecd2eb7f9a57033d4bb1edfb934bf0e84bd8334154db",
+    "ebaa3e120ba837c8f6242b2cf1298529",
+    "793a8d9093ce65e92fe783125e6733fddb1353e270d9f2e17d2597f2cf8baf83aeec050946ccf7e34f3e80307ef99afe3b7067f62faaabfe1ae2d720c3b4c4b7bf77a843cb8fc303ac85cb1ad8bdef96d409fe8e4dd5397f56715033dc77724a8e8514bbbc27a55d4bd7538ab501933157229cdb7f2cee33a91cb870da5fa79e",
+    "32a2403e5bcc135f7e63a51331e3d9f0923baa0cb8fbfc3df0e2056d3de7380ae7d36e83f53e3d927ad6b5835eccce5b9c058a1b5e522bd4a8d939630caea5e10f4f34b90041b0a7b03770fcc332fda2399bf93b59f91f0dc6838e721b8aacc5e4b319f35890f1140b6ed6522b6784405ec468bb8bfefe88e0b4999450449a75",
+    "14e85d8aee2d5cfab13fbda0b68172d",
+    "67eeeebc037372852438285cef4a07854efb1f81a0116b2bb5cafba1852116c6c717b18d80e6c68e5d5a4a297fb633098938d020d2fdfe6fd33c991bc2396c4d5b2a06b3b5294a0ce4cffc82f54c45b2fe9196fad047aa30e212f2d7b03d1a702f95a8ab3e57a312c47c049c53baa2fd92fc2887e2d54d8c8884cc91d6e5bd70",
+    "5c60e5d65ccb2ce9902dc7cdb496f4c81c94cb2ea4937b8fc05ba02b6eca65693bf3647ad22b9c15cbae16607681de0c3e54f5539ee1bef6c63870aa9f763a527ba3e422305ca1acd7a0c8fcfc1b0b7fd98ca3a4589f17781eb2e33a44fbf438a26017edeafb795b29d5f653654d11bb25f6fbbfa1de464bfc105c8fac6e47e1",
+    "13fcd7f5bf9f2ea5ee63407e75efc",
+    "285d5b772372b119a16463fbee3975f0159fd9031b64ba2938825c36c89ec8d1943e289382908a4897cd0dc073cb1142f90b19b0e0aa074c1b5523e1adc011008bf392d77c7d92b0638e69647cc7d5141d0af10ec26125d2fa496517ba0a03d6b627a9f73ff13b132606cd310e4104d61a82f523300ea474aef003ff401b3d0d",
+    "f22035a4ae6fc8453fd5c2ec37750e39f947bd91e071b746df9ea3da07c9a87d6e2f0e487937656ca2f9704728978605245827ce5257c37d6149b8e09c7a10ec0e329b71d1fc4bc441345304ffc0097c488afa2bef36ecc807fabdb3236e4410515b9b7b5047c9fd619fb872668d8a0e6e500d71e9d08d761c27b8b1c6dacdcf",
+    "deca130d298f3efef59855b82ce",
+    "2137c60dc688d262f700592cd2be212061e8b95099fd9c7aecd4278cc8312eb3cf709d441534993cb1f31ec3b31d99044df4470efa3bc9e716dc2c369bd15bf50c08b06f86b2cb2ccd02ceb0ea813783d66c485d7f0130149fefbff5fa05eb8a374ba3c04426c02c4a8b029952e4aca1c27ce257f14386cce3791457aa421c2e",
+    "ab9f81261a2130927acae4a60ab0aea599dd0efe481be94e441c6e2848ac322bd630ab1209affcd3668fd6103b30e088ab75f6a6a7763456ab7a3386c74edc369ab6f58bc3865e4d0c9b69d9624f69098bce00713ea09e6ad612c95b62a20f9fe1dd2e2b773d80a6dc09e2d75783b61a9e4c2b266e85824e9ee6101e3abb55ab",
+    "101f0bcf4fe12d5d947c55baff",
+    "6df6e57b1aa4f30ee496613837ee498a81750be73b776eca66ad1e6f4db385a1968503bb9c45cb747d70bb5297e4f76f52053a37bcc8ef62374868a69acf320b4eaaf1b37798b08598b4d0610caf22ccd85c73de93eb3bedc9bce28585ea4412cb1fbfca718fe4b05726075b68e5e26f5315479b456b66cc9bf17e133aeb86ed",
+    "bd712cd73a035aa233de8cb2801446a1894dd755523983994ea61bc393ad4eef646988dc71d0ad5f7b7d3f9a4329720ef49f20c0b1911d90e5530d299978538ab921ee421161325dc8e40c2ea58be768837fbcf617a614e46983a42d6ec1c07710174b81566c82cd4d5be932f2c2f240043e180b7f4a74cf61b787ec457190b1",
+    "1a8ea562cc52515d0a3822ab3",
+    "17a091e27f4162a3826b5b8ad2341304a9fa78e14bcbac51aa40913cc5c81625a2f324088a20fcf175f02fb6d42e520138c2346c40e8b45b3951232123b3ab9725658feb434c78dd21dc3a82cf2f875e6a843d6936991aaf81c83fe45dfccc340454c5b63754d35a03412d123b833fb1e89d77cae416de3b5d23cec35ea75652",
+    "335109fcd48f0f035457265da6d35637521d3fbde1593e88bf9d1cf7eb9e7183f9cc16d80bebb2256edb5645f0e87aa51f8155ba91389881573494c63e0b2647df6051288c6ead49f521010daf6003ee2f85eb735236fadcf4bb645c16e44160c5daf54ff0e583e95b724e0f5cf26d1b824a7ebd3b8b6d6f56de8f1f728af09b",
+    "fc3f998aea403e95dfcbfd",
+    "3c94d4705e23efcc0c4588cf3f216dcfbe571881c79b0ae0c8df2482ac006ed3d657d0ec6cc9354bb46cb321a0e73a5c26f2636056d4260f03fc171937a93167b09d73be7fedfdfae6fc7cae0a4ec1fd4c84c80d221542a2b41c7579b1c837179140109ee09d60ff4f76a7e23c31f642f1d51264d0f055c533ec74af3301e1cf",
+    "8f19eb84ecb7cec46132bc38db57fa507d5eb8695ad77e8e3219ddefd17c81957a2284ff1fef3e0f1b566d62f9a134065ca53bd73ac8400b47f505b96fb03aaa78a7154347db237f227ff7d05f5cdf8b8f2e8d61714fa703765ea05b38cb521356db111bbe7ccd530ca2226e6ab2accda63621de2c1d553d3f69b1152e5544d5",
+    "90e0e0dab8cbceed5e15",
+    "511878f9a3db4769548da912ed97aa5430923ca0f816e6cfdf407fd74edebb7f03b614c3582b3c1dceb54e558e9d5934b9b98d8098cb6a546f4aaf4ba2663fe58084f34b587fe1497a8a5a201bef01a9e8b7a6d1fffceace61079b08bee4f1b21b80d43df4c14659ce60bf4d4e27ad1ff45de9d1067f658678d89b469b1d1842",
+    "0807c0ccfefd3e60c8bde0482cb18e86f4d0391999f781791e718a362ee9376e09d94c48b03674c654fee49e5ef3083dcb99d9139c68499c3e129529bfef966131bd2de6b352838cc470567afc1d2d7aeb149c47919e9a5564a1b4e4bc72422b214a7348784631b6ca49ae50c6478d32f4e7c6b151135b35142cc1afd4fda7af",
+    "7f673448df2fa5f32c3",
+    "504c8b133ec29b5c20104109b01258ac544f7161fadf3e79425d4c935105c68ee196bdd2a9a68034fdf24664fd43da464e186f473124f961ef00b21db13e491d30a59da95f62acf4ee04b2b0fc57f7ff766e278bfb32360562250e5ae91efeed3e736c059263b1d4ceb741b034a1669c2aec3871bee061e236d759e5ca6bd891",
+    "117641d2dc77feca34c8b5e4701edff2f565724521d803b74a19bb3fd912a3eca1e1eb69e3ba51a987bf2d3a2342ef7b7ee4393ba82e690a49a5da5b98d8788ee8a2eefc24d9c37bf6f1c15048fff972916f488046b66a18c38a041302e51b8f2a233bd5831198f571d707d873060319f84ed4d377e80f8a656b90e1aa238737",
+    "436ea08893d79ba4ce",
+    "71ec07e845cd22138a058fcd6d4de94d7283f308b0276455bfb4a1f90b03e7c754c702b999ea778f232842cd8c19c42d5552194c1293c05e7d0abb1b2f6ca85e4e1e5a22bba1eb218817b5c7c73cb6d64a13c77d941fe81abd86c789c19517802eac95be8175a8f7bbdf7a62f239ec61219037ff6a82149e1aaa366cb375700b",
+    "4408563a1b360ca0f9952583cd9eb39265ac9148d7947a87bab75fe4d5907d68e5d8585b3c9ba4b44c860307128548820c7424b768439edcf06d58b821ba45c25d3c323ee4f7d3ee5c3f97620ac2cff89017dfdf82a76fef575bbd8e8650a9677e1722c627da817f9e14eebc195ec1d28f8a50070aeb7e81520aeb94141d53f3",
+    "2435a49be41f19a7a",
+    "7af0a88d96d0030ab9a897279992a74bde86e1b98b1a78a72022ac3950a214f895c7d0c8007bf4b9bd99a39dc706a98c9e9cbe1f66642ab6f155be9355f8cf633dbbd96f3b352797ddde19d704325d8f8c804adcad2335c6ff6e7710e2fa7e3ccdb44f74b293e060f4d9400a05b4da8a66cb54f7bb2a179a2f7f9ec0f7425c2b",
+    "b1b90163a0e4432ab1a77d74f11d58c75d42d93da4b1c14f88e366c41dbb397b0af84e41fff20e98afca9c96c35ba85d2d5055454aa24f5add54b62a274814ee5118b83f1cca740d0cf4340f6f5780d3ec6e21504d0a9dc44ac8a60428d272ebb20fd3d8346f3c71b505b296e0f97ddef4d930a32a538958655b64b0d016af91",
+    "70b014e16782673",
+    "b05a9fe0306b60fb872e1aa39476f6837e8dd745e6595f2d1637b2442ec27cd5a5669cb0f3a7e6626580c4bc0e10ff9537c5eff6d3e52930ff7d8e648262820bc3b8de62bad76424af2f9ad958438b684d44ad71bed28ec37a5896925289edd62e8c1b3caa7ce90a4e40c95c7e25337a6a9cda4781b0c72ac4cdbe3394d2faa6",
+    "6f8165af1cbb97cbaf4af282d8a8811496a4d168db20906b5b3808f1b351277c280359fcc2315ce94b46236b61b28356d7508050e5d0a2ae24cce0fc767a7b04cf8b96ffd64211261e76cb12d50abfc46939db925491e2c679e9e6b7a3cafa62d4605b0b731d083aff6e63556dae8698922a44913f6d4d0d0bf33dc993715703",
+    "f88e5c66f4e5d",
+    "560e8e94157bf0491d4bcbc7b75a1f1487862048f3b768f4874d3838f8f44e3112fc13091655e44b6a1e88a9a5112e5d97a70ac1565c92576169efeb5000a60fe36811d926d198fda215446317c6b73f8b274e64da47277da2b110caa4cfa9fa4c87f6809221bb89cec0cfe1c605132b261280c1d30b7dc147e88753f6e6466b",
+    "3c360057bb877131cd8dc99c5b897b3616763af31533e0dc2c3e5bf3331f1e72d2d32bbe7fb18a5fb37e7f0e9569da9cd86e0572b5742397fc0c8035b1668ef01c0f3f639118914509dd2351f2a0b32ac4e21f3997ee88fb4c0fc5c40c08c1aff2d926a869a61e32244212c34a0569f9e21d807d9f527ae3422ee88a56054e8b",
+    "6b590434aa6",
+    "7aa60931125e485b5bee8dfae5da990b47af7d8dc9bd06116b60c05318c45b856d273bf5a28320cfdc3ae2008f22a5ede983cd72eef313019e5d25aa58fc1de36c53513d87ebbc367952fbc84b87f0aafa86e0148451a6b2087c7bb6681e82789bfc477735b4002c85aa10928ee95f1b5331d9963109580e4f9ec8d8143423c6",
+    "d3431de0bd24f8ece716c49e73536217b1005695af56661169b9df5c842b4d54d49cfd5cc838503069074a287e000871f355acf6c852f89b380edd1258c5c150b9f40b9a904e4c927cb1f65e915a022393c48527c5b7a8eb859263cedbbada425729480d99f427ac3a7e7f98bf4692490dcead0293834f5b7c1801207b4fb897",
+    "a84e04a3d",
+    "4d0ee32efd21dfdf640081bb1d0a32d9e3f013995cde432ba127f7624eb539f2d6533f4f4eb4893bb3b9577e1c22dbff7ee3cae3ec9401a79999a16b3abc1aea4db1287ceb08e2d04903e8427f36409a0d4dcd2a20e432f6e2e8f7408d8118c4ad365ebb1a2a9088fcb3f9c0f0987e1a0d923608f91e4c2a08e19ae5bd7ac55b",
+    "d1ab973ed78452af201f6106161946eda4069a01e282af51d03a08747860c265064706c2ce04a88d3cfcd3b8855b242f782f79e3fab3c494f80b073024e1f9dc4f4392a2601f4d3f7b7e8a31c5a805d0377753c058f672b77689928d153c290791c59de20e4add5f6628b39e311d06d45ee1789e8fab897e8f90b931373b0bad",
+    "252f57c3e",
+    "3a1f0f5cbe1c2e7d9d09a13797e3d3a5ea04ec1ea2373d772aa2c7183ecdf7128efca5af344a16f1da036250402ebc7db861068fd91080aa8739ea9de411eb22c19c1fb7a2c1377badaca6a4565de37778470f313a9ff1209e69ac11c938d7f9714b210759b0b8fde092c4a3b56ce3a2d29962c88ac82b9503b7663e2222eb8b",
+    "c263c19fd32741ed90090b4f1044b38518d88f2a883167b01ab38bc80978a7e0ee5e68d729c9bce712e9b9089a1af19396da8ac21221914e4f879258ea07a5c78e44eff839837d36fcbf0ca5baf209e84dfa04801b75aa06993b79a85b1bad4d00f07e765267a069f55534d45e90267de1c91f2e1b0f930750cb7bc54326d50f",
+    "95b60d3",
+    "a593a1a3b04a96cf604aaac2774db8e0c629440ee338b2dbabab4d387d422069094792ae35b3c3e8cf4b52d25f3d5eb32fb548cf7e0592f3d330b0dfb259b2ad2f52f23562da23c9c3e73661e7e2e7014d51549feb84da949d152f2858a8e9088e2f08c214ef2fb7adb096081ccf16d308e3255b1215f523c9cee2302fb6fc47",
+    "bd04302d7a46e4eb56b149276fbd0fb28a09c7f15364ed057560f00d459f9af35a1f3a9a12bef9094d81eb59346775100308daa3a2eba34a318940b81eeb3c95df26f8d1f8616b3b03ace0109660387858355e8dc77d538f770560e3cedd3c7eb27ee8ae3b47f689ab631440dddec55154c136e0b8960785abec1c6f6684fef7",
+    "1b9ab7",
+    "af42e0a67e01c90b41ec348c1d1c90290f15e2cb64b553c873cfa2a189dd5424b627e9a1fe796173b1093121ac15aa73215a74c7cbb3632bd2b5dcc3ac91f756ac211ea272a71ae38fc3c8d1be2995d57489a996a72b2a6c30a0a1907efad840b6474ca8dfc3845903bbb703476056ef702f4aa2f1e499a31b18c657833556c0",
+    "341abd6a3f5a982e67247c8e9ccb080029619f39f4e177bd5d7de527a4142f0aab69fd1a1ddc847256a095f6629cb0d795464e4f5e1a9638e2f3dc2ae9239b46b0f3ba51d62e67b0bee932edfb8a79c502c049bbe09f9f8c3bf598a36fff7ded6f0ed62aa0fcbb47db5b24b9b1b51f81a5986191480a5a98b099290eb17ec2a7",
+    "1c3d",
+    "6790ae1e8a8bb756e2a59e05d0a232069a45e715afb1b74a43b808fd09aae26088ab530563d43a1a69947314d30a91d878629a9ae8e06a2c646cc955f14db470adbbf3d29470e73b82621d1ff9f864bd70fd709f682e00237aab3b854511662445942b09dad06e80e139ff6425a82922b3a192ac510b9e91d86e732d4efc4c16",
+    "e4251f5b3a4e4223d601de4a947138d996e19d4751c30b2c85bbdb8717871c7d77f34a446034b197a4c03133a7cfd8e4009722dcb2aa7439a0a83b33aca340f7e1cf5d3175718569eef1863453aaf823670bfcdf8e779259bc56e035f63f9d3519843ef94081991f52c3dbbb3fcffc337e05ae180ed19a0818c231e203fc7fc5",
+    "1f",
+    "b2470af0445ebeb6079ceb3f6bde95ec9a8afbc0cf961fcad48fb8e3ce3ec2aa87c03bd2a63b2e4683349626b349119d4bd5e041ac5b73b915ff60652bcf4f81c65ad2d7809e4d2388488d29e71938da2d0970d63f0626586ce5ba9aeb34933f132be114ef54afcd81aa6386b9e2d43d5e53d02f1e4d76e8cf978c6787dc09c7",
+    "537afdafd607f7d89f3ad75f971c4dbac57e178b305b816efd3c138cf40dae4c83e14101a46a907154d0f7ffadbc96a7d387963ed851c5e7e2b6ee5b97f9ed34b93359ed3e7c54d2521c339be1292d99b63fe89400a91989a03dc81c096b7cf8830acd899e1149451f61eaa6bcb16b8d1581fcfba1c27fbd6ae9b1e5b0c9accf",
+    "1",
+    "837cba2a37de1a140c931ecd8c5f8475729d3a4a8cefc776370181609d4f12f55ea22caf51bbfc470d522f6730f8cc5172dd205e18ff618c6c9d451c3fcd162290a7a9aa0e5d1bc6626faec23f7a5bff9bfa97360aa2d1aecc02456ba0fc03361aeb57a9274a50e50d92db8566c554c736d6f5ff12bebe02ebdb40336c99eed2",
+    "f8d5eb993495463ffa7e4f5b2d6a93dfed934c0d372ad18fcb8ac72171de53d662e0d08aa9e93fbbf571657e8d973938412611246770e30d94c54e94a27ef868e6f320fd56c7a2a878e2d1c86e588dbb18add441d7af5882f14d04043607b18efea0ac5fbc0530147db989f660bb35e8579ade0134b7e684ffb8a6d979f38d7b",
+    "4b1a5c88d9dd97023329c550f79e80db27de6a8c01c947e3eded5e1993c86af9ac2ce84573c909d768f7274d5aa9fedddbb292638d2b6cef74e2e5898c57c4bb86603d5a5edaae76c69201ffc03f0836a974a24c2f29b239ad6e7f74a36e34815c73b01b4c9109102515173e6b97ac41bf2fd67581133e397cc078039b3b3f3",
+    "2f7fca62a86b01d8d1c52905cf7c72e6ac02719008a28a0c0544dee062d60659b2dc19cfac0ee4acf2977a8d2949995aa0696365220edbe9377db74411ef782fdd1f7e0cbcaeab53c7b16c54783ef85ca6b52304f08bac5428fd60a0aa4f337b6132ccfcfa239942990917b6a10c863d19cf49bf4721c6035f99a664f5320ab3",
+    "11da471b41c41d85ed38b5758a008bb85877022865b38ba7671f33880ccc4675ecaff0dbb515abd2230b56f1b13fa3610c64671c3fa4007eb404806160759d5b498f04cd2bd8e7d16f3da9d6c85ad2313f73c35c33ad2fad26d410cd358e38a7272e8e3974b179d656c58e343772abc79b4c593bd5cde7c3d267bb440410bb",
+    "f8f61a0dabed724721fe11ab252d855ad3b4abd4d2c02610243d5fee4a797938840cd7eb66ff031baa574da17e19ec4f9660138638ef6ad7e64634dceea7acbebbfad032319521d1676d539af74db27e20f8dadb025a500bf80806377b9dd86925f5ce4408c5b8e86e6d6ca1ec87c511bfb7dd6bd52454311284fa0b27d39085",
+    "642a7ba9efcbb40194ec4c84a4fddcf909e617fc38c6f57bbc9107417f1e5348f1071bfe423f27c02463727e76192bc501ca627c4d62b15871506a48f4c632e7321a1aaf3e1fc46902369b81c84f31c82efd6fe56e034e4bf76b060b3dd979387890794d40e5010b6a94832b4bbcb142d28d4c2b07b08281b9e9da3fa658",
+    "41382a1999fe17f116a491842d4dcb010e7d3a0e5df3524fc3ac201cfe8f1e66e22d0a1c7a01d51c99d40a96b5bb43fc0a587b73d63cbb1cb3e27bfa65c8e1ecfa9b542859f14ace275179f28a31de7ad4c574435c3b44e98c539a9d452aaa88afb1201630e16776699915368c3246d9282c6ca61c2e560d37ca70263178c4ab",
+    "5ee63d6198aa13cbc04cb9d0afca1184435265c80589d9fc7a860296a2f848f6af271a51826f5aec8600aecfacca7ae77dbb753192e96e39d64b55378de081c0ec143d1f7a970f0fa58f9c6a502fdbac43338f327d6afd1007ced97ff9f04d462b0a3d04c4698f087e81c4333e61a528cb6f334750b0cf936d8f50b1b2",
+    "a387a5d4ede1af057813c36f824177ab9ba49573c8fc75535cf59456b49579c216317ef177bd5c9cfd60333758adfbbf1de18410f717deb245442d513c9fc220b0b97bc2f2b7f87b8ec2c9213ed504a02b4b05cc5410d77e42b5642a2d2adc75cfd97541fe4b6bb503a5a66a723ca96dc4a54d1706a733a24fa2d40ee561ec67",
+    "2d2104c2075f838ba2459385b62ef04a1bd7299c43961c5e5bdca834399a0d9fc78b438e1bd0c36d6f1cb4258c38ad5b33eb45cb6e1eda9584ebd1ff41639dbf88951818fce1a24ca2bd46e7fd360e9c5e1ca8fce2f9bf2542c3b56400b7542c2af8f88dee0f1e75f7f38b48c7b0d5e2b2214bd3a45dd5f80b2b9dfb",
+    "c8fc6ed6c2166b5dfda4b27ca2d873e2abd24fcd1a5f5a1f35ac739662683ea101023b626404c59bcb83ebba733896bb495c78978632173affe5e7448abdd4a02334ce846dcf2da56ca273a4546e8d1210d45c2bc3d31de97140818990a8ff45cca81def0751ad3fbe56a860414aa65af3353a769261c7092b89678b75c43f57",
+    "18debe001163e62e25c4ea1da90e33bf4ea3b033e2217becc4139e48211e37e1ae69c944a7d9033f9dafb5ee23adaf269f04df4a549a7f06db52cfc77c23b152756d65d509d200fea46e15496081397b7a7173c58e55eccc3e44ed0c3ee1777fa583719496027cc57a3dfccef44fcfe91ac362eea95326e294987af",
+    "c0d52590f1a676c4c73bc1323dda7728ed92572462c636729bf9e11b74290835eca37f52f36cbd106e166458ebb53682a8ee6997044ec4e18baa1f927ea800872df8de4cc204b739ceda5cdf921c85ae73db66dc3e77b932a481ee1539fdb535b8f985d809c0e48ebbb9e08a6e77d614413b233661e88905882e6f8604535e4f",
+    "22dcbdf1c390d7c55621df2b6d0af61e926791625cab8d0885b626fc4f06ff57e3b20434b7e5dbcfe06e69f3aca4c2c6e5d7f30f3daf1a099e9e9b021b463f967f2c07aeaa58f8efc846e8acd229636dbdb1b78a919f3e3ede678de3b72d316fa987ae6532a1ef2b42cdcb078fe9be433e54e20053fbff9c19b6d1",
+    "1b39ec330f186a0eb70d8189e38b1c6a23cd9e1151d7e8222cf7f31ff2320f6101e31c02d9aad829a5ab0e19e5701169a978a480db666877456515ceac515aad358693bde51f7734b1830c410adf6f268b2a54c690816205fa7b9f99ba63a4942a612625091fef12f827d4ff605e043f24950965fd6a45147eef2b7733b78521",
+    "7e0dbd6707b87cfd3825a5f40fc4a5638b0986c2ce9a3bb06298943683be87f335805dccc7574c1e751676aae1d89f1b86869afcad139452f2bebcf54dd6d1e9d57d4634e751b8f6fb1f7d9a11aa6ecb27ae1b5ae4fd1f9f0350c6d61db4f3d0173ce97abbe40402ace7d8a38f25e3e808c12edde75087edba2c",
+    "09023a0036cc7b78b6887a70f330216d670cc2801c9a07a7a6a3d3c20b45e9815ef46e9988cbca6e591b6e8a0a985e43aa26c8cb7dda7413572d9a47adb886632b6a95484c957cd7bf2058863832cc6189f84f963682cc955d21bfe2242634effb3d80fd04ab1ed11b935586eaa533fa03c4db0c981c5b7b5f873bd522b0c03b",
+    "1513bb3215d8436fbfb8503a6d77b788dd9d6e1be43dab812d2a4071e5cdef25d5fac80612a71e409facd994e2cc267b5cf0c7b7178e410474b6bf5a245fad0880dcd0296fa1d7553843af3e0fdaa61f8a8d7cdc70b62eb463fea9ed537206b6bc4db929dcb4410bf7a03478f0b627c5880892c354128460b17",
+    "602cfa0963963465ad06d9abaeef1c3b1646da6cb301f86d77639fe5ae12cde720d20097d4fa3c3e28ec8582cd43f7542ba2753b5b9b3171d5774f1e289b5d062708a2f0ef07f2a4a75a5cdfec0cdb723fe136986e9f1d73031f00cbc38177161e8e7e4bae2d683b663cc3bce3c27742d742acd9c5c8b45a91c814a4556d9f9b",
+    "93b201702f880c5552747fa2213eeae845c5bc78f874e6128e99f652ac7d985a1af64e075a56e5e9aec63c26e7ed6c28a66fcb0ca60c8f60a07f5511ff96c3d1512aaa1b5d3e4ccca3442020a3e5424225c82cb28cab078eb9908133bf225700f0855f4f6850d79232c969f65d6ab4f6a50125eba2db8069",
+    "760f46f133f88ce280a6cc7c2f59046e3feacffa4fb096f02c9411976e3990f8f3a224407c21378187599294e41175665f62a237f60ba3ece09a8c4100aba9de7a58238b9237f7ef258bb6c4697661d222e4a5257522d4223938f0f5172bf4de9f20f59859087c2c0e09c6eaef41d1e9950a282f32fff3d3cac868bc230a1349",
+    "4076f89ed28c58170311fb19f9b66fb139b2d803e968a801718046ecdd6752aebf714bd8f70047bef9ca6b1966c642836e1369b3d1db614c493411f64ed1c9b93163f1d2e7bd395243fc970a70f590473a6ff6ae4ce6026d0cba2642211eda03c8d279b016621161976a44e1dcdff190b5f0ec10b5b807",
+    "cc3282986076ab750b11f9821882ef582d179fea9a3b477b33bc6e4404f503fbc8bd8b529c4f08bb55745c34be34c8207c7848c15f9a6dce0397dea0ec12f8dea8c24ca8b9abebd48f6db9d61d581cd62f89354f991cab957b49e45c760da9a766df25b119532f29468560202f977ae42945315ee38a663b4594afd6a16d74d5",
+    "171687c58670370b44e37c0a7d1fd2f4a634b49b59ddc841fbd7d08386e38de7cd2f3f205e6e69fa87f380ce59a0b8ff06a29d5d98f9ee1514544ebf4cd5e7b5fc0537e48570de26a5d3f114da4547685787945fc6f72f1c74617d2ac679f0a538253374981a080a87c194941456b72694ce4f280b073",
+    "7a5159a0560e9855f630cbd24a702d0d46f863ebfa5746648e3847dd21a569767b6ed92bc16c31fb368d90bb471af933ba267633a5d15d5b0ad6d19a311ee37bb49cbcabe158ce6c45bcf3b1c32a66f4f665cb5a99427ee0348184154a0031fbbe7c24d7ccbdfc344382982b04cb063723b80714b3226bd4d5948bca404d9739",
+    "7767ba898173ad3c1c17b6ff4e11dd7a56d70604f5fcf03c683a4ac13460dc5b6f55a9bc31d110f5542a87d9df661e10fe7aa4ab3c1840d8546f4ee492fc77f57c85ed4b330a8053017aa4bcbf312633dc785f186cd9245e06f17270479591b9e057093fb98f328d5e179af0474db66423d72b38cfa6",
+    "62ec39b446389a145fc1aff70331c98464434a5ae9867bd9956a1758e9553d74195b4d2a8d6255d5a185ae87fe0f05d2e3dec2931e548e54c23bd2855795de1dbbde9e4dd1cf377ac49e8892a9485adcc390bb775299d559aaf8b2f4dfe2146f5a27f3ee6cb30d708903434b6ec599606301e68ff5aa34094d520b6ab6bed8a5",
+    "19ca00955469c3e1f49d298b3a9cc97810ff213aed6c8b8688fa60f70ce1c095195520f27e48cc94e94dd26d4f0d92968ae3268e4d8412aaead7913f5150f0958eef4bc410c7b8a8e523639cba2f3843db207c2f6513b7a30abf6934f6175ef96983e843442bd856b382bef21b1073e4551b6a13841",
+    "2628b8d86f1702bf1d8e688bea40c399ec271c57193764434f62d6b3c9094786640ecea814de6350f180fb809fd2c840d8b9f6233cca491fc5d8494937c05ec176602f04e9f19e891819034da91c221f777dadafe409ea51ac1a5a8cbc7743e64c1a42c3ca3ee59962bc4da4799c5b187ad008be4806d43d57c521f11d1fecab",
+    "41fa34bfdb4a3eaeeb3cdb9f94c679343a60902ea534ebe4088847f1089e6b0639488e64144a38e75cfe89044074e712b80b462b90221bac6287f26a55493c5608d33e59577a55c510743afa96230bfdb43b29163448a09b87fa2957b7781850b20a1fc9d1c6f945851c8a93161d2f80b3f348f2c",
+    "55a06049eff59f1fef9128d37b8ea1d1154e5c062e4d4568746909deff81c87ca19aa1675f040e181e2caf2780779048860e795db88dad416f9a2d3053c0e34770fc01afe05ca1507517259e4cc75ccdf124a0868a52f1f39dc4c9fb1c77cf05b1536afb52b3634c320e70a1d665e5c7ee0b58b4330128e4f4df0c48e0169883",
+    "d566677f29ea5468a793eec2bf4fa14291e43c2916135b839d7925f1ddc4ef8168eaa2cb2ec5d2c1b3b742c56e8e6838e6e34fecbd024ffc1851668d40be5df26a93287914d5906f66d1aa2285364849ed49765743a2b6ea5920d59fb1b37584f6460510039ac61d54fcd385db5e38701c61b8",
+    "42c06669c35815f0967825988a0afc7329c004c4c2fbbdc7d959bdb7fd897fe7a0379bbbc0b33ca753e2689fd1c22413177a857aa7a1aeb3d0306dc1de2b5c51f99255794ae436911c161e912b28b82342fc1f6cdf3124195123b8f37f6824ef14a1883fc0b9fc9e56a5987338f614d055dc4e29f28f31298b12bcc598eed217",
+    "33515209a9badf2dd66421e252cbd28cc0c05c3e59291403aa24d388cc8a1f181175f16cf0a827f1c542adee0c7818f90d147691ad79cf6e9730bdfa787c6299d72fa4ab69cac26100d0b408dd8081f83b544c34155a423e13d8f7ed54480acab3b28377160a2c1dc15e574b43b3bf1838844",
+    "f73b3be5e523db75e8d30834ed8297295041feb40119efdb67cd19e515bd59938cd6a37226cdd0324379991e8582add866cd8742802ea571caf76367d8860b238e4073086152355bc41f3fc0f5ec2e60f769843e473db0004f6229da4f9524f43f9c160ab64a5c556781a7d60363a4de79b39984e87784aa149fa320d8a01405",
+    "2714a1bf5b737388ec33f05dc7a334c9531bdd34373ab830fd36c3e495df4d6bf24a72aed0c1e21fb657204c7a592854e02282113a470fb501c0695c4f4de29d584437acd2dd4d615a48c5b1abc3f0071f910ad57c54f32ee035b4fbc87930b8b4a70eff1935d0c767433e28ebfee620177f",
+    "428ef81d92477f3fc11c034a63b6b559a1aa393ff2480fad703ec84f86bf69c62921b74f5f2128cddd276ec483cb166a1f878ace6af57ab0772ea70da06d3a3cd135417907bc23ee3b166f73d89f6b9e3e112b8de3a5df1ac0910647a43a987d7f8da35c2be26f907fdf687b8b95fcf3b1c9c31cf77505ccaddb8c88ee4b16d3",
+    "17a39a3e4d57b4e9745b51b059a492348d480e74be1a6218454b9a45eda2578d228b038c4524a25d46a0937755281768c78270336f7585e1ae119fe8c912862208a06b7366b89bfc152dadbe6ab7354c55640ab474ad7b98835656a399eb40b6960826cc79bfe0f7f36489467570892a6bb",
+    "ab858ef08720dbab4b849bbc2efdadb3ce93df66d61f214bdbd648865ed86a1cc53919cd8814345ffb64385585e1db9e4a3dfbd6060783c5d42f2b623da830394e3a048f5583d11a2f6376ef7391432c7ab521b1e3c64ff4d0239f55cc79a4f7ab2d57649ee0292bf9a0324bfc4a3839c2b3fbce5a76b1c4df480935a03eb6c9",
+    "4e6e0a886ef565c3083b4bd02723c0f01340841bdc771d3438abe928eac5ba27eaaac77d40404e2837cfb5e5cf09b20fba4b71cdc072a1cccf4f5de118f8d82d33b6ed022f37dce593858a6c16383f6ed04252a83aa82b772ec262913072594afef883f7ecb47a190d4de28d19fa9ede3",
+    "e157dabd8cddfd541e73b6bd1700cc781c227be90e9724f76d78dd096d4d9aac0b50aad1eea232763b79a97bada46d804dd98d09049ff3cfbfe2db0bc2f5af440aa6ed1024a852d695a5acf51489286fd77e94b82833b4627cca21c67a33bcbd96f534d1b51d74ba728bc171a93d03f346599e1853da40f3015e0938d8dfa329",
+    "c068c465e8969a850cad2d3da7981d8b868e9dd3af96e5471d2218b5e7e2cefd326a25c41a6b10bd188c47b0d7af2ee07ccb928fff4b15d282d9ac95134bd728b2bc23ff042365586368df7effe61b91f64e7ea18671bdbfaf4a62d49b3c97552d370ad87b130b7bbb669b91c384909",
+    "8ac4c55976fb37e2b37db3d8fa2f6736b48dd9dacb3dae238854fcabfaa7be3d5d96f2749f9c6ae954a492c37c118f6302d171945969596138c1666c94b15694d3bc8b70ab6314f1fef1e1e2c59dceffe99208dd86ac4553499feaa03f11eeb9aa3d54bfedb0c381543e76bd38b4175ef7cbffbdd6ee85177e384845a162872b",
+    "8f7cdd916d323d486e763ad5fccff15f42192fe41811f075b5a0ac047e4c46c98dccd03df36d7cd74a40bd4cbb1cc07b02c55f1f9992f161a044dbfe438eea335c1570aade159d4a1d46bfc47f3e76ba651e6554dd115774860c7667e95b24db068e3e4f5414acad3085f1c9888c6",
+    "2395c7412604c60c9c29a23d4d19f80a293403399387315d9a14760a4a17c58f78e2081a6aa2b33300539bf30329098a6f5eb2d8e00d7e8b6cb961813f62b844997e04c87c78af91879a381d895b1cdc9e3383418cc1b4b0c8dff7b9dc27cf874a5023ce9fdd4c51657b6caa91e8b328ceb3c9e1391acde777d78b398b43c9e5",
+    "fbc1ef544d0d158727ed815f0e914edb0ca93f4c2258d583bbd4b2929fd5aecee7cc91d69e06796ece1ed91aeb8b42723c457a2722d692d888c763474b7b265e4bf6bb6a09b3a2938e2bb31772950950581ec99667f22b1c4e4884acaa884eec56909b97223fc2b8fe897543c21",
+    "602edda64214b70ca923f5b8dca628238d51bc64cc3d84e1f11ed6d5e5c909b75a9f47480c1d78a4f1e2de78155f50d49c680d74c6bd0667d3c5b93afa068b38a6bbcb3e02b78f4fd3c62962fb48b08966ad68e54d88bdb33d4565e6d4877bf8c258f18f96db559899f87d394bfa0d98d3443ff8b96117d396fa07629dc1739d",
+    "3ca93650ee23a9ef62e2331e1bdb00adfa3910ab39eae28783644ec81c7ff2e873137a4d22993059dc6bddaa40cd34c49ae5d0c3362641771c7df05132b13f6ab107756e61b655cce83b3456fc8f13ae5311d60c2893540c9e1835796ddaa5c4dc5d764c4bfee64aff29ca6afe",
+    "91f478729dcd1b916b5215b1a11c7c6b323be980ef4bf8e48524f666a5b9ada8a0dfc76d4679e5ff5b1559baa120f52db253cc3133ec77e1acff4a954424d3079be7a40e48f0ed1d60ebf2ef441dfe15a718a3fa3aa990d301d233d42e286fe15b68e680c9ddfa9d5ad7ea834dc6f7c82cc835b98c953d7e3c10dea50c7cf71f",
+    "45693f984161efac953f71395d80c94e614edf2fa7928f680a5f646e9f2f25f3a24429daaad5501ab35cbbd33fa092ab09f9afef57c137124b29a083b34b772fd41916785c84f87296f4325ac01e3a174cb7e25b69b785904f76e6e61bd0bbc449c7f21ee62d70c7eef838e5e",
+    "3675de038f85b05e6da1aacd5b311ea177442ba3e2c0ee6f015820206f3ff6799edf8888bad0cfbd88051df5e81ffce58258c3a3dce95eeb5458d9316d166f5f40c1722417cbef49d52dddcae2e6943208de2c778eb3d090a9d7e939e80b1509f0f6056412934676278c9a471157ce05b439cfae0450210e51cf9b59f43dfa47",
+    "6f0107b6cc5531560662d1719316f3c6cfe90c3fa75949612d8d98157192bffd7f537242973deb1bf2bb08a299799efeae14bb593554fba1e9da6662782206e64bdd93138cfe751d5f4e9ce85bb1112f31f2c19435e72aa1346176705ac233e16a122977779e69049c7770d",
+    "6b3da33c2749d07e51b7b9a5b45f38794b98fea2f411bcb746f32f4fac829281fe8d10e9e7f12896172a872ddfe8a841e7d2e7c9e1ab115d19d5ff3e312bf98f96cf8c3d11c328b60e25217938f8c6db4961952f6604b995949674007b3d80477cc795d6454cac0b6ffc392ee51ed41826d3dd77f4f6a99cb23b5031b915edbb",
+    "105e2c06ff89530672065ed498cb468adc3de3b158c9ec76fa5d82d1562d3debf0336727cc13ebe14f15942d5342ffbcb13a29ac1c9893d071db23ebcaded47a05588c42a159ba4e9db2786095fee80ff783c1fab4ffc054d601212bd8656fc74d00dbcb6d47531d077c96",
+    "31581564eb16e4e088fcfb8a51d86f24ba228e7d5497c37e51c8760a729b3a6c03dfae3184b3a9be8fdc14c74db27f0e2348a5ec51572467283b277bbb7faf9879b10097d48b0576399a67362f05fc1f9dd9f08cd3c67af1f588be223a68cae92b8af6ce48a7c6ee9aa5c8dd8be0dd48be99abcd8f3a0ee38e367d90a175c3bd",
+    "2d06cf131f1d3737fa21ca1e0ae61c318753debb6e57bb6e6838ed541777a269bb389ced294286684a08160583ad049adf6ffb4fdf8cf20c7be5e42ca7d75eb6ac0341327c8240040a614957c89c4999d1d5d7ca6cb7ea630ce4e616b15369999cd5db9220df0908b444",
+    "595cd2c0e64c0986113f815ba9511bdc81857afbcaf8943a7135a03520cdce286f7405edd879d54bad7377cb5a6838f046345b99a99201ab934787b0e17bd97345222125c3c17377c85c2d7ef366ff55c771649eb8293f1cf2abf97d19ded822fbe4f4cccfb3d24d43d4228d1e6b9e0ad065a7a09e4929a807d060f5a5190b13",
+    "3a4a6cd97619fc52d2c35e26e499d13efa000464cbb437fc8ef0fba49c065de4808ec5bdf7f09e1d85ffcf2a2766141490d8b6af473bf5308bb4a3698d6991bc8e121fec41d45b0a31037af518a5bab280f81c61eaac6558c726015a3b90a305ff9cb9c5560169edb2",
+    "036eb2aa06ecde0e14b83417eae0646c504033e46fc49579cc0c0c57fc5f8e528047ed39776a48cc6082bcc6cfa84fc3bdcf1a88ee651df4b18f3fe4440a88e1299fd5e6bde9cafee015cf031c6d1bb4353da17484a8346e9bdb806b015fb05ea89a22fd4110287c3b69e1057940a3130f7f10d7dc3001ddb6b3b9b0bc0dfd29",
+    "15add85982c6b054d93966e53d63bb2eb9706b0342e7848854afbb704cc3493fc654df7ab0a45d23c807d4a4ae23e2a6de1f83027e7b066d350a356423e43c23e82121cb755fab8300271c9a5a629eec628379a8f8d3994f5c3aba4a0b41e0d0b704f65a1697d5692",
+    "51154cd08a3f0c3accf3dfae8ce3a0ba027d277cad740062a7af1de6a3cb159be57aca1816d39afce216f2d2fe6c1e4ff9b47ae57d1a7998c179c3098d60d0a15d3fb08337d1f4793bff708803de42705a7690e63bc54585d43414a55e8d577641d7d108cf6f4d72e9bed692b398084eea243b7d80e2b5458e32d157c0b9252f",
+    "5ea819f46b1a5f9a660013dcaaabf84d47ae3aea6c0990af10418c25238e0444f9fe9cd0eb716b549ea95dadd79345be0a2e589a6dee9940283e97ced83ba5beaad99b3532d2f009b94dff8e56f886e5c1c566fd0c5b8895158089ec52ea333a437831a45e5f6d0",
+    "cc40d4ca697c53774f6ac309b140882097644fdf6d0d35db280af476feea2a5738c35f9e95670b3623f2fb68325ad9f96eec3c47ea5eb753dff9a4dc24d010706cd0a7b607dd311bdd5daa6e18de82a013165c00b6c1c17c55b0355e4cd1d649b934cc1a308124b260c43e558ec6a928f3b6cfa4fe34ca23513d91ce46f51355",
+    "249e8c4d23efdbaa7b7b642172631f4cd49ebd9cdf5a66e60d7e70d9d29ea0bb66a0ed295497126b7b816bbb4ee1136c410e252600bab03484f310e6c94602d075c6cd3f6723abb9440e48162567e4bbccc2d1ad9f9d054b3418bb56a870234a24df6866dbea37",
+    "cba7d9ef4f53b747679db01e863758f52023e1d1cd4d55c3e9c20d3e3005e8c1021c7e60e9d2538a3540171a65f2c675d85b5e74a17b440f9a7e5a13328da4440d79492224997921885d77b6d303e08f5c5331345c83c90fb26e8e75071f0515c189bdb48a8f5eff35252ef7d67dda75737f1ec4f4251883c7799b4a514858dd",
+    "a6ab686b6da0bdc396c4775614abb1ea9290ce11ec0dd4f0400dadb370b7c3e200a1204042725be21dbd626f1659dfc60c1a0bc294c5ef9c95b1e6f9b2481c236a2e15285f326a6067f06b130fe254e41b3c98b353a93da3a7fd6fe8f43f4dc21213f01354e",
+    "31bb080173a1b4d2894e6c08ed24b4062e266c080dd83884f87de4b190000683059c8a34ab714350cc206bdf914cde40863a60c7203f274f83e2dde63faa15ad652df140547abba25c16b492e715e87faada280f02e8dc24c814d8dcca35ecf0d1c08a72d7b52cd54031bf2bac2221e247182584793a784379a0d549c81b4e71",
+    "34ecd2a618c75fe8764fab003751db2910f8b0ffefaacc7ced6e425c5854a09df39aa8df570fbab3b1acd08a7073797330d0927948f7fece257af7a750bc2a32f5e7f451c9fd3753f5224c4b64b1b5dc9766817d29192a9fedb98437606514472182eb0b8f",
+    "2220389e8ce6c2b7bbf474cb9f1e336a997b0d07c19b0e9a7f4e18fe9b9a125e9882a6c09ae0faf64726a451af10da549a3a9b3eee82b4eb949cd0f272ff365a3a9866514b7df90347021b1e013a690d61e6e279d840e68ea1d68372097504bdf6ef92799da30eb4b0be7dfdd05dcb30831a04f194e7822beb36be4125f9799b",
+    "b694e95f0abf6c20c287fd8cf9fce84a66e8c85a47412d3b0ed0522ba1b2ee52a650d30dad293df6a96683f85319d8ea1484758125f10da978e8050591562fa019f77b56bb506ba2e85c48de0757e574ed4b7373c26eb01d3a7a4bacec58f164dc8908e0",
+    "8c6a853c7bcde0e5551d9a75eff9e9dfa270eed7446a461587d4c6028e74cfc0f535e870882778840a4f78c04f859fe8635004cf11a2ba3b0d779627d5a232a97b668de1dc5913399adb0c529a09e3071fea465509d5c0ba598aa3fbfc110c98a87d219f41c72496d6c75896d5ce616a2f8bcbaa3e1899995414bb4408d7be6d",
+    "3945ce49b1c6033e895330d70f1002f0e34885eabe71afb65aa43aada55fb76f3ea5d9be17c634486aebb859c05cbb946922718e6424e3f83dd6faed7c95cd802ac0209e52c4686b4c7620093ddc615ebcfbdd14ae06c2669c124d093c21db3e872da58",
+    "ab4b9438788b58767602555abaa37e6b8fe7bfd8ce110141ec23735e99ef3927ab09aab8e01dc29796948768db076fa9ed8d4e03a8b9763f83de4f548e38db8a5d7b42616fb3b8fa9665e33417d09a960785c22115b6dd59b435b1a6993ab2207a0661231bdb3b8b18e1eb59d05ab9c0b113f59ea465ad68a9669fa96aa70a27",
+    "f03bea81a5ed1330df7c058f0f8013183b191d819accc88e02ef6125d8d59e13d62e1dff148870b3cde8a36180e0485f3c6ff291349f598ae69f9956437f0a5689d112c121d67b052abc5a440456d1a51a1181900aefb4c236932f5c6854f8dd6a069",
+    "b2fdc829d75037e1c714dbccc8236909a66a8e7c392f78e5ffc85acd487f9bc8403c0a3d52c0b553377f2086f1b70928c05b2dbd85eb620f9fc08bd044a4cbb95387d855b3c80f28b291a2e1f5a21c6a6a1994970d1d753a51e460da269bb78bfdbc4c18435fb8b9b8d48c49837427582f6d66e127c5ea7b489efaa5c7547921",
+    "168fa5ed9301fd77653fbee2c06ab431cb9fc4ca7ca6731e7a6dfd748ccb4a2edabf288a19cb5ff035e0153e5a702262d325d17e0be2253d01a17be87662ada5d946cda3cd3538aaec8ddd524c15e66a3382a04901c3642276737a07cda42b4589c6",
+    "4f514b65f2e91193fc45edbb854d2c75b676f3484a621effce2e2b1369bf7daada89d4979b9308777b1f332fddaefbc77fe528bfec59f962803f08cc805eaf47fc0ee3e1da9d594cc5bce9990e332b05b11a7688f8f5994898de6869eaa7568f33c8ea18c1519fba60cd4e83583bf286085a609731aa9d309f7832916e2defb1",
+    "18d7a51edcd4cee61b015c73be252880bec4122491456dabe6685c65866aa350eb380459ff8e9825f6338ace3d3c06666ced00a90fc88c5a915992e6fe2e0de40cee5c38299bb8336df60123d102e63a2247b6db1b01aac4407a936a72dc164190",
+    "71e8eb4a4db89b3a90e7e0979a8e9c3993b909e673f8492d2010e3765152bce2fb06f1dd391890ff46aa50cada8d7de2f3decb4d64c5a55446d0944b1f8a815853c1bfb4cf8969292c0b46230a309340d92b76350b5deddc8625c7bfbd79168a7237fe01598420b234d415da69e89206f66d7019040a60cf5658b2ab0ec7cceb",
+    "e9e1683089b6c43636754cb4e15aa6b915b75bded1c102fc31e3228ad8b889601c562c0197f70854463257859f8f7d4d903f61b9794ac59a175870ad486f4e5fe74751da10ca2a2b68eb3a500e4c824c7f7d0d2ff6df96feeb3446fde3a9ea45",
+    "dc727951ac1d5445a4d4674309bbcd03450f0d8f24e61ec7939b424c29567b348ff8f2720e70a11aa89edc27a1e0d9cb239e41c65790e20d5667fef07245acd62fba7b127f2c729c6b21944833bf084702c28de20d0961040b4c3daecc6cdad95b109cac1edf8b7102b07a9417c25c63e254c7d446259abc6a52de900bb91205",
+    "1f7e07cf2f7b8770b7f4ad3658a34ae33c80718b671655123cf76bae6e96642740ede4ac6998db9c67d1b826f7c2f6ebbf13e2939adeacd96b164c75ae112184c24a9f979f0b8c7678653abc82fd48ceac2e611debb5d44f96a0a471b62dc2f",
+    "d1043ee4b6d9a1942b61db0fec84bea9b1e0fa7aef55e09b0c0e69b66e4624d62bc5522de56478bbb7a198d2b1823b18fbb672c88efbc4ead8280ee96783445a1700cc94bbc554d41c3b1c4936e5ae0cb78c2873470548fcc2a96303f00313c4050b71fe8b0f778429c9595ecc8dd822f4764e9421f6188a43e74704135345b7",
+    "1185ce5c5c134ac59562076078b75a4c84c9b91cdd61ab98e1202f5d5d03cb81bb7bacff664db403994818923e56cf4bd276af6b6ee45ecd43f9bf9ee3dfe6df927450af6043ad32ad20a0669ea99e780d386e34961b853843e040bcce8333",
+    "8413f5a66799e49aeceafcbfa48e505173f9a7ca057623158b3132260324e550a541743820bcfef641c9bcadbbd8e46879345c1457ccf248267000ac548f1f8dcebd16d457083abad5094998872b4d77620a1bbf8eb50762cfc2da99b1bad0504082ad0e951539d15af22a9e5d91e7b8d41419701f6c6c883197fb6a0b9936d5",
+    "4708160a55efeb3712300794e4dfaf71f257eab1d4417c8f8aa30477bc3c720b8516b6cfcd7065d3d5ecbd016700b4506c93e6d1a2490f6334e1f527d1172584b68167c99d2801449195ed2285a93cc4e7c18122675326e4cb574fcec744",
+    "332ab332aee54d794270d4bf3961fa321292ca5310fb91af7f7971b3376811647ff0ed1ee7386f093007a930046f07536062f7b7b37fcb1b5f881f69a1067bd8638d9ce278931ff9d70eb20d5f91bfebd36f7c3071f215f847e0f051b5ee861595c6f583bd3a88806981f2b936d08927084b9d1a712226c62b1b1064cc177a8f",
+    "67fc1661b505f827e0ed68c7c3b95f4832506705c4265df9f59ba3c9392a53921e07892e01165355b603f5b9389e931eaf53b8350fca6dfac18c966bc67e1850d4144fc535dfac6afc0ae0927c60d2039b91de000acc2f4faac05edd8a",
+    "1822d0be05d91bfc5b874b1c91ae2f549197fdb6e633d099530057eb52b375c117bcf8467ff91fcef55eb6c3fbdc9e38a334c483cad0a101c9c3a3ccdddb51ca020bae80b9fa68b26a8cbd7411f667d10cc47b05e5311d10ae7ba057d6d9502a8f929d4114184f4d0b30bd93f4986a046dd5869e3ce2ef2f9e8989ba1551743b",
+    "1bcbe08ec29f2f85a9cfa4e7425f08312e260c4a80c1a3bab2bbdf4fe79d898e633da862fc6f65695509ca69ad9abf7969e0695e3b4a27ff14f6ff23ef9a395852ae676bac134ddfe012b60e80f54ec05e6cbe24e9611f193f6436f7c",
+    "539d9c0e9046f56bb92f5b55ebd62f3917d13bd169cbc8d09d3603e0ce46b7ac1e17bfcfc8f0722b21c94dd26cfab7e82553115bd7ecb877c01e9c1b9ef13454e75437b0a32ab61f19541e2bd31690259a8e2b38ed1e03a29fd56a91ebec7098319e9881d38cc03015a45c57c59dc1d15df02609b786dd1204227e9f41348669",
+    "1e7b1cad006f15197e0e1689ab4057cb9ca04927ab41885f06969c5c6340013da5cad152c99a19a492f7003afc92800e3085bf8d6f040e748c6fe82f59b6659f57dd95f3ce19f18ca5d969fdc26f00b60d81d7c7bfd5c20db939457",
+    "0f924f429a811baffeb525b36d5f12295524efe0d6e71253fc99f551be627a9f407c269d86f08b85f8be0564b5c7176b82dc770d12ef43c12baa3f673faa2c59124317aa5e888ce60a3edfe4c8cc489e8ab43b34a5052ee6e948011abd7e21710037e8377042f81211c5b3ae24ce34ff05eb2bbd29ad222a855ce2edf162a939",
+    "4e1bd0b20f9a7a4a5301e23273a5af425443cdfe8998c2b970354223741846de4f180f9cb8d1e1872959d9253f5785ce0cca184021f235fb42d1a4f681d05b4892b5fd78707b82dd52e6bcfe743488e0afacdc6d23712caaaeea8",
+    "05671b6ca601f48ba70008aade94ca64e2e4d89f88a63b83ffe97f3bd98bbd887b5948fc365d13ba4e28c3a7576e97fb1bcdb8b32e292aa463ca77ee16dcdda624dfb8abc90b24e48565df4f106924cbc48317a94e7f124e58a569a987ebd7f267dcc4518b2df37e9118a1a3eafcf4e50645c2a334b8922457316f2ca37cf041",
+    "9f49a77a55d7eff870bb57fe00dff9b5070e7bd391a0cf29fcec56f2b4d93d975eed5612b56e7efc03d0fe5d983b85cc20ca7e8d15073d26054e4f834fd82967a50d00ec4fb60cfa124c6d06b887c16d0a90dbfaf77c553a6f6",
+    "3930f1b8f18a7aa68c21e57fd1939cb95d3310409b1c977f74e0045c1b5d88a3700c4484058d923cce52bddcb2ecb49048967f6481780ccb976636f1cfef62768649e1199db36725d2f951a1ceedfb4546709f72950322cea2cc9c41a96f9a1f7c3525557d280b876defc1901b3ab1afc1048716e0adcd7d4ecfc9ad2bdd7683",
+    "4e68ea05e5e38bec7473deb746128dc560303795407e47237a8f8e3d8600102130dfa8fb34cc11d62905f1d19a7215359328a257932a59bfd6d103a2dc6d24c812e1dc243ca7c1868db0e721758b2ad406172aa395f525cdea",
+    "f5dbcd2fbe50a5e88fb18b7e2071062d019e95cfa857188b3131b83c27c78f47df5a9e6307d66e848a247265fc2216e94bc81e53ec824bcadec7ee16ae33c35d58e0768d27071fe6f3e754c9234e75c5bd838af211e4583a58714374d69f3d279dd972927a0ce520921d79536aecfdee003cb710208ba0e8b0531f665e4932f3",
+    "e06131cf60dd49814087d371ada12be66b94ae7eb86b7fcf191dc71640f74410fea07acfd155f6ea2cc3b92de2e4d1f05a111373c670f4b40fec97463dcd3a75c50d82797d34a02adbf24308eec8daa4dbe2741c5b84efe9",
+    "5484e897ffffb4f9edfa59826b851df699ff0299351d64ee4f3a82152b906da72c5fa822c351b0cfb34a4c80c621c1ef015e4ea8efe32bf27f0d16cef9fa115d27c77c505be5ca563ec86bc0169379278551844f97c67d9b20c3975587652016b0f8bcc1572ea1ca9f1ee2c14ef50a36e31243b56aa7da2515f1290d0b2b83f9",
+    "74ea86ceba36f20d65add7b1dd8353372821be9d66fe9019b2634a6b5799cebe92f1475165ff91933e72ed8d39c91ef8da5c5999c9d9ae8bc627f831c85df5bf147fb2b2127d56fddef93d885faa63fcdf6e1eacef1e8e",
+    "db40c51f6b6d6d39af092edb4dbed93b58b733cdb124deea69af5182a6644d0c757563dc5fba4673b09a72dea10c31b09e7701815694a27ecb5b6e6314f3794fe1b625860ea83887500abfa0429ddce3e0f3881ab0d2c46540ac4980cb81416ee4275d85d1912742ae641afcef71a45cd44a07e1626f14005e25ccaa50769f63",
+    "3c3e369b06d48a65c30f57102f39d245c579e5abeae2eed910c472861f931c89c906170fb3eb70f4fd973b524fcbfaa2efbd9e36726c1c973596cdc915af33b196943e7d21d00027d4b8b2a65309e7a3201e3a29691a4",
+    "b1734c85f0efc075be2a1e1625ec37a24b06f854e8cbd9b32e59119a4510ff1f22e1d82d5155f119384961564b2a5ca0bf1aef2dd7a418b1f78632856b5ba2b83164c34a498bf392363cbfcde99b188458aebdd3a6a77a10fa50a46681c8dca86fa65f559361baf13272a6097a68d2e704782ea0866ac6561d82d95e3fba68b1",
+    "b00e5f0d7165fb104e20cd0384798d30e402c855e23c601c9905583a58dcd5e601dedd698f50e2937f8d3f0ad9ad2a8862697df2c106757d2c59be2e2505ef8008470a9304716ef7a3d2b0371969c80f286dd8efbb7",
+    "ae3349af28672ec0ecba5e91149b9842e19bc7bcaff3f51bc22363f2917aa389be0198134534a8580643a67438346b6577897d2b1f211dcbaacd5bd9382db7e684f134acf580a87bd85a44272f8216be7ba228ca74eb4f138c6beee902a8c69ed24d381234ce698f22d3581bc3ca5868c7ea48a5167d801e39fcb2cb84d2bc09",
+    "150b8043f2e1f7858cbb6676a659748fe069fd046dd698067fa5e5296e07a04257b4f6014710dc64c0c8efa05d60530a201572a60d2046e28277d6b01f79b71d8acb6f06041cf227c7a4a27b7d169fdee112be4528",
+    "39e9c04ca94c7b0c018fcd1e995e39cdcefb3921adb1587cee2c76bf841373aa1f4848657a5965466c4033b70faddd25899ea4c64b30842303184f40050d76754042070582ea72bd46f6ba81985d102c3a7851637769e41656d767fba29498edbeb7137f6c66cf098e6180323051d525cf1191e5ad0921a65e181003bf58170b",
+    "1438d88e6fa5afe78af1735a53f1849e11076c779ae96eea19e81bdc38930e95ccb49e41273a9752ef17e0505c291ddb70790a183f5c65d62f8cbefa2894c14324f336257f35b0c609fb8a7fab93f1c8808ae959a",
+    "f3d1193309e9fffe56b757a00e08c4e3fb22acc99e2ece8bd128a8a9cd5d8dc90262f91a9d78f749597ce9e9ebd7c220dff88817a3b59eb387303365defac4bb59d6577692a485ba0e55d4ebfde5990896ceec508041f60624303e70da76bc4edeaeae16026df827b3ae8e5e20a4d5bea84218a122dd30d866b716b2532b63cf",
+    "e2f1957dedfcab3dd6b06ff4717ef46de47b48a81c237aedc7d237255954c90280dbd25c71ed001893f68283fd38a24366635be07a13c24da06290b800051d6eb3824ad590f0e9b38f5ad02d310afcb62f1ec9",
+    "075c010d616213c26c288647dbdbaedcfa4989cc072166534fe6a56ec7e21f1cd76f2f5d3809ac5e736559b9f23dbf8f59f9c621c9d3e295827e13cf3834f312a3dbefa0ceaee651862c9009d8a5fd9741c9ebcb2f98c55560fea4e5d0e1d26a981c0d9c09de61a012a09f7694c234dc08277fd40e368d63ca2770ddd3b2588b",
+    "39d9683d26682ab6789d7adc854be6df53eb6dd353d51911f76c3a1df9183d65ddb381e04a98e60684129786ed57bc84c5da24145127ad0cfabe1969baa0159a64490b62ccd00fa7627377e505c3e64b9a29a",
+    "bc6756a8ed1a3b7b8b97926359b4e0864eda980fd6c3322b2407fca07f73d0c49066b86572540954697d120c9beaa6b4306c307754a80b60aa2910fd2fe3d0ae5e1fbc859f1b3f3e41f28895a4ae37af1258b6c5b1886e7da316bf43dec1f77ec6c0ce9aa30ddd5a9550d41ba7370b0f95de0c14cf29e9bcd55ddda8af9a46df",
+    "715542d95f13423b2e132ed0718c5c586ec49d35bca1930816c1426137a2f1abccafb7890a8f421504643acfdae06102965e716e4948039b6978533d525e32015da99149972cfba15d88b663cd5daf4cb8c",
+    "bab8a4edcbd98e7556f1fe2b2b96763ca586e7cda67e3a65c407242a07ef2adf2a04f4d53469b1d09fb3094972d394c8b79d55b093d5ec1462e439e718352f4c789985e588ec51a9a900ebb02fb3636ca3770e52813339e4a2bcb9ae07b7ce0f3b574d3a4a2f531b43fa91c3960b4717e4b6d9c26750927e990a0ed7d59b939f",
+    "5ac5ee671e896355e2071564b865ede2675d233fde3d90e99b868b0cb51f81c59806ea27a05c12810834018192ea410a7e68a445f4ae8ccca59dcf3744554cb3ff1dae8f6bcd9fff5f608e5a3f8e1ce0e",
+    "4fdb9cf27954d741d1d119ce55431e16479c931c5938be4ed364edd5cc8516eaf82a8e72dfd6c4a599ec02fc102cb264119f5ee5629f64cd4aebd92981b9e3c7b06af3d4cd15992744e102a60c8137ea12c8ff2f263b85ad2f74d7887b4fa4b0af665624cff88d0dc254240faae2d0bf8f88f1d913139c7d009d7c30b24c33dd",
+    "a5c618ce6abc3830fc2d777004f80d798d3c13b7213802640a08da1c91ee232f7856983f91ccc2526707141194074f878a5af44608aa8e56b6091f45cec80eac89ea474a95d68c1539facdb3939affee",
+    "20c778d8a17d1081cd267ca0431fb8c4b398f1ba5259373b43be59b8f9f1ecffbacaba4f5483e7e300da734a5e770385e034bd999b5295005efbdd1b2cb10c826c174cb26bc591465e3bec14c6cd24a6050a87a8c92e0cf3a87b4814438896ed4a943e9caa7d4ac6870f728d4ef85299fbb1eb54c38bfa92e90e3f410b0b1afd",
+    "138490ea732151f7839abe5695004bba957548d43d2a559722eaa2ba98be288b47a91bc22f27b707c508bbab7ab413b3d3521f3ca9c2fe09b23a8f0000b0eaf3e18b624efbf5fa884a292c87dcb3a1f",
+    "2dce51ff3e0ba3ff95c37041aae4beb5dbc1e025d38e7e12153486b7d06111ab7b5a64d3607c3ec5c3737cbbf96d0c742bc93266ea14b5f8630955966c5bda65c6c37aab12189c4907194ab95dddcec62347a724b4b5745a696b85d20ed2ba9815dc183eb6c843234ce91b185380c945fbc482871fe8f8fbe41e268db0c73bf9",
+    "1aed2861d6018480d4bc91b14b33cad08f1b4f92a035b04f4627bfd6fb82a805307ebe7bfb3b5a2e2b3edfb1aea55b825fbf8e4c3a9f33419d0799117f520aba28060f33129a2b22ef221efc02a43",
+    "24f2481167cdd912bbf13bb9238d1c294ea4901ec2b491984a0d965c26e5aa9a2e1ba33e288997cde0d7131d038fc5263ff9cf563eda565653f28da7ffafa10ba852a492161c64bc2c78c281b4d45b254fccf9fc4fae692c0a4c6fbd691394308033bf1a8ec414f728bb2d941b64cd3369e2233cee858598adcb1b8b938510c1",
+    "d7c18b244969f82ebbcc4210b92b6775e546436a97ebbcb5383c64b60a04d4d2a491de3590eb334bce98e393cd8ec19c80967fd443617e076683a10542e9bef6e502039a111b4f2bb573ebcf170",
+    "007a04b3c405a12fd7b1ae9d331fb3accd0ea78601bafbdb88b16768d8a19863faed26b44272090ac11532c8d2a39110e4d66798be1f477b15736934cbff64bf16cdf621e5d58a5f4a1806df330abee39ea2b677fbf831ed1c7012ee44a7df8606c60af36b758bf38a533ff762bf2f7e3807ee10e35ce8f92a751fc4672a96fb",
+    "65dacae918e35e597add19f8054b3ab1081b3d76bd2d197f10408680c066b7b9573d3f8cb24c2f8e6f81a647c0cae70ec0b5faca11b1a6a19d8c83551d75fc2cefa2a40576d2022c647f2e139",
+    "9a03d150779c5786b37f5fca63c074402bd7242100cd24e4ef2e0b357890446ad7b55a3a3969c3eed20e7076d11d745ec3d16bd0129802bf2cbd8411865f9af0e7bb7dcf77fc02d20cb16bd6b3dca3fb07a2e6ba6cb31d45bc9bbe3100072f9c1a3b670f64f22634adfb9954db1591baa61c079799b438e1b76b5ba60ce27139",
+    "2b02862141a8e903ebefe2dd6a8fe2178d6a2698a7e0b59eac7d54a8e1ec3f2d27eb4fdf8f0acaa9a8c8bd3ad1d81125e86d21de6bbc02e5dfe190ea4ea07c70ca6d7e31a55fba39de53e4f1",
+    "ac08e812f17594ce9b0e94b3b7b849c14196253e39e1b0539a76ddc3c0ccbd6d230b4ff062f700712e50c50040861226d650c87c8728085f04c750d12b19af6d2e613f2f05bfa5de392c3747b33bc139112274c2c1603558e78f57f22b0e6c8a8f61b70de543ac44c98db2e4ebb5710f702d5fd23d26733639b7ca18ac497b7f",
+    "130833743a6e234f73929c3de8f04b0b40eecf8460c2f0f81f4b1af5f31408f45183fa9fa9bf114fdcef0ae0f3daed94ca1640607e98c577c17b7f37e91dbc5476d1691f3f3668f6a957b8f",
+    "1ba0026638d7e482ef26e288793345ad8db62fad026f0dc1e6e285bfb70527592183b1dbcddcb703d7cb6a979f52f08c6561ef7c568cd19c46e9e51b65e72ac61785510487c72e1be09a631181c40870fbdac490b3ceb83cb7b9a389bdcbb2e1d8e3e69ee0ffa12283f323d308beb9ab97878a24ba7b3e59cda9d47ef0b94921",
+    "46926bdf884eed11260cfaefe2eccfd49774323f0d9914ef4b476d5661280458fc045b4185c2d98369432a8fc898860ade2f65e8e6ee56670e5048889b1d231ddad80717df0015923e45",
+    "d7dba7b01e9a299c3303c5dcd025d44ffe0719c050d67bcbcdd89047e89e7e1b176147749fdcb15bd98bd2123ab56d3fcc92d829d9a59e5a638e9145be5ce459948985a3a4de0a6302bfb5e9ceaa338280040bb1f3c9620917e78b029c6af76102edda2443179055d0b3f38c53330172ef22d3f0e354470322a5da96735171f5",
+    "600861f58004f4bd336bdd6feaf7d98b5dd5fef13bf1f7213f667f6e4f8b8a1b4fcb4a7173d70906a7519b263c4e8b680afc2c6607823707c067ea7ffee4eeee00ad2c289a6b713859b",
+    "ec9beec905e1928a9e101254cc23c4f7d3183c39b86d3ca231dfbaa58b44e78ebf045ea2d49dadd8e5db0414fda2c8d0af2cbfc460ef36394504889bd20144142c038ef74fc9e121f8dc0332716275087598c2bd824a4ed666edb7293b20fa55da702d15935e2668de90c2fa0343def6bd22f553422cc2900a07850ba4aad8d5",
+    "17b7c79f43b1bdac43833517c9be08192ff5e51a9cf8f24cd70f426db75c1a0c4db26e96b9ebbc1ea14b9f42fd04537379f6ec939ff02ffdf6056b0c5e953748b09e5f6672a9f2e0f1",
+    "cc46698e227ccc34154a1bbcd58459694f416118a27af818a0086bce1d4f80f07230d0ae1670a28825cebb9b481c0ac80396e6b44605dd1abb421469873c38593d72836d1999dbb970bd7d5f5b7a1b5568aa3fd702ecfbdff92ba2063e6b8918f43d940289c5e41322510634bb970d822cd5f7d8db7445363010290c4611cc65",
+    "2bda4ddbb7c5b73eeff5856b72782d4baa3646e67d7c821c5381bed53f389acddadb9b00919e8c0ebee004825310ff365506ad725ac652fbdb7c2b52716f8d9f03774dde2ff879e",
+    "af4a2361fd32ea5e89deace2c8a9bec5b5a379466c159dbe90254d00ccfed635a49cfa6e833a2d7c81c1238ecc71bd29593943e49ac651012df8f07aec159bf571dc8aa7861f9fcd6ecf494a0a7eace564adf3b21d93655de745165a75e3085cceec74a280770941781ae0947d7ce33f6cf9e071893ced7e7c8d2dcaac0e0aef",
+    "4b1e1c16e03dc9c7ae2f20ab6a64967d16dd2c79a504a401b378c8bd9e1ac5a2e2eaa2e3bbd5d140e113901178b4da31896bee1982ff2420da559f7792fa478f4ad18f6db91020",
+    "3932bca317ddc6066c3053efeb7c5fc480ae66efd8fc4a78d2f7c1c8283c7f65ac842646339775f34ac4cd965474a4f6f7100e303ec9bc0fba090a8a4418a5966a15beeeec79f9a148f3c7acdda234f18b3969d7b3b95ad36196be84b2d3ee909d2f5a1f792daf688656c50aa22109d169f2abd357f160654f10c10152d1ba5b",
+    "20a5435389a282ec4b7a3f3d64a1ffc1c2469377c226fa36cb19d12bf80026a5f44793951e3a69ca5e4aeef073a29638e1345229384005544ac678f4beb79e5ed1cc81cbddd36",
+    "32bc4799a9001c6f9194435a4d5669b6a0f6b49b4e310f696ecfd44a0afe5e4be988c159d485c6558eaab9dd7310726e7afac1bc527e73bc2fafc55ca5da6bbe34b83c7a7c7a9359d4cfa2e47112f4243f51b3f027a0cc7b61fdd1f7f2a981c981f802d8cbb199a9aeeb44d80404cf9eb8a3acc98cc058071a9fb8ee96814569",
+    "779981b42b8b7b908bd0dfba573351584d391621a8a5b1e9c251dfc2bce05b3030800f26acaa1d68f2334c87319548b1de90c0cc226dce432eaec288d83d3e9beac360298ad",
+    "1e72efc4e382d95ae86f7d6f1d90023ec8a857962523261f3e81180e1ffbd77843a106067a882dfcdd9245cc5bd112e165605497d8756661da5f429aa9eecb98ba0ebe3998add7f7cd521c9d0beadf58f30fe8f12dbe229dd43c37b8e3ca7a65773b8b4f83ddf16e350083be16ccbc1714b372ada619c984d1e00e249d7e0f49",
+    "1420088719320ab408403f6f91bcd7d30baef6bc7f9161fa3ecb32f19ade9e43139fc0182bca4654d8edad790dfcd063939084fbd98ec3d56d4f634129f08f49ffd5562ca0",
+    "6185c64a48dbad42b7d87f0023b4bb6f33ad021a52c908b55c49d7a025e12230d90feaeb475380596267a4213a4898030f3ac06b3b9756d170b8acc4e4f4bc2f61e298832f1cc4eff6cec7dc2b75c1fddbee11f9930b7f8956a30dcc89ab9753fdd641b9e19bad608bd3644a1061775c19bcf30bf22549c61aac76a7761c5a17",
+    "4ec259eb1e6009195e0cd73e3f71963e8de5f53cdb618f2e4a0f095565c8c738f91662debca8ec36838b3f5b0aada70a5c58dea307896a00876908d7a0ac51ff9ceaf7b",
+    "d131aeede6a6a74c86147cbdf2ca8a2059a655b1558463488afb72e82a0d88aa2925977834bf316348392be3936ad431fa1c9e1e521ee286e0cded3b82d038e9dacc90e524fbf15e0728a8befc2f7a17fb4d1499ab9f35145889ac7e505f928f86aec3ab65804d43c1fb639972f0e65a77ef1edba0b4a990d33d3a4a4c8410e7",
+    "243ba175a0b68c108abcf624fd2bb265d67f28300f9aaf072a710e9602592d1820ee69042903b849a36c06c0a414f6728c20cafdafa7d6a59cd5c661222f2c67850334",
+    "809588a34ecc201a28e3ffa8e1b13ebf738a4fb719cdf4a92dc22f15079e7ba25e1f74362a15ea52566a1aa785cdf05ce0af80a9b45974895fae9cc774aa102dbf711c3a04055b17f66f92835e00dbdd34f98942e73aac87ba90b9578ccf79a157cdd48459327b7cc700c68cb1b0612d11c32643b1ec82a4d43285b0f5f8a26d",
+    "7916d68b83f3cebdd613afd6037be6a90962cc9e97b80f535d45fd1768400b0a4e2e3fec0adc1c4518489ecfda82f04f639ad60a9323f8f18370c738bf33f419bd92",
+    "d179b8046de4902e149836d106d808cb2eb424674b17e0777b0342a66b637f5f627b3e7fa551f53cb1d186308c0b38f0f4143d51be8961f7d16344549c41ba1d33f51f02a895a3fbc85ef687eb5efbd9b5364dd8c5edf024e61d2df496279bbbe51efe702ff28f4e0aeb216ce56255a3bbcd52cfcd49ac8e9604b2849b34cbc1",
+    "345610129e971c447b1887d2488169f81e197714c69a035f7441a1f01904b2ff1d81e4599d28fd5013087770f1c723a6f061843f9fa26f29164f4f36313a7aa8725",
+    "4cffec0e2fda979257c1e751515435e9739da81addfe333572a68d926d1a5d50c73bde11c3ad2d27dd5928e07a7c0f6f8ea0956bc0578806d5ea09f941a39371a30ac350145aeaabf3abc87ac46fd5b1f4fef611fbbf122750a44ac04afb85a51dfe9049b7aecb12375efe51fc5a3f1c6043ff62f2810a5ccd577a7e200ab6a1",
+    "5f137a0f3d51ae1673d9bfeb14b640bba6d80db67884b5a3f9283d730d8d83ae7bd5eaced14347c09e70b17a67a7fa421895aae25626d1b467af23c9665ee0f8e",
+    "3e8d417dbf5b7ff299d780f59da71d2a6623e4a6a97a0727b1513ae7cc5851eb0246d6f71b0ddfa43562fbc288e88508c1bfb0a32f07bc3182a163974445b1ada5ea3440c5233d06eb2022f707cb87e050f54df199ee2457ecfb85a430af5504c41cf687015380e4670b9be0cda42f56727f511141058ada3979fd103c4d4f59",
+    "fdf487a04f7bc0796e79df0b975e9486e24fc0400930f27015198367828018495eb4a5bc6fae7cfba67bea3b39a2a2f98ee6c88e00491220f2efc01d49b34cf",
+    "3aca7f07286d6fe7153f4d052203b049ea7196ab17a43c842f1ad99be952edbcf62bdac8ebb173ce2b6889b141ab40afc4e25d6d0f9b3880cd36a3ac3d18b71e7d51832693f0dee21f896ad1f14f54576cc611960279715d7989b0d32de55847c78a84bf466b260cd55d9387950e2494237247273c9a274824cba49548e98b13",
+    "f70ade7ae959f48415b7a6d19bb8785f64dd627746aac6563a470c5d566d3a38a67baea7b4e9f0adb58a96770659a5fa81e6d9619d92e63296ff733e5c463",
+    "18a3aa5873c7ef4e242a607eba911d4c2f436ff4ac8708ef176e18a153750430bcc2a3b024a19f139c5e2c167a3810dcaa1e547b8074504b38f49243ab51a0409a79f21cba35bb250d8f9c3567f0d8981ac3822a3fe9b420141a81c08367e9caea7ee4c74b67f7481e5af54c6d46e2e33429f113108659327c15feb1aa774365",
+    "39739ecc1bf018feb0f85fe44a78449fe23bf10a08aea7cef4262964e954bbaf350200e646dfab17148a5092b470ff98d18967678a8f22686d62b5c7a280",
+    "52bc158a78e7a4d1488a487fad364e17f2bb9128409b06ab239986172b3629fdd5fb798ae5005905df3d21c12e557905e2706a5bd129c2d3fccda8d83b03aec402fc9082936c7c72862d705b37c70b7932130fa7d8e528cff8645657681cca07cdb282099a089313a4cf61a84f85fc6755cbec6cd9871565c295dd504090950b",
+    "5a2161d69b9a9a00413a7b8879e8dd89c9d7cce2bfa752809f16883102328e40445ad0152d25fa224a4ee4831e9b84629d4b308f2390aee2c1dffc97e1",
+    "2bcc2023f78e2e4f35a26696d623b8ff52bfd6e9011b4ad1fbf843dd263633649be62a174de2871535871f9dbbb1eb6decfc1cdb227f5b72f2b2009a1dec137e529cafd065f5463027b4e36c0b12767126020d03577fd01b697f5f004c0ead7df36feb4f2b6b129797fd7e78d333831c39cfc12d73910fa7070aa80f037661f5",
+    "273cdd9873d4fcb647aecf74866637dac705cea2849d9127f4e86f608d2c8c895ac09e716c2c4df325d7ecdedd80a9ac309e375a49443d63a1138f577",
+    "2caaf1de682df644ba39128040c938f14d24fdd242b77556b3b18de3e5948af09cad4e0e4fa2a9117e3cb1e38fe0a18158a4866920894518fc4df78b2319f4ca8610b1029b78f43fda93e4412a7f44b997e858208fa860b2d5dfd46b04e816818ea59a626c889c5a309d7ba2a4c4358549eddc84199ba3f1d638f2ea6786a88d",
+    "11bd2e0978fe90d8b19d685168856d0c24a1c4e2ecce9695f307fe0bfb808eb2e868ef62278ab9ed3391b3c540dca4827c14705c9f28ab5e19d9c38d",
+    "a5e83f9880cc524465a12d267faffdd77ddac4d88eec70f2cb69adcf814c0011824fe06c5c45455cebc49843f87ec537adcdc4518566342ed480dda9bf40f9b47e4b1f90e8b3b033bc68bd0c8f2a507baa91e2fe975886e43bf4a60b6d334f83a50d1e89f47e3b825d99c1e3cba303f69cbdf0078f1126e289fc79c6785c0e31",
+    "2f23e2229c66fe06ff46e5bcf14a75b72e8a86f584f0f123d5e53f8376e9b4e33ce3ab79d7828da33d8dcd0e97af84eb81e5fd5ba795ff424e21aa",
+    "30a34832949f7d2f52abb0f9d0b871e8297b2cb16683492ce8be0554b8b7f2d6e1a7007a78901656b0d26a6d3c0a7fcc0a6088de76a8246b451c83655099810a5b25c80f4f93bf6c78f193f1d491758cd77d1edfcc628259d4cec4d453e701d9fe20d113e684358f8c0126753f4df0b7f2a33d8f480f1f359402c0d03959ae67",
+    "5b89d902a461cdf8e91d02f9881d40b2cc44787cdbb6659bcd3efe5864afa39387ac88cbb3f156bf8d73aef967ca5769d6415f89896e2d18efee",
+    "bf67d61841909c8a7c3f133ef94b47f7ebeda154677bd3914b84930bf545f22ad1ec89cc432731535b9c2673d25822df07e05759c6efd3aea73292ce71b31e0852e7308ff42e1a9557d53eaf60ddb13a1cd4f7a1a861ebd4782e42be7217e71d99f804d0a60e592d9b611eb2ebf18ab005f52f83eb73f763604579b3cf5a98b5",
+    "2ba5e920aa4205a73ac458c325ce1f2f9f526359bee7bf2e248d3aa165083bda80007b8a0af95f1f6922f1c9a7830ae69de1af2499f97412bc",
+    "6135b4d004adda4704500be13c459fc47354698a4623f790e2e22b46b4b32af08310dbdc48cfd39f7952deb8b49f7a1003e8bf366adec40626a699f29291c34d911d29961de2b41582c351752e905181e20f903bf8b9657ef636dfa8c362911e3d235d3557e3e892ef715e5011006792beee6e04f90eb4666bb25f7b4e79dbbd",
+    "7bd8be7ea0a3503413b379ffa30f11683955d8d6dfb1e21c91bebd36842f86a2f259653346e3ceb08ca427b94337be58af019e44d0b6988e",
+    "727f8da9f676cfd4266be450c9241369307691a949b9d1e0a310d6067ef0ed113783e6c16496146a1957d80df478a03d152a925ed986f9a9ddcd5c7fc58af12300e0c35e0d647e16ff34a530f0a50753a5079129a88d3799323a1b5214931a6483c9c93d2cef006b3e89ecda612fb3352b6f6f33db5929253f48f7185b1ab7ad",
+    "6e1e7f6d4810abe62f47721f7fc1e1cf5df8f3999fd184e38df04997e2e0df71899415d2f7fe5974cc133eec1d8769287af518736f67217",
+    "795e5f436cf9af6344b2b479a548fc774450543d81e5fc788e0c4bb6e7aec997f16ea3ff5796df24b0c763c929c9ee441108f919b780286f793c244966b98e8eb66a2ee0ed81b5cba8ec1243e84749313cddf6016344bf70d442a9591c1ac45e5029fbdd7ec3f79331b98e1b739da1d9b13e8d33df295390b3bafe4bcaa350d9",
+    "18df403c61347364fdcab620ae7a2c26167ea323dccb5edf7d15b32049d325b90aab9839652a966c508fe8b5c79e4621461c35b02e3851",
+    "c09478df642e3be1350700d49f04a92845f07d71b3ba406f647f5fb00c7bce1e0155ca9f6df3ffd1093887602139be650a932287b7fd9325d4d0b92ddd6c9a1f0fa8123bccc2012d596219e3ec688079e4b1be3ba924f8eb334eb36e0c64e1f745232898302bd0dab32c03cfafc6a31991e164e70a30d94da994a3ff2b35ac45",
+    "107c209a232639e35f1e50233e698f5096d2ec6b33db38c214c7195bdb501e9de5eaa531f56ece9d05c15230e684ca7f5e7fc8587323",
+    "77fe920f360bb451cafad217dac501f2abaa528f1b84c2d2bf0e8e5fa0ffd53fff37d56bf70e5f6447732b271c88e342307ecdf7afd02c607fbddf42a73802e4baab12405b8f37da1e609cc1dc261ec805336745ca3fede8c882de32239aec3153c1d4f49a1b06b00b0b1e3d218c122b29fa83cfcf3003bd135369c768c45763",
+    "8042107e6b568b49d465a5a4d2dd641f299d8886e70dbeb4d38563099caf1bbd95f26f4df99c1f0709fd0adb097497ea78f5651f65",
+    "6e07e8a87098bb93cd7612617c693b2aad535f3a2e92046a4a5d7d4d2047b6aec67064f4209ee827ba317264aca72f5b7464c63726ad8aa68db7c7d7f003a63327dd75ea5e4da9f69dcdefc59412379fe2d8e919e92d8163eaf33dd80420cf2ef81f4fddb4e2ab2b01c9304ac71301615c078c7a98b7fe59c2528468fc5e73b1",
+    "7ed39e6fdcfc1a340508b61e2307812106a05f98425d078215a28cd20faf80ab5d1415b06ad83f4e772d0e743d59fac9dfb68b8c",
+    "b5d92c3acda18ea5b55d4654dcfe57e2fe626cfc0906fae4b56a97d1dcbaf137b7d7744ec17d58cebfbcb64437dc83e60734c34e85eff11f8035587fab9291244029c2d5530fc82a07d5bb18dfc7fe3c96422e2c932529a590ecb20c774bc35dbda5190f5e403943b5ff0cd436286e2f3162f559dfed9af8806be0f60c8ce941",
+    "13998da3df16e05d69e892d058868e264f04366d70d8582b7a5ccb11cbb9f80002fa0b061c7036639e76e6d27eae673f2ae15cf",
+    "7271710ea85cc28d1f315cd97f00278fa4c22fc3a8356d2974e72f31e21169daa171d80148e54dfc3861d5a269f2e245930c6af3aee51adf5159920bb74799f59c177d4ccc1d046aa8fcb776b55f5390cca52ddd55f86d8756aa81d5777634d46bda58b8c00ee6a47fb6ef8ecb4a8f483805d0c79782af397d77f7b94b2c7a31",
+    "4854c8e586ccab52e52ba88dd4b7006cf368ccef3b88f3380f4d15ec717fc4544dc8a3a1135bd19d552e1ba07f6881f6e8a34",
+    "dca8902efa46432055d25309bfaa54536952a36418339a6b6dcab4affa499276b5ab9df687a6012fdfcb1e33c144d9d828c71c88a0db41bd7c7096451c8d106d33794bbeb23fec082682b74a62ef03de06f699f1920bfd772cdf1383d85e3426d7c6ba001345a7139234bf943ad00e15712734c49ff9b44ca5c92a5da82bd98f",
+    "20c687d6812aec12471901b29872dc1fa06a077c5b74c23cad2d363c7107564231f7d7fa8e3014f43c7620e88f884663a698",
+    "e1d715dbc9ea80ad0e5eec2a1457d3b41b81b0461d0008581cb1ea80fe41a9119243f43677ea36f8d3f5b6c3aa5afcffde33c73f3067c3601d42badc366aab5594c907e8be0d190dd3514b7ee50ab3d98988577e4b16d9ddc1d91d301b68d50410ef6d67f35c6ccbb1ede1c899fd8fed89d6448678a45cf7b9eacc835503629b",
+    "56ebdcc077b52f5e959a61c3b683b79b066bdec4a8560d21c9c0d5b125a4686c2732d344074ddd71c31176d2afacfd2aa0",
+    "bfa78b8a6dacea5bcf9925ce1c510abe1b40539fd84706d2ec915392881c66a52addafa6f63bededfa1842306907f22023ad5da4fd0e5784485f740ecaba8474565d096038bd5f846e7bd092d9f1e69b0b31aa658d68a02aaf115b97af07e1999979b78b4e828728165b87a13a8af6e129167f2a85d885bd36437ff2075b4caf",
+    "a9ea62d96aa8054acb6e55270957884f58118ea5283dc9b77972535c3d1ae4f164f1937ad9fd4713d9afd2cf4e31a806",
+    "e1f1f8982df796a011100b5da24625e3d5c18b40063e611e74e971c09f2674ad1b7f933166418a0a033582611199e5eaf6f47de5b5dd4c8d85045c5cc372493cab7ca9d866f1686e7eacc53b103c494323aea7a20973f08dada5ea60f3061e596959a35c1e0e4ff4c6d31048ccc3c609596055b3354f30461d5f61eeeba27719",
+    "57da07f289e2faa0a564d7bb82f2e866491db3a872b3cbe88ff0d5efd7feccb997c2c00ba51f9b25a5bc827df817d6",
+    "81b61fa11bfcff165d56fafb83ae2f461de487eef1c057178d2afe9ad6e98da0239eec67d8df212ba4117c2d99a9f004f0564b5de0547055834a5028bae3285f5828bb64490f207baac670a0f5fc3a85c6077db0d4ce5f92cbd327ac3eb7ca8a5e09145b30331cf617e0d62a05c7e8270ce95989dd2fd4a83d6e4cdbbd74030f",
+    "16c83338dd9eca6fb87439f456976ec2b2e4af80c888ac1cc35cb600a2c9c22f5a34af83da11e9c86700b2e423ad0",
+    "31f3bfa93617477f2fa033b30f96844a54896211133b1205b9b6e027963cac81d8d8ff0d21d4f5a68ee1b4490da561bdb7b50d295fce32a3f686cb9230bab0f972d515b73395f6eabb093cc6196f56b0e7351959338265af0d4cca78417d5e20aaa36e5ad28d89afdd49ae878aca45270e8c11856e457bbbc84fe1e774ed4d33",
+    "b1f36c4deae76dcea6f0cc3a2fa5733621be12d914cac452aa24cfcd9721182351b36b6399cae335be61bbc0eb2",
+    "8da7e60359d0ac9b5d720ccc4415dd57893b9e7a80f84abd6edd54d0a4367dc62807b2f815893bc4a9c2f30d32868b462256ef8161e8c0a3cc0e5efa256d18a77cb44763c6d119b8cdcb68d77fa8ca115f7ce5e5c82ba45d945275c5b34e8ebcbfe18909e79c221dc728652a88a3f7f53de73e4e3aa284fb563c2cb064afde9b",
+    "5137a146052c8aa101b202db10c931e459d1598f4186b4930069cbe6213bfe6353514d9897f8d610b3145adaa",
+    "cb99ba4d4cb885d00169798b0abd1b7f1e5fc37b10bf6fb8b323da03dbff69db0d97bfab1ea83fa19a0ef1e89d28340b2232e7d13fb1a85198176a15191efc72766786a57d611c8177373c9204f3806c48385cf2ed3a0fbf1a2ea38cf1145312c245f64476dc71a04e128330f4ba354db816ddb18fe275c2cf585ba943b2f955",
+    "3602398b2ba9d602dd24fcf3328657b53000ba94b069303286e8860c08d056ac39475e8d495eced5518ece69",
+    "3c369d5d40abaf63bc65a08e984d72e72b47c4760a4651dc4575eba42d4e1a37f3cd9a5916390e28ba91a7db11aef74e4c658dcdfca85492ed7f2faf8522a5c49ce1afc99f9500dc672d49b0e7c40bab51a57b8a13101ade5df13724ea1d07d2e9f1e2843b5dae6e51cbf6621b38da3d6a0a18f8c66867e5043ca7497a92466d",
+    "d4da66f3a68189eae309028897a8768d47dce99538cbbc703551de7d8506ee5872a87c87e153f5f08b930",
+    "48798f0c26d15b574b65213ab34552c9a33b26b0d2d3c0834df9e1720a09aae4d1c48fb1eefa568e56a7bc34084a7f1cf57e8b8749e61e37acb96c65c043de21e7a05edfab9ceb1d61221a6da794cc3ce324dbd3cf52d8b74d1294d76cdff56cdedad50d912262153ebddf91d9382bc328575e35ea89753b35718121699eec37",
+    "e77c4a097cac90715408ccb1db3b78ebc16a46d2eb086ef8e51383848dd0efcbcdcf1337ca82dbc6240c",
+    "5984d1d485e582ad919aeb809b0d24603daa6a4b99cc7a6bff695a06105918c79137b03a65cf92bf031ff6e5e331ead609bf40b29f9275006786f28028461128597b8ffdc666d29be41fb814940d295c33a18af3ebc0cc70fd46fe784e41df4848adc79009bbf9c6fba80beb5e2c8f8f383227f0c406d11eaad33d4fe9de8b5d",
+    "304e7ab97db0bb8e505616030fe4ee8fdf10a4c260cdfd94d273c9d9710e7e34eb08af166cf68f1b64",
+    "313e8e04214f2e53894a97218e794239b70641ac24119e1bf8a671a182a117e4aca9f9e4c1918e4e843ce688ed15ae2daf99f00a3ca6672e3241831baed3d95e491372fe057df4d703a08cee26ee5b681d166928b6ef89b85cc54086f7f4953a3ff3736b10e9543259b14d7b8c71ddc9205b6880a845deb631282554d7bd81c1",
+    "ccf8a85865140b3cfef132971a042a4d329fb2c5fce4b2ebdf1bec34494bddc12f2878c46157b983b",
+    "04cf0cfc6d5408664c93cf53b0f715a2c7bbd315f1a4150bc400c1387c1354f5e5707952fa6d26326691e1599fd47fac973c87c480034f7eb9ac5c0b6d05f89585997bcf72373ecfa8156d2d03167a809dcda097b78ca143467cea43d5eef64f77cbbea93335253fb0734300aeb8fdfe7e7fd5f685a449c9ad8ca905a740f48b",
+    "17a91c53e04a13c8e51324d9e07ae60dca220aa79f2579160fef68c9c826c8356f382af4be844108",
+    "990fa5ff82cd6ce4e28a74e85a3d6bd52657534b3d94fcda7895355fb7aee6e38500d1b137ea33d115be7ca1dd420b3e9256a62b9f1b7b4764bdb84d2344308717aa225b7b5161b8b16e742c62f9445a87d870ed24d17b8eb2c99ff2a723bbbc689afae4eb958cb132cb77cda13a347b5c9a59c4c43dc704e6d89b44cc69b737",
+    "7e952bebb001f341883271c604d096fd192bafb7abb51228e8f796e6db6f6af5c96e15dd6737af",
+    "5faf6b77375d58214baf2d021548c73a30f6cb4d3870b2ec09caa71dfbebfa602273aa6670bf8008f127d3a8b68c711ecd6f53c17c7317f5dc157a98de84e133cf42c4eabb6f0842562d755a02ffbca007783cb22a40155997d73acd3451189e5f7c2dc0395896493f8b93c9a15f30491d88ee58b8230a50ce3b3491d1fbeb5b",
+    "fc20a3be85ee8a839e3e63c1826daec5ab3045eb8d2bed2e49093e0b1b94b28bef131a527348",
+    "4b657241b8aefed7d8a87ba0d4d6c2d27219adb9b1f6b62026cd5e7c4f4c52d296bddbc276ec5b2987613574e1e7403a50917ea3aa9b17053b93d3f5b7ed0b682c3c0973ccb13c758f60d6d2c4f4b923730171216ccd10d270ab84bc3211dd9351938d6a6e82b982d86f4c7c81e160d3ec085439d0197007059fae75e8226e4d",
+    "12151cb8a3b76b1febed296f4cf2d9565fc2514f0243eca37b057c9fec7430fb71d1d3365bf",
+    "c9fcda835542fbda323c3ce44030b8c4ddb612ab33b18c1ab307a69fde0dee861c7a748d95c497f49b421f06f02cf892dfed87347dfaa3a96d2023da7f358e6595c5608084b0860479e3871aa93032be4b8c1164f89143bf004bf420221469881d31d4e37ad33616682a04542dc3f90c0cc4f2affed953c9995ac48b70dc9ac1",
+    "17141de9269f484f0df49453b6f7a0e99d1ad55308457ed6507f466ac39cd5afbb78885f6",
+    "356c4239a81c7beacd76be97699ead3b019af2aff1e9fe9f96e3d935533bb6549ea82a85ea48771933369f2b1bb7ba7caa455f7dd9460687aee97896b0b33aa9346d5083bb6ab3f196ed83d21f4a8a7e911b9ba1000dd5387dd70d4d83a35e5d9ae5c666f48408f46110f8258cd53165fff49b89a86af78de6ba9ab51b68e2c9",
+    "6e820970a560e6801c4b5eff53d1b7f47b9dee64194ea5aef9bbff6ef678ff82e92b2ec",
+    "4f37b753a7a5ed3ce004f5302835f2449151799be34c7945aa7ef4d450c8e4a057123862d4f04196c30a59fec9402a816951f322ecff1227fc7a36dba5a9af76840d49c2b922a958c3a5831e872cfc08b24071b07acd8ba068da66302048eb08a876d61b0496e96d64fdb67b0bd81b1011c6422bd81c365f80fe095ee38360c9",
+    "33dfdee9898b735ef6b9ebab832b18cdb097ae58a613886b90473d9ece16fc868d7020",
+    "9c8d2dae98646b1546695ee280460cefd7879ce8bc2b6fb56cf960a32b0ff775ab8dc8c8c46c2f7a805b326e4120a1299837da49452c91ff4d03ece98450e299b2fc24d1e0c98b0ad583de119c0e83c70327592ce0b3e4dec84e7a3c5556b08b23cb3b6992fe7ae774990283d8818147d579cba12e5bcdb2d4e1a09391f1bcdf",
+    "8bea4f6e109291adee08796cf4b28593bee390b37a85726533757b2f39dcc21becb4",
+    "40c40fa8ff5c621aa0e685aca788489999796f7c5ec8d134eb5c2618bac54bc4461d1d2371aab243871d9a4c60e74956c092c8169a11e4e5a7030697a6054e1bf3c5e75b734a8af42647757bf9006796f93aff245b4ffdc990b1038ce6888b827c34dd9c43e3e851a5ae0645d60ff66b2217a8e39281b58e6f75a1d1abad9f23",
+    "8d2fc0f41491d8afe57460f5f0dd9e538b09094c590ea7cf8bacbdc2982b6b0bba",
+    "735cbe3c7137a5523b35b1a1bceb3fd3f2b5ec75dbc3daaa1067c20386fc947c6fd1690d6eb4dd492d280a3fe9246784823b0b078e44346a1d622e33d07e0d6a19b4a4632df7fcc14edaf17194a504e15d0b248a3cd2638b651e584a84f898964549300de428a6155ec31026eea6048fa59d461a14f666d87c552fca44798063",
+    "15657c1fe03c9ef9e1ada4cd1929b71ef2d569f6586f980ad3fa15fcc990108e3",
+    "b455d6b0b0b6062d953c5ec85949d59d4773690627702b40cc24657d239a00cf1a3acbcfa9f436d7207a0e0a7d3cfe36b2614f5ef4ee050b8a9826385dbdeea4e60622f4ecf30ee7fc9bd031ac778015c40c6f972dcb9bd453e01ef1305f1d81f611893e0146d5208673c8e40393fe33c9e9c39cf7316aa2b4dd576b901be8a7",
+    "136913a99a8947cd5d8e0430e2ef5041112e436cf5ead5c53d9b39e3a69ef4f",
+    "64468dcb7992938b45bd618beb59563b1c0a1d2559f6382b282f00819caeb3d5a8ef6cb1852351e43eac928c9f921febc8e2c469a3617993f3d4e24a0429d492cf5ead97f16927057f1eeffb91b26e158c5d05e28971c0b4c3bf498293070d6d150da21e510051e371e1443e70c8d6ee736f01457617060045d3ef9c25d32375",
+    "def83ac05dfa364f859c43d1fea0450b150920969aca70c018eaec6424fa",
+    "c830f4b6984d047ddff69ce6d6af40bd74d297d8fee0774a2d396850f998dfa6f80c58d9cc1105ab317c376a7cff2297bd6a27593621303e79e8960ba063c91465fb0bd253095d2a4eb20b3ee38ded569350aa424cf47f15a235b6def0b8714131e46b1ee92683c23634c4b6482faa8bc38fe8f65b254fada8659bde1ad094bd",
+    "35803ff632d62364fae23ffe690822b4222cb77d4b2718e247eef1bd044a",
+    "33e746db91a2419ee9650bfe2d0099d5e0b8da6e87e16ff9609881f6cac189b56e2a8610f3e7d4dbb8d47db4d747b7d127c909b7bb685191b1c6538fdc6b8e2c673503b0dba7146b83de1f8394555191272c0f96c5d4dcbee9c88e2060981ad9fa7d78f0aae3c3ebb7dcc6315a131ebaf25a7b35ade8ad339b5a234a831b8021",
+    "247924d9aecf169f554c0dc5c13380fcd876d8bbef1346b0e3db88b9cd",
+    "13537b12e738722bd3d3a498e026a87b61436517576864255dab5e2df6eec34ec0f242feb95a696dedb1171fbd0383bbfed99ed69773c9de0d32d2e94d7ede93e877eabd611d2c24c10f0c09b23943328ad25c59804ad908fe32fc4b960390d87db494b12408fec42d4039bdaff6290eb5c4250e4c3c7b410613e425330b32a9",
+    "4abebd8101c7a7dade94b3853c01475f95b644b760cee43991ec7c2d",
+    "9e70354524273cdf8c24a80cdd3145671e94f07229dfb76cdd901c45c0e8077eabf4fc4beed7fd225b14543a976eb3c41cde23280b9d32289c0677b16432a1426091fa4c93d850f52174d6753585cff8faa2b8d31c7c44465a306aebfc7b851fde94140a7d13740886323a00190feb21084f0a2f462debcd58e05b05a97b5ce9",
+    "5fba215cf23a928073a6b63d158b6d38b3a98f5afd66af288b20ca",
+    "7ff2fe598bc10fefe3166772f6cb20067b19974fd7299a2b90a0032f1da5e37b1b9484db4aac770a77c4822b56796341ef8d9ca7b6d7b69ce8da28bb7d424a046801ad0832248ecbe645b3b32bad60d3bf8feb841e51f8e0890fe1a25550d103999fbd437559217974a44278a1372ad4979ece5adb146c276290863eb430bb47",
+    "d9a310b9424de880fd7e6a54ba437ef3ce3933fab0958ed872b9",
+    "5064c4f9dfbec550c6df39182c11bcc66d05fd11ffb220416a0f7a24063e99de9ad4625a30e5829967489b35950aa466616c115fb4a442eab1280e52dcb81dd7f8668690a7446a7ee48a7bc9125bba443924c01e080c08dfc2c61b66fb55a3d7237890d446eb9bf9938a8d975637fc876141e8872e2f7c1e013e5dcfd21d2c0f",
+    "d2401b53e081ec554ede96b270d9b2cd8c1f462a77508bed736",
+    "8b2d3791660534f43a59a0ecbaa9514f6d08f9a1ee3aea31c6e305f88abdc4f73f5a76beef4655148a85fbeacef563d32bbae79029509b6288b9f962d9d66d8ef478514c2c2169f8601016ebd56014a78a44ef5f8d32a311b4c7bb5c634861f7d26c47a6c37e2d5be23181dc8694421b67de407806352d4c467d282f2adc4d7d",
+    "19f4e078d5936ee44f0e949ae740c2850655218b83b9ae9d1f",
+    "4605f0e715398bc2aaeabafdd3b27cac503a98e03dea5c2d25f6276690c7a20924cd107a0ceed985f64abdafe532f379e8d8ef003a6e96f2782f3c14ae55401e3e376713395849881252e7cde30310a8364ce07ba535d0e49f9413dc39f318ad0b0398e1e961bfa3a7abe27b68e87af6a05eb25c44b420e352a7fc23a2ad82d3",
+    "47c2f876c8afa8101aaedf85cc128492665c8da2530d52d7",
+    "3c88b1bfe819d59ce025903f68bc070d5e9db195c918dc2d254d5a7489913b5b103bf7e3e7db03abcf717c47715792ad23573e01e177e29ef4176081fcdc66100fbc39b2c2690f5fdb2ea8499b5f1dc795dff3251962eb4ffa60844aba843afbb01b7b0837775215f97ce65335a60f4f366824756af6aaeeabcf8be1d13e84ef",
+    "4acf798bf4f772d0e6def161e4759a5de463bb88b1e79e",
+    "18e4ceca5126976e4999420b44a80d6fe09743396000b3e3a737259dbd2e21522ba66e162b8a368249e85eb3714b8913bfcbf4303fa5aab1593647e6f868d40a210f56872dcc90ba352fd6d2516024b19905e3b6f99b0af32b11b94ef983f8c447084c18adc0619e7007d2d0badff8df8ad4dce75bffc5d60bd68b29993384bf",
+    "19460afb37ed465d11606c01f2e8358111d997ad5dedc",
+    "b0ee8b19cf75677d10cd68eeefeaa37b2e507438e14ac09a3ca2704f8fe712a7d4ff26f7b7895a4c4bef3030e0b530364787b450aa36e513931b49fc78d87771e11eb5c001003329bc0b1985e23e3970ea840d6c145a2ac0302c234e1f9403192f3b3ef237dea90c6315c78062cba7da7276306783ba99a6acc1837a37561743",
+    "34f9bb300cb1b5c5bca32b86a651d3a921211f3a6",
+    "039c015b4e121ecc71c8458aa78b8da94ba749f7acc8a90be549ba500dc85cec758237df648c1fc26a72d58ca112af4420098fd112776e88bee16fb2ff64903dd4aff33480406ad68948df268cedf1834936f5a863cb11cdbdb0f8209e36b329a90206f9babea7f72336aee2fe639c070caecc72b1a0152a91b2cc4963318573",
+    "b9064024fb7622a46e47d0eef831b3dbedb44d6c1",
+    "d0faa66eba478b84e936d4af9bc5a3e5c637abd0a197469561c7333f5c99c552f9b1586731c0ca96cb5229d4f788cb4f54c0676078a8c6b5e1d47243ce4626c5e6780e2193a34d1a5ccab06444742a61beb4f894aef47180c1ab53eff224ee1d49fa611d37b5d94d41c41d671ad27dbd1736482434bed8b2d2c6d5d51024b591",
+    "2f628a56bf9d9d3f8652d6e98caa241cdc11b839",
+    "c74715c5565a5759622f5da4aabf44ca3b831e079d66fb5f75a0b51e667fc5881fb1108297851649489c9d24e1df58b1cd3419c06844763ca878b63ad11cb73224257f072f2233cf8489db8aa653df9bbe8d4a0740b9ee97c8df2c0702741293d34c5ad7eb496f134a0c5b22cb0c197f06832ad54e3367f2243849085121c433",
+    "853643547978180460b8acf115691650d7c314",
+    "56f06a9ac5d6df771c5eafb4664962adc3fd46a93cf94a6ec17d7708c5b31ac5341d573ab6c9beace3ca49915faa13400d68e8af04affd95538ac528119f1d3340386e5af4f32d6111248cdbc7c2227e80b2f360550822c18209980d6ff14863f6b23a697fe66c6529bc861301012f17e65c6e2890c6aeb3850d109e78b24527",
+    "46c4d11c8cdf8214acb7113b7350936d8cdf",
+    "53eebf72df33d41bb7e342c40a55a2ea2227a57907fc0015e2ba97dd5297bb5597a912083f414c263c8a1111210d66f88ea1a645bb33e5535e600bd75582c1850b090e3e46d5b7409f55f2f934a817d9c27d4bf5cfb2490155db79585ff602a696f23acb6c786bfe9a8a9e8a032ae71da296bd343041dde7020634e05f12f753",
+    "c9746609c4637e95620ce807afc45d7799",
+    "62d32543966b1d7244c75618912c945e3bfd9a262b011bf74bd39f3051a368a4f102ade714aa65b93142689340966ea9e17b713f8537477ab388d83245ab8e40e70502ef4e76ddf64e5677705698f74a8429672dc50ef78408ad006ff3c1fa2b1ce7ea32685b7b3939f0b69bea19ed05308ba2684e97bd98e43c9a1fe37d4797",
+    "283c99f1ef5360c59c4c6180121d93a",
+    "ed58a960789ab9fe32ab790983d986808667b5f4506c8d9d4fa9fd99ca6d9ad42c8dad5090aa072c2a25341d8d16f8aa6063caeb87bb2761569a6000294baf5cb7282ca2d366d5bf1fa15e218d5dc484964632d57d427c71888304214fb79a970a672dc0e598ef739b74db4f7b44cfee9d15b12f784cdf7ef0a08864c5d6d33d",
+    "4bccb1be793739f63a0a0144d217989",
+    "7cdc408e9772dc8db477d7d1d36bb6de92231298aef007fb2620e3002b1aa98c0b7d8f37cc07ef1bf4d053bbce7a61e35a80d9c4f7a2d41c5a7e769c806bf2a2fbbc118518db5c1b08d5602191af6c0470540b24fa0bf37395a3af9e6efadf815cb45022174a6e5141c2ce6f8bcffa204c2c4e5803feb8d367c96a76874b7ebf",
+    "28acb30318c4875b08db6b03d8d407",
+    "524a3c53a7d95c430ee92aec79943a1f5d5e364d9eef82bf7ba26c18aa1e2b5a114ac3dd0c47b80a6525217caef490e96eda8057fe0c1b5ac182346c2a52da68c61a9500816ec27ade901b934e9a7d8210374f253539a99cf42b6bbd3323c8ce744546e7334d8f9507e2b6656af8d1c1d3d94b2060439f3725de0a3a7c244ba9",
+    "3a53272be2099c6c3fbe31bc53a2",
+    "947bebfe648137a8887f22bece17b4afc3ccc23535fb2d2ab331bf631029d560bf436a2966f6820c3cc35bfe8247bd1af2a353d2e6f9530e445a6e9e272217f829c3121bc5fe69bf9379ee052f1127a161999488a1feae28c53359c3ab2c37e7afd010e8a63d83908f359c2b34d1a471f462fc12d21851435aaa056d6ead11b5",
+    "fd0ec4e21c7654068f74fa6ebb",
+    "d82028f0671c0f7951d64bb48368758e61c528da71b2730eef95e4d40cc8349b1f6e37af3ac0f06013c586ed7fdd7a99df1528d230064ae0c2a81860c1fa7709f6e6065a0ce09e36ccb1cc40ab135a78fc9d57738388aa26fffda8d72f86148193e5613cdccf18a49e9bcc81a2474f5c4ca925710759c176c69dda086df9e681",
+    "17a9329d79def0b7982a02e3c",
+    "a38e1878fc47489d1a9f5c26555d70daf137863f0fd399f331b617d06ae324b8dc7125b4d022a01930cceafb9978decc1443fc27e73457c57dc1e4f8e5254512055f1f0dd5e37e08ec6173c7a3c4853499c5597d39e1942d10b89af4726b77dc1678558fd3934566dc6408f4410cbd025680aee244b93ab22a8cc3c8e9265527",
+    "c2bfc31fc548dc7e086bd",
+    "de83454a381427c58f635650dbf57e7c671ecdfd2d83af44dad71d9461fd2b8e6448231d100b878a1995b555975a30c7acfb3e7f9d18279b95801394b06776f8cc4b2d0b4f85eb1f9316a1fcb50150e1abb86cb7a718d1cc8e6b48134baff0bb2f1769806fe6e54a1d89aa7b2a25d869f2f31e23d4215d3416e4005729c9a7b7",
+    "733a99a635032c02fbd25",
+    "a6af45b8ac9d65265af850a79a8d54aea72b01a87797d09064160bfd51323799d25594576e2d72af792c9a7d179ed58f736e916476c6fc04208efeb18044af13ec341a0a2499389f70172139366f727e20e85442806a98e56b8e4d31acccfd0d95b9b387435ddc7740dac61c9e273d29f9c6edbbb026dbeeb41ddc72d97d7fa9",
+    "8345bcce4a225db1aab",
+    "23aa8b589ce7aa137fcdcb668d08783f8e7a748a7a2a100eb7825d5d74855613ccc68c89d616ab1cedaa6c03a14c110b1d6d98ec0af3e485e61d43f3e1dd567de75093c277afeb11bf3959671fa5a8e30a89e77794741de1f340f06b06ffb309907d90974864c079ec262b43cb02f5ad165bc6004216177fea04c69b88b48db5",
+    "c0b8769513aeefea4",
+    "45d7dbcb4d6b3fe2f177645b0a016bb097a16bb5a985f776b72b992657a18051b300a7691a483cffcfc55eca0da9e507a9ead537ad4f6955ef28d64d683d1913f69e473682fb67bd1341c215ff524cb4afe26ef13953bc0a0e7809171a8eec744aefaf621881743be1373800baa295e14ce0528348d16821928f33dd9e192377",
+    "d5c0bd1991da202d",
+    "d3ec030da4abd0baeb18b614e244c4273a1b89da58373feeb60644f0f8f8ddc2693c569e6059d3e808b8955efc4b93af36bc3f40f90533b7c72ea487d77ce77bbf6363d3094efb121329847ee40e14568f203a4d3ff60c83775610b429fa8794f6ac765328665dd29b2f9ea8b30bb0b2b530f378a59c58d4a421fb33cec683fd",
+    "a7ae44bc3269ed",
+    "3b6ae680e5db4bc6e3a3bd200bd41df88ac5bff348767447593195a34c9a4e409b03cf5b979a64f134c3ad89a9e6d62afeb5ecd7a95543a948537a7d34668552b5fa39df519803d1e4c5713ff7d3af32189d71b66433ea174f699a3144a0446c2f9b96ce94d95d7f26bb8b40e8999b53962be3e24f166362bd0a725f13565b41",
+    "4fa8bb288712",
+    "cc83ee125cf390e782f8ccf6662901879c53d211cc0bd9440a05d41099da95d693ee8164d95e2129624a15459f8ce4f693eb86edd9fc06fe3696387782b17822ff051727c77ea6e91b9c8eed802a9e5a691e36420cb9633a17d4b246eee4333a3e744209450442485b8a87e53085e019601a354fbce72041f817cc95d86dae4b",
+    "50c8c83bf99",
+    "813c13a0a2d8caf26c96a3267806574dcbfa37f4854f891d6e300c74c7591bc90f91fc51a9e3d6546629c7b26e51b72d26abff2d0482a9fdca195707c1b775045c48fd1cfa513821f1ad1b88f6744742dead076f6ac3e9e5aa735495077f438e63dc0eae027eebc44fc818fbaf10d1d6a36cbaba6a1f5ae582cb178ee4536c23",
+    "637b94034",
+    "4f19c1d2b04628b4b2a6e4bb9b81ae3d465928cb430fa47d4ef41962bf74d1db77486bb7149e6ae4585f1ffdab4c213ef951b50f0328f60cd377fdacd991da18468671de9332cc03a31a0cb6699e8e0f0f4fa3cce20f284701a5e941b723ee2c157ed1cd788cf858476e6fc1a9e577183c690b6af57f7285b8941070974ef585",
+    "9627809",
+    "8539cff767ab8bcab3caf032b5e0b198c2a879973051094a3591f961c1c43ef72999597f4ea2f05cf1d41280f5b56c47abc99cec6c6f941e6a2bc02fadc9935f202b372102c4ba1131066307dee9399124f6f8bd17918f3f460677e1dd402e285f2cb308a8a7ba8772a1312ca7ba322d31dbb7b131244ed0f61a3a1334be5d7b",
+    "aa930e",
+    "32d69df75c41ef2d31b20ed51c03d34f469cfdd7f7828a5950576ecb9107db1dfe9150d322e6e0cea16deec842f4a899d7cf0fa3cd00cac9f22e743599647d93ea61e5211e5a113586d7da49fcd4c9fccce9129e2e6855fc10b55a6ccab1a76ba0029544d98008f48a15a663990097d3f625aadf8c5540322e12654c4aea1373",
+    "1180f",
+    "c0e266d11e802b62e2eacb87f4af2da1628abdbe8c3b93389a021e778fed2a96622283843b4c5def88d8738b322634ba205a45c48f8e1ed52f9a08812838de83ca6a461669d0d8c63aed6a59da137e2b953266c6abb0ccc0475510afec2d9eb58a3247ee5c5541f53508c8330b0ebd58c9407a76a311d968683fb0662b75a58d",
+    "5d",
+    "b51820c02f99ef8a05a426ec349d8a61a0b4e538f29d570814915e50f510fc8f94636c66558ddad22757a209e58f690d9de27749fcd4bd272c2d537fe78163fefcf092dd86be2605e3e463cd37a15b39834acdb5d86a5a1931d8dfa76abf61956538b279acf6640e6b7bcfdb4e6ab74494760b5eb230e578bac13672558b3503",
+    "1",
+    "9def62da52642470526ea3bc54694fbbdda26ca8f111388647a85501723107c6ae85df43fe9d35ede3b4908446dd190e9ba587178b6a6bb1ca605ec0eae49ff7187ebe2a09d9495b407bc29de9425f61e371ade9cd0f65ebadff2819ed7c9f52eba417d6bee7bcde21e59b5a2a3b39bb0a44f35e12f4b53b133676422c0e5c75",
+    "11af0da83d988d89eec681569faeb9844f4e843bea567fd59857b747425ed8c3d89d1614a5d0a28c19a8b56053b322f579e7d29b70948445d21276f8c1ed9fa08b409a783b2d2ab5fcfa36faeb6b4d5792d0a7576ffd18a360bfee758c32e008d8d476178c0f35d1391adcb4720a900675990cdf6f03c12d0f7b2c4d8b23d079",
+    "1b93f15eda87b59f0756ec56c0ae118f17111cedb9ba04a61bfce588c2a937fbfe97e5ae90b19e24aa250f7629d6ce4a457fc27ab27c90cc59a91d990704252459b9431423e961b1397ba762e507239bd9398807e0e7c94b42eedb8db73d06aef5705935304af68faf761bd5c97481bcaa1c2082f5d8c024960e99887dff9b",
+    "40498c86b51f2358a9c3b80c3199883e909269691d3c510a529a8296704936d5289b5ee9ca850025d0428a0637f4e002866e0d013184fd6607f5b84e6a8f634065a58af67a5008b63cad9601fdeda756ca1feb98c3771f548101127aec8c0fa64a902e00169d892b121ba208c3958ef2fd3c2d2f97d2a649fedbb188c3c3",
+    "dc7c703facb810095cff48d0cbbfc41a654a28f67b8336933494d84ab8dbaeccb6a39f5ff47d189530e64886835d2c5c316e645f60f076ad2a16166817bd4064876af7365cbbef86d56793c4c2c57dede2dbef940b137b6ceead0408a583d6ca58cf72d870f1d2d9f7badb268e4eb6c382609b7ff7e969712a4bbd6017",
+    "5ce7c66831b169a2e52e4a099846623bab62bfb9f91684e2c456e83975a3e0d865a47c6bc2a3d90749dafc733c28f50b7e9f7cf958804c0cfd0e8db8ced18ac87d0c1da63b2187df63a550a5083e87fe29460b2d4936689499630b72e63bf017c40577253bf12b4450b2da92d83fe3293f075f4f27653676761025e1",
+    "1dc211ec2b9445e8e2a65cf8853eabc36fee3da78fb82ab77291904c904a279b2d45e7f4b02b190f13f005fb325a44d188ae1479d584d04ae9dd09e8016d7f9966d97f84fc9947964addfe7889037132687d239105ea49727e1e0ee24b0b1e848900b24ad997a4828fee23a4b904b9b0f8eba39645e4b3b00c849f5",
+    "5e3af46479af6e607901e1e29ddf5068f207e3b29d12b21b72e489fa296b46282ad8a8804d8dde673fe3b6e10c07ee83f381ff3c1dc2dbc3b15b2693d5bf02207387dbd3df0c0ede421700096fe17f20e3a36c7db1b9c6678e170e70c916b123044442a5fcd41736250bee1d11dd02f47b4d93253a33a93e9cc81",
+    "263133f700e9f6244eb722f70266c552fd12397e512ce8369bf9c76b16567e0fa47ef4bc9deac20b30b159a07c2571440e2832588bfa5d910c644bc4d4ded780a526b589e96376f2c1b90cbc3846496febc81e85b9105a835d98b4a11331a32da35fe24e66637a9f0e5b655c14311ad75fcc4d8ff6d6e83644e3",
+    "2dc3a5788535c54eb9fd8aaf20b2780b911cd3c342707587a90ff703e194ab8de5ea441e521a2fbe59434b122bc11238ff2258355b2ae98ccc40c6ace848a1967cef89756c57cd2ce4af185300c3b88c6d093311f6c5a89d8bcd8ea17ef9ed46b8c5b6d928e38a454452ed97fe4aad04e52cfa11f62b46e67",
+    "28ea044d2e4e5a596a40be9252dfd1388ce013f390c34afca2d2275b4fb87176cb72070f2ab521f0a97617e669c33933106963305352f735b1a07513159743979b58dfb51e4b88981ffe14bce679444156fdacb30fc1f13102ed539a46487a6cd47189aa6321cdca175b3573346c4bc51819c4a4fd9f3d2b",
+    "28dbe1dfdce56773a0a0e7678d265ff71ffc34fc37147ecd62a7a95c8c4e7c58d24bdd41058ef77b3362ab056e24a64049a1b119b9b6cbfb17c1497db740edaf469f077c31e0993aab7fd4b06da6421b5149760273bcdb1f7fab4dd8447dcb6a3633904b94f1c6c5e37eeac802dfe902e71ab91892b307",
+    "1da7f06290793e46bcd346f8c0041a6c8189caf7619e85e12c6b72dcf805d81eadeb1eb5f0c7ddac0fe9e777fd4d2defa45353be96ec0bcb728a169d08ca336d2bab84da432edbd1e90eddb30b025479bfb557a9d7250fd277e4aa91d626b596af06a035fb40c86ec0a6d4008c1a4349fc0b35461d17",
+    "75541e207fec971fd26f9b40d96789056cda3d50a976113d088a6ad4cb5efc78bf0802ad70a6d243c1250db1a4c0c7159afb092ad74000661e0806f2599ddf6da0c3115585605e1e993bbedeb6db198bf31200f12d6de9f47e44a5024eacc729e70726bc4b6ebe8cab082013f9b570e88ec5d5870d3",
+    "18e99919d56fdd3e22858cb498f0a97e981d97a8048f04090bf11c8c1099a786fd738291b345a20fc984a2c2ad222b9bf49c4d698822703ede8f40c4965e11e211b564c6e4263901fa446de57e3d963047728d17407b352d56633fa922091461c2e3ac3fd763126d3119d2511cb44610eaa7cfcee7",
+    "1ec2ad10ceccc0e2aa3d5c77b2d62885b796f435e55545b97fc9dba48edc80d1ae26ff230c9dd3a61ac9ba98ad71bc52fcf39e8f3ce7f2b25bdbde27cea77fb1a914c870f17577130a5e7d22ef8e5ee3d8e84ac5702f60017322e5710d00f7f579a2d179b4edd85dbbc9d4c2a0fbf7559ff819fb",
+    "1ca29db6b6a618c83e5372f99e2c0c25edfa81bc3a0160f77e90839a363c05b568c2c18b12e29c9aa7480ca790957171069dc750b96642981caa5b846fa9f289df4544fee3ab4d9c3886098a1b84a01f0bbf95f35f62cc8d3a9062e8f26816524cfad79f518f45fea86c6aa75b4338adf6c95f",
+    "8289fee939b90c0c83f9341f7ccbdebf45ef145ba0f55d0e8971d696386a6efc35282ac8959c18b62e736b0d55d4281ce1f0ac48e929c12d6e3b30620337a20f551e5474a01c2936cb1579b09d33c1ee930f2b815d3c0fd35195347f6f536dab81e4d6056c7d65690006f0e43f79d8e94723",
+    "5d29accce50be0e547fd2f1381920b612dbabd6f2a59936962e8de4ce9b06878310c59da64fa440d5b1037de97677300caf288fc0b006a7e7ee74972c13fb62a2ebd0d5438d2f83f02f9f903fcda64220de6458ba8ff857f17f44179578c45f00a107db6e32010e254bb68367777f86e25",
+    "440bcfa938c7098d6d0ed45f76dc7c13e3ae3d0a4b8edda21fbf44789e861d614db6d105561c082cab1b38c4d8a43e07acc3e9fce3b4e761b14ef776949f2832d2b31483dd4c37f186c4ba6203fbf9daf3765e820765b8de21fde367a686948ae89323e34b7d355df2bc75607a498e689",
+    "f4bdf1af97454a5b8d7993db3d7bbe31c2d445d35e1b97ee8d7989f68a8c4f3bc413804de00232d42277ad2285e6610c4b79d90a5297d46c96d00de169d2265eb9ff4637d490b8c43adf83d8eb6f320c2bcca23d825580d7c171e5a330d87f4a75354ab5202c1e4d18193205d92ef0d",
+    "270891be4eb5d4fe17eb376743526d10a0b2d21d9c1187b560edb0b9682fbe958ebcdb9c802aa3718d5681461425ae80bc00dc4f357a6ec75f38a36a01f47984bc20e019847a66425c361c6116c41879ee1a591baf5aee16b0f49cc4c45e1a82066b3bb18142988e2bd4e978fc814f",
+    "4b994fba2cbd3c31a3409fb684e1b699acdb71f288ef5b11f67130b1eef13d4e4e59c15e0cb8258ea4b3899068615dea17c8843861fb5c23239464d2f7a4fe98b71046ed9d2334d35454e78b87ff04caffd89060e5a9275ceb54e070e0d499d9ffccfa195e7fbcc452d1f689d567",
+    "5fe14923d668ad5883d4fbb5f227ea5d4a97f7f4aa49315f28517f8567f8c19c01a804e4458f70790a1ad1fe14f52c074b7fc631298a5082f43ad9397692ebb47465efb71290a340aeaef7980804e7c5350f1ef7b0be66dc41206f0012efe028a38a521ea62cd22071cf110407",
+    "120a9c945b339c4a81e3bdb4646ded74874460310edf9313d11020906afa922546131c8b47a5ebdd369885e394dc387f976943d13c597b21664e2a2ca3c9b0fa3c5e9719a03273c90e3b8e4a3e71bcd7a20fa362d1aaa3b84bd825d9cb9eff1bc65870ccb19c33c6934bb473",
+    "124a014d490533a3779da4b2b0bba17243373a1117be793911be1c5c4f840f8972caa16488b19bfa74bf13f6548dc8adb44d954c1477c7db277c7ea35eac8fb6e2b2593441814fe6ad53a06a383c4670e3f62326492dcf2a14238619e3f763385fa7c426e1eadae7afe39ad",
+    "46a6fcf5bfa82e56966b5fc21fdbafb2f3b53e8ce72973a6f41168e95a45c43f90e9e461ef8734b75d122af3c2ae25fed7c5f1826355fd8da089f2bd6cb9043527746cc0f52d19da5ece664c4900cc91cc9bf4ef63537e2841cdb492737e4c0d9323f96ec9009a60ee4f3",
+    "baf4c14c128acd0374483c4ac39290610d7a52dd822745e303d567adf6251db950f91e7b32760c5557cb92baa3f121a3a95255c2aa46ef18d240b39fa426d19015ecc760c75d6d419ec905a3e7060586491c4dfb3074e1bb084c0a662fab06e3be1df26cabc8aaa255",
+    "2f0f1429810bf903ec97c04a15754b4bc13315fac4b47ddac52aba65605f05efddf282d798fbbd5cc329fc6ca431f5222c5b76cc4d36589e2b7b15f255c9b3b9520db49d4a34a4e5d76aa6e5d26f87acd41f8f5c601e557b9592fac382f13003c0d60fc1bbd5fde8c3",
+    "4141adf56d9f1d5541e5c02ec6efc6140d74e6fbcbe35a243cf8013654948365b10857ed4035b08e4a6b68787270a066e59283e4333fc748b9ad879ac532b5a00a92144c1dd995e63744986a9cc44d532131313587bb28561233a26ead368b04f50392b3cbc3df0f",
+    "6b4ceffb072da6f56f7328928e5ecb667407716965c3d485bbbc078a85faf05207c052268db3f624f4eb380244a6bdfbd567b8e8db6334b1ea567d5f0d832bc48f5ed21a00b331c705d459e5287dc0ad62fb4d4a1eccf1b5a19960ea076618d8b1abbaca671bb",
+    "484f3026e083effe732565c956f501f2051a01ed3fe4d6771830808e6f9d88f697cd3cb1fc45e5188914e420d64b91f43cff269ac1a74241b262d92c5d959092137d88548b3d0a7b6b9962b43701d657f41df72306ce0173078b7c0872de19a612341e39bb0f",
+    "264d6f05fcdc46e6eff9af0f44b48970c53d750a6a647e6d029f535e556b028b5f9f75dabb505e6e29e1831bb84894931d1475b41c1701578c82bcc01029a8deead5c162a3a9f0977d74b20c2a2ffca246bd7f4c81c9337e1b5eadb5d2d64f74c9d245b595f",
+    "d3257c60335aba306f615f31efa7b742b7657133ba20ddb590625e6c47e4614b9f8f95ee438fee4508c157eca5f4bc76b2de29fb141fb9d7cb866641ccdfd80a8932352a5a7f04372465f8d67b0f11c7e0bdcac0d2ef2695aa31d382ffe686bc7d2ad8e77",
+    "1ba10a2ad26ba62aff6e7026e4462912e617cad969fa5c9e346c4a09b8611d67d13061b59062e8d2015ba31105cb230b1f707a36b06f238b5b89a8b15aeec86e746603aa239fd4068e96bcd30f9243677225a33c66c2414980f0d0c2ee669974b0b9557f",
+    "295c624d6d3e1ec15e80dfd0a4e22e7e26c2d0999bbf80e7850c1e1038740f515dc6ef38fff56e62d1eab5f2cf8e0e92bd74603062d6d61e7c1818fdaab7a5a708dfc50c8a59e5e3cc99c577a86d76a8d5139af2e947dd8ed6811436e6674f16108bef",
+    "153194a1037caa0b0ed4744f35473b2b25cb9583bc75a58e7656799805727dc41f16e92ab90afdeb42dfbebe7350054e12da21a44bf8fb687ac751dd7cd1aa9c6f3ff2191b2b998426695faa2065b78617f45d446f9af1b3e3224ab478b01cafb549",
+    "81960b4d4e5380659807d89c27c06f841274f03d4afffd1973286b83668869676f255dfca0cddaa85c44eb18dc8f6fd945626e0e8e7d999cc6b911419138a33589c14d7b771cb3ef5fb6906e2ce3586a03d18673c460032c8ab240c84de07c6c49",
+    "26eaaf27d68b2c272c31a06aad08b30d2c88738714130754ae99181c5a5090a6d815e29319a0f2ac9cc870f72fa73d429f1bc38159c80d103788327748f008deccda71e4eb5c5876f7ebefc50ec2f34e9749f6891828fe2fbb051601ea390b6bb",
+    "e0c947634f019a17524460f5d22bf0b00eaab538d264f2f957c87b585377280b2781e428df84801486fde12b65897994cf9e5d3eee42b77a4ed5c58917016e6ebbfea7283e21b0e3c617a8dfea59d56df4c7894b38b00ae88bdaa118287139",
+    "f4cc3e16b8f4231acc7718ebdb16a08be940960a7e8b3c161c1ba170507cbfc4abd16c7445e566c30e6dc2b03bfae925d5baaa93f1528e372435c1ece8186e3a01265b2aac7b6205d8e7b4d106b1c707655232e62896a501cc9f4674e7ec9",
+    "187f291122a12a9ff33a2e7ecdc2fbbe8921b2ccf102f2c3f02e87def65638e32bbfee0806cb1f1a4d9db64b70774f157e0652d3b9f50dd81694295b6bc9e6ef9f936b58ed3d8a40a8d4a1ac5dd9b3fd30bd50b7c0d471491cf2f7364813",
+    "94da40904a737b2cd78ead52fb2b3027dba79f2a68dea3c558d0d849c684753e660f33ced0aa00c3f20f51455505b83783b7cc3afb5a9d6c014f325eeb8bdafbb1684948d62280ab3094d93a58c10f3318e2433b88d046e2e3a5c10d7",
+    "199b1aee33a0c61725b0b489bc99bec3dfb897f797d1e2016940469fe734add70952a493b8054ef453051f41174ae8f085602d22cc4c23e14876daa63b0d9b16e9d107acdc0afbf807233aea67592f6a1d91f19807448c10e6412671",
+    "127923cb7579510d2eece35cf946f009394380dbf108f252b1ab97ad205eefec58ff94acd7c0eb4ed6116766573b94ef8163a7bcdf46011b4149384bef6736fd5f615f32e76e091b2a27c95096802454e2c608984facf6cb10c7f5",
+    "e165c1997a54c2930acc08e7b9a09ae892fee86922a46890b587947a88bdd2223331f3f21f5fa891225254506ac5e4046db710e92712d90cc1f2d3eb5cf24870e54f660568b611fed006440800ec17e0f7ce02e05792e9ba5c1f",
+    "7fd8a819c4e9572561e8d2a0ffb9cd66d1e46d8c3676a4e5faf6269095f86d7d509761129e10e65d77103725390da8fb9823f18310871c2eb752f46f7801e259157bc54edc87c9b7e0e015da81c911c4b01c4ce513a1c1e9e91",
+    "d97222b68b13d37a3a578756b511dbd5fbda27a0f527f4246c17446f7b3040894815a5894397392112db962c87b10fb11c6aecc2c19c6f48ce94676ad473f8a3702dcc0d08e5ce76c50611d78a4b58751cf8eeac57193ea5",
+    "d1b03b9cfc0d4bea2bd7097a25be1fb933d74299c6aa6b629ae2eaf974a590fe9327dd07893f1dcec953ef21a19fb4582c515786349bad13c36ca757390376fa2b4c5c18dbd37b00eddb6438ff0d860d16aec0ce9e0f977",
+    "2174ae88e2bba799cebd461e0c55a34cef6ee896583e2f2cec2cc26ad64b517e94225ba2bfb0d5f9db3e3855430aa3c57b629091ff91aa84c9f0f5072884b60f25cc1e6f995d001fb63735848fa279314c15884ed138d",
+    "8289b27763d791d585afc120aed5424d273315d5eab255c247818817a8e7d2513ab2103d79bcbf968029f2b0a22e8294cb0f5685abe9ac652a90785a330af46423cccd30ccaedfa5cbd31d92c8527067692fde3b8add",
+    "1a948b3f45d96b29327a12f397d5593138ec5bea43a0b60c90d173693a86f39ac55c9740b83fc4e11d9b710b0392f806943dc093924c85347a6b34ef6a8b2b74cdf3f8985f20df9e2088ed8b94c4afc5d040ba609e7",
+    "fbd38ff5091a41a51ebe2afdfddaf0070c69d6391e56f7e37305cf49671803a4636bc7d14d8329b03b3a6edae30b2c8037f5d4d16a411f45b1aaf1575afaf870a41cecff4ab3d066e7d32ff1debe1a6b9b0e31cb",
+    "1c4ca8ae23fbfb4c95b4fa348645276789da1cab29dab6339230951e9eeaaa0162c03d841959be3ce7f86ddaeb7204830b9708b41a15f75d8388b68b35e98189b3cb2ce64248b4cc5db5d50af34a411b2bdfdd9",
+    "80ddcbc16025eac874eeae1bd8d746cd730d309e5bfff90720bbd119f5d2c10f2bdaf95f46d79a03fc1f245b89fc4a8cad1fe54c2add600a29a73ce0bba890025483d8267d4c4cc9fb64cd59c775a151b6d11",
+    "39166d9a76ac3c2745b0323b47b5219f472064f8e2b577b462206366168ba30fd828a9d84667f889375bc5a9fe2c75d68fc500b7a16d3b46444f6240b6b4a4b543d189de52fe73c91eaef0f788df1b925f3",
+    "d5223c1fc3d020e417e58aa361ab8410fbac2663a74facbd4aa5d13d2f8ecf93fc92c2b5fe3bc955de141a2051591204b04f65a0196b66d4cc78f861fd35f9076c342bee346c163d801a298380e80eec7",
+    "bc75c622148cb6b77aef8cb068131eae7aecf93a1ff2ae82f2b5c8da14795e7ffd1883855bfe96ba96ed328e93829250734cf41d339729ecc7ae0ee41f43ec71e65f9dea917ffd61accd25c0d120e291",
+    "1d38ef2e89b620f3afc590eab38501becd4070d2df9fe50bca7a6e3734e6c884ae2c06f419b1908e3977c04f3c160da2629803bfdca068de8cd201e6994461f963fa6d600ee1225bf0cabdf6467c3f5",
+    "1baeb06da907be86847385512ecf22942ff3e1768459b07497aceccc44914c84d2276e2091d4fcbc17a967d1d476de8ffb9881d44910ca9054a3dd0b3d1a0b1b8a7212aac8d8a767c2f9824f1757",
+    "23b6715e77af90f9fbd68e89e81a2adba3b6650259c12dd5ff7ed79f75dcc5c6857e0bbef34198f938919de27c7bbcb7142508539b5dcc598619eb97d13d840f8a3981c81f940d1fd72195ef933",
+    "36e84e8bbe9a782ef86e534e41f706c21cf28d971e95c51c1f158c5f08a509cf7f1d9677972a0699ecb1d96795ab05883ef62f0bd6e225e32bc3849e371ffd7b59da1533fff89a4f121e5ab5",
+    "4f85cd94dd3c41d00d556b5822eca708bf92ce2356047e379d60b08398b051ee3d78ca58c8d51bf3afa18c128f19bd7e2f15bb0ee9d1b6a57f8f8fc078f6d5cc830841ab951912cebb3519f",
+    "2725643ceb224988d84861e061604d9593c2559c5319d24e5af495f44b7539d465d5d32ee7a2799adf75a3f95b4cdb1b47cc05cb06a1c4f6a19587028cc9a0e8ce8ea8b5066e5e6663e249",
+    "663a2ac5d8d93b5ac40b20a9ac992392466788d3bb37133a232c2b2ce8487283d1e815d0512a301de4ecc77cf9a59b9294ec81996f903bed2f6250dc7bee4bb8425f7c79f8abe1d048e1",
+    "cbb4e4eb3393853f30f70bf313f2044cbb0e135c20f342cdd246bf9e55feafca891eea245c6fc670cbfbe701d9d766b2e6ef30570747064e8cafc66623226541e7f850d54e01265d95",
+    "244bd2485c9838f61a655511a93d44b7461eaf5d35617798bb2789028580a4b3712f0339c019b01ecf806def78bf67205074ba7fd5b349c21e0381b5b8537efc627c7a2bd78c8a247",
+    "8a6ea52b8ae94711c0fd1dcb1701714d0d017175bfc33ed996b1e317be1d1fbaf7adb5bb43a1b714290815cb38cbd0c82155b9835f70a1db72a9145779e70693dd9cb68aea59c7",
+    "6a4f3293c25f07257621f026a64b793c3d591dd2f213923664f2073d11646a283d3d412ba53abda9129b181cec72bc105d8cf868272764597b669e99747cadbe390491dfc0c7d",
+    "f331c7a13ac0d64688cbce8abcaf575105afdb88016885227a10d0ea39220b3e49d223f6b66ba68352773bef49fe96915570bd64041850cda48556c6b13d65529478672ca7d",
+    "542866a614707c8a319a3c0ee8677419eb30f11e047d652afd38edbb45a765cfc83dae86beba10b5d252a839592242e9438ef41e2ebd9e6c00b23774b0857ed99684addc19",
+    "b04b7707941546bcf9f976ce0905036c514eda111f3f84fcc5ca09c46b5673eeae28566de4e960bcb3be499a94d57850f739f9529b8f50c16c1763ef6f9b15c29aae350f",
+    "1111cf0f51948ab7bc6227483860f67cf0afa7e404021f7973450b5281cc441219d9e14e0f41f18e423005a8eed18407dd7c8f511f1c4da2e99ad2f7694b8a2819e295b",
+    "d066a7abe60d8267477130e0c4e599ea2d226c97e3a10084677eab8f912dcecff4f65bbf5696d12a8c87efc0ecad8a809d7e476a866d41a0686ecc82e4b751adb34b",
+    "f3c3066cbabd810d4d830620ade0a6fdaa9c518ff3eea29904899bbde4d65930641547d62633db4273218cce3c364478b449d08b2dcf63667373d1fa725abeba7f",
+    "57dc30952870fcc29f1ca57ca13f2eb6bbeacd4bdea7c2ec6e9dd53b2aad8a134bf86f39861d6fc47d024bfacefa275ed85371317fe7bc8ad5bbc1c8ee650759b",
+    "824838d810a9e5b66261de629340c8b631f09b19ae873e6271b59692045de7501b2f92ae0894fd9e08ff244a60c3e945637e72352176b513755c3c1cacd96c1",
+    "47ca97e8e6fdc95e4009499bbfd3c7e7da0509e13ce9cafd058eced3fcd5af14a19ca6b351d5b585c81d70c33c33efb04ffe45b6a105872940799590ab04d9",
+    "778d0ec47eec02ce0355791cdda1bec6a78f5568e29ae9d3df09a6922ecc27961182e885112479038abf1ab78974396be4612b08255899f196cd30c63197",
+    "1d91d22fa7f241ad5579d50dcd8a91edc0f0dd9d99a31fe5bac236c2c48791b596d520dc73dc0f4acb02b4bbde82c5ddd9501e6ba922ee5c126f32dc61",
+    "69b987d04c767f69f9e6c0362f7654513202bb9db52b6d05c7b82a655652dbb1ff152e20afd9d36e9fbdfcfec0642b9648a51f3b395384ad5b0424af",
+    "ea9d35357926e6c4b34af8966b7f7056bd3b32add0c3c3666e8b42681cedc5dacf88407a31a443af147d8ead178a0670632492340f7b73dc11c579",
+    "bd5033ed8461e3773b5159c3161677b1c78689e108c5f603dbe3d623142a100781ba0ecc616937606f14307ed406c11e1f70fa9d82249eb86665",
+    "1b82d6cd02cb3a69eb5f642b01aff322705960fa43cd8ec3fdaafaa318e4f997a0cac75e143b7416afd7f8be858aff469fc2881323bf3e394971",
+    "1871f27337d365052c6fd92081c78dcfbbdcdc96770903b7d0f7546e32c8a2c6536f29acd9c7eda7a6f1ebecc8036c70657d26dd9ab8274d09",
+    "1cbe5505d0e54e3f337e67dc6ae8522073a8b03f274749c8dabfc9d677f5bcd7eef5738415401363aa7c43e7860309e3e746a5fed3681f7",
+    "724243aec594e5cf23438b933bc20bf9a4dc5e0caca89b4d374c75421451a20f97b51197d3d2b6ced242e9c215481813683bace722627",
+    "8f01fb7ed3687647f41ea6672e6d60c999a53d91be1a6629351745c3700db515294d4331d30257023412f01b4a955c29b4a0e0de8579",
+    "2032e32e0bdf700d14a2d1c5ecac33a04a1d18aad4a49c9f324f8777295c94ffd9e4435c28686b065122ea012b2e0ef78b29753d11b",
+    "9eab788050434340ae9e9dfd69ba52ce011b71aeffb95e1f06ebe8ed65acfc1914f53b79ccb4e3998775ce67053615252a7f6bbf9",
+    "12b95bb108faf9a9d7904ca508078049401cd20c07f60918b4c3709bd18fc94ef0cd7b1a0c2f178398ea7bbf78a85404fc0ec5ab",
+    "c8069e769486db8d3dc252e1b6957d3365d0e52959c5e015fc7434cc5c0811d0938c7712776faa2606ce6ac171a70854d8d5f",
+    "1202a0c55bed9e8671f3348d4753ca8a6972d4b0d4a050507b3bc9da59479a38a1f5daae352d99d3ba62e8dedb930552bf9",
+    "4ddc5641e3945abb8726101585cc3be8f0425d42c348c30e9d38eddd4b0b140e7ef2f9c4aa62af5f70a5c30a8568c9c81b",
+    "51c0f778b7b7d8f713cb96e6dac55356f1b8f88fbfc539bb0a16d6829374f516a66701117534b61fddec3dd3d2153b35",
+    "35c219117d59b927b436d1afe49d1ec770619c0a6f307970933c5e404599a8e6dec2c36aca810682a2f6a43bedc985d",
+    "6b9d7edb585500c90f8d48469af7c319c094d50ea970b55fa85323d9690de14c2a2583b4f8ff7f33227edc9215aa7",
+    "4f750d608a3a32fed5ac0a7c8e074239ddbe9ef4f2740a627a2e9d6f25fc886027d7b1a2c72fcab84483a088bd9",
+    "377f6c00e6fe362e251a5bf7484a1bccb2de1696963c0117c0553fa87d2022aa931076d143eedef32e1989973",
+    "1209a4d3e3dedd8e552f2823fa513f3cea38be442805d9c4863394edf35a1bb1ea3f65131800d74c7226561f",
+    "604d73b68690e7e9cb8d973b308933083ec892feeb01c67356a31d1aa80864010018c6e9335c7a8758cbd9",
+    "1118ab7521d92b998fae704ba993eba157c57b4ebe5142a1f88aab21f06ef81b93fecb7a63d13a329bbe9",
+    "2449faa0f2015178402373f7856f8ad5acc7f2149f5870e8643e65af0750bf1d8d54d63782b71068597",
+    "3a4af8e1acc78e840f45aabee3c263c49c7e1cd50a0c5e4a2acf7bd47aee11467e52b98284bdc5451",
+    "378c75673b93b3ec2e14a479e4e574afde12dae5146254fa809a0239f43c9be88f7387d80451f8d",
+    "188fad5287dd8054f7716d48bba23374745d85ac67028dbe004311ee704b82197baf13d8f593f",
+    "685209b9f3f5208996988436067f2e74b222bc2b39945c16165729cd7653f49877712078bf3",
+    "28be990e14ce1e971507e347c41f92eade30c16c7d331d597115b6c7c17910f8e815b30d2b",
+};
+
+static const int gamma_taylor_table_chunks[] = {
+    1, 5, -5, -5, 5, -5, -5, 5, -5, -5, 5, -5, -5, 5, -5, 5,
+    5, -5, 5, 5, -5, 5, -5, -5, 5, -5, 5, 5, -5, 5, 5, -5,
+    5, -5, -5, 5, -5, 5, 5, -4, 4, -4, 4, 4, -4, 4, -4, -4,
+    4, -4, 4, 4, -4, 4, -4, -4, 4, -4, 4, -4, -4, 4, -4, 4,
+    4, -4, 4, -4, -4, 4, -4, 4, -4, -4, 4, -4, 4, -4, -4, 4,
+    -4, 4, 4, -4, 4, -4, 4, 4, -4, 4, -4, -4, 4, -4, 4, -4,
+    -4, 4, -4, 4, -4, -4, 4, -4, 4, -4, -4, 4, -4, 4, -4, -4,
+    4, -4, 4, 4, -4, 4, -4, 4, 4, -4, 4, -4, 4, 4, -4, 4,
+    -4, 4, 4, -4, 4, -4, 4, 4, -4, 4, -4, 4, 4, -4, 4, -4,
+    4, 4, -4, 4, -4, 4, 4, -4, 4, -4, 4, 4, -4, 4, -4, 4,
+    4, -4, 4, -4, 4, -4, -4, 4, -4, 4, -4, -4, 4, -4, 4, -4,
+    -4, 4, -4, 4, -4, -4, 4, -4, 4, -4, -4, 4, -4, 4, -4, 4,
+    4, -4, 4, -4, 4, 4, -4, 4, -4, 4, 4, -4, 4, -4, 4, -4,
+    -4, 4, -4, 4, -4, -4, 4, -4, 4, -4, -4, 4, -4, 4, -4, 4,
+    4, -4, 4, -4, 4, 4, -4, 4, -4, 4, 4, -4, 4, -4, 4, -4,
+    -4, 4, -4, 4, -4, -4, 4, -4, 3, -3, 3, 3, -3, 3, -3, 3,
+    3, -3, 3, -3, 3, -3, -3, 3, -3, 3, -3, -3, 3, -3, 3, -3,
+    3, 3, -3, 3, -3, 3, 3, -3, 3, -3, 3, -3, -3, 3, -3, 3,
+    -3, -3, 3, -3, 3, -3, 3, 3, -3, 3, -3, 3, -3, -3, 3, -3,
+    3, -3, -3, 3, -3, 3, -3, 3, 3, -3, 3, -3, 3, -3, -3, 3,
+    -3, 3, -3, -3, 3, -3, 3, -3, 3, 3, -3, 3, -3, 3, -3, -3,
+    3, -3, 3, -3, -3, 3, -3, 3, -3, 3, 3, -3, 3, -3, 3, -3,
+    -3, 3, -3, 3, -3, 3, 3, -3, 3, -3, 3, 3, -3, 3, -3, 3,
+    -3, -3, 3, -3, 3, -3, 3, 3, -3, 3, -3, 3, -3, -3, 3, -3,
+    3, -3, -3, 3, -3, 3, -3, 3, 3, -3, 3, -3, 3, -3, -3, 3,
+    -3, 3, -3, 3, 3, -3, 3, -3, 3, -3, -3, 3, -3, 3, -3, 3,
+    3, -2, 2, -2, 2, -2, -2, 2, -2, 2, -2, -2, 2, -2, 2, -2,
+    2, 2, -2, 2, -2, 2, -2, -2, 2, -2, 2, -2, 2, 2, -2, 2,
+    -2, 2, -2, -2, 2, -2, 2, -2, 2, 2, -2, 2, -2, 2, -2, -2,
+    2, -2, 2, -2, 2, 2, -2, 2, -2, 2, -2, -2, 2, -2, 2, -2,
+    2, 2, -2, 2, -2, 2, -2, -2, 2, -2, 2, -2, 2, 2, -2, 2,
+    -2, 2, -2, -2, 2, -2, 2, -2, 2, 2, -2, 2, -2, 2, -2, -2,
+    2, -2, 2, -2, 2, 2, -2, 2, -2, 2, -2, -2, 2, -2, 2, -2,
+    2, 2, -2, 2, -2, 2, -2, -2, 2, -2, 2, -2, 2, 2, -2, 2,
+    -2, 2, -2, -2, 2, -2, 2, -2, 2, -2, -2, 2, -2, 2, -2, 2,
+    2, -2, 2, -2, 2, -2, -2, 2, -2, 2, -2, 2, 2, -1, 1, -1,
+    1, -1, -1, 1, -1, 1, -1, 1, 1, -1, 1, -1, 1, -1, -1, 1,
+    -1, 1, -1, 1, 1, -1, 1, -1, 1, -1, 1, 1, -1, 1, -1, 1,
+    -1, -1, 1, -1, 1, -1, 1, 1, -1, 1, -1, 1, -1, -1, 1, -1,
+    1, -1, 1, 1, -1, 1, -1, 1, -1, 1, 1, -1, 1, -1, 1, -1,
+    -1, 1, -1, 1, -1, 1, 1, -1, 1, -1, 1, -1, -1, 1, -1, 1,
+    -1, 1, 1, -1, 1, -1, 1, -1, 1, 1, -1, 1, -1, 1, -1, -1,
+    1, -1, 1, -1, 1, 1, -1, 1,
+};
+
+static const long gamma_taylor_table_exp[] = {
+    0L, -4200L, -4200L, -4200L, -4199L, -4200L, -4200L, -4200L,
+    -4198L, -4198L, -4200L, -4199L, -4200L, -4200L, -4198L, -4200L,
+    -4199L, -4200L, -4200L, -4200L, -4198L, -4199L, -4198L, -4200L,
+    -4200L, -4200L, -4200L, -4197L, -4200L, -4198L, -4200L, -4199L,
+    -4200L, -4197L, -4196L, -4199L, -4200L, -4199L, -4200L, -4195L,
+    -4196L, -4200L, -4200L, -4200L, -4199L, -4197L, -4198L, -4197L,
+    -4199L, -4199L, -4200L, -4198L, -4196L, -4199L, -4196L, -4199L,
+    -4199L, -4200L, -4200L, -4200L, -4194L, -4197L, -4199L, -4200L,
+    -4200L, -4198L, -4200L, -4198L, -4199L, -4198L, -4199L, -4200L,
+    -4198L, -4200L, -4196L, -4199L, -4199L, -4198L, -4198L, -4200L,
+    -4199L, -4199L, -4199L, -4200L, -4199L, -4200L, -4200L, -4199L,
+    -4199L, -4200L, -4200L, -4200L, -4200L, -4200L, -4200L, -4198L,
+    -4198L, -4199L, -4200L, -4199L, -4196L, -4200L, -4199L, -4199L,
+    -4200L, -4199L, -4199L, -4198L, -4200L, -4197L, -4199L, -4199L,
+    -4199L, -4200L, -4197L, -4198L, -4199L, -4200L, -4199L, -4199L,
+    -4200L, -4198L, -4199L, -4200L, -4200L, -4200L, -4199L, -4199L,
+    -4200L, -4200L, -4199L, -4200L, -4197L, -4197L, -4197L, -4200L,
+    -4200L, -4200L, -4198L, -4200L, -4200L, -4196L, -4200L, -4198L,
+    -4200L, -4200L, -4200L, -4198L, -4198L, -4197L, -4200L, -4196L,
+    -4200L, -4197L, -4194L, -4200L, -4200L, -4195L, -4200L, -4198L,
+    -4200L, -4199L, -4200L, -4199L, -4200L, -4200L, -4199L, -4199L,
+    -4200L, -4200L, -4198L, -4200L, -4197L, -4200L, -4198L, -4199L,
+    -4199L, -4200L, -4200L, -4200L, -4198L, -4200L, -4199L, -4198L,
+    -4200L, -4200L, -4198L, -4200L, -4200L, -4200L, -4199L, -4198L,
+    -4198L, -4197L, -4200L, -4197L, -4200L, -4199L, -4200L, -4199L,
+    -4197L, -4199L, -4200L, -4198L, -4200L, -4200L, -4200L, -4199L,
+    -4199L, -4198L, -4197L, -4200L, -4200L, -4200L, -4200L, -4200L,
+    -4199L, -4199L, -4198L, -4200L, -4198L, -4200L, -4200L, -4200L,
+    -4198L, -4200L, -4200L, -4200L, -4197L, -4198L, -4198L, -4200L,
+    -4200L, -4198L, -4199L, -4200L, -4196L, -4199L, -4198L, -4198L,
+    -4200L, -4200L, -4197L, -4199L, -4199L, -4200L, -4199L, -4200L,
+    -4200L, -4200L, -4200L, -4200L, -4200L, -4200L, -4200L, -4200L,
+    -4199L, -4199L, -4197L, -4200L, -4196L, -4200L, -4200L, -4200L,
+    -4199L, -4196L, -4200L, -4196L, -4197L, -4199L, -4197L, -4200L,
+    -4200L, -4197L, -4200L, -4197L, -4200L, -4200L, -4200L, -4200L,
+    -4200L, -4200L, -4200L, -4200L, -4200L, -4200L, -4199L, -4197L,
+    -4200L, -4200L, -4197L, -4200L, -4200L, -4200L, -4200L, -4199L,
+    -4200L, -4200L, -4200L, -4200L, -4200L, -4199L, -4200L, -4198L,
+    -4199L, -4200L, -4199L, -4200L, -4199L, -4200L, -4198L, -4200L,
+    -4200L, -4200L, -4198L, -4200L, -4198L, -4200L, -4200L, -4198L,
+    -4200L, -4199L, -4199L, -4199L, -4199L, -4199L, -4200L, -4200L,
+    -4200L, -4200L, -4198L, -4200L, -4199L, -4200L, -4198L, -4200L,
+    -4200L, -4197L, -4200L, -4199L, -4199L, -4199L, -4200L, -4200L,
+    -4200L, -4199L, -4197L, -4199L, -4200L, -4199L, -4200L, -4199L,
+    -4196L, -4200L, -4200L, -4196L, -4200L, -4200L, -4200L, -4200L,
+    -4200L, -4199L, -4199L, -4195L, -4199L, -4200L, -4200L, -4199L,
+    -4199L, -4199L, -4199L, -4199L, -4199L, -4199L, -4200L, -4198L,
+    -4200L, -4198L, -4200L, -4199L, -4196L, -4197L, -4200L, -4196L,
+    -4199L, -4200L, -4199L, -4199L, -4198L, -4200L, -4199L, -4199L,
+    -4196L, -4200L, -4198L, -4200L, -4200L, -4200L, -4199L, -4199L,
+    -4197L, -4200L, -4198L, -4197L, -4199L, -4199L, -4200L, -4200L,
+    -4200L, -4199L, -4197L, -4200L, -4200L, -4200L, -4199L, -4200L,
+    -4200L, -4199L, -4199L, -4200L, -4199L, -4200L, -4198L, -4200L,
+    -4200L, -4200L, -4198L, -4200L, -4196L, -4200L, -4200L, -4200L,
+    -4197L, -4200L, -4199L, -4200L, -4200L, -4200L, -4199L, -4200L,
+    -4198L, -4200L, -4199L, -4199L, -4200L, -4200L, -4199L, -4199L,
+    -4200L, -4197L, -4199L, -4200L, -4199L, -4199L, -4198L, -4197L,
+    -4200L, -4200L, -4200L, -4200L, -4199L, -4200L, -4200L, -4200L,
+    -4198L, -4199L, -4199L, -4197L, -4200L, -4200L, -4198L, -4200L,
+    -4198L, -4199L, -4200L, -4198L, -4200L, -4199L, -4198L, -4200L,
+    -4199L, -4200L, -4200L, -4196L, -4199L, -4200L, -4197L, -4200L,
+    -4200L, -4200L, -4200L, -4197L, -4200L, -4200L, -4200L, -4199L,
+    -4199L, -4198L, -4200L, -4199L, -4199L, -4200L, -4200L, -4200L,
+    -4199L, -4199L, -4200L, -4200L, -4198L, -4200L, -4200L, -4200L,
+    -4199L, -4200L, -4200L, -4200L, -4199L, -4200L, -4200L, -4197L,
+    -4199L, -4196L, -4200L, -4197L, -4200L, -4199L, -4200L, -4200L,
+    -4200L, -4200L, -4199L, -4200L, -4200L, -4199L, -4200L, -4200L,
+    -4196L, -4200L, -4198L, -4198L, -4198L, -4200L, -4200L, -4199L,
+    -4199L, -4198L, -4200L, -4195L, -4200L, -4200L, -4200L, -4198L,
+    -4199L, -4199L, -4199L, -4200L, -4199L, -4200L, -4200L, -4197L,
+    -4200L, -4198L, -4197L, -4200L, -4199L, -4199L, -4200L, -4198L,
+    -4197L, -4200L, -4200L, -4199L, -4199L, -4200L, -4199L, -4199L,
+    -4200L, -4199L, -4200L, -4199L, -4200L, -4195L, -4198L, -4198L,
+    -4197L, -4200L, -4200L, -4199L, -4198L, -4200L, -4200L, -4200L,
+    -4200L, -4200L, -4200L, -4200L, -4200L, -4199L, -4199L, -4195L,
+    -4200L, -4200L, -4199L, -4198L, -4199L, -4200L, -4200L, -4200L,
+    -4200L, -4200L, -4200L, -4197L, -4200L, -4200L, -4199L, -4199L,
+    -4196L, -4198L, -4200L, -4196L, -4200L, -4197L, -4200L, -4200L,
+    -4198L, -4198L, -4200L, -4200L, -4198L, -4200L, -4200L, -4195L,
+    -4199L, -4199L, -4198L, -4199L, -4199L, -4199L, -4200L, -4199L,
+    -4200L, -4199L, -4200L, -4200L, -4200L, -4200L, -4199L, -4199L,
+    -4198L, -4200L, -4200L, -4198L, -4200L, -4198L, -4196L, -4200L,
+    -4199L, -4195L, -4200L, -4199L, -4199L, -4200L, -4200L, -4199L,
+    -4197L, -4200L, -4198L, -4200L, -4200L, -4199L, -4199L, -4200L,
+    -4200L, -4200L, -4200L, -4200L, -4200L, -4199L, -4198L, -4199L,
+};
@@ -0,0 +1,92 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "gamma.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("log_rising_fmpcb_ui....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* compare with the sum of the logarithms of the factors */
+    for (iter = 0; iter < 1000; iter++)
+    {
+        fmpcb_t x, y, z, t;
+        ulong n, k;
+        long prec;
+
+        fmpcb_init(x);
+        fmpcb_init(y);
+        fmpcb_init(z);
+        fmpcb_init(t);
+
+        fmpcb_randtest(x, state, 1 + n_randint(state, 1000), 1 + n_randint(state, 10));
+        n = n_randint(state, 200);
+        prec = 2 + n_randint(state, 1000);
+
+        if (n_randint(state, 2))
+        {
+            gamma_log_rising_fmpcb_ui(y, x, n, prec);
+        }
+        else
+        {
+            fmpcb_set(y, x);
+            gamma_log_rising_fmpcb_ui(y, y, n, prec);
+        }
+
+        fmpcb_zero(z);
+        for (k = 0; k < n; k++)
+        {
+            fmpcb_add_ui(t, x, k, prec);
+            fmpcb_log(t, t, prec);
+            fmpcb_add(z, z, t, prec);
+        }
+
+        if (!fmpcb_overlaps(y, z))
+        {
+            printf("FAIL: overlap\n\n");
+            printf("n = %lu\n", n);
+            printf("x = "); fmpcb_print(x); printf("\n\n");
+            printf("y = "); fmpcb_print(y); printf("\n\n");
+            printf("z = "); fmpcb_print(z); printf("\n\n");
+            abort();
+        }
+
+        fmpcb_clear(x);
+        fmpcb_clear(y);
+        fmpcb_clear(z);
+        fmpcb_clear(t);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,113 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "gamma.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("rising_fmpcb_ui_multipoint....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* compare with binary splitting */
+    for (iter = 0; iter < 1000; iter++)
+    {
+        fmpcb_t x, y, z;
+        ulong n;
+        long prec;
+
+        fmpcb_init(x);
+        fmpcb_init(y);
+        fmpcb_init(z);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        fmpcb_randtest(x, state, 1 + n_randint(state, 500), 10);
+
+        if (n_randint(state, 10) == 0)
+            n = n_randint(state, 3000);
+        else
+            n = n_randint(state, 100);
+
+        prec = 2 + n_randint(state, 500);
+
+        gamma_rising_fmpcb_ui_multipoint(y, x, n, prec);
+        gamma_rising_fmpcb_ui_bsplit(z, x, n, prec);
+
+        if (!fmpcb_overlaps(y, z))
+        {
+            printf("FAIL: overlap\n\n");
+            printf("n = %lu\n", n);
+            printf("x = "); fmpcb_print(x); printf("\n\n");
+            printf("y = "); fmpcb_print(y); printf("\n\n");
+            printf("z = "); fmpcb_print(z); printf("\n\n");
+            abort();
+        }
+
+        fmpcb_clear(x);
+        fmpcb_clear(y);
+        fmpcb_clear(z);
+    }
+
+    /* aliasing of y and x */
+    for (iter = 0; iter < 1000; iter++)
+    {
+        fmpcb_t x, y;
+        ulong n;
+        long prec;
+
+        fmpcb_init(x);
+        fmpcb_init(y);
+
+        fmpcb_randtest(x, state, 1 + n_randint(state, 200), 10);
+        fmpcb_randtest(y, state, 1 + n_randint(state, 200), 10);
+        n = n_randint(state, 100);
+
+        prec = 2 + n_randint(state, 200);
+        gamma_rising_fmpcb_ui_multipoint(y, x, n, prec);
+        gamma_rising_fmpcb_ui_multipoint(x, x, n, prec);
+
+        if (!fmpcb_equal(x, y))
+        {
+            printf("FAIL: aliasing\n\n");
+            printf("x = "); fmpcb_print(x); printf("\n\n");
+            printf("y = "); fmpcb_print(y); printf("\n\n");
+            printf("n = %lu\n", n);
+            abort();
+        }
+
+        fmpcb_clear(x);
+        fmpcb_clear(y);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
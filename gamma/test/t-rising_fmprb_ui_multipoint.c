@@ -85,6 +85,41 @@ int main()
         fmpq_clear(z);
     }
 
+    /* compare with binary splitting, for larger n and several threads */
+    for (iter = 0; iter < 200; iter++)
+    {
+        fmprb_t x, y, z;
+        ulong n;
+        long prec;
+
+        fmprb_init(x);
+        fmprb_init(y);
+        fmprb_init(z);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        fmprb_randtest_precise(x, state, 1 + n_randint(state, 500), 10);
+        n = n_randint(state, 3000);
+        prec = 2 + n_randint(state, 500);
+
+        gamma_rising_fmprb_ui_multipoint(y, x, n, prec);
+        gamma_rising_fmprb_ui_bsplit(z, x, n, prec);
+
+        if (!fmprb_overlaps(y, z))
+        {
+            printf("FAIL: overlap\n\n");
+            printf("n = %lu\n", n);
+            printf("x = "); fmprb_print(x); printf("\n\n");
+            printf("y = "); fmprb_print(y); printf("\n\n");
+            printf("z = "); fmprb_print(z); printf("\n\n");
+            abort();
+        }
+
+        fmprb_clear(x);
+        fmprb_clear(y);
+        fmprb_clear(z);
+    }
+
     /* aliasing of y and x */
     for (iter = 0; iter < 10000; iter++)
     {
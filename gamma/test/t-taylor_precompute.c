@@ -0,0 +1,159 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "gamma.h"
+#include "fmprb_poly.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+    fmprb_srcptr x;
+    fmprb_ptr y;
+    const long * prec;
+}
+taylor_test_arg_t;
+
+static void
+_taylor_test_worker(void * arg_ptr, long i)
+{
+    const taylor_test_arg_t * arg = (const taylor_test_arg_t *) arg_ptr;
+
+    gamma_taylor_fmprb(arg->y + i, arg->x + i, arg->prec[i]);
+}
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("taylor_precompute....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* extending the table gives the same coefficients */
+    for (iter = 0; iter < 30; iter++)
+    {
+        fmprb_poly_t A;
+        long i, num1, num2, prec;
+
+        fmprb_poly_init(A);
+
+        gamma_taylor_cleanup();
+
+        prec = 2 + n_randint(state, 1000);
+        num1 = 1 + n_randint(state, 50);
+        num2 = num1 + n_randint(state, 200);
+
+        gamma_taylor_precompute(num1, prec);
+        gamma_taylor_precompute(num2, prec);
+
+        if (gamma_taylor_num < num2 || gamma_taylor_prec < prec)
+        {
+            printf("FAIL: num = %ld, prec = %ld\n", gamma_taylor_num,
+                gamma_taylor_prec);
+            abort();
+        }
+
+        fmprb_poly_set_coeff_si(A, 0, 1);
+        fmprb_poly_set_coeff_si(A, 1, 1);
+        fmprb_poly_lgamma_series(A, A, num2, prec + 30);
+        fmprb_poly_neg(A, A);
+        fmprb_poly_exp_series(A, A, num2, prec + 30);
+
+        for (i = 0; i < num2; i++)
+        {
+            if (!fmprb_overlaps(gamma_taylor_coeffs + i, A->coeffs + i))
+            {
+                printf("FAIL: overlap, i = %ld\n\n", i);
+                printf("table = "); fmprb_printd(gamma_taylor_coeffs + i, 30);
+                printf("\n\n");
+                printf("series = "); fmprb_printd(A->coeffs + i, 30);
+                printf("\n\n");
+                abort();
+            }
+        }
+
+        fmprb_poly_clear(A);
+    }
+
+    /* concurrent use from several threads */
+    for (iter = 0; iter < 20; iter++)
+    {
+        taylor_test_arg_t arg;
+        fmprb_ptr x, y;
+        fmprb_t z;
+        long * prec;
+        long i, num;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        if (n_randint(state, 2))
+            gamma_taylor_cleanup();
+
+        num = 1 + n_randint(state, 30);
+        x = _fmprb_vec_init(num);
+        y = _fmprb_vec_init(num);
+        prec = flint_malloc(sizeof(long) * num);
+        fmprb_init(z);
+
+        for (i = 0; i < num; i++)
+        {
+            fmprb_randtest_precise(x + i, state, 1 + n_randint(state, 1000), 3);
+            prec[i] = 2 + n_randint(state, 2000);
+        }
+
+        arg.x = x;
+        arg.y = y;
+        arg.prec = prec;
+
+        thread_pool_parallel_for(_taylor_test_worker, &arg, num,
+            flint_get_num_threads());
+
+        for (i = 0; i < num; i++)
+        {
+            fmprb_gamma(z, x + i, prec[i] + 30);
+
+            if (!fmprb_overlaps(y + i, z))
+            {
+                printf("FAIL: threaded\n\n");
+                printf("x = "); fmprb_print(x + i); printf("\n\n");
+                printf("y = "); fmprb_print(y + i); printf("\n\n");
+                printf("z = "); fmprb_print(z); printf("\n\n");
+                abort();
+            }
+        }
+
+        _fmprb_vec_clear(x, num);
+        _fmprb_vec_clear(y, num);
+        flint_free(prec);
+        fmprb_clear(z);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
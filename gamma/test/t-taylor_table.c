@@ -0,0 +1,121 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include <string.h>
+#include "gamma.h"
+
+/* the checked-in table, whether or not the library uses it */
+#include "../taylor_table.h"
+
+int main()
+{
+    fmprb_ptr t;
+    fmpz_t u;
+    fmpz * m;
+    long i, j, k, n;
+
+    printf("taylor_table....");
+    fflush(stdout);
+
+    t = _fmprb_vec_init(GAMMA_TAYLOR_TABLE_NUM);
+    fmpz_init(u);
+
+    for (i = k = 0; i < GAMMA_TAYLOR_TABLE_NUM; i++)
+    {
+        m = fmpr_manref(fmprb_midref(t + i));
+        n = FLINT_ABS(gamma_taylor_table_chunks[i]);
+
+        for (j = 0; j < n; j++, k++)
+        {
+            fmpz_set_str(u, gamma_taylor_table_man[k], 16);
+            fmpz_mul_2exp(m, m, 4 * strlen(gamma_taylor_table_man[k]));
+            fmpz_add(m, m, u);
+        }
+
+        if (gamma_taylor_table_chunks[i] < 0)
+            fmpz_neg(m, m);
+
+        fmpz_set_si(fmpr_expref(fmprb_midref(t + i)),
+            gamma_taylor_table_exp[i]);
+        mag_set_ui_2exp_si(fmprb_radref(t + i),
+            1, -GAMMA_TAYLOR_TABLE_ABS_PREC);
+
+        /* mantissas are normalised */
+        if (!fmpr_is_zero(fmprb_midref(t + i)) &&
+            fmpz_is_even(fmpr_manref(fmprb_midref(t + i))))
+        {
+            printf("FAIL: even mantissa, i = %ld\n", i);
+            abort();
+        }
+    }
+
+    if (GAMMA_TAYLOR_TABLE_NUM < gamma_taylor_coeffs_for_prec(GAMMA_TAYLOR_TABLE_PREC))
+    {
+        printf("FAIL: table too short\n");
+        abort();
+    }
+
+    /* compare with coefficients computed to higher precision; this
+       precision is not covered by the table, so they are computed
+       even if the library is built with GAMMA_TAYLOR_STATIC_TABLE */
+    gamma_taylor_cleanup();
+    gamma_taylor_precompute(GAMMA_TAYLOR_TABLE_NUM,
+        GAMMA_TAYLOR_TABLE_ABS_PREC + 64);
+
+    for (i = 0; i < GAMMA_TAYLOR_TABLE_NUM; i++)
+    {
+        if (!fmprb_contains(t + i, gamma_taylor_coeffs + i))
+        {
+            printf("FAIL: i = %ld\n\n", i);
+            printf("table = "); fmprb_printd(t + i, 30); printf("\n\n");
+            printf("computed = "); fmprb_printd(gamma_taylor_coeffs + i, 30);
+            printf("\n\n");
+            abort();
+        }
+    }
+
+    /* a table loaded at low precision agrees with the computed values */
+    gamma_taylor_cleanup();
+    gamma_taylor_precompute(GAMMA_TAYLOR_TABLE_NUM + 100, 200);
+
+    for (i = 0; i < GAMMA_TAYLOR_TABLE_NUM; i++)
+    {
+        if (!fmprb_overlaps(t + i, gamma_taylor_coeffs + i))
+        {
+            printf("FAIL (low precision): i = %ld\n\n", i);
+            printf("table = "); fmprb_printd(t + i, 30); printf("\n\n");
+            printf("computed = "); fmprb_printd(gamma_taylor_coeffs + i, 30);
+            printf("\n\n");
+            abort();
+        }
+    }
+
+    _fmprb_vec_clear(t, GAMMA_TAYLOR_TABLE_NUM);
+    fmpz_clear(u);
+
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
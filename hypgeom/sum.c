@@ -24,6 +24,7 @@
 ******************************************************************************/
 
 #include "hypgeom.h"
+#include "bsplit.h"
 
 static __inline__ void
 fmpz_poly_evaluate_si(fmpz_t y, const fmpz_poly_t poly, long x)
@@ -93,8 +94,86 @@ bsplit_recursive_fmpz(fmpz_t P, fmpz_t Q, fmpz_t B, fmpz_t T,
     }
 }
 
+typedef struct
+{
+    fmprb_t P;
+    fmprb_t Q;
+    fmprb_t B;
+    fmprb_t T;
+}
+hypgeom_bsplit_struct;
+
+typedef struct
+{
+    const hypgeom_struct * hyp;
+    long prec;
+}
+hypgeom_bsplit_arg_t;
+
+/* sets L = L * R; the independent multiplications are done in parallel */
+static void
+bsplit_merge_fmprb(hypgeom_bsplit_struct * L, hypgeom_bsplit_struct * R,
+    int cont, long prec, long num_threads)
+{
+    fmprb_t u[5];
+    fmprb_ptr z[5];
+    fmprb_srcptr x[5], y[5];
+    long i, n;
+
+    for (i = 0; i < 5; i++)
+    {
+        fmprb_init(u[i]);
+        z[i] = u[i];
+    }
+
+    if (fmprb_is_one(L->B) && fmprb_is_one(R->B))
+    {
+        /* T = T Q2 + P T2, Q = Q Q2, P = P P2 */
+        x[0] = L->T; y[0] = R->Q;
+        x[1] = L->P; y[1] = R->T;
+        x[2] = L->Q; y[2] = R->Q;
+        x[3] = L->P; y[3] = R->P;
+        n = cont ? 4 : 3;
+
+        bsplit_fmprb_mul_batch(z, x, y, n, prec, num_threads);
+
+        fmprb_add(L->T, u[0], u[1], prec);
+        fmprb_swap(L->Q, u[2]);
+        if (cont)
+            fmprb_swap(L->P, u[3]);
+    }
+    else
+    {
+        /* T = T B2 Q2 + P B T2, B = B B2, Q = Q Q2, P = P P2 */
+        x[0] = L->T; y[0] = R->B;
+        x[1] = R->T; y[1] = L->B;
+        x[2] = L->Q; y[2] = R->Q;
+        x[3] = L->B; y[3] = R->B;
+        x[4] = L->P; y[4] = R->P;
+        n = cont ? 5 : 4;
+
+        bsplit_fmprb_mul_batch(z, x, y, n, prec, num_threads);
+
+        fmprb_swap(L->Q, u[2]);
+        fmprb_swap(L->B, u[3]);
+
+        /* R->T is no longer needed */
+        z[0] = R->T; x[0] = u[0]; y[0] = R->Q;
+        z[1] = u[1]; x[1] = L->P; y[1] = u[1];
+
+        bsplit_fmprb_mul_batch(z, x, y, 2, prec, num_threads);
+
+        fmprb_add(L->T, R->T, u[1], prec);
+        if (cont)
+            fmprb_swap(L->P, u[4]);
+    }
+
+    for (i = 0; i < 5; i++)
+        fmprb_clear(u[i]);
+}
+
 static void
-bsplit_recursive_fmprb(fmprb_t P, fmprb_t Q, fmprb_t B, fmprb_t T,
+bsplit_recursive_fmprb(hypgeom_bsplit_struct * S,
     const hypgeom_t hyp, long a, long b, int cont, long prec)
 {
     if (b - a < 4)
@@ -108,10 +187,10 @@ bsplit_recursive_fmprb(fmprb_t P, fmprb_t Q, fmprb_t B, fmprb_t T,
 
         bsplit_recursive_fmpz(PP, QQ, BB, TT, hyp, a, b, cont);
 
-        fmprb_set_fmpz(P, PP);
-        fmprb_set_fmpz(Q, QQ);
-        fmprb_set_fmpz(B, BB);
-        fmprb_set_fmpz(T, TT);
+        fmprb_set_fmpz(S->P, PP);
+        fmprb_set_fmpz(S->Q, QQ);
+        fmprb_set_fmpz(S->B, BB);
+        fmprb_set_fmpz(S->T, TT);
 
         fmpz_clear(PP);
         fmpz_clear(QQ);
@@ -121,41 +200,61 @@ bsplit_recursive_fmprb(fmprb_t P, fmprb_t Q, fmprb_t B, fmprb_t T,
     else
     {
         long m;
-        fmprb_t P2, Q2, B2, T2;
+        hypgeom_bsplit_struct R;
 
         m = (a + b) / 2;
 
-        fmprb_init(P2);
-        fmprb_init(Q2);
-        fmprb_init(B2);
-        fmprb_init(T2);
+        fmprb_init(R.P);
+        fmprb_init(R.Q);
+        fmprb_init(R.B);
+        fmprb_init(R.T);
 
-        bsplit_recursive_fmprb(P, Q, B, T, hyp, a, m, 1, prec);
-        bsplit_recursive_fmprb(P2, Q2, B2, T2, hyp, m, b, 1, prec);
+        bsplit_recursive_fmprb(S, hyp, a, m, 1, prec);
+        bsplit_recursive_fmprb(&R, hyp, m, b, 1, prec);
+        bsplit_merge_fmprb(S, &R, cont, prec, 1);
 
-        if (fmprb_is_one(B) && fmprb_is_one(B2))
-        {
-            fmprb_mul(T, T, Q2, prec);
-            fmprb_addmul(T, P, T2, prec);
-        }
-        else
-        {
-            fmprb_mul(T, T, B2, prec);
-            fmprb_mul(T, T, Q2, prec);
-            fmprb_mul(T2, T2, B, prec);
-            fmprb_addmul(T, P, T2, prec);
-        }
+        fmprb_clear(R.P);
+        fmprb_clear(R.Q);
+        fmprb_clear(R.B);
+        fmprb_clear(R.T);
+    }
+}
 
-        fmprb_mul(B, B, B2, prec);
-        fmprb_mul(Q, Q, Q2, prec);
-        if (cont)
-            fmprb_mul(P, P, P2, prec);
+static void
+bsplit_init(void * state, void * args)
+{
+    hypgeom_bsplit_struct * S = state;
 
-        fmprb_clear(P2);
-        fmprb_clear(Q2);
-        fmprb_clear(B2);
-        fmprb_clear(T2);
-    }
+    fmprb_init(S->P);
+    fmprb_init(S->Q);
+    fmprb_init(S->B);
+    fmprb_init(S->T);
+}
+
+static void
+bsplit_clear(void * state, void * args)
+{
+    hypgeom_bsplit_struct * S = state;
+
+    fmprb_clear(S->P);
+    fmprb_clear(S->Q);
+    fmprb_clear(S->B);
+    fmprb_clear(S->T);
+}
+
+static void
+bsplit_basecase(void * state, long a, long b, int cont, void * args)
+{
+    hypgeom_bsplit_arg_t * arg = args;
+    bsplit_recursive_fmprb(state, arg->hyp, a, b, cont, arg->prec);
+}
+
+static void
+bsplit_merge(void * L, void * R, long a, long m, long b,
+    int cont, long num_threads, void * args)
+{
+    hypgeom_bsplit_arg_t * arg = args;
+    bsplit_merge_fmprb(L, R, cont, arg->prec, num_threads);
 }
 
 void
@@ -168,15 +267,29 @@ fmprb_hypgeom_sum(fmprb_t P, fmprb_t Q, const hypgeom_t hyp, const long n, long
     }
     else
     {
-        fmprb_t B, T;
-        fmprb_init(B);
-        fmprb_init(T);
-        bsplit_recursive_fmprb(P, Q, B, T, hyp, 0, n, 0, prec);
-        if (!fmprb_is_one(B))
-            fmprb_mul(Q, Q, B, prec);
-        fmprb_swap(P, T);
-        fmprb_clear(B);
-        fmprb_clear(T);
+        hypgeom_bsplit_struct S;
+        hypgeom_bsplit_arg_t arg;
+        bsplit_t B;
+
+        arg.hyp = hyp;
+        arg.prec = prec;
+
+        B->size = sizeof(hypgeom_bsplit_struct);
+        B->init = bsplit_init;
+        B->clear = bsplit_clear;
+        B->basecase = bsplit_basecase;
+        B->merge = bsplit_merge;
+        B->args = &arg;
+
+        bsplit_init(&S, &arg);
+        bsplit_eval(&S, B, 0, n, 0, flint_get_num_threads());
+
+        if (!fmprb_is_one(S.B))
+            fmprb_mul(S.Q, S.Q, S.B, prec);
+
+        fmprb_swap(P, S.T);
+        fmprb_swap(Q, S.Q);
+        bsplit_clear(&S, &arg);
     }
 }
 
@@ -216,7 +329,7 @@ fmprb_hypgeom_infsum(fmprb_t P, fmprb_t Q, hypgeom_t hyp, long target_prec, long
     {
         fmpr_t u;
         fmpr_init(u);
-        fmpr_add(u, fmprb_midref(Q), fmprb_radref(Q), FMPRB_RAD_PREC, FMPR_RND_UP);
+        fmprb_get_ubound_fmpr(u, Q, FMPRB_RAD_PREC);
         fmpr_mul(u, u, err, FMPRB_RAD_PREC, FMPR_RND_UP);
         fmprb_add_error_fmpr(P, u);
         fmpr_clear(u);
@@ -0,0 +1,373 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#ifndef MAG_H
+#define MAG_H
+
+#include "fmpr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+  A mag_struct holds an upper bound for a nonnegative real number, used
+  for error bounds (e.g. the radius of a ball). The value is
+  m * 2^(e - MAG_BITS) where the mantissa m is either zero or satisfies
+  2^(MAG_BITS-1) <= m < 2^MAG_BITS, so that the value lies in
+  [2^(e-1), 2^e). The exponent is an fmpz, which is a plain machine
+  word unless it is huge.
+
+  Zero is represented by m = 0, e = 0 and positive infinity by m = 0,
+  e != 0. All arithmetic operations round upwards; results are exact
+  whenever the exact result is representable.
+*/
+
+#define MAG_BITS 30
+
+#define MAG_ONE_HALF (1UL << (MAG_BITS - 1))
+
+#define MAG_EXP_POS_INF 1L
+
+typedef struct
+{
+    fmpz exp;
+    mp_limb_t man;
+}
+mag_struct;
+
+typedef mag_struct mag_t[1];
+typedef mag_struct * mag_ptr;
+typedef const mag_struct * mag_srcptr;
+
+#define MAG_EXP(x) ((x)->exp)
+#define MAG_EXPREF(x) (&(x)->exp)
+#define MAG_MAN(x) ((x)->man)
+
+static __inline__ void
+mag_init(mag_t x)
+{
+    fmpz_init(MAG_EXPREF(x));
+    MAG_MAN(x) = 0;
+}
+
+static __inline__ void
+mag_clear(mag_t x)
+{
+    fmpz_clear(MAG_EXPREF(x));
+}
+
+static __inline__ void
+mag_zero(mag_t x)
+{
+    fmpz_zero(MAG_EXPREF(x));
+    MAG_MAN(x) = 0;
+}
+
+static __inline__ void
+mag_inf(mag_t x)
+{
+    fmpz_set_si(MAG_EXPREF(x), MAG_EXP_POS_INF);
+    MAG_MAN(x) = 0;
+}
+
+static __inline__ void
+mag_one(mag_t x)
+{
+    fmpz_one(MAG_EXPREF(x));
+    MAG_MAN(x) = MAG_ONE_HALF;
+}
+
+static __inline__ int
+mag_is_special(const mag_t x)
+{
+    return MAG_MAN(x) == 0;
+}
+
+static __inline__ int
+mag_is_zero(const mag_t x)
+{
+    return MAG_MAN(x) == 0 && MAG_EXP(x) == 0;
+}
+
+static __inline__ int
+mag_is_inf(const mag_t x)
+{
+    return MAG_MAN(x) == 0 && MAG_EXP(x) != 0;
+}
+
+static __inline__ int
+mag_is_finite(const mag_t x)
+{
+    return !mag_is_inf(x);
+}
+
+static __inline__ void
+mag_set(mag_t y, const mag_t x)
+{
+    fmpz_set(MAG_EXPREF(y), MAG_EXPREF(x));
+    MAG_MAN(y) = MAG_MAN(x);
+}
+
+static __inline__ void
+mag_swap(mag_t x, mag_t y)
+{
+    mag_struct t = *x;
+    *x = *y;
+    *y = t;
+}
+
+static __inline__ int
+mag_equal(const mag_t x, const mag_t y)
+{
+    return MAG_MAN(x) == MAG_MAN(y)
+        && fmpz_equal(MAG_EXPREF(x), MAG_EXPREF(y));
+}
+
+/* Given a nonzero mantissa m < 2^(MAG_BITS+2), with the exponent of x
+   already set, sets x to an upper bound for m * 2^(exp - MAG_BITS)
+   having a normalised mantissa. */
+static __inline__ void
+_mag_set_man_fix_overflow(mag_t x, mp_limb_t m)
+{
+    long shift = 0;
+
+    while (m >> MAG_BITS)
+    {
+        m = (m >> 1) + (m & 1);
+        shift++;
+    }
+
+    MAG_MAN(x) = m;
+
+    if (shift != 0)
+        fmpz_add_ui_inline(MAG_EXPREF(x), MAG_EXPREF(x), shift);
+}
+
+static __inline__ void
+mag_mul_2exp_si(mag_t z, const mag_t x, long e)
+{
+    if (mag_is_special(x))
+    {
+        mag_set(z, x);
+    }
+    else
+    {
+        fmpz_add_si_inline(MAG_EXPREF(z), MAG_EXPREF(x), e);
+        MAG_MAN(z) = MAG_MAN(x);
+    }
+}
+
+static __inline__ void
+mag_mul_2exp_fmpz(mag_t z, const mag_t x, const fmpz_t e)
+{
+    if (mag_is_special(x))
+    {
+        mag_set(z, x);
+    }
+    else
+    {
+        fmpz_add_inline(MAG_EXPREF(z), MAG_EXPREF(x), e);
+        MAG_MAN(z) = MAG_MAN(x);
+    }
+}
+
+/* Sets z to an upper bound for x + y. */
+static __inline__ void
+mag_add(mag_t z, const mag_t x, const mag_t y)
+{
+    if (mag_is_zero(x))
+    {
+        mag_set(z, y);
+    }
+    else if (mag_is_zero(y))
+    {
+        mag_set(z, x);
+    }
+    else if (mag_is_inf(x) || mag_is_inf(y))
+    {
+        mag_inf(z);
+    }
+    else
+    {
+        mp_limb_t xm, ym, m;
+        long shift;
+
+        xm = MAG_MAN(x);
+        ym = MAG_MAN(y);
+        shift = _fmpz_sub_small(MAG_EXPREF(x), MAG_EXPREF(y));
+
+        if (shift == 0)
+        {
+            m = xm + ym;
+            fmpz_set(MAG_EXPREF(z), MAG_EXPREF(x));
+        }
+        else if (shift > 0)
+        {
+            if (shift < MAG_BITS)
+                m = xm + (ym >> shift) + ((ym & ((1UL << shift) - 1)) != 0);
+            else
+                m = xm + 1;
+
+            fmpz_set(MAG_EXPREF(z), MAG_EXPREF(x));
+        }
+        else
+        {
+            shift = -shift;
+
+            if (shift < MAG_BITS)
+                m = ym + (xm >> shift) + ((xm & ((1UL << shift) - 1)) != 0);
+            else
+                m = ym + 1;
+
+            fmpz_set(MAG_EXPREF(z), MAG_EXPREF(y));
+        }
+
+        _mag_set_man_fix_overflow(z, m);
+    }
+}
+
+/* Sets z to an upper bound for x * y. The product of two normalised
+   mantissas has 2*MAG_BITS-1 or 2*MAG_BITS bits; we keep the top
+   MAG_BITS bits and round up if anything nonzero is discarded. */
+static __inline__ void
+mag_mul(mag_t z, const mag_t x, const mag_t y)
+{
+    if (mag_is_special(x) || mag_is_special(y))
+    {
+        if (mag_is_inf(x) || mag_is_inf(y))
+            mag_inf(z);
+        else
+            mag_zero(z);
+    }
+    else
+    {
+        mp_limb_t hi, lo, m;
+
+        umul_ppmm(hi, lo, MAG_MAN(x), MAG_MAN(y));
+
+        m = (hi << (FLINT_BITS - MAG_BITS)) | (lo >> MAG_BITS);
+
+        if (m >> (MAG_BITS - 1))
+        {
+            m += ((lo & ((1UL << MAG_BITS) - 1)) != 0);
+            fmpz_add_inline(MAG_EXPREF(z), MAG_EXPREF(x), MAG_EXPREF(y));
+        }
+        else
+        {
+            m = (hi << (FLINT_BITS - MAG_BITS + 1)) | (lo >> (MAG_BITS - 1));
+            m += ((lo & ((1UL << (MAG_BITS - 1)) - 1)) != 0);
+            fmpz_add2_fmpz_si_inline(MAG_EXPREF(z),
+                MAG_EXPREF(x), MAG_EXPREF(y), -1);
+        }
+
+        _mag_set_man_fix_overflow(z, m);
+    }
+}
+
+/* Sets z to an upper bound for x + 2^e. */
+static __inline__ void
+mag_add_2exp_fmpz(mag_t z, const mag_t x, const fmpz_t e)
+{
+    mag_t t;
+    fmpz_init(MAG_EXPREF(t));
+    fmpz_add_ui_inline(MAG_EXPREF(t), e, 1);
+    MAG_MAN(t) = MAG_ONE_HALF;
+    mag_add(z, x, t);
+    fmpz_clear(MAG_EXPREF(t));
+}
+
+/* Sets z to an upper bound for x plus the error bound implied by the
+   return value rret of an fmpr function that has computed result
+   (compare fmpr_add_error_result). */
+static __inline__ void
+mag_add_error_result(mag_t z, const mag_t x, const fmpr_t result, long rret)
+{
+    if (rret == FMPR_RESULT_EXACT)
+    {
+        mag_set(z, x);
+    }
+    else
+    {
+        mag_t t;
+        fmpz_init(MAG_EXPREF(t));
+        fmpz_sub_si_inline(MAG_EXPREF(t), fmpr_expref(result), rret - 1);
+        MAG_MAN(t) = MAG_ONE_HALF;
+        mag_add(z, x, t);
+        fmpz_clear(MAG_EXPREF(t));
+    }
+}
+
+/* Sets z to the error bound implied by the return value rret of an fmpr
+   function that has computed result (compare fmpr_set_error_result). */
+static __inline__ void
+mag_set_error_result(mag_t z, const fmpr_t result, long rret)
+{
+    if (rret == FMPR_RESULT_EXACT)
+    {
+        mag_zero(z);
+    }
+    else
+    {
+        fmpz_sub_si_inline(MAG_EXPREF(z), fmpr_expref(result), rret - 1);
+        MAG_MAN(z) = MAG_ONE_HALF;
+    }
+}
+
+/* Sets z to an upper bound for z + x * y. */
+static __inline__ void
+mag_addmul(mag_t z, const mag_t x, const mag_t y)
+{
+    mag_t t;
+    mag_init(t);
+    mag_mul(t, x, y);
+    mag_add(z, z, t);
+    mag_clear(t);
+}
+
+int mag_cmp(const mag_t x, const mag_t y);
+
+int mag_cmp_2exp_si(const mag_t x, long e);
+
+int mag_cmpabs_fmpr(const mag_t x, const fmpr_t y);
+
+void mag_set_fmpr(mag_t y, const fmpr_t x);
+
+void mag_get_fmpr(fmpr_t y, const mag_t x);
+
+void mag_set_ui_2exp_si(mag_t y, ulong x, long e);
+
+void mag_randtest(mag_t x, flint_rand_t state, long expbits);
+
+void mag_randtest_special(mag_t x, flint_rand_t state, long expbits);
+
+void mag_print(const mag_t x);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -0,0 +1,47 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "mag.h"
+
+int
+mag_cmp_2exp_si(const mag_t x, long e)
+{
+    int c;
+
+    if (mag_is_zero(x))
+        return -1;
+
+    if (mag_is_inf(x))
+        return 1;
+
+    /* x lies in [2^(exp-1), 2^exp) */
+    c = fmpz_cmp_si(MAG_EXPREF(x), e + 1);
+
+    if (c == 0)
+        return (MAG_MAN(x) == MAG_ONE_HALF) ? 0 : 1;
+
+    return (c < 0) ? -1 : 1;
+}
+
@@ -0,0 +1,54 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "mag.h"
+
+int
+mag_cmpabs_fmpr(const mag_t x, const fmpr_t y)
+{
+    fmpr_t t;
+    fmpz xe;
+    long ye;
+    int c;
+
+    if (!mag_is_special(x) && !fmpr_is_special(y))
+    {
+        /* x lies in [2^(xe-1), 2^xe) and |y| in [2^(ye-1), 2^ye) */
+        xe = MAG_EXP(x);
+        ye = fmpr_abs_bound_lt_2exp_si(y);
+
+        if (!COEFF_IS_MPZ(xe) && ye > -FMPR_PREC_EXACT && ye < FMPR_PREC_EXACT
+            && xe != ye)
+            return (xe < ye) ? -1 : 1;
+    }
+
+    fmpr_init(t);
+    mag_get_fmpr(t, x);
+    c = fmpr_cmpabs(t, y);
+    fmpr_clear(t);
+
+    return c;
+}
+
@@ -0,0 +1,52 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "mag.h"
+
+void
+mag_get_fmpr(fmpr_t y, const mag_t x)
+{
+    if (mag_is_zero(x))
+    {
+        fmpr_zero(y);
+    }
+    else if (mag_is_inf(x))
+    {
+        fmpr_pos_inf(y);
+    }
+    else
+    {
+        mp_limb_t m;
+        unsigned int shift;
+
+        m = MAG_MAN(x);
+        count_trailing_zeros(shift, m);
+
+        fmpz_set_ui(fmpr_manref(y), m >> shift);
+        fmpz_add_si_inline(fmpr_expref(y), MAG_EXPREF(x),
+            (long) shift - MAG_BITS);
+    }
+}
+
@@ -0,0 +1,54 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "mag.h"
+
+void
+mag_randtest(mag_t x, flint_rand_t state, long expbits)
+{
+    fmpr_t t;
+
+    fmpr_init(t);
+    fmpr_randtest_not_zero(t, state, 1 + n_randint(state, 2 * MAG_BITS), expbits);
+    mag_set_fmpr(x, t);
+    fmpr_clear(t);
+}
+
+void
+mag_randtest_special(mag_t x, flint_rand_t state, long expbits)
+{
+    switch (n_randint(state, 32))
+    {
+        case 0:
+            mag_zero(x);
+            break;
+        case 1:
+            mag_inf(x);
+            break;
+        default:
+            mag_randtest(x, state, expbits);
+    }
+}
+
@@ -0,0 +1,65 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "mag.h"
+
+void
+mag_set_fmpr(mag_t y, const fmpr_t x)
+{
+    if (fmpr_is_special(x))
+    {
+        if (fmpr_is_zero(x))
+            mag_zero(y);
+        else
+            mag_inf(y);
+    }
+    else
+    {
+        fmpz m = *fmpr_manref(x);
+        mp_limb_t u, man;
+        long bits;
+
+        if (!COEFF_IS_MPZ(m))
+        {
+            u = FLINT_ABS(m);
+            bits = FLINT_BIT_COUNT(u);
+
+            if (bits <= MAG_BITS)
+                man = u << (MAG_BITS - bits);
+            else
+                man = (u >> (bits - MAG_BITS)) +
+                    ((u & ((1UL << (bits - MAG_BITS)) - 1)) != 0);
+        }
+        else
+        {
+            man = fmpz_abs_ubound_ui_2exp(&bits, fmpr_manref(x), MAG_BITS);
+            bits += MAG_BITS;
+        }
+
+        fmpz_add_si_inline(MAG_EXPREF(y), fmpr_expref(x), bits);
+        _mag_set_man_fix_overflow(y, man);
+    }
+}
+
@@ -0,0 +1,53 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "mag.h"
+
+void
+mag_set_ui_2exp_si(mag_t y, ulong x, long e)
+{
+    if (x == 0)
+    {
+        mag_zero(y);
+    }
+    else
+    {
+        mp_limb_t man;
+        long bits;
+
+        bits = FLINT_BIT_COUNT(x);
+
+        if (bits <= MAG_BITS)
+            man = x << (MAG_BITS - bits);
+        else
+            man = (x >> (bits - MAG_BITS)) +
+                ((x & ((1UL << (bits - MAG_BITS)) - 1)) != 0);
+
+        fmpz_set_si(MAG_EXPREF(y), e);
+        fmpz_add_si_inline(MAG_EXPREF(y), MAG_EXPREF(y), bits);
+        _mag_set_man_fix_overflow(y, man);
+    }
+}
+
@@ -0,0 +1,81 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+#include "mag.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("cmp_2exp_si....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000000; iter++)
+    {
+        fmpr_t x, y;
+        mag_t xb;
+        long e;
+        int c1, c2;
+
+        fmpr_init(x);
+        fmpr_init(y);
+        mag_init(xb);
+
+        mag_randtest_special(xb, state, 1 + n_randint(state, 10));
+        mag_get_fmpr(x, xb);
+
+        if (n_randint(state, 2) && mag_is_finite(xb) && !mag_is_zero(xb))
+            e = fmpz_get_si(MAG_EXPREF(xb)) - n_randint(state, 3);
+        else
+            e = (long) n_randint(state, 2000) - 1000;
+
+        fmpr_set_ui_2exp_si(y, 1, e);
+
+        c1 = mag_cmp_2exp_si(xb, e);
+        c1 = (c1 > 0) - (c1 < 0);
+        c2 = fmpr_cmp(x, y);
+        c2 = (c2 > 0) - (c2 < 0);
+
+        if (c1 != c2)
+        {
+            printf("FAIL\n\n");
+            printf("x = "); fmpr_print(x); printf("\n\n");
+            printf("e = %ld\n\n", e);
+            printf("c1 = %d, c2 = %d\n\n", c1, c2);
+            abort();
+        }
+
+        fmpr_clear(x);
+        fmpr_clear(y);
+        mag_clear(xb);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
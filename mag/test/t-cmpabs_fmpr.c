@@ -0,0 +1,92 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+#include "mag.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("cmpabs_fmpr....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000000; iter++)
+    {
+        fmpr_t x, y;
+        mag_t xb;
+        int c1, c2;
+
+        fmpr_init(x);
+        fmpr_init(y);
+        mag_init(xb);
+
+        mag_randtest_special(xb, state, 1 + n_randint(state, 10));
+        mag_get_fmpr(x, xb);
+
+        /* exercise equal and nearby exponents */
+        switch (n_randint(state, 3))
+        {
+            case 0:
+                fmpr_randtest_special(y, state, 2 + n_randint(state, 100),
+                    1 + n_randint(state, 10));
+                break;
+            case 1:
+                fmpr_set(y, x);
+                break;
+            default:
+                fmpr_randtest_not_zero(y, state, 2 + n_randint(state, 100), 4);
+                fmpr_mul(y, y, x, FMPR_PREC_EXACT, FMPR_RND_DOWN);
+                break;
+        }
+
+        if (n_randint(state, 2))
+            fmpr_neg(y, y);
+
+        c1 = mag_cmpabs_fmpr(xb, y);
+        c1 = (c1 > 0) - (c1 < 0);
+        c2 = fmpr_cmpabs(x, y);
+        c2 = (c2 > 0) - (c2 < 0);
+
+        if (c1 != c2)
+        {
+            printf("FAIL\n\n");
+            printf("x = "); fmpr_print(x); printf("\n\n");
+            printf("y = "); fmpr_print(y); printf("\n\n");
+            printf("c1 = %d, c2 = %d\n\n", c1, c2);
+            abort();
+        }
+
+        fmpr_clear(x);
+        fmpr_clear(y);
+        mag_clear(xb);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
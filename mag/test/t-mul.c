@@ -0,0 +1,113 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "mag.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("mul....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000000; iter++)
+    {
+        fmpr_t x, y, z, z2, w;
+        mag_t xb, yb, zb;
+
+        fmpr_init(x);
+        fmpr_init(y);
+        fmpr_init(z);
+        fmpr_init(z2);
+        fmpr_init(w);
+
+        mag_init(xb);
+        mag_init(yb);
+        mag_init(zb);
+
+        mag_randtest_special(xb, state, 1 + n_randint(state, 100));
+        mag_randtest_special(yb, state, 1 + n_randint(state, 100));
+        mag_randtest_special(zb, state, 1 + n_randint(state, 100));
+
+        mag_get_fmpr(x, xb);
+        mag_get_fmpr(y, yb);
+
+        fmpr_mul(z, x, y, FMPR_PREC_EXACT, FMPR_RND_DOWN);
+        if (fmpr_is_nan(z))
+            fmpr_pos_inf(z);
+
+        /* upper bound with relative error at most 2^(1-MAG_BITS) */
+        fmpr_mul_2exp_si(z2, z, 1 - MAG_BITS);
+        fmpr_add(z2, z2, z, FMPR_PREC_EXACT, FMPR_RND_DOWN);
+        if (fmpr_is_nan(z2))
+            fmpr_pos_inf(z2);
+
+        switch (n_randint(state, 3))
+        {
+            case 0:
+                mag_mul(zb, xb, yb);
+                break;
+            case 1:
+                mag_set(zb, xb);
+                mag_mul(zb, zb, yb);
+                break;
+            default:
+                mag_set(zb, yb);
+                mag_mul(zb, xb, zb);
+                break;
+        }
+
+        mag_get_fmpr(w, zb);
+
+        if (!(fmpr_cmp(z, w) <= 0 && fmpr_cmp(w, z2) <= 0))
+        {
+            printf("FAIL\n\n");
+            printf("x = "); fmpr_print(x); printf("\n\n");
+            printf("y = "); fmpr_print(y); printf("\n\n");
+            printf("z = "); fmpr_print(z); printf("\n\n");
+            printf("w = "); fmpr_print(w); printf("\n\n");
+            abort();
+        }
+
+        fmpr_clear(x);
+        fmpr_clear(y);
+        fmpr_clear(z);
+        fmpr_clear(z2);
+        fmpr_clear(w);
+
+        mag_clear(xb);
+        mag_clear(yb);
+        mag_clear(zb);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,93 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "mag.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("set_fmpr....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000000; iter++)
+    {
+        fmpr_t x, y, z, z2;
+        mag_t xb, yb;
+
+        fmpr_init(x);
+        fmpr_init(y);
+        fmpr_init(z);
+        fmpr_init(z2);
+
+        mag_init(xb);
+        mag_init(yb);
+
+        fmpr_randtest_special(x, state, 1 + n_randint(state, 200), 1 + n_randint(state, 100));
+
+        mag_set_fmpr(xb, x);
+        mag_get_fmpr(y, xb);
+
+        fmpr_abs(z, x);
+        if (fmpr_is_nan(z))
+            fmpr_pos_inf(z);
+
+        fmpr_mul_2exp_si(z2, z, 1 - MAG_BITS);
+        fmpr_add(z2, z2, z, FMPR_PREC_EXACT, FMPR_RND_DOWN);
+        if (fmpr_is_nan(z2))
+            fmpr_pos_inf(z2);
+
+        /* the conversion back is exact */
+        mag_set_fmpr(yb, y);
+
+        if (!(fmpr_cmp(z, y) <= 0 && fmpr_cmp(y, z2) <= 0) ||
+                !mag_equal(xb, yb))
+        {
+            printf("FAIL\n\n");
+            printf("x = "); fmpr_print(x); printf("\n\n");
+            printf("y = "); fmpr_print(y); printf("\n\n");
+            printf("xb = "); mag_print(xb); printf("\n\n");
+            printf("yb = "); mag_print(yb); printf("\n\n");
+            abort();
+        }
+
+        fmpr_clear(x);
+        fmpr_clear(y);
+        fmpr_clear(z);
+        fmpr_clear(z2);
+
+        mag_clear(xb);
+        mag_clear(yb);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
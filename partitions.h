@@ -35,12 +35,90 @@
 extern "C" {
 #endif
 
+/* A_k(n) = A_k1(a1 n + b1) A_k2(a2 n + b2) where k = k1 k2 and k1 = p^exp */
+typedef struct
+{
+    ulong k1;
+    ulong k2;
+    ulong p;
+    int exp;
+    ulong a1;
+    ulong b1;
+    ulong a2;
+    ulong b2;
+}
+partitions_hrr_stage_struct;
+
+/* factor[k] = smallest prime factor of k for k <= limit, where
+   limit = min(N, PARTITIONS_HRR_SIEVE_MAX); larger k are factored
+   when needed */
+typedef struct
+{
+    long N;
+    long limit;
+    unsigned int * factor;
+    long * offset;
+    partitions_hrr_stage_struct * stages;
+}
+partitions_hrr_sieve_struct;
+
+typedef partitions_hrr_sieve_struct partitions_hrr_sieve_t[1];
+
+typedef struct
+{
+    long max_q;
+    fmprb_struct ** values;
+    long ** prec;
+}
+partitions_cos_table_struct;
+
+typedef partitions_cos_table_struct partitions_cos_table_t[1];
+
+/* largest k stored in the table of smallest prime factors */
+#define PARTITIONS_HRR_SIEVE_MAX (1L << 22)
+
+/* the decompositions are only cached for N up to this bound */
+#define PARTITIONS_HRR_STAGE_CACHE_MAX (1L << 18)
+
+/* the table is only used above this precision */
+#define PARTITIONS_COS_TABLE_MIN_PREC 128
+
+#define PARTITIONS_COS_TABLE_MAX_Q 1024
+
+void partitions_hrr_sieve_init(partitions_hrr_sieve_t sieve, long N, int cache_stages);
+
+void partitions_hrr_sieve_clear(partitions_hrr_sieve_t sieve);
+
+long partitions_hrr_decompose(partitions_hrr_stage_struct * stages, ulong k,
+    const partitions_hrr_sieve_t sieve);
+
+void partitions_hrr_expsum_factored(trig_prod_t prod, ulong k, ulong n,
+    const partitions_hrr_sieve_t sieve);
+
+void partitions_cos_table_init(partitions_cos_table_t table, long max_q);
+
+void partitions_cos_table_clear(partitions_cos_table_t table);
+
+void partitions_cos_table_cos_pi(fmprb_t c, partitions_cos_table_t table,
+    mp_limb_signed_t p, ulong q, long prec);
+
 void partitions_rademacher_bound(fmpr_t b, const fmpz_t n, ulong N);
 
+void _partitions_hrr_sum_fmprb(fmprb_t x, const fmpz_t n, long N0, long N1,
+    long N, int use_doubles, const partitions_hrr_sieve_t sieve,
+    partitions_cos_table_t table);
+
 void partitions_hrr_sum_fmprb(fmprb_t x, const fmpz_t n, long N0, long N, int use_doubles);
 
+void _partitions_hrr_sum_fmprb_threaded(fmprb_t x, const fmpz_t n, long N,
+    int use_doubles, const partitions_hrr_sieve_t sieve);
+
+void partitions_hrr_sum_fmprb_threaded(fmprb_t x, const fmpz_t n, long N, int use_doubles);
+
 void partitions_fmpz_fmpz(fmpz_t p, const fmpz_t n, int use_doubles);
 
+void partitions_fmpz_fmpz_vec(fmpz * p, const fmpz * n, long len, int use_doubles);
+
 void partitions_fmpz_ui(fmpz_t p, ulong n);
 
 void partitions_fmpz_ui_using_doubles(fmpz_t p, ulong n);
@@ -0,0 +1,44 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "partitions.h"
+
+void
+partitions_cos_table_clear(partitions_cos_table_t table)
+{
+    long q;
+
+    for (q = 1; q <= table->max_q; q++)
+    {
+        if (table->values[q] != NULL)
+        {
+            _fmprb_vec_clear(table->values[q], q + 1);
+            flint_free(table->prec[q]);
+        }
+    }
+
+    flint_free(table->values);
+    flint_free(table->prec);
+}
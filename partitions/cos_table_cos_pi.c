@@ -0,0 +1,70 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "partitions.h"
+
+void
+partitions_cos_table_cos_pi(fmprb_t c, partitions_cos_table_t table,
+    mp_limb_signed_t p, ulong q, long prec)
+{
+    fmpq_t pq;
+    ulong g, u;
+
+    /* cos(pi p/q) = cos(pi u/q) with 0 <= u <= q */
+    u = FLINT_ABS(p) % (2 * q);
+    if (u > q)
+        u = 2 * q - u;
+
+    g = n_gcd(q, u);
+    u /= g;
+    q /= g;
+
+    if (q > table->max_q || prec < PARTITIONS_COS_TABLE_MIN_PREC)
+    {
+        fmpq_init(pq);
+        fmpq_set_si(pq, u, q);
+        fmprb_cos_pi_fmpq(c, pq, prec);
+        fmpq_clear(pq);
+        return;
+    }
+
+    if (table->values[q] == NULL)
+    {
+        table->values[q] = _fmprb_vec_init(q + 1);
+        table->prec[q] = flint_calloc(q + 1, sizeof(long));
+    }
+
+    /* entries are only recomputed when a higher precision is needed */
+    if (table->prec[q][u] < prec)
+    {
+        fmpq_init(pq);
+        fmpq_set_si(pq, u, q);
+        fmprb_cos_pi_fmpq(table->values[q] + u, pq, prec);
+        fmpq_clear(pq);
+        table->prec[q][u] = prec;
+    }
+
+    fmprb_set_round(c, table->values[q] + u, prec);
+}
@@ -23,8 +23,8 @@
 
 ******************************************************************************/
 
-#include <pthread.h>
 #include "partitions.h"
+#include "thread_pool.h"
 
 /* defined in flint*/
 #define NUMBER_OF_SMALL_PARTITIONS 128
@@ -32,57 +32,29 @@ extern const unsigned int partitions_lookup[NUMBER_OF_SMALL_PARTITIONS];
 
 long partitions_hrr_needed_terms(double n);
 
-typedef struct
-{
-    fmprb_ptr x;
-    fmpz * n;
-    ulong N0;
-    ulong N;
-    int use_doubles;
-}
-worker_arg_t;
+/* the sum for a single p(n) is split between threads above this n */
+#define THREADED_MIN_N 4e8
 
-static void *
-worker(void * arg_ptr)
-{
-    worker_arg_t arg = *((worker_arg_t *) arg_ptr);
-    partitions_hrr_sum_fmprb(arg.x, arg.n, arg.N0, arg.N, arg.use_doubles);
-    flint_cleanup();
-    return NULL;
-}
-
-/* TODO: set number of threads in child threads, for future
-   multithreaded evaluation of single terms */
+/* sets p to the unique integer in x plus the truncation error bound */
 static void
-hrr_sum_threaded(fmprb_t x, const fmpz_t n, long N, int use_doubles)
+_partitions_fmpz_from_sum(fmpz_t p, fmprb_t x, const fmpz_t n, long N)
 {
-    fmprb_t y;
-    pthread_t threads[2];
-    worker_arg_t args[2];
-
-    fmprb_init(y);
-
-    args[0].x = x;
-    args[0].n = (fmpz *) n;
-    args[0].N0 = 1;
-    args[0].N = 16;
-    args[0].use_doubles = use_doubles;
+    fmpr_t bound;
 
-    args[1].x = y;
-    args[1].n = (fmpz *) n;
-    args[1].N0 = 17;
-    args[1].N = N;
-    args[1].use_doubles = use_doubles;
+    fmpr_init(bound);
 
-    pthread_create(&threads[0], NULL, worker, &args[0]);
-    pthread_create(&threads[1], NULL, worker, &args[1]);
+    partitions_rademacher_bound(bound, n, N);
+    fmprb_add_error_fmpr(x, bound);
 
-    pthread_join(threads[0], NULL);
-    pthread_join(threads[1], NULL);
-
-    fmprb_add(x, x, y, FMPR_PREC_EXACT);
+    if (!fmprb_get_unique_fmpz(p, x))
+    {
+        printf("not unique!\n");
+        fmprb_printd(x, 50);
+        printf("\n");
+        abort();
+    }
 
-    fmprb_clear(y);
+    fmpr_clear(bound);
 }
 
 void
@@ -98,37 +70,128 @@ partitions_fmpz_fmpz(fmpz_t p, const fmpz_t n, int use_doubles)
     else
     {
         fmprb_t x;
-        fmpr_t bound;
         long N;
 
         fmprb_init(x);
-        fmpr_init(bound);
 
         N = partitions_hrr_needed_terms(fmpz_get_d(n));
 
-        if (fmpz_cmp_ui(n, 4e8) >= 0 && flint_get_num_threads() > 1)
+        if (fmpz_cmp_ui(n, THREADED_MIN_N) >= 0 && flint_get_num_threads() > 1)
         {
-            hrr_sum_threaded(x, n, N, use_doubles);
+            partitions_hrr_sum_fmprb_threaded(x, n, N, use_doubles);
         }
         else
         {
             partitions_hrr_sum_fmprb(x, n, 1, N, use_doubles);
         }
 
-        partitions_rademacher_bound(bound, n, N);
-        fmpr_add(fmprb_radref(x), fmprb_radref(x), bound, FMPRB_RAD_PREC, FMPR_RND_UP);
+        _partitions_fmpz_from_sum(p, x, n, N);
+
+        fmprb_clear(x);
+    }
+}
+
+typedef struct
+{
+    fmpz * p;
+    const fmpz * n;
+    long len;
+    long num_blocks;
+    int use_doubles;
+    int skip_large;     /* the entries n >= THREADED_MIN_N are done later */
+    const partitions_hrr_sieve_struct * sieve;
+}
+vec_arg_t;
 
-        if (!fmprb_get_unique_fmpz(p, x))
+/* computes a contiguous block of the p(n_i), so that neighbouring
+   n_i share the table of cosines */
+static void
+_partitions_vec_worker(void * arg_ptr, long b)
+{
+    const vec_arg_t * arg = (const vec_arg_t *) arg_ptr;
+    partitions_cos_table_t table;
+    fmprb_t x;
+    long i, i0, i1, N;
+
+    i0 = (arg->len * b) / arg->num_blocks;
+    i1 = (arg->len * (b + 1)) / arg->num_blocks;
+
+    partitions_cos_table_init(table, PARTITIONS_COS_TABLE_MAX_Q);
+    fmprb_init(x);
+
+    for (i = i0; i < i1; i++)
+    {
+        if (fmpz_cmp_ui(arg->n + i, NUMBER_OF_SMALL_PARTITIONS) < 0)
+        {
+            partitions_fmpz_fmpz(arg->p + i, arg->n + i, arg->use_doubles);
+        }
+        else if (!arg->skip_large ||
+            fmpz_cmp_ui(arg->n + i, THREADED_MIN_N) < 0)
+        {
+            N = partitions_hrr_needed_terms(fmpz_get_d(arg->n + i));
+            _partitions_hrr_sum_fmprb(x, arg->n + i, 1, N, N,
+                arg->use_doubles, arg->sieve, table);
+            _partitions_fmpz_from_sum(arg->p + i, x, arg->n + i, N);
+        }
+    }
+
+    partitions_cos_table_clear(table);
+    fmprb_clear(x);
+}
+
+void
+partitions_fmpz_fmpz_vec(fmpz * p, const fmpz * n, long len, int use_doubles)
+{
+    partitions_hrr_sieve_t sieve;
+    vec_arg_t arg;
+    fmprb_t x;
+    long i, N, num_threads;
+
+    if (len < 1)
+        return;
+
+    N = 1;
+    for (i = 0; i < len; i++)
+        if (fmpz_cmp_ui(n + i, NUMBER_OF_SMALL_PARTITIONS) >= 0)
+            N = FLINT_MAX(N, partitions_hrr_needed_terms(fmpz_get_d(n + i)));
+
+    partitions_hrr_sieve_init(sieve, N, len > 1);
+
+    num_threads = flint_get_num_threads();
+
+    /* several blocks per thread to even out the cost of the entries */
+    arg.p = p;
+    arg.n = n;
+    arg.len = len;
+    arg.num_blocks = FLINT_MIN(len, 4 * num_threads);
+    arg.use_doubles = use_doubles;
+    arg.skip_large = (num_threads > 1);
+    arg.sieve = sieve;
+
+    thread_pool_parallel_for(_partitions_vec_worker, &arg,
+        arg.num_blocks, num_threads);
+
+    /* a large entry costs more than a block of small ones, so its
+       terms are split between the threads instead */
+    if (arg.skip_large)
+    {
+        fmprb_init(x);
+
+        for (i = 0; i < len; i++)
         {
-            printf("not unique!\n");
-            fmprb_printd(x, 50);
-            printf("\n");
-            abort();
+            if (fmpz_cmp_ui(n + i, THREADED_MIN_N) >= 0)
+            {
+                N = partitions_hrr_needed_terms(fmpz_get_d(n + i));
+                _partitions_hrr_sum_fmprb_threaded(x, n + i, N,
+                    use_doubles, sieve);
+                _partitions_fmpz_from_sum(p + i, x, n + i, N);
+            }
         }
 
         fmprb_clear(x);
-        fmpr_clear(bound);
     }
+
+    partitions_hrr_sieve_clear(sieve);
 }
 
 void
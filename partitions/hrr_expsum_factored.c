@@ -0,0 +1,309 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "partitions.h"
+#include "ulong_extras.h"
+
+/* (k2^2 - 1) / d1 mod k1, where d1 divides k2^2 - 1 */
+static ulong
+_hrr_quot_mod(ulong k2, ulong d1, ulong k1)
+{
+    ulong m, s;
+
+    m = d1 * k1;
+    s = k2 % m;
+    s = n_mulmod2_preinv(s, s, m, n_preinvert_limb(m));
+    s = (s + m - 1) % m;
+
+    return (s / d1) % k1;
+}
+
+/* finds a, b with k2^2 d e n1 = d e n + (k2^2 - 1)/d1 mod k1,
+   i.e. n1 = a n + b mod k1, where d = gcd(24, k2) */
+static void
+_hrr_solve_n1(ulong * a, ulong * b, ulong k1, ulong k2, ulong d1, ulong de)
+{
+    ulong u, inv;
+
+    inv = n_preinvert_limb(k1);
+
+    u = n_mulmod2_preinv(k2 % k1, k2 % k1, k1, inv);
+    u = n_mulmod2_preinv(u, de % k1, k1, inv);
+    u = n_invmod(u, k1);
+
+    *a = n_mulmod2_preinv(u, de % k1, k1, inv);
+    *b = n_mulmod2_preinv(u, _hrr_quot_mod(k2, d1, k1), k1, inv);
+}
+
+/* the smallest prime in fac dividing k */
+static ulong
+_hrr_smallest_prime(const n_factor_t * fac, ulong k)
+{
+    ulong p;
+    int i;
+
+    p = k;
+
+    for (i = 0; i < fac->num; i++)
+        if (fac->p[i] < p && k % fac->p[i] == 0)
+            p = fac->p[i];
+
+    return p;
+}
+
+long
+partitions_hrr_decompose(partitions_hrr_stage_struct * stages, ulong k,
+    const partitions_hrr_sieve_t sieve)
+{
+    ulong p, k1, k2, d1, d2, e, c, v;
+    n_factor_t fac;
+    long num;
+    int exp;
+
+    num = 0;
+
+    /* k beyond the table is factored once */
+    if (k > sieve->limit)
+    {
+        n_factor_init(&fac);
+        n_factor(&fac, k, 1);
+    }
+
+    /* split off the prime power factors one at a time, starting
+       with the smallest prime */
+    while (k > 1)
+    {
+        partitions_hrr_stage_struct * s = stages + num;
+
+        if (k <= sieve->limit)
+            p = sieve->factor[k];
+        else
+            p = _hrr_smallest_prime(&fac, k);
+        k1 = 1;
+        k2 = k;
+        exp = 0;
+
+        while (k2 % p == 0)
+        {
+            k1 *= p;
+            k2 /= p;
+            exp++;
+        }
+
+        s->k1 = k1;
+        s->k2 = k2;
+        s->p = p;
+        s->exp = exp;
+        s->a1 = 1;
+        s->b1 = 0;
+        s->a2 = 1;
+        s->b2 = 0;
+
+        num++;
+
+        if (k2 == 1)
+            break;
+
+        if (p == 2 && exp == 1)
+        {
+            /* n1 = n - (k2^2-1)/8 mod 2, 32 n2 = 8n + 1 mod k2 */
+            c = ((k2 % 16) * (k2 % 16) % 16) / 8;
+            s->b1 = c;
+            v = n_invmod(32 % k2, k2);
+            s->a2 = n_mulmod2_preinv(8, v, k2, n_preinvert_limb(k2));
+            s->b2 = v;
+        }
+        else if (p == 2 && exp == 2)
+        {
+            /* n1 = n - (k2^2-1)/8 mod 4, 128 n2 = 8n + 5 mod k2 */
+            c = ((k2 % 32) * (k2 % 32) % 32) / 8;
+            s->b1 = (4 - c) % 4;
+            v = n_invmod(128 % k2, k2);
+            s->a2 = n_mulmod2_preinv(8, v, k2, n_preinvert_limb(k2));
+            s->b2 = n_mulmod2_preinv(5, v, k2, n_preinvert_limb(k2));
+        }
+        else
+        {
+            d1 = n_gcd(24, k1 % 24);
+            d2 = n_gcd(24, k2 % 24);
+            e = 24 / (d1 * d2);
+
+            _hrr_solve_n1(&s->a1, &s->b1, k1, k2, d1, d2 * e);
+            _hrr_solve_n1(&s->a2, &s->b2, k2, k1, d2, d1 * e);
+        }
+
+        k = k2;
+    }
+
+    return num;
+}
+
+/* some square root of a mod p^exp, or -1 if there is none */
+static mp_limb_signed_t
+_hrr_sqrtmod(ulong a, ulong p, int exp)
+{
+    mp_limb_t * r;
+    mp_limb_signed_t x;
+    long num;
+
+    num = n_sqrtmod_primepow(&r, a, p, exp);
+    x = (num == 0) ? -1 : r[0];
+    flint_free(r);
+
+    return x;
+}
+
+/* 1 - 24n mod m */
+static ulong
+_hrr_one_minus_24n(ulong n, ulong m)
+{
+    return (1 + m - n_mulmod2_preinv(24 % m, n % m, m, n_preinvert_limb(m))) % m;
+}
+
+/* multiplies prod by A_k(n) where k = p^exp */
+static void
+_hrr_mul_prime_power(trig_prod_t prod, ulong k, ulong p, int exp, ulong n)
+{
+    ulong m, mod;
+    mp_limb_signed_t x;
+
+    if (p == 2)
+    {
+        /* A = (-1)^exp (-1|m) sqrt(k) sin(pi m / (2k)),
+           where (3m)^2 = 1 - 24n mod 8k */
+        mod = 8 * k;
+        x = _hrr_sqrtmod(_hrr_one_minus_24n(n, mod), 2, exp + 3);
+        m = n_mulmod2_preinv(x, n_invmod(3, mod), mod, n_preinvert_limb(mod));
+
+        if (m % 4 == 3)
+            prod->prefactor = -prod->prefactor;
+        if (exp % 2 == 1)
+            prod->prefactor = -prod->prefactor;
+
+        prod->sqrt_p *= k;
+        prod->cos_p[prod->n] = (mp_limb_signed_t) k - (mp_limb_signed_t) m;
+        prod->cos_q[prod->n] = 2 * k;
+        prod->n++;
+    }
+    else if (p == 3)
+    {
+        /* A = 2 (-1)^(exp+1) (m|3) sqrt(k/3) sin(4 pi m / (3k)),
+           where (8m)^2 = 1 - 24n mod 3k */
+        mod = 3 * k;
+        x = _hrr_sqrtmod(_hrr_one_minus_24n(n, mod), 3, exp + 1);
+        m = n_mulmod2_preinv(x, n_invmod(8, mod), mod, n_preinvert_limb(mod));
+
+        prod->prefactor *= 2;
+        if (m % 3 == 2)
+            prod->prefactor = -prod->prefactor;
+        if (exp % 2 == 0)
+            prod->prefactor = -prod->prefactor;
+
+        prod->sqrt_p *= k;
+        prod->sqrt_q *= 3;
+        prod->cos_p[prod->n] = 3 * (mp_limb_signed_t) k - 8 * (mp_limb_signed_t) m;
+        prod->cos_q[prod->n] = 6 * k;
+        prod->n++;
+    }
+    else
+    {
+        /* A = 2 (3|k) sqrt(k) cos(4 pi m / k), where (24m)^2 = 1 - 24n mod k */
+        m = _hrr_one_minus_24n(n, k);
+
+        if (m % p == 0)
+        {
+            if (exp == 1)
+            {
+                prod->prefactor *= n_jacobi(3, k);
+                prod->sqrt_p *= k;
+            }
+            else
+            {
+                prod->prefactor = 0;
+            }
+
+            return;
+        }
+
+        x = _hrr_sqrtmod(m, p, exp);
+
+        if (x == -1)
+        {
+            prod->prefactor = 0;
+            return;
+        }
+
+        m = n_mulmod2_preinv(x, n_invmod(24 % k, k), k, n_preinvert_limb(k));
+
+        prod->prefactor *= 2 * n_jacobi(3, k);
+        prod->sqrt_p *= k;
+        prod->cos_p[prod->n] = 4 * (mp_limb_signed_t) m;
+        prod->cos_q[prod->n] = k;
+        prod->n++;
+    }
+}
+
+void
+partitions_hrr_expsum_factored(trig_prod_t prod, ulong k, ulong n,
+    const partitions_hrr_sieve_t sieve)
+{
+    partitions_hrr_stage_struct buf[FLINT_BITS];
+    const partitions_hrr_stage_struct * stages;
+    ulong n1;
+    long i, num;
+
+    if (k <= 1)
+    {
+        prod->prefactor = k;
+        return;
+    }
+
+    if (sieve->stages != NULL && k <= sieve->limit)
+    {
+        stages = sieve->stages + sieve->offset[k];
+        num = sieve->offset[k + 1] - sieve->offset[k];
+    }
+    else
+    {
+        num = partitions_hrr_decompose(buf, k, sieve);
+        stages = buf;
+    }
+
+    for (i = 0; i < num && prod->prefactor != 0; i++)
+    {
+        const partitions_hrr_stage_struct * s = stages + i;
+
+        n1 = n_mulmod2_preinv(s->a1, n % s->k1, s->k1, n_preinvert_limb(s->k1));
+        n1 = (n1 + s->b1) % s->k1;
+
+        if (s->k2 != 1)
+        {
+            n = n_mulmod2_preinv(s->a2, n % s->k2, s->k2, n_preinvert_limb(s->k2));
+            n = (n + s->b2) % s->k2;
+        }
+
+        _hrr_mul_prime_power(prod, s->k1, s->p, s->exp, n1);
+    }
+}
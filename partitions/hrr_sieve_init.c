@@ -0,0 +1,84 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "partitions.h"
+
+void
+partitions_hrr_sieve_init(partitions_hrr_sieve_t sieve, long N, int cache_stages)
+{
+    partitions_hrr_stage_struct stages[FLINT_BITS];
+    unsigned int * factor;
+    long i, j, k, num, alloc, limit;
+
+    N = FLINT_MAX(N, 1);
+    limit = FLINT_MIN(N, PARTITIONS_HRR_SIEVE_MAX);
+
+    sieve->N = N;
+    sieve->limit = limit;
+    sieve->offset = NULL;
+    sieve->stages = NULL;
+
+    /* factor[k] = smallest prime factor of k */
+    factor = flint_calloc(limit + 1, sizeof(unsigned int));
+
+    for (i = 2; i * i <= limit; i++)
+        if (factor[i] == 0)
+            for (j = i * i; j <= limit; j += i)
+                if (factor[j] == 0)
+                    factor[j] = i;
+
+    for (i = 2; i <= limit; i++)
+        if (factor[i] == 0)
+            factor[i] = i;
+
+    sieve->factor = factor;
+
+    if (cache_stages && N <= PARTITIONS_HRR_STAGE_CACHE_MAX)
+    {
+        sieve->offset = flint_malloc(sizeof(long) * (limit + 2));
+
+        alloc = limit + 1;
+        sieve->stages = flint_malloc(sizeof(partitions_hrr_stage_struct) * alloc);
+
+        sieve->offset[0] = sieve->offset[1] = 0;
+
+        for (k = 1; k <= limit; k++)
+        {
+            num = partitions_hrr_decompose(stages, k, sieve);
+
+            if (sieve->offset[k] + num > alloc)
+            {
+                alloc = FLINT_MAX(2 * alloc, sieve->offset[k] + num);
+                sieve->stages = flint_realloc(sieve->stages,
+                    sizeof(partitions_hrr_stage_struct) * alloc);
+            }
+
+            for (i = 0; i < num; i++)
+                sieve->stages[sieve->offset[k] + i] = stages[i];
+
+            sieve->offset[k + 1] = sieve->offset[k] + num;
+        }
+    }
+}
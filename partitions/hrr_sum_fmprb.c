@@ -28,10 +28,14 @@
 #include "arith.h"
 #include "fmprb.h"
 #include "math.h"
+#include "thread_pool.h"
 
 #define DOUBLE_CUTOFF 40
 #define DOUBLE_ERR 1e-12
 
+/* number of double terms evaluated before summation */
+#define DOUBLE_BLOCK 256
+
 #define DOUBLE_PREC 53
 #define MIN_PREC 20
 #define PI 3.141592653589793238462643
@@ -171,7 +175,7 @@ eval_trig_prod_d(trig_prod_t prod)
 }
 
 static void
-eval_trig_prod(fmprb_t sum, trig_prod_t prod, long prec)
+eval_trig_prod(fmprb_t sum, trig_prod_t prod, partitions_cos_table_t table, long prec)
 {
     int i;
     mp_limb_t v;
@@ -205,10 +209,7 @@ eval_trig_prod(fmprb_t sum, trig_prod_t prod, long prec)
 
     for (i = 0; i < prod->n; i++)
     {
-        fmpq_t pq;
-        *fmpq_numref(pq) = prod->cos_p[i];
-        *fmpq_denref(pq) = prod->cos_q[i];
-        fmprb_cos_pi_fmpq(t, pq, prec);
+        partitions_cos_table_cos_pi(t, table, prod->cos_p[i], prod->cos_q[i], prec);
         fmprb_mul(sum, sum, t, prec);
     }
 
@@ -233,14 +234,79 @@ sinh_cosh_divk_precomp(fmprb_t sh, fmprb_t ch, fmprb_t ex, long k, long prec)
 }
 
 
+/* x = sum of the terms N0 <= k <= N1 in double precision, where each
+   term has an error of at most DOUBLE_ERR (|t| + 1); the terms are
+   evaluated in blocks and each block is summed by a simple loop, with
+   rounding errors much smaller than DOUBLE_ERR |t| */
+static void
+_partitions_hrr_sum_doubles(fmprb_t x, const fmpz_t n, long N0, long N1,
+    const partitions_hrr_sieve_t sieve)
+{
+    trig_prod_t prod;
+    double t[DOUBLE_BLOCK];
+    double nd, Cd, zz, s, abs_s;
+    long j, k, len;
+    fmprb_t u;
+
+    fmprb_init(u);
+    fmprb_zero(x);
+
+    nd = fmpz_get_d(n);
+    Cd = PI * sqrt(24*nd-1) / 6;
+
+    for (k = N0; k <= N1; k += len)
+    {
+        len = FLINT_MIN(DOUBLE_BLOCK, N1 - k + 1);
+
+        for (j = 0; j < len; j++)
+        {
+            trig_prod_init(prod);
+            partitions_hrr_expsum_factored(prod, k + j, fmpz_fdiv_ui(n, k + j), sieve);
+
+            if (prod->prefactor != 0)
+            {
+                prod->prefactor *= 4;
+                prod->sqrt_p *= 3;
+                prod->sqrt_q *= (k + j);
+
+                zz = Cd / (k + j);
+                t[j] = eval_trig_prod_d(prod) / (24*nd - 1);
+                t[j] *= (cosh(zz) - sinh(zz) / zz);
+            }
+            else
+            {
+                t[j] = 0.0;
+            }
+        }
+
+        s = abs_s = 0.0;
+        for (j = 0; j < len; j++)
+        {
+            s += t[j];
+            abs_s += fabs(t[j]);
+        }
+
+        fmpr_set_d(fmprb_midref(u), 2 * DOUBLE_ERR * abs_s + len * DOUBLE_ERR);
+        mag_set_fmpr(fmprb_radref(u), fmprb_midref(u));
+        fmpr_set_d(fmprb_midref(u), s);
+        fmprb_add(x, x, u, 2 * DOUBLE_PREC);
+    }
+
+    fmprb_clear(u);
+}
+
+/* evaluates the terms N0 <= k <= N1, choosing the precision as for
+   the full sum up to N */
 void
-partitions_hrr_sum_fmprb(fmprb_t x, const fmpz_t n, long N0, long N, int use_doubles)
+_partitions_hrr_sum_fmprb(fmprb_t x, const fmpz_t n, long N0, long N1,
+    long N, int use_doubles, const partitions_hrr_sieve_t sieve,
+    partitions_cos_table_t table)
 {
     trig_prod_t prod;
     fmprb_t acc, C, t1, t2, t3, t4, exp1;
     fmpz_t n24;
     long k, prec, res_prec, acc_prec, guard_bits;
-    double nd, Cd;
+    double nd;
 
     if (fmpz_cmp_ui(n, 2) <= 0)
     {
@@ -280,12 +346,10 @@ partitions_hrr_sum_fmprb(fmprb_t x, const fmpz_t n, long N0, long N, int use_dou
     /* exp1 = exp(C) */
     fmprb_exp(exp1, C, prec);
 
-    Cd = PI * sqrt(24*nd-1) / 6;
-
-    for (k = N0; k <= N; k++)
+    for (k = N0; k <= N1; k++)
     {
         trig_prod_init(prod);
-        arith_hrr_expsum_factored(prod, k, fmpz_fdiv_ui(n, k));
+        partitions_hrr_expsum_factored(prod, k, fmpz_fdiv_ui(n, k), sieve);
 
         if (prod->prefactor != 0)
         {
@@ -293,41 +357,34 @@ partitions_hrr_sum_fmprb(fmprb_t x, const fmpz_t n, long N0, long N, int use_dou
             if (prec > MIN_PREC)
                 prec = partitions_prec_bound(nd, k, N);
 
+            /* the remaining terms are evaluated in a separate pass */
+            if (prec <= DOUBLE_CUTOFF && use_doubles)
+            {
+                _partitions_hrr_sum_doubles(t1, n, k, N1, sieve);
+                fmprb_add(acc, acc, t1, acc_prec);
+                break;
+            }
+
             prod->prefactor *= 4;
             prod->sqrt_p *= 3;
             prod->sqrt_q *= k;
 
-            if (prec > DOUBLE_CUTOFF || !use_doubles)
-            {
-                /* Compute A_k(n) * sqrt(3/k) * 4 / (24*n-1) */
-                eval_trig_prod(t1, prod, prec);
-                fmprb_div_fmpz(t1, t1, n24, prec);
-
-                /* Multiply by (cosh(z) - sinh(z)/z) where z = C / k */
-                fmprb_set_round(t2, C, prec);
-                fmprb_div_ui(t2, t2, k, prec);
-
-                if (k < 35 && prec > 1000)
-                    sinh_cosh_divk_precomp(t3, t4, exp1, k, prec);
-                else
-                    fmprb_sinh_cosh(t3, t4, t2, prec);
-
-                fmprb_div(t3, t3, t2, prec);
-                fmprb_sub(t2, t4, t3, prec);
-                fmprb_mul(t1, t1, t2, prec);
-            }
-            else
-            {
-                double xx, zz, xxerr;
+            /* Compute A_k(n) * sqrt(3/k) * 4 / (24*n-1) */
+            eval_trig_prod(t1, prod, table, prec);
+            fmprb_div_fmpz(t1, t1, n24, prec);
 
-                xx = eval_trig_prod_d(prod) / (24*nd - 1);
-                zz = Cd / k;
-                xx = xx * (cosh(zz) - sinh(zz) / zz);
+            /* Multiply by (cosh(z) - sinh(z)/z) where z = C / k */
+            fmprb_set_round(t2, C, prec);
+            fmprb_div_ui(t2, t2, k, prec);
 
-                xxerr = fabs(xx) * DOUBLE_ERR + DOUBLE_ERR;
-                fmpr_set_d(fmprb_midref(t1), xx);
-                fmpr_set_d(fmprb_radref(t1), xxerr);
-            }
+            if (k < 35 && prec > 1000)
+                sinh_cosh_divk_precomp(t3, t4, exp1, k, prec);
+            else
+                fmprb_sinh_cosh(t3, t4, t2, prec);
+
+            fmprb_div(t3, t3, t2, prec);
+            fmprb_sub(t2, t4, t3, prec);
+            fmprb_mul(t1, t1, t2, prec);
 
             /* Add to accumulator */
             fmprb_add(acc, acc, t1, acc_prec);
@@ -353,4 +410,174 @@ partitions_hrr_sum_fmprb(fmprb_t x, const fmpz_t n, long N0, long N, int use_dou
     fmprb_clear(t4);
 }
 
+void
+partitions_hrr_sum_fmprb(fmprb_t x, const fmpz_t n, long N0, long N, int use_doubles)
+{
+    partitions_hrr_sieve_t sieve;
+    partitions_cos_table_t table;
+
+    partitions_hrr_sieve_init(sieve, N, 0);
+    partitions_cos_table_init(table, PARTITIONS_COS_TABLE_MAX_Q);
+
+    _partitions_hrr_sum_fmprb(x, n, N0, N, N, use_doubles, sieve, table);
+
+    partitions_hrr_sieve_clear(sieve);
+    partitions_cos_table_clear(table);
+}
+
+typedef struct
+{
+    fmprb_ptr x;
+    const fmpz * n;
+    long * a;       /* job i evaluates the terms a[i] <= k < a[i+1] */
+    const partitions_hrr_sieve_struct * sieve;
+    long N;
+    long num_ball_jobs;
+    int use_doubles;
+}
+hrr_arg_t;
 
+static void
+_partitions_hrr_worker(void * arg_ptr, long i)
+{
+    const hrr_arg_t * arg = (const hrr_arg_t *) arg_ptr;
+    partitions_cos_table_t table;
+
+    if (i < arg->num_ball_jobs)
+    {
+        partitions_cos_table_init(table, PARTITIONS_COS_TABLE_MAX_Q);
+        _partitions_hrr_sum_fmprb(arg->x + i, arg->n, arg->a[i],
+            arg->a[i + 1] - 1, arg->N, arg->use_doubles, arg->sieve, table);
+        partitions_cos_table_clear(table);
+    }
+    else
+    {
+        _partitions_hrr_sum_doubles(arg->x + i, arg->n, arg->a[i],
+            arg->a[i + 1] - 1, arg->sieve);
+    }
+}
+
+/* estimated cost of the term k in ball arithmetic, where prec holds the
+   precision of the previous term and is updated as in the serial loop;
+   returns -1 if the term would be evaluated using doubles */
+static double
+_partitions_hrr_cost(long * prec, double nd, long k, long N, int use_doubles)
+{
+    if (*prec > MIN_PREC)
+        *prec = partitions_prec_bound(nd, k, N);
+
+    if (*prec <= DOUBLE_CUTOFF && use_doubles)
+        return -1.0;
+
+    return pow(FLINT_MAX(*prec, MIN_PREC), 1.6) + 1000.0;
+}
+
+void
+_partitions_hrr_sum_fmprb_threaded(fmprb_t x, const fmpz_t n, long N,
+    int use_doubles, const partitions_hrr_sieve_t sieve)
+{
+    hrr_arg_t arg;
+    double nd, c, total, target;
+    long i, k, K, prec, prec0, num_threads, num_ball, num_double, num_jobs;
+
+    num_threads = flint_get_num_threads();
+
+    if (num_threads < 2 || N < 2)
+    {
+        partitions_cos_table_t table;
+        partitions_cos_table_init(table, PARTITIONS_COS_TABLE_MAX_Q);
+        _partitions_hrr_sum_fmprb(x, n, 1, N, N, use_doubles, sieve, table);
+        partitions_cos_table_clear(table);
+        return;
+    }
+
+    nd = fmpz_get_d(n);
+
+    /* the terms k < K use ball arithmetic */
+    prec0 = partitions_remainder_bound_log2(nd, 1) + 2 * FLINT_BIT_COUNT(N) + 32;
+    prec = prec0;
+    total = 0.0;
+
+    for (K = 1; K <= N; K++)
+    {
+        c = _partitions_hrr_cost(&prec, nd, K, N, use_doubles);
+
+        if (c < 0)
+            break;
+
+        total += c;
+    }
+
+    /* split the ball terms into ranges of roughly equal cost; a single
+       expensive term (typically k = 1) gets a range of its own */
+    num_ball = FLINT_MIN(4 * num_threads, K - 1);
+    num_double = 0;
+    if (K <= N)
+        num_double = FLINT_MIN(num_threads,
+            (N - K + 1 + DOUBLE_BLOCK - 1) / DOUBLE_BLOCK);
+
+    arg.a = flint_malloc(sizeof(long) * (num_ball + num_double + 2));
+
+    num_jobs = 0;
+    arg.a[0] = 1;
+
+    if (num_ball > 0)
+    {
+        target = total / num_ball;
+        total = 0.0;
+        prec = prec0;
+
+        for (k = 1; k < K; k++)
+        {
+            total += _partitions_hrr_cost(&prec, nd, k, N, use_doubles);
+
+            if (total >= target && k + 1 < K)
+            {
+                arg.a[++num_jobs] = k + 1;
+                total = 0.0;
+            }
+        }
+
+        arg.a[++num_jobs] = K;
+    }
+
+    arg.num_ball_jobs = num_jobs;
+
+    /* the double terms have roughly uniform cost */
+    for (i = 1; i <= num_double; i++)
+        arg.a[num_jobs + i] = K + ((N - K + 1) * i) / num_double;
+
+    num_jobs += num_double;
+
+    arg.x = _fmprb_vec_init(num_jobs);
+    arg.sieve = sieve;
+    arg.n = n;
+    arg.N = N;
+    arg.use_doubles = use_doubles;
+
+    thread_pool_parallel_for(_partitions_hrr_worker, &arg, num_jobs, num_threads);
+
+    /* add the partial sums exactly */
+    fmprb_zero(x);
+    for (i = 0; i < num_jobs; i++)
+        fmprb_add(x, x, arg.x + i, FMPR_PREC_EXACT);
+
+    _fmprb_vec_clear(arg.x, num_jobs);
+    flint_free(arg.a);
+}
+
+void
+partitions_hrr_sum_fmprb_threaded(fmprb_t x, const fmpz_t n, long N, int use_doubles)
+{
+    partitions_hrr_sieve_t sieve;
+
+    if (flint_get_num_threads() < 2 || N < 2)
+    {
+        partitions_hrr_sum_fmprb(x, n, 1, N, use_doubles);
+        return;
+    }
+
+    partitions_hrr_sieve_init(sieve, N, 0);
+    _partitions_hrr_sum_fmprb_threaded(x, n, N, use_doubles, sieve);
+    partitions_hrr_sieve_clear(sieve);
+}
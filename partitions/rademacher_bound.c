@@ -32,7 +32,7 @@ _fmpr_sinh(fmpr_t y, const fmpr_t x, long prec)
     fmprb_init(t);
     fmprb_set_fmpr(t, x);
     fmprb_sinh(t, t, prec);
-    fmpr_add(y, fmprb_midref(t), fmprb_radref(t), prec, FMPR_RND_UP);
+    fmprb_get_ubound_fmpr(y, t, prec);
     fmprb_clear(t);
 }
 
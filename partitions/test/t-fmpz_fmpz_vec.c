@@ -0,0 +1,85 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "partitions.h"
+
+int main(void)
+{
+    flint_rand_t state;
+    long iter;
+
+    printf("fmpz_fmpz_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100; iter++)
+    {
+        fmpz * n;
+        fmpz * p;
+        fmpz_t q;
+        long i, len;
+        ulong start;
+        int use_doubles;
+
+        len = 1 + n_randint(state, 30);
+        start = n_randint(state, 2) ? n_randint(state, 200) : n_randint(state, 1000000);
+        use_doubles = n_randint(state, 2);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        n = _fmpz_vec_init(len);
+        p = _fmpz_vec_init(len);
+        fmpz_init(q);
+
+        for (i = 0; i < len; i++)
+            fmpz_set_ui(n + i, start + n_randint(state, 100));
+
+        partitions_fmpz_fmpz_vec(p, n, len, use_doubles);
+
+        for (i = 0; i < len; i++)
+        {
+            partitions_fmpz_fmpz(q, n + i, use_doubles);
+
+            if (!fmpz_equal(p + i, q))
+            {
+                printf("FAIL\n");
+                printf("n = "); fmpz_print(n + i); printf("\n");
+                printf("vec = "); fmpz_print(p + i); printf("\n");
+                printf("single = "); fmpz_print(q); printf("\n");
+                abort();
+            }
+        }
+
+        _fmpz_vec_clear(n, len);
+        _fmpz_vec_clear(p, len);
+        fmpz_clear(q);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
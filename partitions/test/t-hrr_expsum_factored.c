@@ -0,0 +1,130 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include <math.h>
+#include "partitions.h"
+
+static double
+eval_trig_prod_d(trig_prod_t prod)
+{
+    double s;
+    int i;
+
+    s = prod->prefactor;
+    s *= sqrt((double) prod->sqrt_p / (double) prod->sqrt_q);
+
+    for (i = 0; i < prod->n; i++)
+        s *= cos(3.141592653589793 * prod->cos_p[i] / (double) prod->cos_q[i]);
+
+    return s;
+}
+
+int main(void)
+{
+    flint_rand_t state;
+    partitions_hrr_sieve_t sieve1, sieve2;
+    long iter, N;
+
+    printf("hrr_expsum_factored....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    N = 10000;
+    partitions_hrr_sieve_init(sieve1, N, 0);
+    partitions_hrr_sieve_init(sieve2, N, 1);
+
+    for (iter = 0; iter < 100000; iter++)
+    {
+        trig_prod_t prod1, prod2, prod3;
+        ulong k, n;
+        double x1, x2, x3;
+
+        k = 1 + n_randint(state, N);
+        n = n_randtest(state);
+
+        trig_prod_init(prod1);
+        trig_prod_init(prod2);
+        trig_prod_init(prod3);
+
+        partitions_hrr_expsum_factored(prod1, k, n, sieve1);
+        partitions_hrr_expsum_factored(prod2, k, n, sieve2);
+        arith_hrr_expsum_factored(prod3, k, n % k);
+
+        x1 = eval_trig_prod_d(prod1);
+        x2 = eval_trig_prod_d(prod2);
+        x3 = eval_trig_prod_d(prod3);
+
+        if (fabs(x1 - x3) > 1e-8 * (1 + fabs(x3)) || x1 != x2)
+        {
+            printf("FAIL\n");
+            printf("k = %lu, n = %lu\n", k, n);
+            printf("x1 = %g, x2 = %g, x3 = %g\n", x1, x2, x3);
+            abort();
+        }
+    }
+
+    partitions_hrr_sieve_clear(sieve1);
+    partitions_hrr_sieve_clear(sieve2);
+
+    /* k beyond the sieved range */
+    N = PARTITIONS_HRR_SIEVE_MAX * 64;
+    partitions_hrr_sieve_init(sieve1, N, 1);
+
+    for (iter = 0; iter < 10000; iter++)
+    {
+        trig_prod_t prod1, prod3;
+        ulong k, n;
+        double x1, x3;
+
+        k = PARTITIONS_HRR_SIEVE_MAX + 1 +
+            n_randint(state, N - PARTITIONS_HRR_SIEVE_MAX);
+        n = n_randtest(state);
+
+        trig_prod_init(prod1);
+        trig_prod_init(prod3);
+
+        partitions_hrr_expsum_factored(prod1, k, n, sieve1);
+        arith_hrr_expsum_factored(prod3, k, n % k);
+
+        x1 = eval_trig_prod_d(prod1);
+        x3 = eval_trig_prod_d(prod3);
+
+        if (fabs(x1 - x3) > 1e-8 * (1 + fabs(x3)))
+        {
+            printf("FAIL (large k)\n");
+            printf("k = %lu, n = %lu\n", k, n);
+            printf("x1 = %g, x3 = %g\n", x1, x3);
+            abort();
+        }
+    }
+
+    partitions_hrr_sieve_clear(sieve1);
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
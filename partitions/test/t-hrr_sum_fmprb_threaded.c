@@ -0,0 +1,81 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "partitions.h"
+
+long partitions_hrr_needed_terms(double n);
+
+int main(void)
+{
+    flint_rand_t state;
+    long iter;
+
+    printf("hrr_sum_fmprb_threaded....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 200; iter++)
+    {
+        fmprb_t x, y;
+        fmpz_t n;
+        long N;
+        int use_doubles;
+
+        fmprb_init(x);
+        fmprb_init(y);
+        fmpz_init(n);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        fmpz_set_ui(n, 3 + n_randint(state, 1000000));
+        use_doubles = n_randint(state, 2);
+
+        N = partitions_hrr_needed_terms(fmpz_get_d(n));
+        N = 1 + n_randint(state, N + 1);
+
+        partitions_hrr_sum_fmprb(x, n, 1, N, use_doubles);
+        partitions_hrr_sum_fmprb_threaded(y, n, N, use_doubles);
+
+        if (!fmprb_overlaps(x, y))
+        {
+            printf("FAIL: overlap\n\n");
+            printf("n = "); fmpz_print(n); printf("\n\n");
+            printf("N = %ld, use_doubles = %d\n\n", N, use_doubles);
+            printf("x = "); fmprb_printd(x, 30); printf("\n\n");
+            printf("y = "); fmprb_printd(y, 30); printf("\n\n");
+            abort();
+        }
+
+        fmprb_clear(x);
+        fmprb_clear(y);
+        fmpz_clear(n);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
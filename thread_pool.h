@@ -0,0 +1,62 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include "flint.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+  A process-wide pool of persistent worker threads. The workers are
+  created on first use and are kept alive between calls, so that their
+  thread-local caches (constants, Bernoulli numbers, etc.) survive.
+
+  A job consists of the iterations 0 <= i < n of a loop. The iterations
+  are initially split into equal contiguous ranges, one per thread; a
+  thread that runs out of work steals half of the remaining range of
+  another thread. Only one job runs at a time: a call made while the
+  pool is busy (in particular, a nested call from inside a job) simply
+  runs the loop in the calling thread.
+*/
+
+typedef void (*thread_pool_func_t)(void * arg, long i);
+
+void thread_pool_parallel_for(thread_pool_func_t func, void * arg,
+    long n, long num_threads);
+
+long thread_pool_num_workers(void);
+
+void thread_pool_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -0,0 +1,320 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include <pthread.h>
+#include "thread_pool.h"
+
+/* a range of remaining iterations; the owner takes iterations from
+   the start and thieves take half of the range from the end */
+typedef struct
+{
+    pthread_mutex_t lock;
+    long start;
+    long end;
+}
+thread_pool_range_struct;
+
+typedef struct
+{
+    pthread_mutex_t busy;       /* held by the thread running a job */
+    pthread_mutex_t lock;       /* protects the fields below */
+    pthread_cond_t wake;        /* signalled when a job is posted */
+    pthread_cond_t done;        /* signalled when a worker finishes */
+    pthread_t * threads;
+    long num_workers;
+    long generation;
+    long working;
+    int shutdown;
+    thread_pool_func_t func;
+    void * arg;
+    thread_pool_range_struct * ranges;
+    long num_ranges;
+    long alloc_ranges;
+}
+thread_pool_struct;
+
+static thread_pool_struct pool = {
+    PTHREAD_MUTEX_INITIALIZER,
+    PTHREAD_MUTEX_INITIALIZER,
+    PTHREAD_COND_INITIALIZER,
+    PTHREAD_COND_INITIALIZER,
+    NULL, 0, 0, 0, 0, NULL, NULL, NULL, 0, 0
+};
+
+static int
+_thread_pool_pop(long k, long * i)
+{
+    thread_pool_range_struct * r = pool.ranges + k;
+    int found;
+
+    pthread_mutex_lock(&r->lock);
+    found = (r->start < r->end);
+    if (found)
+        *i = r->start++;
+    pthread_mutex_unlock(&r->lock);
+
+    return found;
+}
+
+/* moves half of the remaining work of some other thread to range k */
+static int
+_thread_pool_steal(long k)
+{
+    thread_pool_range_struct * r;
+    long j, start, end;
+
+    for (j = 1; j < pool.num_ranges; j++)
+    {
+        r = pool.ranges + (k + j) % pool.num_ranges;
+
+        pthread_mutex_lock(&r->lock);
+        start = r->start;
+        end = r->end;
+        if (start < end)
+        {
+            start = end - (end - start + 1) / 2;
+            r->end = start;
+        }
+        pthread_mutex_unlock(&r->lock);
+
+        if (start < end)
+        {
+            r = pool.ranges + k;
+            pthread_mutex_lock(&r->lock);
+            r->start = start;
+            r->end = end;
+            pthread_mutex_unlock(&r->lock);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static void
+_thread_pool_work(long k)
+{
+    long i;
+
+    for (;;)
+    {
+        if (_thread_pool_pop(k, &i))
+            pool.func(pool.arg, i);
+        else if (!_thread_pool_steal(k))
+            break;
+    }
+}
+
+static TLS_PREFIX int _thread_pool_is_worker = 0;
+
+static void *
+_thread_pool_worker(void * arg_ptr)
+{
+    long k, generation;
+
+    /* the generation must be taken from the creating thread, since the
+       job that caused this worker to be created may be posted before
+       the worker gets to run */
+    k = ((long *) arg_ptr)[0];
+    generation = ((long *) arg_ptr)[1];
+    flint_free(arg_ptr);
+
+    _thread_pool_is_worker = 1;
+
+    pthread_mutex_lock(&pool.lock);
+
+    for (;;)
+    {
+        while (!pool.shutdown && pool.generation == generation)
+            pthread_cond_wait(&pool.wake, &pool.lock);
+
+        if (pool.shutdown)
+            break;
+
+        generation = pool.generation;
+
+        /* the job may use fewer threads than there are workers;
+           range 0 belongs to the thread that posted the job */
+        if (k + 1 < pool.num_ranges)
+        {
+            pthread_mutex_unlock(&pool.lock);
+            _thread_pool_work(k + 1);
+            pthread_mutex_lock(&pool.lock);
+
+            pool.working--;
+            if (pool.working == 0)
+                pthread_cond_signal(&pool.done);
+        }
+    }
+
+    pthread_mutex_unlock(&pool.lock);
+
+    /* free the thread-local caches of this worker */
+    flint_cleanup();
+    return NULL;
+}
+
+static void
+_thread_pool_fit_ranges(long num_ranges)
+{
+    long i;
+
+    if (num_ranges <= pool.alloc_ranges)
+        return;
+
+    /* no job is running, so the mutexes can be reallocated */
+    for (i = 0; i < pool.alloc_ranges; i++)
+        pthread_mutex_destroy(&pool.ranges[i].lock);
+
+    pool.ranges = flint_realloc(pool.ranges,
+        sizeof(thread_pool_range_struct) * num_ranges);
+
+    for (i = 0; i < num_ranges; i++)
+        pthread_mutex_init(&pool.ranges[i].lock, NULL);
+
+    pool.alloc_ranges = num_ranges;
+}
+
+static void
+_thread_pool_fit_workers(long num_workers)
+{
+    long i, * k;
+
+    if (num_workers <= pool.num_workers)
+        return;
+
+    if (pool.num_workers == 0)
+        flint_register_cleanup_function(thread_pool_clear);
+
+    pool.threads = flint_realloc(pool.threads, sizeof(pthread_t) * num_workers);
+
+    for (i = pool.num_workers; i < num_workers; i++)
+    {
+        k = flint_malloc(2 * sizeof(long));
+        k[0] = i;
+        k[1] = pool.generation;
+
+        if (pthread_create(pool.threads + i, NULL, _thread_pool_worker, k) != 0)
+        {
+            printf("exception: thread_pool: unable to create thread\n");
+            abort();
+        }
+    }
+
+    pool.num_workers = num_workers;
+}
+
+void
+thread_pool_parallel_for(thread_pool_func_t func, void * arg,
+    long n, long num_threads)
+{
+    long i;
+
+    num_threads = FLINT_MIN(num_threads, n);
+
+    if (num_threads <= 1 || pthread_mutex_trylock(&pool.busy) != 0)
+    {
+        for (i = 0; i < n; i++)
+            func(arg, i);
+        return;
+    }
+
+    pthread_mutex_lock(&pool.lock);
+
+    _thread_pool_fit_workers(num_threads - 1);
+    _thread_pool_fit_ranges(num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        pool.ranges[i].start = (n * i) / num_threads;
+        pool.ranges[i].end = (n * (i + 1)) / num_threads;
+    }
+
+    pool.func = func;
+    pool.arg = arg;
+    pool.num_ranges = num_threads;
+    pool.working = num_threads - 1;
+    pool.generation++;
+
+    pthread_cond_broadcast(&pool.wake);
+    pthread_mutex_unlock(&pool.lock);
+
+    _thread_pool_work(0);
+
+    pthread_mutex_lock(&pool.lock);
+    while (pool.working != 0)
+        pthread_cond_wait(&pool.done, &pool.lock);
+    pthread_mutex_unlock(&pool.lock);
+
+    pthread_mutex_unlock(&pool.busy);
+}
+
+long
+thread_pool_num_workers(void)
+{
+    long n;
+
+    pthread_mutex_lock(&pool.lock);
+    n = pool.num_workers;
+    pthread_mutex_unlock(&pool.lock);
+
+    return n;
+}
+
+void
+thread_pool_clear(void)
+{
+    long i;
+
+    if (_thread_pool_is_worker)
+        return;
+
+    /* wait for any running job */
+    pthread_mutex_lock(&pool.busy);
+
+    pthread_mutex_lock(&pool.lock);
+    pool.shutdown = 1;
+    pthread_cond_broadcast(&pool.wake);
+    pthread_mutex_unlock(&pool.lock);
+
+    for (i = 0; i < pool.num_workers; i++)
+        pthread_join(pool.threads[i], NULL);
+
+    for (i = 0; i < pool.alloc_ranges; i++)
+        pthread_mutex_destroy(&pool.ranges[i].lock);
+
+    flint_free(pool.threads);
+    flint_free(pool.ranges);
+
+    pool.threads = NULL;
+    pool.ranges = NULL;
+    pool.num_workers = 0;
+    pool.num_ranges = 0;
+    pool.alloc_ranges = 0;
+    pool.shutdown = 0;
+
+    pthread_mutex_unlock(&pool.busy);
+}
+
@@ -0,0 +1,108 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "thread_pool.h"
+#include "ulong_extras.h"
+
+typedef struct
+{
+    long * counts;
+    long inner;
+    long num_threads;
+}
+test_arg_t;
+
+static void
+count(void * arg_ptr, long i)
+{
+    ((test_arg_t *) arg_ptr)->counts[i]++;
+}
+
+/* every iteration runs a nested job on its own block of counters */
+static void
+nested(void * arg_ptr, long i)
+{
+    test_arg_t * arg = (test_arg_t *) arg_ptr;
+    test_arg_t inner;
+
+    inner.counts = arg->counts + i * arg->inner;
+    thread_pool_parallel_for(count, &inner, arg->inner, arg->num_threads);
+}
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("parallel_for....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 10000; iter++)
+    {
+        test_arg_t arg;
+        long i, n, outer, num_threads;
+
+        num_threads = 1 + n_randint(state, 8);
+        outer = n_randint(state, 2) ? 0 : n_randint(state, 20);
+        n = n_randint(state, 1000);
+
+        arg.inner = outer ? n_randint(state, 50) : n;
+        arg.num_threads = num_threads;
+        n = outer ? outer * arg.inner : n;
+
+        arg.counts = flint_calloc(n + 1, sizeof(long));
+
+        if (outer)
+            thread_pool_parallel_for(nested, &arg, outer, num_threads);
+        else
+            thread_pool_parallel_for(count, &arg, n, num_threads);
+
+        for (i = 0; i < n; i++)
+        {
+            if (arg.counts[i] != 1)
+            {
+                printf("FAIL\n\n");
+                printf("iter = %ld, n = %ld, outer = %ld, num_threads = %ld\n",
+                    iter, n, outer, num_threads);
+                printf("i = %ld, count = %ld\n", i, arg.counts[i]);
+                abort();
+            }
+        }
+
+        flint_free(arg.counts);
+
+        /* the pool must be restartable */
+        if (n_randint(state, 100) == 0)
+            thread_pool_clear();
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -53,6 +53,10 @@ void zeta_series_em_choose_param(fmpr_t bound, ulong * N, ulong * M, const fmpcb
 void zeta_series_em_bound(fmpr_t bound, const fmpcb_t s, const fmpcb_t a, long N, long M, long d, long wp);
 void zeta_series_em_vec_bound(fmprb_ptr vec, const fmpcb_t s, const fmpcb_t a, ulong N, ulong M, long d, long wp);
 void zeta_series(fmpcb_ptr z, const fmpcb_t s, const fmpcb_t a, int deflate, long d, long prec);
+void zeta_series_vec_a(fmpcb_ptr z, const fmpcb_t s, fmpcb_srcptr a, long num, int deflate, long d, long prec);
+
+void zeta_vec_critical_line(fmpcb_ptr z, const fmprb_t t0, const fmprb_t dt, long num, long prec);
+void zeta_vec_riemann_siegel_z(fmprb_ptr z, const fmprb_t t0, const fmprb_t dt, long num, long prec);
 
 void zeta_log_ui_from_prev(fmprb_t s, ulong k, fmprb_t log_prev, ulong prev, long prec);
 
@@ -60,6 +64,10 @@ void zeta_powsum_series_naive(fmpcb_ptr z, const fmpcb_t s, const fmpcb_t a, lon
 void zeta_powsum_one_series_sieved(fmpcb_ptr z, const fmpcb_t s, long n, long len, long prec);
 void zeta_powsum_series_naive_threaded(fmpcb_ptr z,
     const fmpcb_t s, const fmpcb_t a, long n, long len, long prec);
+void zeta_powsum_one_series_sieved_threaded(fmpcb_ptr z,
+    const fmpcb_t s, long n, long len, long prec);
+
+void zeta_vec_sum_tree(fmpcb_ptr z, fmpcb_ptr vecs, long num, long len, long prec);
 
 void zeta_em_tail_naive(fmpcb_ptr sum, const fmpcb_t s, const fmpcb_t Na, fmpcb_srcptr Nasx, long M, long len, long prec);
 void zeta_em_tail_bsplit(fmpcb_ptr z, const fmpcb_t s, const fmpcb_t Na, fmpcb_srcptr Nasx, long M, long len, long prec);
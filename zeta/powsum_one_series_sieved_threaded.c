@@ -0,0 +1,331 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "zeta.h"
+#include "fmpcb.h"
+#include "fmpcb_poly.h"
+#include "thread_pool.h"
+
+#define POWER(_k) (arg->powers + (((_k)-1)/2) * (arg->len))
+#define DIVISOR(_k) (arg->divisors[((_k)-1)/2])
+
+typedef struct
+{
+    fmpcb_srcptr s;
+    long n;
+    long len;
+    long prec;
+    int critical_line;
+    int integer;
+
+    /* DIVISOR(k) is a prime factor of odd composite k, or 0 */
+    long * divisors;
+
+    /* POWER(k) = k^(-(s+x)) for odd k <= n/3 */
+    fmpcb_ptr powers;
+
+    /* the odd k <= n/3 to fill in during the current level */
+    const long * klist;
+    long knum;
+
+    /* per-chunk sums of k^(-(s+x)) over odd k with
+       floor(log2(n/k)) = j, for 0 <= j < num_buckets */
+    fmpcb_ptr buckets;
+    long num_buckets;
+    long num_chunks;
+}
+sieve_arg_t;
+
+/* t = k^(-(s+x)); logk holds log(prev) on input if prev != 0 and
+   is updated to log(k) when the logarithm is needed */
+static void
+_sieve_power(fmpcb_ptr t, long k, fmprb_t logk, long * prev,
+    const sieve_arg_t * arg)
+{
+    fmprb_t v, w;
+    fmpcb_srcptr s = arg->s;
+    long i, len = arg->len, prec = arg->prec;
+
+    fmprb_init(v);
+    fmprb_init(w);
+
+    if (!arg->integer || len != 1)
+    {
+        if (*prev == 0)
+            fmprb_log_ui(logk, k, prec);
+        else
+            zeta_log_ui_from_prev(logk, k, logk, *prev, prec);
+
+        *prev = k;
+    }
+
+    if (arg->integer)
+    {
+        fmprb_neg(w, fmpcb_realref(s));
+        fmprb_set_ui(v, k);
+        fmprb_pow(fmpcb_realref(t), v, w, prec);
+        fmprb_zero(fmpcb_imagref(t));
+    }
+    else
+    {
+        fmprb_mul(w, logk, fmpcb_imagref(s), prec);
+        fmprb_neg(w, w);
+        fmprb_sin_cos(fmpcb_imagref(t), fmpcb_realref(t), w, prec);
+
+        if (arg->critical_line)
+        {
+            fmprb_rsqrt_ui(w, k, prec);
+        }
+        else
+        {
+            fmprb_mul(w, fmpcb_realref(s), logk, prec);
+            fmprb_neg(w, w);
+            fmprb_exp(w, w, prec);
+        }
+
+        fmpcb_mul_fmprb(t, t, w, prec);
+    }
+
+    for (i = 1; i < len; i++)
+    {
+        fmpcb_mul_fmprb(t + i, t + i - 1, logk, prec);
+        fmpcb_div_si(t + i, t + i, -i, prec);
+    }
+
+    fmprb_clear(v);
+    fmprb_clear(w);
+}
+
+/* t = POWER(d) * POWER(k/d) */
+static void
+_sieve_product(fmpcb_ptr t, long k, long d, const sieve_arg_t * arg)
+{
+    if (arg->len == 1)
+        fmpcb_mul(t, POWER(d), POWER(k / d), arg->prec);
+    else
+        _fmpcb_poly_mullow(t, POWER(d), arg->len,
+            POWER(k / d), arg->len, arg->len, arg->prec);
+}
+
+/* fills in POWER(k) for a chunk of the current level */
+static void
+_sieve_level_worker(void * arg_ptr, long c)
+{
+    const sieve_arg_t * arg = (const sieve_arg_t *) arg_ptr;
+    long i, i0, i1, k, prev;
+    fmprb_t logk;
+
+    fmprb_init(logk);
+
+    i0 = (arg->knum * c) / arg->num_chunks;
+    i1 = (arg->knum * (c + 1)) / arg->num_chunks;
+    prev = 0;
+
+    for (i = i0; i < i1; i++)
+    {
+        k = arg->klist[i];
+
+        if (DIVISOR(k) == 0)
+            _sieve_power(POWER(k), k, logk, &prev, arg);
+        else
+            _sieve_product(POWER(k), k, DIVISOR(k), arg);
+    }
+
+    fmprb_clear(logk);
+}
+
+/* adds up k^(-(s+x)) for a chunk of the odd k <= n */
+static void
+_sieve_sum_worker(void * arg_ptr, long c)
+{
+    const sieve_arg_t * arg = (const sieve_arg_t *) arg_ptr;
+    long i, i0, i1, k, j, prev, len, num_odd;
+    fmpcb_ptr t, out;
+    fmprb_t logk;
+
+    len = arg->len;
+    num_odd = (arg->n + 1) / 2;
+    out = arg->buckets + c * arg->num_buckets * len;
+
+    t = _fmpcb_vec_init(len);
+    fmprb_init(logk);
+
+    i0 = (num_odd * c) / arg->num_chunks;
+    i1 = (num_odd * (c + 1)) / arg->num_chunks;
+    prev = 0;
+
+    for (i = i0; i < i1; i++)
+    {
+        k = 2 * i + 1;
+
+        /* the largest j with k 2^j <= n */
+        j = FLINT_BIT_COUNT(arg->n / k) - 1;
+
+        if (k * 3 <= arg->n)
+        {
+            _fmpcb_vec_add(out + j * len, out + j * len, POWER(k), len, arg->prec);
+        }
+        else
+        {
+            if (DIVISOR(k) == 0)
+                _sieve_power(t, k, logk, &prev, arg);
+            else
+                _sieve_product(t, k, DIVISOR(k), arg);
+
+            _fmpcb_vec_add(out + j * len, out + j * len, t, len, arg->prec);
+        }
+    }
+
+    _fmpcb_vec_clear(t, len);
+    fmprb_clear(logk);
+}
+
+void
+zeta_powsum_one_series_sieved_threaded(fmpcb_ptr z, const fmpcb_t s,
+    long n, long len, long prec)
+{
+    sieve_arg_t arg_struct;
+    sieve_arg_t * arg = &arg_struct;
+    long * level;
+    long * klist;
+    long * offset;
+    long i, j, k, ibound, num_small, max_level, num_threads, prev;
+    fmpcb_ptr t, u, x;
+    fmprb_t logk;
+
+    num_threads = flint_get_num_threads();
+
+    if (n < 100 || num_threads < 2)
+    {
+        zeta_powsum_one_series_sieved(z, s, n, len, prec);
+        return;
+    }
+
+    arg->s = s;
+    arg->n = n;
+    arg->len = len;
+    arg->prec = prec;
+
+    arg->critical_line = fmprb_is_exact(fmpcb_realref(s)) &&
+        (fmpr_cmp_2exp_si(fmprb_midref(fmpcb_realref(s)), -1) == 0);
+
+    arg->integer = fmprb_is_zero(fmpcb_imagref(s)) &&
+        fmprb_is_int(fmpcb_realref(s));
+
+    arg->divisors = flint_calloc(n / 2 + 1, sizeof(long));
+    arg->powers = _fmpcb_vec_init((n / 6 + 1) * len);
+
+    ibound = n_sqrt(n);
+    for (i = 3; i <= ibound; i += 2)
+        if (DIVISOR(i) == 0)
+            for (j = i * i; j <= n; j += 2 * i)
+                DIVISOR(j) = i;
+
+    /* level(k) = number of prime factors of odd k <= n/3, counted with
+       multiplicity; the powers on each level only depend on the powers
+       on lower levels, so each level can be filled in parallel */
+    num_small = (n / 3 + 1) / 2;
+    level = flint_calloc(num_small + 1, sizeof(long));
+    klist = flint_malloc(sizeof(long) * (num_small + 1));
+
+    max_level = 0;
+    for (i = 1; i < num_small; i++)
+    {
+        k = 2 * i + 1;
+
+        if (DIVISOR(k) == 0)
+            level[i] = 1;
+        else
+            level[i] = level[(k / DIVISOR(k) - 1) / 2] + 1;
+
+        max_level = FLINT_MAX(max_level, level[i]);
+    }
+
+    offset = flint_calloc(max_level + 2, sizeof(long));
+    for (i = 1; i < num_small; i++)
+        offset[level[i] + 1]++;
+    for (i = 1; i <= max_level + 1; i++)
+        offset[i] += offset[i - 1];
+    for (i = 1; i < num_small; i++)
+        klist[offset[level[i]]++] = 2 * i + 1;
+    for (i = max_level + 1; i > 0; i--)
+        offset[i] = offset[i - 1];
+    offset[0] = 0;
+
+    if (num_small > 0)
+        fmpcb_one(POWER(1));
+
+    for (j = 1; j <= max_level; j++)
+    {
+        arg->klist = klist + offset[j];
+        arg->knum = offset[j + 1] - offset[j];
+        arg->num_chunks = FLINT_MIN(arg->knum, 16 * num_threads);
+
+        thread_pool_parallel_for(_sieve_level_worker, arg,
+            arg->num_chunks, num_threads);
+    }
+
+    /* add up all odd k, keeping the sums for different powers of two
+       apart so that the chunks are independent */
+    arg->num_buckets = FLINT_BIT_COUNT(n);
+    arg->num_chunks = FLINT_MIN((n + 1) / 2, 16 * num_threads);
+    arg->buckets = _fmpcb_vec_init(arg->num_chunks * arg->num_buckets * len);
+
+    thread_pool_parallel_for(_sieve_sum_worker, arg,
+        arg->num_chunks, num_threads);
+
+    t = _fmpcb_vec_init(arg->num_buckets * len);
+    u = _fmpcb_vec_init(len);
+    x = _fmpcb_vec_init(len);
+    fmprb_init(logk);
+
+    zeta_vec_sum_tree(t, arg->buckets, arg->num_chunks,
+        arg->num_buckets * len, prec);
+
+    /* x = 2^(-(s+x)) */
+    prev = 0;
+    _sieve_power(x, 2, logk, &prev, arg);
+
+    /* z = sum_j x^j sum_{i >= j} bucket_i by Horner's rule */
+    _fmpcb_vec_zero(z, len);
+
+    for (j = arg->num_buckets - 1; j >= 0; j--)
+    {
+        _fmpcb_vec_add(u, u, t + j * len, len, prec);
+        _fmpcb_poly_mullow(arg->buckets, z, len, x, len, len, prec);
+        _fmpcb_vec_add(z, arg->buckets, u, len, prec);
+    }
+
+    flint_free(arg->divisors);
+    flint_free(level);
+    flint_free(klist);
+    flint_free(offset);
+    _fmpcb_vec_clear(arg->powers, (n / 6 + 1) * len);
+    _fmpcb_vec_clear(arg->buckets, arg->num_chunks * arg->num_buckets * len);
+    _fmpcb_vec_clear(t, arg->num_buckets * len);
+    _fmpcb_vec_clear(u, len);
+    _fmpcb_vec_clear(x, len);
+    fmprb_clear(logk);
+}
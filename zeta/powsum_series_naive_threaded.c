@@ -23,10 +23,10 @@
 
 ******************************************************************************/
 
-#include <pthread.h>
 #include "zeta.h"
 #include "fmpcb.h"
 #include "fmpcb_poly.h"
+#include "thread_pool.h"
 
 typedef struct
 {
@@ -41,10 +41,10 @@ typedef struct
 }
 powsum_arg_t;
 
-void *
-_zeta_powsum_evaluator(void * arg_ptr)
+static void
+_zeta_powsum_evaluator(void * args, long j)
 {
-    powsum_arg_t arg = *((powsum_arg_t *) arg_ptr);
+    powsum_arg_t arg = ((powsum_arg_t *) args)[j];
     long i, k;
 
     fmpcb_t t, u, v;
@@ -94,29 +94,28 @@ _zeta_powsum_evaluator(void * arg_ptr)
     fmpcb_clear(u);
     fmpcb_clear(v);
     fmprb_clear(f);
-
-    flint_cleanup();
-
-    return NULL;
 }
 
 void
 zeta_powsum_series_naive_threaded(fmpcb_ptr z,
     const fmpcb_t s, const fmpcb_t a, long n, long len, long prec)
 {
-    pthread_t * threads;
     powsum_arg_t * args;
-    long i, num_threads;
+    fmpcb_ptr partial;
+    long i, num_threads, num_tasks;
     int split_each_term;
 
     num_threads = flint_get_num_threads();
+    split_each_term = (len > 1000);
 
-    threads = flint_malloc(sizeof(pthread_t) * num_threads);
-    args = flint_malloc(sizeof(powsum_arg_t) * num_threads);
+    /* use a few tasks per thread, so that the work can be balanced */
+    num_tasks = FLINT_MIN(4 * num_threads, split_each_term ? len : n);
+    num_tasks = FLINT_MAX(num_tasks, 1);
 
-    split_each_term = (len > 1000);
+    args = flint_malloc(sizeof(powsum_arg_t) * num_tasks);
+    partial = split_each_term ? NULL : _fmpcb_vec_init(num_tasks * len);
 
-    for (i = 0; i < num_threads; i++)
+    for (i = 0; i < num_tasks; i++)
     {
         args[i].s = s;
         args[i].a = a;
@@ -124,8 +123,8 @@ zeta_powsum_series_naive_threaded(fmpcb_ptr z,
         if (split_each_term)
         {
             long n0, n1;
-            n0 = (len * i) / num_threads;
-            n1 = (len * (i + 1)) / num_threads;
+            n0 = (len * i) / num_tasks;
+            n1 = (len * (i + 1)) / num_tasks;
             args[i].z = z + n0;
             args[i].n0 = 0;
             args[i].n1 = n;
@@ -134,33 +133,25 @@ zeta_powsum_series_naive_threaded(fmpcb_ptr z,
         }
         else
         {
-            args[i].z = _fmpcb_vec_init(len);
-            args[i].n0 = (n * i) / num_threads;
-            args[i].n1 = (n * (i + 1)) / num_threads;
+            args[i].z = partial + i * len;
+            args[i].n0 = (n * i) / num_tasks;
+            args[i].n1 = (n * (i + 1)) / num_tasks;
             args[i].d0 = 0;
             args[i].len = len;
         }
 
         args[i].prec = prec;
-        pthread_create(&threads[i], NULL, _zeta_powsum_evaluator, &args[i]);
     }
 
-    for (i = 0; i < num_threads; i++)
-    {
-        pthread_join(threads[i], NULL);
-    }
+    thread_pool_parallel_for(_zeta_powsum_evaluator, args,
+        num_tasks, num_threads);
 
     if (!split_each_term)
     {
-        _fmpcb_vec_zero(z, len);
-        for (i = 0; i < num_threads; i++)
-        {
-            _fmpcb_vec_add(z, z, args[i].z, len, prec);
-            _fmpcb_vec_clear(args[i].z, len);
-        }
+        zeta_vec_sum_tree(z, partial, num_tasks, len, prec);
+        _fmpcb_vec_clear(partial, num_tasks * len);
     }
 
-    flint_free(threads);
     flint_free(args);
 }
 
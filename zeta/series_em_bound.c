@@ -135,8 +135,7 @@ fmpcb_rfac_abs_ubound2(fmpr_t bound, const fmpcb_t s, ulong n, long prec)
 
     /* we add t = 2*a to each term. note that this can be signed;
        we always want the most positive value */
-    fmpr_add(t, fmprb_midref(fmpcb_realref(s)),
-        fmprb_radref(fmpcb_realref(s)), prec, FMPR_RND_CEIL);
+    fmprb_get_ubound_fmpr(t, fmpcb_realref(s), prec);
     fmpr_mul_2exp_si(t, t, 1);
 
     for (k = 0; k < n; k++)
@@ -159,7 +158,7 @@ bound_rfac(fmprb_ptr F, const fmpcb_t s, ulong n, long len, long wp)
     if (len == 1)
     {
         fmpcb_rfac_abs_ubound2(fmprb_midref(F + 0), s, n, wp);
-        fmpr_zero(fmprb_radref(F + 0));
+        mag_zero(fmprb_radref(F + 0));
     }
     else
     {
@@ -202,7 +201,7 @@ zeta_series_em_vec_bound(fmprb_ptr bound, const fmpcb_t s, const fmpcb_t a, ulon
         for (k = 0; k < len; k++)
         {
             fmpr_pos_inf(fmprb_midref(bound + k));
-            fmpr_zero(fmprb_radref(bound + k));
+            mag_zero(fmprb_radref(bound + k));
         }
         return;
     }
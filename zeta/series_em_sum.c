@@ -65,35 +65,18 @@ void _fmpcb_poly_fmpcb_invpow_cpx(fmpcb_ptr res, const fmpcb_t N, const fmpcb_t
     fmpcb_clear(logN);
 }
 
+/* sum += the integral and boundary terms of the Euler-Maclaurin formula,
+   and sets Na = N + a and t = 1/(N+a)^(s+x), where t needs space for
+   d + 1 coefficients */
 void
-zeta_series_em_sum(fmpcb_ptr z, const fmpcb_t s, const fmpcb_t a, int deflate, ulong N, ulong M, long d, long prec)
+_zeta_series_em_sum_boundary(fmpcb_ptr sum, fmpcb_ptr t, fmpcb_t Na,
+    const fmpcb_t s, const fmpcb_t a, int deflate, ulong N, long d, long prec)
 {
-    fmpcb_ptr t, u, v, term, sum;
-    fmpcb_t Na;
+    fmpcb_ptr u, v;
     long i;
 
-    t = _fmpcb_vec_init(d + 1);
     u = _fmpcb_vec_init(d);
     v = _fmpcb_vec_init(d);
-    term = _fmpcb_vec_init(d);
-    sum = _fmpcb_vec_init(d);
-    fmpcb_init(Na);
-
-    prec += 2 * (FLINT_BIT_COUNT(N) + FLINT_BIT_COUNT(d));
-
-    /* sum 1/(k+a)^(s+x) */
-    if (fmpcb_is_one(a) && d <= 3)
-    {
-        zeta_powsum_one_series_sieved(sum, s, N, d, prec);
-    }
-    else if (N > 50 && flint_get_num_threads() > 1)
-    {
-        zeta_powsum_series_naive_threaded(sum, s, a, N, d, prec);
-    }
-    else
-    {
-        zeta_powsum_series_naive(sum, s, a, N, d, prec);
-    }
 
     /* t = 1/(N+a)^(s+x); we might need one extra term for deflation */
     fmpcb_add_ui(Na, a, N, prec);
@@ -154,6 +137,42 @@ zeta_series_em_sum(fmpcb_ptr z, const fmpcb_t s, const fmpcb_t a, int deflate, u
     _fmpcb_vec_scalar_mul_2exp_si(u, t, d, -1L);
     _fmpcb_vec_add(sum, sum, u, d, prec);
 
+    _fmpcb_vec_clear(u, d);
+    _fmpcb_vec_clear(v, d);
+}
+
+void
+zeta_series_em_sum(fmpcb_ptr z, const fmpcb_t s, const fmpcb_t a, int deflate, ulong N, ulong M, long d, long prec)
+{
+    fmpcb_ptr t, u, sum;
+    fmpcb_t Na;
+
+    t = _fmpcb_vec_init(d + 1);
+    u = _fmpcb_vec_init(d);
+    sum = _fmpcb_vec_init(d);
+    fmpcb_init(Na);
+
+    prec += 2 * (FLINT_BIT_COUNT(N) + FLINT_BIT_COUNT(d));
+
+    /* sum 1/(k+a)^(s+x) */
+    if (fmpcb_is_one(a) && d <= 3)
+    {
+        if (N > 50 && flint_get_num_threads() > 1)
+            zeta_powsum_one_series_sieved_threaded(sum, s, N, d, prec);
+        else
+            zeta_powsum_one_series_sieved(sum, s, N, d, prec);
+    }
+    else if (N > 50 && flint_get_num_threads() > 1)
+    {
+        zeta_powsum_series_naive_threaded(sum, s, a, N, d, prec);
+    }
+    else
+    {
+        zeta_powsum_series_naive(sum, s, a, N, d, prec);
+    }
+
+    _zeta_series_em_sum_boundary(sum, t, Na, s, a, deflate, N, d, prec);
+
     /* Euler-Maclaurin formula tail */
     if (d < 5 || d < M / 10)
         zeta_em_tail_naive(u, s, Na, t, M, d, prec);
@@ -164,9 +183,6 @@ zeta_series_em_sum(fmpcb_ptr z, const fmpcb_t s, const fmpcb_t a, int deflate, u
 
     _fmpcb_vec_clear(t, d + 1);
     _fmpcb_vec_clear(u, d);
-    _fmpcb_vec_clear(v, d);
-    _fmpcb_vec_clear(term, d);
     _fmpcb_vec_clear(sum, d);
     fmpcb_clear(Na);
 }
-
@@ -27,6 +27,7 @@
 #include "fmpcb.h"
 #include "fmpcb_poly.h"
 #include "bernoulli.h"
+#include "thread_pool.h"
 
 static void
 bsplit(fmpcb_ptr P, fmpcb_ptr T, const fmpcb_t s, const fmpcb_t Na,
@@ -121,10 +122,117 @@ bsplit(fmpcb_ptr P, fmpcb_ptr T, const fmpcb_t s, const fmpcb_t Na,
     }
 }
 
+/* below this many terms per thread, the tail is computed serially */
+#define TAIL_BSPLIT_THREAD_CUTOFF 16
+
+typedef struct
+{
+    fmpcb_ptr P;
+    fmpcb_ptr T;
+    long * plen;
+    fmpcb_srcptr s;
+    fmpcb_srcptr Na;
+    long M;
+    long num;
+    long step;
+    long len;
+    long prec;
+}
+tail_bsplit_arg_t;
+
+/* computes P_i, T_i for the i-th of num equal ranges of terms */
+static void
+_tail_bsplit_leaf_worker(void * arg_ptr, long i)
+{
+    const tail_bsplit_arg_t * arg = (const tail_bsplit_arg_t *) arg_ptr;
+    long a, b;
+
+    a = (arg->M * i) / arg->num;
+    b = (arg->M * (i + 1)) / arg->num;
+
+    /* the shared Bernoulli cache has already been extended to 2M
+       by zeta_em_tail_bsplit */
+    arg->plen[i] = FLINT_MIN(2 * (b - a) + 1, arg->len);
+
+    bsplit(arg->P + i * arg->len, arg->T + i * arg->len,
+        arg->s, arg->Na, a, b, 1, arg->len, arg->prec);
+}
+
+/* merges the ranges i and i + step: P = P1 * P2, T = T1 + P1 * T2 */
+static void
+_tail_bsplit_merge_worker(void * arg_ptr, long j)
+{
+    const tail_bsplit_arg_t * arg = (const tail_bsplit_arg_t *) arg_ptr;
+    fmpcb_ptr P1, T1, P2, T2, U;
+    long i, len1, len2, plen;
+
+    i = 2 * arg->step * j;
+
+    if (i + arg->step >= arg->num)
+        return;
+
+    P1 = arg->P + i * arg->len;
+    T1 = arg->T + i * arg->len;
+    P2 = arg->P + (i + arg->step) * arg->len;
+    T2 = arg->T + (i + arg->step) * arg->len;
+    len1 = arg->plen[i];
+    len2 = arg->plen[i + arg->step];
+    plen = FLINT_MIN(len1 + len2 - 1, arg->len);
+
+    U = _fmpcb_vec_init(arg->len);
+
+    _fmpcb_poly_mullow(U, T2, len2, P1, len1, plen, arg->prec);
+    _fmpcb_vec_add(T1, U, T1, len1, arg->prec);
+    _fmpcb_vec_set(T1 + len1, U + len1, plen - len1);
+
+    _fmpcb_poly_mullow(U, P2, len2, P1, len1, plen, arg->prec);
+    _fmpcb_vec_set(P1, U, plen);
+
+    arg->plen[i] = plen;
+
+    _fmpcb_vec_clear(U, arg->len);
+}
+
+static void
+_zeta_em_tail_bsplit_threaded(fmpcb_ptr P, fmpcb_ptr T, const fmpcb_t s,
+    const fmpcb_t Na, long M, long len, long num, long num_threads, long prec)
+{
+    tail_bsplit_arg_t arg;
+    long num_pairs;
+
+    arg.P = _fmpcb_vec_init(num * len);
+    arg.T = _fmpcb_vec_init(num * len);
+    arg.plen = flint_malloc(sizeof(long) * num);
+    arg.s = s;
+    arg.Na = Na;
+    arg.M = M;
+    arg.num = num;
+    arg.len = len;
+    arg.prec = prec;
+
+    thread_pool_parallel_for(_tail_bsplit_leaf_worker, &arg, num, num_threads);
+
+    /* parallel tree reduction of the products */
+    for (arg.step = 1; arg.step < num; arg.step *= 2)
+    {
+        num_pairs = (num - arg.step + 2 * arg.step - 1) / (2 * arg.step);
+        thread_pool_parallel_for(_tail_bsplit_merge_worker, &arg,
+            num_pairs, num_threads);
+    }
+
+    _fmpcb_vec_set(P, arg.P, len);
+    _fmpcb_vec_set(T, arg.T, len);
+
+    _fmpcb_vec_clear(arg.P, num * len);
+    _fmpcb_vec_clear(arg.T, num * len);
+    flint_free(arg.plen);
+}
+
 void
 zeta_em_tail_bsplit(fmpcb_ptr z, const fmpcb_t s, const fmpcb_t Na, fmpcb_srcptr Nasx, long M, long len, long prec)
 {
     fmpcb_ptr P, T;
+    long num_threads;
 
     if (M < 1)
     {
@@ -137,7 +245,18 @@ zeta_em_tail_bsplit(fmpcb_ptr z, const fmpcb_t s, const fmpcb_t Na, fmpcb_srcptr
     P = _fmpcb_vec_init(len);
     T = _fmpcb_vec_init(len);
 
-    bsplit(P, T, s, Na, 0, M, 0, len, prec);
+    num_threads = flint_get_num_threads();
+
+    if (num_threads > 1 && M >= 2 * TAIL_BSPLIT_THREAD_CUTOFF)
+    {
+        /* a few ranges per thread, for load balancing */
+        long num = FLINT_MIN(4 * num_threads, M / TAIL_BSPLIT_THREAD_CUTOFF);
+        _zeta_em_tail_bsplit_threaded(P, T, s, Na, M, len, num, num_threads, prec);
+    }
+    else
+    {
+        bsplit(P, T, s, Na, 0, M, 0, len, prec);
+    }
 
     _fmpcb_poly_mullow(z, T, len, Nasx, len, len, prec);
 
@@ -0,0 +1,248 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "zeta.h"
+#include "fmpcb.h"
+#include "fmpcb_poly.h"
+#include "bernoulli.h"
+#include "thread_pool.h"
+
+void _fmpcb_poly_mullow_cpx(fmpcb_ptr res, fmpcb_srcptr src, long len,
+    const fmpcb_t c, long trunc, long prec);
+
+void _zeta_series_em_sum_boundary(fmpcb_ptr sum, fmpcb_ptr t, fmpcb_t Na,
+    const fmpcb_t s, const fmpcb_t a, int deflate, ulong N, long d, long prec);
+
+typedef struct
+{
+    fmpcb_ptr z;
+    fmpcb_srcptr s;
+    fmpcb_srcptr a;
+    fmpcb_srcptr coeffs;
+    ulong * Nj;
+    ulong * Mj;
+    ulong N;
+    ulong M;
+    int deflate;
+    int threaded_powsum;
+    long d;
+    long prec;
+}
+vec_a_arg_t;
+
+static void
+_zeta_vec_a_choose_param(void * arg_ptr, long j)
+{
+    const vec_a_arg_t * arg = (const vec_a_arg_t *) arg_ptr;
+    fmpr_t bound;
+
+    fmpr_init(bound);
+    zeta_series_em_choose_param(bound, arg->Nj + j, arg->Mj + j, arg->s,
+        arg->a + j, FLINT_MIN(arg->d, 2), arg->prec, FMPRB_RAD_PREC);
+    fmpr_clear(bound);
+}
+
+/* coeffs[r-1] = B_(2r) (s+x)_(2r-1) / (2r)! for 1 <= r <= M, so that
+   the Euler-Maclaurin tail is (N+a)^(-(s+x)) sum_r coeffs[r-1] (N+a)^(1-2r),
+   where only the scalar powers of N+a depend on a */
+static void
+_zeta_vec_a_tail_coeffs(fmpcb_ptr coeffs, const fmpcb_t s, ulong M, long d, long prec)
+{
+    fmpcb_ptr q;
+    fmpcb_t c;
+    fmprb_t b;
+    fmpz_t f;
+    ulong r;
+
+    q = _fmpcb_vec_init(d);
+    fmpcb_init(c);
+    fmprb_init(b);
+    fmpz_init(f);
+
+    BERNOULLI_ENSURE_CACHED(2 * M);
+
+    /* q = (s+x) / 2 */
+    fmpcb_mul_2exp_si(q, s, -1);
+    if (d > 1)
+    {
+        fmpcb_one(q + 1);
+        fmpcb_mul_2exp_si(q + 1, q + 1, -1);
+    }
+
+    for (r = 1; r <= M; r++)
+    {
+        fmprb_set_round_fmpz(b, fmpq_numref(bernoulli_cache + 2 * r), prec);
+        fmprb_div_fmpz(b, b, fmpq_denref(bernoulli_cache + 2 * r), prec);
+        _fmpcb_vec_scalar_mul_fmprb(coeffs + (r - 1) * d, q, d, b, prec);
+
+        /* q *= ((s+x)+2r-1)((s+x)+2r) / ((2r+1)(2r+2)) */
+        if (r < M)
+        {
+            fmpcb_add_ui(c, s, 2 * r - 1, prec);
+            _fmpcb_poly_mullow_cpx(q, q, d, c, d, prec);
+            fmpcb_add_ui(c, s, 2 * r, prec);
+            _fmpcb_poly_mullow_cpx(q, q, d, c, d, prec);
+            fmpz_set_ui(f, 2 * r + 1);
+            fmpz_mul_ui(f, f, 2 * r + 2);
+            _fmpcb_vec_scalar_div_fmpz(q, q, d, f, prec);
+        }
+    }
+
+    _fmpcb_vec_clear(q, d);
+    fmpcb_clear(c);
+    fmprb_clear(b);
+    fmpz_clear(f);
+}
+
+static void
+_zeta_vec_a_worker(void * arg_ptr, long j)
+{
+    const vec_a_arg_t * arg = (const vec_a_arg_t *) arg_ptr;
+    fmpcb_ptr sum, t, u, z;
+    fmprb_ptr vb;
+    fmpcb_t Na, w;
+    fmpr_t bound;
+    long i, d, prec;
+    ulong r;
+
+    d = arg->d;
+    prec = arg->prec;
+    z = arg->z + j * d;
+
+    sum = _fmpcb_vec_init(d);
+    t = _fmpcb_vec_init(d + 1);
+    u = _fmpcb_vec_init(d);
+    vb = _fmprb_vec_init(d);
+    fmpcb_init(Na);
+    fmpcb_init(w);
+    fmpr_init(bound);
+
+    if (arg->threaded_powsum)
+        zeta_powsum_series_naive_threaded(sum, arg->s, arg->a + j, arg->N, d, prec);
+    else
+        zeta_powsum_series_naive(sum, arg->s, arg->a + j, arg->N, d, prec);
+
+    _zeta_series_em_sum_boundary(sum, t, Na, arg->s, arg->a + j,
+        arg->deflate, arg->N, d, prec);
+
+    /* u = sum_r coeffs[r-1] w^(r-1) with w = 1/(N+a)^2 */
+    if (arg->M >= 1)
+    {
+        fmpcb_mul(w, Na, Na, prec);
+        fmpcb_inv(w, w, prec);
+
+        _fmpcb_vec_set(u, arg->coeffs + (arg->M - 1) * d, d);
+
+        for (r = arg->M - 1; r >= 1; r--)
+        {
+            _fmpcb_vec_scalar_mul(u, u, d, w, prec);
+            _fmpcb_vec_add(u, u, arg->coeffs + (r - 1) * d, d, prec);
+        }
+
+        /* sum += t u / (N+a) */
+        _fmpcb_vec_scalar_div(u, u, d, Na, prec);
+        _fmpcb_poly_mullow(z, t, d, u, d, d, prec);
+        _fmpcb_vec_add(z, z, sum, d, prec);
+    }
+    else
+    {
+        _fmpcb_vec_set(z, sum, d);
+    }
+
+    zeta_series_em_vec_bound(vb, arg->s, arg->a + j, arg->N, arg->M, d,
+        FMPRB_RAD_PREC);
+
+    for (i = 0; i < d; i++)
+    {
+        fmprb_get_abs_ubound_fmpr(bound, vb + i, FMPRB_RAD_PREC);
+        fmprb_add_error_fmpr(fmpcb_realref(z + i), bound);
+        fmprb_add_error_fmpr(fmpcb_imagref(z + i), bound);
+    }
+
+    _fmpcb_vec_clear(sum, d);
+    _fmpcb_vec_clear(t, d + 1);
+    _fmpcb_vec_clear(u, d);
+    _fmprb_vec_clear(vb, d);
+    fmpcb_clear(Na);
+    fmpcb_clear(w);
+    fmpr_clear(bound);
+}
+
+void
+zeta_series_vec_a(fmpcb_ptr z, const fmpcb_t s, fmpcb_srcptr a, long num,
+    int deflate, long d, long prec)
+{
+    vec_a_arg_t arg;
+    fmpcb_ptr coeffs;
+    long j, num_threads;
+
+    if (d < 1 || num < 1)
+        return;
+
+    num_threads = flint_get_num_threads();
+
+    arg.z = z;
+    arg.s = s;
+    arg.a = a;
+    arg.deflate = deflate;
+    arg.d = d;
+    arg.prec = prec;
+    arg.Nj = flint_malloc(sizeof(ulong) * num);
+    arg.Mj = flint_malloc(sizeof(ulong) * num);
+
+    /* common parameters: the largest needed for any a_j */
+    thread_pool_parallel_for(_zeta_vec_a_choose_param, &arg, num, num_threads);
+
+    arg.N = arg.M = 0;
+    for (j = 0; j < num; j++)
+    {
+        arg.N = FLINT_MAX(arg.N, arg.Nj[j]);
+        arg.M = FLINT_MAX(arg.M, arg.Mj[j]);
+    }
+
+    arg.prec = prec + 2 * (FLINT_BIT_COUNT(arg.N) + FLINT_BIT_COUNT(d));
+
+    /* the tail coefficients are shared by all a_j */
+    coeffs = _fmpcb_vec_init(arg.M * d);
+    _zeta_vec_a_tail_coeffs(coeffs, s, arg.M, d, arg.prec);
+    arg.coeffs = coeffs;
+
+    /* with fewer shifts than threads, parallelise each power sum instead */
+    arg.threaded_powsum = (num < num_threads && arg.N > 50);
+
+    if (arg.threaded_powsum)
+    {
+        for (j = 0; j < num; j++)
+            _zeta_vec_a_worker(&arg, j);
+    }
+    else
+    {
+        thread_pool_parallel_for(_zeta_vec_a_worker, &arg, num, num_threads);
+    }
+
+    _fmpcb_vec_clear(coeffs, arg.M * d);
+    flint_free(arg.Nj);
+    flint_free(arg.Mj);
+}
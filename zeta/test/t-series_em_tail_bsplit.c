@@ -83,6 +83,56 @@ int main()
         _fmpcb_vec_clear(z2, len);
     }
 
+    /* large M with several threads, to exercise the threaded splitting */
+    for (iter = 0; iter < 300; iter++)
+    {
+        fmpcb_t Na, s;
+        fmpcb_ptr z1, z2, Nasx;
+        long i, M, len, prec;
+
+        prec = 2 + n_randint(state, 400);
+        len = 1 + n_randint(state, 30);
+        M = n_randint(state, 200);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        fmpcb_init(Na);
+        fmpcb_init(s);
+
+        Nasx = _fmpcb_vec_init(len);
+        z1 = _fmpcb_vec_init(len);
+        z2 = _fmpcb_vec_init(len);
+
+        fmpcb_randtest(Na, state, prec, 4);
+        fmpcb_randtest(s, state, prec, 4);
+
+        _fmpcb_poly_fmpcb_invpow_cpx(Nasx, Na, s, len, prec);
+
+        zeta_em_tail_naive(z1, s, Na, Nasx, M, len, prec);
+        zeta_em_tail_bsplit(z2, s, Na, Nasx, M, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            if (!fmpcb_overlaps(z1 + i, z2 + i))
+            {
+                printf("FAIL: overlap (threaded)\n\n");
+                printf("iter = %ld\n", iter);
+                printf("prec = %ld, len = %ld, M = %ld\n", prec, len, M);
+                printf("s = "); fmpcb_printd(s, prec / 3.33); printf("\n\n");
+                printf("Na = "); fmpcb_printd(Na, prec / 3.33); printf("\n\n");
+                printf("z1 = "); fmpcb_printd(z1 + i, prec / 3.33); printf("\n\n");
+                printf("z2 = "); fmpcb_printd(z2 + i, prec / 3.33); printf("\n\n");
+                abort();
+            }
+        }
+
+        fmpcb_clear(Na);
+        fmpcb_clear(s);
+        _fmpcb_vec_clear(z1, len);
+        _fmpcb_vec_clear(z2, len);
+        _fmpcb_vec_clear(Nasx, len);
+    }
+
     flint_randclear(state);
     flint_cleanup();
     printf("PASS\n");
@@ -0,0 +1,120 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "zeta.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("series_vec_a....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 300; iter++)
+    {
+        fmpcb_t s;
+        fmpcb_ptr a, z1, z2;
+        long i, j, num, len, prec1, prec2;
+        int deflate;
+
+        fmpcb_init(s);
+
+        if (n_randint(state, 2))
+        {
+            fmpcb_randtest(s, state, 1 + n_randint(state, 300), 3);
+        }
+        else
+        {
+            fmprb_set_ui(fmpcb_realref(s), 1);
+            fmprb_mul_2exp_si(fmpcb_realref(s), fmpcb_realref(s), -1);
+            fmprb_randtest(fmpcb_imagref(s), state, 1 + n_randint(state, 300), 4);
+        }
+
+        num = 1 + n_randint(state, 8);
+        a = _fmpcb_vec_init(num);
+
+        for (j = 0; j < num; j++)
+        {
+            switch (n_randint(state, 3))
+            {
+                case 0:
+                    fmpcb_randtest(a + j, state, 1 + n_randint(state, 300), 3);
+                    break;
+                case 1:
+                    fmprb_randtest(fmpcb_realref(a + j), state, 1 + n_randint(state, 300), 3);
+                    break;
+                case 2:
+                    fmpcb_one(a + j);
+                    break;
+            }
+        }
+
+        prec1 = 2 + n_randint(state, 300);
+        prec2 = prec1 + 30;
+        len = 1 + n_randint(state, 20);
+
+        deflate = n_randint(state, 2);
+
+        z1 = _fmpcb_vec_init(num * len);
+        z2 = _fmpcb_vec_init(len);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        zeta_series_vec_a(z1, s, a, num, deflate, len, prec1);
+
+        for (j = 0; j < num; j++)
+        {
+            zeta_series(z2, s, a + j, deflate, len, prec2);
+
+            for (i = 0; i < len; i++)
+            {
+                if (!fmpcb_overlaps(z1 + j * len + i, z2 + i))
+                {
+                    printf("FAIL: overlap\n\n");
+                    printf("iter = %ld\n", iter);
+                    printf("deflate = %d, len = %ld, j = %ld, i = %ld\n\n", deflate, len, j, i);
+                    printf("s = "); fmpcb_printd(s, prec1 / 3.33); printf("\n\n");
+                    printf("a = "); fmpcb_printd(a + j, prec1 / 3.33); printf("\n\n");
+                    printf("z1 = "); fmpcb_printd(z1 + j * len + i, prec1 / 3.33); printf("\n\n");
+                    printf("z2 = "); fmpcb_printd(z2 + i, prec2 / 3.33); printf("\n\n");
+                    abort();
+                }
+            }
+        }
+
+        fmpcb_clear(s);
+        _fmpcb_vec_clear(a, num);
+        _fmpcb_vec_clear(z1, num * len);
+        _fmpcb_vec_clear(z2, len);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,116 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "zeta.h"
+#include "fmprb_poly.h"
+
+int main()
+{
+    long iter;
+    flint_rand_t state;
+
+    printf("vec_critical_line....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 300; iter++)
+    {
+        fmprb_t t0, dt;
+        fmpcb_ptr z;
+        fmprb_ptr y;
+        fmpcb_t s, w;
+        fmprb_poly_t h, Z;
+        long j, num, prec1, prec2;
+
+        num = 1 + n_randint(state, 20);
+        prec1 = 2 + n_randint(state, 200);
+        prec2 = 2 + n_randint(state, 200);
+
+        fmprb_init(t0);
+        fmprb_init(dt);
+        fmpcb_init(s);
+        fmpcb_init(w);
+        fmprb_poly_init(h);
+        fmprb_poly_init(Z);
+        z = _fmpcb_vec_init(num);
+        y = _fmprb_vec_init(num);
+
+        fmprb_randtest(t0, state, 1 + n_randint(state, 200), 3);
+        fmprb_randtest(dt, state, 1 + n_randint(state, 200), 2);
+
+        zeta_vec_critical_line(z, t0, dt, num, prec1);
+        zeta_vec_riemann_siegel_z(y, t0, dt, num, prec1);
+
+        for (j = 0; j < num; j++)
+        {
+            fmprb_one(fmpcb_realref(s));
+            fmprb_mul_2exp_si(fmpcb_realref(s), fmpcb_realref(s), -1);
+            fmprb_mul_ui(fmpcb_imagref(s), dt, j, prec2);
+            fmprb_add(fmpcb_imagref(s), fmpcb_imagref(s), t0, prec2);
+
+            fmpcb_zeta(w, s, prec2);
+
+            if (!fmpcb_overlaps(z + j, w))
+            {
+                printf("FAIL: overlap (zeta)\n\n");
+                printf("j = %ld\n\n", j);
+                printf("s = "); fmpcb_printd(s, 15); printf("\n\n");
+                printf("z = "); fmpcb_printd(z + j, 15); printf("\n\n");
+                printf("w = "); fmpcb_printd(w, 15); printf("\n\n");
+                abort();
+            }
+
+            fmprb_poly_set_coeff_fmprb(h, 0, fmpcb_imagref(s));
+            fmprb_poly_riemann_siegel_z_series(Z, h, 1, prec2);
+            fmprb_poly_get_coeff_fmprb(fmpcb_realref(w), Z, 0);
+
+            if (!fmprb_overlaps(y + j, fmpcb_realref(w)))
+            {
+                printf("FAIL: overlap (Z)\n\n");
+                printf("j = %ld\n\n", j);
+                printf("t = "); fmprb_printd(fmpcb_imagref(s), 15); printf("\n\n");
+                printf("y = "); fmprb_printd(y + j, 15); printf("\n\n");
+                printf("Z = "); fmprb_printd(fmpcb_realref(w), 15); printf("\n\n");
+                abort();
+            }
+        }
+
+        fmprb_clear(t0);
+        fmprb_clear(dt);
+        fmpcb_clear(s);
+        fmpcb_clear(w);
+        fmprb_poly_clear(h);
+        fmprb_poly_clear(Z);
+        _fmpcb_vec_clear(z, num);
+        _fmprb_vec_clear(y, num);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
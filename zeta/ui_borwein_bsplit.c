@@ -24,6 +24,7 @@
 ******************************************************************************/
 
 #include "zeta.h"
+#include "bsplit.h"
 
 /* With parameter n, the error is bounded by 3/(3+sqrt(8))^n */
 #define ERROR_A 1.5849625007211561815 /* log2(3) */
@@ -93,6 +94,58 @@ zeta_coeff_k(zeta_bsplit_t S, long k, long n, long s)
     fmprb_set(S->C, S->Q1);
 }
 
+/* sets L to the combination of L = [m, b) with R = [a, m); the
+   independent multiplications are done in parallel */
+static void
+zeta_bsplit_merge(zeta_bsplit_t L, zeta_bsplit_t R,
+    int cont, long bits, long num_threads)
+{
+    fmprb_t u[11];
+    fmprb_ptr z[11];
+    fmprb_srcptr x[11], y[11];
+    long i, n;
+
+    for (i = 0; i < 11; i++)
+    {
+        fmprb_init(u[i]);
+        z[i] = u[i];
+    }
+
+    x[0] = L->B;  y[0] = R->D;
+    x[1] = L->A;  y[1] = R->C;
+    x[2] = R->B;  y[2] = L->Q3;
+    x[3] = L->A;  y[3] = R->Q3;
+    x[4] = R->A;  y[4] = L->Q3;
+    x[5] = L->C;  y[5] = R->D;
+    x[6] = R->C;  y[6] = L->Q1;
+    x[7] = L->Q1; y[7] = R->Q1;
+    x[8] = L->Q3; y[8] = R->Q3;
+    x[9] = L->D;  y[9] = R->D;
+    x[10] = L->Q2; y[10] = R->Q2;
+    n = cont ? 11 : 9;
+
+    bsplit_fmprb_mul_batch(z, x, y, n, bits, num_threads);
+
+    /* B = (B D2 + A C2) Q2_2 + B2 Q3 */
+    fmprb_add(L->B, u[0], u[1], bits);
+    fmprb_mul(L->B, L->B, R->Q2, bits);
+    fmprb_add(L->B, L->B, u[2], bits);
+
+    fmprb_add(L->A, u[3], u[4], bits);
+    fmprb_add(L->C, u[5], u[6], bits);
+    fmprb_swap(L->Q1, u[7]);
+    fmprb_swap(L->Q3, u[8]);
+
+    if (cont)
+    {
+        fmprb_swap(L->D, u[9]);
+        fmprb_swap(L->Q2, u[10]);
+    }
+
+    for (i = 0; i < 11; i++)
+        fmprb_clear(u[i]);
+}
+
 static void
 zeta_bsplit(zeta_bsplit_t L, long a, long b,
     long n, long s, int cont, long bits)
@@ -112,29 +165,52 @@ zeta_bsplit(zeta_bsplit_t L, long a, long b,
         zeta_bsplit_init(R);
         zeta_bsplit(R, a, m, n, s, 1, bits);
 
-        fmprb_mul(L->B, L->B, R->D, bits);
-        fmprb_addmul(L->B, L->A, R->C, bits);
+        zeta_bsplit_merge(L, R, cont, bits, 1);
+
+        zeta_bsplit_clear(R);
+    }
+}
+
+typedef struct
+{
+    long n;
+    long s;
+    long bits;
+}
+zeta_bsplit_arg_t;
 
-        fmprb_mul(L->B, L->B, R->Q2, bits);
-        fmprb_addmul(L->B, R->B, L->Q3, bits);
+static void
+_zeta_bsplit_init(void * state, void * args)
+{
+    zeta_bsplit_init(state);
+}
 
-        fmprb_mul(L->A, L->A, R->Q3, bits);
-        fmprb_addmul(L->A, R->A, L->Q3, bits);
+static void
+_zeta_bsplit_clear(void * state, void * args)
+{
+    zeta_bsplit_clear(state);
+}
 
-        fmprb_mul(L->C, L->C, R->D, bits);
-        fmprb_addmul(L->C, R->C, L->Q1, bits);
+static void
+_zeta_bsplit_basecase(void * state, long a, long b, int cont, void * args)
+{
+    zeta_bsplit_arg_t * arg = args;
+    zeta_bsplit(state, a, b, arg->n, arg->s, cont, arg->bits);
+}
 
-        if (cont)
-        {
-            fmprb_mul(L->D, L->D, R->D, bits);
-            fmprb_mul(L->Q2, L->Q2, R->Q2, bits);
-        }
+static void
+_zeta_bsplit_merge(void * X, void * Y, long a, long m, long b,
+    int cont, long num_threads, void * args)
+{
+    zeta_bsplit_arg_t * arg = args;
+    zeta_bsplit_state t;
 
-        fmprb_mul(L->Q1, L->Q1, R->Q1, bits);
-        fmprb_mul(L->Q3, L->Q3, R->Q3, bits);
+    /* the merge combines into the state for the upper range */
+    zeta_bsplit_merge(Y, X, cont, arg->bits, num_threads);
 
-        zeta_bsplit_clear(R);
-    }
+    t = *((zeta_bsplit_state *) X);
+    *((zeta_bsplit_state *) X) = *((zeta_bsplit_state *) Y);
+    *((zeta_bsplit_state *) Y) = t;
 }
 
 /* The error for eta(s) is bounded by 3/(3+sqrt(8))^n */
@@ -151,6 +227,8 @@ void
 zeta_ui_borwein_bsplit(fmprb_t x, ulong s, long prec)
 {
     zeta_bsplit_t sum;
+    zeta_bsplit_arg_t arg;
+    bsplit_t B;
     fmpr_t err;
     long wp, n;
 
@@ -158,7 +236,7 @@ zeta_ui_borwein_bsplit(fmprb_t x, ulong s, long prec)
     if (s == 0)
     {
         fmpr_set_si_2exp_si(fmprb_midref(x), -1, -1);
-        fmpr_zero(fmprb_radref(x));
+        mag_zero(fmprb_radref(x));
         return;
     }
 
@@ -171,8 +249,19 @@ zeta_ui_borwein_bsplit(fmprb_t x, ulong s, long prec)
     n = prec / ERROR_B + 2;
     wp = prec + 30;
 
+    arg.n = n;
+    arg.s = s;
+    arg.bits = wp;
+
+    B->size = sizeof(zeta_bsplit_state);
+    B->init = _zeta_bsplit_init;
+    B->clear = _zeta_bsplit_clear;
+    B->basecase = _zeta_bsplit_basecase;
+    B->merge = _zeta_bsplit_merge;
+    B->args = &arg;
+
     zeta_bsplit_init(sum);
-    zeta_bsplit(sum, 0, n + 1, n, s, 0, wp);
+    bsplit_eval(sum, B, 0, n + 1, 0, flint_get_num_threads());
 
     /*  A/Q3 - B/Q3 / (C/Q1) = (A*C - B*Q1) / (Q3*C)    */
     fmprb_mul(sum->A, sum->A, sum->C, wp);
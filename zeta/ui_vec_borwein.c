@@ -88,7 +88,7 @@ zeta_ui_vec_borwein(fmprb_ptr z, ulong start, long num, ulong step, long prec)
 
         fmprb_set_fmpz(x, zeta + k);
         /* the error in each term in the main loop is < 2 */
-        fmpr_set_ui(fmprb_radref(x), 2 * n);
+        mag_set_ui_2exp_si(fmprb_radref(x), 2 * n, 0);
         fmprb_div_fmpz(x, x, d, wp);
 
         /* mathematical error for eta(s), bounded by 3/(3+sqrt(8))^n */
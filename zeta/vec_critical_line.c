@@ -0,0 +1,239 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "zeta.h"
+#include "fmpcb.h"
+#include "fmpcb_poly.h"
+#include "bernoulli.h"
+#include "thread_pool.h"
+
+void _fmpcb_poly_fmpcb_invpow_cpx(fmpcb_ptr res,
+    const fmpcb_t N, const fmpcb_t c, long trunc, long prec);
+
+/* maximum number of consecutive points sharing the power sum; the
+   powers k^(-s) are updated by repeated multiplication within a block,
+   which loses about log2(block) bits */
+#define ZETA_VEC_BLOCK 1024
+
+typedef struct
+{
+    fmpcb_ptr z;
+    const fmprb_struct * t0;
+    const fmprb_struct * dt;
+    long num;
+    long block;
+    ulong N;
+    ulong M;
+    long prec;
+}
+zeta_vec_arg_t;
+
+/* s = 1/2 + (t0 + j dt) i */
+static void
+_zeta_vec_point(fmpcb_t s, const fmprb_t t0, const fmprb_t dt, long j, long prec)
+{
+    fmprb_mul_ui(fmpcb_imagref(s), dt, j, prec);
+    fmprb_add(fmpcb_imagref(s), fmpcb_imagref(s), t0, prec);
+    fmprb_one(fmpcb_realref(s));
+    fmprb_mul_2exp_si(fmpcb_realref(s), fmpcb_realref(s), -1);
+}
+
+/* z += the Euler-Maclaurin remainder for zeta(s) after N terms,
+   as in zeta_series_em_sum with a = 1, d = 1 */
+static void
+_zeta_vec_em_remainder(fmpcb_t z, const fmpcb_t s, ulong N, ulong M, long prec)
+{
+    fmpcb_t Na, t, u, v;
+
+    fmpcb_init(Na);
+    fmpcb_init(t);
+    fmpcb_init(u);
+    fmpcb_init(v);
+
+    /* t = 1/(N+1)^s */
+    fmpcb_set_ui(Na, N);
+    fmpcb_add_ui(Na, Na, 1, prec);
+    _fmpcb_poly_fmpcb_invpow_cpx(t, Na, s, 1, prec);
+
+    /* z += (N+1)^(1-s) / (s-1) */
+    fmpcb_sub_ui(v, s, 1, prec);
+    _fmpcb_poly_fmpcb_invpow_cpx(u, Na, v, 1, prec);
+    fmpcb_div(u, u, v, prec);
+    fmpcb_add(z, z, u, prec);
+
+    /* z += t / 2 */
+    fmpcb_mul_2exp_si(u, t, -1);
+    fmpcb_add(z, z, u, prec);
+
+    /* Euler-Maclaurin formula tail */
+    zeta_em_tail_naive(u, s, Na, t, M, 1, prec);
+    fmpcb_add(z, z, u, prec);
+
+    fmpcb_clear(Na);
+    fmpcb_clear(t);
+    fmpcb_clear(u);
+    fmpcb_clear(v);
+}
+
+static void
+_zeta_vec_block(void * arg_ptr, long b)
+{
+    const zeta_vec_arg_t * arg = (const zeta_vec_arg_t *) arg_ptr;
+    long j, start, len, prec;
+    ulong k;
+    fmpcb_ptr z;
+    fmpcb_t s, w, r, one;
+    fmprb_t logk, t, vb;
+    fmpr_t bound;
+
+    start = b * arg->block;
+    len = FLINT_MIN(arg->block, arg->num - start);
+    z = arg->z + start;
+    prec = arg->prec;
+
+    fmpcb_init(s);
+    fmpcb_init(w);
+    fmpcb_init(r);
+    fmpcb_init(one);
+    fmprb_init(logk);
+    fmprb_init(t);
+    fmprb_init(vb);
+    fmpr_init(bound);
+
+    _fmpcb_vec_zero(z, len);
+
+    _zeta_vec_point(s, arg->t0, arg->dt, start, prec);
+
+    /* sum k^(-s_j) for k = 1, ..., N, where s_j = s_0 + j dt i;
+       each term costs one exp and log per block and one
+       multiplication per point */
+    for (k = 1; k <= arg->N; k++)
+    {
+        fmprb_log_ui(logk, k, prec);
+
+        /* w = k^(-s_0) */
+        fmpcb_mul_fmprb(w, s, logk, prec);
+        fmpcb_neg(w, w);
+        fmpcb_exp(w, w, prec);
+
+        /* r = k^(-dt i) */
+        fmprb_mul(t, arg->dt, logk, prec);
+        fmprb_sin_cos(fmpcb_imagref(r), fmpcb_realref(r), t, prec);
+        fmprb_neg(fmpcb_imagref(r), fmpcb_imagref(r));
+
+        for (j = 0; j < len; j++)
+        {
+            fmpcb_add(z + j, z + j, w, prec);
+
+            if (j + 1 < len)
+                fmpcb_mul(w, w, r, prec);
+        }
+    }
+
+    fmpcb_one(one);
+
+    for (j = 0; j < len; j++)
+    {
+        _zeta_vec_point(s, arg->t0, arg->dt, start + j, prec);
+
+        _zeta_vec_em_remainder(z + j, s, arg->N, arg->M, prec);
+
+        /* add the error bound for this point */
+        zeta_series_em_vec_bound(vb, s, one, arg->N, arg->M, 1, FMPRB_RAD_PREC);
+        fmprb_get_abs_ubound_fmpr(bound, vb, FMPRB_RAD_PREC);
+        fmprb_add_error_fmpr(fmpcb_realref(z + j), bound);
+        fmprb_add_error_fmpr(fmpcb_imagref(z + j), bound);
+    }
+
+    fmpcb_clear(s);
+    fmpcb_clear(w);
+    fmpcb_clear(r);
+    fmpcb_clear(one);
+    fmprb_clear(logk);
+    fmprb_clear(t);
+    fmprb_clear(vb);
+    fmpr_clear(bound);
+}
+
+void
+zeta_vec_critical_line(fmpcb_ptr z, const fmprb_t t0, const fmprb_t dt,
+    long num, long prec)
+{
+    zeta_vec_arg_t arg;
+    long num_threads, num_blocks, wp;
+    ulong N, M;
+    fmpcb_t s, a;
+    fmpr_t bound;
+
+    if (num < 1)
+        return;
+
+    fmpcb_init(s);
+    fmpcb_init(a);
+    fmpr_init(bound);
+
+    fmpcb_one(a);
+
+    /* choose parameters for the endpoints of the grid; the bound is
+       computed separately for each point */
+    _zeta_vec_point(s, t0, dt, 0, prec);
+    zeta_series_em_choose_param(bound, &N, &M, s, a, 1, prec, FMPRB_RAD_PREC);
+
+    if (num > 1)
+    {
+        ulong N2, M2;
+
+        _zeta_vec_point(s, t0, dt, num - 1, prec);
+        zeta_series_em_choose_param(bound, &N2, &M2, s, a, 1, prec, FMPRB_RAD_PREC);
+
+        N = FLINT_MAX(N, N2);
+        M = FLINT_MAX(M, M2);
+    }
+
+    /* use at least as many blocks as threads */
+    num_threads = flint_get_num_threads();
+    arg.block = FLINT_MIN(ZETA_VEC_BLOCK, (num + num_threads - 1) / num_threads);
+    num_blocks = (num + arg.block - 1) / arg.block;
+
+    wp = prec + 2 * FLINT_BIT_COUNT(N) + FLINT_BIT_COUNT(arg.block) + 4;
+
+    /* the Bernoulli numbers used by the tail */
+    BERNOULLI_ENSURE_CACHED(2 * M);
+
+    arg.z = z;
+    arg.t0 = t0;
+    arg.dt = dt;
+    arg.num = num;
+    arg.N = N;
+    arg.M = M;
+    arg.prec = wp;
+
+    thread_pool_parallel_for(_zeta_vec_block, &arg, num_blocks, num_threads);
+
+    fmpcb_clear(s);
+    fmpcb_clear(a);
+    fmpr_clear(bound);
+}
+
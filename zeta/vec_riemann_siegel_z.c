@@ -0,0 +1,70 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "zeta.h"
+#include "fmprb_poly.h"
+
+void
+zeta_vec_riemann_siegel_z(fmprb_ptr z, const fmprb_t t0, const fmprb_t dt,
+    long num, long prec)
+{
+    fmpcb_ptr v;
+    fmprb_t t, theta, s, c;
+    long j, wp;
+
+    if (num < 1)
+        return;
+
+    wp = prec + 10;
+
+    v = _fmpcb_vec_init(num);
+    fmprb_init(t);
+    fmprb_init(theta);
+    fmprb_init(s);
+    fmprb_init(c);
+
+    zeta_vec_critical_line(v, t0, dt, num, wp);
+
+    /* Z(t) = exp(i theta(t)) zeta(1/2 + it), which is real */
+    for (j = 0; j < num; j++)
+    {
+        fmprb_mul_ui(t, dt, j, wp);
+        fmprb_add(t, t, t0, wp);
+
+        _fmprb_poly_riemann_siegel_theta_series(theta, t, 1, 1, wp);
+        fmprb_sin_cos(s, c, theta, wp);
+
+        fmprb_mul(c, c, fmpcb_realref(v + j), wp);
+        fmprb_mul(s, s, fmpcb_imagref(v + j), wp);
+        fmprb_sub(z + j, c, s, prec);
+    }
+
+    _fmpcb_vec_clear(v, num);
+    fmprb_clear(t);
+    fmprb_clear(theta);
+    fmprb_clear(s);
+    fmprb_clear(c);
+}
+
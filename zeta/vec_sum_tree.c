@@ -0,0 +1,91 @@
+/*=============================================================================
+
+    This file is part of ARB.
+
+    ARB is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    ARB is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with ARB; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Fredrik Johansson
+
+******************************************************************************/
+
+#include "zeta.h"
+#include "thread_pool.h"
+
+/* below this many coefficients per round, the reduction is done
+   in the calling thread */
+#define SUM_TREE_SERIAL_CUTOFF 64
+
+typedef struct
+{
+    fmpcb_ptr vecs;
+    long num;
+    long len;
+    long step;
+    long prec;
+}
+sum_tree_arg_t;
+
+static void
+_zeta_vec_sum_tree_worker(void * arg_ptr, long j)
+{
+    const sum_tree_arg_t * arg = (const sum_tree_arg_t *) arg_ptr;
+    long i = 2 * arg->step * j;
+
+    if (i + arg->step < arg->num)
+        _fmpcb_vec_add(arg->vecs + i * arg->len, arg->vecs + i * arg->len,
+            arg->vecs + (i + arg->step) * arg->len, arg->len, arg->prec);
+}
+
+void
+zeta_vec_sum_tree(fmpcb_ptr z, fmpcb_ptr vecs, long num, long len, long prec)
+{
+    sum_tree_arg_t arg;
+    long num_pairs, num_threads;
+
+    if (num < 1)
+    {
+        _fmpcb_vec_zero(z, len);
+        return;
+    }
+
+    num_threads = flint_get_num_threads();
+
+    arg.vecs = vecs;
+    arg.num = num;
+    arg.len = len;
+    arg.prec = prec;
+
+    for (arg.step = 1; arg.step < num; arg.step *= 2)
+    {
+        num_pairs = (num - arg.step + 2 * arg.step - 1) / (2 * arg.step);
+
+        if (num_threads > 1 && num_pairs * len >= SUM_TREE_SERIAL_CUTOFF)
+        {
+            thread_pool_parallel_for(_zeta_vec_sum_tree_worker, &arg,
+                num_pairs, num_threads);
+        }
+        else
+        {
+            long j;
+            for (j = 0; j < num_pairs; j++)
+                _zeta_vec_sum_tree_worker(&arg, j);
+        }
+    }
+
+    _fmpcb_vec_set(z, vecs, len);
+}